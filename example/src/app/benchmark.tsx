@@ -7,6 +7,7 @@ import {
 } from 'react-native';
 import { useLocalSearchParams, router } from 'expo-router';
 import Entypo from '@expo/vector-icons/Entypo';
+import { getRegexBackend } from 'react-native-libprisma';
 
 interface BenchmarkResult {
   language: string;
@@ -25,6 +26,7 @@ export default function BenchmarkScreen() {
   const sortedResults = [...results].sort(
     (a, b) => b.tokensPerSecond - a.tokensPerSecond
   );
+  const regexBackend = getRegexBackend();
 
   return (
     <View style={styles.container}>
@@ -39,6 +41,9 @@ export default function BenchmarkScreen() {
           </TouchableOpacity>
           <Text style={styles.title}>Benchmark Results</Text>
         </View>
+        <Text style={styles.subtitle}>
+          Regex backend: {regexBackend}
+        </Text>
       </View>
 
       {/* Results Table */}
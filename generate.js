@@ -432,7 +432,7 @@ async function saveBlob(blob, filename) {
   fs.writeFileSync(filename, buffer);
 }
 
-const filepath = 'libprisma/grammars.dat';
+const filepath = 'packages/react-native-libprisma/common/cpp/assets/grammars.dat';
 
 generate().then((blob) => {
   saveBlob(blob, filepath).then(() => {
@@ -0,0 +1,22 @@
+package com.margelo.nitro.libprisma;
+
+import android.content.res.AssetManager;
+
+import androidx.annotation.Keep;
+import androidx.annotation.Nullable;
+
+import com.facebook.react.bridge.ReactApplicationContext;
+import com.margelo.nitro.NitroModules;
+
+/**
+ * Gives native code access to the grammar image packaged as an asset.
+ */
+@Keep
+public class LibPrismaAssets {
+  @Keep
+  @Nullable
+  public static AssetManager getAssetManager() {
+    ReactApplicationContext context = NitroModules.Companion.getApplicationContext();
+    return context != null ? context.getAssets() : null;
+  }
+}
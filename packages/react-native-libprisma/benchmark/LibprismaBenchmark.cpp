@@ -0,0 +1,332 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+#include "GrammarImage.h"
+#include "Libprisma.hpp"
+#include "Samples.hpp"
+#include "SyntaxHighlighter.h"
+
+using namespace athex::libprisma;
+
+// Every allocation of the process goes through these, so the benchmarks can
+// report how many allocations and how much live memory a call needs. The
+// size is kept in a header in front of the block for operator delete.
+namespace {
+
+std::atomic<size_t> gAllocations{0};
+std::atomic<size_t> gAllocatedBytes{0};
+std::atomic<size_t> gLiveBytes{0};
+std::atomic<size_t> gPeakBytes{0};
+
+constexpr size_t kHeaderSize = alignof(std::max_align_t);
+
+void *allocate(size_t size) {
+  auto *block = static_cast<char *>(std::malloc(size + kHeaderSize));
+  if (block == nullptr) {
+    throw std::bad_alloc();
+  }
+  *reinterpret_cast<size_t *>(block) = size;
+
+  gAllocations.fetch_add(1, std::memory_order_relaxed);
+  gAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+  const size_t live = gLiveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+  size_t peak = gPeakBytes.load(std::memory_order_relaxed);
+  while (live > peak &&
+         !gPeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+  }
+  return block + kHeaderSize;
+}
+
+void deallocate(void *ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  char *block = static_cast<char *>(ptr) - kHeaderSize;
+  gLiveBytes.fetch_sub(*reinterpret_cast<size_t *>(block), std::memory_order_relaxed);
+  std::free(block);
+}
+
+} // namespace
+
+void *operator new(size_t size) { return allocate(size); }
+void *operator new[](size_t size) { return allocate(size); }
+void operator delete(void *ptr) noexcept { deallocate(ptr); }
+void operator delete[](void *ptr) noexcept { deallocate(ptr); }
+void operator delete(void *ptr, size_t) noexcept { deallocate(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { deallocate(ptr); }
+
+namespace {
+
+/**
+ * Allocations made while it is alive, summed over all iterations of a
+ * benchmark and reported as per-iteration counters
+ */
+class AllocationScope {
+public:
+  AllocationScope()
+      : m_allocations(gAllocations.load()), m_bytes(gAllocatedBytes.load()),
+        m_live(gLiveBytes.load()) {
+    gPeakBytes.store(m_live);
+  }
+
+  ~AllocationScope() {
+    s_allocations += gAllocations.load() - m_allocations;
+    s_bytes += gAllocatedBytes.load() - m_bytes;
+    s_peak = std::max(s_peak, gPeakBytes.load() - m_live);
+  }
+
+  static void reset() { s_allocations = s_bytes = s_peak = 0; }
+
+  static void report(benchmark::State &state) {
+    state.counters["allocs"] =
+        benchmark::Counter(static_cast<double>(s_allocations),
+                           benchmark::Counter::kAvgIterations);
+    state.counters["alloc_bytes"] = benchmark::Counter(
+        static_cast<double>(s_bytes), benchmark::Counter::kAvgIterations,
+        benchmark::Counter::kIs1024);
+    state.counters["peak_bytes"] =
+        benchmark::Counter(static_cast<double>(s_peak),
+                           benchmark::Counter::kDefaults,
+                           benchmark::Counter::kIs1024);
+  }
+
+private:
+  size_t m_allocations;
+  size_t m_bytes;
+  size_t m_live;
+
+  static inline size_t s_allocations = 0;
+  static inline size_t s_bytes = 0;
+  static inline size_t s_peak = 0;
+};
+
+size_t countTokens(const TokenList &tokens) {
+  size_t count = 0;
+  for (const auto &node : tokens) {
+    if (node.kind() == TokenListNode::Kind::Syntax) {
+      count += 1 + countTokens(static_cast<const Syntax &>(node).children());
+    }
+  }
+  return count;
+}
+
+std::string envOr(const char *name, const char *fallback) {
+  const char *value = std::getenv(name);
+  return value != nullptr && *value != '\0' ? value : fallback;
+}
+
+std::shared_ptr<const GrammarImage> gImage;
+std::unique_ptr<Libprisma> gLibprisma;
+
+void finish(benchmark::State &state, const Sample &sample, size_t tokens = 0) {
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * sample.code.size()));
+  if (tokens > 0) {
+    state.counters["tokens"] = static_cast<double>(tokens);
+  }
+  AllocationScope::report(state);
+}
+
+/**
+ * First tokenize call of a new highlighter: loads the grammar of the
+ * language from the mapped image and compiles its patterns
+ */
+void BM_TokenizeCold(benchmark::State &state, const Sample &sample) {
+  AllocationScope::reset();
+  size_t tokens = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto highlighter = std::make_unique<SyntaxHighlighter>(gImage);
+    state.ResumeTiming();
+    {
+      AllocationScope scope;
+      auto result = highlighter->tokenize(sample.code, sample.language);
+      benchmark::DoNotOptimize(result.head);
+      tokens = countTokens(result);
+    }
+    state.PauseTiming();
+    highlighter.reset();
+    state.ResumeTiming();
+  }
+  finish(state, sample, tokens);
+}
+
+/**
+ * Tokenize with the patterns of the language already compiled
+ */
+void BM_TokenizeWarm(benchmark::State &state, const Sample &sample) {
+  SyntaxHighlighter highlighter(gImage);
+  highlighter.preload(sample.language);
+
+  AllocationScope::reset();
+  size_t tokens = 0;
+  for (auto _ : state) {
+    AllocationScope scope;
+    auto result = highlighter.tokenize(sample.code, sample.language);
+    benchmark::DoNotOptimize(result.head);
+    tokens = countTokens(result);
+  }
+  finish(state, sample, tokens);
+}
+
+/**
+ * tokenize with the language already loaded, top-level tokens only
+ */
+void BM_TokenizeShallow(benchmark::State &state, const Sample &sample) {
+  SyntaxHighlighter highlighter(gImage);
+  highlighter.preload(sample.language);
+
+  TokenizeLimits limits;
+  limits.maxDepth = 1;
+
+  AllocationScope::reset();
+  size_t tokens = 0;
+  for (auto _ : state) {
+    AllocationScope scope;
+    TokenizeStats stats;
+    auto result = highlighter.tokenize(sample.code, sample.language, limits, stats);
+    benchmark::DoNotOptimize(result.head);
+    tokens = countTokens(result);
+  }
+  finish(state, sample, tokens);
+}
+
+/**
+ * JSON serialization of an already tokenized sample
+ */
+void BM_SerializeJson(benchmark::State &state, const Sample &sample) {
+  SyntaxHighlighter highlighter(gImage);
+  const auto result = highlighter.tokenize(sample.code, sample.language);
+
+  AllocationScope::reset();
+  for (auto _ : state) {
+    AllocationScope scope;
+    auto json = gLibprisma->tokensToJson(result);
+    benchmark::DoNotOptimize(json.data());
+  }
+  finish(state, sample, countTokens(result));
+}
+
+/**
+ * tokenizeToJson as called from JS, with the result cache disabled
+ */
+void BM_TokenizeToJson(benchmark::State &state, const Sample &sample) {
+  gLibprisma->tokenizeToJson(sample.code, sample.language);
+
+  AllocationScope::reset();
+  for (auto _ : state) {
+    AllocationScope scope;
+    auto json = gLibprisma->tokenizeToJson(sample.code, sample.language);
+    benchmark::DoNotOptimize(json.data());
+  }
+  finish(state, sample);
+}
+
+/**
+ * tokenizeToBuffer as called from JS, tokenize and binary encoding
+ */
+void BM_TokenizeToBuffer(benchmark::State &state, const Sample &sample) {
+  gLibprisma->tokenizeToBuffer(sample.code, sample.language);
+
+  AllocationScope::reset();
+  for (auto _ : state) {
+    AllocationScope scope;
+    auto buffer = gLibprisma->tokenizeToBuffer(sample.code, sample.language);
+    benchmark::DoNotOptimize(buffer.data());
+  }
+  finish(state, sample);
+}
+
+/**
+ * tokenizeToLines as called from JS, tokenize and line runs
+ */
+void BM_TokenizeToLines(benchmark::State &state, const Sample &sample) {
+  gLibprisma->tokenizeToLines(sample.code, sample.language);
+
+  AllocationScope::reset();
+  for (auto _ : state) {
+    AllocationScope scope;
+    auto buffer = gLibprisma->tokenizeToLines(sample.code, sample.language);
+    benchmark::DoNotOptimize(buffer.data());
+  }
+  finish(state, sample);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const std::string grammars = envOr("LIBPRISMA_GRAMMARS", LIBPRISMA_GRAMMARS_PATH);
+  const std::string samplesDir = envOr("LIBPRISMA_SAMPLES", LIBPRISMA_SAMPLES_DIR);
+
+  gImage = GrammarImage::fromFile(grammars);
+  gLibprisma = std::make_unique<Libprisma>();
+  if (gImage == nullptr || !gLibprisma->loadGrammarsFromFile(grammars)) {
+    std::fprintf(stderr, "Cannot load grammars from %s\n", grammars.c_str());
+    return 1;
+  }
+  gLibprisma->setCacheBudget(0);
+
+  static const std::vector<Sample> samples = loadSamples(samplesDir);
+  if (samples.empty()) {
+    std::fprintf(stderr, "No samples in %s\n", samplesDir.c_str());
+    return 1;
+  }
+
+  for (const auto &sample : samples) {
+    benchmark::RegisterBenchmark(("TokenizeCold/" + sample.name).c_str(),
+                                 BM_TokenizeCold, sample)
+        ->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark(("TokenizeWarm/" + sample.name).c_str(),
+                                 BM_TokenizeWarm, sample)
+        ->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark(("TokenizeShallow/" + sample.name).c_str(),
+                                 BM_TokenizeShallow, sample)
+        ->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark(("SerializeJson/" + sample.name).c_str(),
+                                 BM_SerializeJson, sample)
+        ->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark(("TokenizeToJson/" + sample.name).c_str(),
+                                 BM_TokenizeToJson, sample)
+        ->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark(("TokenizeToBuffer/" + sample.name).c_str(),
+                                 BM_TokenizeToBuffer, sample)
+        ->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark(("TokenizeToLines/" + sample.name).c_str(),
+                                 BM_TokenizeToLines, sample)
+        ->Unit(benchmark::kMillisecond);
+  }
+
+  benchmark::AddCustomContext("regex_backend", Libprisma::regexBackend());
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+#ifndef _WIN32
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+  const long maxRssKb = usage.ru_maxrss / 1024;
+#else
+  const long maxRssKb = usage.ru_maxrss;
+#endif
+  std::fprintf(stderr, "Peak RSS: %ld KiB\n", maxRssKb);
+#endif
+
+  gLibprisma.reset();
+  gImage.reset();
+  return 0;
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// The code samples of the example app, read by the benchmark and the tests
+
+struct Sample {
+  std::string name;
+  std::string language;
+  std::string code;
+};
+
+inline std::string readFile(const std::filesystem::path &path) {
+  std::ifstream file(path, std::ios::binary);
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  return buffer.str();
+}
+
+inline void appendUtf8(std::string &out, uint32_t codePoint) {
+  if (codePoint < 0x80) {
+    out += static_cast<char>(codePoint);
+  } else if (codePoint < 0x800) {
+    out += static_cast<char>(0xC0 | (codePoint >> 6));
+    out += static_cast<char>(0x80 | (codePoint & 0x3F));
+  } else if (codePoint < 0x10000) {
+    out += static_cast<char>(0xE0 | (codePoint >> 12));
+    out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+    out += static_cast<char>(0x80 | (codePoint & 0x3F));
+  } else {
+    out += static_cast<char>(0xF0 | (codePoint >> 18));
+    out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+    out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+    out += static_cast<char>(0x80 | (codePoint & 0x3F));
+  }
+}
+
+/**
+ * Value of the first template literal in a sample module, e.g.
+ * export const goCode = `package main ...`;
+ */
+inline std::string templateLiteral(const std::string &source) {
+  std::string out;
+  size_t i = source.find('`');
+  if (i == std::string::npos) {
+    return out;
+  }
+
+  for (++i; i < source.size() && source[i] != '`'; ++i) {
+    if (source[i] == '\r') {
+      continue;
+    }
+    if (source[i] != '\\' || i + 1 == source.size()) {
+      out += source[i];
+      continue;
+    }
+
+    const char escaped = source[++i];
+    switch (escaped) {
+    case 'n': out += '\n'; break;
+    case 't': out += '\t'; break;
+    case 'r': out += '\r'; break;
+    case 'b': out += '\b'; break;
+    case 'f': out += '\f'; break;
+    case 'v': out += '\v'; break;
+    case '0': out += '\0'; break;
+    case '\n': break;
+    case 'x':
+      appendUtf8(out, std::stoul(source.substr(i + 1, 2), nullptr, 16));
+      i += 2;
+      break;
+    case 'u':
+      if (source[i + 1] == '{') {
+        const size_t close = source.find('}', i);
+        appendUtf8(out, std::stoul(source.substr(i + 2, close - i - 2), nullptr, 16));
+        i = close;
+      } else {
+        appendUtf8(out, std::stoul(source.substr(i + 1, 4), nullptr, 16));
+        i += 4;
+      }
+      break;
+    default: out += escaped; break;
+    }
+  }
+  return out;
+}
+
+/**
+ * The samples of the example app, one per language
+ */
+inline std::vector<Sample> loadSamples(const std::filesystem::path &directory) {
+  std::vector<Sample> samples;
+  for (const auto &entry : std::filesystem::directory_iterator(directory)) {
+    const auto &path = entry.path();
+    if (path.extension() != ".ts" || path.stem() == "index") {
+      continue;
+    }
+
+    Sample sample;
+    sample.name = path.stem().string();
+    sample.language = sample.name == "objcpp" ? "objectivec" : sample.name;
+    sample.code = templateLiteral(readFile(path));
+    if (!sample.code.empty()) {
+      samples.push_back(std::move(sample));
+    }
+  }
+
+  std::sort(samples.begin(), samples.end(),
+            [](const Sample &a, const Sample &b) { return a.name < b.name; });
+  return samples;
+}
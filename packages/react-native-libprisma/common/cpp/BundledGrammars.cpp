@@ -0,0 +1,151 @@
+#include "BundledGrammars.hpp"
+
+#if defined(__ANDROID__)
+#include <android/asset_manager.h>
+#include <android/asset_manager_jni.h>
+#include <fbjni/fbjni.h>
+#include <unistd.h>
+#elif defined(__APPLE__)
+#include <CoreFoundation/CoreFoundation.h>
+#include <climits>
+#include <string>
+#endif
+
+namespace athex {
+namespace libprisma {
+
+#if defined(__ANDROID__)
+
+static constexpr const char *kImageName = "grammars.bin";
+
+/**
+ * Java side of the asset lookup, see LibPrismaAssets.java
+ */
+struct JLibPrismaAssets : facebook::jni::JavaClass<JLibPrismaAssets> {
+  static constexpr auto kJavaDescriptor =
+      "Lcom/margelo/nitro/libprisma/LibPrismaAssets;";
+
+  static facebook::jni::local_ref<jobject> assetManager() {
+    static const auto method =
+        javaClassStatic()->getStaticMethod<jobject()>("getAssetManager");
+    return method(javaClassStatic());
+  }
+};
+
+std::shared_ptr<const GrammarImage> openBundledGrammars() {
+  AAssetManager *manager = nullptr;
+  facebook::jni::local_ref<jobject> assets;
+  facebook::jni::ThreadScope::WithClassLoader([&] {
+    assets = JLibPrismaAssets::assetManager();
+    if (assets) {
+      manager = AAssetManager_fromJava(facebook::jni::Environment::current(),
+                                       assets.get());
+    }
+  });
+  if (!manager) {
+    return nullptr;
+  }
+
+  AAsset *asset = AAssetManager_open(manager, kImageName, AASSET_MODE_RANDOM);
+  if (!asset) {
+    return nullptr;
+  }
+
+  // Uncompressed assets can be mapped directly from the APK
+  off64_t start = 0;
+  off64_t length = 0;
+  const int fd = AAsset_openFileDescriptor64(asset, &start, &length);
+  if (fd >= 0) {
+    AAsset_close(asset);
+    std::shared_ptr<const GrammarImage> image;
+    try {
+      image = GrammarImage::fromDescriptor(fd, start,
+                                           static_cast<size_t>(length));
+    } catch (...) {
+      close(fd);
+      throw;
+    }
+    close(fd);
+    if (image) {
+      return image;
+    }
+    asset = AAssetManager_open(manager, kImageName, AASSET_MODE_BUFFER);
+    if (!asset) {
+      return nullptr;
+    }
+  }
+
+  // Compressed by the app's packaging options, the asset manager inflates it
+  // once and the image reads it in place
+  const void *buffer = AAsset_getBuffer(asset);
+  if (!buffer) {
+    AAsset_close(asset);
+    return nullptr;
+  }
+  return std::make_shared<GrammarImage>(
+      std::string_view(static_cast<const char *>(buffer),
+                       static_cast<size_t>(AAsset_getLength64(asset))),
+      [asset]() { AAsset_close(asset); });
+}
+
+#elif defined(__APPLE__)
+
+static std::string resourcePath(CFBundleRef bundle, CFStringRef name,
+                                CFStringRef type) {
+  std::string path;
+  CFURLRef url = CFBundleCopyResourceURL(bundle, name, type, nullptr);
+  if (url) {
+    char buffer[PATH_MAX];
+    if (CFURLGetFileSystemRepresentation(
+            url, true, reinterpret_cast<UInt8 *>(buffer), sizeof(buffer))) {
+      path = buffer;
+    }
+    CFRelease(url);
+  }
+  return path;
+}
+
+std::shared_ptr<const GrammarImage> openBundledGrammars() {
+  // The resource bundle is copied into the app, or into the pod's framework
+  // when pods are built as frameworks
+  const CFBundleRef hosts[] = {
+      CFBundleGetMainBundle(),
+      CFBundleGetBundleWithIdentifier(CFSTR("org.cocoapods.LibPrisma")),
+  };
+
+  for (CFBundleRef host : hosts) {
+    if (!host) {
+      continue;
+    }
+
+    CFURLRef url = CFBundleCopyResourceURL(host, CFSTR("LibPrismaGrammars"),
+                                           CFSTR("bundle"), nullptr);
+    if (!url) {
+      continue;
+    }
+    CFBundleRef resources = CFBundleCreate(kCFAllocatorDefault, url);
+    CFRelease(url);
+    if (!resources) {
+      continue;
+    }
+
+    const std::string path =
+        resourcePath(resources, CFSTR("grammars"), CFSTR("bin"));
+    CFRelease(resources);
+
+    if (auto image = GrammarImage::fromFile(path)) {
+      return image;
+    }
+  }
+
+  return nullptr;
+}
+
+#else
+
+std::shared_ptr<const GrammarImage> openBundledGrammars() { return nullptr; }
+
+#endif
+
+} // namespace libprisma
+} // namespace athex
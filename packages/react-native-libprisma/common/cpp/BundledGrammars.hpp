@@ -0,0 +1,22 @@
+#pragma once
+
+#include "libprisma/GrammarImage.h"
+#include <memory>
+
+namespace athex {
+namespace libprisma {
+
+/**
+ * Map the grammars.bin image packaged with the app.
+ *
+ * - Android: the "grammars.bin" asset of the APK, mapped straight from the
+ *   APK when it is stored uncompressed (see android/build.gradle).
+ * - Apple platforms: grammars.bin in the LibPrismaGrammars resource bundle
+ *   declared in the podspec.
+ *
+ * @return nullptr on other platforms or when the asset cannot be found
+ */
+std::shared_ptr<const GrammarImage> openBundledGrammars();
+
+} // namespace libprisma
+} // namespace athex
@@ -2,7 +2,18 @@
 
 #include "HybridLibPrismaSpec.hpp"
 #include "Libprisma.hpp"
+#include "TokenObjectBuilder.hpp"
+#include <NitroModules/Promise.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <jsi/jsi.h>
+#include <limits>
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace margelo::nitro::libprisma {
 
@@ -26,6 +37,233 @@ public:
     return _impl->tokenizeToJson(code, language);
   }
 
+  /**
+   * Tokenize source code into JSON tokens within a time limit in
+   * milliseconds, a regex step budget, a token memory ceiling in bytes and a
+   * nesting depth, not descending into flatTypes
+   */
+  std::string tokenizeWithLimits(const std::string &code,
+                                 const std::string &language, double timeLimit,
+                                 double maxSteps, double maxBytes,
+                                 double maxDepth,
+                                 const std::vector<std::string> &flatTypes) override {
+    ::TokenizeLimits limits;
+    limits.maxSteps = toLimit<uint64_t>(maxSteps);
+    limits.timeLimit = std::min(
+        std::chrono::microseconds(toLimit<int64_t>(timeLimit * 1000.0)),
+        kMaxTimeLimit);
+    limits.maxBytes = toLimit<size_t>(maxBytes);
+    limits.maxDepth = toLimit<uint32_t>(maxDepth);
+    limits.flatTokens = _impl->tokenIds(flatTypes);
+    return _impl->tokenizeWithLimits(code, language, limits);
+  }
+
+  /**
+   * Tokenize source code into JSON tokens on a native worker thread
+   */
+  std::shared_ptr<Promise<std::string>>
+  tokenizeAsync(const std::string &code, const std::string &language,
+                double requestId) override {
+    auto promise = Promise<std::string>::create();
+    _impl->tokenizeAsync(
+        toIndex<uint64_t>(requestId, "requestId"), code, language,
+        [promise](std::string json) { promise->resolve(std::move(json)); },
+        [promise](std::exception_ptr error) { promise->reject(error); });
+    return promise;
+  }
+
+  /**
+   * Drop a pending tokenizeAsync request
+   */
+  bool cancelTokenize(double requestId) override {
+    return _impl->cancelTokenize(toIndex<uint64_t>(requestId, "requestId"));
+  }
+
+  /**
+   * Compile the patterns of languages on a native worker thread
+   */
+  std::shared_ptr<Promise<void>>
+  preloadLanguages(const std::vector<std::string> &languages) override {
+    auto promise = Promise<void>::create();
+    _impl->preloadLanguages(
+        languages, [promise]() { promise->resolve(); },
+        [promise](std::exception_ptr error) { promise->reject(error); });
+    return promise;
+  }
+
+  /**
+   * Open a document for incremental tokenization
+   */
+  std::string openDocument(double documentId, const std::string &code,
+                           const std::string &language) override {
+    return _impl->openDocument(toIndex<uint64_t>(documentId, "documentId"), code,
+                               language);
+  }
+
+  /**
+   * Apply an edit to an open document and return the changed tokens
+   */
+  std::string editDocument(double documentId, double offset,
+                           double deleteCount,
+                           const std::string &insertText) override {
+    return _impl->editDocument(toIndex<uint64_t>(documentId, "documentId"),
+                               toIndex<size_t>(offset, "offset"),
+                               toIndex<size_t>(deleteCount, "deleteCount"),
+                               insertText);
+  }
+
+  /**
+   * Release an open document
+   */
+  bool closeDocument(double documentId) override {
+    return _impl->closeDocument(toIndex<uint64_t>(documentId, "documentId"));
+  }
+
+  /**
+   * Open a large text for streaming tokenization
+   */
+  void openStream(double streamId, const std::string &code,
+                  const std::string &language, double linesPerChunk) override {
+    _impl->openStream(toIndex<uint64_t>(streamId, "streamId"), code, language,
+                      toLimit<size_t>(linesPerChunk));
+  }
+
+  /**
+   * Tokenize the next chunk of a stream on a native worker thread
+   */
+  std::shared_ptr<Promise<std::string>> readStream(double streamId) override {
+    auto promise = Promise<std::string>::create();
+    _impl->readStream(
+        toIndex<uint64_t>(streamId, "streamId"),
+        [promise](std::string json) { promise->resolve(std::move(json)); },
+        [promise](std::exception_ptr error) { promise->reject(error); });
+    return promise;
+  }
+
+  /**
+   * Release a stream
+   */
+  bool closeStream(double streamId) override {
+    return _impl->closeStream(toIndex<uint64_t>(streamId, "streamId"));
+  }
+
+  /**
+   * Tokenize a line range of a large text from cached checkpoints
+   */
+  std::string tokenizeRange(const std::string &code, const std::string &language,
+                            double startLine, double endLine) override {
+    return _impl->tokenizeRange(code, language,
+                                toIndex<size_t>(startLine, "startLine"),
+                                toIndex<size_t>(endLine, "endLine"));
+  }
+
+  /**
+   * Tokenize source code into a flat binary token stream
+   */
+  std::shared_ptr<ArrayBuffer>
+  tokenizeToBuffer(const std::string &code,
+                   const std::string &language) override {
+    auto *words = new std::vector<uint32_t>(
+        _impl->tokenizeToBuffer(code, language));
+    return ArrayBuffer::wrap(reinterpret_cast<uint8_t *>(words->data()),
+                             words->size() * sizeof(uint32_t),
+                             [words]() { delete words; });
+  }
+
+  /**
+   * Tokenize UTF-8 source code held in an ArrayBuffer into a flat binary
+   * token stream. The tokenizer reads the JS buffer in place.
+   */
+  std::shared_ptr<ArrayBuffer>
+  tokenizeUtf8ToBuffer(const std::shared_ptr<ArrayBuffer> &code,
+                       const std::string &language) override {
+    const std::string_view source(reinterpret_cast<const char *>(code->data()),
+                                  code->size());
+    auto *words = new std::vector<uint32_t>(
+        _impl->tokenizeToBuffer(source, language));
+    return ArrayBuffer::wrap(reinterpret_cast<uint8_t *>(words->data()),
+                             words->size() * sizeof(uint32_t),
+                             [words]() { delete words; });
+  }
+
+  /**
+   * Tokenize many snippets into one binary token stream
+   */
+  std::shared_ptr<ArrayBuffer>
+  tokenizeBatch(const std::vector<std::string> &codes,
+                const std::vector<std::string> &languages,
+                bool parallel) override {
+    auto *words = new std::vector<uint32_t>(
+        _impl->tokenizeBatch(codes, languages, parallel));
+    return ArrayBuffer::wrap(reinterpret_cast<uint8_t *>(words->data()),
+                             words->size() * sizeof(uint32_t),
+                             [words]() { delete words; });
+  }
+
+  /**
+   * Tokenize source code into render-ready line runs
+   */
+  std::shared_ptr<ArrayBuffer>
+  tokenizeToLines(const std::string &code,
+                  const std::string &language) override {
+    auto *words = new std::vector<uint32_t>(
+        _impl->tokenizeToLines(code, language));
+    return ArrayBuffer::wrap(reinterpret_cast<uint8_t *>(words->data()),
+                             words->size() * sizeof(uint32_t),
+                             [words]() { delete words; });
+  }
+
+  /**
+   * Get the token type table referenced by tokenizeToBuffer ids
+   */
+  std::vector<std::string> getTokenTypes() override {
+    return _impl->tokenTypes();
+  }
+
+  /**
+   * Set the memory budget of the result cache
+   */
+  void setCacheBudget(double bytes) override {
+    // Infinity is no budget at all, unlike 0 which disables the cache
+    _impl->setCacheBudget(bytes == std::numeric_limits<double>::infinity()
+                              ? std::numeric_limits<size_t>::max()
+                              : toLimit<size_t>(bytes));
+  }
+
+  /**
+   * Drop all cached results
+   */
+  void clearCache() override { _impl->clearCache(); }
+
+  /**
+   * Counters of the result cache as JSON
+   */
+  std::string getCacheStats() override { return _impl->cacheStats(); }
+
+  /**
+   * Turn per-pattern profiling on or off
+   */
+  void setProfiling(bool enabled) override { _impl->setProfiling(enabled); }
+
+  /**
+   * Per-pattern counters as JSON
+   */
+  std::string getProfile() override { return _impl->profile(); }
+
+  /**
+   * Turn splitting large code into chunks on or off
+   */
+  void setParallelTokenize(bool enabled) override {
+    _impl->setParallelTokenize(enabled);
+  }
+
+  /**
+   * Name of the compiled-in regex engine
+   */
+  std::string getRegexBackend() override {
+    return athex::libprisma::Libprisma::regexBackend();
+  }
+
   /**
    * Load grammars from base64-encoded gzipped data
    */
@@ -33,7 +271,145 @@ public:
     _impl->loadGrammars(grammars);
   }
 
+  /**
+   * Memory-map a grammar image file
+   */
+  bool loadGrammarsFromFile(const std::string &path) override {
+    return _impl->loadGrammarsFromFile(path);
+  }
+
+  /**
+   * Memory-map the grammar image shipped with the native module
+   */
+  bool loadBundledGrammars() override { return _impl->loadBundledGrammars(); }
+
+  /**
+   * Register the raw JSI methods next to the ones of the Nitro spec
+   */
+  void loadHybridMethods() override {
+    HybridLibPrismaSpec::loadHybridMethods();
+    registerHybrids(this, [](Prototype &prototype) {
+      prototype.registerRawHybridMethod("tokenizeToObjects", 2,
+                                        &HybridLibPrisma::tokenizeToObjects);
+    });
+  }
+
+  /**
+   * Tokenize source code into the Token[] tree of tokenizeToJson, built
+   * directly as JS objects instead of a JSON string. A raw JSI method, the
+   * Nitro spec has no type for the recursive tree.
+   */
+  jsi::Value tokenizeToObjects(jsi::Runtime &runtime,
+                               const jsi::Value & /* thisValue */,
+                               const jsi::Value *args, size_t count) {
+    if (count < 2 || !args[0].isString() || !args[1].isString()) {
+      throw jsi::JSError(runtime,
+                         "tokenizeToObjects(code, language) expects two strings");
+    }
+    const std::string code = args[0].getString(runtime).utf8(runtime);
+    const std::string language = args[1].getString(runtime).utf8(runtime);
+
+    const auto highlighter = _impl->highlighter();
+    if (!highlighter) {
+      return jsi::Array(runtime, 0);
+    }
+
+    const ::TokenList tokens = highlighter->tokenize(code, language);
+    JsiTokenValues values(runtime);
+    athex::libprisma::TokenObjectBuilder<JsiTokenValues> builder(values,
+                                                                 *highlighter);
+    return builder.array(tokens);
+  }
+
 private:
+  // Longer time limits are as good as none, and keep the deadline of a call
+  // in the range of the clock
+  static constexpr std::chrono::microseconds kMaxTimeLimit =
+      std::chrono::hours(24);
+
+  /**
+   * A limit or size from JS: NaN, infinities and numbers below 1 are 0, no
+   * limit, and numbers past the range of T are its largest value
+   */
+  template <typename T> static T toLimit(double value) {
+    if (!std::isfinite(value) || value < 1) {
+      return 0;
+    }
+    if (value >= static_cast<double>(std::numeric_limits<T>::max())) {
+      return std::numeric_limits<T>::max();
+    }
+    return static_cast<T>(value);
+  }
+
+  /**
+   * An id, offset or line number from JS, without its fraction. Throws for
+   * NaN, infinities, negative numbers and numbers past the range of T.
+   */
+  template <typename T> static T toIndex(double value, const char *name) {
+    if (!std::isfinite(value) || value < 0 ||
+        value >= static_cast<double>(std::numeric_limits<T>::max())) {
+      throw std::invalid_argument(std::string(name) +
+                                  " must be a non-negative integer, got " +
+                                  std::to_string(value));
+    }
+    return static_cast<T>(value);
+  }
+
+  /**
+   * JS values of one tokenizeToObjects call, see TokenObjectBuilder. The
+   * property names are created once per call.
+   */
+  class JsiTokenValues {
+  public:
+    using Array = jsi::Array;
+    using Object = jsi::Object;
+    using String = jsi::String;
+    using Property = athex::libprisma::TokenProperty;
+
+    explicit JsiTokenValues(jsi::Runtime &runtime)
+        : m_runtime(runtime), m_type(jsi::PropNameID::forAscii(runtime, "type")),
+          m_alias(jsi::PropNameID::forAscii(runtime, "alias")),
+          m_content(jsi::PropNameID::forAscii(runtime, "content")) {}
+
+    Array array(size_t size) { return jsi::Array(m_runtime, size); }
+
+    Object object() { return jsi::Object(m_runtime); }
+
+    String string(std::string_view utf8) {
+      return jsi::String::createFromUtf8(
+          m_runtime, reinterpret_cast<const uint8_t *>(utf8.data()), utf8.size());
+    }
+
+    void set(Array &array, size_t index, Object &&object) {
+      array.setValueAtIndex(m_runtime, index, jsi::Value(std::move(object)));
+    }
+
+    void set(Object &object, Property property, const String &value) {
+      object.setProperty(m_runtime, name(property), value);
+    }
+
+    void set(Object &object, Property property, Array &&value) {
+      object.setProperty(m_runtime, name(property), jsi::Value(std::move(value)));
+    }
+
+  private:
+    const jsi::PropNameID &name(Property property) const {
+      switch (property) {
+      case Property::Type:
+        return m_type;
+      case Property::Alias:
+        return m_alias;
+      default:
+        return m_content;
+      }
+    }
+
+    jsi::Runtime &m_runtime;
+    jsi::PropNameID m_type;
+    jsi::PropNameID m_alias;
+    jsi::PropNameID m_content;
+  };
+
   static constexpr auto TAG = "LibPrisma";
   std::shared_ptr<athex::libprisma::Libprisma> _impl;
 };
@@ -0,0 +1,116 @@
+#include "JsonWriter.hpp"
+
+// LIBPRISMA_JSON_SCALAR turns the vector scan off, see LIBPRISMA_JSON_SIMD in
+// CMakeLists.txt
+#if defined(LIBPRISMA_JSON_SCALAR)
+#elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define LIBPRISMA_JSON_SSE2 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define LIBPRISMA_JSON_NEON 1
+#endif
+
+namespace athex {
+namespace libprisma {
+
+namespace {
+
+bool needsEscape(unsigned char c) { return c < 0x20 || c == '"' || c == '\\'; }
+
+/**
+ * Number of leading bytes of [p, p + size) that are copied unescaped
+ */
+size_t plainPrefix(const char *p, size_t size) {
+  size_t i = 0;
+
+#if defined(LIBPRISMA_JSON_SSE2)
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i control = _mm_set1_epi8(0x1F);
+  for (; i + 16 <= size; i += 16) {
+    const __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+    // unsigned chunk <= 0x1F
+    const __m128i low = _mm_cmpeq_epi8(_mm_min_epu8(chunk, control), chunk);
+    const __m128i hit = _mm_or_si128(
+        low, _mm_or_si128(_mm_cmpeq_epi8(chunk, quote),
+                          _mm_cmpeq_epi8(chunk, backslash)));
+    if (_mm_movemask_epi8(hit) != 0) {
+      break;
+    }
+  }
+#elif defined(LIBPRISMA_JSON_NEON)
+  const uint8x16_t quote = vdupq_n_u8('"');
+  const uint8x16_t backslash = vdupq_n_u8('\\');
+  const uint8x16_t space = vdupq_n_u8(0x20);
+  for (; i + 16 <= size; i += 16) {
+    const uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t *>(p + i));
+    const uint8x16_t hit =
+        vorrq_u8(vcltq_u8(chunk, space),
+                 vorrq_u8(vceqq_u8(chunk, quote), vceqq_u8(chunk, backslash)));
+    if (vmaxvq_u8(hit) != 0) {
+      break;
+    }
+  }
+#endif
+
+  // The block with the first escape, and the tail
+  while (i < size && !needsEscape(static_cast<unsigned char>(p[i]))) {
+    ++i;
+  }
+  return i;
+}
+
+} // namespace
+
+void JsonWriter::escaped(std::string_view text) {
+  static constexpr char hex[] = "0123456789abcdef";
+
+  const char *p = text.data();
+  size_t size = text.size();
+  while (size > 0) {
+    const size_t plain = plainPrefix(p, size);
+    m_out.append(p, plain);
+    if (plain == size) {
+      return;
+    }
+
+    const auto c = static_cast<unsigned char>(p[plain]);
+    switch (c) {
+    case '"':
+      m_out.append("\\\"", 2);
+      break;
+    case '\\':
+      m_out.append("\\\\", 2);
+      break;
+    case '\b':
+      m_out.append("\\b", 2);
+      break;
+    case '\f':
+      m_out.append("\\f", 2);
+      break;
+    case '\n':
+      m_out.append("\\n", 2);
+      break;
+    case '\r':
+      m_out.append("\\r", 2);
+      break;
+    case '\t':
+      m_out.append("\\t", 2);
+      break;
+    default:
+      // Other control characters are not valid in a JSON string
+      m_out.append("\\u00", 4);
+      m_out.push_back(hex[c >> 4]);
+      m_out.push_back(hex[c & 0xF]);
+      break;
+    }
+
+    p += plain + 1;
+    size -= plain + 1;
+  }
+}
+
+} // namespace libprisma
+} // namespace athex
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace athex {
+namespace libprisma {
+
+/**
+ * Appends JSON text to a single output string.
+ * Strings are escaped in one pass: runs of bytes that need no escaping are
+ * found with a vector scan and copied as a whole.
+ */
+class JsonWriter {
+public:
+  /**
+   * @param reserve Expected output size, the buffer grows past it if needed
+   */
+  explicit JsonWriter(size_t reserve = 0) { m_out.reserve(reserve); }
+
+  void raw(char c) { m_out.push_back(c); }
+
+  void raw(std::string_view text) { m_out.append(text); }
+
+  /**
+   * Append text as a quoted JSON string
+   */
+  void string(std::string_view text) {
+    m_out.push_back('"');
+    escaped(text);
+    m_out.push_back('"');
+  }
+
+  /**
+   * Append text escaped for a JSON string, without quotes
+   */
+  void escaped(std::string_view text);
+
+  std::string take() { return std::move(m_out); }
+
+private:
+  std::string m_out;
+};
+
+} // namespace libprisma
+} // namespace athex
@@ -1,6 +1,17 @@
 #include "Libprisma.hpp"
+#include "BundledGrammars.hpp"
+#include "JsonWriter.hpp"
+#include "libprisma/GrammarImage.h"
+#include "libprisma/Regex.h"
 #include "libprisma/TokenList.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <map>
 #include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
 #include <vector>
 #include <zlib.h>
 
@@ -8,14 +19,44 @@ namespace athex {
 namespace libprisma {
 
 void Libprisma::loadGrammars(const std::string &grammars) {
+  std::lock_guard<std::mutex> lock(m_mutex);
   if (m_highlighter) {
     return;
   }
   std::string decoded = base64_decode(grammars);
   std::string decompressed = gzip_decompress(decoded);
-  m_highlighter = std::make_shared<SyntaxHighlighter>(decompressed);
+  m_highlighter = std::make_shared<SyntaxHighlighter>(
+      GrammarImage::fromBytes(std::move(decompressed)));
 }
 
+bool Libprisma::loadGrammarsFromFile(const std::string &path) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_highlighter) {
+    return true;
+  }
+  auto image = GrammarImage::fromFile(path);
+  if (!image) {
+    return false;
+  }
+  m_highlighter = std::make_shared<SyntaxHighlighter>(std::move(image));
+  return true;
+}
+
+bool Libprisma::loadBundledGrammars() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_highlighter) {
+    return true;
+  }
+  auto image = openBundledGrammars();
+  if (!image) {
+    return false;
+  }
+  m_highlighter = std::make_shared<SyntaxHighlighter>(std::move(image));
+  return true;
+}
+
+const char *Libprisma::regexBackend() { return Regex::backend; }
+
 std::string Libprisma::gzip_decompress(const std::string &data) {
   z_stream zs;
   memset(&zs, 0, sizeof(zs));
@@ -55,18 +96,694 @@ std::string Libprisma::gzip_decompress(const std::string &data) {
 
 std::string Libprisma::tokenizeToJson(const std::string &code,
                                       const std::string &language) {
-  if (!m_highlighter) {
+  const auto highlighter = this->highlighter();
+  if (!highlighter) {
     // Fallback or error if grammars not loaded
     // Ideally loadGrammars should be called first
     return "[]";
   }
 
-  TokenList tokens = m_highlighter->tokenize(code, language);
-  return tokensToJson(tokens);
+  if (auto cached = m_results.find(code, language)) {
+    return std::move(*cached);
+  }
+
+  TokenList tokens = tokenizeParallel(*highlighter, code, language);
+  std::string json = tokensToJson(*highlighter, tokens);
+  m_results.insert(code, language, json);
+  return json;
+}
+
+std::string Libprisma::tokenizeWithLimits(const std::string &code,
+                                          const std::string &language,
+                                          const TokenizeLimits &limits) {
+  const auto highlighter = this->highlighter();
+  if (!highlighter) {
+    return "{\"limited\":false,\"shallow\":false,\"bytes\":0,\"tokens\":[]}";
+  }
+
+  TokenizeStats stats;
+  TokenList tokens = highlighter->tokenize(code, language, limits, stats);
+
+  JsonWriter out(code.size() + tokens.length * kJsonBytesPerNode + 64);
+  out.raw(stats.limited ? "{\"limited\":true" : "{\"limited\":false");
+  out.raw(stats.shallow ? ",\"shallow\":true" : ",\"shallow\":false");
+  out.raw(",\"bytes\":");
+  out.raw(std::to_string(stats.bytes));
+  out.raw(",\"tokens\":");
+  writeTokens(*highlighter, tokens, out);
+  out.raw('}');
+  return out.take();
+}
+
+void Libprisma::setCacheBudget(size_t bytes) { m_results.setBudget(bytes); }
+
+void Libprisma::clearCache() { m_results.clear(); }
+
+std::string Libprisma::cacheStats() {
+  const auto stats = m_results.stats();
+  return "{\"hits\":" + std::to_string(stats.hits) +
+         ",\"misses\":" + std::to_string(stats.misses) +
+         ",\"entries\":" + std::to_string(stats.entries) +
+         ",\"bytes\":" + std::to_string(stats.bytes) +
+         ",\"budget\":" + std::to_string(stats.budget) + "}";
+}
+
+void Libprisma::setProfiling(bool enabled) {
+  if (auto loaded = highlighter()) {
+    loaded->setProfiling(enabled);
+  }
+}
+
+std::string Libprisma::profile() {
+  auto loaded = highlighter();
+  if (!loaded) {
+    return "[]";
+  }
+
+  const auto entries = loaded->profile();
+  JsonWriter out(entries.size() * kJsonBytesPerProfileEntry);
+  out.raw('[');
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const auto &stats = entries[i];
+    if (i > 0) {
+      out.raw(',');
+    }
+    out.raw("{\"language\":");
+    out.string(stats.language);
+    out.raw(",\"token\":");
+    out.string(loaded->tokenName(stats.token));
+    out.raw(",\"pattern\":");
+    out.raw(std::to_string(stats.index));
+    out.raw(",\"regex\":");
+    out.string(stats.source);
+    out.raw(",\"calls\":");
+    out.raw(std::to_string(stats.calls));
+    out.raw(",\"matches\":");
+    out.raw(std::to_string(stats.matches));
+    out.raw(",\"misses\":");
+    out.raw(std::to_string(stats.misses));
+    out.raw(",\"rematches\":");
+    out.raw(std::to_string(stats.rematches));
+    out.raw(",\"time\":");
+    out.raw(std::to_string(
+        std::chrono::duration<double, std::milli>(stats.time).count()));
+    out.raw('}');
+  }
+  out.raw(']');
+  return out.take();
+}
+
+void Libprisma::setParallelTokenize(bool enabled) {
+  m_parallel.store(enabled, std::memory_order_relaxed);
+}
+
+void Libprisma::tokenizeAsync(uint64_t requestId, std::string code,
+                              std::string language,
+                              std::function<void(std::string)> resolve,
+                              std::function<void(std::exception_ptr)> reject) {
+  WorkerPool::Job job;
+  job.run = [this, code = std::move(code), language = std::move(language),
+             resolve, reject]() {
+    std::string json;
+    try {
+      json = tokenizeToJson(code, language);
+    } catch (...) {
+      reject(std::current_exception());
+      return;
+    }
+    resolve(std::move(json));
+  };
+  job.cancel = [reject]() {
+    reject(std::make_exception_ptr(
+        std::runtime_error("Tokenize request cancelled")));
+  };
+
+  workers().submit(requestId, std::move(job));
+}
+
+void Libprisma::preloadLanguages(
+    std::vector<std::string> languages, std::function<void()> resolve,
+    std::function<void(std::exception_ptr)> reject) {
+  WorkerPool::Job job;
+  job.run = [this, languages = std::move(languages), resolve, reject]() {
+    try {
+      const auto highlighter = this->highlighter();
+      for (const auto &language : languages) {
+        if (highlighter) {
+          highlighter->preload(language);
+        }
+      }
+    } catch (...) {
+      reject(std::current_exception());
+      return;
+    }
+    resolve();
+  };
+  job.cancel = [reject]() {
+    reject(std::make_exception_ptr(
+        std::runtime_error("Preload request cancelled")));
+  };
+
+  workers().submit(WorkerPool::kAnonymousJob, std::move(job));
+}
+
+std::shared_ptr<SyntaxHighlighter> Libprisma::highlighter() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_highlighter;
+}
+
+WorkerPool &Libprisma::workers() {
+  std::call_once(m_workersOnce, [this] {
+    // One core is left to the JS and UI threads
+    const size_t cores = std::thread::hardware_concurrency();
+    m_workers = std::make_unique<WorkerPool>(
+        std::clamp<size_t>(cores > 1 ? cores - 1 : 1, 1, kMaxWorkers));
+  });
+  return *m_workers;
+}
+
+TokenList Libprisma::tokenizeParallel(SyntaxHighlighter &highlighter,
+                                      std::string_view code,
+                                      const std::string &language) {
+  if (!m_parallel.load(std::memory_order_relaxed) ||
+      code.size() < 2 * kMinParallelChunk) {
+    return highlighter.tokenize(code, language, std::string_view::npos);
+  }
+
+  // The calling thread takes a chunk itself
+  WorkerPool &pool = workers();
+  const size_t chunks =
+      std::min(pool.size() + 1, code.size() / kMinParallelChunk);
+  return highlighter.tokenizeParallel(
+      code, language, chunks,
+      [&pool](size_t count, const std::function<void(size_t)> &body) {
+        pool.parallelFor(count, body);
+      });
+}
+
+bool Libprisma::cancelTokenize(uint64_t requestId) {
+  return m_workers && m_workers->cancel(requestId);
+}
+
+TokenDocument::Tokenizer
+Libprisma::documentTokenizer(const std::string &language) {
+  return [this, &language](std::string_view text, size_t base, size_t limit) {
+    std::vector<TokenDocument::Segment> segments;
+    const auto highlighter = this->highlighter();
+    if (!highlighter) {
+      // Same as tokenizeToJson without grammars
+      return segments;
+    }
+
+    TokenList tokens = highlighter->tokenize(text, language, limit);
+
+    size_t start = 0;
+    for (auto it = tokens.begin(); it != tokens.end() && start < limit; ++it) {
+      JsonWriter out(it->length() + kJsonBytesPerNode);
+      writeToken(*highlighter, *it, out);
+      segments.push_back({base + start, it->length(), out.take()});
+      start += it->length();
+    }
+    return segments;
+  };
+}
+
+/**
+ * Length of a UTF-8 string in UTF-16 code units: every byte that is not a
+ * continuation byte starts a code point, and 4-byte sequences need a
+ * surrogate pair.
+ */
+static uint32_t utf16Length(std::string_view str) {
+  uint32_t length = 0;
+  for (unsigned char c : str) {
+    if ((c & 0xC0) != 0x80) {
+      length += c >= 0xF0 ? 2 : 1;
+    }
+  }
+  return length;
+}
+
+/**
+ * Byte offset in a UTF-8 string of a UTF-16 code unit offset, clamped to the
+ * end of the string
+ */
+static size_t utf8Offset(std::string_view str, size_t utf16Offset) {
+  size_t units = 0;
+  size_t i = 0;
+  while (i < str.size() && units < utf16Offset) {
+    const unsigned char c = str[i];
+    const size_t bytes = c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : c >= 0xC0 ? 2 : 1;
+    units += bytes == 4 ? 2 : 1;
+    i = std::min(str.size(), i + bytes);
+  }
+  return i;
+}
+
+std::string Libprisma::openDocument(uint64_t documentId,
+                                    const std::string &code,
+                                    const std::string &language) {
+  std::lock_guard<std::mutex> lock(m_documentsMutex);
+  m_documents.erase(documentId);
+
+  auto &document =
+      m_documents
+          .emplace(documentId,
+                   Document{language, TokenDocument(code,
+                                                    documentTokenizer(language))})
+          .first->second;
+
+  std::string json = "[";
+  for (const auto &segment : document.tokens.segments()) {
+    if (json.size() > 1)
+      json += ",";
+    json += segment.json;
+  }
+  json += "]";
+  return json;
+}
+
+std::string Libprisma::editDocument(uint64_t documentId, size_t offset,
+                                    size_t deleteCount,
+                                    const std::string &insertText) {
+  std::lock_guard<std::mutex> lock(m_documentsMutex);
+  const auto &find = m_documents.find(documentId);
+  if (find == m_documents.end()) {
+    throw std::runtime_error("Document " + std::to_string(documentId) +
+                             " is not open");
+  }
+
+  Document &document = find->second;
+  const std::string &text = document.tokens.text();
+  const size_t start = utf8Offset(text, offset);
+  const size_t end =
+      start + utf8Offset(std::string_view(text).substr(start), deleteCount);
+
+  const auto patch = document.tokens.edit(start, end - start, insertText,
+                                          documentTokenizer(document.language));
+
+  std::string json = "{\"start\":" + std::to_string(patch.start) +
+                     ",\"deleteCount\":" + std::to_string(patch.deleteCount) +
+                     ",\"tokens\":[";
+  const auto &segments = document.tokens.segments();
+  for (size_t i = 0; i < patch.insertCount; ++i) {
+    if (i > 0)
+      json += ",";
+    json += segments[patch.start + i].json;
+  }
+  json += "]}";
+  return json;
+}
+
+bool Libprisma::closeDocument(uint64_t documentId) {
+  std::lock_guard<std::mutex> lock(m_documentsMutex);
+  return m_documents.erase(documentId) > 0;
+}
+
+void Libprisma::openStream(uint64_t streamId, std::string code,
+                           std::string language, size_t linesPerChunk) {
+  // Not movable because of its mutex
+  std::shared_ptr<Stream> stream(new Stream{
+      std::move(language), TokenStream(std::move(code), linesPerChunk), 0, {}});
+
+  std::lock_guard<std::mutex> lock(m_documentsMutex);
+  m_streams[streamId] = std::move(stream);
+}
+
+void Libprisma::readStream(uint64_t streamId,
+                           std::function<void(std::string)> resolve,
+                           std::function<void(std::exception_ptr)> reject) {
+  std::shared_ptr<Stream> stream;
+  {
+    std::lock_guard<std::mutex> lock(m_documentsMutex);
+    const auto &find = m_streams.find(streamId);
+    if (find != m_streams.end()) {
+      stream = find->second;
+    }
+  }
+  if (!stream) {
+    reject(std::make_exception_ptr(std::runtime_error(
+        "Stream " + std::to_string(streamId) + " is not open")));
+    return;
+  }
+
+  WorkerPool::Job job;
+  job.run = [this, stream, resolve, reject]() {
+    std::string json;
+    try {
+      // Reads of one stream run in order even if several are pending
+      std::lock_guard<std::mutex> lock(stream->mutex);
+      const auto chunk = stream->tokens.next(documentTokenizer(stream->language));
+
+      json = "{\"offset\":" + std::to_string(stream->utf16Offset) +
+             ",\"startLine\":" + std::to_string(chunk.startLine) +
+             ",\"endLine\":" + std::to_string(chunk.endLine) +
+             ",\"done\":" + (stream->tokens.done() ? "true" : "false") +
+             ",\"tokens\":[";
+      for (size_t i = 0; i < chunk.segments.size(); ++i) {
+        if (i > 0)
+          json += ",";
+        json += chunk.segments[i].json;
+      }
+      json += "]}";
+
+      stream->utf16Offset += utf16Length(std::string_view(stream->tokens.text())
+                                             .substr(chunk.start,
+                                                     chunk.end - chunk.start));
+    } catch (...) {
+      reject(std::current_exception());
+      return;
+    }
+    resolve(std::move(json));
+  };
+  job.cancel = [reject]() {
+    reject(std::make_exception_ptr(
+        std::runtime_error("Stream read cancelled")));
+  };
+
+  workers().submit(WorkerPool::kAnonymousJob, std::move(job));
+}
+
+bool Libprisma::closeStream(uint64_t streamId) {
+  std::lock_guard<std::mutex> lock(m_documentsMutex);
+  return m_streams.erase(streamId) > 0;
+}
+
+std::string Libprisma::tokenizeRange(const std::string &code,
+                                     const std::string &language,
+                                     size_t startLine, size_t endLine) {
+  const size_t hash = std::hash<std::string>()(code);
+
+  std::shared_ptr<RangeDocument> document;
+  {
+    std::lock_guard<std::mutex> lock(m_documentsMutex);
+    auto it = std::find_if(
+        m_rangeDocuments.begin(), m_rangeDocuments.end(),
+        [&](const std::shared_ptr<RangeDocument> &candidate) {
+          return candidate->hash == hash && candidate->language == language &&
+                 candidate->tokens.text() == code;
+        });
+
+    if (it != m_rangeDocuments.end()) {
+      m_rangeDocuments.splice(m_rangeDocuments.begin(), m_rangeDocuments, it);
+    } else {
+      // Not movable because of its mutex
+      m_rangeDocuments.emplace_front(new RangeDocument{
+          hash, language, TokenRanges(code, kCheckpointLines), {}});
+      if (m_rangeDocuments.size() > kMaxRangeDocuments) {
+        m_rangeDocuments.pop_back();
+      }
+    }
+    document = m_rangeDocuments.front();
+  }
+
+  std::lock_guard<std::mutex> lock(document->mutex);
+  const auto range = document->tokens.tokenize(startLine, endLine,
+                                               documentTokenizer(language));
+
+  // The text is converted from JS on every call anyway, counting its UTF-16
+  // prefix is in the same order of cost
+  std::string json =
+      "{\"offset\":" +
+      std::to_string(utf16Length(std::string_view(code).substr(0, range.start))) +
+      ",\"startLine\":" + std::to_string(range.startLine) +
+      ",\"endLine\":" + std::to_string(range.endLine) + ",\"tokens\":[";
+  for (size_t i = 0; i < range.segments.size(); ++i) {
+    if (i > 0)
+      json += ",";
+    json += range.segments[i].json;
+  }
+  json += "]}";
+  return json;
+}
+
+std::vector<uint32_t> Libprisma::tokenizeToBuffer(std::string_view code,
+                                                  const std::string &language) {
+  std::vector<uint32_t> out(TokenBufferFormat::headerFields, 0);
+  size_t tableSize = TokenBufferFormat::textType + 1;
+
+  if (const auto highlighter = this->highlighter()) {
+    TokenList tokens = tokenizeParallel(*highlighter, code, language);
+    out.reserve(out.size() + tokens.length * TokenBufferFormat::entryFields);
+
+    uint32_t offset = 0;
+    tokensToBuffer(tokens, 0, offset, out);
+    tableSize = highlighter->tokenNames().size();
+  }
+
+  out[0] = TokenBufferFormat::version;
+  out[1] = static_cast<uint32_t>((out.size() - TokenBufferFormat::headerFields) /
+                                 TokenBufferFormat::entryFields);
+  out[2] = static_cast<uint32_t>(tableSize);
+  return out;
+}
+
+std::vector<uint32_t>
+Libprisma::tokenizeBatch(const std::vector<std::string> &codes,
+                         const std::vector<std::string> &languages,
+                         bool parallel) {
+  if (codes.size() != languages.size()) {
+    throw std::invalid_argument("tokenizeBatch: " +
+                                std::to_string(codes.size()) + " snippets but " +
+                                std::to_string(languages.size()) +
+                                " languages");
+  }
+
+  const auto highlighter = this->highlighter();
+  std::vector<std::vector<uint32_t>> entries(codes.size());
+
+  const auto tokenize = [&](size_t i) {
+    if (!highlighter) {
+      return;
+    }
+    TokenList tokens = highlighter->tokenize(codes[i], languages[i]);
+    entries[i].reserve(tokens.length * TokenBufferFormat::entryFields);
+
+    uint32_t offset = 0;
+    tokensToBuffer(tokens, 0, offset, entries[i]);
+  };
+
+  if (parallel && codes.size() > 1) {
+    workers().parallelFor(codes.size(), tokenize);
+  } else {
+    for (size_t i = 0; i < codes.size(); ++i) {
+      tokenize(i);
+    }
+  }
+
+  const size_t tableStart = TokenBatchFormat::headerFields;
+  size_t size = tableStart + codes.size() * TokenBatchFormat::snippetFields;
+  for (const auto &snippet : entries) {
+    size += snippet.size();
+  }
+
+  std::vector<uint32_t> out;
+  out.reserve(size);
+  out.resize(tableStart + codes.size() * TokenBatchFormat::snippetFields, 0);
+  out[0] = TokenBatchFormat::version;
+  out[1] = static_cast<uint32_t>(codes.size());
+  out[2] = static_cast<uint32_t>(highlighter ? highlighter->tokenNames().size()
+                                             : TokenBufferFormat::textType + 1);
+
+  uint32_t first = 0;
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const auto count = static_cast<uint32_t>(entries[i].size() /
+                                             TokenBufferFormat::entryFields);
+    out[tableStart + i * TokenBatchFormat::snippetFields] = first;
+    out[tableStart + i * TokenBatchFormat::snippetFields + 1] = count;
+    out.insert(out.end(), entries[i].begin(), entries[i].end());
+    first += count;
+  }
+
+  return out;
+}
+
+namespace {
+
+/**
+ * Flattens a TokenList into runs of one line and one style class each, for
+ * tokenizeToLines. A class is the chain of names a renderer can style a run
+ * by, innermost first: alias and type of the token the run is in, then of
+ * every enclosing token. Classes are interned per call.
+ */
+class LineRuns {
+public:
+  using Format = Libprisma::TokenLinesFormat;
+
+  LineRuns() : m_chains(1) {}
+
+  void add(const TokenList &tokens, uint32_t classId) {
+    for (auto it = tokens.begin(); it != tokens.end(); ++it) {
+      if (it->isSyntax()) {
+        const auto &syntax = static_cast<const Syntax &>(*it);
+        add(syntax.children(), intern(classId, syntax.type(), syntax.alias()));
+      } else {
+        text(static_cast<const Text &>(*it).value(), classId);
+      }
+    }
+  }
+
+  std::vector<uint32_t> finish(uint32_t tableSize) {
+    const size_t lineTable = Format::headerFields;
+    const size_t runTable = lineTable + m_lines.size();
+    size_t size = runTable + m_runs.size();
+    for (const auto &chain : m_chains) {
+      size += 1 + chain.size();
+    }
+
+    std::vector<uint32_t> out;
+    out.reserve(size);
+    out.push_back(Format::version);
+    out.push_back(static_cast<uint32_t>(m_lines.size()));
+    out.push_back(static_cast<uint32_t>(m_runs.size() / Format::runFields));
+    out.push_back(static_cast<uint32_t>(m_chains.size()));
+    out.push_back(tableSize);
+    out.insert(out.end(), m_lines.begin(), m_lines.end());
+    out.insert(out.end(), m_runs.begin(), m_runs.end());
+    for (const auto &chain : m_chains) {
+      out.push_back(static_cast<uint32_t>(chain.size()));
+      out.insert(out.end(), chain.begin(), chain.end());
+    }
+    return out;
+  }
+
+private:
+  uint32_t intern(uint32_t parent, uint32_t type, uint32_t alias) {
+    const auto key = std::make_tuple(parent, type, alias);
+    auto it = m_classes.find(key);
+    if (it != m_classes.end()) {
+      return it->second;
+    }
+
+    std::vector<uint32_t> chain;
+    chain.reserve(m_chains[parent].size() + 2);
+    if (alias != TokenNames::None) {
+      chain.push_back(alias);
+    }
+    chain.push_back(type);
+    chain.insert(chain.end(), m_chains[parent].begin(), m_chains[parent].end());
+
+    const auto id = static_cast<uint32_t>(m_chains.size());
+    m_chains.push_back(std::move(chain));
+    m_classes.emplace(key, id);
+    return id;
+  }
+
+  void text(std::string_view value, uint32_t classId) {
+    while (true) {
+      const size_t newline = value.find('\n');
+      run(value.substr(0, newline), classId);
+      if (newline == std::string_view::npos) {
+        return;
+      }
+
+      m_offset += 1;
+      m_lines.push_back(static_cast<uint32_t>(m_runs.size() / Format::runFields));
+      value.remove_prefix(newline + 1);
+    }
+  }
+
+  void run(std::string_view value, uint32_t classId) {
+    // A token can end inside a UTF-8 sequence, the byte regexes match bytes,
+    // then the rest of the character is counted with the token it started in
+    const uint32_t length = utf16Length(value);
+    if (length == 0) {
+      return;
+    }
+
+    // Extends the previous run if it has the same class on the same line
+    const size_t lineStart = m_lines.back() * Format::runFields;
+    if (m_runs.size() > lineStart && m_runs.back() == classId) {
+      m_runs[m_runs.size() - 2] += length;
+    } else {
+      m_runs.insert(m_runs.end(), {m_offset, length, classId});
+    }
+    m_offset += length;
+  }
+
+  uint32_t m_offset = 0;
+  // Index of the first run of every line
+  std::vector<uint32_t> m_lines{0};
+  std::vector<uint32_t> m_runs;
+  // Name chain of every class id, class 0 is plain text outside any token
+  std::vector<std::vector<uint32_t>> m_chains;
+  std::map<std::tuple<uint32_t, uint32_t, uint32_t>, uint32_t> m_classes;
+};
+
+} // namespace
+
+std::vector<uint32_t> Libprisma::tokenizeToLines(const std::string &code,
+                                                 const std::string &language) {
+  LineRuns runs;
+  uint32_t tableSize = TokenBufferFormat::textType + 1;
+
+  if (const auto highlighter = this->highlighter()) {
+    TokenList tokens = tokenizeParallel(*highlighter, code, language);
+    runs.add(tokens, 0);
+    tableSize = static_cast<uint32_t>(highlighter->tokenNames().size());
+  }
+
+  return runs.finish(tableSize);
+}
+
+std::vector<std::string> Libprisma::tokenTypes() {
+  if (const auto highlighter = this->highlighter()) {
+    return highlighter->tokenNames();
+  }
+
+  return {"", "text"};
+}
+
+std::vector<uint32_t>
+Libprisma::tokenIds(const std::vector<std::string> &names) {
+  std::vector<uint32_t> ids;
+  const auto highlighter = this->highlighter();
+  if (!highlighter) {
+    return ids;
+  }
+
+  const auto &table = highlighter->tokenNames();
+  for (const auto &name : names) {
+    // Id 0 is the empty alias, it names no token
+    const auto found = std::find(table.begin() + 1, table.end(), name);
+    if (found != table.end()) {
+      ids.push_back(static_cast<uint32_t>(found - table.begin()));
+    }
+  }
+  return ids;
+}
+
+void Libprisma::tokensToBuffer(const TokenList &tokenList, uint32_t depth,
+                               uint32_t &offset, std::vector<uint32_t> &out) {
+  for (auto it = tokenList.begin(); it != tokenList.end(); ++it) {
+    const size_t entry = out.size();
+    out.resize(entry + TokenBufferFormat::entryFields);
+    out[entry + 2] = offset;
+    out[entry + 4] = depth;
+
+    if (it->isSyntax()) {
+      const auto &syntax = static_cast<const Syntax &>(*it);
+      out[entry + 0] = syntax.type();
+      out[entry + 1] = syntax.alias();
+
+      // Children are written right after their parent, the length is
+      // patched in once the whole subtree has been visited
+      const uint32_t start = offset;
+      tokensToBuffer(syntax.children(), depth + 1, offset, out);
+      out[entry + 3] = offset - start;
+    } else {
+      const auto &text = static_cast<const Text &>(*it);
+      const uint32_t length = utf16Length(text.value());
+      out[entry + 0] = TokenBufferFormat::textType;
+      out[entry + 1] = TokenBufferFormat::noAlias;
+      out[entry + 3] = length;
+      offset += length;
+    }
+  }
 }
 
 std::string Libprisma::base64_decode(const std::string &in) {
   std::string out;
+  out.reserve(in.size() / 4 * 3);
   std::vector<int> T(256, -1);
   for (int i = 0; i < 64; i++)
     T["ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"[i]] =
@@ -86,83 +803,70 @@ std::string Libprisma::base64_decode(const std::string &in) {
   return out;
 }
 
-std::string Libprisma::escapeJson(const std::string &str) {
-  std::stringstream escaped;
-  for (char c : str) {
-    switch (c) {
-    case '"':
-      escaped << "\\\"";
-      break;
-    case '\\':
-      escaped << "\\\\";
-      break;
-    case '\b':
-      escaped << "\\b";
-      break;
-    case '\f':
-      escaped << "\\f";
-      break;
-    case '\n':
-      escaped << "\\n";
-      break;
-    case '\r':
-      escaped << "\\r";
-      break;
-    case '\t':
-      escaped << "\\t";
-      break;
-    default:
-      escaped << c;
-      break;
-    }
+std::string Libprisma::tokensToJson(const TokenList &tokenList) {
+  const auto highlighter = this->highlighter();
+  if (!highlighter) {
+    return "[]";
   }
-  return escaped.str();
+  return tokensToJson(*highlighter, tokenList);
 }
 
-std::string Libprisma::tokensToJson(const TokenList &tokenList) {
-  std::stringstream json;
-  json << "[";
+std::string Libprisma::tokensToJson(const SyntaxHighlighter &highlighter,
+                                    const TokenList &tokenList) {
+  // Every node adds its type and quotes to the source text it covers, only
+  // nodes nested in other tokens are not counted here
+  size_t source = 0;
+  for (auto it = tokenList.begin(); it != tokenList.end(); ++it) {
+    source += it->length();
+  }
+  JsonWriter out(source + tokenList.length * kJsonBytesPerNode);
+  writeTokens(highlighter, tokenList, out);
+  return out.take();
+}
+
+void Libprisma::writeTokens(const SyntaxHighlighter &highlighter,
+                            const TokenList &tokenList, JsonWriter &out) {
+  out.raw('[');
 
   bool first = true;
   for (auto it = tokenList.begin(); it != tokenList.end(); ++it) {
     if (!first)
-      json << ",";
+      out.raw(',');
     first = false;
-    json << tokenNodeToJson(*it);
+    writeToken(highlighter, *it, out);
   }
 
-  json << "]";
-  return json.str();
+  out.raw(']');
 }
 
-std::string Libprisma::tokenNodeToJson(const TokenListNode &node) {
-  std::stringstream json;
-  json << "{";
-
+void Libprisma::writeToken(const SyntaxHighlighter &highlighter,
+                           const TokenListNode &node, JsonWriter &out) {
   if (node.isSyntax()) {
-    const auto &syntax = dynamic_cast<const Syntax &>(node);
+    const auto &syntax = static_cast<const Syntax &>(node);
 
-    json << "\"type\":\"" << escapeJson(syntax.type()) << "\"";
+    out.raw("{\"type\":");
+    out.string(highlighter.tokenName(syntax.type()));
 
-    if (!syntax.alias().empty()) {
-      json << ",\"alias\":\"" << escapeJson(syntax.alias()) << "\"";
+    if (syntax.alias() != TokenNames::None) {
+      out.raw(",\"alias\":");
+      out.string(highlighter.tokenName(syntax.alias()));
     }
 
     // Check if there are nested tokens
     const TokenList &nested = syntax.children();
     if (nested.begin() != nested.end()) {
-      json << ",\"content\":" << tokensToJson(nested);
+      out.raw(",\"content\":");
+      writeTokens(highlighter, nested, out);
     } else {
-      json << ",\"content\":\"\"";
+      out.raw(",\"content\":\"\"");
     }
   } else {
-    const auto &text = dynamic_cast<const Text &>(node);
-    json << "\"type\":\"text\"";
-    json << ",\"content\":\"" << escapeJson(std::string(text.value())) << "\"";
+    const auto &text = static_cast<const Text &>(node);
+    out.raw("{\"type\":\"text\",\"content\":");
+    out.string(text.value());
   }
 
-  json << "}";
-  return json.str();
+  out.raw('}');
 }
 
 } // namespace libprisma
@@ -1,9 +1,24 @@
 #pragma once
 
+#include "JsonWriter.hpp"
+#include "ResultCache.hpp"
+#include "TokenDocument.hpp"
+#include "TokenRanges.hpp"
+#include "TokenStream.hpp"
+#include "WorkerPool.hpp"
 #include "libprisma/SyntaxHighlighter.h"
 #include "libprisma/TokenList.h"
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace athex {
 namespace libprisma {
@@ -21,7 +36,8 @@ public:
 
   /**
    * Tokenize source code into syntax-highlighted tokens.
-   * Returns a JSON string representation.
+   * Returns a JSON string representation. Results are cached, see
+   * setCacheBudget.
    *
    * @param code The source code to tokenize
    * @param language The language identifier (e.g., "javascript", "python")
@@ -30,31 +46,469 @@ public:
   std::string tokenizeToJson(const std::string &code,
                              const std::string &language);
 
+  /**
+   * Tokenize source code into JSON tokens within bounds on the regex work,
+   * the token memory and the nesting, see SyntaxHighlighter::tokenize. When
+   * the step or time limit is hit the result keeps the tokens matched until
+   * then and leaves the rest of the code plain text. Past the memory or
+   * depth limit, and for flat token types, matches are not tokenized inside.
+   * Bypasses the result cache, and large code is not split into chunks on
+   * the worker pool, so the limits bound the call as a whole.
+   *
+   * @param code The source code to tokenize
+   * @param language The language identifier
+   * @param limits Step budget, deadline, memory ceiling, nesting depth and
+   * flat token types of the call, zero or empty for no limit
+   * @return JSON object {"limited","shallow","bytes","tokens"}: limited and
+   * shallow tell which limits were hit, bytes is the memory of the token
+   * nodes and tokens the array tokenizeToJson returns
+   */
+  std::string tokenizeWithLimits(const std::string &code,
+                                 const std::string &language,
+                                 const TokenizeLimits &limits);
+
+  /**
+   * Tokenize source code into JSON tokens on a native worker thread.
+   * Exactly one of the callbacks is invoked, from the worker thread (resolve,
+   * or reject on error) or from the thread calling cancelTokenize.
+   *
+   * @param requestId Caller-chosen id used to cancel the request
+   * @param code The source code to tokenize
+   * @param language The language identifier
+   * @param resolve Receives the JSON string, same as tokenizeToJson
+   * @param reject Receives the error, including cancellation
+   */
+  void tokenizeAsync(uint64_t requestId, std::string code,
+                     std::string language,
+                     std::function<void(std::string)> resolve,
+                     std::function<void(std::exception_ptr)> reject);
+
+  /**
+   * Drop a pending tokenizeAsync request before it starts on a worker.
+   * A request that is already running is not interrupted.
+   *
+   * @param requestId Id passed to tokenizeAsync
+   * @return true if the request was dropped and rejected
+   */
+  bool cancelTokenize(uint64_t requestId);
+
+  /**
+   * Compile the patterns of languages on a native worker thread, so their
+   * first tokenize call does not pay for it. Queued behind pending
+   * tokenizeAsync requests. Unknown languages are skipped.
+   * Exactly one of the callbacks is invoked, from the worker thread.
+   *
+   * @param languages The language identifiers
+   * @param resolve Invoked once all languages are compiled
+   * @param reject Receives the error
+   */
+  void preloadLanguages(std::vector<std::string> languages,
+                        std::function<void()> resolve,
+                        std::function<void(std::exception_ptr)> reject);
+
+  /**
+   * Open a document for incremental tokenization.
+   * Replaces any document previously opened with the same id.
+   *
+   * @param documentId Caller-chosen id of the document
+   * @param code The source code of the document
+   * @param language The language identifier
+   * @return JSON string of all tokens, same as tokenizeToJson
+   */
+  std::string openDocument(uint64_t documentId, const std::string &code,
+                           const std::string &language);
+
+  /**
+   * Apply a text edit to an open document and re-tokenize only the part of
+   * it that can be affected by the edit.
+   * Offsets are in UTF-16 code units of the current document text.
+   *
+   * @param documentId Id passed to openDocument
+   * @param offset Start of the replaced range
+   * @param deleteCount Length of the replaced range
+   * @param insertText Replacement text
+   * @return JSON object {"start","deleteCount","tokens"}: the top-level
+   * tokens [start, start + deleteCount) of the previous result are replaced
+   * by tokens
+   */
+  std::string editDocument(uint64_t documentId, size_t offset,
+                           size_t deleteCount, const std::string &insertText);
+
+  /**
+   * Release an open document.
+   *
+   * @return true if the document was open
+   */
+  bool closeDocument(uint64_t documentId);
+
+  /**
+   * Open a large text for streaming tokenization, see TokenStream.
+   * Replaces any stream previously opened with the same id.
+   *
+   * @param streamId Caller-chosen id of the stream
+   * @param code The source code
+   * @param language The language identifier
+   * @param linesPerChunk Number of lines tokenized per readStream call
+   */
+  void openStream(uint64_t streamId, std::string code, std::string language,
+                  size_t linesPerChunk);
+
+  /**
+   * Tokenize the next chunk of a stream on a native worker thread.
+   * Exactly one of the callbacks is invoked.
+   *
+   * @param streamId Id passed to openStream
+   * @param resolve Receives a JSON object {"offset","startLine","endLine",
+   * "done","tokens"}: the top-level tokens starting at UTF-16 offset offset,
+   * through line endLine. done is true after the last chunk.
+   * @param reject Receives the error, e.g. if the stream is not open
+   */
+  void readStream(uint64_t streamId, std::function<void(std::string)> resolve,
+                  std::function<void(std::exception_ptr)> reject);
+
+  /**
+   * Release a stream. A pending read still completes.
+   *
+   * @return true if the stream was open
+   */
+  bool closeStream(uint64_t streamId);
+
+  /**
+   * Tokenize the lines [startLine, endLine) of a large text, e.g. the
+   * visible rows of a virtualized list, see TokenRanges.
+   * Checkpoints are cached for the most recently used texts, so later
+   * ranges of the same text resume from the nearest checkpoint above them.
+   *
+   * @param code The source code
+   * @param language The language identifier
+   * @param startLine First line, zero-based
+   * @param endLine Line after the last one
+   * @return JSON object {"offset","startLine","endLine","tokens"}: the
+   * top-level tokens overlapping the lines, the first one starting at
+   * UTF-16 offset offset on line startLine
+   */
+  std::string tokenizeRange(const std::string &code, const std::string &language,
+                            size_t startLine, size_t endLine);
+
+  /**
+   * Tokenize source code into a flat binary token stream.
+   * The buffer starts with a header of three uint32 values (format version,
+   * entry count, size of the token type table) followed by one
+   * entry of five uint32 values per token, in pre-order:
+   * type id, alias id, start offset, length and nesting depth.
+   * Offsets and lengths are in UTF-16 code units so they can be used to
+   * slice the original JS string directly.
+   *
+   * The code is only borrowed for the call, nothing of it is copied, so it
+   * can point straight into a caller's buffer.
+   *
+   * @param code The UTF-8 source code to tokenize
+   * @param language The language identifier (e.g., "javascript", "python")
+   * @return Binary token stream as uint32 words, see TokenBufferFormat
+   */
+  std::vector<uint32_t> tokenizeToBuffer(std::string_view code,
+                                         const std::string &language);
+
+  /**
+   * Tokenize many snippets in one call into a single binary token stream.
+   * The buffer starts with a header of three uint32 values (format version,
+   * snippet count, size of the token type table) and a table of two uint32
+   * values per snippet (index of its first entry, entry count), followed by
+   * the entries of all snippets in the layout of tokenizeToBuffer. Offsets
+   * are relative to the start of each snippet's code.
+   *
+   * @param codes The source code of each snippet
+   * @param languages The language identifier of each snippet
+   * @param parallel Spread the snippets over the worker pool, the calling
+   * thread takes part and blocks until all of them are done
+   * @return Binary token stream as uint32 words, see TokenBatchFormat
+   * @throws std::invalid_argument if codes and languages differ in size
+   */
+  std::vector<uint32_t> tokenizeBatch(const std::vector<std::string> &codes,
+                                      const std::vector<std::string> &languages,
+                                      bool parallel);
+
+  /**
+   * Tokenize into render-ready runs, split per line and flattened into one
+   * style class per run. The buffer starts with a header of five uint32
+   * values (format version, line count, run count, class count, size of the
+   * token type table), followed by the index of the first run of every line,
+   * then three uint32 values per run (start offset, length, class id), then
+   * every class as a name count and that many token type table ids.
+   * Runs cover the code without the line breaks, offsets and lengths are in
+   * UTF-16 code units. The names of a class are the alias and type of the
+   * token a run is in, followed by those of the enclosing tokens, so the
+   * first name that a theme has a style for gives the run its style.
+   * Class 0 has no names, it is text outside of any token.
+   *
+   * @param code The source code to tokenize
+   * @param language The language identifier (e.g., "javascript", "python")
+   * @return Line runs as uint32 words, see TokenLinesFormat
+   */
+  std::vector<uint32_t> tokenizeToLines(const std::string &code,
+                                        const std::string &language);
+
+  /**
+   * Get the token type table.
+   * Type and alias ids in buffers returned by tokenizeToBuffer index into
+   * this table. Id 0 is the empty string (no alias) and id 1 is "text".
+   * The names are interned once when the grammars are loaded, so there is a
+   * single table shared by all languages. It has to be fetched again only
+   * when a buffer reports a larger table size than the cached copy, i.e.
+   * when grammars were loaded after it was fetched.
+   *
+   * @return Interned token type and alias names
+   */
+  std::vector<std::string> tokenTypes();
+
+  /**
+   * Ids of token type and alias names in the table of tokenTypes, e.g. for
+   * TokenizeLimits::flatTokens. Unknown names are skipped.
+   *
+   * @param names Token type and alias names
+   * @return Their interned ids
+   */
+  std::vector<uint32_t> tokenIds(const std::vector<std::string> &names);
+
+  /**
+   * Serialize a TokenList in the format of tokenizeToJson.
+   * The tokens must come from a highlighter of the same grammars, their
+   * type and alias ids are resolved against the loaded ones.
+   *
+   * @param tokens Tokens of a tokenize call
+   * @return JSON array of token objects
+   */
+  std::string tokensToJson(const TokenList &tokens);
+
+  /**
+   * Set the memory budget of the tokenizeToJson result cache, evicting the
+   * least recently used results that no longer fit.
+   *
+   * @param bytes Budget for cached code and results, 0 disables the cache
+   */
+  void setCacheBudget(size_t bytes);
+
+  /**
+   * Drop all cached tokenizeToJson results
+   */
+  void clearCache();
+
+  /**
+   * Counters of the tokenizeToJson result cache
+   *
+   * @return JSON object {"hits","misses","entries","bytes","budget"}
+   */
+  std::string cacheStats();
+
+  /**
+   * Turn per-pattern profiling of the tokenize calls on or off. Enabling it
+   * starts a new profile. Results served from the cache are not tokenized
+   * and do not count.
+   *
+   * @param enabled Whether to profile the following tokenize calls
+   */
+  void setProfiling(bool enabled);
+
+  /**
+   * Counters of every pattern run since profiling was enabled, the most
+   * expensive first
+   *
+   * @return JSON array of {"language","token","pattern","regex","calls",
+   * "matches","misses","rematches","time"}, time in milliseconds
+   */
+  std::string profile();
+
+  /**
+   * Split large code into chunks that the worker pool tokenizes together in
+   * tokenizeToJson, tokenizeToBuffer and tokenizeToLines, off by default.
+   * The seams are checked, see SyntaxHighlighter::tokenizeParallel, but a
+   * construct that ends the same way from either side of a seam can still
+   * be tokenized differently than in one piece.
+   *
+   * @param enabled Whether to split code of 2 * kMinParallelChunk and more
+   */
+  void setParallelTokenize(bool enabled);
+
+  /**
+   * Name of the regex engine this build was compiled with ("boost" or "std")
+   */
+  static const char *regexBackend();
+
+  /**
+   * Loaded highlighter, nullptr before grammars are loaded. For callers that
+   * convert the TokenList themselves instead of going through JSON.
+   */
+  std::shared_ptr<SyntaxHighlighter> highlighter();
+
   /**
    * Load grammars from a base64 string.
    * This should be called once before using tokenizeToJson.
    *
-   * @param grammars Base64-encoded gzipped grammar data
+   * @param grammars Base64-encoded gzipped grammar image (grammars.bin)
+   * @throws std::runtime_error if it is not a valid grammar image
    */
   void loadGrammars(const std::string &grammars);
 
+  /**
+   * Load grammars by memory-mapping a grammar image (grammars.bin).
+   * The tables are read in place, nothing is decoded or copied up front.
+   *
+   * @param path Path of the image file
+   * @return false if the file cannot be opened, true if grammars are loaded
+   * @throws std::runtime_error if the file is not a valid grammar image
+   */
+  bool loadGrammarsFromFile(const std::string &path);
+
+  /**
+   * Load the grammar image shipped with the native module, see
+   * BundledGrammars.hpp. Preferred over loadGrammars at startup.
+   *
+   * @return false if this platform or app build has no bundled image
+   */
+  bool loadBundledGrammars();
+
+  /**
+   * Layout constants of the buffer returned by tokenizeToBuffer
+   */
+  struct TokenBufferFormat {
+    static constexpr uint32_t version = 1;
+    static constexpr size_t headerFields = 3;
+    static constexpr size_t entryFields = 5;
+    static constexpr uint32_t noAlias = TokenNames::None;
+    static constexpr uint32_t textType = TokenNames::Text;
+  };
+
+  /**
+   * Layout constants of the buffer returned by tokenizeToLines
+   */
+  struct TokenLinesFormat {
+    static constexpr uint32_t version = 1;
+    static constexpr size_t headerFields = 5;
+    static constexpr size_t runFields = 3;
+  };
+
+  /**
+   * Layout constants of the buffer returned by tokenizeBatch, entries use
+   * TokenBufferFormat::entryFields words each
+   */
+  struct TokenBatchFormat {
+    static constexpr uint32_t version = 1;
+    static constexpr size_t headerFields = 3;
+    static constexpr size_t snippetFields = 2;
+  };
+
 private:
+  struct Document {
+    std::string language;
+    TokenDocument tokens;
+  };
+
+  // Set once by the load functions, then shared by all threads. The
+  // highlighter is thread-safe, so tokenize calls run concurrently and only
+  // take m_mutex to read the pointer.
   std::shared_ptr<SyntaxHighlighter> m_highlighter;
+  std::mutex m_mutex;
+
+  struct Stream {
+    std::string language;
+    TokenStream tokens;
+    size_t utf16Offset;
+    std::mutex mutex;
+  };
+
+  struct RangeDocument {
+    size_t hash;
+    std::string language;
+    TokenRanges tokens;
+    std::mutex mutex;
+  };
+
+  // Lines between two checkpoints of tokenizeRange
+  static constexpr size_t kCheckpointLines = 100;
+  // Texts that tokenizeRange keeps checkpoints for
+  static constexpr size_t kMaxRangeDocuments = 4;
+
+  // Guards m_documents, m_streams and m_rangeDocuments
+  std::unordered_map<uint64_t, Document> m_documents;
+  std::unordered_map<uint64_t, std::shared_ptr<Stream>> m_streams;
+  // Most recently used first
+  std::list<std::shared_ptr<RangeDocument>> m_rangeDocuments;
+  std::mutex m_documentsMutex;
+
+  // Default budget of m_results
+  static constexpr size_t kDefaultCacheBudget = 8 * 1024 * 1024;
+
+  // Results of tokenizeToJson, also serving tokenizeAsync
+  ResultCache m_results{kDefaultCacheBudget};
+
+  // Upper bound of the worker pool size
+  static constexpr size_t kMaxWorkers = 4;
+
+  // Smallest chunk of a parallel tokenization, shorter code is tokenized in
+  // one piece on the calling thread
+  static constexpr size_t kMinParallelChunk = 128 * 1024;
+
+  // Set by setParallelTokenize
+  std::atomic<bool> m_parallel{false};
+
+  // Estimated JSON bytes that a token adds to the text it covers, for
+  // reserving the output of tokensToJson
+  static constexpr size_t kJsonBytesPerNode = 56;
+
+  // Estimated JSON bytes of a profile entry, its regex source included, for
+  // reserving the output of profile
+  static constexpr size_t kJsonBytesPerProfileEntry = 192;
+
+  // Created on the first tokenizeAsync or preloadLanguages call, or the first
+  // large file split into chunks, see tokenizeParallel. Declared last so it is
+  // destroyed, and its workers joined, before the state they use.
+  std::once_flag m_workersOnce;
+  std::unique_ptr<WorkerPool> m_workers;
 
   /**
-   * Convert a TokenList to JSON string
+   * Worker pool shared by the asynchronous entry points
    */
-  std::string tokensToJson(const TokenList &tokens);
+  WorkerPool &workers();
+
+  /**
+   * Tokenize code, split into chunks on the worker pool when it is large and
+   * setParallelTokenize enabled it, see SyntaxHighlighter::tokenizeParallel
+   */
+  TokenList tokenizeParallel(SyntaxHighlighter &highlighter,
+                             std::string_view code,
+                             const std::string &language);
+
+  /**
+   * tokensToJson with the highlighter the tokens come from, which the
+   * caller took from m_highlighter under m_mutex
+   */
+  static std::string tokensToJson(const SyntaxHighlighter &highlighter,
+                                  const TokenList &tokens);
+
+  /**
+   * Append a TokenList as a JSON array of tokens, with the type and alias
+   * names of highlighter
+   */
+  static void writeTokens(const SyntaxHighlighter &highlighter,
+                          const TokenList &tokens, JsonWriter &out);
+
+  /**
+   * Append a single TokenListNode as a JSON object
+   */
+  static void writeToken(const SyntaxHighlighter &highlighter,
+                         const TokenListNode &node, JsonWriter &out);
 
   /**
-   * Convert a single TokenListNode to JSON
+   * Tokenizer for TokenDocument that serializes each top-level token
    */
-  std::string tokenNodeToJson(const TokenListNode &node);
+  TokenDocument::Tokenizer documentTokenizer(const std::string &language);
 
   /**
-   * Escape a string for JSON
+   * Append the entries of a TokenList to a binary token stream.
+   * Advances offset by the UTF-16 length of the serialized tokens.
    */
-  std::string escapeJson(const std::string &str);
+  void tokensToBuffer(const TokenList &tokens, uint32_t depth,
+                      uint32_t &offset, std::vector<uint32_t> &out);
 
   /**
    * Decode base64 string
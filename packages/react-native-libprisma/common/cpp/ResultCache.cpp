@@ -0,0 +1,86 @@
+#include "ResultCache.hpp"
+
+#include <functional>
+
+namespace athex {
+namespace libprisma {
+
+ResultCache::ResultCache(size_t budget) : m_budget(budget) {}
+
+size_t ResultCache::hash(const std::string &code,
+                         const std::string &language) {
+  const size_t seed = std::hash<std::string>()(language);
+  return std::hash<std::string>()(code) ^
+         (seed + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+std::optional<std::string> ResultCache::find(const std::string &code,
+                                             const std::string &language) {
+  const size_t key = hash(code, language);
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const auto &find = m_index.find(key);
+  if (find == m_index.end() || find->second->code != code ||
+      find->second->language != language) {
+    ++m_misses;
+    return std::nullopt;
+  }
+
+  ++m_hits;
+  m_entries.splice(m_entries.begin(), m_entries, find->second);
+  return find->second->result;
+}
+
+void ResultCache::insert(const std::string &code, const std::string &language,
+                         const std::string &result) {
+  Entry entry{hash(code, language), code, language, result};
+  const size_t bytes = entry.bytes();
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (bytes > m_budget) {
+    return;
+  }
+
+  // Replaces an entry with the same key, including a colliding one
+  const auto &find = m_index.find(entry.hash);
+  if (find != m_index.end()) {
+    m_bytes -= find->second->bytes();
+    m_entries.erase(find->second);
+    m_index.erase(find);
+  }
+
+  m_entries.push_front(std::move(entry));
+  m_index[m_entries.front().hash] = m_entries.begin();
+  m_bytes += bytes;
+  trim();
+}
+
+void ResultCache::trim() {
+  while (m_bytes > m_budget && !m_entries.empty()) {
+    const Entry &last = m_entries.back();
+    m_bytes -= last.bytes();
+    m_index.erase(last.hash);
+    m_entries.pop_back();
+  }
+}
+
+void ResultCache::setBudget(size_t budget) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_budget = budget;
+  trim();
+}
+
+void ResultCache::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries.clear();
+  m_index.clear();
+  m_bytes = 0;
+}
+
+ResultCache::Stats ResultCache::stats() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return {m_hits, m_misses, m_entries.size(), m_bytes, m_budget};
+}
+
+} // namespace libprisma
+} // namespace athex
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace athex {
+namespace libprisma {
+
+/**
+ * Least recently used cache of serialized tokenize results, keyed by the
+ * source code and language.
+ * Entries are found by a hash of both and confirmed by comparing the code,
+ * which counts towards the budget along with the result. Inserting evicts
+ * the least recently used entries until the cache fits its budget again.
+ * Thread-safe.
+ */
+class ResultCache {
+public:
+  struct Stats {
+    uint64_t hits;
+    uint64_t misses;
+    size_t entries;
+    // Bytes of code and results held
+    size_t bytes;
+    size_t budget;
+  };
+
+  explicit ResultCache(size_t budget);
+
+  /**
+   * Cached result of code in language, counted as a hit or a miss
+   */
+  std::optional<std::string> find(const std::string &code,
+                                  const std::string &language);
+
+  /**
+   * Store a result. Results larger than the budget are not stored.
+   */
+  void insert(const std::string &code, const std::string &language,
+              const std::string &result);
+
+  /**
+   * Change the budget, evicting entries that no longer fit. 0 disables the
+   * cache.
+   */
+  void setBudget(size_t budget);
+
+  /**
+   * Drop all entries, the counters are kept
+   */
+  void clear();
+
+  Stats stats() const;
+
+private:
+  struct Entry {
+    size_t hash;
+    std::string code;
+    std::string language;
+    std::string result;
+
+    size_t bytes() const {
+      return code.size() + language.size() + result.size() + sizeof(Entry);
+    }
+  };
+
+  static size_t hash(const std::string &code, const std::string &language);
+
+  // Evict until m_bytes fits m_budget, m_mutex is held
+  void trim();
+
+  mutable std::mutex m_mutex;
+  // Most recently used first
+  std::list<Entry> m_entries;
+  std::unordered_map<size_t, std::list<Entry>::iterator> m_index;
+  size_t m_bytes = 0;
+  size_t m_budget;
+  uint64_t m_hits = 0;
+  uint64_t m_misses = 0;
+};
+
+} // namespace libprisma
+} // namespace athex
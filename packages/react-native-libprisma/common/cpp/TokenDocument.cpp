@@ -0,0 +1,151 @@
+#include "TokenDocument.hpp"
+
+#include <algorithm>
+
+namespace athex {
+namespace libprisma {
+
+// Number of tokens before the window end that have to match the previous
+// result before the rest of it is reused
+static constexpr size_t kConvergedTokens = 2;
+
+// Text past the window end that the patterns of a window see
+static constexpr size_t kWindowMargin = 4 * 1024;
+
+static size_t lineStart(const std::string &text, size_t pos) {
+  if (pos == 0) {
+    return 0;
+  }
+
+  size_t newline = text.rfind('\n', pos - 1);
+  return newline == std::string::npos ? 0 : newline + 1;
+}
+
+static size_t lineEnd(const std::string &text, size_t pos) {
+  size_t newline = text.find('\n', std::min(pos, text.size()));
+  return newline == std::string::npos ? text.size() : newline + 1;
+}
+
+TokenDocument::TokenDocument(std::string text, const Tokenizer &tokenize)
+    : m_text(std::move(text)),
+      m_segments(tokenize(m_text, 0, std::string_view::npos)) {}
+
+size_t TokenDocument::segmentAt(size_t offset) const {
+  auto it = std::upper_bound(
+      m_segments.begin(), m_segments.end(), offset,
+      [](size_t value, const Segment &segment) { return value < segment.start; });
+  return it == m_segments.begin() ? 0 : (it - m_segments.begin()) - 1;
+}
+
+TokenDocument::Patch TokenDocument::edit(size_t offset, size_t deleteCount,
+                                         const std::string &insertText,
+                                         const Tokenizer &tokenize) {
+  offset = std::min(offset, m_text.size());
+  deleteCount = std::min(deleteCount, m_text.size() - offset);
+
+  const size_t oldEditEnd = offset + deleteCount;
+  const auto shifted = [&](size_t start) {
+    return start - deleteCount + insertText.size();
+  };
+
+  m_text.replace(offset, deleteCount, insertText);
+
+  // Resync from the top-level token that contains the start of the line above
+  // the edit
+  size_t resync = lineStart(m_text, offset);
+  if (resync > 0) {
+    resync = lineStart(m_text, resync - 1);
+  }
+
+  const size_t count = m_segments.size();
+  const size_t first = segmentAt(resync);
+  const size_t windowStart = first < count ? m_segments[first].start : 0;
+
+  // The token before the window is tokenized with it, as the text in front
+  // of the window that a pattern with a lookbehind group (e.g. a named
+  // argument after a comma) needs. It is kept if it comes out the same,
+  // otherwise it depends on text further up and the window is tokenized
+  // without it.
+  bool context = first > 0 && first < count;
+
+  // First old token that starts after the edit
+  size_t after = first;
+  while (after < count && m_segments[after].start < oldEditEnd) {
+    ++after;
+  }
+
+  size_t last = std::min(count, after + kConvergedTokens);
+
+  std::vector<Segment> fresh;
+
+  while (true) {
+    const size_t windowEnd =
+        last < count ? shifted(m_segments[last].start) : m_text.size();
+
+    // Patterns see the text up to a margin past the window end, so that a
+    // token opened in the window (e.g. a block comment) gets its real end
+    // without every search running to the end of the document. A token that
+    // reaches the end of that text may have been cut there, the rest of the
+    // document is tokenized with the window then. The token right at the
+    // window end is returned too, it shows whether the tokens after the
+    // window are affected by the edit.
+    const size_t start = context ? m_segments[first - 1].start : windowStart;
+    const std::string_view rest = std::string_view(m_text).substr(start);
+    const size_t textEnd = lineEnd(m_text, windowEnd + kWindowMargin);
+    fresh = tokenize(rest.substr(0, textEnd - start), start,
+                     windowEnd - start + 1);
+    if (textEnd < m_text.size() && !fresh.empty() &&
+        fresh.back().start + fresh.back().length >= textEnd) {
+      fresh = tokenize(rest, start, windowEnd - start + 1);
+    }
+
+    if (context) {
+      const Segment &before = m_segments[first - 1];
+      if (fresh.empty() || fresh.front().length != before.length ||
+          fresh.front().json != before.json) {
+        context = false;
+        continue;
+      }
+      fresh.erase(fresh.begin());
+    }
+
+    if (last == count) {
+      break;
+    }
+
+    // The window converged if the tokens around its end are the same as
+    // before the edit, everything after it is then tokenized the same way
+    bool converged =
+        last - after >= kConvergedTokens && fresh.size() > kConvergedTokens;
+    for (size_t i = 0; converged && i <= kConvergedTokens; ++i) {
+      const Segment &next = fresh[fresh.size() - 1 - i];
+      const Segment &prev = m_segments[last - i];
+      converged = next.start == shifted(prev.start) &&
+                  next.length == prev.length && next.json == prev.json;
+    }
+
+    if (converged) {
+      fresh.pop_back();
+      break;
+    }
+
+    // Grow the window geometrically so a non-converging edit costs at most
+    // a constant factor over a full tokenization
+    last = std::min(count, last + std::max(kConvergedTokens, last - first));
+  }
+
+  for (size_t i = last; i < count; ++i) {
+    m_segments[i].start = shifted(m_segments[i].start);
+  }
+
+  const size_t insertCount = fresh.size();
+  m_segments.erase(m_segments.begin() + first, m_segments.begin() + last);
+  m_segments.insert(m_segments.begin() + first,
+                    std::make_move_iterator(fresh.begin()),
+                    std::make_move_iterator(fresh.end()));
+
+  return Patch{first, last - first, insertCount};
+}
+
+} // namespace libprisma
+} // namespace athex
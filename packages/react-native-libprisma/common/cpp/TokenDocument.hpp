@@ -0,0 +1,76 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace athex {
+namespace libprisma {
+
+/**
+ * Tokenized text that can be edited incrementally.
+ * The document keeps the top-level tokens of its last tokenization, each
+ * with its byte range and serialized form. An edit re-tokenizes only a
+ * window starting a line above the edit, growing the window until its last
+ * tokens converge with the old ones, and reuses the serialized tokens
+ * outside it.
+ *
+ * Prism grammars aren't strictly local: an edit can change a token that
+ * starts before the window (e.g. closing a block comment that was left
+ * open further up), which this heuristic doesn't catch, nor a token that
+ * starts in the window and only ends more than 4 KB past it.
+ * Reopen the document to get a full tokenization again.
+ */
+class TokenDocument {
+public:
+  /**
+   * One top-level token
+   */
+  struct Segment {
+    size_t start;
+    size_t length;
+    std::string json;
+  };
+
+  /**
+   * Top-level tokens [start, start + deleteCount) of the previous result
+   * were replaced by segments()[start, start + insertCount)
+   */
+  struct Patch {
+    size_t start;
+    size_t deleteCount;
+    size_t insertCount;
+  };
+
+  /**
+   * Tokenizes text, which runs a few KB past limit or to the end of the
+   * document, and returns its top-level tokens that start before limit,
+   * with start offsets relative to base
+   */
+  using Tokenizer = std::function<std::vector<Segment>(
+      std::string_view text, size_t base, size_t limit)>;
+
+  TokenDocument(std::string text, const Tokenizer &tokenize);
+
+  /**
+   * Replace deleteCount bytes at offset with insertText.
+   *
+   * @return The changed range of top-level tokens
+   */
+  Patch edit(size_t offset, size_t deleteCount, const std::string &insertText,
+             const Tokenizer &tokenize);
+
+  const std::string &text() const { return m_text; }
+
+  const std::vector<Segment> &segments() const { return m_segments; }
+
+private:
+  size_t segmentAt(size_t offset) const;
+
+  std::string m_text;
+  std::vector<Segment> m_segments;
+};
+
+} // namespace libprisma
+} // namespace athex
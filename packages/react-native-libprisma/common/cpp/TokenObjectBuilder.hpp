@@ -0,0 +1,99 @@
+#pragma once
+
+#include "libprisma/SyntaxHighlighter.h"
+#include "libprisma/TokenList.h"
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace athex {
+namespace libprisma {
+
+/**
+ * Property of a token object, see TokenObjectBuilder
+ */
+enum class TokenProperty { Type, Alias, Content };
+
+/**
+ * Builds the Token[] tree of tokenizeToJson as objects of a JS runtime
+ * instead of a JSON string. Every type or alias name is created once per id
+ * and then shared by all tokens that use it.
+ *
+ * Values creates and fills the objects of the runtime:
+ *
+ *   Array array(size_t size);
+ *   Object object();
+ *   String string(std::string_view utf8);
+ *   void set(Array &array, size_t index, Object &&object);
+ *   void set(Object &object, TokenProperty property, const String &value);
+ *   void set(Object &object, TokenProperty property, Array &&value);
+ *
+ * Properties are set in the order of the keys of tokenizeToJson.
+ */
+template <typename Values> class TokenObjectBuilder {
+public:
+  using Array = typename Values::Array;
+  using Object = typename Values::Object;
+  using String = typename Values::String;
+
+  TokenObjectBuilder(Values &values, const SyntaxHighlighter &highlighter)
+      : m_values(values), m_highlighter(highlighter),
+        m_names(highlighter.tokenNames().size()) {}
+
+  Array array(const TokenList &tokens) {
+    size_t size = 0;
+    for (auto it = tokens.begin(); it != tokens.end(); ++it) {
+      ++size;
+    }
+
+    Array array = m_values.array(size);
+    size_t index = 0;
+    for (auto it = tokens.begin(); it != tokens.end(); ++it) {
+      m_values.set(array, index++, object(*it));
+    }
+    return array;
+  }
+
+private:
+  Object object(const TokenListNode &node) {
+    Object object = m_values.object();
+
+    if (node.isSyntax()) {
+      const auto &syntax = static_cast<const Syntax &>(node);
+      m_values.set(object, TokenProperty::Type, name(syntax.type()));
+      if (syntax.alias() != TokenNames::None) {
+        m_values.set(object, TokenProperty::Alias, name(syntax.alias()));
+      }
+
+      const auto &nested = syntax.children();
+      if (nested.begin() != nested.end()) {
+        m_values.set(object, TokenProperty::Content, array(nested));
+      } else {
+        m_values.set(object, TokenProperty::Content, name(TokenNames::None));
+      }
+    } else {
+      m_values.set(object, TokenProperty::Type, name(TokenNames::Text));
+      m_values.set(object, TokenProperty::Content,
+                   m_values.string(static_cast<const Text &>(node).value()));
+    }
+
+    return object;
+  }
+
+  // Interned token name, "" for TokenNames::None and "text" for
+  // TokenNames::Text
+  const String &name(uint32_t id) {
+    auto &slot = m_names[id];
+    if (!slot) {
+      slot = m_values.string(m_highlighter.tokenName(id));
+    }
+    return *slot;
+  }
+
+  Values &m_values;
+  const SyntaxHighlighter &m_highlighter;
+  std::vector<std::optional<String>> m_names;
+};
+
+} // namespace libprisma
+} // namespace athex
@@ -0,0 +1,97 @@
+#include "TokenRanges.hpp"
+
+#include <algorithm>
+
+namespace athex {
+namespace libprisma {
+
+TokenRanges::TokenRanges(std::string text, size_t checkpointLines)
+    : m_stream(std::move(text), checkpointLines),
+      m_checkpoints{m_stream.checkpoint()} {}
+
+size_t TokenRanges::lineStart(const TokenStream::Checkpoint &from,
+                              size_t line) const {
+  const std::string &text = m_stream.text();
+  if (line <= from.line) {
+    const size_t newline =
+        from.offset > 0 ? text.rfind('\n', from.offset - 1) : std::string::npos;
+    return newline == std::string::npos ? 0 : newline + 1;
+  }
+
+  size_t pos = from.offset;
+  for (size_t count = line - from.line; count > 0 && pos < text.size();
+       --count) {
+    const size_t newline = text.find('\n', pos);
+    pos = newline == std::string::npos ? text.size() : newline + 1;
+  }
+  return pos;
+}
+
+TokenRanges::Range
+TokenRanges::tokenize(size_t startLine, size_t endLine,
+                      const TokenDocument::Tokenizer &tokenize) {
+  const size_t textSize = m_stream.text().size();
+  endLine = std::max(endLine, startLine + 1);
+
+  // Stream on from the last checkpoint until one is past startLine
+  while (m_checkpoints.back().line <= startLine &&
+         m_checkpoints.back().offset < textSize) {
+    m_stream.seek(m_checkpoints.back());
+    m_stream.next(tokenize);
+    m_checkpoints.push_back(m_stream.checkpoint());
+  }
+
+  // Last checkpoint on or above startLine
+  const auto above =
+      std::upper_bound(m_checkpoints.begin(), m_checkpoints.end(), startLine,
+                       [](size_t line, const TokenStream::Checkpoint &checkpoint) {
+                         return line < checkpoint.line;
+                       }) -
+      1;
+  const size_t rangeStart = lineStart(*above, startLine);
+  const size_t rangeEnd = std::max(lineStart(*above, endLine), rangeStart + 1);
+
+  // The checkpoint can be mid-line after a token spanning line breaks, which
+  // belongs to the chunk before it
+  auto from = above;
+  while (from != m_checkpoints.begin() && from->offset > rangeStart) {
+    --from;
+  }
+
+  // Stays empty for lines past the end of the text
+  Range range{textSize, textSize, startLine, startLine, {}};
+  const std::string &text = m_stream.text();
+  size_t index = from - m_checkpoints.begin();
+  size_t offset = from->offset;
+  m_stream.seek(*from);
+
+  while (offset < rangeEnd && !m_stream.done()) {
+    const auto chunk = m_stream.next(tokenize);
+    offset = chunk.end;
+    if (++index == m_checkpoints.size()) {
+      m_checkpoints.push_back(m_stream.checkpoint());
+    }
+
+    for (const auto &segment : chunk.segments) {
+      const size_t end = segment.start + segment.length;
+      if (end <= rangeStart || segment.start >= rangeEnd) {
+        continue;
+      }
+      if (range.segments.empty()) {
+        range.start = segment.start;
+        range.startLine =
+            chunk.startLine + std::count(text.begin() + chunk.start,
+                                         text.begin() + segment.start, '\n');
+      }
+      range.end = end;
+      range.segments.push_back(segment);
+    }
+  }
+
+  range.endLine = range.startLine + std::count(text.begin() + range.start,
+                                               text.begin() + range.end, '\n');
+  return range;
+}
+
+} // namespace libprisma
+} // namespace athex
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "TokenStream.hpp"
+#include <string>
+#include <vector>
+
+namespace athex {
+namespace libprisma {
+
+/**
+ * Tokenizes line ranges of a large text, e.g. the visible lines of a
+ * virtualized list.
+ * The text is streamed in chunks of checkpointLines lines and the position
+ * between two chunks is kept as a checkpoint. A range is tokenized from the
+ * nearest checkpoint above it, so jumping far into the text only streams
+ * the part that no earlier range reached.
+ *
+ * Tokens match the ones TokenStream yields with the same chunk size.
+ */
+class TokenRanges {
+public:
+  struct Range {
+    // Byte range and lines covered by segments, which hold whole top-level
+    // tokens and can start before or end after the requested lines
+    size_t start;
+    size_t end;
+    size_t startLine;
+    size_t endLine;
+    std::vector<TokenDocument::Segment> segments;
+  };
+
+  TokenRanges(std::string text, size_t checkpointLines);
+
+  /**
+   * Top-level tokens that overlap lines [startLine, endLine)
+   */
+  Range tokenize(size_t startLine, size_t endLine,
+                 const TokenDocument::Tokenizer &tokenize);
+
+  const std::string &text() const { return m_stream.text(); }
+
+private:
+  // Start of line line, counted from a checkpoint on or above it
+  size_t lineStart(const TokenStream::Checkpoint &from, size_t line) const;
+
+  TokenStream m_stream;
+  // Checkpoints in text order, the first one is the start of the text
+  std::vector<TokenStream::Checkpoint> m_checkpoints;
+};
+
+} // namespace libprisma
+} // namespace athex
@@ -0,0 +1,112 @@
+#include "TokenStream.hpp"
+
+#include <algorithm>
+
+namespace athex {
+namespace libprisma {
+
+// Least text past the last line of a chunk that the patterns of its window
+// see, so that a token starting right after the chunk is not cut by the
+// window end and taken apart into the last token of the chunk
+static constexpr size_t kWindowMargin = 4 * 1024;
+
+TokenStream::TokenStream(std::string text, size_t linesPerChunk)
+    : m_text(std::move(text)), m_linesPerChunk(std::max<size_t>(1, linesPerChunk)) {}
+
+size_t TokenStream::linesAhead(size_t pos, size_t count) const {
+  for (; count > 0 && pos < m_text.size(); --count) {
+    const size_t newline = m_text.find('\n', pos);
+    pos = newline == std::string::npos ? m_text.size() : newline + 1;
+  }
+  return std::min(pos, m_text.size());
+}
+
+size_t TokenStream::resyncPoint() const {
+  // Start of the line above the chunk, so lookbehind groups that reach back
+  // over a line break see the same text as in a full tokenization
+  size_t line = m_text.rfind('\n', m_offset - 1);
+  if (line != std::string::npos && line > 0) {
+    line = m_text.rfind('\n', line - 1);
+  }
+  const size_t lineAbove = line == std::string::npos ? 0 : line + 1;
+
+  // Latest token boundary of the previous chunk at or before it
+  auto it = std::upper_bound(m_boundaries.begin(), m_boundaries.end(),
+                             lineAbove);
+  return it == m_boundaries.begin() ? m_offset : *(it - 1);
+}
+
+std::vector<TokenDocument::Segment>
+TokenStream::tokenizeFrom(size_t from, size_t windowEnd, size_t limit,
+                          const TokenDocument::Tokenizer &tokenize) const {
+  auto segments = tokenize(std::string_view(m_text).substr(from, windowEnd - from),
+                           from, limit - from);
+  if (from == m_offset) {
+    return segments;
+  }
+
+  // Drop the context tokens, which were emitted by the previous chunk
+  auto first = std::find_if(segments.begin(), segments.end(),
+                            [&](const TokenDocument::Segment &segment) {
+                              return segment.start >= m_offset;
+                            });
+  if (first == segments.end() || first->start != m_offset) {
+    // A token spans the chunk start, resume without context
+    return tokenizeFrom(m_offset, windowEnd, limit, tokenize);
+  }
+  segments.erase(segments.begin(), first);
+  return segments;
+}
+
+TokenStream::Chunk TokenStream::next(const TokenDocument::Tokenizer &tokenize) {
+  Chunk chunk{m_offset, m_offset, m_line, m_line, {}};
+  if (done()) {
+    return chunk;
+  }
+
+  const size_t limit = std::max(linesAhead(m_offset, m_linesPerChunk), m_offset + 1);
+  const size_t resync = checkpoint().resync;
+
+  // Starts as long again as the chunk itself, at least by the margin
+  size_t windowEnd =
+      std::min(m_text.size(), limit + std::max(limit - m_offset, kWindowMargin));
+  while (true) {
+    chunk.segments = tokenizeFrom(resync, windowEnd, limit, tokenize);
+
+    const size_t end = chunk.segments.empty()
+                           ? m_offset
+                           : chunk.segments.back().start +
+                                 chunk.segments.back().length;
+    if (windowEnd == m_text.size() || end < windowEnd) {
+      chunk.end = std::max(end, limit);
+      break;
+    }
+
+    windowEnd = std::min(m_text.size(), windowEnd + (windowEnd - m_offset));
+  }
+
+  chunk.endLine = m_line + std::count(m_text.begin() + m_offset,
+                                      m_text.begin() + chunk.end, '\n');
+
+  m_boundaries.clear();
+  for (const auto &segment : chunk.segments) {
+    m_boundaries.push_back(segment.start);
+  }
+
+  m_offset = chunk.end;
+  m_line = chunk.endLine;
+  return chunk;
+}
+
+TokenStream::Checkpoint TokenStream::checkpoint() const {
+  return {m_offset, m_line, m_offset > 0 ? resyncPoint() : 0};
+}
+
+void TokenStream::seek(const Checkpoint &checkpoint) {
+  m_offset = checkpoint.offset;
+  m_line = checkpoint.line;
+  m_boundaries.assign(1, checkpoint.resync);
+}
+
+} // namespace libprisma
+} // namespace athex
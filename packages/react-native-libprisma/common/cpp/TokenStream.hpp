@@ -0,0 +1,93 @@
+#pragma once
+
+#include "TokenDocument.hpp"
+#include <string>
+#include <vector>
+
+namespace athex {
+namespace libprisma {
+
+/**
+ * Tokenizes a large text a few lines at a time.
+ * Each chunk runs from the end of the previous one to the first top-level
+ * token boundary at or after the next chunk's line, so it holds whole
+ * top-level tokens. Prism grammars keep no state between tokens besides
+ * the position, so the next chunk resumes at that boundary, tokenizing again
+ * from a line above it for the context of lookbehind groups.
+ *
+ * A chunk is tokenized within a window that reaches past its last line by
+ * the length of the chunk, and by at least a few KB.
+ * When a token runs into the window end (e.g. an unterminated block
+ * comment), the window grows until the token ends inside it or reaches
+ * the end of the text. Tokens match a full tokenization of the text except
+ * where a pattern looks further back than the line above the chunk, which
+ * gets more likely with chunks of only a line or two.
+ */
+class TokenStream {
+public:
+  struct Chunk {
+    // Byte range of the text covered by segments
+    size_t start;
+    size_t end;
+    // Lines of start and end, the chunk can begin and end mid-line when a
+    // token spans a line break
+    size_t startLine;
+    size_t endLine;
+    std::vector<TokenDocument::Segment> segments;
+  };
+
+  /**
+   * Position between two chunks to resume the stream from, see seek
+   */
+  struct Checkpoint {
+    size_t offset;
+    size_t line;
+    // Token boundary the next chunk is tokenized from
+    size_t resync;
+  };
+
+  TokenStream(std::string text, size_t linesPerChunk);
+
+  bool done() const { return m_offset >= m_text.size(); }
+
+  /**
+   * Tokenize the next chunk. Returns an empty chunk at the end of the text.
+   */
+  Chunk next(const TokenDocument::Tokenizer &tokenize);
+
+  /**
+   * Position before the next chunk
+   */
+  Checkpoint checkpoint() const;
+
+  /**
+   * Resume at a checkpoint of this stream. The following chunks are the
+   * same as when the stream got there by reading.
+   */
+  void seek(const Checkpoint &checkpoint);
+
+  const std::string &text() const { return m_text; }
+
+private:
+  // Start of the line count lines below the one containing pos
+  size_t linesAhead(size_t pos, size_t count) const;
+
+  // Token boundary of the previous chunk to tokenize the next one from
+  size_t resyncPoint() const;
+
+  // Tokens of [m_offset, windowEnd) that start before limit, tokenized from
+  // an earlier boundary so that the first tokens get their context
+  std::vector<TokenDocument::Segment>
+  tokenizeFrom(size_t from, size_t windowEnd, size_t limit,
+               const TokenDocument::Tokenizer &tokenize) const;
+
+  std::string m_text;
+  size_t m_linesPerChunk;
+  size_t m_offset = 0;
+  size_t m_line = 0;
+  // Token starts of the previous chunk
+  std::vector<size_t> m_boundaries;
+};
+
+} // namespace libprisma
+} // namespace athex
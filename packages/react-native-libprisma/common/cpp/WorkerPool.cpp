@@ -0,0 +1,138 @@
+#include "WorkerPool.hpp"
+
+#include <algorithm>
+
+namespace athex {
+namespace libprisma {
+
+WorkerPool::WorkerPool(size_t threads) {
+  for (size_t i = 0; i < threads; ++i) {
+    m_threads.emplace_back([this] { work(); });
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  std::deque<std::pair<uint64_t, Job>> pending;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stopping = true;
+    pending.swap(m_queue);
+  }
+  m_condition.notify_all();
+
+  for (auto &[id, job] : pending) {
+    if (job.cancel) {
+      job.cancel();
+    }
+  }
+
+  for (auto &thread : m_threads) {
+    thread.join();
+  }
+}
+
+void WorkerPool::submit(uint64_t id, Job job) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queue.emplace_back(id, std::move(job));
+  }
+  m_condition.notify_one();
+}
+
+bool WorkerPool::cancel(uint64_t id) {
+  Job job;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_queue.begin();
+    while (it != m_queue.end() && it->first != id) {
+      ++it;
+    }
+    if (it == m_queue.end()) {
+      return false;
+    }
+    job = std::move(it->second);
+    m_queue.erase(it);
+  }
+
+  if (job.cancel) {
+    job.cancel();
+  }
+  return true;
+}
+
+void WorkerPool::parallelFor(size_t count,
+                             const std::function<void(size_t)> &body) {
+  // Shared with the helper jobs, which can start after this call returned
+  // and then find no index left to run
+  struct State {
+    std::function<void(size_t)> body;
+    size_t count;
+    std::atomic<size_t> next{0};
+    std::mutex mutex;
+    std::condition_variable finished;
+    size_t done = 0;
+    std::exception_ptr error;
+  };
+
+  auto state = std::make_shared<State>();
+  state->body = body;
+  state->count = count;
+
+  const auto drain = [](State &state) {
+    size_t ran = 0;
+    std::exception_ptr error;
+    for (size_t i; (i = state.next.fetch_add(1)) < state.count; ++ran) {
+      try {
+        state.body(i);
+      } catch (...) {
+        if (!error) {
+          error = std::current_exception();
+        }
+      }
+    }
+
+    if (ran > 0) {
+      std::lock_guard<std::mutex> lock(state.mutex);
+      if (error && !state.error) {
+        state.error = error;
+      }
+      state.done += ran;
+      if (state.done == state.count) {
+        state.finished.notify_all();
+      }
+    }
+  };
+
+  const size_t helpers = std::min(size(), count > 0 ? count - 1 : 0);
+  for (size_t i = 0; i < helpers; ++i) {
+    submit(kAnonymousJob, {[state, drain] { drain(*state); }, nullptr});
+  }
+
+  drain(*state);
+
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->finished.wait(lock, [&] { return state->done == state->count; });
+  if (state->error) {
+    std::rethrow_exception(state->error);
+  }
+}
+
+void WorkerPool::work() {
+  while (true) {
+    Job job;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_condition.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+      if (m_stopping) {
+        return;
+      }
+      job = std::move(m_queue.front().second);
+      m_queue.pop_front();
+    }
+
+    job.run();
+  }
+}
+
+} // namespace libprisma
+} // namespace athex
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace athex {
+namespace libprisma {
+
+/**
+ * Fixed-size pool of native worker threads.
+ * Jobs are identified by a caller-provided id so that a job which has not
+ * been picked up by a worker yet can be cancelled.
+ */
+class WorkerPool {
+public:
+  struct Job {
+    // Runs on a worker thread
+    std::function<void()> run;
+    // Runs on the cancelling thread if the job is dropped before it starts
+    std::function<void()> cancel;
+  };
+
+  // Id of jobs that are not cancelled individually
+  static constexpr uint64_t kAnonymousJob = UINT64_MAX;
+
+  explicit WorkerPool(size_t threads);
+
+  /**
+   * Cancels all jobs that have not started yet and joins the workers.
+   */
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool &) = delete;
+  WorkerPool &operator=(const WorkerPool &) = delete;
+
+  /**
+   * Queue a job. Jobs start in submission order.
+   */
+  void submit(uint64_t id, Job job);
+
+  /**
+   * Drop a queued job and invoke its cancel callback.
+   *
+   * @return true if the job was still queued, false if it already started,
+   * finished or never existed
+   */
+  bool cancel(uint64_t id);
+
+  /**
+   * Run body(0) ... body(count - 1) on the calling thread and on the
+   * workers that are idle, and wait until all of them returned.
+   * The calling thread keeps taking indices itself, so this completes even
+   * when all workers are busy with other jobs.
+   *
+   * @throws The first exception thrown by body, once all indices ran
+   */
+  void parallelFor(size_t count, const std::function<void(size_t)> &body);
+
+  size_t size() const { return m_threads.size(); }
+
+private:
+  void work();
+
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  std::deque<std::pair<uint64_t, Job>> m_queue;
+  std::vector<std::thread> m_threads;
+  bool m_stopping = false;
+};
+
+} // namespace libprisma
+} // namespace athex
@@ -0,0 +1,237 @@
+#include "GrammarImage.h"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr size_t HeaderWords = 16;
+
+    // Record size in words of each table, in header order
+    constexpr size_t RecordWords[] = { 5, 2, 3, 1, 5, 2 };
+}
+
+GrammarImage::GrammarImage(std::string_view data, std::function<void()> release)
+    : m_data(data)
+    , m_release(std::move(release))
+{
+    const auto invalid = [this](const char* reason)
+    {
+        if (m_release)
+        {
+            m_release();
+        }
+        throw std::runtime_error(std::string("Invalid grammar image: ") + reason);
+    };
+
+    if (m_data.size() < HeaderWords * sizeof(uint32_t) || word(0) != Magic)
+    {
+        invalid("bad header");
+    }
+
+    if (word(4) != Version)
+    {
+        invalid("unsupported version");
+    }
+
+    for (size_t i = 0; i < TableCount; ++i)
+    {
+        TableInfo& table = m_tables[i];
+        table.count = word(8 + i * 8);
+        table.offset = word(12 + i * 8);
+        table.stride = RecordWords[i] * sizeof(uint32_t);
+
+        if (table.offset > m_data.size() || table.count > (m_data.size() - table.offset) / table.stride)
+        {
+            invalid("table out of range");
+        }
+    }
+
+    const size_t stringsOffset = word(56);
+    const size_t stringsSize = word(60);
+    if (stringsOffset > m_data.size() || stringsSize > m_data.size() - stringsOffset)
+    {
+        invalid("string pool out of range");
+    }
+
+    m_strings = m_data.substr(stringsOffset, stringsSize);
+
+    // References between records are checked once here, so that the lookups
+    // of LanguageTree never leave a table
+    const auto inRange = [](size_t first, size_t count, size_t size)
+    {
+        return first <= size && count <= size - first;
+    };
+    const auto isString = [&](size_t record)
+    {
+        return inRange(word(record), word(record + 4), m_strings.size());
+    };
+
+    if (nameCount() <= 1 || name(1) != "text")
+    {
+        invalid("missing the text name");
+    }
+    for (size_t id = 0; id < nameCount(); ++id)
+    {
+        if (!isString(offset(Names, id)))
+        {
+            invalid("name out of range");
+        }
+    }
+
+    for (size_t id = 0; id < patternCount(); ++id)
+    {
+        const size_t record = offset(Patterns, id);
+        if (!isString(record) || word(record + 8) >= nameCount() ||
+            (word(record + 12) != NoGrammar && word(record + 12) >= grammarCount()))
+        {
+            invalid("pattern out of range");
+        }
+    }
+
+    for (size_t id = 0; id < grammarCount(); ++id)
+    {
+        const auto record = grammar(id);
+        if (!inRange(record.firstToken, record.tokenCount, m_tables[Tokens].count))
+        {
+            invalid("grammar tokens out of range");
+        }
+    }
+
+    for (size_t id = 0; id < m_tables[Tokens].count; ++id)
+    {
+        const auto record = token(id);
+        if (record.name >= nameCount() || !inRange(record.firstIndex, record.indexCount, m_tables[Indices].count))
+        {
+            invalid("token out of range");
+        }
+    }
+
+    for (size_t id = 0; id < m_tables[Indices].count; ++id)
+    {
+        if (patternIndex(id) >= patternCount())
+        {
+            invalid("pattern index out of range");
+        }
+    }
+
+    for (size_t id = 0; id < languageCount(); ++id)
+    {
+        const size_t record = offset(Languages, id);
+        if (!isString(record) || !isString(record + 8) || word(record + 16) >= grammarCount())
+        {
+            invalid("language out of range");
+        }
+    }
+}
+
+GrammarImage::~GrammarImage()
+{
+    if (m_release)
+    {
+        m_release();
+    }
+}
+
+std::shared_ptr<const GrammarImage> GrammarImage::fromBytes(std::string bytes)
+{
+    auto owner = std::make_shared<std::string>(std::move(bytes));
+    return std::make_shared<GrammarImage>(*owner, [owner]() mutable { owner.reset(); });
+}
+
+#ifdef _WIN32
+
+std::shared_ptr<const GrammarImage> GrammarImage::fromFile(const std::string& path)
+{
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return nullptr;
+    }
+
+    LARGE_INTEGER size;
+    HANDLE mapping = nullptr;
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+    {
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    }
+
+    // The view keeps the mapping, and the mapping the file, alive
+    CloseHandle(file);
+    if (!mapping)
+    {
+        return nullptr;
+    }
+
+    const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!view)
+    {
+        return nullptr;
+    }
+
+    return std::make_shared<GrammarImage>(
+        std::string_view(static_cast<const char*>(view), static_cast<size_t>(size.QuadPart)),
+        [view]() { UnmapViewOfFile(view); });
+}
+
+#else
+
+std::shared_ptr<const GrammarImage> GrammarImage::fromFile(const std::string& path)
+{
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return nullptr;
+    }
+
+    struct stat info;
+    std::shared_ptr<const GrammarImage> image;
+    try
+    {
+        if (fstat(fd, &info) == 0 && info.st_size > 0)
+        {
+            image = fromDescriptor(fd, 0, static_cast<size_t>(info.st_size));
+        }
+    }
+    catch (...)
+    {
+        // An invalid image has already been unmapped
+        close(fd);
+        throw;
+    }
+
+    close(fd);
+    return image;
+}
+
+std::shared_ptr<const GrammarImage> GrammarImage::fromDescriptor(int fd, int64_t offset, size_t length)
+{
+    // mmap offsets have to be page aligned
+    const int64_t pageSize = sysconf(_SC_PAGESIZE);
+    const int64_t mapOffset = offset - offset % pageSize;
+    const size_t mapLength = length + static_cast<size_t>(offset - mapOffset);
+
+    void* view = mmap(nullptr, mapLength, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(mapOffset));
+    if (view == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    return std::make_shared<GrammarImage>(
+        std::string_view(static_cast<const char*>(view) + (offset - mapOffset), length),
+        [view, mapLength]() { munmap(view, mapLength); });
+}
+
+#endif
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+// Read-only view of grammars.bin, the indexed form of grammars.dat written by
+// scripts/build-grammar-image.js. The tables are read in place, so a mapped
+// file needs neither a parse pass nor any copy of its strings.
+//
+// All fields are little-endian uint32 words:
+//   header     magic "LPGI", version, then count and byte offset of the
+//              pattern, grammar, token, index, language and name tables,
+//              then byte offset and size of the string pool
+//   pattern    regex offset, regex length, alias name id, inside grammar
+//              (NoGrammar if none), options (RegexFlags | Lookbehind | Greedy)
+//   grammar    first token, token count
+//   token      name id, first index, index count
+//   index      pattern id
+//   language   name offset, name length, title offset, title length,
+//              grammar; sorted by name
+//   name       offset, length; ids 0 and 1 are "" and "text"
+// String offsets are relative to the string pool.
+class GrammarImage
+{
+public:
+    static constexpr uint32_t Magic = 0x4947504C;
+    static constexpr uint32_t Version = 1;
+    static constexpr uint32_t NoGrammar = 0xFFFFFFFF;
+
+    static constexpr uint32_t Lookbehind = 1 << 8;
+    static constexpr uint32_t Greedy = 1 << 9;
+
+    struct PatternRecord
+    {
+        std::string_view regex;
+        uint32_t alias;
+        uint32_t inside;
+        uint32_t options;
+    };
+
+    struct GrammarRecord
+    {
+        uint32_t firstToken;
+        uint32_t tokenCount;
+    };
+
+    struct TokenRecord
+    {
+        uint32_t name;
+        uint32_t firstIndex;
+        uint32_t indexCount;
+    };
+
+    struct LanguageRecord
+    {
+        std::string_view name;
+        std::string_view title;
+        uint32_t grammar;
+    };
+
+    // Takes ownership of data, release is called once the image is destroyed.
+    // Throws std::runtime_error if data is not a valid image: every table,
+    // string and reference between records is checked here, the accessors
+    // below do not check their ids.
+    GrammarImage(std::string_view data, std::function<void()> release);
+    ~GrammarImage();
+
+    GrammarImage(const GrammarImage&) = delete;
+    GrammarImage& operator=(const GrammarImage&) = delete;
+
+    static std::shared_ptr<const GrammarImage> fromBytes(std::string bytes);
+
+    // Maps the file read-only, nullptr if it cannot be opened. Throws
+    // std::runtime_error if it is not a valid image.
+    static std::shared_ptr<const GrammarImage> fromFile(const std::string& path);
+
+#ifndef _WIN32
+    // Maps length bytes at offset of an open file, e.g. an uncompressed asset
+    // inside an APK. The descriptor can be closed afterwards, also when this
+    // throws std::runtime_error for an invalid image.
+    static std::shared_ptr<const GrammarImage> fromDescriptor(int fd, int64_t offset, size_t length);
+#endif
+
+    size_t patternCount() const { return m_tables[Patterns].count; }
+    size_t grammarCount() const { return m_tables[Grammars].count; }
+    size_t languageCount() const { return m_tables[Languages].count; }
+    size_t nameCount() const { return m_tables[Names].count; }
+
+    PatternRecord pattern(size_t id) const
+    {
+        const size_t record = offset(Patterns, id);
+        return {
+            string(word(record), word(record + 4)),
+            word(record + 8),
+            word(record + 12),
+            word(record + 16)
+        };
+    }
+
+    GrammarRecord grammar(size_t id) const
+    {
+        const size_t record = offset(Grammars, id);
+        return { word(record), word(record + 4) };
+    }
+
+    TokenRecord token(size_t id) const
+    {
+        const size_t record = offset(Tokens, id);
+        return { word(record), word(record + 4), word(record + 8) };
+    }
+
+    uint32_t patternIndex(size_t id) const
+    {
+        return word(offset(Indices, id));
+    }
+
+    LanguageRecord language(size_t id) const
+    {
+        const size_t record = offset(Languages, id);
+        return {
+            string(word(record), word(record + 4)),
+            string(word(record + 8), word(record + 12)),
+            word(record + 16)
+        };
+    }
+
+    std::string_view name(size_t id) const
+    {
+        const size_t record = offset(Names, id);
+        return string(word(record), word(record + 4));
+    }
+
+private:
+    enum Table
+    {
+        Patterns,
+        Grammars,
+        Tokens,
+        Indices,
+        Languages,
+        Names,
+        TableCount
+    };
+
+    struct TableInfo
+    {
+        size_t count;
+        size_t offset;
+        size_t stride;
+    };
+
+    uint32_t word(size_t offset) const
+    {
+        uint32_t value;
+        memcpy(&value, m_data.data() + offset, sizeof(value));
+        return value;
+    }
+
+    size_t offset(Table table, size_t id) const
+    {
+        return m_tables[table].offset + id * m_tables[table].stride;
+    }
+
+    // Out of range strings are returned empty
+    std::string_view string(size_t offset, size_t length) const
+    {
+        return offset <= m_strings.size() ? m_strings.substr(offset, length) : std::string_view();
+    }
+
+    std::string_view m_data;
+    std::string_view m_strings;
+    TableInfo m_tables[TableCount];
+    std::function<void()> m_release;
+};
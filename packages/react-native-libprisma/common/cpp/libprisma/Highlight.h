@@ -1,140 +1,139 @@
 #pragma once
-#include <functional>
-#include <map>
-#include <regex>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
-class GrammarPtr;
-class GrammarToken;
+#include "Regex.h"
+
 class Pattern;
 class TokenList;
 
-class LanguageTree;
+// A token of a grammar, its patterns are the slice [first, first + count) of
+// Grammar::patterns
+struct GrammarToken {
+  // Interned name id, see LanguageTree::name
+  uint32_t name;
+  uint32_t first;
+  uint32_t count;
+};
 
+// Grammar of a language or of the inside of a pattern, see LanguageTree
 struct Grammar {
   std::vector<GrammarToken> tokens;
+  // Image indices of the patterns of all tokens, token by token. Patterns are
+  // compiled on first use, see LanguageTree::pattern
+  std::vector<uint32_t> patterns;
 };
 
-class GrammarPtr {
-public:
-  GrammarPtr(std::shared_ptr<LanguageTree> tree, size_t path);
-
-  const Grammar *operator->() const;
-  const Grammar *get() const;
-
-private:
-  std::shared_ptr<LanguageTree> m_tree;
-  size_t m_path;
+// Last greedy search of a pattern in the text being tokenized, see
+// Pattern::match
+struct GreedySearch {
+  const Pattern *pattern = nullptr;
+  // Position the search started from
+  size_t from = 0;
+  // Start of the regex match, including the lookbehind group
+  size_t start = 0;
+  bool success = false;
+  // Results of Pattern::match
+  size_t pos = 0;
+  std::string_view match;
 };
 
-class PatternRaw {
+class Pattern {
 public:
-  PatternRaw(std::string_view pattern,
-             std::regex_constants::syntax_option_type flags, bool lookbehind,
-             bool greedy, std::string alias, std::shared_ptr<GrammarPtr> inside)
-      : m_regex(std::string{pattern}), m_flags(flags), m_lookbehind(lookbehind),
+  Pattern(std::string_view pattern, uint8_t flags, bool lookbehind,
+          bool greedy, uint32_t alias, const Grammar *inside)
+      : m_regex(pattern, flags), m_source(pattern), m_lookbehind(lookbehind),
         m_greedy(greedy), m_alias(alias), m_inside(inside) {}
 
-  std::shared_ptr<Pattern> realize();
-
-private:
-  std::string m_regex;
-  std::regex_constants::syntax_option_type m_flags;
-  bool m_lookbehind;
-  bool m_greedy;
-  std::string m_alias;
-  std::shared_ptr<GrammarPtr> m_inside;
-};
+  // With a budget the search spends its steps, see MatchBudget
+  std::string_view match(bool &success, size_t &pos, std::string_view text,
+                         MatchBudget *budget = nullptr) const {
+    RegexMatch m;
 
-class Pattern {
-public:
-  Pattern(std::string_view pattern,
-          std::regex_constants::syntax_option_type flags, bool lookbehind,
-          bool greedy, std::string alias, std::shared_ptr<GrammarPtr> inside)
-      : m_lookbehind(lookbehind), m_greedy(greedy), m_alias(alias),
-        m_inside(inside) {
-    try {
-      m_regex = std::regex(std::string{pattern},
-                           flags | std::regex_constants::optimize);
-    } catch (const std::regex_error &e) {
-      // Log error and fallback to a regex that never matches
-      printf("Libprisma Regex Error: %s | Pattern: %s\n", e.what(),
-             std::string(pattern).c_str());
-      m_regex = std::regex("$^", std::regex_constants::optimize);
+    if (m_regex.search(text.data() + pos, text.data() + text.size(), m,
+                       budget)) {
+      return matched(m, success, pos, text);
     }
-  }
 
-  std::string_view match(bool &success, size_t &pos,
-                         std::string_view text) const {
-    std::cmatch m;
-
-    auto match = std::regex_search(text.data() + pos, text.data() + text.size(),
-                                   m, m_regex);
-    if (match) {
-      success = true;
-      pos += m.position();
-
-      if (m_lookbehind && m[1].matched) {
-        // change the match to remove the text matched by the Prism lookbehind
-        // group
-        auto lookbehindLength = m[1].length();
-        pos += lookbehindLength;
+    return {};
+  }
 
-        return text.substr(pos, m[0].length() - lookbehindLength);
+  // Greedy search, which always runs over the whole text. Reuses the last
+  // search of this pattern when its result does not depend on the new start:
+  // the same start, or a start before the match it found. Only an attempt
+  // at the new start itself can then give a different result. A plain
+  // regex searches again every time.
+  std::string_view match(bool &success, size_t &pos, std::string_view text,
+                         GreedySearch &last,
+                         MatchBudget *budget = nullptr) const {
+    const char *begin = text.data() + pos;
+    const char *end = text.data() + text.size();
+    RegexMatch m;
+    bool found;
+
+    if (!m_regex.plain() && last.pattern == this && pos >= last.from &&
+        (pos == last.from ||
+         (m_regex.local() && (!last.success || pos < last.start)))) {
+      if (pos == last.from || !m_regex.matchAt(begin, end, m, budget)) {
+        success = last.success;
+        if (last.success) {
+          pos = last.pos;
+        }
+        return last.match;
       }
-
-      return text.substr(pos, m[0].length());
+      found = true;
+    } else {
+      found = m_regex.search(begin, end, m, budget);
     }
 
-    return {};
+    last.pattern = this;
+    last.from = pos;
+    last.success = found;
+    last.match = {};
+    if (found) {
+      last.start = pos + m.position;
+      last.match = matched(m, success, pos, text);
+    }
+    last.pos = pos;
+    return last.match;
   }
 
+  // Regex source, it points into the grammar image
+  std::string_view source() const { return m_source; }
+
   bool lookbehind() const { return m_lookbehind; }
 
   bool greedy() const { return m_greedy; }
 
-  std::string alias() const { return m_alias; }
-
-  const Grammar *inside() const;
-
-private:
-  std::regex m_regex;
-  bool m_lookbehind;
-  bool m_greedy;
-  std::string m_alias;
-  std::shared_ptr<GrammarPtr> m_inside;
-};
-
-class PatternPtr {
-public:
-  PatternPtr(std::shared_ptr<LanguageTree> tree, size_t path);
-
-  const Pattern *operator->() const { return get(); }
+  // Interned name id, TokenNames::None if the pattern has no alias
+  uint32_t alias() const { return m_alias; }
 
-  const Pattern *get() const;
+  // Grammar the match is tokenized with, null if it stays one token
+  const Grammar *inside() const { return m_inside; }
 
 private:
-  std::shared_ptr<LanguageTree> m_tree;
-  size_t m_path;
-};
-
-class GrammarToken {
-public:
-  GrammarToken(const std::string name, std::vector<PatternPtr> patterns)
-      : m_name(name), m_patterns(std::move(patterns)) {}
+  std::string_view matched(const RegexMatch &m, bool &success, size_t &pos,
+                           std::string_view text) const {
+    success = true;
+    pos += m.position;
 
-  const std::string &name() const { return m_name; }
+    if (m_lookbehind && m.group1Matched) {
+      // change the match to remove the text matched by the Prism lookbehind
+      // group
+      pos += m.group1Length;
 
-  std::vector<PatternPtr>::const_iterator cbegin() const noexcept {
-    return m_patterns.cbegin();
-  }
+      return text.substr(pos, m.length - m.group1Length);
+    }
 
-  std::vector<PatternPtr>::const_iterator cend() const noexcept {
-    return m_patterns.cend();
+    return text.substr(pos, m.length);
   }
 
-private:
-  std::string m_name;
-  const std::vector<PatternPtr> m_patterns;
+  Regex m_regex;
+  std::string_view m_source;
+  bool m_lookbehind;
+  bool m_greedy;
+  uint32_t m_alias;
+  const Grammar *m_inside;
 };
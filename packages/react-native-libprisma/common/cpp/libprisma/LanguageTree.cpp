@@ -1,171 +1,170 @@
 #include "LanguageTree.h"
 
 #include "TokenList.h"
+#include <algorithm>
 #include <cassert>
-#include <regex>
-
-void LanguageTree::load(const std::string &content) {
-  Buffer buffer{content};
-  parsePatterns(buffer);
-  parseGrammars(buffer);
-  parseLanguages(buffer);
-}
-
-inline uint8_t freadUint8(Buffer &buffer) {
-  uint8_t value = 0;
-  if (buffer.offset + sizeof(uint8_t) <= buffer.content.size()) {
-    memcpy(&value, &buffer.content[buffer.offset], sizeof(uint8_t));
-    buffer.offset += sizeof(uint8_t);
+#include <unordered_set>
+
+void LanguageTree::load(std::shared_ptr<const GrammarImage> image,
+                        bool accelerate) {
+  m_image = std::move(image);
+  m_regexFlags = accelerate ? RegexFlags::None : RegexFlags::Plain;
+  m_grammars.reset(new std::atomic<const Grammar *>[m_image->grammarCount()]());
+  m_patterns.reset(new std::atomic<const Pattern *>[m_image->patternCount()]());
+
+  const size_t count = m_image->nameCount();
+  m_names.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    m_names.emplace_back(m_image->name(i));
   }
-  return value;
-}
 
-inline uint16_t freadUint16(Buffer &buffer) {
-  uint16_t value = 0;
-  if (buffer.offset + sizeof(uint16_t) <= buffer.content.size()) {
-    memcpy(&value, &buffer.content[buffer.offset], sizeof(uint16_t));
-    buffer.offset += sizeof(uint16_t);
-  }
-  return value;
+  assert(count > TokenNames::Text && m_names[TokenNames::Text] == "text");
 }
 
-inline std::string freadString(Buffer &buffer) {
-  size_t length = freadUint8(buffer);
-  if (length >= 254) {
-    size_t a = freadUint8(buffer);
-    size_t b = freadUint8(buffer);
-    size_t c = freadUint8(buffer);
-    length = a | (b << 8) | (c << 16);
+const Grammar *LanguageTree::find(const std::string &key) {
+  const auto language = findLanguage(key);
+  if (!language || language->grammar >= m_image->grammarCount()) {
+    return nullptr;
   }
 
-  std::string str(length, '\0');
-  if (buffer.offset + length <= buffer.content.size()) {
-    memcpy(&str[0], &buffer.content[buffer.offset], length);
-    buffer.offset += length;
+  const Grammar *grammar =
+      m_grammars[language->grammar].load(std::memory_order_acquire);
+  if (grammar == nullptr) {
+    std::lock_guard<std::mutex> lock(m_buildMutex);
+    materialize(language->grammar);
+    grammar = m_grammars[language->grammar].load(std::memory_order_relaxed);
   }
-  return str;
+  return grammar;
 }
 
-void LanguageTree::parseLanguages(Buffer &buffer) {
-  uint16_t count = freadUint16(buffer);
-
-  for (int i = 0; i < count; ++i) {
-    std::string name = freadString(buffer);
-    std::string displayName = freadString(buffer);
-    size_t index = freadUint16(buffer);
-    m_languages.emplace(name,
-                        std::pair<std::string, size_t>(displayName, index));
+bool LanguageTree::preload(const std::string &key) {
+  const Grammar *root = find(key);
+  if (!root) {
+    return false;
   }
-}
 
-void LanguageTree::parseGrammars(Buffer &buffer) {
-  uint16_t count = freadUint16(buffer);
+  std::vector<const Grammar *> pending{root};
+  std::unordered_set<const Grammar *> visited{root};
 
-  for (int i = 0; i < count; ++i) {
-    auto grammar = std::make_shared<Grammar>();
-    const auto keys = freadUint8(buffer);
+  while (!pending.empty()) {
+    const Grammar *grammar = pending.back();
+    pending.pop_back();
 
-    for (int j = 0; j < keys; ++j) {
-      std::vector<PatternPtr> indices;
-
-      const auto key = freadString(buffer);
-      uint8_t ids = freadUint8(buffer);
-
-      for (int k = 0; k < ids; ++k) {
-        indices.push_back(PatternPtr(shared_from_this(), freadUint16(buffer)));
+    for (const uint32_t index : grammar->patterns) {
+      const Grammar *inside = pattern(index)->inside();
+      if (inside && visited.insert(inside).second) {
+        pending.push_back(inside);
       }
-
-      grammar->tokens.push_back(GrammarToken(key, indices));
     }
-
-    m_grammars.push_back(grammar);
   }
-}
 
-void LanguageTree::parsePatterns(Buffer &buffer) {
-  uint16_t count = freadUint16(buffer);
+  return true;
+}
 
-  m_patterns.resize(count);
+std::optional<GrammarImage::LanguageRecord>
+LanguageTree::findLanguage(std::string_view name) const {
+  // The image sorts languages by name
+  size_t first = 0;
+  size_t last = m_image->languageCount();
+  while (first < last) {
+    const size_t middle = first + (last - first) / 2;
+    const auto language = m_image->language(middle);
+    const int order = language.name.compare(name);
+    if (order == 0) {
+      return language;
+    }
+    if (order < 0) {
+      first = middle + 1;
+    } else {
+      last = middle;
+    }
+  }
 
-  for (int i = 0; i < count; ++i) {
-    std::string item = freadString(buffer);
-    std::string_view value(item);
-    std::string alias;
+  return std::nullopt;
+}
 
-    size_t beg = value.find_first_of('/');
-    size_t end = value.find_last_of('/');
+void LanguageTree::materialize(size_t root) {
+  // Builds the grammar and, transitively, the grammars its patterns
+  // tokenize inside of. The root is published last, so a thread that sees it
+  // also sees the whole closure.
+  std::vector<size_t> pending{root};
+  std::vector<size_t> built;
+  const auto isBuilt = [&](size_t path) {
+    return m_grammars[path].load(std::memory_order_relaxed) != nullptr ||
+           std::find(built.begin(), built.end(), path) != built.end();
+  };
+
+  while (!pending.empty()) {
+    const size_t path = pending.back();
+    pending.pop_back();
+    if (isBuilt(path)) {
+      continue;
+    }
 
-    if (beg != std::string::npos && end != std::string::npos) {
-      std::string_view pattern = value.substr(beg + 1, end - (beg + 1));
-      std::string_view options = value.substr(end + 1);
+    Grammar &grammar = m_grammarStore.emplace_back();
+    const auto record = m_image->grammar(path);
+    grammar.tokens.reserve(record.tokenCount);
 
-      size_t aliasBeg = options.find_first_of(',');
-      size_t aliasEnd = options.find_last_of(',');
+    for (uint32_t j = 0; j < record.tokenCount; ++j) {
+      const auto token = m_image->token(record.firstToken + j);
+      grammar.tokens.push_back(
+          {token.name, static_cast<uint32_t>(grammar.patterns.size()),
+           token.indexCount});
 
-      std::string alias{
-          options.substr(aliasBeg + 1, aliasEnd - (aliasBeg + 1))};
-      size_t inside = 0;
+      for (uint32_t k = 0; k < token.indexCount; ++k) {
+        const uint32_t pattern = m_image->patternIndex(token.firstIndex + k);
+        grammar.patterns.push_back(pattern);
 
-      if (aliasEnd + 1 < options.size()) {
-        for (int i = aliasEnd + 1; i < options.size(); i++) {
-          char c = options[i];
-          if (c >= '0' && c <= '9') {
-            inside = inside * 10 + (c - '0');
-          } else {
-            assert(false);
-          }
+        const uint32_t inside = m_image->pattern(pattern).inside;
+        if (inside < m_image->grammarCount() && !isBuilt(inside)) {
+          pending.push_back(inside);
         }
-      } else {
-        inside = std::string::npos;
       }
+    }
 
-      bool lookbehind = false;
-      bool greedy = false;
-
-      std::regex_constants::syntax_option_type flags =
-          std::regex_constants::ECMAScript;
-
-      for (char c : options.substr(0, aliasBeg)) {
-        switch (c) {
-        case 'l':
-          lookbehind = true;
-          break;
-        case 'y':
-          greedy = true;
-          break;
-        case 'i':
-          flags |= std::regex_constants::icase;
-          break;
-        case 'm':
-          // Note: std::regex doesn't have no_mod_m, multiline is default
-          break;
-        }
-      }
+    built.push_back(path);
+  }
 
-      if (inside != std::string::npos) {
-        m_patternsRaw.push_back(std::make_shared<PatternRaw>(
-            pattern, flags, lookbehind, greedy, std::string{alias},
-            std::make_shared<GrammarPtr>(shared_from_this(), inside)));
-      } else {
-        m_patternsRaw.push_back(std::make_shared<PatternRaw>(
-            pattern, flags, lookbehind, greedy, std::string{alias}, nullptr));
-      }
-    }
+  // m_grammarStore ends with the grammars built above, in order
+  const size_t first = m_grammarStore.size() - built.size();
+  for (size_t i = built.size(); i-- > 0;) {
+    m_grammars[built[i]].store(&m_grammarStore[first + i],
+                               std::memory_order_release);
   }
 }
 
-const Pattern *LanguageTree::resolvePattern(size_t path) {
-  std::shared_ptr<Pattern> &parsed = m_patterns[path];
-  if (parsed == nullptr) {
-    parsed = m_patternsRaw[path]->realize();
-
-    m_patternsRaw[path] = nullptr;
-    m_patterns[path] = parsed;
+const Pattern *LanguageTree::compile(uint32_t index) {
+  const auto record = m_image->pattern(index);
+
+  const uint8_t flags =
+      (record.options & (RegexFlags::IgnoreCase | RegexFlags::Multiline)) |
+      m_regexFlags;
+  const bool lookbehind = record.options & GrammarImage::Lookbehind;
+  const bool greedy = record.options & GrammarImage::Greedy;
+
+  // Patterns are only reached through a materialized grammar, and
+  // materialize builds the inside grammars of its patterns along with it
+  const Grammar *inside = nullptr;
+  if (record.inside < m_image->grammarCount()) {
+    inside = m_grammars[record.inside].load(std::memory_order_acquire);
+    assert(inside != nullptr);
   }
 
-  return parsed.get();
-}
+  // Compiled without any lock, so first uses on other threads and of other
+  // languages do not wait for this one
+  auto pattern = std::make_unique<Pattern>(record.regex, flags, lookbehind,
+                                           greedy, record.alias, inside);
+
+  const Pattern *expected = nullptr;
+  if (!m_patterns[index].compare_exchange_strong(
+          expected, pattern.get(), std::memory_order_acq_rel,
+          std::memory_order_acquire)) {
+    // Another thread published it first
+    return expected;
+  }
 
-const Grammar *LanguageTree::resolveGrammar(size_t path) {
-  return m_grammars[path].get();
+  const Pattern *compiled = pattern.get();
+  std::lock_guard<std::mutex> lock(m_patternMutex);
+  m_patternStore.push_back(std::move(pattern));
+  return compiled;
 }
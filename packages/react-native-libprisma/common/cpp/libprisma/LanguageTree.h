@@ -1,38 +1,60 @@
 #pragma once
 
-#include <sstream>
-#include <fstream>
+#include <atomic>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <string_view>
+#include <vector>
 
+#include "GrammarImage.h"
 #include "Highlight.h"
 
-struct Buffer {
-    const std::string &content;
-    int64_t offset = 0;
-};
-
-class LanguageTree : public std::enable_shared_from_this<LanguageTree>
+// Grammars are materialized per language: find builds the Grammar objects of
+// a language and of everything it references through inside on first use,
+// and patterns are compiled when they are first matched. Nothing else of the
+// image is touched, so memory scales with the languages in use.
+//
+// The tree is safe to use from several threads at once. Grammars are built
+// once under a lock and published through atomic slots. Patterns are compiled
+// without the lock, threads that compile the same one race to publish it and
+// all but the first discard theirs. Once published, both are immutable and
+// read without locking.
+//
+// Grammars refer to patterns by their image index and patterns to their
+// inside grammar by plain pointer, the tree owns all of them.
+class LanguageTree
 {
 public:
     LanguageTree() = default;
 
-    void load(const std::string& content);
+    // The image is kept alive by the tree, patterns and language names are
+    // read from it in place. Without accelerate patterns are compiled with
+    // RegexFlags::Plain.
+    void load(std::shared_ptr<const GrammarImage> image, bool accelerate = true);
 
-    const Pattern* resolvePattern(size_t path);
-    const Grammar* resolveGrammar(size_t path);
+    // Compiled pattern of an index of Grammar::patterns
+    const Pattern* pattern(uint32_t index)
+    {
+        const Pattern* compiled = m_patterns[index].load(std::memory_order_acquire);
+        return compiled ? compiled : compile(index);
+    }
 
     std::map<std::string, std::string> keys() const
     {
         std::map<std::string, std::string> keys;
 
-        for (const auto& kv : m_languages)
+        for (size_t i = 0; i < m_image->languageCount(); ++i)
         {
-            if (kv.second.first.empty())
+            const auto language = m_image->language(i);
+            if (language.title.empty())
             {
                 continue;
             }
 
-            keys.emplace(kv.first, kv.second.first);
+            keys.emplace(std::string(language.name), std::string(language.title));
         }
 
         return keys;
@@ -40,33 +62,58 @@ public:
 
     std::string languageName(const std::string& language) const
     {
-        const auto& find = m_languages.find(language);
-        if (find != m_languages.end())
+        const auto find = findLanguage(language);
+        if (find)
         {
-            return find->second.first;
+            return std::string(find->title);
         }
 
         return language;
     }
 
-    const Grammar* find(const std::string& key) const
+    // Token type and alias names of all grammars, indexed by name id
+    const std::vector<std::string>& names() const
     {
-        const auto& value = m_languages.find(key);
-        if (value != m_languages.end())
-        {
-            return m_grammars[value->second.second].get();
-        }
+        return m_names;
+    }
 
-        return nullptr;
+    const std::string& name(uint32_t id) const
+    {
+        return m_names[id];
     }
 
+    const Grammar* find(const std::string& key);
+
+    // Materializes the grammar like find and compiles every pattern it can
+    // reach, false if the language is unknown
+    bool preload(const std::string& key);
+
 private:
-    void parseLanguages(Buffer &buffer);
-    void parseGrammars(Buffer &buffer);
-    void parsePatterns(Buffer &buffer);
-
-    std::map<std::string, std::pair<std::string, size_t>> m_languages;
-    std::vector<std::shared_ptr<Grammar>> m_grammars;
-    std::vector<std::shared_ptr<Pattern>> m_patterns;
-    std::vector<std::shared_ptr<PatternRaw>> m_patternsRaw;
-};
\ No newline at end of file
+    std::optional<GrammarImage::LanguageRecord> findLanguage(std::string_view name) const;
+
+    void materialize(size_t grammar);
+
+    const Pattern* compile(uint32_t index);
+
+    std::shared_ptr<const GrammarImage> m_image;
+
+    // Indexed like the image tables, null until materialized
+    std::unique_ptr<std::atomic<const Grammar*>[]> m_grammars;
+    std::unique_ptr<std::atomic<const Pattern*>[]> m_patterns;
+
+    // Owners of the published grammars, only touched under m_buildMutex. The
+    // deque keeps them in blocks without moving them.
+    std::mutex m_buildMutex;
+    std::deque<Grammar> m_grammarStore;
+
+    // Owners of the published patterns, only touched under m_patternMutex,
+    // which is held just to append one
+    std::mutex m_patternMutex;
+    std::vector<std::unique_ptr<Pattern>> m_patternStore;
+
+    // interned by the image builder, ids below TokenNames are reserved
+    std::vector<std::string> m_names;
+
+    // Added to the flags of every pattern
+    uint8_t m_regexFlags = RegexFlags::None;
+};
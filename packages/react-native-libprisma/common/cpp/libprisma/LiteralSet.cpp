@@ -0,0 +1,247 @@
+#include "LiteralSet.h"
+
+#include <map>
+
+namespace
+{
+
+unsigned char lower(unsigned char c)
+{
+    return c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c;
+}
+
+// Literal characters of an alternative, escapes of punctuation included
+bool parseLiteral(std::string_view source, std::string& literal)
+{
+    for (size_t i = 0; i < source.size(); ++i)
+    {
+        const char c = source[i];
+        if (c == '\\')
+        {
+            if (++i == source.size())
+            {
+                return false;
+            }
+
+            const char escaped = source[i];
+            if ((escaped >= 'a' && escaped <= 'z') || (escaped >= 'A' && escaped <= 'Z') || (escaped >= '0' && escaped <= '9'))
+            {
+                return false;
+            }
+            literal += escaped;
+        }
+        else if (std::string_view("[](){}|.*+?^$").find(c) != std::string_view::npos)
+        {
+            return false;
+        }
+        else
+        {
+            literal += c;
+        }
+    }
+    return !literal.empty();
+}
+
+// Whether the source is one non-capturing group: (?:a|b), but not (?:a)|(?:b)
+bool wholeGroup(std::string_view source)
+{
+    if (source.substr(0, 3) != "(?:")
+    {
+        return false;
+    }
+
+    int depth = 0;
+    for (size_t i = 0; i < source.size(); ++i)
+    {
+        if (source[i] == '\\')
+        {
+            ++i;
+        }
+        else if (source[i] == '(')
+        {
+            ++depth;
+        }
+        else if (source[i] == ')' && --depth == 0)
+        {
+            return i == source.size() - 1;
+        }
+    }
+    return false;
+}
+
+}
+
+std::optional<LiteralSet> LiteralSet::parse(std::string_view pattern, bool ignoreCase, const std::array<bool, 256>& word)
+{
+    LiteralSet set(word);
+    set.m_ignoreCase = ignoreCase;
+
+    if (pattern.substr(0, 2) == "\\b")
+    {
+        set.m_wordStart = true;
+        pattern.remove_prefix(2);
+    }
+    if (pattern.size() >= 2 && pattern.substr(pattern.size() - 2) == "\\b" &&
+        (pattern.size() < 3 || pattern[pattern.size() - 3] != '\\'))
+    {
+        set.m_wordEnd = true;
+        pattern.remove_suffix(2);
+    }
+    if (wholeGroup(pattern))
+    {
+        pattern = pattern.substr(3, pattern.size() - 4);
+    }
+    else if (set.m_wordStart || set.m_wordEnd)
+    {
+        // Outside a group the assertions only belong to the first and the
+        // last alternative: \bfoo|bar\b is (?:\bfoo)|(?:bar\b)
+        return std::nullopt;
+    }
+
+    std::vector<std::string> literals;
+    size_t start = 0;
+    for (size_t i = 0; i <= pattern.size(); ++i)
+    {
+        if (i < pattern.size() && pattern[i] == '\\')
+        {
+            ++i;
+            continue;
+        }
+        if (i == pattern.size() || pattern[i] == '|')
+        {
+            std::string literal;
+            if (!parseLiteral(pattern.substr(start, i - start), literal))
+            {
+                return std::nullopt;
+            }
+            for (auto& c : literal)
+            {
+                // Case folding beyond ASCII is up to the regex traits
+                if (ignoreCase && static_cast<unsigned char>(c) >= 0x80)
+                {
+                    return std::nullopt;
+                }
+                if (ignoreCase)
+                {
+                    c = lower(c);
+                }
+            }
+            literals.push_back(std::move(literal));
+            start = i + 1;
+        }
+    }
+
+    if (literals.size() < 2)
+    {
+        return std::nullopt;
+    }
+
+    set.build(literals);
+    return set;
+}
+
+void LiteralSet::build(const std::vector<std::string>& literals)
+{
+    struct Building
+    {
+        std::map<unsigned char, uint32_t> children;
+        int32_t alternative = -1;
+    };
+
+    std::vector<Building> tree(1);
+    for (size_t i = 0; i < literals.size(); ++i)
+    {
+        uint32_t node = 0;
+        for (unsigned char c : literals[i])
+        {
+            auto it = tree[node].children.find(c);
+            if (it == tree[node].children.end())
+            {
+                tree.emplace_back();
+                it = tree[node].children.emplace(c, static_cast<uint32_t>(tree.size() - 1)).first;
+            }
+            node = it->second;
+        }
+        if (tree[node].alternative < 0)
+        {
+            tree[node].alternative = static_cast<int32_t>(i);
+        }
+    }
+
+    // Flatten with the edges of each node next to each other
+    m_nodes.resize(tree.size());
+    for (size_t i = 0; i < tree.size(); ++i)
+    {
+        m_nodes[i].firstEdge = static_cast<uint32_t>(m_edges.size());
+        m_nodes[i].edgeCount = static_cast<uint32_t>(tree[i].children.size());
+        m_nodes[i].alternative = tree[i].alternative;
+        for (const auto& [byte, node] : tree[i].children)
+        {
+            m_edges.push_back({byte, node});
+        }
+    }
+}
+
+uint32_t LiteralSet::child(const Node& node, unsigned char byte) const
+{
+    const Edge* edges = m_edges.data() + node.firstEdge;
+    for (uint32_t i = 0; i < node.edgeCount; ++i)
+    {
+        if (edges[i].byte == byte)
+        {
+            return edges[i].node;
+        }
+    }
+    return 0;
+}
+
+bool LiteralSet::boundary(const char* begin, const char* at, const char* end) const
+{
+    const bool before = at > begin && (*m_word)[static_cast<unsigned char>(at[-1])];
+    const bool after = at < end && (*m_word)[static_cast<unsigned char>(*at)];
+    return before != after;
+}
+
+bool LiteralSet::search(const char* begin, const char* from, const char* end, bool continuous, size_t& position, size_t& length) const
+{
+    for (const char* candidate = from; candidate < end; ++candidate)
+    {
+        if (!m_wordStart || boundary(begin, candidate, end))
+        {
+            int32_t best = -1;
+            size_t bestLength = 0;
+
+            uint32_t node = 0;
+            for (const char* it = candidate; it < end; ++it)
+            {
+                const unsigned char c = static_cast<unsigned char>(*it);
+                node = child(m_nodes[node], m_ignoreCase ? lower(c) : c);
+                if (node == 0)
+                {
+                    break;
+                }
+
+                const int32_t alternative = m_nodes[node].alternative;
+                if (alternative >= 0 && (best < 0 || alternative < best) &&
+                    (!m_wordEnd || boundary(begin, it + 1, end)))
+                {
+                    best = alternative;
+                    bestLength = it + 1 - candidate;
+                }
+            }
+
+            if (best >= 0)
+            {
+                position = candidate - begin;
+                length = bestLength;
+                return true;
+            }
+        }
+
+        if (continuous)
+        {
+            break;
+        }
+    }
+    return false;
+}
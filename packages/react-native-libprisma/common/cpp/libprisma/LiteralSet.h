@@ -0,0 +1,60 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Matcher for patterns that are an alternation of literals, like the
+// keyword patterns of most grammars: \b(?:break|case|catch|...)\b
+// The literals are kept in a prefix tree, so a position is tested in one
+// walk over the text instead of trying every alternative in turn.
+//
+// Matches are the same as the regex engine's: the leftmost position, and
+// there the first alternative in pattern order whose end satisfies the
+// trailing \b.
+class LiteralSet {
+public:
+  // nullopt if pattern is not an alternation of at least two literals,
+  // optionally in a non-capturing group. \b before or after the
+  // alternation is only taken around such a group.
+  static std::optional<LiteralSet> parse(std::string_view pattern,
+                                         bool ignoreCase,
+                                         const std::array<bool, 256> &word);
+
+  // Leftmost match starting in [from, end). Assertions see the text from
+  // begin on. With continuous, only a match at from.
+  bool search(const char *begin, const char *from, const char *end,
+              bool continuous, size_t &position, size_t &length) const;
+
+private:
+  struct Node {
+    uint32_t firstEdge = 0;
+    uint32_t edgeCount = 0;
+    // Index of the first alternative ending here, -1 if none
+    int32_t alternative = -1;
+  };
+
+  struct Edge {
+    unsigned char byte;
+    uint32_t node;
+  };
+
+  LiteralSet(const std::array<bool, 256> &word) : m_word(&word) {}
+
+  void build(const std::vector<std::string> &literals);
+
+  // Child of node for byte, 0 (the root) if there is none
+  uint32_t child(const Node &node, unsigned char byte) const;
+
+  bool boundary(const char *begin, const char *at, const char *end) const;
+
+  std::vector<Node> m_nodes;
+  std::vector<Edge> m_edges;
+  const std::array<bool, 256> *m_word;
+  bool m_ignoreCase = false;
+  bool m_wordStart = false;
+  bool m_wordEnd = false;
+};
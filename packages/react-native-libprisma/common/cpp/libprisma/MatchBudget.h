@@ -0,0 +1,221 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+// Bounds on the work, memory and nesting of one tokenize call, see
+// SyntaxHighlighter::tokenize
+struct TokenizeLimits {
+  // Steps the regex engines may take over the text, summed over all searches
+  // of the call. Every move of the engine by one character is a step, so
+  // backtracking counts. 0 for no limit.
+  uint64_t maxSteps = 0;
+  // Wall time of the call, zero for no limit
+  std::chrono::microseconds timeLimit{0};
+  // Memory of the token nodes, see TokenArena::bytes. Past it matches are
+  // no longer tokenized inside, so the nodes only grow with the top-level
+  // tokens. 0 for no limit.
+  size_t maxBytes = 0;
+  // Levels of nested tokens, 1 keeps only the top-level tokens. 0 for no
+  // limit.
+  uint32_t maxDepth = 0;
+  // Name ids of token types and aliases whose matches are not tokenized
+  // inside, see SyntaxHighlighter::tokenName
+  std::vector<uint32_t> flatTokens;
+
+  bool enabled() const {
+    return maxSteps > 0 || timeLimit.count() > 0 || maxBytes > 0 ||
+           maxDepth > 0 || !flatTokens.empty();
+  }
+};
+
+// Outcome of one tokenize call with limits
+struct TokenizeStats {
+  // A step or time limit was hit, the rest of the text stayed plain text
+  bool limited = false;
+  // The memory limit was hit, later matches were not tokenized inside
+  bool shallow = false;
+  // Memory of the token nodes, see TokenArena::bytes
+  size_t bytes = 0;
+};
+
+// Remaining budget of one tokenize call. The regex engines run over
+// MatchBudget::Iterator, which counts their steps and throws Exceeded from
+// inside the engine once the budget is spent; Regex catches it and reports
+// no match. SyntaxHighlighter checks the memory limit before it tokenizes a
+// match inside.
+class MatchBudget {
+public:
+  struct Exceeded {};
+
+  explicit MatchBudget(const TokenizeLimits &limits)
+      : m_maxSteps(limits.maxSteps > 0 ? limits.maxSteps : UINT64_MAX),
+        m_maxBytes(limits.maxBytes > 0 ? limits.maxBytes : SIZE_MAX),
+        m_maxDepth(limits.maxDepth > 0 ? limits.maxDepth : UINT32_MAX),
+        m_flatTokens(limits.flatTokens),
+        m_timed(limits.timeLimit.count() > 0),
+        m_deadline(std::chrono::steady_clock::now() + limits.timeLimit) {
+    // A copy, limits may be a temporary
+    std::sort(m_flatTokens.begin(), m_flatTokens.end());
+    m_nextCheck = nextCheck();
+  }
+
+  // Whether the regex searches count steps, only memory may be bounded
+  bool counting() const { return m_maxSteps != UINT64_MAX || m_timed; }
+
+  // Whether a step or time limit was hit, no search of the call runs after
+  // that
+  bool exhausted() const { return m_exhausted; }
+
+  // Whether a match of a token type and alias may be tokenized inside at the
+  // current depth, with bytes of nodes in use. Past the memory limit no
+  // match is, for the rest of the call.
+  bool allowInside(size_t bytes, uint32_t type, uint32_t alias) {
+    if (m_depth + 1 >= m_maxDepth || isFlat(type) || isFlat(alias)) {
+      return false;
+    }
+    if (bytes >= m_maxBytes) {
+      m_shallow = true;
+    }
+    return !m_shallow;
+  }
+
+  // Around the tokenization of a match inside, see allowInside
+  void enter() { ++m_depth; }
+  void leave() { --m_depth; }
+
+  bool shallow() const { return m_shallow; }
+
+  void exhaust() { m_exhausted = true; }
+
+  uint64_t steps() const { return m_steps; }
+
+  void step() {
+    if (++m_steps >= m_nextCheck) {
+      check();
+    }
+  }
+
+  // Text iterator that spends a step on every move
+  class Iterator {
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = char;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const char *;
+    using reference = const char &;
+
+    Iterator() = default;
+    Iterator(const char *ptr, MatchBudget *budget)
+        : m_ptr(ptr), m_budget(budget) {}
+
+    reference operator*() const { return *m_ptr; }
+    reference operator[](difference_type n) const { return m_ptr[n]; }
+    pointer operator->() const { return m_ptr; }
+
+    Iterator &operator++() {
+      ++m_ptr;
+      m_budget->step();
+      return *this;
+    }
+    Iterator operator++(int) {
+      Iterator it = *this;
+      ++*this;
+      return it;
+    }
+    Iterator &operator--() {
+      --m_ptr;
+      m_budget->step();
+      return *this;
+    }
+    Iterator operator--(int) {
+      Iterator it = *this;
+      --*this;
+      return it;
+    }
+
+    // Jumps are a single step, the engines use them to skip known lengths
+    Iterator &operator+=(difference_type n) {
+      m_ptr += n;
+      m_budget->step();
+      return *this;
+    }
+    Iterator &operator-=(difference_type n) { return *this += -n; }
+    friend Iterator operator+(Iterator it, difference_type n) {
+      return it += n;
+    }
+    friend Iterator operator+(difference_type n, Iterator it) {
+      return it += n;
+    }
+    friend Iterator operator-(Iterator it, difference_type n) {
+      return it -= n;
+    }
+    friend difference_type operator-(const Iterator &a, const Iterator &b) {
+      return a.m_ptr - b.m_ptr;
+    }
+
+    friend bool operator==(const Iterator &a, const Iterator &b) {
+      return a.m_ptr == b.m_ptr;
+    }
+    friend bool operator!=(const Iterator &a, const Iterator &b) {
+      return a.m_ptr != b.m_ptr;
+    }
+    friend bool operator<(const Iterator &a, const Iterator &b) {
+      return a.m_ptr < b.m_ptr;
+    }
+    friend bool operator>(const Iterator &a, const Iterator &b) {
+      return a.m_ptr > b.m_ptr;
+    }
+    friend bool operator<=(const Iterator &a, const Iterator &b) {
+      return a.m_ptr <= b.m_ptr;
+    }
+    friend bool operator>=(const Iterator &a, const Iterator &b) {
+      return a.m_ptr >= b.m_ptr;
+    }
+
+  private:
+    const char *m_ptr = nullptr;
+    MatchBudget *m_budget = nullptr;
+  };
+
+private:
+  // The clock is read every kClockInterval steps
+  static constexpr uint64_t kClockInterval = 4096;
+
+  void check() {
+    if (m_steps >= m_maxSteps ||
+        (m_timed && std::chrono::steady_clock::now() >= m_deadline)) {
+      m_exhausted = true;
+      throw Exceeded{};
+    }
+    m_nextCheck = nextCheck();
+  }
+
+  bool isFlat(uint32_t id) const {
+    return std::binary_search(m_flatTokens.begin(), m_flatTokens.end(), id);
+  }
+
+  uint64_t nextCheck() const {
+    if (!m_timed) {
+      return m_maxSteps;
+    }
+    return m_maxSteps - m_steps > kClockInterval ? m_steps + kClockInterval
+                                                 : m_maxSteps;
+  }
+
+  uint64_t m_steps = 0;
+  uint64_t m_nextCheck = 0;
+  uint64_t m_maxSteps;
+  size_t m_maxBytes;
+  uint32_t m_maxDepth;
+  uint32_t m_depth = 0;
+  std::vector<uint32_t> m_flatTokens;
+  bool m_timed;
+  bool m_exhausted = false;
+  bool m_shallow = false;
+  std::chrono::steady_clock::time_point m_deadline;
+};
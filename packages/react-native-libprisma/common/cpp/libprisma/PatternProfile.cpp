@@ -0,0 +1,65 @@
+#include "PatternProfile.h"
+
+#include <algorithm>
+
+void PatternStats::add(const PatternStats &other)
+{
+    calls += other.calls;
+    matches += other.matches;
+    misses += other.misses;
+    rematches += other.rematches;
+    time += other.time;
+}
+
+PatternStats& PatternProfile::Call::stats(const Pattern* pattern, std::string_view source, uint32_t token, uint32_t index)
+{
+    auto [it, inserted] = m_stats.try_emplace(pattern);
+    if (inserted)
+    {
+        it->second.token = token;
+        it->second.index = index;
+        it->second.source = source;
+    }
+    return it->second;
+}
+
+void PatternProfile::add(const Call& call, const std::string& language)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& [pattern, stats] : call.m_stats)
+    {
+        auto [it, inserted] = m_stats.try_emplace({ language, pattern }, stats);
+        if (inserted)
+        {
+            it->second.language = language;
+        }
+        else
+        {
+            it->second.add(stats);
+        }
+    }
+}
+
+std::vector<PatternStats> PatternProfile::entries() const
+{
+    std::vector<PatternStats> entries;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        entries.reserve(m_stats.size());
+        for (const auto& [key, stats] : m_stats)
+        {
+            entries.push_back(stats);
+        }
+    }
+
+    std::stable_sort(entries.begin(), entries.end(), [](const PatternStats& a, const PatternStats& b) {
+        return a.time > b.time;
+    });
+    return entries;
+}
+
+void PatternProfile::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.clear();
+}
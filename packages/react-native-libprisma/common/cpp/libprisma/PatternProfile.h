@@ -0,0 +1,69 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class Pattern;
+
+// Counters of one pattern of a grammar token
+struct PatternStats {
+  // Language of the tokenize calls, inside grammars count for the language
+  // that embeds them
+  std::string language;
+  // Name id of the grammar token and index of the pattern in it
+  uint32_t token = 0;
+  uint32_t index = 0;
+  std::string_view source;
+
+  // Regex searches, and how many of them found a match
+  uint64_t calls = 0;
+  uint64_t matches = 0;
+  uint64_t misses = 0;
+  // Rematch passes started because a greedy match consumed tokens
+  uint64_t rematches = 0;
+  // Time spent in the regex searches
+  std::chrono::nanoseconds time{0};
+
+  void record(bool success, std::chrono::nanoseconds elapsed) {
+    ++calls;
+    ++(success ? matches : misses);
+    time += elapsed;
+  }
+
+  void add(const PatternStats &other);
+};
+
+// Per-pattern counters of the tokenize calls of a SyntaxHighlighter, see
+// SyntaxHighlighter::setProfiling. Every call counts into its own Call
+// without locking, which is added to the profile when the call is done.
+class PatternProfile {
+public:
+  class Call {
+  public:
+    // Counters of pattern, created on first use
+    PatternStats &stats(const Pattern *pattern, std::string_view source,
+                        uint32_t token, uint32_t index);
+
+  private:
+    friend class PatternProfile;
+    std::unordered_map<const Pattern *, PatternStats> m_stats;
+  };
+
+  void add(const Call &call, const std::string &language);
+
+  // All counters, the most expensive patterns first
+  std::vector<PatternStats> entries() const;
+
+  void clear();
+
+private:
+  mutable std::mutex m_mutex;
+  std::map<std::pair<std::string, const Pattern *>, PatternStats> m_stats;
+};
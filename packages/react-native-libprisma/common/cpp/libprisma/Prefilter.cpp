@@ -0,0 +1,615 @@
+#include "Prefilter.h"
+
+namespace
+{
+
+using ByteSet = std::array<bool, 256>;
+
+struct Analysis
+{
+    // Bytes the matched text can start with
+    ByteSet first{};
+    // Can match the empty string
+    bool nullable = true;
+};
+
+void addRange(ByteSet& set, unsigned char from, unsigned char to)
+{
+    for (unsigned int c = from; c <= to; ++c)
+    {
+        set[c] = true;
+    }
+}
+
+void addAll(ByteSet& set, const ByteSet& other)
+{
+    for (size_t c = 0; c < set.size(); ++c)
+    {
+        set[c] = set[c] || other[c];
+    }
+}
+
+void complement(ByteSet& set)
+{
+    for (auto& c : set)
+    {
+        c = !c;
+    }
+}
+
+int hexValue(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+// Recursive descent over the ECMAScript syntax of Prism patterns.
+// Sets m_unknown on anything the analysis cannot vouch for.
+class Parser
+{
+public:
+    explicit Parser(std::string_view source)
+        : m_source(source)
+    {
+
+    }
+
+    Analysis parse()
+    {
+        Analysis analysis = alternation();
+        if (m_pos != m_source.size())
+        {
+            m_unknown = true;
+        }
+        if (m_topLevelAlternation)
+        {
+            m_required.clear();
+        }
+        return analysis;
+    }
+
+    bool unknown() const { return m_unknown; }
+
+    bool lookbehind() const { return m_lookbehind; }
+
+    // Longest literal run of the top-level sequence
+    const std::string& required() const { return m_required; }
+
+private:
+    bool atEnd() const { return m_pos >= m_source.size(); }
+
+    char peek() const { return m_source[m_pos]; }
+
+    Analysis alternation()
+    {
+        Analysis result = sequence();
+        while (!atEnd() && peek() == '|')
+        {
+            if (m_depth == 0)
+            {
+                m_topLevelAlternation = true;
+            }
+            ++m_pos;
+            Analysis next = sequence();
+            addAll(result.first, next.first);
+            result.nullable = result.nullable || next.nullable;
+        }
+        return result;
+    }
+
+    Analysis sequence()
+    {
+        Analysis result;
+        std::string run;
+
+        while (!atEnd() && peek() != '|' && peek() != ')')
+        {
+            int literal = -1;
+            Analysis atom = this->atom(literal);
+
+            size_t min = 1;
+            bool exactlyOnce = true;
+            quantifier(min, exactlyOnce);
+            if (min == 0)
+            {
+                atom.nullable = true;
+            }
+
+            if (result.nullable)
+            {
+                addAll(result.first, atom.first);
+                result.nullable = atom.nullable;
+            }
+
+            if (m_depth == 0)
+            {
+                if (literal >= 0 && min > 0)
+                {
+                    run += static_cast<char>(literal);
+                }
+                if (literal < 0 || !exactlyOnce)
+                {
+                    keepRun(run);
+                }
+            }
+        }
+
+        if (m_depth == 0)
+        {
+            keepRun(run);
+        }
+        return result;
+    }
+
+    void keepRun(std::string& run)
+    {
+        if (run.size() > m_required.size())
+        {
+            m_required = run;
+        }
+        run.clear();
+    }
+
+    // Parses an optional quantifier and its lazy marker
+    void quantifier(size_t& min, bool& exactlyOnce)
+    {
+        if (atEnd())
+        {
+            return;
+        }
+
+        const char c = peek();
+        if (c == '*' || c == '?')
+        {
+            min = 0;
+        }
+        else if (c == '+')
+        {
+            min = 1;
+        }
+        else if (c == '{')
+        {
+            // {n}, {n,} or {n,m}, otherwise a literal brace
+            size_t pos = m_pos + 1;
+            size_t count = 0;
+            size_t digits = 0;
+            while (pos < m_source.size() && m_source[pos] >= '0' && m_source[pos] <= '9')
+            {
+                count = count * 10 + (m_source[pos++] - '0');
+                ++digits;
+            }
+            if (digits == 0)
+            {
+                return;
+            }
+            if (pos < m_source.size() && m_source[pos] == ',')
+            {
+                ++pos;
+                while (pos < m_source.size() && m_source[pos] >= '0' && m_source[pos] <= '9')
+                {
+                    ++pos;
+                }
+            }
+            if (pos >= m_source.size() || m_source[pos] != '}')
+            {
+                return;
+            }
+            m_pos = pos;
+            min = count;
+        }
+        else
+        {
+            return;
+        }
+
+        exactlyOnce = false;
+        ++m_pos;
+        if (!atEnd() && peek() == '?')
+        {
+            ++m_pos;
+        }
+    }
+
+    Analysis atom(int& literal)
+    {
+        Analysis result;
+        result.nullable = false;
+
+        const char c = m_source[m_pos++];
+        switch (c)
+        {
+        case '(':
+            return group();
+        case '[':
+            characterClass(result.first);
+            return result;
+        case '.':
+            addRange(result.first, 0, 255);
+            result.first['\n'] = false;
+            return result;
+        case '^':
+        case '$':
+            // Zero-width
+            result.nullable = true;
+            return result;
+        case '*':
+        case '+':
+        case '?':
+            m_unknown = true;
+            return result;
+        case '\\':
+            return escape(literal);
+        default:
+            literal = static_cast<unsigned char>(c);
+            addByte(result.first, literal);
+            return result;
+        }
+    }
+
+    Analysis group()
+    {
+        bool assertion = false;
+        if (m_source.substr(m_pos, 2) == "?:")
+        {
+            m_pos += 2;
+        }
+        else if (m_source.substr(m_pos, 2) == "?=" || m_source.substr(m_pos, 2) == "?!")
+        {
+            m_pos += 2;
+            assertion = true;
+        }
+        else if (m_source.substr(m_pos, 3) == "?<=" || m_source.substr(m_pos, 3) == "?<!")
+        {
+            m_pos += 3;
+            assertion = true;
+            m_lookbehind = true;
+        }
+        else if (m_source.substr(m_pos, 2) == "?<")
+        {
+            // Named group
+            const size_t close = m_source.find('>', m_pos);
+            if (close == std::string_view::npos)
+            {
+                m_unknown = true;
+                return Analysis();
+            }
+            m_pos = close + 1;
+        }
+        else if (!atEnd() && peek() == '?')
+        {
+            m_unknown = true;
+            return Analysis();
+        }
+
+        ++m_depth;
+        Analysis inner = alternation();
+        --m_depth;
+
+        if (atEnd() || peek() != ')')
+        {
+            m_unknown = true;
+            return Analysis();
+        }
+        ++m_pos;
+
+        if (assertion)
+        {
+            // Lookarounds consume nothing, the following atoms start the match
+            return Analysis();
+        }
+        return inner;
+    }
+
+    Analysis escape(int& literal)
+    {
+        Analysis result;
+        result.nullable = false;
+
+        if (atEnd())
+        {
+            m_unknown = true;
+            return result;
+        }
+
+        const char c = m_source[m_pos++];
+        if (c == 'b' || c == 'B')
+        {
+            result.nullable = true;
+            return result;
+        }
+        if (classEscape(c, result.first))
+        {
+            return result;
+        }
+        if ((c >= '1' && c <= '9') || c == 'k' || c == 'p' || c == 'P')
+        {
+            // Backreferences and unicode properties
+            m_unknown = true;
+            return result;
+        }
+
+        const int byte = characterEscape(c);
+        if (byte >= 0)
+        {
+            literal = byte < 0x80 ? byte : -1;
+            addByte(result.first, byte);
+        }
+        return result;
+    }
+
+    // \d, \w, \s and their complements
+    bool classEscape(char c, ByteSet& set)
+    {
+        ByteSet bytes{};
+        switch (c)
+        {
+        case 'd':
+        case 'D':
+            addRange(bytes, '0', '9');
+            break;
+        case 'w':
+        case 'W':
+            addRange(bytes, '0', '9');
+            addRange(bytes, 'A', 'Z');
+            addRange(bytes, 'a', 'z');
+            bytes['_'] = true;
+            break;
+        case 's':
+        case 'S':
+            addRange(bytes, '\t', '\r');
+            bytes[' '] = true;
+            break;
+        default:
+            return false;
+        }
+
+        if (c == 'D' || c == 'W' || c == 'S')
+        {
+            complement(bytes);
+        }
+        // Locale dependent beyond ASCII
+        addRange(bytes, 0x80, 0xFF);
+        addAll(set, bytes);
+        return true;
+    }
+
+    // Byte of a single character escape, -1 if it is not a single byte, in
+    // which case any byte from 0x80 up is added to the first set
+    int characterEscape(char c)
+    {
+        switch (c)
+        {
+        case 'n':
+            return '\n';
+        case 'r':
+            return '\r';
+        case 't':
+            return '\t';
+        case 'f':
+            return '\f';
+        case 'v':
+            return '\v';
+        case '0':
+            return '\0';
+        case 'c':
+            if (!atEnd())
+            {
+                return m_source[m_pos++] % 32;
+            }
+            m_unknown = true;
+            return -1;
+        case 'x':
+        case 'u':
+        {
+            const size_t digits = c == 'x' ? 2 : 4;
+            int value = 0;
+            for (size_t i = 0; i < digits; ++i)
+            {
+                const int digit = m_pos + i < m_source.size() ? hexValue(m_source[m_pos + i]) : -1;
+                if (digit < 0)
+                {
+                    m_unknown = true;
+                    return -1;
+                }
+                value = value * 16 + digit;
+            }
+            m_pos += digits;
+            return value;
+        }
+        default:
+            return static_cast<unsigned char>(c);
+        }
+    }
+
+    void characterClass(ByteSet& set)
+    {
+        ByteSet bytes{};
+        bool negate = false;
+        if (!atEnd() && peek() == '^')
+        {
+            negate = true;
+            ++m_pos;
+        }
+
+        bool empty = true;
+        while (!atEnd() && peek() != ']')
+        {
+            empty = false;
+            int from = classCharacter(bytes);
+            if (from < 0)
+            {
+                continue;
+            }
+
+            if (m_pos + 1 < m_source.size() && peek() == '-' && m_source[m_pos + 1] != ']')
+            {
+                ++m_pos;
+                int to = classCharacter(bytes);
+                if (to < from)
+                {
+                    // Class escape as range end, or a reversed range
+                    m_unknown = true;
+                    return;
+                }
+                if (to >= 0x80)
+                {
+                    addRange(bytes, 0x80, 0xFF);
+                    to = 0x7F;
+                }
+                if (from <= to)
+                {
+                    addRange(bytes, from, to);
+                }
+            }
+            else
+            {
+                addByte(bytes, from);
+            }
+        }
+
+        if (atEnd() || empty)
+        {
+            m_unknown = true;
+            return;
+        }
+        ++m_pos;
+
+        if (negate)
+        {
+            complement(bytes);
+        }
+        // Members beyond ASCII are kept as the whole high range, which the
+        // complement must not take out: [^\w] matches an é as well
+        addRange(bytes, 0x80, 0xFF);
+        addAll(set, bytes);
+    }
+
+    // One class member: returns its character, or -1 for a class escape,
+    // which is added to set
+    int classCharacter(ByteSet& set)
+    {
+        const char c = m_source[m_pos++];
+        if (c != '\\')
+        {
+            return static_cast<unsigned char>(c);
+        }
+        if (atEnd())
+        {
+            m_unknown = true;
+            return -1;
+        }
+
+        const char escaped = m_source[m_pos++];
+        if (escaped == 'b')
+        {
+            return '\b';
+        }
+        if (classEscape(escaped, set))
+        {
+            return -1;
+        }
+        if (escaped == 'p' || escaped == 'P')
+        {
+            m_unknown = true;
+            return -1;
+        }
+        return characterEscape(escaped);
+    }
+
+    // Multi-byte characters are compared byte by byte by the engine, their
+    // bytes are all kept from 0x80 up
+    void addByte(ByteSet& set, int c)
+    {
+        if (c >= 0x80)
+        {
+            addRange(set, 0x80, 0xFF);
+        }
+        else if (c >= 0)
+        {
+            set[c] = true;
+        }
+    }
+
+    std::string_view m_source;
+    size_t m_pos = 0;
+    size_t m_depth = 0;
+    bool m_unknown = false;
+    bool m_lookbehind = false;
+    bool m_topLevelAlternation = false;
+    std::string m_required;
+};
+
+bool hasLetters(const std::string& text)
+{
+    for (char c : text)
+    {
+        if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+}
+
+Prefilter::Prefilter(std::string_view pattern, bool ignoreCase)
+{
+    Parser parser(pattern);
+    Analysis analysis = parser.parse();
+    m_local = !parser.unknown() && !parser.lookbehind();
+    if (parser.unknown() || analysis.nullable)
+    {
+        return;
+    }
+
+    if (ignoreCase)
+    {
+        for (int c = 'a'; c <= 'z'; ++c)
+        {
+            const int upper = c - 'a' + 'A';
+            analysis.first[c] = analysis.first[upper] = analysis.first[c] || analysis.first[upper];
+        }
+    }
+
+    // Literals in the pattern are above 0x7F only as part of multi-byte
+    // characters, which addByte widened
+    const std::string& required = parser.required();
+    bool asciiRequired = true;
+    for (char c : required)
+    {
+        asciiRequired = asciiRequired && static_cast<unsigned char>(c) < 0x80;
+    }
+    if (asciiRequired && !(ignoreCase && hasLetters(required)))
+    {
+        m_required = required;
+    }
+
+    size_t count = 0;
+    for (size_t c = 0; c < analysis.first.size(); ++c)
+    {
+        if (analysis.first[c])
+        {
+            m_single = static_cast<int>(c);
+            ++count;
+        }
+    }
+
+    if (count == analysis.first.size())
+    {
+        m_single = -1;
+        return;
+    }
+
+    m_first = analysis.first;
+    m_anyStart = false;
+    if (count != 1)
+    {
+        m_single = -1;
+    }
+}
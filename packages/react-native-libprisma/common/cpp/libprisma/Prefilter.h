@@ -0,0 +1,69 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+// Cheap test of where a regex can match, computed from its source.
+// A Prism pattern often can only start with a few bytes (a quote, a slash,
+// a digit) or must contain some literal text (e.g. "/*"). Searching for
+// those first rejects most Text nodes without running the regex engine, and
+// lets the engine start at the first byte that can begin a match.
+//
+// The analysis is conservative: anything it does not understand (unicode
+// properties, backreferences, patterns that can match the empty string)
+// lets every position through.
+class Prefilter {
+public:
+  Prefilter(std::string_view pattern, bool ignoreCase);
+
+  // First position in [begin, end) where a match can start, nullptr if the
+  // range cannot contain a match
+  const char *find(const char *begin, const char *end) const {
+    if (!m_required.empty() &&
+        std::string_view(begin, end - begin).find(m_required) ==
+            std::string_view::npos) {
+      return nullptr;
+    }
+
+    if (m_anyStart) {
+      return begin;
+    }
+    if (m_single >= 0) {
+      return static_cast<const char *>(
+          memchr(begin, m_single, static_cast<size_t>(end - begin)));
+    }
+    for (const char *it = begin; it != end; ++it) {
+      if (m_first[static_cast<unsigned char>(*it)]) {
+        return it;
+      }
+    }
+    return nullptr;
+  }
+
+  // Whether a match can start at begin, checking only its first byte
+  bool canStartAt(const char *begin, const char *end) const {
+    return m_anyStart ||
+           (begin != end && m_first[static_cast<unsigned char>(*begin)]);
+  }
+
+  // Whether find can skip or reject anything
+  bool active() const { return !m_anyStart || !m_required.empty(); }
+
+  // Whether a match attempt at a position looks back at most at the byte
+  // before it (no lookbehind assertions). Searches of such a regex from
+  // different range starts then only differ in the attempt at the start.
+  bool local() const { return m_local; }
+
+private:
+  // Bytes a match can start with, all of them if m_anyStart
+  std::array<bool, 256> m_first{};
+  bool m_anyStart = true;
+  // The only byte in m_first, -1 if there are more
+  int m_single = -1;
+  // Literal text every match contains, empty if none is known
+  std::string m_required;
+  bool m_local = false;
+};
@@ -0,0 +1,235 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "LiteralSet.h"
+#include "MatchBudget.h"
+#include "Prefilter.h"
+
+// The regex engine behind Pattern is selected at build time:
+//   LIBPRISMA_REGEX_BOOST - boost::regex (Perl/ECMAScript engine, fast and
+//                           non-recursive, same as upstream libprisma)
+//   otherwise             - std::regex, no extra dependency
+#if defined(LIBPRISMA_REGEX_BOOST)
+#include <boost/regex.hpp>
+#else
+#include <regex>
+#endif
+
+namespace RegexFlags {
+enum : uint8_t {
+  None = 0,
+  IgnoreCase = 1 << 0,
+  // Prism "m" flag: ^ and $ also match at line breaks
+  Multiline = 1 << 1,
+  // No prefilter or literal set, every search runs the engine from its start
+  Plain = 1 << 2,
+};
+}
+
+struct RegexMatch {
+  // Offset of the match from the start of the searched range
+  size_t position = 0;
+  size_t length = 0;
+  // Prism lookbehind patterns capture the lookbehind text in group 1
+  bool group1Matched = false;
+  size_t group1Length = 0;
+};
+
+class Regex {
+public:
+#if defined(LIBPRISMA_REGEX_BOOST)
+  static constexpr const char *backend = "boost";
+#else
+  static constexpr const char *backend = "std";
+#endif
+
+  Regex(std::string_view pattern, uint8_t flags)
+      : m_prefilter(flags & RegexFlags::Plain ? std::string_view() : pattern,
+                    flags & RegexFlags::IgnoreCase),
+        m_literals(flags & RegexFlags::Plain
+                       ? std::nullopt
+                       : LiteralSet::parse(pattern,
+                                           flags & RegexFlags::IgnoreCase,
+                                           wordBytes())),
+        m_plain(flags & RegexFlags::Plain) {
+    if (m_literals) {
+      return;
+    }
+
+    try {
+      m_regex = Engine(std::string{pattern}, syntaxFlags(flags));
+    } catch (const std::exception &e) {
+      // Log error and fallback to a regex that never matches
+      printf("Libprisma Regex Error: %s | Pattern: %s\n", e.what(),
+             std::string(pattern).c_str());
+      m_regex = Engine("$^", syntaxFlags(RegexFlags::None));
+      m_prefilter = Prefilter("$^", false);
+    }
+  }
+
+  // Match starting exactly at begin. With a budget the engine spends its
+  // steps, and finds no match once it is exhausted.
+  bool matchAt(const char *begin, const char *end, RegexMatch &match,
+               MatchBudget *budget = nullptr) const {
+    if (!m_prefilter.canStartAt(begin, end)) {
+      return false;
+    }
+
+    if (m_literals) {
+      return m_literals->search(begin, begin, end, true, match.position,
+                                match.length);
+    }
+
+    if (budget && budget->counting()) {
+      return runWithin(*budget, begin, begin, end, true, match);
+    }
+    return run(begin, begin, end, true, match);
+  }
+
+  // See Prefilter::local
+  bool local() const { return m_prefilter.local(); }
+
+  // Built with RegexFlags::Plain
+  bool plain() const { return m_plain; }
+
+  bool search(const char *begin, const char *end, RegexMatch &match,
+              MatchBudget *budget = nullptr) const {
+    // No match can start before start. Anchors, \b and lookbehinds still see
+    // the text from begin.
+    const char *start = m_prefilter.find(begin, end);
+    if (!start) {
+      return false;
+    }
+
+    if (m_literals) {
+      return m_literals->search(begin, start, end, false, match.position,
+                                match.length);
+    }
+
+    if (budget && budget->counting()) {
+      return runWithin(*budget, begin, start, end, false, match);
+    }
+    return run(begin, start, end, false, match);
+  }
+
+private:
+#if defined(LIBPRISMA_REGEX_BOOST)
+  using Engine = boost::regex;
+  using Match = boost::cmatch;
+
+  static boost::regex_constants::syntax_option_type syntaxFlags(uint8_t flags) {
+    auto syntax = boost::regex_constants::ECMAScript |
+                  boost::regex_constants::optimize;
+    if (flags & RegexFlags::IgnoreCase) {
+      syntax |= boost::regex_constants::icase;
+    }
+    if (!(flags & RegexFlags::Multiline)) {
+      syntax |= boost::regex_constants::no_mod_m;
+    }
+    return syntax;
+  }
+#else
+  using Engine = std::regex;
+  using Match = std::cmatch;
+
+  static std::regex_constants::syntax_option_type syntaxFlags(uint8_t flags) {
+    auto syntax =
+        std::regex_constants::ECMAScript | std::regex_constants::optimize;
+    if (flags & RegexFlags::IgnoreCase) {
+      syntax |= std::regex_constants::icase;
+    }
+    // Note: the "m" flag is ignored, std::regex keeps its default anchors
+    return syntax;
+  }
+#endif
+
+  // Engine search from start, continuous to only match at start. begin is
+  // the start of the text, match positions are relative to it.
+  template <typename It>
+  bool run(It begin, It start, It end, bool continuous,
+           RegexMatch &match) const {
+#if defined(LIBPRISMA_REGEX_BOOST)
+    boost::match_results<It> m;
+    auto flags = boost::regex_constants::match_not_dot_newline;
+    if (continuous) {
+      flags |= boost::regex_constants::match_continuous;
+    }
+    if (!boost::regex_search(start, end, m, m_regex, flags, begin)) {
+      return false;
+    }
+#else
+    std::match_results<It> m;
+    const auto flags = continuous ? std::regex_constants::match_continuous
+                       : start == begin
+                           ? std::regex_constants::match_default
+                           : std::regex_constants::match_prev_avail;
+    if (!std::regex_search(start, end, m, m_regex, flags)) {
+      return false;
+    }
+#endif
+
+    store(m, begin, match);
+    return true;
+  }
+
+  bool runWithin(MatchBudget &budget, const char *begin, const char *start,
+                 const char *end, bool continuous, RegexMatch &match) const {
+    if (budget.exhausted()) {
+      return false;
+    }
+
+    using It = MatchBudget::Iterator;
+    try {
+      return run(It(begin, &budget), It(start, &budget), It(end, &budget),
+                 continuous, match);
+    } catch (const MatchBudget::Exceeded &) {
+      return false;
+    } catch (const std::runtime_error &) {
+      // The engine gave up on its own complexity or stack limit, which is
+      // the same kind of runaway search
+      budget.exhaust();
+      return false;
+    }
+  }
+
+  template <typename M, typename It>
+  static void store(const M &m, It begin, RegexMatch &match) {
+    match.position = m[0].first - begin;
+    match.length = m[0].length();
+    match.group1Matched = m.size() > 1 && m[1].matched;
+    match.group1Length = match.group1Matched ? m[1].length() : 0;
+  }
+
+  // Bytes the engine counts as word characters for \b, read once from the
+  // engine itself so LiteralSet agrees with it
+  static const std::array<bool, 256> &wordBytes() {
+    static const std::array<bool, 256> bytes = [] {
+      std::array<bool, 256> result{};
+      const Engine word("\\w", syntaxFlags(RegexFlags::None));
+      for (int c = 0; c < 256; ++c) {
+        const char byte = static_cast<char>(c);
+        Match m;
+#if defined(LIBPRISMA_REGEX_BOOST)
+        result[c] = boost::regex_match(&byte, &byte + 1, m, word);
+#else
+        result[c] = std::regex_match(&byte, &byte + 1, m, word);
+#endif
+      }
+      return result;
+    }();
+    return bytes;
+  }
+
+  Engine m_regex;
+  Prefilter m_prefilter;
+  // Replaces the engine for alternations of literals
+  std::optional<LiteralSet> m_literals;
+  bool m_plain;
+};
@@ -1,22 +1,283 @@
 #include "SyntaxHighlighter.h"
 #include "LanguageTree.h"
 #include "TokenList.h"
+#include <algorithm>
+#include <chrono>
+#include <optional>
 
-SyntaxHighlighter::SyntaxHighlighter(const std::string& path)
+namespace
+{
+    bool isBlank(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    // Least text past the limit of a chunk that its patterns see, see SyntaxHighlighter::tokenizeParallel
+    constexpr size_t kChunkMargin = 4 * 1024;
+
+    // Characters that start a top-level declaration, comment or tag, not the continuation of an expression
+    bool startsDeclaration(char c)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == '$' || c == '@' || c == '#' || c == '<' || c == '/';
+    }
+
+    // Starts of the chunks of text, the first one is 0. The chunk k starts at the first split point at or after
+    // k / chunks of the text, if there is one within another half chunk.
+    std::vector<size_t> splitPoints(std::string_view text, size_t chunks)
+    {
+        std::vector<size_t> starts{ 0 };
+        const size_t stride = text.size() / chunks;
+        for (size_t k = 1; k < chunks; ++k)
+        {
+            const size_t to = std::min(text.size(), k * stride + stride / 2);
+            for (size_t pos = text.find('\n', std::max(k * stride, starts.back() + 1)); pos < to; pos = text.find('\n', pos + 1))
+            {
+                // a line break, a blank line and a line with a declaration
+                size_t start = pos + 1;
+                while (start < text.size() && isBlank(text[start]))
+                {
+                    ++start;
+                }
+                if (start + 1 < text.size() && text[start] == '\n' && startsDeclaration(text[start + 1]))
+                {
+                    starts.push_back(start + 1);
+                    break;
+                }
+            }
+        }
+        return starts;
+    }
+
+    // Last top-level node in tokenList, which covers text up to end, that starts at or before offset, the head if
+    // offset is end. pos is set to its start.
+    TokenListPtr nodeBefore(const TokenList& tokenList, size_t end, size_t offset, size_t& pos)
+    {
+        TokenListPtr node = tokenList.head;
+        pos = end;
+        while (pos > offset && node->prev != tokenList.head)
+        {
+            node = node->prev;
+            pos -= node->length();
+        }
+        return node;
+    }
+
+    // First top-level node at offset in tokenList, which covers text up to end, the head if offset is end,
+    // nullptr if a node spans offset
+    TokenListPtr nodeAt(const TokenList& tokenList, size_t end, size_t offset)
+    {
+        size_t pos;
+        TokenListPtr node = nodeBefore(tokenList, end, offset, pos);
+        return pos == offset ? node : nullptr;
+    }
+
+    bool sameTokens(const TokenListNode& a, const TokenListNode& b)
+    {
+        if (a.kind() != b.kind() || a.length() != b.length())
+        {
+            return false;
+        }
+        if (a.kind() != TokenListNode::Kind::Syntax)
+        {
+            return true;
+        }
+
+        const auto& syntaxA = static_cast<const Syntax&>(a);
+        const auto& syntaxB = static_cast<const Syntax&>(b);
+        if (syntaxA.type() != syntaxB.type() || syntaxA.alias() != syntaxB.alias())
+        {
+            return false;
+        }
+
+        auto childB = syntaxB.begin();
+        for (const auto& childA : syntaxA)
+        {
+            if (childB == syntaxB.end() || !sameTokens(childA, *childB))
+            {
+                return false;
+            }
+            ++childB;
+        }
+        return childB == syntaxB.end();
+    }
+
+    // Number of nodes from node up to the head
+    size_t countTo(const TokenList& tokenList, TokenListPtr node)
+    {
+        size_t count = 0;
+        for (; node != tokenList.head; node = node->next)
+        {
+            ++count;
+        }
+        return count;
+    }
+}
+
+SyntaxHighlighter::SyntaxHighlighter(std::shared_ptr<const GrammarImage> image, bool accelerate)
 {
     m_tree = std::make_shared<LanguageTree>();
-    m_tree->load(path);
+    m_tree->load(std::move(image), accelerate);
 }
 
 TokenList SyntaxHighlighter::tokenize(const std::string& text, const std::string& language)
+{
+    return tokenize(std::string_view(text), language, std::string_view::npos);
+}
+
+TokenList SyntaxHighlighter::tokenize(std::string_view text, const std::string& language, size_t limit)
+{
+    return tokenize(text, language, limit, nullptr);
+}
+
+TokenList SyntaxHighlighter::tokenize(std::string_view text, const std::string& language, const TokenizeLimits& limits, TokenizeStats& stats)
+{
+    if (!limits.enabled())
+    {
+        TokenList tokenList = tokenize(text, language, std::string_view::npos, nullptr);
+        stats = TokenizeStats();
+        stats.bytes = tokenList.arena()->bytes();
+        return tokenList;
+    }
+
+    MatchBudget budget(limits);
+    TokenList tokenList = tokenize(text, language, std::string_view::npos, &budget);
+    stats.limited = budget.exhausted();
+    stats.shallow = budget.shallow();
+    stats.bytes = tokenList.arena()->bytes();
+    return tokenList;
+}
+
+TokenList SyntaxHighlighter::tokenize(std::string_view text, const std::string& language, size_t limit, MatchBudget* budget)
 {
     const Grammar* grammar = m_tree->find(language);
-    if (grammar)
+    if (!grammar)
+    {
+        return TokenList(text);
+    }
+
+    if (!m_profiling.load(std::memory_order_relaxed))
+    {
+        return tokenize(text, grammar, nullptr, nullptr, budget, limit);
+    }
+
+    PatternProfile::Call profile;
+    TokenList tokenList = tokenize(text, grammar, nullptr, &profile, budget, limit);
+    m_profile.add(profile, language);
+    return tokenList;
+}
+
+TokenList SyntaxHighlighter::tokenizeParallel(std::string_view text, const std::string& language, size_t chunks, const ParallelFor& parallelFor)
+{
+    // while profiling the text is tokenized in one piece, so the profile counts the work of a single call
+    const bool split = chunks > 1 && !m_profiling.load(std::memory_order_relaxed) && m_tree->find(language);
+    const std::vector<size_t> starts = split ? splitPoints(text, chunks) : std::vector<size_t>{ 0 };
+    if (starts.size() < 2)
+    {
+        return tokenize(text, language, std::string_view::npos, nullptr);
+    }
+
+    // chunk i covers [starts[i], ends[i]), on to the end of the next chunk, so that its tokens can be checked against
+    // all of the next chunk's. It is tokenized with ends[i] as the limit and a window of text behind it as long again
+    // as the chunk, at least kChunkMargin, so a string or comment that goes on past ends[i] is matched as in a
+    // tokenization of the whole text unless it runs past the window too. The patterns of a chunk never search the
+    // rest of a large text.
+    std::vector<size_t> ends(starts.size(), text.size());
+    for (size_t i = 0; i + 2 < starts.size(); ++i)
+    {
+        ends[i] = starts[i + 2];
+    }
+    auto windowEnd = [&](size_t from, size_t to) {
+        return to == text.size() ? text.size() : std::min(text.size(), to + std::max(to - from, kChunkMargin));
+    };
+    auto tokenizeFrom = [&](size_t from, size_t to) {
+        return tokenize(text.substr(from, windowEnd(from, to) - from), language,
+            to == text.size() ? std::string_view::npos : to - from, nullptr);
+    };
+
+    // every chunk gets its own arena, the first one adopts the others
+    std::vector<std::optional<TokenList>> lists(starts.size());
+    parallelFor(starts.size(), [&](size_t i) {
+        lists[i].emplace(tokenizeFrom(starts[i], ends[i]));
+    });
+
+    TokenList& tokenList = *lists[0];
+    // end of the text that tokenList covers, the end of the window of its last chunk
+    size_t covered = windowEnd(starts[0], ends[0]);
+    // start of the text after each seam that matched or was tokenized again, and the last node before it
+    std::vector<std::pair<size_t, TokenListPtr>> seams;
+    for (size_t i = 1; i < starts.size(); ++i)
+    {
+        const size_t seam = starts[i];
+        TokenList& next = *lists[i];
+
+        // the tokens past the seam have to match all tokens of the next chunk. Both lists go on to the end of their
+        // windows, past their limits the text is not tokenized completely.
+        TokenListPtr node = nodeAt(tokenList, covered, seam);
+        bool matches = node != nullptr;
+        size_t pos = seam;
+        for (TokenListPtr a = node, b = next.head->next; matches && a != tokenList.head && pos < ends[i - 1]; a = a->next, b = b->next)
+        {
+            matches = b != next.head && sameTokens(*a, *b);
+            pos += a->length();
+        }
+
+        if (!matches)
+        {
+            // tokenize the two chunks at the seam again as one. A token that runs into the previous chunk from further
+            // up spans more than two chunks, the text from its start on is tokenized in one piece then, instead of
+            // again for every seam it crosses.
+            size_t from;
+            TokenListPtr first = nodeBefore(tokenList, covered, starts[i - 1], from);
+            const size_t to = from < starts[i - 1] ? text.size() : ends[i];
+            TokenList repaired = tokenizeFrom(from, to);
+            tokenList.removeRange(first->prev, countTo(tokenList, first));
+            while (!seams.empty() && seams.back().first > from)
+            {
+                seams.pop_back();
+            }
+            if (from > 0 && (seams.empty() || seams.back().first < from))
+            {
+                seams.emplace_back(from, tokenList.head->prev);
+            }
+            tokenList.append(std::move(repaired));
+            covered = windowEnd(from, to);
+            lists[i].reset();
+            if (to == text.size())
+            {
+                break;
+            }
+            continue;
+        }
+
+        tokenList.removeRange(node->prev, countTo(tokenList, node));
+        seams.emplace_back(seam, tokenList.head->prev);
+        tokenList.append(std::move(next));
+        covered = windowEnd(seam, ends[i]);
+        lists[i].reset();
+    }
+
+    // text on both sides of a seam becomes one node, as in a tokenization of the whole text. The last seam goes
+    // first, joining replaces the node after the seam, which can be the one before the next seam.
+    for (auto it = seams.rbegin(); it != seams.rend(); ++it)
     {
-        return tokenize(text, grammar);
+        const TokenListPtr last = it->second;
+        const TokenListPtr first = last->next;
+        if (last != tokenList.head && first != tokenList.head && !last->isSyntax() && !first->isSyntax())
+        {
+            const std::string_view before = static_cast<const Text&>(*last).value();
+            const std::string_view joined(before.data(), before.size() + first->length());
+            const TokenListPtr prev = last->prev;
+            tokenList.removeRange(prev, 2);
+            tokenList.addAfter(prev, joined);
+        }
     }
 
-    return TokenList(text);
+    return std::move(tokenList);
+}
+
+bool SyntaxHighlighter::preload(const std::string& language)
+{
+    return m_tree->preload(language);
 }
 
 std::map<std::string, std::string> SyntaxHighlighter::languages() const
@@ -29,30 +290,84 @@ std::string SyntaxHighlighter::languageName(const std::string& language) const
     return m_tree->languageName(language);
 }
 
-TokenList SyntaxHighlighter::tokenize(std::string_view text, const Grammar* grammar)
+const std::string& SyntaxHighlighter::tokenName(uint32_t id) const
 {
-    TokenList tokenList(text);
-    matchGrammar(text, tokenList, grammar, tokenList.head, 0, nullptr);
+    return m_tree->name(id);
+}
+
+const std::vector<std::string>& SyntaxHighlighter::tokenNames() const
+{
+    return m_tree->names();
+}
+
+void SyntaxHighlighter::setProfiling(bool enabled)
+{
+    if (enabled && !m_profiling.load())
+    {
+        m_profile.clear();
+    }
+    m_profiling.store(enabled);
+}
+
+std::vector<PatternStats> SyntaxHighlighter::profile() const
+{
+    return m_profile.entries();
+}
+
+TokenList SyntaxHighlighter::tokenize(std::string_view text, const Grammar* grammar, TokenArena* arena, PatternProfile::Call* profile, MatchBudget* budget, size_t limit)
+{
+    // nested token lists share the arena of the outermost one
+    TokenList tokenList(text, arena);
+    // greedy patterns search the whole text, their last results are reused for later searches
+    std::vector<GreedySearch> searches;
+    matchGrammar(text, tokenList, grammar, tokenList.head, 0, nullptr, limit, searches, profile, budget);
 
     return tokenList;
 }
 
-void SyntaxHighlighter::matchGrammar(std::string_view text, TokenList& tokenList, const Grammar* grammar, TokenListPtr startNode, size_t startPos, RematchOptions* rematch)
+GreedySearch& SyntaxHighlighter::lastSearch(std::vector<GreedySearch>& searches, const Pattern* pattern)
+{
+    for (auto& search : searches)
+    {
+        if (search.pattern == pattern)
+        {
+            return search;
+        }
+    }
+
+    searches.emplace_back();
+    return searches.back();
+}
+
+void SyntaxHighlighter::matchGrammar(std::string_view text, TokenList& tokenList, const Grammar* grammar, TokenListPtr startNode, size_t startPos, RematchOptions* rematch, size_t limit, std::vector<GreedySearch>& searches, PatternProfile::Call* profile, MatchBudget* budget)
 {
     for (const auto& token : grammar->tokens)
     {
-        int x = 0;
-        for (auto j = token.cbegin(); j != token.cend(); ++j)
+        for (uint32_t x = 0; x < token.count; ++x)
         {
-            if (rematch && rematch->j == x && rematch->token == token.name())
+            if (rematch && rematch->j == x && rematch->token == token.name)
             {
                 return;
             }
 
-            const auto& pattern = *j->get();
+            const auto& pattern = *m_tree->pattern(grammar->patterns[token.first + x]);
             const auto& inside = pattern.inside();
             const bool greedy = pattern.greedy();
 
+            PatternStats* stats = profile ? &profile->stats(&pattern, pattern.source(), token.name, x) : nullptr;
+            // runs a regex search of the pattern, timed when profiling
+            auto search = [stats](bool& success, auto&& run) {
+                if (!stats)
+                {
+                    return run();
+                }
+
+                const auto started = std::chrono::steady_clock::now();
+                std::string_view found = run();
+                stats->record(success, std::chrono::steady_clock::now() - started);
+                return found;
+            };
+
             size_t pos = startPos;
 
             // iterate the token list and keep track of the current token/string position
@@ -65,6 +380,18 @@ void SyntaxHighlighter::matchGrammar(std::string_view text, TokenList& tokenList
                     break;
                 }
 
+                // the first match past the limit is still kept, as it bounds the matches of the following patterns
+                if (pos >= limit)
+                {
+                    break;
+                }
+
+                // an exhausted budget leaves the rest of the text as it is
+                if (budget && budget->exhausted())
+                {
+                    return;
+                }
+
                 if (tokenList.length > text.length())
                 {
                     // Something went terribly wrong, ABORT, ABORT!
@@ -76,7 +403,7 @@ void SyntaxHighlighter::matchGrammar(std::string_view text, TokenList& tokenList
                     continue;
                 }
 
-                const auto& currentText = dynamic_cast<Text&>(*currentNode);
+                const auto& currentText = static_cast<Text&>(*currentNode);
                 std::string_view str = currentText.value();
 
                 auto removeCount = 1; // this is the to parameter of removeBetween
@@ -86,7 +413,9 @@ void SyntaxHighlighter::matchGrammar(std::string_view text, TokenList& tokenList
 
                 if (greedy)
                 {
-                    match = pattern.match(matchSuccess, matchIndex, text);
+                    match = search(matchSuccess, [&] {
+                        return pattern.match(matchSuccess, matchIndex, text, lastSearch(searches, &pattern), budget);
+                    });
                     if (!matchSuccess || matchIndex >= text.length())
                     {
                         break;
@@ -130,7 +459,9 @@ void SyntaxHighlighter::matchGrammar(std::string_view text, TokenList& tokenList
                 else
                 {
                     matchIndex = 0;
-                    match = pattern.match(matchSuccess, matchIndex, str);
+                    match = search(matchSuccess, [&] {
+                        return pattern.match(matchSuccess, matchIndex, str, budget);
+                    });
                     if (!matchSuccess)
                     {
                         continue;
@@ -158,20 +489,30 @@ void SyntaxHighlighter::matchGrammar(std::string_view text, TokenList& tokenList
                 tokenList.removeRange(removeFrom, removeCount);
 
                 TokenList tokenEntries = [&]() {
-                    if (inside)
+                    // with limits, past maxDepth or the memory limit and for flat tokens the match stays a single token
+                    if (inside && (!budget || budget->allowInside(tokenList.arena()->bytes(), token.name, pattern.alias())))
                     {
-                        return tokenize(match, inside);
+                        if (budget)
+                        {
+                            budget->enter();
+                        }
+                        TokenList nested = tokenize(match, inside, tokenList.arena(), profile, budget);
+                        if (budget)
+                        {
+                            budget->leave();
+                        }
+                        return nested;
                     }
                     else
                     {
-                        return TokenList(match);
+                        return TokenList(match, tokenList.arena());
                     }
                 }();
 
-                currentNode = tokenList.addAfter(removeFrom, token.name(),
+                currentNode = tokenList.addAfter(removeFrom, token.name,
                     std::move(tokenEntries),
                     pattern.alias(),
-                    match.size());
+                    match);
 
                 if (after.size())
                 {
@@ -183,12 +524,16 @@ void SyntaxHighlighter::matchGrammar(std::string_view text, TokenList& tokenList
                     // at least one Token object was removed, so we have to do some rematching
                     // this can only happen if the current pattern is greedy
                     RematchOptions nestedRematch = {
-                        .token = token.name(),
+                        .token = token.name,
                         .reach = reach,
                         .j = x
                     };
 
-                    matchGrammar(text, tokenList, grammar, currentNode->prev, pos, &nestedRematch);
+                    if (stats)
+                    {
+                        ++stats->rematches;
+                    }
+                    matchGrammar(text, tokenList, grammar, currentNode->prev, pos, &nestedRematch, limit, searches, profile, budget);
 
                     // the reach might have been extended because of the rematching
                     if (rematch && nestedRematch.reach > rematch->reach)
@@ -197,8 +542,6 @@ void SyntaxHighlighter::matchGrammar(std::string_view text, TokenList& tokenList
                     }
                 }
             }
-
-            ++x;
         }
     }
 }
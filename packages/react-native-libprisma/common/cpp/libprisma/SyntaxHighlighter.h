@@ -1,35 +1,90 @@
 #pragma once
 #include <sstream>
 
+#include "MatchBudget.h"
+#include "PatternProfile.h"
 #include "TokenList.h"
+#include <atomic>
+#include <functional>
 #include <vector>
 #include <map>
 #include <optional>
 
+class GrammarImage;
 class LanguageTree;
+class Pattern;
 struct Grammar;
+struct GreedySearch;
 
 struct RematchOptions
 {
-    std::string token;
+    uint32_t token;
     size_t reach;
-    int j;
+    uint32_t j;
 };
 
+// Can be shared by any number of threads, every tokenize call has its own
+// match state and token arena
 class SyntaxHighlighter
 {
 public:
-    SyntaxHighlighter(const std::string& languages);
+    // Without accelerate every search runs the regex engine: no prefilter, literal set or reuse of greedy
+    // searches. It is the reference the accelerated searches are checked against.
+    SyntaxHighlighter(std::shared_ptr<const GrammarImage> image, bool accelerate = true);
 
     TokenList tokenize(const std::string& text, const std::string& language);
 
+    // Only top-level tokens that start before limit are guaranteed to match a full tokenization,
+    // patterns stop scanning at their first match past it
+    TokenList tokenize(std::string_view text, const std::string& language, size_t limit);
+
+    // Bounds the regex work, memory and nesting of the call by limits. Once the step or time limit is
+    // exceeded no further pattern is tried: the tokens matched until then are kept and the rest of the
+    // text stays plain text. Past the memory limit matches are no longer tokenized inside, nor past
+    // maxDepth or for flatTokens. stats tells which limits were hit, and the memory of the nodes.
+    TokenList tokenize(std::string_view text, const std::string& language, const TokenizeLimits& limits, TokenizeStats& stats);
+
+    // Runs body(0) ... body(count - 1), concurrently where it can, and returns once all of them returned
+    using ParallelFor = std::function<void(size_t count, const std::function<void(size_t)>& body)>;
+
+    // Tokenizes text in up to chunks pieces, which parallelFor runs. The text is split after blank lines, before a
+    // line that starts at column 0. Each chunk is tokenized on to the end of the next chunk, whose tokens it has to
+    // match, with a window of text after that as long again, otherwise the two chunks are tokenized again as one, or
+    // the rest of the text from a token that spans more chunks. A string or comment that is still open at a seam shows up as a
+    // mismatch unless it ends the same way from the next chunk on. While profiling, the text is tokenized in one
+    // piece. There are no TokenizeLimits, a tokenization with limits is not split.
+    TokenList tokenizeParallel(std::string_view text, const std::string& language, size_t chunks, const ParallelFor& parallelFor);
+
+    // Compiles all patterns of a language ahead of its first tokenize call
+    bool preload(const std::string& language);
+
     std::map<std::string, std::string> languages() const;
 
     std::string languageName(const std::string& language) const;
 
+    // Resolves the type and alias ids of Syntax tokens
+    const std::string& tokenName(uint32_t id) const;
+
+    // All token type and alias names, indexed by id
+    const std::vector<std::string>& tokenNames() const;
+
+    // Counts calls, matches and regex time of every pattern in the tokenize calls
+    // that follow, off by default. Enabling it again starts a new profile.
+    void setProfiling(bool enabled);
+
+    // Counters of the patterns run since profiling was enabled, the most expensive first
+    std::vector<PatternStats> profile() const;
+
 private:
-    TokenList tokenize(std::string_view text, const Grammar* grammar);
-    void matchGrammar(std::string_view text, TokenList& tokenList, const Grammar* grammar, TokenListPtr startNode, size_t startPos, RematchOptions* rematch);
+    TokenList tokenize(std::string_view text, const std::string& language, size_t limit, MatchBudget* budget);
+    TokenList tokenize(std::string_view text, const Grammar* grammar, TokenArena* arena, PatternProfile::Call* profile, MatchBudget* budget, size_t limit = std::string_view::npos);
+    void matchGrammar(std::string_view text, TokenList& tokenList, const Grammar* grammar, TokenListPtr startNode, size_t startPos, RematchOptions* rematch, size_t limit, std::vector<GreedySearch>& searches, PatternProfile::Call* profile, MatchBudget* budget);
+
+    // Last search of a greedy pattern in searches, added if there is none
+    static GreedySearch& lastSearch(std::vector<GreedySearch>& searches, const Pattern* pattern);
 
     std::shared_ptr<LanguageTree> m_tree;
+
+    std::atomic<bool> m_profiling{ false };
+    PatternProfile m_profile;
 };
\ No newline at end of file
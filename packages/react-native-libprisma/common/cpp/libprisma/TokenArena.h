@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Pool for the nodes of one tokenize call, nested token lists included.
+// Nodes come from large blocks that are released all at once when the arena
+// is destroyed, nodes destroyed before that are recycled by size.
+class TokenArena
+{
+public:
+    TokenArena() = default;
+
+    TokenArena(const TokenArena&) = delete;
+    TokenArena& operator=(const TokenArena&) = delete;
+
+    // LIBPRISMA_TOKEN_HEAP allocates every node on its own instead, which
+    // sanitizers and heap profilers can track
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+#if defined(LIBPRISMA_TOKEN_HEAP)
+        m_bytes += sizeof(T);
+        return new T(std::forward<Args>(args)...);
+#else
+        return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+#endif
+    }
+
+    template <typename T>
+    void destroy(T* node)
+    {
+#if defined(LIBPRISMA_TOKEN_HEAP)
+        m_bytes -= sizeof(T);
+        delete node;
+#else
+        node->~T();
+        release(node, sizeof(T));
+#endif
+    }
+
+    // Memory held for nodes: the blocks, or the live nodes with
+    // LIBPRISMA_TOKEN_HEAP, adopted arenas included
+    size_t bytes() const
+    {
+        // With LIBPRISMA_TOKEN_HEAP an arena may count down nodes of an
+        // adopted one, the unsigned sum still comes out right
+        size_t bytes = m_bytes;
+        for (const auto& adopted : m_adopted)
+        {
+            bytes += adopted->bytes();
+        }
+        return bytes;
+    }
+
+    // Keeps another arena alive as long as this one, for nodes that moved
+    // from its lists into this arena's, see TokenList::append. Nodes of
+    // either arena may be destroyed through the other.
+    void adopt(std::unique_ptr<TokenArena> other)
+    {
+        m_adopted.push_back(std::move(other));
+    }
+
+private:
+    struct FreeSlot
+    {
+        FreeSlot* next;
+    };
+
+    struct SizeClass
+    {
+        size_t size;
+        FreeSlot* free;
+    };
+
+    static constexpr size_t kFirstBlockSize = 4 * 1024;
+    static constexpr size_t kMaxBlockSize = 64 * 1024;
+
+    SizeClass& sizeClass(size_t size)
+    {
+        // Only a handful of node types exist
+        for (auto& sizeClass : m_sizeClasses)
+        {
+            if (sizeClass.size == size)
+            {
+                return sizeClass;
+            }
+        }
+
+        return m_sizeClasses.emplace_back(SizeClass{ size, nullptr });
+    }
+
+    void* allocate(size_t size, size_t alignment)
+    {
+        SizeClass& recycled = sizeClass(size);
+        if (recycled.free)
+        {
+            FreeSlot* slot = recycled.free;
+            recycled.free = slot->next;
+            return slot;
+        }
+
+        size_t space = m_end - m_cursor;
+        void* cursor = m_cursor;
+        if (!std::align(alignment, size, cursor, space))
+        {
+            m_blockSize = m_blocks.empty() ? kFirstBlockSize : std::min(m_blockSize * 2, kMaxBlockSize);
+
+            const size_t blockSize = std::max(m_blockSize, size + alignment);
+            m_blocks.emplace_back(new std::byte[blockSize]);
+            m_bytes += blockSize;
+            m_cursor = m_blocks.back().get();
+            m_end = m_cursor + blockSize;
+
+            space = blockSize;
+            cursor = m_cursor;
+            std::align(alignment, size, cursor, space);
+        }
+
+        m_cursor = static_cast<std::byte*>(cursor) + size;
+        return cursor;
+    }
+
+    void release(void* memory, size_t size)
+    {
+        SizeClass& recycled = sizeClass(size);
+        recycled.free = new (memory) FreeSlot{ recycled.free };
+    }
+
+    std::vector<std::unique_ptr<std::byte[]>> m_blocks;
+    std::vector<SizeClass> m_sizeClasses;
+    std::vector<std::unique_ptr<TokenArena>> m_adopted;
+    std::byte* m_cursor = nullptr;
+    std::byte* m_end = nullptr;
+    size_t m_blockSize = 0;
+    size_t m_bytes = 0;
+};
@@ -1,30 +1,64 @@
 #include "TokenList.h"
 
 TokenList::TokenList(std::string_view value)
-    : head(new TokenListNode())
-    , length(1)
+    : TokenList(value, nullptr)
 {
-    const TokenListPtr newNode = new Text(head, head, value);
+}
+
+TokenList::TokenList(std::string_view value, TokenArena* arena)
+    : length(1)
+    , m_arena(arena)
+{
+    if (!m_arena)
+    {
+        m_ownedArena = std::make_unique<TokenArena>();
+        m_arena = m_ownedArena.get();
+    }
+
+    head = m_arena->create<TokenListNode>();
+    const TokenListPtr newNode = m_arena->create<Text>(head, head, value);
     head->next = newNode;
+    head->prev = newNode;
 }
 
 TokenList::~TokenList()
 {
+    if (!head)
+    {
+        return;
+    }
+
     TokenListPtr next = head->next;
     while (head != next)
     {
         TokenListPtr current = next;
         next = next->next;
-        delete current;
+        destroy(current);
     }
 
-    delete head;
+    destroy(head);
+}
+
+void TokenList::destroy(TokenListPtr node)
+{
+    switch (node->kind())
+    {
+    case TokenListNode::Kind::Text:
+        m_arena->destroy(static_cast<Text*>(node));
+        break;
+    case TokenListNode::Kind::Syntax:
+        m_arena->destroy(static_cast<Syntax*>(node));
+        break;
+    case TokenListNode::Kind::Head:
+        m_arena->destroy(node);
+        break;
+    }
 }
 
-TokenListPtr TokenList::addAfter(TokenListPtr node, const std::string& type, TokenList&& children, const std::string& alias, size_t textLength)
+TokenListPtr TokenList::addAfter(TokenListPtr node, uint32_t type, TokenList&& children, uint32_t alias, std::string_view value)
 {
     const TokenListPtr next = node->next;
-    const TokenListPtr newNode = new Syntax(node, next, type, std::move(children), alias, textLength);
+    const TokenListPtr newNode = m_arena->create<Syntax>(node, next, type, std::move(children), alias, value);
 
     node->next = newNode;
     next->prev = newNode;
@@ -36,7 +70,7 @@ TokenListPtr TokenList::addAfter(TokenListPtr node, const std::string& type, Tok
 TokenListPtr TokenList::addAfter(TokenListPtr node, std::string_view value)
 {
     const TokenListPtr next = node->next;
-    const TokenListPtr newNode = new Text(node, next, value);
+    const TokenListPtr newNode = m_arena->create<Text>(node, next, value);
 
     node->next = newNode;
     next->prev = newNode;
@@ -53,19 +87,38 @@ void TokenList::removeRange(TokenListPtr node, size_t count)
     {
         node->next = item->next;
         node->next->prev = node;
-        delete item;
+        destroy(item);
 
         item = node->next;
         length--;
     }
 }
 
-Syntax::Syntax(TokenListPtr prev, TokenListPtr next, const std::string& type, TokenList&& children, const std::string& alias, size_t length)
-    : TokenListNode(prev, next)
+void TokenList::append(TokenList&& other)
+{
+    const TokenListPtr first = other.head->next;
+    const TokenListPtr last = other.head->prev;
+    if (first != other.head)
+    {
+        const TokenListPtr tail = head->prev;
+        tail->next = first;
+        first->prev = tail;
+        last->next = head;
+        head->prev = last;
+        length += other.length;
+    }
+
+    other.m_arena->destroy(other.head);
+    other.head = nullptr;
+    other.length = 0;
+    m_arena->adopt(std::move(other.m_ownedArena));
+}
+
+Syntax::Syntax(TokenListPtr prev, TokenListPtr next, uint32_t type, TokenList&& children, uint32_t alias, std::string_view value)
+    : TokenListNode(prev, next, Kind::Syntax, value)
     , m_type(type)
-    , m_children(std::move(children))
     , m_alias(alias)
-    , m_length(length)
+    , m_children(std::move(children))
 {
 
 }
@@ -1,39 +1,79 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 
+#include "TokenArena.h"
+
+// Ids of the token type and alias names that every LanguageTree reserves
+namespace TokenNames {
+enum : uint32_t {
+    // alias of a token that has none
+    None = 0,
+    // type of text between tokens, it has no Syntax node
+    Text = 1,
+};
+}
+
+// Token nodes are tagged instead of polymorphic, hot loops branch on kind
+// and static_cast to Text or Syntax. Every node refers to the source text it
+// covers, a Syntax node additionally holds its children and the interned
+// ids of its type and alias names.
 struct TokenListNode
 {
-    TokenListNode(TokenListNode* prev, TokenListNode* next)
+    enum class Kind : uint8_t
+    {
+        Head,
+        Text,
+        Syntax,
+    };
+
+    TokenListNode(TokenListNode* prev, TokenListNode* next, Kind kind, std::string_view value)
         : prev(prev)
         , next(next)
+        , m_data(value.data())
+        , m_length(static_cast<uint32_t>(value.size()))
+        , m_kind(kind)
     {
     }
 
     TokenListNode()
         : prev(nullptr)
         , next(nullptr)
+        , m_data(nullptr)
+        , m_length(0)
+        , m_kind(Kind::Head)
     {
     }
 
-    virtual ~TokenListNode() = default;
-
     TokenListNode(const TokenListNode&) = delete;
     TokenListNode& operator=(const TokenListNode&) = delete;
 
-    virtual size_t length() const
+    size_t length() const
+    {
+        return m_length;
+    }
+
+    // the head sentinel counts as syntax, so text runs stop at it
+    bool isSyntax() const
     {
-        return 0;
+        return m_kind != Kind::Text;
     }
 
-    virtual bool isSyntax() const
+    Kind kind() const
     {
-        return true;
+        return m_kind;
     }
 
     TokenListNode* prev;
     TokenListNode* next;
+
+protected:
+    const char* m_data;
+    uint32_t m_length;
+    Kind m_kind;
 };
 
 typedef TokenListNode* TokenListPtr;
@@ -41,21 +81,30 @@ typedef TokenListNode* TokenListPtr;
 class TokenList
 {
 public:
+    // Creates the arena that the nodes of this list and of all lists nested in it are allocated from
     TokenList(std::string_view text);
+    // Allocates from the arena of an enclosing list, which has to outlive this one
+    TokenList(std::string_view text, TokenArena* arena);
     ~TokenList();
 
     TokenList(const TokenList&) = delete;
     TokenList& operator=(const TokenList&) = delete;
     TokenList(TokenList&& old) noexcept
+        : head(old.head)
+        , length(old.length)
+        , m_arena(old.m_arena)
+        , m_ownedArena(std::move(old.m_ownedArena))
     {
-        head = old.head;
-        length = old.length;
-
-        old.head = new TokenListNode();
-        old.head->next = old.head;
+        // a moved-from list is only destroyed
+        old.head = nullptr;
         old.length = 0;
     }
 
+    TokenArena* arena() const
+    {
+        return m_arena;
+    }
+
     struct ConstIterator
     {
         using iterator_category = std::forward_iterator_tag;
@@ -79,20 +128,29 @@ public:
     ConstIterator begin() const { return ConstIterator(head->next); }
     ConstIterator end() const { return ConstIterator(head); }
 
-    TokenListPtr addAfter(TokenListPtr node, const std::string& type, TokenList&& children, const std::string& alias, size_t length);
+    TokenListPtr addAfter(TokenListPtr node, uint32_t type, TokenList&& children, uint32_t alias, std::string_view value);
     TokenListPtr addAfter(TokenListPtr node, std::string_view value);
     void removeRange(TokenListPtr node, size_t count);
 
+    // Moves the nodes of other to the end of this list. other has to own its arena, which
+    // this list's arena adopts, and is left empty.
+    void append(TokenList&& other);
+
     TokenListPtr head;
     size_t length;
+
+private:
+    void destroy(TokenListPtr node);
+
+    TokenArena* m_arena;
+    std::unique_ptr<TokenArena> m_ownedArena;
 };
 
 class Text : public TokenListNode
 {
 public:
     Text(TokenListPtr prev, TokenListPtr next, std::string_view value)
-        : TokenListNode(prev, next)
-        , m_value(value)
+        : TokenListNode(prev, next, Kind::Text, value)
     {
 
     }
@@ -100,44 +158,22 @@ public:
     Text(const Text&) = delete;
     Text& operator=(const Text&) = delete;
 
-    const std::string_view& value() const
+    std::string_view value() const
     {
-        return m_value;
+        return std::string_view(m_data, m_length);
     }
-
-    size_t length() const
-    {
-        return m_value.size();
-    }
-
-    bool isSyntax() const
-    {
-        return false;
-    }
-
-private:
-    const std::string_view m_value;
 };
 
 class Syntax : public TokenListNode
 {
 public:
-    Syntax(TokenListPtr prev, TokenListPtr next, const std::string& type, TokenList&& children, const std::string& alias, size_t length);
+    // type and alias are name ids, see SyntaxHighlighter::tokenName
+    Syntax(TokenListPtr prev, TokenListPtr next, uint32_t type, TokenList&& children, uint32_t alias, std::string_view value);
 
     Syntax(const Syntax&) = delete;
     Syntax& operator=(const Syntax&) = delete;
 
-    size_t length() const
-    {
-        return m_length;
-    }
-
-    bool isSyntax() const
-    {
-        return true;
-    }
-
-    const std::string &type() const
+    uint32_t type() const
     {
         return m_type;
     }
@@ -152,7 +188,8 @@ public:
         return m_children.end();
     }
 
-    const std::string &alias() const
+    // TokenNames::None if the token has no alias
+    uint32_t alias() const
     {
         return m_alias;
     }
@@ -162,9 +199,8 @@ public:
 		return m_children;
 	}
 
-public:
-    std::string m_type;
+private:
+    uint32_t m_type;
+    uint32_t m_alias;
     TokenList m_children;
-    std::string m_alias;
-    size_t m_length;
 };
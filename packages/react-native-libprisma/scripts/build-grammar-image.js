@@ -0,0 +1,178 @@
+#!/usr/bin/env node
+
+// Converts grammars.dat into grammars.bin, the indexed image the native
+// module maps at startup. The layout is documented in
+// common/cpp/libprisma/GrammarImage.h and both must be kept in sync.
+
+const fs = require('fs');
+const path = require('path');
+
+const assetsDir = path.join(__dirname, '..', 'common', 'cpp', 'assets');
+const inputFile = path.join(assetsDir, 'grammars.dat');
+const outputFile = path.join(assetsDir, 'grammars.bin');
+
+const MAGIC = 0x4947504c; // "LPGI"
+const VERSION = 1;
+const HEADER_WORDS = 16;
+const NO_GRAMMAR = 0xffffffff;
+
+const IGNORE_CASE = 1 << 0;
+const MULTILINE = 1 << 1;
+const LOOKBEHIND = 1 << 8;
+const GREEDY = 1 << 9;
+
+// Reader for the sequential grammars.dat layout written by generate.js
+function reader(data) {
+  let offset = 0;
+  return {
+    uint8() {
+      return data[offset++];
+    },
+    uint16() {
+      const value = data.readUInt16LE(offset);
+      offset += 2;
+      return value;
+    },
+    string() {
+      let length = this.uint8();
+      if (length >= 254) {
+        length = this.uint8() | (this.uint8() << 8) | (this.uint8() << 16);
+      }
+      const value = data.subarray(offset, offset + length);
+      offset += length;
+      return value;
+    },
+  };
+}
+
+// Deduplicated string pool
+const strings = [];
+const stringOffsets = new Map();
+let stringsSize = 0;
+
+function addString(bytes) {
+  const key = bytes.toString('latin1');
+  let offset = stringOffsets.get(key);
+  if (offset === undefined) {
+    offset = stringsSize;
+    stringOffsets.set(key, offset);
+    strings.push(bytes);
+    stringsSize += bytes.length;
+  }
+  return [offset, bytes.length];
+}
+
+// Token type and alias names, ids 0 and 1 are reserved like in TokenList.h
+const names = [];
+const nameIds = new Map();
+
+function intern(bytes) {
+  const key = bytes.toString('latin1');
+  let id = nameIds.get(key);
+  if (id === undefined) {
+    id = names.length;
+    nameIds.set(key, id);
+    names.push(addString(bytes));
+  }
+  return id;
+}
+
+intern(Buffer.from(''));
+intern(Buffer.from('text'));
+
+function parsePattern(item) {
+  const value = item.toString('latin1');
+  const beg = value.indexOf('/');
+  const end = value.lastIndexOf('/');
+  if (beg < 0 || beg === end) {
+    throw new Error(`Invalid pattern: ${value}`);
+  }
+
+  const options = value.substring(end + 1);
+  const aliasBeg = options.indexOf(',');
+  const aliasEnd = options.lastIndexOf(',');
+  const inside = options.substring(aliasEnd + 1);
+
+  let flags = 0;
+  for (const c of options.substring(0, aliasBeg)) {
+    flags |=
+      { i: IGNORE_CASE, m: MULTILINE, l: LOOKBEHIND, y: GREEDY }[c] || 0;
+  }
+
+  return [
+    ...addString(item.subarray(beg + 1, end)),
+    intern(Buffer.from(options.substring(aliasBeg + 1, aliasEnd), 'latin1')),
+    inside.length ? parseInt(inside, 10) : NO_GRAMMAR,
+    flags,
+  ];
+}
+
+console.log('Reading grammars.dat...');
+const input = reader(fs.readFileSync(inputFile));
+
+const patterns = [];
+for (let i = 0, count = input.uint16(); i < count; i++) {
+  patterns.push(parsePattern(input.string()));
+}
+
+const grammars = [];
+const tokens = [];
+const indices = [];
+for (let i = 0, count = input.uint16(); i < count; i++) {
+  const keys = input.uint8();
+  grammars.push([tokens.length, keys]);
+
+  for (let j = 0; j < keys; j++) {
+    const name = intern(input.string());
+    const ids = input.uint8();
+    tokens.push([name, indices.length, ids]);
+
+    for (let k = 0; k < ids; k++) {
+      indices.push(input.uint16());
+    }
+  }
+}
+
+const languages = [];
+for (let i = 0, count = input.uint16(); i < count; i++) {
+  const name = input.string();
+  const title = input.string();
+  languages.push([name, title, input.uint16()]);
+}
+
+// Sorted by name so languages can be found with a binary search
+languages.sort((a, b) => Buffer.compare(a[0], b[0]));
+
+const tables = [
+  patterns,
+  grammars,
+  tokens,
+  indices.map((id) => [id]),
+  languages.map(([name, title, grammar]) => [
+    ...addString(name),
+    ...addString(title),
+    grammar,
+  ]),
+  names,
+];
+
+const header = [MAGIC, VERSION];
+let offset = HEADER_WORDS * 4;
+for (const table of tables) {
+  header.push(table.length, offset);
+  offset += table.reduce((size, record) => size + record.length * 4, 0);
+}
+header.push(offset, stringsSize);
+
+const words = [header, ...tables.flat()].flat();
+const image = Buffer.alloc(offset + stringsSize);
+words.forEach((word, i) => image.writeUInt32LE(word, i * 4));
+Buffer.concat(strings).copy(image, offset);
+
+console.log(`Writing ${outputFile}...`);
+fs.writeFileSync(outputFile, image);
+
+console.log(
+  `Grammar image: ${patterns.length} patterns, ${grammars.length} grammars, ` +
+    `${languages.length} languages, ${(image.length / 1024).toFixed(2)} KB`
+);
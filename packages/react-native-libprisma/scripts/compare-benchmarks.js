@@ -0,0 +1,66 @@
+#!/usr/bin/env node
+
+// Prints a Markdown table comparing two runs of the native benchmark, one
+// column per run named after its regex backend, from
+// libprisma_benchmark --benchmark_out_format=json --benchmark_out=std.json.
+// Only benchmarks named <prefix><language> are compared, TokenizeWarm/ by
+// default. See docs/benchmark.md.
+
+const fs = require('fs');
+const path = require('path');
+
+const [beforeFile, afterFile, prefix = 'TokenizeWarm/'] =
+  process.argv.slice(2);
+if (!beforeFile || !afterFile) {
+  console.error(
+    'Usage: node compare-benchmarks.js <before.json> <after.json> [prefix]'
+  );
+  process.exit(1);
+}
+
+const MILLISECONDS = { ns: 1e-6, us: 1e-3, ms: 1, s: 1e3 };
+
+// Milliseconds per call by language, the mean when the run has repetitions
+function readRun(file) {
+  const { context, benchmarks } = JSON.parse(fs.readFileSync(file, 'utf8'));
+  const repeated = benchmarks.some((b) => b.aggregate_name === 'mean');
+  const times = new Map();
+  for (const benchmark of benchmarks) {
+    if (
+      !benchmark.name.startsWith(prefix) ||
+      (repeated
+        ? benchmark.aggregate_name !== 'mean'
+        : benchmark.run_type === 'aggregate')
+    ) {
+      continue;
+    }
+    const language = benchmark.run_name
+      ? benchmark.run_name.slice(prefix.length)
+      : benchmark.name.slice(prefix.length);
+    times.set(
+      language,
+      benchmark.real_time * MILLISECONDS[benchmark.time_unit]
+    );
+  }
+  return {
+    label: context.regex_backend ?? path.basename(file, path.extname(file)),
+    times,
+  };
+}
+
+const before = readRun(beforeFile);
+const after = readRun(afterFile);
+
+console.log(`| Language | ${before.label} | ${after.label} | Speedup |`);
+console.log('|----------|-----------:|-----------:|--------:|');
+const languages = [...before.times.keys()].sort();
+for (const language of languages) {
+  if (!after.times.has(language)) {
+    continue;
+  }
+  const time = before.times.get(language);
+  const other = after.times.get(language);
+  console.log(
+    `| ${language} | ${time.toFixed(2)}ms | ${other.toFixed(2)}ms | ${(time / other).toFixed(1)}x |`
+  );
+}
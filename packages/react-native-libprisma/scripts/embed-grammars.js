@@ -9,13 +9,13 @@ const inputFile = path.join(
   'common',
   'cpp',
   'assets',
-  'grammars.dat'
+  'grammars.bin'
 );
 const outputFile = path.join(__dirname, '..', 'src', 'grammars.ts');
 
 const zlib = require('zlib');
 
-console.log('Reading grammars.dat...');
+console.log('Reading grammars.bin...');
 const data = fs.readFileSync(inputFile);
 const size = data.length;
 
@@ -35,7 +35,7 @@ const base64 = compressed.toString('base64');
 
 // Generate TypeScript file
 const content = `// Auto-generated file - DO NOT EDIT
-// Generated from grammars.dat
+// Generated from grammars.bin
 // Original size: ${(size / 1024).toFixed(2)} KB
 // Compressed size: ${(compressedSize / 1024).toFixed(2)} KB
 
@@ -45,5 +45,5 @@ export const GRAMMARS_DATA = "${base64}";
 console.log(`Writing ${outputFile}...`);
 fs.writeFileSync(outputFile, content);
 
-console.log('Successfully embedded grammars.dat as TypeScript!');
+console.log('Successfully embedded grammars.bin as TypeScript!');
 console.log(`   Output: ${outputFile}`);
@@ -1,6 +1,6 @@
 // Auto-generated file - DO NOT EDIT
-// Generated from grammars.dat
-// Original size: 606.68 KB
-// Compressed size: 189.85 KB
+// Generated from grammars.bin
+// Original size: 667.47 KB
+// Compressed size: 217.70 KB
 
-export const GRAMMARS_DATA = "H4sIAAAAAAAAE+y93W9jSZYn1jP7MR89O1873TPdPbObX1UpSqSYyszKylSlxKJISmIlv4qXzEw1L6WkyCuJlfwqXjIllSILsx7D+2h7v+w3w+sxbMAG5sUvxsIPC9vwgw0D9osNw/CL/eK/YO2FkfDvd07EJanM6q3q7tmpmRYkRpyIGzc+T5xzIu6JEz/+zevJpf3Gvt9oLvuNWMMPfa+5spTa8Jubt2LJ3nk8vnaefHw9W87U9iq5pdR6Y3/zxu2G32yaG439G83lG+Z2Y/92c/l2DK+t+w1J8vjG7XekMI+XUtevJxIx8xiuJEw0DYDric1YbDkBd9lv+uFyLLWZ7KLoQdI/RLLDcdB6adqtSfvEtIeDSXcwDUxnaIJeGJij7qDV652bo+HYHE0H7Ul3ODDdI9OFOwgnrUE7GB6ZQXBqBtNez4yDyXQ8MJOT8fDUTMbn5vSk2wti/mEyHv/15L6/vLqc7MfjN5NLL8ztGFvkrxrU0F+LoZd8f+wPmqjlGpInkksN87rpEvGxubAJ0IMNc9FED8bDybg7OI5/H/1s/DB2gwX04u1hvx8MJvE3/8Effie55IcGOexLVsuJfKlSrxk/VSub9Fa6kvDK9WomB3irmnuaT9dyWcAef7VqOlMz6UwmV3FevrQjkOdVyoV8Zo+BcjWr0WW8lanln6Zr+XKJYD1dMOlslr8EklVzeKukibOfpDO5ErLdruWqJl3Ipz11c+Lv4P1Cgb9yBlUCUNlNm3QpXdjz8p4CP+aLJeReQjUqlRxB8dI7OQtJUZUKamrrVM3s5p/iaTWH3Kr52m4xV8tnDAv3Mu4FL4+UXiXHxnteriqeVEk8dpAAmtgrZ/I2d2+vlNmtlkvlOvLDW7U0Imu1an6rXmO76rXdMgrdm0GJzG4u88Skn+6YrTQAOjvVch1tIViviPcsXWU4m4fj5cxWbrtcpbeDim7las9yOfh5ZJEvpat79KQhW/kafwl2Ev1SWcPlqnjP6Rek1EK6ZF0PXnmLjsTDZUwdpWml6KLj0BoB6T1HhwB30k8SlXIeQ7qF//r2NkZnC3XZq7CzWJs9jCOdRCZt/ZL1y9b31C/Z5yUbBoIhs4zBexliBR3mmGFnwKmJozG1zK7J5PJIBOziW+KhhpndNHpLXDsFFK7mPq3nPAmVgDfiSVYASrmCR6CaqJUTu7nnAgOvmS+gQo4ZcvzERU+YTL6aqRfSeJ4/MJkCmq4u2ihDooEsMMOCuaeooEsEZNwtZ12oUi6jGYVcugQ0oI9cC3lOmgyHKCNDBJedgIowvoz/dCEHVAaQFUdKLRcKxGb4GHO49WLJeh79gzm0Y5BgRaDdXNrlcPAktyd+KbcDfH+a00C5WsQsJ1gpe/kovlauSXSxKBVW3xMgr+FySbx6yU1OhCpALSmtCEJhX1RIXq2AgnguKaYU/BJetl6ulNaorDi5kqehvM0dwyl9IL6N8jBFJW9gyfOa8zUiX6pLBrUqx0F9efJUnFzVVoUgX61wVsBjL83TOtJF/ICX6OCaulUmeko8Qj9X8iaD+cPK05N3QBzQLygX79aRWwm01gEH88VLXI2+x7EVL+HlCq6Nda9WLrIgCyS26yV9lCXCV0mrBB/pCHkhkC9tlwXwcjX6jN0DWd5FaKuYfk7Uz2b9ZLHoJ/f25kAJFIv0chH1zuYyeWCJ54ADbze/XWMIU0UGn49yFTjb6XqBT0A+OGsB5Es59dgvCmj10UbJG54+KpLQZXNAoppgXTYX0XSCIMNMTkqRtjmgoQWTzacLZSTJV9FnZYxMNu85bAFYKaT3nJ8oclYhALTJKJAvSbKn/OXlIb1L7I6RMlxZ9God3QNXuVJuBqEP6lVbs7rMg+xeKV0Ee4JfqZZNzuTSIG85YLQ4GGihh6BSOXHy2yZXrIC/YCpsFdB94jMnoI2SAnJJ/BK50i6bwH4CtihCMB6pURFC5e3EXG/bmO18IefgCvmshWcIR/5boyvUWXzSZAJCgQkIXQSA3shxokZVkeDzXIY+eJz1iuI7tOWIptXbNnZ4xQNZ3oZQwUChXK7QV4IqUDlb16prFuhPGS6AWndCnJbwnu1qK8EHcrmq5j9fxVnPKcN7d19GcWxqTVhmrqQlPM1DSNDMPsU/xSS4wCEgPZoLIiddywBe8jLpSk49qctTeVH5Ru45RbTccxHR1JPSHZSoERFmYb6RKdSzOetLhtLhcEhRc8+B00xFHIOTII3mvMo9r/BnwbTt9+eVvEVZgEBjecvSbgJV52nqmqCfeDkLePqyyprbnI/bOSLMdj5XyKqbEH7k2YC3V9wCQZ4P2Ef00Fg45NDq2Q7QABNAcqTLrKtg++IK1gOEJGOHdPsJRmb7CUZhG7iEzAp1EPDtMh8xSKSkk5awyGfbwj630Q46xZy6KLKaI5wnpsEv40WHyg5QVu9CEH8xhbfr1doumrGTRstRj51cKVclvdgBRd4BPUGH7rCWO6zlDiQCNGynCnYGl8ykSh9kWpm57cKdmgFeZtEj6lXhV4uQGDwA3i4GZTctWe9mtwyZvyUIBJlYPA1Kqlyhkshn1XeS1C7n1S54BRzUZreMcdwt10AMayZv8iCtBq8gEVjstmP+LohC8ugnTG0I2JRyxWNZeYgQWa5PCnuAKwWZW/blhaA3C6M9hAUvARAd1ZMM8WJJFiwopZQpiMOpYX3PApoWrFlmbJ4USl1FG7JKrl6ZHAOWt3mzRNLOdMH5+R/b2oK1oJVYJTBJRVxZZeRLyleYk8wMdEfWzAhbBCm+REFNXy2lbdxTslpAZTiUE3LqozcSwsqxgMp7eFgjQgGb87VS2XwCkfIT4L55QkZMh+14gmxzBUPRDz+PzjOI4wA4hbBg2KmTVBUohBeYN5gk2wUEK1gcgf+Uoe2aOIlPIIhoyxisYGIJ4FXYxAJkS0g6EC92artG8BLsHb+nqIW4iMg/QUJ2PZ2ESlUCzriQBvM/1jTbOZYmiFzIs6ZwEuAAXMdKFRGm9I6JV2PN2S5TKKez4givq5Yxt4qGgjeFmoK6OfHYh5Qg8LPkA9DaHbpCkODn9RXJFqypUH7GH9CgUGEpkAAh9RRNkfSvSDZZTH8C9o55UsT6lXUspqs7El99AsejQzIprsj6kMr4yxfryAczRbziFqcrfMo1oEa7xnEX60sRCnoWkNKUcboFSZElA40lb2Cu1gwCHwU/yHozUALZLD2+LxUrk1OLy+ktgDwmQy5CChbnksRUhBiYr2CqO+DSc6wRSySydEDiTUmXJCVAcEGGMOKlnK4KS7ln/Ol0JSCSCwHHrUsU/jEJSuWEk/gAzvgTAqDD1vPEJz2VzLkyVEwHCCmzrItTBrhnAL+WJ1YRKFfK21p4OfFjyN7wszlxmGkpwcWQxggMemq4aC+haCSoQ9Yr1Tmk9MrbXIOasilvfUL5RT0PPuT0tAiy5YxdMuTmQE9heNv4lx+F/DKqiJaWS+jzcgV8o6yihHrA3rIVIIDsuiAvC38SF7GY9Pgxol6raABews5krnW2ifUE2L0V7jvQYW9wDuAnnVjRCKIjBHmOLvKMIMvOo7AkqokDCltgvjWSQlPJVbn0l8xQNPm19aUQvIm2VbbxnwDRrYEIYTRRo4LQU6Gvup5lsrJ3IPyMABtRqaZ3MAfh57gSzVPUBmzXLFylgghLOVUsdzAQ8EEVxE24FSVCuhkE4ClJpxAkSP4W8pi/Uh34qLEkLdcwyFKIyq+VOoY7A8/b3arXaqwtOh+IU88lZCwhV2aeyHKuCiwt20TVdB5sgS6rWZWtD3E9eM8MBIisOJpHVbk/WpvjJLN+1gHuiWQl0XMLBwTqmZz1+GzbSE8JVgKqkihVcztgqtWcIDIYLVoJj4sfyVJGxfnChRW2T8nWnfBhfSmJo5ATn/FeuVC3NZK9PX2ZBMXLE6cAc+mpnid+Me0eFOlReIdbr5asJ3NVQclN1sfiznE5CQubE0j5XDUPCl4tZg4WtkAOKP8SAfgEPBsyQ/bAoiejvD20rDhLxTlLeiNbh7p9Uy0/Q9paLW+q9ZLxQLQ87vEKQnsq2nlkXAdzWHo54sDL5K1wxmfIZj7swINn+drugeXyB0LNQP0ocSoRtF7CbhnumRlt9HLciIXH7Rl5JJBnHD22SzL1Eo7yzNh7BCVckbOIXG0xNPeepR5R2D0CSfO4MvG4d8Cp6ABGITvQWYKyaeHtEt3ExUpepF+h83QO0h53wWpYSSBMIdRwL5lzTEG0mTKJ9yRfEUc4iFckCfPKwDFP8oaj9SxXpQq6Qa+IQ9RVvAKbgoxpRxayNRrzaYE/7nRgNeh9yrxsTrV0sUKX3Z0lUK0tLtslSmpTkw6gKzMtgjwBiQLiabDuCWkBWlYSItl4NXFkbxRePVMjpkYQ39pjhepblCnhiQDDeIBsT30LiFwjpwboRrfOjxFSu/qWrhQdcEks8Orb0vmQU/AT2ktfH/FDADuOwJ543E80HhCZ2CieNBdxusjkhr5IdIwBN3luPbttbwOsCKork1N3ZCw8t+yOYtBGyiv4baEuOjzieuo9zUNaqcnXFyAJvyDgtwunyoVfjZIfHaQmuatZEUd2L+kIOoAl47Vd0AJTywOt6HjqCiIQ+jEW6UYlE3HtQk/gLcgVWD3Uyk9yJbdqkQCelysuJSC3CyQ9oJtDCtp2gcHIhAdQ8tKKaQLz64ACsoiO4mUNIZBbpdXwPAMXi2N1NYUA+tqe4fJLHF0YRZBndGFWF8mvXrKfcUCPULyTteCXGSfSVp3rNjrze6wIP4cjIgvWGhDR66VnXP9gXV2vyJIKuMQsPetEuyZ14a/12nbioRFyThfliButmCXkwUNb6PAdFB6tjhNOaHc1eppPG0EUbiuyp5+lUe9naeVDzzj8dHLkzQAwA3VP61k+C2GMdQdqqOcZ0nFxIkFWAoobBCnbcdVH54l5BqElp27VPDfPiwXDL0nPvSx+OvH3cgWKSXto094elwPmx0YYBJEutpS63vBPE81YstuLx5P8PqmfJv3llHnc2NhspszmRsr4qQ3TSKz4yQ1+Bd1AqiTS/0DSv/9+Kop6GZyfDsed+AqenDKnxGbKbGyaxpfm4rW+esp0I36/nbb4CTf+e8kGHyYXIr+bbMRX15diTf1a+16jGxL8URJ5SiCW4jdnf+CPm8s3kufx+P2Hyff4CblxZ625khDXdPzOSgI/c9ZIJ7b9Dh9YAC2OD6b9w2Ac/2TuRTZ+VaDYsrwuEfARjDLRRC6j5bmsbvPbb2NfupSpOuhIOIYZoNnDUTBuTYbj+Aa/xV/zJ81lJmu0El80ZRyW0en7jzfl2/Lypnb18kaM35Fd167dX/sf2AtS0GNXkn6U5VdGWYlk+F/YNpka99R3EJ39tE5Jbjf3HGGzS7qH54VnXgVrkBo5a8U8lXcRFeMH/J93npuL2Dae9gI2Jp6ca8lX9YSgJxJ/N7nhJ4GOSeDCbyQbSzGfCgoIbCeXUGPpe99+qL+4+xpj49/yL0QBAShmFsDG/uvmso80+K34r4nQD0rJF/KuqkeYr/2yKA4gsagOvGjGll8QJT8sa9tWm7HHqLZ/KpgTriBRuMm5tLKxdMMpH9gimdHdmDZjGdAyEADvbrJ6a292f+k7qinRCo1TlggDpzHRa4Uh9SbCiekER61pj34vmIgORed80Op32yZoIakoVARnk2DQCVWx4t3qFcfBRFQs+qNeQC2GkOBwPFGli3Zv2gnmlS+6g0kwPmq1A4WYbTc0KDcIR4wdYHK/CmY6GsNXwXjcRR54+rJ1DH/cfdWa0B9OgvYk6JjR9LCHWlttjhD1QWkTxIRTTCYTnnbZ9MkJypmpekzOR6zOFI181RqbV8NuR9U/DJKfqA7IRtJf8VdMImE4rCt+At383n7TgJwZH3+gf49B/DZToGCN6xvNjVQMhLDxZepj4tsfJG/gtRs3DInQ2D8SXZAbeNDA+PgdPDtI+Z3Y8s2G3wGhaEqEhak0QgLyriex1E1E5BoriWZqLptYCjQm/ngxb0ua5hK9+1U0Fy+/+Z8i3DnkCLYOQ/4m41YbgXY7GKkHFGr1usCqDvyeaQ3gj8etc9OamMPgGAN/OOycW7wbytgTzYB844DohpRwJy3T6R53gTBOfQcOMAkIhx/HKDhjkUSy4Kw7uYx2g2CMMT4eToaRik+EWqHpdftdIkdvOByZ/rCjGDWcWKw6MshsODkJxqEZTicOzbqD4zlEax33W/P41g460/E85o1bXVR73Bog+Thog/bC6+Mn+Az/82kwDRxmjgMUgvQhJhw6NAxGrTFzDod9ONNDoqQJzwdtIOmg+wXyn7SOj8ULXxq0rY/5h/So9UDw10wHk25PcPiUcTP8NWfDcUwH9f3kHJPeAKaub4A4kmELB2+8D2QAUv5OEoiyinD8o6XYOmN+JXl79Tb87wElhOgSmU5BbSTbP0r6FwklSMtEqgQo3K0Y5srqMt75LRLei9d/8m+ufvSxZcpI02lhzLWfYtdWYr63QpJ1c57RXYeQ0NhfF5pO1bN1YWzCNEHljMoejQ2z/p1/8M98P3XQNInNOXHjTcthsBdMZrgrSDietsFXjVQimLQSGBxg8QTkrBv0OsQuIvOJIsE8DevgRdKk7uCoe6ZuT71xRNkMaKjpt9rjIZENfMv0pxBUekC5xEJh4O8DwbZeawRUm5AGmtEwnEx7imXEW5YW4Z1St8+nQDp1M0Mg+tlEAztDFCJQDQgyw0JScrRjHJyOuxNBq0nrDJjUJmGcDjQ762cxNWcwiSJfBVnstg57glvjebL4CSQ3djHQGfN6Ni8m4y7QFXgXrhjLacHWgFbhsnDtg6Z/uqzyir+k4uSbWxHFUQIShsEYXTLGQFlKMmNh5FDD08HEUQvSCanCjDoMx8K7FnT/5hiTjCbGnzziHYyoN2y3hDYszPXjcas/P+eDUQA6N54OhuBuXZYfBu0pevn8qNtDTuw7cJ7RGHSy0w0xtuiagPjUIt+RyTt0nWWnMFnQ3OylI00L7SR+c++XXT9pw9QDHe50WkcolMBhwPYTOuqOweABgN3DR6dIz/YPwbzbJ63xBJSHs6ITTAddAr1pfyDqlONhD6+ho9rT4Hg8nI4AhJNhH+QolKkDZOob14ed4WQAL3AdHEDGFUfkhlApt5MgZJLRBdKPu4fTSaBB+7YGtMwZaF+kx76Fd4YxOAapNpoUMi9/IPitw6CnLgPnpOqYit2jc3ivAu0lQrabCGo/EZKOGgnZh+PaLAsNiZk1SLoO6HDE0QJ9x5gqSiB7AKQaQvfDiWQXtk8CcBFL7IGj4XlIbGAuE5le4rpO0EBUGOf5rLsYihIK/cdssaMGFOqB1Zz1e6yCRZtPFWfunEF4aCWOmjIvZysWMH6jKxfOZisVrMRSDEJIL6RMHRB8RFkR4WPNMTMdj5mIY1MamgpbWpXGx8xZqhq0EZI+KAv/DplAiceb/+qvO0yeoo+1hw8hB2AScj4AFOJ22BseQowY9oIWnp+j9URcozNOGk/0hcPpzUzshBLa0cPk6RGfB4HME0lPpD0UOgJABOHuUbetFRCEbg81lTpAkj5ossCTbp+CS7vbB32wcrNFsU631Rsew5OCOMN1UkTzTYOsgUpAtsCpBaS+YCZDhaSmwRkwkE/bltJHEX22WWaESvICjkGyBZCXBS91thABD6ddTLGxOZ5iypxMJiNLswRk9hY+CVodCkOELf5ChAk5sBoFQjZAk2wc+R7ISt+4cfts+JJuyD4gJSc0PPyMgg7BCR4PBFI8xZRltXtdmX9kmB1MokEnGLTPpTc0UkAQ2oCi22y45gM6bFqUdMBQRUYMjq0iuwH151onYo/0ug5gTXTqctBblwk6giFnIyjeBMQ91El6CbskzqafoPMsnSaopE8hPp+FhUIIQOFOC5HwPAURDKDjhpKwLuGEIABLRGQRJIW8Mwi1bOJKbz5C6ilcHWMOCeRwGFIioVDKqr7qQkKmE5rT4BCU5VW3HeibDg8vx2uvykQE4ZkRqvkAmEtP+4nRbRG/CKjOO8H5ecHgsD2NHllYqo6wo34AoyVjvzXgALs4JaoM2GrRFzwjbSRjDynedK1EaAsFonQUcUIGpbXwRXiy8ZamZkRQNhBC15vc8FpOYt1nHm+axuNNQpCuhbpBOul0X+nSA8sOUP6ZTP67bl/i4vX66kdxSsg/TN6eOztw2x4duM09ggfJpcZ+o+lkqmj3wvchjPt+I8ZTE37z8qbZTtL3kW6qu0dHuhd1cf81tyai8Ir/OmYao0oTkRvcVOFOBcpA8VPExlCzW0k5yOGq5jfduYcmKjfG5D+Lr939PmTCi/kjI69FHt9MftXuyMJGycVsp8T+2O61ez/kavZ0RWVGvhFfamKVwVqVkkuJTYnlkkE6RJLE5ciIXbGIvLku8mZjHz0uO0V+DOzM5vlRzG4b/SD5se69rGONsxLDGsZtpv0geVNXJ4hf3ID8XPmY3Vk5aYEe9MLZJgmXj8RVyo99sC67pOiBmI9V1AyN0HOHd5AJQhEiuFq0exXwSDlDZZ4/TM43jA3A+ki3yX7ER+nEjxcfycvx33PP6Bw0lyWvHygeJ4C45ktg8vJKqumnUnjy3WTjo/Wl2AbR8s0/55GU/YY/uYb1mbQ3LRsB20rqNFBpTU7yJNVp2R3As6CEqYigzK90h3sNadBf/LbOc45iSajGqZ05YdsnJqu8dRYM2+Ou0vPorV1MrR6KzoMqiTOXowYly/xgNHW1LGCFPiUtLQpXkaqWp5NZgvmAfZ9ODFXstkJ1izLO6V5veEoJyKocS9FBxwM7PoGIXAwmJ0OIq2W3beWAAigQxK00mNl5fzgNuflSGB7n+i2I/wdFCJw7WPXZYGlYBybks+bgKdYTR+cSzbe5O2Alq2fDMTjudksWtenp5AQ5brXCbpswRIqJbqRJ1HbrpYUq4+GrLpmIhFBKtnuMzNK9Y75y0jfZrSzLrjz7VERbG6wGrV7fxRR3KHlzkBmQzoLPZBonOcqAR5lC0MOaogROgo44Unkqqsqnw5HxTvpB38MqI2a2wYP59mIzuKGU7YYk7qWhN6EEz1ZFLTaFoRUO0KvdATupOw46i7HeVPBzPhJiQhTUwTNF1E4YTgUiFmnArKoe2AFjRydjSpKssGHDyXhiZtYvhWy6MmvDF0EFIkb3zGxh+XmpXYjJlsSLSrPYj2X+UffYZIZcLATpkOW4ULZUHnjgxIjJQrY5wg9dK2gKJJR6pCNuvBjMhygvj2UfBFepj2Y8F1OxuxLF1pk3PZS3s5jkJ5Dp+1gFM/ks81mcZOwFrXH7xObp3p6ldjEZkV7r414MnT4+5tQVgjHIYPkecHpZiSM3EHZuBwCoYbyypDE1jBIGL2YGX2y3j7uZk6D9kn07iAZLH4CkdAdBFCnoGuHqF8BvwYzasCq9OJYoxXRC1aADNGpPohjF9y88yKqozWG3A5G1PNjG/JyOgQJbrR63g8Zo5Sl6zAXzgxNM5EkULgb8FhQFKxTBIKFskeLjqVCa+UBpmCG+bU2PWElgNaRQDQgKul6z5DN3NkKlgRlYrvd2RbDH3BkXgsEx6iTQK7IqO59cJ0uP2OT54wGmmOSbsQtMjdq16wQNlYYFLJxBVW1YusmTQ442pl4teCo+59FTFNv59pPgHDOXD43NgA86lpphQr4UBxiYBtUmSBZDjLRtA8TqSuuL3YGL7Q6i2FJwjFUCFm+d7LAdmk+n3fZLxzpAzjqSiAARyVSHkNE8EALtSKK+ZN06k8fIWJNdfhFE2Zu0ekF5kJNNK6FMWpuOBhy1Ereim3oxk9nJZz3hbRaPGVNsjXLR0t9SATukLmjX0y7oDafjdgAeZAT/iSTlAYQPCXmjoNfjSGQgSQwnGHeT0RWfkmiEhi+7gSXOGtCqhzYkc1JBb3Lec3Bt3Gq/lIzRpOy0P8rKHBlihmRk5wT4abKtV/wJ5QDD7Q641kDEjm7cc0yzW4yYQbaX2RuYeqiK8AmAJE5UlwH4JAhG9DEy4qHm8CpYP/RDgexUIjjmpktgX0TPC7WU7hTZwcKRcGDDVW7J9QN2l41RFid0hB43asls5+YfqPJYsVymllFJosQ9VrSdLxS4r2tZtzAzG18l65HcuBUlqUgT+5rPM5Dj4anyxWwwIAu0PS0j7PA5is1jBX12KehI2CxahBUwZV1bCepnOaaCnpg/QA7DYc2XRYiysMpIlljk3KeZXWCEjSsW0xULkjzKRoTOCnFdeRoiijhgW1fdubMWN3OMxcG07rrbkJXKbMjNCpkuFL/ATqchg9rzdrCisJs22xDND4G81SCUmSM0L1drHdsRw7QCQrk89IOVhsBAJkOsZWdB5ScalN6j5AL5xqIT+pJs/lxjpfKAOLnbbPsOtxCJYzt89Wja806mE25vuxkgfNKRY/VkOgIcTw6DlkhYnQ7RzlC4DJRhi1AQCrXhnpvZHYYTSicFjBO3U5UKTxR/FkOu5Hy/NSJ1FsD1NOFiMJgCb/WbrvW1Z1tgD8Q11IlVzQ+4jW85gPXQ5ZDo3UCUxx0ZJclbaIt3EgRAfcE4D8Qz76UrebZxxH0hdFltKPgCaXwWo2xZ2JRwL4qEIiRTtMP086YjLrqQHQl2mptcOm1jhoQEAhMwLIJcBzwBanOOytx+azytbCeF5rjtSHLJQK1WIIG1u0KV4bC3GOOyL3QP+SkgGxxOj9EhCxnZIF8UgWTc6u0OR0IWoogQkKamj3z4QdUDQwg6s56YC0szXOG1MSg0HsguYIajZGN2esPDVm8+psjFqS5AFK34MKY0Ch2Qt59NqtwsE5ZlyRupGSnctu7ci6ddiTkZowrSHB2MOeRVbwuTk9OjMGx1VJIGoKs2M6MUgJQ+AijaHcnCtEXx74toZiIigxaotIgAcROTwK5gw1BwPtC1k4PFt2uv7e6ZTBjBZbeQRNXApWtDO7/QVa1BSDouc5Oz3GZFTFaZb34hincdzV5Yf1b0m3NGpBwbEHhRbBEhhfudMc51FZMtcoUVUq9urzNDZ9vLXJT2t8cBhBZ+qC7rt8dQQ1X5Ji04xWBoFlaXoCPCQR1RYaB2wr2y0FhfBXiKBBitsSyAWyRr9DmAGuNh0mH9w5VVsXWMBSmHFrx7IXsXdiUU0VuaEMPYB4kfdFpYHiHEfDBK0bZDEVSkK1uXKjoXsdY4kxXF0+6Yn2FJBbH8BG6cnZvSM88ruHmAsQ01pj46HoPKiii8QKbsUJEocY2WG7wyla5i54xhymSJmIQDcu2ToZFSlVo76XmrZUGz1aOwa2UwIXDR1gF4Hak71hxS1izoOCGDTnafUAhz+yYI5cJ2axQ8A0K00WkhozjDygMXZXZrxYKKMSrDWAGT/H7Y1iI075x8iYx47Wxi8BMDJ/VLHWRDwX+U0Y1drO6qBQwg5kF5TlKi3D4cn0qV2JlCR9w8YX5DTiZ2sY5k1epMWH9BYl2IIy5AGIfMxx3qQAYclCnAPJgrXler1nMl2FniQQKf0TQrMzEyEmaoU6ASt2O8Vu5wxPVptxUTTtNXevCuCtiMHeAqoSFM4n5rQCHJxdSC/oiUvyeim0UarX++YtmtLN+14orhCyEOu+AgOIZNbZFfE88HZJdKsn8VOGTSULTFpsHZSoqheRKnMZFQrcEFYqdRgmG286NmScitrdijdh8HvmzF6x4XBe5BB+h5TCEPSBbN1yr4BOovLCpTqVuomCtaiAfzM8aDzB0enZOUjoOtIZBRWaasx2Tj6tKmn6LmOICr42+URx3ryCo/ksU1lpAvuSYkTwwsZ/MCR4pr3N0jOs1hhFI/IQ99ILWWrQxfcEjYgFL+7vEA6IbeqOmesLEra2EEnAQA5B06d20/Y605Ph9NuMbIdEcnXC3oUmhuH2sGsiNiXC5Fec6tATVbhTVzLEqoPFiQb+/KKRUGIusWkOg6aVx9xG+pAscMpzgWESJKRjisQV31Sy9OmEy9/FEEkPRFAbs1gqDDSYDzCOkJUZsLe/ncoEOZnxApbjFU2MbN70hIODhutc9ZaEV36BGHiT+e2PTEVSuYIFQHjeTioyO0H3yFPZkmn9FPliqeLcTIEGfS2ZJFE5siCtvnoHd2p1KF9/kY+8osQt+ZlSErG011uSqz8JPgXKMEUbwpNYfm1rYWk7IBvwC66bedr3hYZUDE17eUZRIXOAWqWO3rPgzfL2e8ymybqirflJnaMhrH+WYPImhGD/Q7tN0ZckE+9l4Gp9zZs50mm80xUIZggEHgZmqm34kIBTG+Ihif1Q/486xbuPXXG7NZh/MVGRYVDMiOVJysBDK9MyW7eJXZGVvo44iStU/gz5UimbqBm8s4qq2K59aTvZYYJbnOsA+qw1UPun+B/ThyKj46Zp6GiKSs6w+3WoD0GUwcWmiIdKdaqQ9eDrBa5SSXkhAllejanVVMkBE3n6J8ZaYtZM7FWm18XhDVGVklcz/wGw95Vb6XRa/ZRaITF+dLjImE0p54pfxTCgg6XmyCEDkArta2Q3WVtNi7MvNny2ySASuvetPDEItp3eemyob1WICu5jWlEnf7ViS2axgZtl9GC7ayLNha3OGTCSKrDYwluQ/5Z2i/EdQHdsNDiE9R1BDr1Fcg+UTx/GVag+EASNVzbY0iKifnofj8PClUmw6FeO2lnbyuBG2AMm+oIW2VgHOxyvwUluysEM6ZP7/npPxWGB6/3+YrIPnPyG87w2PhuK9aPfN8qwvCjmE66/fuQghR/mgDbgOBQRkKIdDykb3fi4/GPEwxOY//TnLfKtcn45PWcXztwfeTq8uN/c1mMk49hYTopMTXPvwbyc1kPP6/JyX1of2A0xh80XSLSi19tt0ZQSon5KiXSAfMShc/4loh4gj/dpzyR3ZNmz96atUvFCvE1c21+S9aCtjFjQyvym52HovM0jPpwTm/sYG4zC170BurPB2hLX/4I/2a3/BPN5rxVGzFb84+df9WUs4arKpJw7VHfyfZuPVe079Iieavv5pqJFbWm3zpNb8T/+2kv59C4lvG36fHuDf/669Z9S57fkwMClqrgTtlseFnbQVKnFoGdEYBC3vWtp8zuWdPsyFUPpgZ9XC29rJbkVW96pNcIbfHiPyOWLVztvVq1kIeT5rRyaVLav4ObvkZzfPVaPFlq154QgN41mKdB+6by6aszTpni66qzcrx/GkNyCrHChEnZw4ZVutuhbpnjdjNrLsVCmrtTIy4pRYsreVryKKWy8ZS84bSnPUziBo1TVmihce8gjT55fE1HtyTF2cG0NS+mbNQVvacSTIWcyDH3w7kmOHB7IThAU/BMRtrlmwvU1DDYpS3aeQxhYd8lUXiLQntQUzMZC4ZDnM2w6y1sNy8jbA8Dalkc4X0npgKc/bA8kWeTUOnZHOlPTH9NW//C49oysLjUdZs3pODirT4xYOxWR7LnrPqpQDPURJWO45ZMeJVrst71XIlMuhVpCTCM5BsTGTei3a5SIu2EatmuWiMi+Oatca4aGYKXr1Ii0+Fp4VFw0/Amci8Uy6DnFAFZrVgp6lSENNazrDSnAWlmU2kwnZaTjo7u0c027hdKIsFIx7X48G/7TIx8hrNjF1Dq1EOYoButDfJk5O0ZcRTpnOIYi0aFWb2i8xOrlzkYXlRaijYE8ZI6owUlWvlyFIRbRPNTBF5u5H9oXIhKwYOd8v1qrUOVLM5mgM1mIMs5+wEWfM+1jyPtNpZ2imVMY+dwR1rakd+uR15Tmzh7HDWcyLjOeUnfO6VC9ZyT01NMFk7OXtAsSfo2Mt2cOYN3ojdGiKk2J8plSMzNDROIkearZ0Za1PmiViJ4SwhkWFfx9RkjJyT5lkbTmu17+JSsTGaspir0rRLPov+ZCwQnbN/ZoaFVsgiAyyl2q6aV6FO7qxCasKmUi7s7WDYjBrLQ+0A1Kv05XTdzGRKaUafaKIEQwJczlUxvcrb2ylrXwRdJcZEciUybRoW1FPtn9ZztKpAwsnx5FH/Io/I65l/ORBY2OMDNTlSJ+qpcS8in5hQtMY/1FeDHWr8w1TyT8s12vQoLTZKDHfk1NwIIDXNB6iSFuMbuadvG+54igLFJgmW+zIK9SorEJnfYL+LqQ01rcEZLGYz0G54BVrIKAMpd8Rug7N/QSsTwBbPGrsQExegsmy1Tq550xfOUhYPDeclFx5mlqy9WlkjMIBiQIMWKUh0eOxdsiEmO/sUcwYj5Jw9Ol/mFc0o7dTzWc4weUv4WJVWejxg9Bxb8sCnimlrtWFmrKGKUWCpP7a199RaJ7mEZQcYZFIwG6BZBVpSeAanXsuWn5UiqwlFMfGKTEvpClJE5hGkl8TOAe0VaBOZFU0SeHNWCYwcn+dhfzWZISez9Zh9yvpiTgHPSLXLVQ62I2nKIcT8gyV2tNrAB3KuHuyKUeRzjMuX9t6eiLVyJSXn2JlSBRdheajVzo6cfXcn2T21/ycH1VOmXhJzGSgZz4WV1wRWZpe9fFhdCEa9pHheL1nrxHomXWSA5xyuupwdRxe4A+pyvlzOnKd43pzVV+lGz9xGRm55ED2mB815wJyW7+wZcy86ZD53trxG+nSN+AWinifFnx0Yn9VmL5euWq3VP05S3dVPbry3/+X8Icjr1H/FGzxc9ths4qXNxuZGM6WKsGLO2Fo9puHNvBgEozU3axuMJpNk+u3QaGFV4jyxVnxN4OdlV4F1OUXW2IgvXaw3kbtqSsao8ek3aLfcbzapltrtncd7dgMyEX7ei99d+57od1Lx8dK5cqeH+1F8ffXxpqg8Pvzr37EnnFTJXk+12HMsC8eJ3nGqlccM7VEEP1xhmeHKkHVcUe1JGgN3Z6FQ8cZjv9GMyZFefbquB1X0kIqebFsRlc/Y/FHMiZ4Nk5OXEPrd4Sn8tw3PVQyG1DF0R6i6x+7swuKpCjladTjtwTm3Zyz0qHA4MZFW6zg6NCx63Dxx0e/aI3UzC+xY8VEF7Xx2fuJdZyais8YB6inHuaZc1s6Oc2lPL5z6DM5EbfYrTiL3hi179Gs87PMssuq+NjCg6LFj+aapZ0T1uNBJ6xWX9ycYsJ9wankQyMm+QMLzgxwdd1g4PTY0nw3xXq/7MtBzp3quoTdESXr+tIUfP5MtnkKlExq1C2BPMMjJ1IEcTp0SD94+/tziMcWg947jqW8dhx53g1ez06dDVX2YHT/F74RNDstadCgBe3R64s6xzU5QLxxN1WNMclihr2qTerJt7pT1pfMICsuGijv8xkO+04FFiqlsD8OTfrdnEHUda49nR6cP3HFXOZcox+Ywcbr6HQl1i87Qcc8H8ycEFiM3TMBYTFWgZ4rhPJ0YxfFwa6RJzuP2oCZC2mhnYAESb3kzpv+xZVEjv3v3zf/310g7loQkXU33q+l+Nd3/Sk53e4qZokfDP12yxnEw///fv2a3v64m/tXEv5r4f1UnPsX65cZHWInEsBShdSdM/ptcNcxk/5guOEAYZGIlqIUZf/PZjEBckYArEnBFAv68SADn5C1aQfO3xMaBoWGkyFabKcRS0YFe2m7i/sUG93z8FM3gvP++bG7Q9pPYgJKDvvvvG57wXafZJ/ibF2vxe683UmI9Z24jYbUpH8eQY9PcbFy/1oytLt/iRWK/L2d8G/t6utfcvm0P+DaTfyaf2DogUylXzaCx8mfWHoP5M/N3+IX0M0m2NG/CYeWSCYeFV9Qk1A+T63r4UwynAaKvZ0B/L/mP5dEK0jmbKTz+2du8+Y/32YoMt3z+l3/xq79+04RnqeWD//76o8edjc3gRevw10FGv1y6/fl4Ev9s45/k/91/+G/8yb/19z98Uv3T/7he+o/+aXprd/jv/ek/aMpB04bv+8nUx//pyYP330NMZOLu95ON1faLzh88/Hg9mI//jeS/M/9RsuE3PvKbS7H/7r9hdt9PYsZ/MX11/isvaaaIh+JBl+K/kry5uqIXsaFnDi8Zudia9VFCO0jH/ofJxvsbLzrB8oqf8JP/Yr9pT3FzG+jf/qUZpVbqSroV8jNzLExdE8zjHhHoYgukI8VAZxiE1zjpCQxuT2LX7OOYoC1ID2PhMlHs2uz1oHMNhNmme1dSsdx1PFY7I70gDGPXJictqm1cG46viXkhSXJtMoyltF40QfUVdeoHUvgCA3pnDSXj+WzfmaGkMuJeo3keAqHNQzOU3FvainFwFOUYnV1kUNKQz4WXjs7HrO2QpV+e2Seb0r4TVdCs/ZtjDgLiaFnlmrCIFtiA5AaiamMmRuiiNQEjozog8TkMwCY68HqgZofBIKB2z2HAN+FNTgPQoEOUiDEiN6QqAF+b8cTh6Fy6wwTd45PJyRyf066RYzDUVz231opael/hEdKqFRq1XzQdM4J1hcPD4yDdx91XKN4yOHIynqcQI1V6rWHQ6lxTnjWk5TPkTqNqYtFGLRqBOPe7nQ6NUp0btBdFWN7DV9CTfJ3sh6xlZJzehOFxH2fuyJkwoyfsggYwOspaxFQRmEaXhrDC7hlh2jSbBOB8E3kGXJ2QbUSsY9wR3jE95rPxVFgIx5R+qAaS5tnJNLAchNaS5rnB6QntKy2yAcGV33W4QsPwz6+JAm91ZwvI30NPi/06IMuo52yKOFGpHcjxrwnVexzME3FzphNpP6M9Pey2ry0kXoiRVyTmKAhccnTQSRS/8NrCG+eiHq3iVYA5j+mWoW08iHkuvN06wbQ5CbqTKOpJ0IPAY6Q4ae0xpAfquh3L2ThbtpNqXnZ7Q31AyNbFgqyJijVdiYbHKJvIJuiLfouTaMA8EBpxwoUGKE+tehCr3sziip3nRk/0m5CJAu0cC89VZDGGxdmYxeeXnkmNbED7UM4QC6hY8TtkHkux9fh//p/9s1//LtnJTnKpcRGXi0aFul33OxTczVLjxu3/4kXTRd6d3fhpfH9V7G5GZhZ4M+p7Sb4RpV97K/1a0qaay/UrUv168uOPVVspLmsKfqvhgkI++uk6gZ+8scyRbYf/2yrc7OxUeddfTvVr3FWbXia6UFB1K5y+hLt4qcyrh9KVXb1hRy+OnH13L5snB5V0bdeDL2bUc17NRshVL3q7C7+Yl2iiWu6/oHpBWT7/am68IuBpbu7zqBjlX8hNbalH5pml9MjwcW3XimorznbuakP6UC6/qVTrND+uRupr5ZiuudjVC2nd1Xu8XqRcyDJZjyKZf2gN1tul3YWs5n4T8XfU3q8abEHwrHEn8UjMaDHq0aJsicAd01hLPGpS5JhJZ5dMa/HNWNJfvrgbf20aG9ebX9JyqFqOcTKnyJoUlOLfS66vm0ZqdZ1GGUW6bIpxRd+zlhcRuvtwMXxvrTsz2HGTCyRru1GtukASA64liX3LMQC+2FXZX0ak2FJJYpHrL/tJI8Zj+IbRvGWTuw9Uj9Tq7j76g+Rja/IlOb/IvbeWFpS87iQ6YOr8Ztg719dzhgHRiDtv/hMnflkde/V2Chao8iwKgzxvAqHhU7G06cwGWBVl9RZS5AZikzM9Pg71YAtPNh4H6q5lnZ+WZbYN2BpI6G7W+XNJ7mZREYHuZZ3vYqxmuMCIexKMB1jSqbdNmVsPvLd6Ho0ZoV48rkXdwlJWjmSZSpemKHotMU5FvT8xSOg9LdIUSVtsyiHAA1iTNK3WtaNgZkh1yCi4Tc1DF+AhCzkqPh/xTGxFuhgJaRo5mKt6odJpQk1nEvoC/j3614V/9+7+dnK/8fhGM8LB+Fch5AeX6vjBv7Y6PnjzL3/VfU62+w5q2kw+CSOSRoLfykdsBrsLpm8s2LkWWqO7yBBijgctMcYLkfAIkm5ftoRElnmH8WfZ4YGz9uBgIsC9uxZ4SN8KOAet05bs+hxYoQ/QuZgsE2N7FIFEPTXaFgonB7qPRDCg0q5CPKUhUFeNTLrLuoN2Tw3yvW2AWjeJrB1qzdVK0rJbRGltcZ8I1bPbRHPbQ10K3pFhYLfZ0yP6240d6QH40gHwH9xXn/0gezkzI66ieD1nn1p2dXTjSnZ1RpOxcXRubg/nq/dqjnkqiGaeuu5UkTZ0rLq8YWTIWndsMLTcg+l+wX2paMuG3oFaS3UhyUSNmkU2rwMMmJoM1r0azPEDXRMsWsLGUIjf7YjH5pqp66ep66ip66mp7arpgJLzdGAr+Y6NnFc8zydyOtEMr7gr1mPO1LluzYrRLbcpK7FXWH6F5X9FsTyWMlcofoXif6VRXBbF9+7Fk9UbanvRv9a8uBNfe/A65i85u/F+zF/jzSz6CSL+M68a7r/5b6MdwqspdTWl/pJOKbkwQS19KvILo4BctC5oXl3QTtVWxZyyqQhPscb+Rxevb9z2w2Z0n0wU4T5iNz66aNpp+uGbf/nLizqvDpEFuWzHudbblcsV67qaZ3+55xlZFzcBb7xtO3c90vIgb+FuoiY5uJTmy1kizMyteXvF/2p9kncV9FU7GI9+Zub48H+zN6Po935VJNFZuqglMqcdIlN2NmnsXFnU5nj3rVDz1/K8U61ipjIR3fU0u8FpOorUEtztTQ5V5m9q4kUyQi7/D7sFXkoXyjsH7v696OwhryJLF6J4nryT+9e387zOMH1gj1LJrcHujne4B5W6PRwxf187gLWnaxF89+kHD0whlz3YqucLtXxJbgu3tyrrbbcHWi0XsrXh6ZqDSr50IMe9vD0v9/xAjsm4QzByE64274vkJm/vefwYTmIzUkqINoxT619i4HmJnmwdv2/23Z5yZIscv4Pgc3PY5bl4ehgt0U4ZThhPujEmcKaGygHa72g3/pY70DvtdIdmy/PyWbMFAnMcGHs+PgMCO6ShoFyFxwtz4ag3HLecX9uumRxvWuJVIQ6wb7qgtWXrgvVsxUQmD/Jl8TzVQtnucju1ZXYqVc/seEX+ttgk+DZTQGIxigA6mJ7XbommD0EtCtDTITeHeekPAgd4YnYnk5HNJF9xNn7yVZIsmiw9pKmYCLB2UbkvWuiCbHYyY1QRRGchdJC/mzHFVrd3ODwzxSHvahJ37u2K7kBX1Da9qaKHTXV4OJw4y6sSKA5lp5c3yeaNDILXPgnIIWjiZNxt9awpGfGGxhseTU7VupY8mwQjKvh4eicCB6XGa6Xq3pbYSnrW3e6KY9tP0OZHkCPyjJYj9qYDmwKQTSD3hHU6YoQzkI/xA9rU4I7yHEibi72p3l5jI903QQ3r7vMcvPBGeBqMZbBakwnv+FFP0EBBMRkwnvKOMgnzdjIIImGb3WxarzAGwkepAXCsqgGHNCZqNefo0vJaYO8wQ0+rD7xQYATqGNh7idh/CvAztb27QWO0GZhh/GVAWHmpiWyv06cNqUO7t27AjQcv1XVmAA71WwPNyR8HxN622BCJgPoTBarBsWl3x200COLIOY06SBEuoAW0pXhxvfaYWgxtCACQyHrDUC9PAYfR99SShL3VwvlBx96dRXtb7SFFsymvZpsVNwvbEkVFJSNi3nQc8sIt2jmsjLtyB5y9+611XuxiXFSJgF+1ZUjVm42jXA9HY1ytjoO1kE43dBXlDUuSqfq06I38xq3TrWJF/Iw2EuJbm9ZraIdR7lgRHcSOHXFAHGd4C+OJsBYYnHVpIoyqG0/l/pKjbk9UEzvi1EUt4ag3DU/MMZp/2jrPV1R3I5iknTIdpj3YJGKEXtGfTiZ6g2JGdConGTDlLi9rCSb5Yi5PH9SGnrVHNA4ZKAd9Gw28qPMaPoBVveEEkNiJ6nGii0kqxgyllYAimmctlyHqeUZwjeCeBenKXDsRdRZzAneLYsEJ1Tq6fb0Bxg4TFX3U0H+WF7V0w5l5jG6oJrBEWSUkEsMlUUWVuyF6Eqz8ZXDuogBWIYe3LCxUVgb/5WB4KEAvOJrUhlWplMjSdLaHtMlvTaH01OaWeuWBfFk7GYoqTKujhFaET4wPXpJG9VttR+tpV47qWKrG2Toz9r6bdEQ9+oK31H5AEYYWu/ovO13eLIUWh95EbhskqIhD3dwgO9Z7/CRQhHxuQdduCUQtF7tag2F6RrsGwy0hFPCVOgyGGZ1bg2HW4v9guN2VpPnZuAyGhbe6YTAEYgxfsoQah2s4sEbqBBLLSfaOOjil4EyNUXFNcUTdKLmjwn5Q1cC2LHoEzA8sYGfVqCXt5VIkCF6aUXegAdRXciVQDHq0FToakj6IWxvyPryuXr3FItWMsxErVFzUyKVzcCkKkMM50imRC4HewNgbX5yvBo1HU9poGaiCk1hLsp6YMhJ2T4d2QsFeVSlFYrZ6cp0jrcjK1BUQOBTOIKUFDO4IwSX0yRCyAOju3FsuylP5dj7q+UJoz6jNIKC8Fww46Aw7q6cCEyVHJxxNBkvBBILxS61S1bbH64lNVDUxNNabAR04qzGNDXJ5QfM9DPNqszZXhYKazk+LqK4WCC1QUjUgDVT0DjTBY3uR0TY12pyaMikLio3eOeUdCBHNGLOltWEBM92M+5xaY4o/EceJQjrBxtMBf5eILGK8k6DXc5h6Kfx2atVpg5QY9Z7OPTu9pDYLMUqDQuJ1CDaRFqlFwKxyKvZCpdUdX44LJcIOgoDnYXAGiGKaaiSElkXQ707UoBovhKCp0GxXrduGwjSIDjQSX/LEg2AsMwzw5ckRCg+RR45p0H78KFCghpkuZqcIW1W88KR7NMkP1C9LhJqopqaf7AaY8HNd+48nBa7kQGzoCCREJpweQpwvUtDUhRx5AFYgeiGijqDeb0XsnVjzVmYyHdjhlQWhqovnq3LfXYQILqAJX0XC/KloPtg162m3Q81ASSKuzGCBdHoK+IlXLink5pUG5mUUianubFkA3SYbUrpKmtP+4j1Jl3S7nF7X7eTHXI1Ft2HoVaREz6AnSohWzeladFP1Lc3yVnRRtW5Y/ECuFtZ7hQdNc+NGzF5wvvajBRXzizvx+6+pZy5q5r+f9E3DP/24ueKb5JyOwpv/0anapAt52l8q0HhMuppLwymatCfaWOlarWoyJZPhcpXO2gPx7t0VK0bowExFbAaZbGYLvyx/ZTp1ONtZcQjm8fuUPwae8QegZHI0RULzO9bOTpYGaugzuoTlR65Uq+6ZHF7LPRfjMeqlPbueVws6YjvHbJfm7NtsFdJ0CnSwZszVnGkbmqNxdmgyW6L+linUs7ROsF02olxWyOBlOAU6ninUytUdU0xnqmVDa/dF1rUoZn1K5e0K7aDQIgk67GnuoVgfMZ+WxLJIuVTYo/0QxMxMgoj/kDYPvJoY+OCmAC111GR7wDNeyajlC6++hQXbbr24pe5zQxPhz1i82HMQNIxGdGgRaGnxxjCgRMr4g1hML7RSbe7oYqg7iUcHzWV3vZSJAOqtyQsrcmSCSVebK6I+5zSAXqjSfeNu4lHzgPpwl3TwV96tg2/8wzuswVGneWDOYpF6nXk/Au2M+APFz7EPEVAuUYuH5/3DYS9+P/l40zx+bDY3Z7shG9cfb8qlbHJl93s3U++b/abRhq6sJzkR9m9el0vTeVmxbs62BpP4mz+l5Yd9KuF8ZN7XswD+kh7k3qK1IzoYYk+AA5ktOReo7mQi6KlCmWLWPqVhr0KO6ChgmrtAVX1kDQ0JXM2J3SANWJM7Aj/NVT1BylmIE65coAol5qg1LCYGxA6elatZMXHmmexW3Tuwhl0OCKezWaCn57bGPFW+zOa8J7VyxaU0WRqdotGZbN6rFNKYdfV81uxkiy4BwAOaUTI7pXIxd/Akt8cNtAOaIauWC5diK3y3snOQ3sEUPpBmiCUpz+wC7907hMUMlANoxUUCCtCizG7Zq4lNGQK0wYIp7FFZtZYuZWjoaUuMO81ZeMpELSYo0/hAzVNtOws9iCnm0l7dGpdjsFzCNASxASzF0bdGkgBW0pVclUAtV8hVdqn2ygBtqqHWnlqBI0T7Sc6CVHlHc/IOZNQ8EpFdaUIxnS+IJTlAJRDQcnVPR6VUPgCibFXzWbSkXMhWnmVJYHLVqthbwtQvV7fyNSBK5kmuRoRCrzBHqaD0muRTyVdy1s5OhWNR8dbwu4vfPfzuG+ZbRdHloqjo7llLQR5NBUFUeI4hy9eceSDnS0EOs1DxNO3keLs5dLG4Mk28XRpI8zgp6rVdqaiY6zFEJyAAtzsPck/R7V4UjEbTRXBUHewqIZZxVD8YOT231gJre+Z5VrBwO7/DGeZpWDV/DyyWSxwZ1SzFjhhKq0axEglsqB+AmG/nn0u4Wi9xjKPnXi5diwAdMQ1pn8yX5uJY17ngW+9IpzLiaa2EQqwNsKqnysru7EH8zT/kHbq3rujSFV26oktXdOkvli7NyNIPIDuBKi05/R4Ib/jjeuW7SfsAwtfjpPt85S/7y+6rlnzfmpPgKLkl33u8aY/cNlJfruupWuYCwREZp0zcfCRxkrnZf4HoW+bFLTnYKoc/blz4PpZQNyHm9Vjykn/ovlBSh6EhF94upTas/pL1YrGUPQjSm52Kvc0PwC69JHYGQJhwlu6OVaM4kpU5j1/HrC0APbjTRcnMWO5hPuwFvN33bYnz1ErOp1ZbYyW1sfDS/XspvoasEhdr8buvmfp0ZV3OmcRSl19voGDemzufA4/SyJo1JXYK7loR3/ekr+aNpH2w9tvo4c68oHwrud5IbKRWmhiZ61SWv3kzZd57D+Oy7+9jXOJygPafiB21iyv5+YpPXfGpKz717ZGfn+vN6I3WYTvIHQ3Gk1e+f6NpyqnGncSHTbHqYOp2CyKd2G5ePHxtpvPh+6/N2XyYJJjKOw+jjbvHzdjjx4mUHCslGfZDp/MqGzEpf2D8ccy/K/p3H9z5+J0v6paivH73KzK4Jxnc/6BsTzv6zSV3NXxMTxbpa4YssrEfA4WPAeYG5VLMvGjsv2iuvNDTRi9u8ayRrdDva363uHV0u7F/u7l8W578Xaw73A6jz0Or9sCSGrK4/+DNP5KlSeqK5l/R/Cuaf0Xzvy1rkx8KUZotTVKyNCHJuh/jVgrJ74xA8sBCM0bIUkhJ+fB3mfKisf8aiV5L1KPvJ0lMKXybxs3U8vWPQUQp+5b/5rt2kvn1p9MxLW7UD2l+gvZKJgm5dVogqozA7054D1Yr5AXOosTUPw8/F5NO05Fpnb40h61QFWQPeZPvYRv/Vgfv8NgcftEd3TVUsG23xsdDqnGa9lGnG7407ZPj8QjuS6fuc0IjK+0TftRryy3Rpv0ynPad4lB/RGNg0/5AbIGJwtCQN7q0ET8eDsSZtA5NOxz1qF89HaPQ6cTarmgbNFY0K9qiPnqI/KlLNDKdI9PpHqlzj7o9hh968RPrHDT/MpbmwUegH4RIMJQbOtVL2JqYztTQ/MXIBGLXKhi8MsHkZEKt1uBsxI+o8OQJNcGPOkd6Glt74+gY/3xZzGWoNk+fCty9jnEJeW/mUdhG4gnS8ZujOeYIHKO5x7Q1Q+0b5iFGxzi6AnSCngLsXwFoh2N6mOi7rj/GKJmTVm9ieCutOaGlslC+gIuexom9t9ec8HNqFy+9Mt2O6R7Z17tH8iW2ewSMiNTLqXDYM8j3s9arlvlseBiqubKXVA2hw8c0HmREn6Q3EF2YCVVijqUw2gQZTjRmiASjNn5j/qh1oV7H+p/T75seMguHR6Z3Pjgz/dZL6tMMTL9t+p1Wp2+i9lo1mZfB3aMQ3lH3aEiPcBfv0x+gr/ovw1Pq3vRp/2dMBZqQJ6anKL7PYUW6yZg68Qi/MoPWYGgGbTMIJtRANwOe+h9QDaZDDZcTdM5gOOkenSf4pd0MRn0zCHtyFbIZjlTRxQ4ilcROxaPKfGtygllClZVjM5LuG/Hl0bDD1qkXIeFoOMKLY9U5abdGChAXMeqjaXiCp6/M51P0rLqiwWfBSc/wPP8Y022MaTWWWUL1CbnGeKzTHB5bNg5eGXS5VYtAfcaSKMR7oar3hTKt9Ov+AJXs9gB8bpwxtZBYDIoRUhlCaxGeTI/mvuz3qBIZWrRQM3EytUO+xS4Ww4T8so//ztCQWITTcCS2sTByVDWQOp2HbBoaiF+XwNhMMJfUVJwz9oMxmAyn1O+mhTjkO6YtPDORgieTczPVoZ/qaYCBndPTQfdzOpMQLntuOqDhN3icVKoukOB0AywFct5ybtLn1KTPmUkfeYDatokx02kwEOCVedUevTw2r9jRr7r47/NMAfrgVV96QY6nnIp+/GnbnJJui1WibkjddMaeDPlr9btW++CsRZMTZ53jhGDdeWsMJwjNFxhaNJQV/wL5f3FONV3alrllGjFlH7KHNn43PxFFfdHIH1Afv3tkD6uE6Pij7qJSvurjW6OAYojJ2VPieYi3i3zz6Je+gov5q2bd2lA6FMNZ1r6k2GIj66FWcltO64j+zcLBGypzBbwcMdBbzeS4jtyXNm8FEl06pBLbCTkc0HUEwuUMWoFMEX36rZFQbpluR2Z0Oqe7pccbCA1pwWJ2tEDVWXiyhVaI9DZPmjZ0lqfInuRoEB2mn6qdx2mfWixARGn1lLervd1l8yc23t1zaviLBq3e0eG/l/S33vc7lFxmm22fJv1O6vGm2fSN8Vc2zEZj48umvXXhceNxgptweKmZ2tw0foclvZ+SAhvv8xKG9xub7/MuBiQyTe7L3f/whhOG3Eaqv4oBbVy8bvjNj3zeCBa/bbcXudSzRm3MHQmtxpvOgB5R5B5RpOEn1pvWmiqv9L2O3+OGf+on3rv5UTK1/vH7Gyu34qvXv1y+LXZsmiubRhbgiS/SiR/7nURz+XosdfmFVUlOtQOmvfZrzZXG8vtNLHJDMYUT5xNzOcol/XlXAX+SL9KYzabAokAxvxrXBL6nVkTkuX/XBlawIEeH2ZOub/4Rz9vpkn/dT8QbF6KcMZfvX/FOjFnlExTqn925k4DzEL8AwNrR9Rs333v/9nIcWLWZ+hjlvLgwr/2zD4/w9OF9/B4AeHTkTzsP+eq0c3SEAJxA3KMmT8Qkmu/OPC6N/Ca5xWx36Lhcb9xcb8Z+Xnmbr+iCn6KWsWXjtMLmTYrdMNF+zVzsbWe9TL5GnMdboEi9IP4jmsUR5aDYe6sryX5vXjvmv5Spruj6CzPbhdt1Lu6/ToAud1LqMqtJDWimE55RTHT3tbpLkeXROcz5MQ9nNd3rmhDZk/ra7BGhrpnLMUo7y1QqteHyvWXihjtxr6WBMsTcPEzdjMU4fmqgL/7mwS/q4C0y3K/Ta91FtL/7i9pzcibzy5+y10q/qL32DWnw15vG55C0Pv9F7VH5qg3/zlnD76iC6J2hfKpRRdNFU89zxrCd0UVEdgdHcAetQeyb4HO8lvx5N02UEy73IyL/KJlIJCAMKt9PxM1mqilyub+Kp38ruc/H+N2SM+K+Z+06AIgtJ+PnLdT2g7sf8qO+KDFoY9B/eAUyy2rMfT3SBy5Wv/bc+zvJ/U3pARrE20SG/QUNgJSo92KJ8OKFoPELRWIErr+IxVZevJBtUhVzX8hXKMPAi2aMLfvw7ps/AeruL/km9VPnwxfNT/12bEXLZgYDiU3JXSzOah+eCkqspxIX9+Kv11MOQXzzjniXW5SVyAjf2sbFlm9xpfbB/d9OYgUZNQUj8399qwflZx0VbfUHuz8L8s4Y2od3/2ly/9vbWSQLHzx488ecaN/eWv6MI/otn2a84uGDD1/Ydb0/sMcskFoj5BUb59pzjboE/iS2unIp64VnseW5wxYfYta+ePFidXmBBLnvWlabzcXvI+UtWQiQh/A9ZMeJ8StJwHI7A5M47iDJk30yhYd/K7kBzgWes0LkepCkatilGiIBnytLZbtY1Nyk+eDRd5P7N1fMTcnih9QPBHu9eXll+eDOB/bRUmM5oettYUX+3RgNJetSVZsxz5fuuLeQfhncnkdVIFixNnx99a0XfhddcD3lN7h8B+dmP3ycXHI2WFdVD6Lp5DWNuS0xt41+IpSomET5OuuQZ4M3f1xf120+RF0kWYiW4Te1LYJ93orYgtFcNpnLymbU2pWfoSKUK6bjXvzB2t9M7l8X+1FL+19+mXJowR5cEwXA+IO7v5LEExEjlvZX51Ks2gT3fxUCykHTpoh6i3noNuWDB3+XD5oy5qnFBJrH35bn/pLsk8S0p993ewsrsbeayVdj+iqxZHWhWq5eD7+bpMqoOTjgF9a/+UvRDlp0wMnXc3IEDw8OZEZdP4hFhUH6HvjjplnE4utWVoqZb/xGbOUA/wf+oeiy6tv+8tcv8Kd4B2SIhBHFqfD24NG/uie+eUf8ND3BrpCe+Gn64afsCe0L2xMf+D+hG5Y4G7SML79JEXdt5vc+cRpWar7/xYxRMBQFYssvlJvMcxJlL8yIX5fi//VPqCcph+2K5jepp+h9LdnpRpLya6Aob82zWIraDWCuP20pMdsdH97gbAZxAJFuzFOZ5uYtTfLh3Yvk4+vZcoYKGsJsN2/c5oLJ3EB1miRtqlemjLkhSR7fuP2OFCSa168nEjHz+DoXLkgIYs8VTIJ3siXgLvu6cttMdln2HZTtJ1N6nQM7ZdNPbtx6/J41h7ekayQbbyOXN3RRfblwJrt9Y1OSgbGEm8RYBZOb0i2qL55E4Sx77TeSL1apMUJrY/F4cuEg5JyfwCIRTEuXuyk5RgwJ/YKHElN+UhVM4qSjF9flJrn5Xn4tJDG64/pkAka39kd4m8tVhmK3LEtHPmTnH95LfL2s2mEYf/jwgz+0eSH4Vlb3v2atPgvjj+48/JHN6bO3M/pg5etl1IfQc9fl0++8lc+Dr1khvQrcNQ2ht3L6cPVr5sTv5/EP1lylwpO3snr4KPnPVpeNf7HuhKt1H+LcRWT79LXZT1w8eO3e41v269D3klK+n0qtzx3q1aPd0ZNUbE696Y+S6289m32K/NXkTb1N5M13ZuZRe7MrBcN2t0ujSWMzO5seQYXWYdDjV97W+JyXCtJ6kFj3sfdeySn2Q/kKLUo/XfnWzMRBfzQ5dxcg8Qqj6P4j2tKxNyDRegiVLGaW4+wdV9Yvj3OSgbMl5ywo6tV8Ie3EmJ5UsRe0Rla5BY57T66w0U/GXf10fEoDKmz7IDhG2WJsJbKFpi/ZK/v6wbjbNsNOh+bRqBIijnaImih5JWZJjrpn/AYtehrHtOVAZQX51ExzOdRlCOTisEGn1eNn+ujGvUNJND1iBnL/noTlZLP1Crb60Q1I8ml6OpB2TsWil70gDwnVOiQXCeZsoHbczBfBeBjzU7PbGt78+38jukQrNC0adaJzAjcM2uoyQCsN4p4Y0VnTW7Z6NPZoL08S9DnuUXNN1D9aY1oVPMaTMTUa5m6qZL6aLS1H0KH9LhYA5664JzMExBtAFFphiO7pGrRP+q0xTWUFkbYBtQzgjGhYg7Yo1GRh0O1Rn20Umb7qjiJrV7z4qT3sHxKFgL6fXbq/S+1boSfa47aRztC+kK7QnnAmrVAXdHoHSazmSAdIMAjmLr2kERW9wOlVVy+Y6nTFRMjcBKGujrWA1ukeUwdBrFzp7Wei03E6oNki0+G1XJ3pyLgLNHVmqa5KMAhpr0VU30L0RyC6FFO1WiXqFPZGTXpyqehRi6ZWQmrBvaLuG0fWXkLWwwCgZZiWch0ZFeHkMrJodrb6/ZY5bnfUuhWtPKqCxvloqNdsDtr4dQKx9NjBZOgOjrqi4QJgCIc2d2YXbopunpiSQlerksrgFZ991hrbuzaBuJjm0/EEM85da0ZNEJKU8GQSyHWcxyfO6pNqtVnTkjrbRQ1KLTpRYUftOmE4Bmq/iVpnztRqLyIN1soqKcO4rximNMIaq1QjSXJ5p7R21KLyGGom6mMDEA5LMWjyD/PU2hQLBZ6Kjt2oS9Ux/qYjNXXE6pIGAGC1ZrTF2TwK5w0adWhm9fMpierMipE1CmRtiogJHmuJx2mSqSEge63bqNdqR2Z6Zte8vWI9jFrJC+X2FxOhtLvBC9gv8yO6ZXT8ypK9E5Cvk7Golh3xTTEXMzixNmNeBqcDtiDsiUqa6pgxiSqaiUkZVCdg2olcYwp6OSK5nNHK/uymUpLJkL7oNIZAlgm1EMXKDOfshH1P87wWoH4Zr5cDSgs8I6pCLJw92S6qEBFaUZNy2mUkuq9oBS6ER3DcpX1T2pkFy+Ddpa+6wB1ro1RupgPhPaVikVUFi4hzd7Rwk87vJxObZmOTZyDX1+cuxHyUfLxuEuvm/zEfm5uGRycN1kzG5+5MwiTMe4aX0VCJx983X5oN89ggEx8c/w+V1Cuz7bfOD+2nUBE3TVI3nZZS77xRtLGyLHfiPN7flNXFqkDy2EFf/UzMh1grIrJB5BsIJSTvCek7d0ST65KGud7ckCOa17kjnby4H38dyVOpfX8t2Y9TkwzTjLtY/go6YEW2lP52cp8l8LMLxbR16l7/anJ/Xba3fwsPb71oGjpMjCULwcXL12YXr8XjD+/8WnL/trl9Sy5eky8p3NppUNFKLqfEIgN/PK0qWz/vzadZXUnhEZ8jNQI2zcO174tIGdN6xlcOErod8geo3Ubq+s33Pr7VNNe5nlh/LbrjqLZ/YSBxGm3GbzK8uoIIZnf3j6TQ27dTWKXLDmQE31LTJkuN2wdNJ7v6a/LWvd9BJlgtp2SpnbJd5y+7VMuS6n5V8n7xAslW9BgUD3b6t4BojS/30VVLojUWlfquVOhwPybq9bZCC8eF+NmTRT34XmTCyMXf0O9cfsP4zVsmLj2BccLqa+VWTO523UjOVoroaP/G7aZ5x6170ZBaX3r14Yc/ksYlgDurK9ICC94SdTf3bHnFHKyYjVmKKILpbumIr7oE3P9cMV8i2b7gpCTa4Bb8Bjey7dyy+mGs4SAWW12OXTrEpYnliuBH9zi+6NfLU0CePnxEtEzwIar+7jSP7sSZJoGaS7oDcTe+IvFaaabxwwbzrbX4B5K9+Ev6bVP2VmPcJTh71eUZCU7pa/qVdH6H9e4sO0X4puxsr1/cpSWqjz5StSN9z5rwSSWXluZOxMWW7Cah3W9e6Kl7q/ZA9F2qyei+4G+gu5NiyqfPq5T3pcDoFQ4Se9fIlwXzpbj+vnor9GK3zP6GNPba6orZ91d1U3+V1zYv7GY/uvsBSEtjf113dViza6sylNf8hTIRGVuOpdjDk9Zx/HjWJ0Te635D8BWIe+vyBZPR5ZLGoXmDiO6im8bFyLsuVrb3H36IuX/bIdL8mCD+8bvi7wsyZ9J1OdKllrDSvCGxXMuZWr5inqWrpXxpJ7aOFx2LmtMQe5zyO8ubydlI/lbyMbBkMzLO5NtLDIAFjkovg6YtWb0/bgYt/7TT+eGb+C9/Z8ZCLKJs/aTs3upim13K7ZJeV4XXawfI9GBeVWPlEh6+O1FsWfY/t2QDEFmtrqQuvYcY0L/b/hZTReU19l/wYgYjn/NjK43bL5qSAoR8eeVmMzarmH9PTMvdu3Rt6Luq91VJ0eJ7/pZys5/QV/cX+ur+Ql8tHRwIGxErDv5KCuR/xiO+qtX+B0aOTunc4U5IxDbfmXyelb4rAZWdlRt9VQ6WCenHr4cf/CApH04ypmpqRR7+iq4O/17y/ZspUS35gkd5H77+iCbHaM3CXIv5kDMu0bg3/+FMeXf/QvdPL8Dhdev6gt13Yfux8XpdP2ft37idXIrp1iq5WmM52ZSrBZNOWbhhB+mrbxtcmv8+hDGLrgdUDsug47I8mFufnjVVYcaeUX74Onabm+1LVxX6S1chIZjcXYzF5n9khuvr0bQCyr8WnvjogzcbPz2Sfp2rL38uLbvU01fl/vmV+00R6MM3vyKHf1CZQXCq14gomf04pUYgZ7cTCUrJtxN3DclHG2rARywv/rzibRN4d8rCLxWzSgC2d92k/XqhKFfpjQVHvmOt3Vl7c8xt828fUbiq0F+6Cn3FNFymPEJU+/3k4/cSCbdMSyTegzTdCke8B/4nf25dW7tn/sK+t67duXtEu1e6EzgcO/tYupKKNWMxO92smBvFm7mJ6Ms9gVHXODtbMTk2ZTOO/73kx2KFS9766MIPKblqjshwNk4iDn7lfcq3vyLN7SgNRktWdh+Z6Fp4HaF7f18WHRev0RTIyOJLZS5ef3Tj9kL7wHV/vhWa3VDf4y3yS/uPsZbM0ADDDClSghWKF90ea3z/WnIuXfT5kWko567d+eA3k7MbtJE+SC49DifnvQAoRHVg0uNZBorwQBqqHFxHJjFBhibVoK+/XSHpxo3HflJy3GSlBGEefMJSZCeZOj7L4+mgNdlo3L7RTMlGslxwpeXPDN9IPvKOZCQzA5NmDV0hH+8bso5B53MlE4tFV37LjoHsFvDzNpr4W8mN+SZ/qModMn5srtQ19s1UAmxvP/xDzGC8lWrc2njv5jpNcN99bTiNuRXw5p9fWrT6tz42H/u3RCPqxg0zM9cDWc1cLSeuKvQXvpyQki5uRLahHj14U3RI/DGx2L/l6vQ1kfYXQdz+RSv3myLUjYsZQj18853viUqCri/mbiGVKzfl6/CRfqVsU7fB3Xh6GBNW+y1dk9jafpuraA+R/ZxXTWoIQ9v9jkbH3B21S+7b4yzn+FLs8SaNEPx59MM37J9v0Blfv2uW5HOhdHucfcAtVZHH47/I7aelLXkG0vT1CYCqJc1UkcJ2MOjIzaZigEZvED7kdXPRE+qyqBDNYk7NLRQreiy94WHLGmxicdRT6U405UcxVUOhzgk1KIZHTldM1UBUCYR39KAs2hLibYtW5yLSjKAFm35r0OItYPL522ltYaaIioCWdRHjXYqqpEPTKtRoescVykH7pbuY7x23s6LM45beZazKQnKn0NzFxbMbi3lra/cs6KiZmCFKQv5zlxbrG6J3x5eohhcaUQG8dBmxVYixFxBPJ3OXEPNSyPAn3UUcWWg5mllpafUW7htuv0Rdh+3o6mF3J6xeKDx3hzCSTweug6aDsHUUvHUjsLsMWNQz3B0+sW/v5paW769qJb6ddYwtx2Z18MV6aeqdc33ZtoY6z8bNdb2EWK4dpmZpJ2h3+xiqxZu47e3aYoeMVwcPD8XiWyjv2XuqVa+SN0ObqSSa6gNR0+G9wVdU5Yqq/OukKuZbO2P/nGQ/mdLug4Fu39mmxiP6dSXyXYl8VyLfFXH+iybOVyLflch3RVWuqMrPX+R7SwRy3+7wTIeqcfFRk5r+t2KqbvHozf/5G3OnuEP/dDOWasr1Qo3ZZpke2wrDoH+Ihup4HLFg0w8mJ7NzLNJXxp0cdL3BdumuqW7ApZwsdsWBr+bKFQf+y8iBbTW/fR8Yryr0l65CX62aFM2H+TX8FdO4YhpXTOOKafxVJolXFfqZmEaksdh0qtR3Ysl/pUqd6Fmu3TlJArOvvxfzk6mGGuqxdnpWGvN2e2jtbgnZqBUjqz03d3hMDo7NZR7j0aCZtZ61tbU/VoW9j7Veabe6yoBcj4c9k+fhdx49Dglya6HIK2LGSFvjgiplytPJaDrJyCVOFZqtqIyDV93hNGSAaUw1cHYeqsFxl2/jtfeofkmlwN+zFVhddmqCa2t3fxuRcxF3Hr35n3/J2u1IZzMmXcqatFcwW5kMfp7Zyn1qtvI1s1XMm61SzmxV8Kz6xGw9xfOnnskUMvhl8cvj99RkihWTqTzHb89kcxn8nuO3Z3LlqsmXMvg9x2/PfIJ0n3hVU8im8XuO354pIFwqV0y5mjaVXf4qplKAX6gY3kpXRR7VWh4/z3hbGV6Nhl8Wv7zxamn8nuO3Z2rp5/jB9+A/T+PnmdpeGtJC28oJPXPY5t1WYLDB5+aQUkK/a7C4NocjPKNBkFd4/io07V4bP+72dPF7pTdXjc7wO7dmOs7ww5oZXE9NVNAyxbn5DOk+C8em12nhd4bfuemFNPowgqjQMqMT/kZm1IPfGxlixBh5QHjALzThYdsaQuCNO13yPfzO8AOba53hBz+Ef9bCD0zwvLVw4v+PkjdT/i1r1xgT6/5rPO06q+3f5wHKs/NWUyKju3s/VjzgeU1yl6bJZqsKIDabNZWYhDgjOqZxJ3G3Cf9e484aTXDy4D/yXdUbia/F5iwM3UK+Y/vW2txLfCcq/M32X5/HQxSXzuafKUKWsnlgZRUYWYADdNuqYvzhAEGrxNQqUZXXLNIFxlZ3gKrVXT7Z5ZM8X8kzrlCmA4SuEqOrROmq4DSvlKzW+AbvlKwSv6tA8C0vh8RezWR4Y2FmC2i+VbVov2vRvmRYr0yB06Gm06DwY97/iGmAfyStIFnFy9kp4ZlcXrLL5TkPcoVKUSbIdrH+/7P3ZrGNLNuW2Ou2/foOb7i3u9+d3+06NSolUSxJVXWqdErFQ5GUxFucLpOsKl2SlYcSKYm3OOhwKEnnRB204QYaNmC4R9jf9odtuIHnDwM20D8NeEAD/vGXJ7Rh2F9tA4YbMDx8FbzX2hGZSUp17rnvNfrrVYmZEZGZkZEx7NixY++1Czz4eqwbvY135UscQAgW0hn5+fKrycCRP8sL3E88aRlkVpARjNFULL/A76VBxsxXsy3l9uxIk7+8KddrpiLRSl0qocpXVuWr5SeDDS90o4+jbicjw22HP8TyGIzSUP4OrleRVPXt2NzXsZmDp8IqPBQa1KafeyG/Xxm/kMtVjC/ller12eX4BX59Bz958GW6IqO4Zl5mq+ZVZl9HMHj+Tu/c4gR1ejKexzKW+3LoA8MHXuvGhzK0xxjjYwxy9SI0xlgfA/5nfIorp7jSwyM9pPVHOAgpGIMWjEEMxqQG8IQ3nuKJKZ4AZRgLaSDI0iEYcAIGHQqBOBxbgnFqCcbQoFxHfRCSqRKQ/hfACqKnuzO59UxuO5t0LTGR9U6P2XV7oCDd/tmApOUYCDI4TPQ4M3ob7yJ3fkSS028fAclGflMhOfLXcN0COfWF8IEIycoEv3Pi0jBTzZPoNCRQ8tcjF08cmZnUwJjvE/YcP6FReJsjWiRWh0dCpQ75Q6wHGiatNDnE9TGSxhNL0k6VpMGtWBfezCeK7tJ9K78vnKswKe8EcniLgM6PUKgWvAS+3KZy/bwzNhdHp19D+zYWaN9flat3QH5W8IxN/Ct4BHh6sbSf08r86Ivh28nptHdxuUAsE0n6lqeX+bvqEqlpGk2DQCOxIhzz64+2nz5LtbYBtvGdZGPJW6Wv+T+wLpA+Ue/xMBFQVFrPMVbkmsCBKaavMBVUblVeKrwhdjWlUP7ADXEgCcKZrH52c0vhSyIQ3T6ItEPIICjjzZsKkfHt5B0h3XckdJpspsj3peTTtrbxWduGHp+26fFppbEND+2JxjZ8RDWXG9vLcsZ6AXXxzGx7QDLBw401qYOvpAaMEnah5aVyTWiOThfvc99yJH82HdXGvYHZwdoyTzCnHY7ajCwReTx7idV8xi12HRtlz/Y2jeyOjmYTF9nrTmPBxUuVUTxWk6WxixaxfLdhHyhXsXC1fR5F3VPS9YrAzcqMe1NCwmW7WOju9zqd7pD3xBNe9oad0fnEZMfAUuIRJWXAx7J6Fx4ic8O3aaF3csr23uKEe+RUxDpfzr5GfRkXcqrTQZ3JAZ4Lh/TZmdmVNW5acdQQzACQzAWyvbGGCYk3H/Ox2wWXm0jKKvwYgjmAg2E5jYiUJk08PxebewpxADPZcA1Adjb8ojsGaBWjeeteEmFWugu4AlUBO+UCBcChaeTo8qg/F84RvkwTBrEMfAphEIpHR30AVmlC/DN8V1R66mRQSvy8e+kTXGtvBCq0BxHJHqRF6aOpCjY0Jq3FQIbYcAxmu+3wnlkPP9d5oyDadX80BepgfiDsvd9tj49OTX7Ys3UvIdaDnF8S7EkHCY87owsj5eMAKcgyQDOaMIz60tCLthDgAtDLit3hzBRlIdHVYRMFs+P2iUbt2GCYrVKcnOA95SG7l65Nst3D2YmsTQBFVulddPEZGcLhMWY/QvKZFruTiS5hFGVMzidjBKoKMCbrF/uhEuKHylk/tNolVl1VkcWqKiCqzvhLT3Dkh3OM4pCjtAshrSKE3OsZxiBFoNIXJtoNZ2n1HQjXtL4klmmfwV3lG211JGhLSTH5mHw8xW2sIf+s28XbpzIKcdK+g5C0S/gEbw1jpdlgLn/54BfA95KgfyQv6hfiV/3paNx1ZbKfwM451sBUxgzK7y4JfQnf9HI0fiNDFsPBdw45fc6yPtadPtDYdjQqIXRFF3jZftt9ofBjTNIqQ8h3d/nzd8mCZnLKLmzDoHzl4+N4bIhIb1oBjh0+cDbZaY8d+Q0TtFW5D59pSxV3h9LLNG47p0YK3eNpGBy6EAH6NFwUHk9DVQtLZ2NA97NhFsiGMRHFMkU0fmudQG2+9U3qX05QYbVTguPVRqN+rXdmauP2cAJXvwhdIqVeLWQt7GJtRFIkLRTSjlh4ZzSdyoCQFCUhEsAL9MSbuqiiyVwK29+mZCg31zBqSUOsWxt0N+9DPCvn5/BDK+di+6I3AMVGWGiEEsr8tMviFHvD6KoNp+2DUbQuw5lJoBlyrnbhfJhBXz/Dj5VA5otznNnW9qxf5GJhJSBSGtmrHnmx0Hr3/f/1uw57NGifviFAIkNv7TwjkTNMju0oBOA3vSK8xxS8Rzs4xAjqkwK0g6O2cLoXLnCJwGggBKWrLqQRJUHocJhJVDE82wEWKHKwR56UVAww/ickFUibvIGf2jAUFqhDNuGUbMIUzTafdG45h3Yg/Y9aLhICzSMQpoSFPktnnDAv+DHtuilboqRLqv7iYg70th2cyOzEo/2yuYhuIjAlFjztcmQwfN7rsN4leKEnVMvpaIa8e3TXDFBXBvVTbEQZbhuZ9lAnivEpZ7i+xkSxHo9sxCOb8cgDRCaPHhz2pgCglXC7AzBOhNB8vT4rvwdrX+XSECGYpqZbn8M2Nhv2iIXaDmRCdQ3t0JoZhNBtzGZHv7FfiGD4UQAMVWUKF+53FQU5lgB/wFFMG93Fjmf9vu3SLgkaSQtJtlO6KLWVrktbeIzQmfPRN4cLCYN4AtzZto8wiXc7C8lH5BwXUwfS+eT7XTLoJMGWXfQETE8YiRVZYsJqzV29Nr8Twmy2g0GHzaPNPRjwYI88cUBwDLqWHBBBOBhcdmRZoLLYdgAkVh5nU1xEO8bJgjAz+rrRJKIuZ+PeaHyq/JuNuaDwOe0BazKKxoPhsD+bjm1jyCcR6bMdqPftzlkvDIcDTqNuzKn1uvYiDcd6jSacnkNgYiO2mvX7dRtPztP2eDoAcxgLh+VjyuwsCsWuYF7EBuWEk3Q7mLbRZWTiwO3YpQPQrw2G1YSIQmxr2L7ZBXuYd+ajZxzTMm7fHNF9N8KDbq/DQeeCZ6eXEzuy6Xq5NzzqzrdPmDxfHExKRPId6JCfT3B0G669be2da4cDQbYdCkG2wbmyXBq51Psuu6TVl+fd7huc5R9xpA9H7XEnClGaNBoAwtiQtoD09k28J+n0t/r+//6LVyC3J0cWDJvg0opaPbbKipLr6PDXbZ1fbYRg2hoGJcZmtY1xMNuI0jgNH/fbJy4vbJ1rSOGCNcwBokHd6kbJOv2+SrYuzozSOIAqgxMi4rFDhibf3OsHEPPJyZZCQtICMg0B7lnOxvYo14Hyk7LqcDqQZk7o/bfMRk4WPzsMHcnkJhEpvnYkDQ9BdzU4tUGLKB2G7IOkQZdRyCZPQPBkZiBeNICWhXigiuSElchoOLDrEOK5K2o0gxFesm7joKYOAVGsSMljfs7kkC+QZrJB6BpMbJgFJiDy56q+2od4bTp2OUvQ4iDPoF+gMMZaP9Owfqb8dns6Ou31Oy7MWppGtaRBKUA3TBdK/NYGlTEDaZxGtTkNq+1tG2DUR20hOwDwlkFj+6SEtFsEQQZ9JQjA+gZBSYhhEAjj6Dr+//ovh/4GABuvSxo5gzydnU0woFF9StgOx8IudccBK9RFjttvR1heTqKU0fgcA9HFTwGy7yLj7rGwF6dhfKJL2zAKTk7G4JFdoJkjaQAerPKGhFhGBKSQUt8hpjuSiaIODQtArTu49eN1+bsvP5w35Lcpvwfyeyi/R/L7WH6P5ffEHMvlDbl1Q27dQFhu3ZBb5SRHuV9ul7vl5ieG3wUHC7Zv/3p0uc7DfR41vMHjJo8PeHzI4yMeP+bxMY9PcOTtG8xggxlsaAoz2GAGG8xggxlsMIMNZrDBDHjjJjPYZAabzIBP8kE+x8f4FB9qX0jzyflwJkumIYPkgeVMCi3ns9FbnMY4zHBg9AKHSxy+MH10oX4bSiNYGqzHwhsuTKB3FwbCu+nrO03fscp9tngfy8b+5LSH0zl0hpRb14A0/MA+x1wCDiUNyii9DBTU3SZgOGmQvWuo4gLSknbnvj2v2/OGPW/a8wN7fmjPj+z5Y3t+bM9P7Bl0QEPq30DD6KY21HvrQqNpGJLv0iD6rwuhF2uYPU2D6G8aYhVpcAAppgbPTjrDMDg7s8ExeR0NQ+qmIYDa43beqOj15IXMGE05tjU8di0zZstoVmNtmjGaZuyaZqxNM6HQhXWsd/HIOxjCLaQnYG4korDsAW+w4QG8I9iw3HF+2u3qsGeIX86QFoZBue1CS7zuAhuWyv0weUthzhmN+UC+CMXmh5DfyPFtt0RvAgbyR1n3BjrhI9S96PKsqm0I9fSWMzlj/Z7uQ8Uu3ceWdLo/9WeHA5kmJFST79RTGhI0Yc40thDMCn8m6yZJOW9fTsrDmnRWyPMp+90Rmnuik1gUpHTE7Mgq5twW+7A7PUcL7sjyH7dyqY9TeYyjj/qnSMZFVCAjsVe4A/4kdqiBZ3a09Xcuq91jk+EMm4E22OHoQgPCxNnzHlifzOkIAgY9qYDHqMxBBZmZ0eBwBMFnxvmlsXJAiFQljHkxCxYFBwqLs1ILJpstGCsgNCrYRFVLqDeA5xUJQdsta3maLNxzyHGCnSV37pjseHQGoRFfletAqk8mJwelvtyQN+upY3Lk0HKcPXMXZ9gczV34wJtSofblBOz0rtX526VXjl1I5OQIaQCPu3CCoVskuyPYAEiWVjNyDzulFGfrEVUC8bWKuVWOLdSMfUOiKPouFz0Syel8JiH2if3O2OgmiKEEal/a0uw/z2RwqOJQl0PuIMgU0r6f84NquVyzKfVqNVeqBZlyaTe/N59Wxx4zUwrlTLoQFNOZ/Xwpp0m46EuwUJSDZD+ajSdmX+WsJg+WCgd/AK4jn5W/Aqoifyx/6rpHzqzb/PGedSQUhpxLoPxxfmh7UP64AOG2nqLrVoaePy45j0AatDlLMJaDkwl2NexukmAoBguj9uLJEKI2Sl/ZZ4TK5a10x57ZwgiPx7OzKZQ56ebmyPwCGq7qggifvsshG4Y0/wI6r4l2FHjAB3F7AStWoZ7yURBcy+FkdHwsp3OjwlgeqcValHGk+18SHJ/Ii0PJowsgVwmzv4SCRxfgRYorcXL3zMDMFaUbngrvqBsXRncuZBD2TCltSiP5C2WupZEboKUR+2FpxI5QGsXKByctxhKp0ojicj2hE0uIzpeEaQS5Ko1AMeUIqfzElFQABNl3+Y0pD035fJilr54JgnKpAj5YjpMJfStVekdTeNzh3gl2TeR3bipYuoJNtlsnJXA2VZlRR9g7OcH+CHdH2p0ylGgl0Mf6VgKdcfucimHyUdXcXrCTL6WrBwxmX5arWYZyryrpUjbwf8VYsV6o5V0EJ+fsparypWqXmmpVFRs52W61C+3b6t6O8XUi9mWBNexgG0VXAX53DJ1oYeC1h5GE2xmGImC/R4dPfr8HGo76zYIRDqvXqv3q3kC0RWBDmSzt9d5AsA+CZ6cwoXkkR/KWDRx8sFGUg9dOu/IxNSoO1yCyq41O5P2cF2zYklcI9G1XwLwmv8FIOj5nMJ0gGLQLIQj75dDtcjDUxohcpk+kOxnq69WH+ooZfOVQCFa3Asb6kIxHnQ5h6qT6RjcaeOSwqU+6pPIFygNeyNiVn1JyCfRQ3BeWoqk8PRKfC9uQES4ozdDuBk92J+0ltaBfwovMK7qJMhcDI2v0i4k5kAF1OTCXZ+bSiRyWk7DM/uRGc7raHK4sNxPbqWdbzWYz+fTuHQLvE15zSf2NNL58J0lL3tYq9B72I0WHW1DvV8crkwSlSeZoEuIxWj8AvIlyBL1PeExVYHgYZnSrNzzqzzoAhSKapCpJPGutPAP0KMI3Wys39anvJZcad25/2vLgzW6dvjlCZPrmenM9Uu5UPQu5h3qcH/9xrNzECKWXYads8t1kQzJVN3j/u3Jl2K0ClzCJ1BVcKrZfvYgxkEV9dsTpXG7IH3spmc47EtyFbEMmH92AMb5qu7/sTU89uUO4NezByn3MLoWdasNH9nSuxrQ1BBUG0UJ/L0E7v9rF+1yWbkBh10+zr8EeoTayffCF05J/KUVynQQF0H5wP/m0sf3Mqro0k9t3n0HLo5GCMxdypkOlieWxfUB6Q5OdYU21YH4VwVVKuuoTNxvQKG44dLlldSNqfsN1qh639Eh14MfJyBSYrpcic19r1vu23SfG282U7Q3AK11/Atc1aMg4KP/vJrfhe+Uj6SyrSy100SY0deSpyfK2FGCbdpbrG/eP9a3Z3G5aiGhQlL9yNgfNyWI6X/Iz1XylZirV8l41XTQa9bL5qt6gnAqYFA8ucsn45DOmUqj7XiDHPclBdWZWkt8A95U9d2P9+1okbFLYVvh53G3TcKTu/y5DgeKeXlYrE5qO0CwkdNKm3asXmmmA7KsVRRDkZBYJbD4pyUcqAJ/GCUVKX0uXMjlTymdywW6+UKM6YDWfLuR/BQ3eSi6TB8tWs4pBP/h9u8LpTb62JT3rIK9jAVGclYqXCgv9tj32UuobMgXhUB++Ayn4cPYy3bf4KNXBhvqbtdkBkda8R2fTgLImWbCwBO0Zpt/2W2w7CW871L2BzvnRaXs47PYH7ckb0+UEgucOHz2Akm97KHRuJCtIWXqMTw7N2431++ZyM1i/H0SBR54RvuW8/bZL33pK1d92Zof6/Kk87UFbjq10dNqlqHrQvjg6mxlsjYwv4YVOb4YV0NGlcHcnQ1BQE8mkPXPavZAsKJ0VAqJSWgiRVWJsqRZIkXDpI3o3G43VcyVC8gjFuCqzhaDzeAzNw9GJPLF+Xy7TFx6c4M36EB3QI905vck5529SKnpmg99KiCzbKbhykyZKwVcizjL5NzZOhcagDknv6EJPqMpFSt7b6I9bKa7MG+1Jfyb3TU6RZiZtnnAYj6A/0U/JSxvjfstMu6nJ1NUf1m5S1KO+RLptLzU2R6d8iZc66aY8z7mLBO05PJEcj4RhGLQbs7ctI0v8Nk2yG9KUV64YtG/jUqIyG0beGDHy5L4zq8ZvZKEqrex53m+8JcXc8Co0Le6KOxrUupZTlA+t2qxLP8rEpG0GkxPjkJG3pBfIcTY9fiyZQx4fxcDphTH2NnnYWnFhMwFlhMaADI6OSrwGvU7M5d9bFbZ4EDNbgX5D2oc8jDXeQ/UPznop2uPhRQbi6umI7zTkXyHy1kGn79A8ZcVid91GY+fR1SbIzXbP1dEGOGLpnIGbtjsSwq9RhIMvlKEYXml3OtACgHIGdmyYF0bU0awjrQxviV36BOxO1avlYMpxd9oGdVJi8FY41xHGlYp2uC0ng4I1qdJz+Dj0NA3BD44to4J1uracsK67dJcpz3mwB+zAYGECplD6iXSPIbdgNES2XIrVpjSHjystkID0nnZKmpc0st+Vzt1BP5UrGw/M5oZ58Ng8eiDXLyXlsZmRPEhsw0PaWwzsDbP+yMjND9bXPfNg47785LEHD0xI1Dx8R1QaE6ti1JIOZPQi0kkhmfD8CCotzX8CG8itxvGkZU570l/ltVplvYl7OCT/GJs97YdCvyaymqev07HQ7YmsJ2wC92Lw5bI4QrfQVD21ZSnp0dlmZ9B3V7onIJSke5L/B7L1jJBne41dSkYmSCbci2KLYTq6nF1uuJQpyi1Lo4VqNmHLeCm5mk6Zg8fye3Glmg/qL9IAVJBIvMpx4WDDg/GmEBzpQzACOhk32t3WpcxI/a7zd8rNw4lxcifpZCfddgr0iUH0TtIuS9HQSTq/noFIygdz/KEnHWJ+OFEha7fjUf9avnp6js0NkD35aCn/pYzgt4Y9vq874OOuDBqPE2K/fUmfqZM3csPpBJMESkBDUeyeTmaH1u610zmkMG+ilP9oBpXywx7mija0/KWSB234jJ3BKbN8+hejyQMXkImG/AFU4nV+QZ0+MpuPUO/eWJeuskw6I2cBZStQQOEuUCxZan8BQV8fVIUKImyq69JTUhOzo+6htDW9s44hYoQTUuwJGfBHePHj+3PkSyoSPnEvDsejN/A+jKqfndETKhjTk+4QbpnRd0b9GUeGZCI0izbF3AGXy95kdAy3tJPT9hh7p9wdBMWWmYvTfbeDL5cesURYDyjm6Yldo8Pxd9J1XdTbrfiG5Eg3pGZ4FiOPNEf6/2Qy6r8VXlBGEXksI/ROSLXXuL/RAgmHS1W9N6It6ifXOXxVlgrzLPx1w/M1hiUKIbwZvHd7toCNw2nr+NhGrid+o0PSOzWes4RS8X3O+eKz7tGs32uP1afzmSx9VIbfxRQ2VXosnX04UYiTiUF7aZe2Ccwndh9vEI4EjXQM8tg5RFRrlE5s6b+WVEpYNXzmBW5AnG1jK1oTRsqqPrajfHPDgwEaSZsXUY2BzHCGagU6v6g35reH48HZJq3bT8jExPpWylJV80Ym58V5iUMtJLuD3oVexVumI+w4d0cxh8Rj+1l602QC8w24Ee9+zrlZ5lfOh6Ch/HBw1WPXpTo9+qHuK3me0imw0l92AjsFgumeRV5/yd1PjzAG1U2DCYktdmktg4IG7dEefAyeiPSd1y1VoPtfCQ3fqH9uUKHD9hjT4GkHrJ70m/YYXXxwpmU7GbfPZKlzdDqSSWcypYqFepS2W/XMSDgAilWElvEBodv9S3iNtkSSX+SYj8EZdtKlmjxePu697VoOZaKW7B+iMyCAVIwE0+e4Gl1RudXM6pNvtLa15rFLnjzqBBXL1mkiDcbDG8xSc81rRHbk9DaxHHMs2TRYa27HLUjiy+NCsrnTvE2bFDW3efTOuODjd1J4uzCjA8OEF7kDXvZSTKNL4OYhSrp6K6l+/xownIE84e5d04RP4kZqazl5JwG5wfchVVJJwieray36Tg0lCWrYQrlPzP0rZAJ3k5/i2u3m+VqiZT7Tmz5rrXzmrchiOazej5KxS1Etxu74XvwOrLO34KCGfXM2UH0dQhyMoBJi0SqIUIA1NuRUKAM89cqj/63VYaAODppUuBKClwljpD7e59DLYm/QBbxFbtAe0AnXsIprJl1KFZ2mMpSDwUShzuCt3KJWyCrz8kpRJ1hTtl1f0oKzMyOHuewoOrBOrWfC/wMUTVfvf8M2yPlay0s4H4rxhrd+oFFpjZVEK6XOoe9jRSpd8RimXnq3i+kz4TU8eRY96TU6x/1Wis5x8E724Z8kEynWbt75iS+1S1q+P4ItFrrQl++ePlvbWv0kcX03subr8W60HkFpndPREPCuYC2P+5PNmEPM5WaST/zH2sY7ub18yfC4my/kTK6UxY/hOL7HdVgecSQP2F7My2RkdYY1NOA6hoYKBThQEZV748epEFRD5XwU2GBkfsrJnAJUg6WP1s4jLfCc4+4rLdVQk31tDT72aRKugWX4mo9SX5lnd82zZ+bpU4IJwKVn4+mzjyyQxOuW54Z2w9xtYXC3VFy85LFRVj9BXJ2jUZYIM/RcxewUyums2fHTL3K0xpVLN9I7frlQr+WkVJm0L+n7aannzD4ka5lCLo1jGekwzoVBbrlYLMsN5ZJfM3AoBJPcQroK09xdZLhbMjf83J7J7hRMvlQzhdKe8fGrVT2TzRdNtix/9R20YcHXQ37XtueLfFUyz1VRklwVFrO5V/ma2c3nClmDtvbNLux866UMfePu5Wpmrwx7171yrWwkn3ypUq/hxbm9XNXky5lawTzPHZjn+ULBFPKl3A29A1uctRxOz+Ug5SuUyxVTgHlt8Tk+vpQu5kwp96pmyru7plzCt6ECbmi5biDTG7V8MVcF0kAlV5IDynRjB4VXi+DnOYN3VXNp7BXh46s5/PxaWSpMzvUiTrV6tWSqRby1igJU67D3LeQytRtsE39f6jcrp5x8g58v7UndWdvfWroGI+Iaw2UcqnlUNiyAYfzrH8i1oqntS/lYWCPVVKvik2qoavgkM/USq6FequULpo4XmBf53MsblSoa8GVaWuAl2uflPkbby2peugv65W1j553vJhurn2wteS0aar7e2lKfzyk32O8utTw7H467A/bJxuvXdz072l8vyGK9ZbqhlqnqteYUGsL/WDt0B+hCGIGvZSirxPSza94lF9FqzSTm5xS9gd3YwslhXMDI82ay1fSXCT9xo+mv3OgNbwA9w4Mv7RudkZZkfePRthXtDjpCHZzishNwxtRMVf9OuEKWr3fstn2ar832tsr2u5/PhOx8bk6mY1nbfG76wnQNu59b2e8/veZLese/3YdAlDOa3iDhmSvxDSFArtQ3mucrsZLzEkuPejCx3GViuGl9Bm1ve3CFzIzlc258zdfc8BYLqOVzNfrx7yVfgybrV9+KvtoLP9td1gcefzf5WhhId7/iJKAuZKq4I6Tx7msDv8RCOL3UNjbQbiXjl5ytMa2OGx99FWy3nF3xPe6vDa6peJV02pr/ZhX/TXr2+saT73CvhKT/p2pQLPNlCznSpRPrXK49TbpWp0szebu57W3BeBgFki6WYCihSk6DVRhGJCCeW3348ZMfyZSMCXZLGpSMpxtHP0jeuZNqfLUFTupOynwk1z+Sl/2u9FI5Na9WxKe60YPe+4GyIvK1H87v3rz/rWTj7qct2kuj5i3JEG4imSIAhgZRr9vYDQXmzObG8tej0zRbDp5mc1O+AXn+fjKehUnO57pEpKVvkKdC5yq0DZ/8ho8RyqbFEj34sWOMtlokf5MVIWr0tncjuQTHeqFbdWF8vDXL/XD39P3/9xciBXUr3BHesz0+OTKHXSh+HF52TajsrCzQ6dCpq+OIJd/RVHjgNgFX+ly+WaZIVtawHe3Q9K4z+cLySNSl7QhDJMSBHNN0RMwzaCQc9yywKZmosTx9QnveOOSZReWJQOfCENefwizLD1QSgHAagIGqg0rlCXdqCJAJgIg7gzj0+EKZsjgaGkT0asA1iYOjyefEANJ4CGRdrnLHsdQAKktR5oJIXVyNZMdWMcMyfmMiK0Dnh6eJrOY/76Oe5QTJ9GQy1DV1BK+G8lt+cXIJjDWImaS+cfuMG8RQryEQMu+1OHaWtQSFu2cZ351fpyv55lqtWs8ZF9lNC6di79twO8mka2ARm8nX23ftPrLb8ZHWuhi5veQl6XcxCAQvvqzVpC1dBDxbuFHdYUoXva2O5CJPmLfhCjP+OPr3D5P37nF4OM0EiaJbJ92IuNf6TVkyH2gQNG/LxZiD1Xe3deN488kPk7hGl59E2Wq+47j7OPeBt2zZF80/c+2L1zcfP7HL0xENthWMT6qR37kiNFEDSh3hxxJjTglwRRuQUyqhEwFxxFWGRQPWdWQsXxP2T+lMJzBjFnrNDVjOE99JfuqmjJvJcSpC11pbBNZCJd9KKsZdS4ULQWvZIoGgoSE8kGzSWsSGTTWKHukgugHqp9PM+bKKRFZ0377xyeo2pmnJ4e8lQ+zj8XRuJWYtZqDFEW4UK3mRVTixE6VGsCM8UTXJcfsQ1TPsgn0CIiKXYiO/2z0MF2AL4IVQPwrxxMOxA1WVp1JQ4IhNLgeHoz6AmbCykhWWk4hErMBXqMLkNnZ27Oi5I+zC9kcqQWmmzBalJjHhD9/xk+TrO6nml0YO727Pqzz8paQwIVSQgWrLkurVTKBV46VkhX0bU1IIg7L+YL0XU5BB7TpWg2KSZjP5zTwGXlFpUGbjMpr1Nz5+f8OtCY/62FnfK7A19gogqXuFGeye1A5UOmzAPbrD3lQJviLDz7BBaq2KAm5McZMQJm3QLLMSUuSt6sTEtqZsnbworG1D2HiaU3pOOqMCXLlpw2yaBwbiXZU4DoSGIcPPZ10qAgUULwb2s3pdiJb1NUeqQ/uBezrdt70jKhR0L7pHAcxnsCeCq+b4LKB97YmRnmT3eyEAGnQH+pUIUGFAo+FnqSmvFWJ77s26JSwTRmD3OfvHKmzVcr3pjqWSomJCsUD1y93Tg/ZZoHZi8mLcqBF7v+LtsyRy71m/PcU2Mb7Mlh57rqNjbPic6CPW+A05aXtpRvo2bw7954Z0kEwBmXGWMZh4eIMVsK2+/8/pFVLvSZv0zl4VcGOynPWt7k2xghfVykEuuwfJQjGPNXMuG1RzlVy6ZkrlEta9CHsmDb1HySMN+UTmOVafO/Xd3Vw1yMjCuZYLsEaVJ/ew4N+p5wtZvEVX4flSQI0gebVmavWDgt10vlCXNbZfz2Tkoke5BfQ0UeTML+v5ai7YKwTlnV/IKts3O+lqNS+L40y5coBbtAD4iKpcN/iUfDHNb+HZfp7ehj3+3XyhED2oN3mmmGZF2MQgTK0+l2gxLyWtMSv/RdFLBcVcMSxQSdb1L3KB3FfKFUwpW02X9sIo5AlXS+nK5sn1Qi7tz32gvIEtWs3lUCoj7wLCoJxQcln6S6Jnamn/uYZjhaFWla76v+alrOFKviDNVirXgvQLaYA0hDw2OVhsGaQXcjUESrXcKyo7ZXMv8tJcFN9UyxUqnQf+QSljSvVi4K5WCunabrlaRGNXctVaXtKqOSlUrpTJBZlyvSS9Kpur1PZZtzVJzhekoPo8e4DtrTt5qZr07m6+lK8dBNkyFM1wvdBYTzxoBZl0Zl9lQEElLe+BeIffJKVJS8cNvxG9shbIs9pAflQX0T0q8wp2K073PlfK5tOloJCv1QpW2iWXqqhVeU/g1yvAETS5V7lMnSmZdCW9k5f78cFSqFzJl2Rf6HZ5J83eh0bDCES5IesK/PyvIOqTaDxIoQ/innmRruZRPGke1CDGaK1ck9z08n7ZrwX1Un43Lxck93L1wOQLwYtcFa8Ox8KGXEy/wqv3c/m9/Zp5mc/W9j2zGaazOcz81QCSssC1RbqQ3ysVcyUZbXhGBmT6QAvNuCUJmlDJ1zL78SdsZXmQ8D2fq3ZryiAVw0ejKCvBli4DwhPI4PhlXTrLAZuvLt1dvrzmq6wzXZJOXd2LxeIlsk0Q1iYT8ZZ0QbLWKLqwX98J9qrlesU30qBRh8y9kM/wjby+nhNiJb0tXZSxYXOv5IUA8uUc+az1WFyHZizVT2NoVX3zslx9ru/TjBiXm2Us5Yuu+0SJuMc3i9l5/JCwrbTahXpJ+dO1tFJnptnPpNxUydcL6cvSq9nerOf9dNUJf3cLZZkJ9tOFXRUTQwbr77MRQUAwSsNG3JUxnfUoZZVZJxP2P6knGK5oPZpwjPLh+VFtdg6Ca5JILPwoJKNROjxl0b+sS9sdGJCrXJYdBY0X0qCI9KACPG0j253SGX69dOtc9UW6xlqupDPPczU7rGIUzI06MmPsROlauZjPxHr3VWqovfjKjS7bq1f+dA0hBYUEeHeuq8uXc9NFzzJbB5Qr42uxkYBmYTfGa7Qpom7OWtRM3He7PG1tWpITT4iHF8i8FYbHiGo4wIQaC82RlkQHkUp5ma5mI17BTodaTzKm45Q1U05XMXlWMRnYqXsXxPRDKSpj99gRMOOkheWQ4SeZy5wPLNAgU6nLoe7L60xgFZxNsFepy6wkIz9b5nyazzLKri0TWFX6UDXs6qQQbLqIkYmmBuwD1C39sB3STqtXZ0Y8hacdbzHHaWhGgc5GUm2BUibMbdgH4PggtwPihJlSqkG6Eg45XmFnkvZgSTmZFQ6CKsavNHY2/yKfFer4S5nXpGEwAnaLael2u0EpXTK8jbxWaTeK2LyjhF/JaDB+eVfaFW/zLPVlF9YknZjYwtE0YhtOZyJpIAwMvYIxg1LzFBTzvpwy+y4OamTnFyEEdgoDMS/mK0FB6kfme9J2Ul2hyeWXOkEZv4B+r2E752EsC92tyTRaeiHjUxnS6h676yvwwlokBOQ6RD5qdBQfgsoE63aTH3K22vgh5xFd1n5giaQdjBGt1IFkkzUPG+EMyfa3vS/sAW6+K+/uYr/KxjiR2OnQ8Y46mmuWI5a+r4r7ZZdg6/hKOrOxfVJPOrXZsIwhkHIMDJvCacfO/u7TYzxs2FaYRKqkyUqylf7EOEqaFzhmVUcY5yBLhg4sdYtNAHa6NdperIVwev2aKVinAlt82ws4eWTsQooLGkxDYL+qOteXS4WD2KxvJ2ukenNrMMukuKHBCQPU/AU2PcM80R93ywsMO2uSs7rLyM7pXF9Jnc2VCRuOUr8vylKF0u9kzkjXJGlH2KeQDQ4WWB+XvFg3rquSQrFkoNNXKO3CdeldfrgjrP3gSoe8lgtEkDQumjR0MGCaWiiym/+j0vJJuzDj+Gf/jCa2hY9Ty8AKOxJbISqN63RXJrf5Ys29cCH3kPGdb0okXll4aV8o1IWDo0kJVntc7OtlblbHO5clVCiyLsKVIURXJXMbDvG075czeblPlwo68FybcmUd3spYWea2gqxFdwtpqTleK5UD7f8R4WAg6vuMRr3ejR/eACqoJcc3aSVqMcLScuSHVRFfra9n3VnXHmEsftNG1p3jN21mOS48Y+nhtSP1KusiTY/+65iQhb5uX6sb9DDiZl8vkxlEQlSZcRpghQqx5bsdxTVaeJdIODGNlTFby1RHHhF8mHQ2O8fYr+B4l0MQimXK9Zpc5DIP77brQTB+9WqGrFq+EvJ5yvB+gPFV7iVcwTK7K2wkh7JjN5VNitijiP2c54lCsQKYeJLqLJiaKodTMV+7juR5Ib2HfAPzLci6Trx2UWQjjsWzFCzrppf4RCEz5E4VU3aAGhSWLpRZLa4So5W2DMo946Yt5cG8hZnbl4V3fLLz52QiCDvhw5WexubxXG2E3Pn1nIFjT8P1aWylGl7TjlCuZqXFSI1hqifrJjdT2qaJEj4gp7FSCJlI0qFUiwNHlUysBKa6R9toqPnjcCGHCyjJlNApqxduAo5JdvByWg+6b7QcK9MKZYol9JwvkTeIXwdfqnZ1Ukj5xmukS/KmeslL+Tp2ZEwuWX3kzQ3P+MgglujZrgf20cojTX3hHigyB+v38d+dA8lKb+NqDF/38OFD8/DRQ88NA6StB/fNerAuvw2zIeGNYN0zE8pTJ6i1CasNxwtKcbkjQxSU/5IYULTe2oFMuKIyYqB3DLvPKaIGegcgH8NLlPvzAewD4DKk87+0knnYt1biIncLauHOu+PRgHbcim/LI0gqzkJE7Tv1NMkP3VsrvbOusZGX9PS1tdMbtseXBuWe5of2CYwQ32o9+yqRd+f5ksHA3X6BhLLcF5jAPHxM7GPYCLvNBryrPR735NZie/xGZfzIDcbhgG3gV55dhnUigSqsH2sjfhYEpNaKpjbSO6y73V2YgBXbZ15UnfqEKfZOoA9f7A4UlG0CATC0w20FlQgpYCN8X7tjiPXsLRbDvd7D9IKXAhRdXmokcy1AdwBXLNErTX04kEKZGkxOGA7LQYP43ZFW0sQDGEqP+Cfwb7BHTZl4h8hji8G2PMNa0Us0bt4fTSz6cj4rDcc9C+Yrlytu78JL8bmcWnKOhrtWaTOte1T4ntG4Yrc/5FNjmeKj+fBzt9eSHp8wgQdpdqKwMAJ45zDmmfB7eRGdTwP2PZJVVORKuK/CIWQLbDudfdMZlIq7HRZJca2l7gq94RvXv9lWqo9Q7QIjx1uoyXAcaQ1qRbnhEjWPy8++3rV5mo7f0PIeECQW8q44Z7TWqF5fMfd2vi7jVCTmRqnWqxzlVZUR9TxghH/RPVqoSyL1zAA2HGYUjjcFofCI4dCG7VjUpJb+jBe6HghZqFG+lrzT/NJpGNxpvjPNL7ET+mXj9Tts7Bvs8mNXnGoBDzZ+L9n06dTB4z46dQSAaoBd0fsXVvd+xUBTlzoQf5S807iTapmG2foESs9Pn6m282vuw95pmTt0h+Ut37kTFuIOX7X5PXmVTWPCw1//C9rpXX/w4H3dqQ4FaZg0tSdGA6NjCUxHcOMd7GBPN8jQGujCBHuwnkI6+qpS2KA0spvvgUIeBHarP1DE7kARa4JAEXln024QmPZkYGAPOqcPgK3fDzlcHIUq+qGGgHOySOV8Kgg4DaOh6mu7XWQH+RgqCaj/cVpxxRwgUnFAvV46/QGZiaQEkddDquIP7ZPUKZh3deg5bT0HjaHaX3TK1lq+R43Dp3D5x9actlaeqQXE1hbUEccz7vY/+nby9VPz7Db16OfvZh959NOk3C+9zSpzL69I32uufbn5ju9+fct5NUmuLScvY6hmP3ZuSZxLkstVtUJYfZCk9zh1wdZozrKP799PyGlnd7eFaEajuxL1oJ+Dplr9oXxm8/xP1n7+j1orLoBe/PMkhtf2moyn5pp0UzkmV0NflquPocv/8NQ87JmHL83DV+Zhxzw8Mg9L5mHZPNw2D5+Zh78wwcOjAAcvvu0cOmTE6/C2+ZxvJOdU6hvdXOtPoE8f+pv56dUckk4B5KtkAwnU5utIxuqsZolq+X9CtXyTcyEhYH9ifm7+Eajwr//kiv3FyoL9xQcf91Jh0b6d/DSp1bqVbCRW/rv/97/6yXe+Zf7BvaWnzz7b7nTbh//ev/uLZ8V//Lf/7t//j/7hdj75vPpv/e2/9Xe+c/73PhJS45yCSos0Pvsn//1/YH72n/xP/0M8/cfJxo/+s3/yXz/71/9m8O/8P/9G/MpPko2/9d/8h0vel+/+6f8mnSn1n/4Xq2ufbKXUiQ51VFzt/0GyKRWpgJbdzurvJRPJVdUS7Kz+5WSzYaDMGPW1byUba9SZ/cto7qYM84G550GtkTgxr29RrdhbW4GK1rZ02iUYA2LsdxWrhURwpQfElu6w42LWOEeS4yWzSl8YHQ/XS4sgOL9FpmuqfRtRyYf3d62C25erLZvrkuqHdaDRZZyjHyq1clRR19VbVHT7WfIDd0IR64+gQZaeaHmQLaeVobXNmBDFJge3sQpLJwcpdI74c71piE1DYxV6TVF0mgrVIC0GkcLQAJ4JnmwcEM3LmDbhT/k6+10oPr9WgYaeaiMuWqw0up0WjFa0T989hc1Ks0N7lcadux/daqWQcTa0W4ncOT19ph6cmk1Vompsvd5OxRQSiexLpURbuu+hP31iKV6LpJE3cxNb1rb2tp9o6m7+FUSU5WzZvHr1ytkkWWW/2y3vljqGWn+Iuf6wUdtt8ZZNZ2hG7ik0ADodjd54kRaf3LC1JWcZvZLH+x2ZRSUJpj6WOUkswfJ8BuVbmSomsO6fkXEhzkEPkKq942EKMwtnsyWaXXopaVRYeECagfW7x0XAXVR0u9MJiMZs1aq6F2e98aIJk97RHR6NL8+m2qeDU6lMMEf6gN6hMJXAcFZTdcyqozO1KDVnsAKQyVIVaBUWbdw+D6wSIid0+/Yx50bF/wjI2AHlxcZpAg4r2tPxaCjhDifRQO191eLU5uOhg/0INc+hGtUzB8H774f6zfRK1xmbdr89Fu5heGkVzpSDmOcbFA8iNO1a5Byct2bwAbTjug6EB81u1TExkMIvVH7GaWiC6RbeYHTWlgWhOWtPyZQwZ9VDtmZ/jvc4Ou3yQfpjUxvAyexwCExotoQic8gBvuGsW2W64KA3a+3KWzKiUkYtOT/ahhsw6irKb5sxq8JI3cTmsjCK5ivTfG3uKMqSWtettbxPZRJsrrUW4JjuxWCjhMN0HOsSzcySxirVPnzwD5KN4LbqizYv0sIfXAh3YGnjhDaYUbJzJ9vY3mpZx+CHrrrVgNU6yIV3XBjXyNk6ozU2v9/iXTAZ3H6GfhWuAP6XBR15x3bS13cM5OMq22mNAp1uO5VSnVvveKdxHUWN/QDXAQFGTAld11ChwvlgNMUQ+nwmQ4C9g7qqX6PGCiQoqLIqGtTFoO8pvZZvxQhKXVFg3doy289g6dva3rb+8u6a187wt8kWXTNbnuqv5pMh8T1yOKzdz+UPGJrdz9+ak6n8AfHjjA7KhbeWWESnnfI4jEM0pzMFOaD7hvGJdf5wdAKnjT2t7dGbXtcOpwk0SgG7DiN49TruFGB1MaeDcjVwxbw01qhXVyHOtpdWvSewliXci1Siwua7oab8fWhOa+sxuQqdR2n7r1Ukf/g4HxmnNhXWrvnlxjv0uNtcUnIhaeaCPEN73P40p0etRVvYm7fVntoy4aGy+zfPObSgffjxnSh3dQt9L565012/bac7LMzQ5QHYZid/rkn41f9qMrrnyopNx4/T4w7Hzrw698JwuYpxNudqPt7LtT/9XWU+7h827q/fw7r7UO2YuQ6/5+yYbczaMbtrkR2zJCFOqCuZ8hlzT9rHdmwkZjftnvIax7N+68v7qw/eJXuXmK8+YPl8W1HsaLRsa3Klee7N6/0/jzm25FCVIbvV2IJfS8cqNaBerta85u5rRf77imb1n5GDpMPhz7ighK/Llx6Nt7/QDjtZeN8fCn9uaT1Njt7/a3/xitGQrGqJ2kYP2mxoHLgmP+xK03Wp442vtdMusKcOL2VCRMD2BK7gAW+mXWI2BlLW5YKpvesbka29zMRCKnrTkM66pX0bIiaWCuEeOlF7MBrblJ5CYPQviS4zak83N/T86IE57XW6h5fCfplZqkeZoZW+KwJTr40ZvQO/RCh43CbJWfj3piOgvfYoDI+bKJnebPhmSMR54GKAIzhDHfAI6tI/m2r8HCf5BJkJQuOlIUWzS6ELclgzyNVh93zSByGlLGwJiEpYpZz1hm9Hb7ooX2wu4XlC049wPvl8InzG4a/h2vpMarrdJ5rsGJZEA3AbRKWZCDmHGysSXADG9r4g0xF/JJKExAjm5HLCxp2y2Z3PptnQfhyg6iK5CKDu5Aus8jnJuNT22954irkkQjF433A+Jtw6bdymsexwREaT9T+FY4DZ0ILuhPIW6e9quzoavm2ugRz0Zq3G+saDxzKIRm+PZThECRzngO4xY5zN+IEZP/ZMv3PER3sP3KoGpGNQbK3LGZsTvcfRrcJKDpRexF7UXBs3JICzUL22PIIh0rlSIL0LTSoVipyaayhU7+r1lIEpkOZw7eUu4Ut1CFnwF0tgUco2Ra1SyPuJzUnLtBmRT2HJZKaNfSg+cEIoneaaVFhYR7AtmPWvSxbu+7rkydRlrG9FNcsYH17aPkC8FHPYn4YPuVJJYveaxJPr7jy55s7Z8HB0wZi8jbhrxDA87L/BOPJo9oh6ZN9DJmOiekSZDrvIMYyzitrR5fEX3fEoFgUgRywK66xYFJQijMLY7yTK2MId2Wun41iPtN2KkU7vbRQ5itWYiTAmZeadKn3td/Bdx9OhUOjPw9yP3nBOEsaqMzmWHiHnKZCwlNGCoH/wRtsn5DqPTqYcF1JkGls6s8QpMnASUqFQoC8ANRmPbeZyoolav8M39SaoA8uvTqa4fTLV20gQO0iRSkZhOig3nzNHZ0g/OkO7OUfi8i3gKKWu1CU2vGSD0QR6KJxowzk23FRI0c0RvI6PLuiuXB45tHzomtAWgqPcv5CO+SQS2ru+qkk0dOthZaRgyp/Ai/R2C1rsuEcFhhQufSv5CSWqq98GDgnxiD0yWs2JQztZbXlbWzDhWl75KHXv6bPt5BrQjLGQ/Wff/h3ht5bw9oRJPJO/Zwb2hms4cJEm0/5TWcmZbeAAPJP1nFEvcPB9d0J/gDgmOGdOEIGtL1H9YPObEIa9TXpAt+10SJxQD0MWkxX8cgLwNG0sPnFIOLZZI5dAmkJIfR4iZNfODFunhghiYcsABewMqVTdyv7lJB2tfQ6QbB4T4P4Oib4DB17y0KEkoqQ4o2Vxxj09ZNU7lqwBvBVF1aMH4ugXIZbPWCbnU1nnHs6mQOEluA/HiOVGUAHChYQGz932ODFXjxb9mueZuuM6szBWhI2MkNDA4wqjQwQuHH5NqYNx++X9Sw1iwkzIgu/iMlxJNVNWIqHyGzSVDdn5VR0tq4d6Z4FNNjqhWAzc0GDIMSESGbSPxiMGlLVAiED8EiDyxJBPj4Z6uxSJm4AaVEyiDpwuUT4hIVsWCZFsd+hAIwI8BUzdrxWr7ggnmaeO7M4MTM47SB0JwyFH4TNwBIhaZ0RMI5zDPRyixXVkScxDQle0XXjfkD7bTFkkNkUNJnadpJFy43xMOHZIbRJ4TTQHdnhIoBwMEH5OzlhO2Id0q4i70VJDx0NmQDN12JRKr5hcDoD3g582YUL7zWl7csqhwwCGTw9+eIAqJmXSMNBEj+UvAaN1OaFTh9xkgt6gjox63VQxuh2dNsLubsPa1yUifNk0oYKhMIYNeseVNlORbEpBARmcWK8AEhnxkNDFMvnVKdw29YYG4JF0Ym0F6e4seXIk9dtfyOe3XQBdXZ0vyWFiLfOH2ghqoi8HIWQUdOKQoGQNoPsY7iQURCxkt+2qA5VYOLEusTddW1IGhwq9jEfOEhZtU4JNWj+iZMTlbV8k8CmD7uB4aAEveUzILHYKtrutGL7SCLxvBNZ+nLBulMDyhltImFqaKWtcfM5Bp0bGPTQzi6OTEEjXJZOEjtgeKuFtAydMk4Q2uwaJl80gkcF0SYazsu68AvjbsQ0pEqQEwV3LA/IN8mMHBfAZHVrALR2YeHqfPIOzQ8yPZyMQmjOgo4GuRDgIQuzCeH/ozjYNcRdWAqG0S7u/FEHWICcT8/lMPhyHrsWYRpNRvklUwnE3wSEoZ8qXJwjR/R73XW2QqU5GOta+E2IvJFjfQo5meALAn+Aj8eOAYx2BXbKQDPaUsMTPxoAlqY409JRgDw9BGxyAssXfNK66Wb1yEPLJuYzlUmDNsdIO690KR8BVSmWM9SHcO6E3Dgdrrid9M9E1cEjAVYve+3niix4w0D+X1qIYuDv9yG1K92djuQSvXhPG5SDzMs/dDntQFIxdYDa6iEvohibyhjfCRHtqAxwOaGdd2uEGu7jTKYuZzw4nOLyVmUjzMVF2IOdTGZc8JNAxGVDyPe2GnJ+KsB3NcYHERseAdrFywUlLlpD22F11WUDCaXTXzpwg/ZAtqPW+zNmgyjhP9CwPW7G4nlilGpRLEJXzkNDGYxAUiwEMYVRGghwx5oeJxkkrGKLDTA3NdPBcDPosOc54F5YG8iYJot7kdEbNr+0GQOuslLztYPrgFCPcIm4k11ofxnwj4JtprMup2UmNIdRRDLhGfzB0EHzIj9sja6FA8l7La2J7bJ7zXCjQd5ONW5++/uyrlnMeojCP3Ki9m4yJGm+3jIPMuO1kjNhefbTulAiA7+Nw+yB0fLTx/v90LsIzxfTzXIDtUfkFur63VipW1TTARpez6YAq7365mKvArqNeLRh6o7IajPJoUEz/ApZSxXwJpwptb4Lay1z6udWUS5ey1XI+a9IV6M/vlKsFSbFqtYqNBp1bX61bTQYax9QFtdB2sC6p5UtW9ZsgctDfLZegEp0vZQr1LHRxK7QPQdFpLHdgTXLlmTAjumEoFOIZmq/JILpdXVqEV4JKrlrM+6r87O5yHi6k9Ok9KLC6C7ApyL8yfo52MjXU7ct0tfSbSuaZTE1ioU7zQaxkWndWbdrGqG6986tqlCzheoWK/6Ex0T7t0KUtpKYzz6EH7O5WA7y62tao7ZBLysVuknZHP7iSkHtVq6YDNQXISC+JXkmzOdVXDu9lldsGklhOe5nG1XhLwxUolodmJZrE4mhKMf0qX6yraQQsn1Fd8k2VujUMc9dL9eIOFeND5AGfTSCtBPNYe1cFztauyyVXZG0F+b0ScP8qVnmeiRrDM7AdiSVLhKk4+O5R+9LYN7sUfrU0+Qs/cE2jEVfREl5ozCyMSp1NhMaKudp+OathH1YLYSjIZNP+fiyOr6UTrCiJQAHakGFbQefd7OWjfoIwbLdgcVAsZ+sYjkizhbNWkrEUV9z9vTAPCS5cLKR3cgXfWfNUqmWFPVATBa39pdBOIDSZCzXu0zAm+1XMdAwGf1QklwhphrWqLMH6r3AQ0KSAJgum8iDIFPK0v30QllCCLisJLhS2Wi+FTvfsqPczlfBZVrxS0tiQVR1yElD/RSm6WcJhoSW88Cp2RsJ+MoQCo2fUqvm9PZoTyqtczdscF3KwUadxTu18mJ8U0vWSVGwVhgoHey/zJcB3msgOwg0Boef7Zm/fT9AAyuTL0lhqIDF3h1D/vZem6L/ILMEDillfN8Dxf2Ae3Tcfy9+6eXzfPLlvhPbkgMdRBlRnaB3rAsAa8Q9onk3bF9K0ekmopxRwcwPHTA7HbPmlH1T2YeLiYgrK+SpTzuY8K8E+/pFDy7m44ISHWaWa2YfBrC28pERtRL2O0LwtMlKMTN4q2R0tVDzBZhWbeZTABbvVcjGcPUilTb6ohqh4sYSlKlGdofVjEBk9ay3D6IIXaDi0m86g5Up7dRmbVy986Alru5bPwHA1pBilcuCX+eYQZaSsNcAnpQ0yuaxMCErLi/lf6WMLrR999cKF6Jt0VvizFRYWYWHdWWPxsg+cCWnOmpRApinfxF8dNtW1TVQFWmox9xsvMAeFaXWGQfZ7QJzBvVQQypZrpRzs3KyhCUxmrktHmjUj8i1QCCaQ65KrsZu1WwehaaYXZ98y6BBCGrIHkfWwG93CTVV0QpJAIU80Au2bL/fTteCgXAfVn683KQ/4lRd5P0+j+gOURUarZ4RdkckhU4OpqqKpwMuoMJNAGna8WTr7AnaJwu4V8mlOqOkqcH5hv/cyyNbRtNFMYa/KY8okkvEDVkf0BkfJ0pU8frT5QbPDYFGeDNsOfWmvnje/SFfDYZRBojWRl+b7cHosD3Z836eNEQzL6mmZJV3A9j0letJW4I7Q2L5NeZ6vBCi/hfQtBDrvLFCdqLtJk4LrzbrKm4sG1tbRpOu18l6upPg9YPbAREpp94DiwU/yCTpSKAADQKceWpcaW70ysxayMEdk1D3jMeNiOePOzgKPfUhaXc0NfaP3WysrPzZLyLjMVMvWoA0ZhHPZhwuhb61mMu4ct75zSWGj2/hcfkis5zPuvPg8kuLPI+7n0ARspNAaEJXI6lS75LArahVX2aCxMEZKoJVuk1/mJdWx7qiDKMv5ay6vUpZoQzgFof2kRfVxZoW+0dEk5NkyU4rZHdL9wJIojnbpwpisI/KJLiKzq7E8LzqxC0q5FV86muOW6LAvnOZ2c2klpEriQhbo60gpMhMKpss2Wb88r4GfhMmbtIlv00s5gGGAqVRrWk3FMiqNZZyNkyurX31aubVirlS/cullXuaATMFIL/R9/Soy2DKLEMAjU8+mg5ipKuOV2itrAqqTCxNpufoi52wl/YPiTrlgH/BzGF2o6CuPwU4/CwoxFwuARZQH6nfm1au590s0eiQWiT0xd3/s7mvuzeZ26nvB3NoNo5V2yPoFJt6+jlbIuVA+IIJGjNAqCYpdqwr7XYszsdm8j1rIhoEg7DE5YaIrvlsIZhwHZ02XF6+X3FOlxWxsQsTkaAr89ErL+w5knrA4c3wWkFq+hvHS57Ub23DMrhU1XuVkowbBuaPTkXVEDQIMy3npUFisumUFEGSyIUtAjjq/s7lhKcx1Fx89+JqLrz78KGCTdvys45FhNCvzM6tLJ16hiGFC2DPCFJkjcYPS/10AUwF8AHrp03F7GDjwFBvVJV2syWXaAeCG5GhDAJYhKASRGsK0vG+dJ1vmTJYMpEp7VXAQ6UqFKeQ5I0quSzPL+djOGWifpinvwhWQxIMMV5yl+nRUlEVlWurg1Suzn0vDlpkFU5yBXKFiwfTJZgs3GWYTinyq6ZJP3BDHWc6x5x8mu3OjzXJof0pmHkryMX7e3RVngr1vxLIXbZemrMnG/PouY/Z740yOS7umY1+Z0OZnsbmY7b6AqdBrse9anIq/bl0Vjn+X4B66ruyxunWRxasL9R1OZGVfUXPi6FJgrS2/4luHC8E1r/0NyyLhxGrVA4csgHVyOPtL2g5RG35R3hF2H7OKC4X3hwkor3mey1ViDIJKR4zrKF+3BCOKSOzG0nML3+fovhtI1ilFvOZ00r9uifah1Vl4Q8j2KZsFZtH5ttAUncJtWnztAegTLDiAuie87/P4ki+DFZ7lmuZiih5TIZaRvRBStmuuqUw2FyxmrR2aLCwgYkqEjMOMCKyr+EqhmEv70j056QhhIp6iQ9VxIxIh7TycfUKSYmE8XBPYqDad/5vWsFpwcM51SKVcFPAXLkkh9MIuALnedaP665fDHx4YlG8uyrjdysAt7sL1haU/kH5eeUZhc5RSu0UWJLFhMET4C+U/7PimUt+RDueerOZI20IslGAOnkJnP8vKOGiTMBDQUUoVM5yukMPxN5embHc8iaOSCbLQ8Umsv06CEKhvZ7sc1MVbFMGCK4xgHRRGsKhhJL4EYYJ6mVmgVaGMUYJOlHatrGIhMUIqwQQJaelOnA7YaUP5RymRXTTaNSwWxgfBTm5u68beElaOjVvcNX/+XkjEVZ7pyKxKaBdTfBPKO/UsHYQoH9whcMg6tuv5Fr8rWka5GokJMvIlWKT5wX5exngJ8hXO89fsfFQOAFVX1oZVNntPIUoWhdDypfWisrgx1hSUCAuR2DIpxlhbrjieFAnyF0RG/tWUgOVTIChXYTL/vPAx2Zdr4TqKeMDPcweU84djIOTZjC8L63T9lfYyCTPHMGYHoUrANA74P3ks+zxePGnbrFaNXRXMTYwhA886lIjMkoRBstMN+LyCo4oRY2lHVYyv0wYPwXeU7XFfastqIFjmMrMKOTMRNymdgZS4yk0M3Te08dhCSxNin/UqXXTSm5dAh6YghmLouLzBSZ/tkoIEz64cr3QB87KaroS7XyrSw4YU9gVyu7s5hR0NMZbcUkWZV1YNq4ChGEpbIS3j5nmp/LIUu0m+OluXGlWs4My+zF1x5ORwx8RcSSFLpwPNuraKerhrYAIt1/YJ+UPxIoAZD6TAMSKDXQs/lqrAvpW85A/WZH4dF9anCtmKBPsy17wmoJssvR7ozQAp910SZpsdFUxpnDyFzSP8xiUCS5crXspE88hObj/9Ii9j5Nr7fgUmLucAuT1P2g8Ey+40LP2lyA4yOFLQi4AagXQGOjHxdDXntGmzyXQ0CCxMfjxJXUgwZTGjThfqo93hEbBwkABA/JkqoiHa7x2OYXal4eGbuTdOZofq0Xlk76BuSHt2EajviiC6atV9CTjvSqgx6vAcQQ0sOB1NpsHkcjLtDohHD4AU6Izo1YEUfDAbBKEtnSZTUSqIGZ5p6qjfO6Je5nHvZAaLWOiuRGaj1mtBFy9kWanZdsQElsuGwwzCuDqyt9Hu4Gx6GahpWuxr9eKgOzg67cIZD6M0qbUtgtJMXPpsGKjnVpsw6Xe7Zy5MXzI2PDsc9FyEVa1B1acJI9TLU8deQWiOqNaNalDeHaJ5g357eDLDp9g4HoeUQvoDzIBgho6gs3u0foCGHdVGlYBV54QHBetUwGjv4Xuh0OxMb/XkOtN8p1Oz3N6wE0Qh1+sYcSaWNgJn8AzZVx73p2+C83H7LJj1jCt43KdjYHuEqwokhU01n4wSoD8GkakokufusV0bt85f0FG2kIYmCVNoOqp2o/YcFgQ14dLUKAouJyZOU89dkgYbd8LYuHsy67fHsK8eW7NK6ov2++5sO5qL2TqLErTM8GkuQzteFiZoM2jUumZSzxc2aMexdghWcjQEBu3xm6A9Cdqdt9BfxV1U0qQnYGuGbj3ehCPaltZ99OdTbdejs7MwLG08pxU4R9CcmaF1Tx0jClb77mq74+Mm8VabzDfxZPHG+VYOU6Wd52+F3buaWWlmaowfGYJLSew4mNjoxLr6uZboL1w6FvIlROlKuqPONvm6XmYvXWnxeHrU8PHUhcz1w2jJ6d7PMDTDZ0PU+EwIs/SQk740Ldx7m9kUXlYu7aOh4a/rAJEpcHDeDv2rWhABtEbkjZlz5R9bEAg6J1HfnJGPEvhTpummEziEoLexVZ6uB0O3mipTsCsONz8zs79uMTpKWeOAM4kLb/bomaRqCsDy43IC24HlmgFTXKvqTRJw90mQtzotCr3BxdxdLo5bPetkqHnYPF8hIAXB+yKrz59e645ajV2+D9d6z2BGfLvx9MuWZrT8bG3ZRH6pl+FZE3bCnyYbF1+cUPlwK+b/OY5iYu6F6fda5t49uvr66B58OV4CWiTKFa6oma0Fvvk9GsUApacPI/Sl5uFZD9Zk6MdeChbJqj/YSDTPbydXt5ZXnj6DwR1N381tj3qVS8gW/hUVNGL90YP3/+P3fsdpXyaofJnegbMMgMdW9ORjJznr2FO7qwxxLllTY3FPsassv8p+eodbzBrA1mAYTBTKL/lAmCCLUpdQEsa26m63kUQum68xa78sB30btwekG6ZLBwbecuWX5kGKhr8M3IGgdH4mn8fONJwsRIi6CbraXYgnCrnSniy20rUIdBkblvvSCyEN4CGB5b/ZES52jwjqiUy5INcXEupI8fPOUXBuF7ow9LbM/YIdeJ51SOT5mtkppEvP5ZjnETKRnXINMo8d5AiHCvIXeundOajl4eMEPoflIKujgkLuIy3ju3V2RtbEu0ZW5vRBjNequmGWZyCBw21BOoMKDUPY7ZRq0WMCiokoTsJ67rCui+WYkKWHE1LJ0hsbWxkFCM3mEoC7zTClgK05vLlcqBdxYzFRze3pWp3HfI0rjtANcrEor7Irb6wOeUis62lDT5t6eqCnh9a9SFp3zeZj9skovrEQ31yIP1iIu9wXthkIhCq1avHgSwrMnC/VFSK1yo/nOaGLaxvj/QB/t3m8AAll/VSgLVKt8pCTqtXuq6iumSqEXkZ13OBPpV71pc+pu2h0XPpIhl4ZDwkHp6sx7PBKESVygF+ivJt4mcs9N9mdDCTQKkxJhBuDGgWkug1CRGODXAJr0K/vSOVG4Y1YeNMKaPAF2VwmL2s/Ww3q3Jp6HtwXJfytPbNLFVDICI0+myP4sJzyRRIBF6pa2bm+IhzucU3ibK4GEUF2dx8VirNKpOyiGefnJnynnvFJdKrAk6/yn1ItQ4fc6t8jKwt7E6rNhCtqk9vJZHHak1qVgW69cRclUKzUDhKq9WMRfK239YSlrwxmNYmDmgHb7xC21cCgFg/BHL4nbdPV53fC7gccMCItXdG1fTYhJJZbawgTk1wDmZw0hQ1TuKBB1QpAWPcLNEjcZw1xJ4/B+o7qICFSL8WuhHloAtqM0iY9JtzGzYLoQUZOrlyRnz/vt9wXCicRX+oz/GznS0FV/JzWMuQ5Pr/q1X4e1JU+z1UgpH6esvaUy4YbzWZXHaLzkHBjGM681DkJ7shXfXi1KHPE0m+6UPW5WWAhoY4NXqHiu3Vp05B8u0DCoY+7hPgOrgSkoeU9djtzryx/mGSEVxKqrHo3kMbhnv383n5CO3cU9Bku0L1GPlHGL/wuySGPLYX8rqO1cPVu92XtbqXJYxMNXjR4xGasNCW9vHN0UtbJM5SyNchr6jBejgkVGmKHsgJhoN2BcPtz1qV8CY7mFRMfZzh5l3nzF3Wpaxx0b+d5uvSLvHmOwULv87mDnTJ0MHRDItpfS8tThR1TkCu2bgq53RoPJGN2hteTHZOF/I5lcCQUuopym3qG9EaP3L20+3hySpA689YS0+ZTdK9Tb0ex1E8AjgnoxvJCmRtspb0EiTdD3NMWHsk2aBjyjTJOctRGtXjxwiPtQSmekn5TLGazB/KPclzjFMLlxlzC7loWyzI0Qu8JIb1A58uakptFXcAxX6qbZ0q5PReoUW0B3tyEU5e/RC6zL2d0dRx8q+ZkHEvnuDl+6QJr56L8dl0yOPpXNeUM5jtTzspyYFdXKBb9W7oRlDHsbqeUmgjqepRPKlf30iW3H1yuQf3S9khIpHelIhlg64GoE1ofxJYzlkSz7EEkoZV4e4e6+o6oVnZNZd9U5Cvlh21DUxEaZNwA53AKuSUNvMipNyjuveVLpCmxtZUljWEoJBZhit2oy2Xdht2itxVwby7oOrPEi9j8q6PPqHeaX9bLNXv0TVXWZthqy6rfiqrb4kvDS6LOFfaMixndx8CJ0PEMYZsPDab3Oo3Fao6OFncj7HcTk+1XcwXtVtbVopwha9Z3w78jboHuE08vWBr242pOVR2rOZm9mSfOWhjWup6ihGhPUgLCVhn1KsYtSbqa4CSopwQ5Wg1rDmCtcwlMwGUXQz7YdDBu0qzKN+6bKoeoddSELUig6ufk8ALif6kNScjazXhjdYyt/qqesO3q5/Y4KdpzQkmRL3WUwQnmCphXUZmqEQdDB3W65wKk0/gytzrnaecAXIYLS+nA3zOep7ey/G4tAe1EBrDhRzU/HbpcSam3DVQwDuG8YiPSXcMbEpxQo6iSKxtUmqURLhzC22xD2P1iPUUkwa+gsXn0DSYX+cqE9oRQPc8FhKULgxvOd4X69+LeheVYwLdyQOD+MLwRC2+akNfx68XQpMXuy0bbs3Qph8O+MDVwe2B0K6VGB3g84oU18DPcEazBeg3kywZquvdqaFMlZKtk90vsKaEziUTK9b19nOvckOWhyiN2arFClKm1Vhae39ems2H1SCSfLh9D9UzIe0oZKpVxfwoHGbjci1HyyP4RcnfYaS8YYUDqsk4xun8EtfU6HEWE+76cs14I1WFivlqDjAY+r8xLfBMO0UoF6rnYocuG+3ThJKnD6gB+0TCzZYVRxhkznYHvsgRdriIk78PJ99TuM2HNPu/NizaIjUCb2oX7avP30dh0KYZWDIxeNT51oQWbVFi5eguZ/lES6K0Wt3V7ZTl5t0VH4XOvShCFRNEDT7irMjZ9iP4tWuD0tD1cyPe7ycba1uqSh9x+nLx165aF4EtJEF4pCNMBdOnkl5vvHCwlI8nVcfeke7G6/ujR7ydvKXDe2grRLkNoYLetkfh1+21b91VWn9x//MfJz1AbDnYPdq2ftbzlz2js+vGP6Z5+zjW9Rcz+WfLmzZvuigSjK+uPHv80eW8x03tE3btcXf1B8pYCz6/AojZ08v1zmtXOPXKzFdrWPv6bySW3d4HbJit/ClTMFAWAQKbTG5YUcLM5aRnNkJbCXhx/00IBSoiwhY+e2A41n3W8LN8YCnT7mWdldU/2IAL805XLZqT5vP8/AMVLfD950rz21Fl9e2LatF1XOJoP4xfOA88fzk5OuuMFjN0IEVQR6O02Vgwd1AEdjkeDue0m7vJcAzMXQnmMjmMQc7BVJwoF0JXkyjV4otPuEYDjQgA4u8cxDQHciKQ5h60Y4oiGgPa6H9hRK3vgYVrROqACLgH4xzE634Be1LK/RfcjIiJa2TRbf4aOiMOXrsF/kowDVgOzUuJbBBR+fzvEDcaWsm4zX34IsTJs67CNuc0ZQb9GbdxehLR0wK9RK0rrTuB7AAgpADyJw4ucA9yOGCK2ZQELgS2vsQEojmvG+bbrDucbcNa9vhVnQ5JYYP71HQaCNuewIw9qq3YntmW5f/CD5KdhHcbI0f0IQBTj6VocYDigSK4tK775slT2eOmmuaeoqGuE7V33kAXxKqUDrJOWfQxE9aXrQVQ/CHQa4ZyuWATVjzfXCQu6Y5qH0oO+yYvX/xqwXaX/mKaJw7tKVNERvpVEWCrlhm6q2HvdNMSLzGkjYT9B+qnUvYWsbuhYmN9uIfTXJ1fhNgldIX1pJPPkEJDZhMl14FkxakWszRDsSruxIlx1I9TNIQAmFe/KwlyNJt1OiEx1PTir9PYIGrt3PI+PLd3rA10+dLdBEmfBXE/OZshaTm/U+YtSu5DE9XC2W9YAFBocApiOyL9xYCB8jo4RV8hwmAz1Mw2ROYCNDY2LcS+OtdweHytCjpxYhWejCdBsriWb49FbPqzn8SIdlboEXqb1FIK9SuLgBdPQYYgOUWKixMcmGg12DhM9Eul4bsSinmRegAYIhqwifBPt5AoJ1iH6LmnBb1vyC1rLhRTmtzgIbgBPGF7KRs6EfVuxqNqHzY6kyvUlC3UbhFC37kqc5XM3NDrH/Ymi958nnwKNTn7bwKwzTxMA778r8btybqa26OtC0ciBXkugaYsx3fjo9VcxUH+ZiA9JjYHfdmGh1Sy5FIoILGliSG+n5KuXQJiwq7mlgI+wRm3IqG4BwxaOMxxi8/t//y/8jkXh+4Tk5FCGRmI27plDYE8lAI036F10O4CwIrA9zLWJvCUJQ4uIpniaI8D+j7E93xucALm1dwx9mkG302tbaFZi+HcJj6jKOZPpJZprRNdficmY2GhCy4khA2Sy0XiQaCsfwLwTrI4jyRjwc3b33JOBcTYj6Ni06/g83HnUJ1ZQnxvy9CUwbL/tnQApZzoy6mYggX41MarcxE8nWNKYeEnHffb4xMWEOEgAFML26sjIfZ5DIJdy9wjRN5EGApai3BL/Pn4YCw4caCCYemZ2djJud7oJYJYdzSQP5AWFBwuD8wlRZ3oxdxpCNhs3vq1LEYAqWnCbNel8y1uLT0kPCO++NxwNu/cW73AOQDbmbzzqJqQTJpvn262VK8/YXedU7BEZ63LaePjIbD5+YB6ub3i/+fm/8XVfgnlReurkk9V7LWF3lqOwvS3hoKfDqEevEjL8llsKDBTLwUstFmI27sss9GA99hGz4aR9LB8uOSauKbZenqvSD93KG3+UbDYSbspPNFsyshX68mZy6dkzsG4o3pa6ptpqLWtMPWL8QfLZs7XlrTV6tPr4ERDVb3l2Ov/0lnyf3BQyGr+ffH0rcuXyI8zQX3ruzmRY338lqWBEkmqRiD7+eAdLvTBXsgm3PqU/r4gJbXZurzzddkzqY8eNrnjM4jHK9unXle3TqGw/hSOYL02LpTPLd+aLt3TH46JO0qxDoT8QpinmaUeiJhb9EbiXO2apuezdwUvDC99PRsjuLOSTHVLCP8N3Pr7/A/nOr1BwFjDO5d1RNnzr1JyOZkKOTuU3cHh5s6mC74ff9K8k4UPi95Nxp0qLBX68LvX2VVRvHyW/soV8/emtr3jf/P0bP0u+Xrp1PeT+4yfvfyTk/U7j81/28ucvJyq+aLzWL5Wx05x8udRsPN1uuVWJsn5xsPvmugm9S8xj7F+X6jm/EyELOv/MdakOgV9mKFWDacgaZ+6p69PlGf7MU15++mzuoesSveVn+CMb+vhhPukY30imYG45xwGLPuBinPGtedb48cNc8unTRuIrqd5QY8ij2yOM8LXlhr0/ZZ0CrUOt57QrLNLoKOHkHo8fvf9DtNXFnzdR2EQfpyhf+kbNQ9mTa5nP7PPv/xqqdPznVSp/je5JbzAcTWYX8MTw6J1W0eMnH1pP3vqguwylLQ9OdJWbhKcb9Z+IpxvW2SI5TUDcyS2NpFtOrsjMvFAOXezJo7cNB8rq2ifvvFstT1fGUsJIGEGFKSpLtPs9CKbADnfhKSouluIazi7VoK4d4ftymT8vn+hPVP86RM1VgUVcNKG6xaHHovMQ1NRJY8/GVDn9GvFSuzehx6eR4xiBlnk0wwkLm1D81D8OXbhQaoFFEQUUHxROxIQRN5K31pbN623WSHPi+I/X21K25EDq8ocyI9PV3O15n0U/khnEutyY93zxw2TTX3KeDZebPhYOqxv31/8wKfmsLafoDmP9yf0/RgZfrsWmoDU3B8ndchX+Q7+8A+eI7+605FJsKv9Z0roTRX7vzB053fF0bnuyXkhazcimc9ux8U7H/pqZ4Uo6sWtRH+nSAx11LunRO+myHr0urn54opRC/vlE+SEq/GTzn9dE+WTz95Kv7UxJyEwXCWdNE9O5vY318/qTB/88JtcnD78XvuyeuXebK+QwIcz33jXvf7Tn3n8vVoB7v3UJPv7z6X2xYz3+frTBZOvpzzbhP3n8S+uUSScBpdlwzCQNS3Ef/AkR53VNSoXUxoLMcU0OQuObhyQMj588+XMW4jewEE+e/GlZiCcb/2JYiCdPbiQbn95urczLmLcaqY8k+0Os8n6pBZFFOLZ3b1phOByOOjn4Tev6KpYFPnjyO7JY/HgXAmzJLWWat9f0rYfO8+nSagtSA64T/4wZw6u23aPBK76bfA2WgZP/HXR8YRRCJ2RbrjeHvjY37t9//y50Wg2z1yAwAbEg6AcUERqoImBTIpG7Zbhi0na6of469mv0IR7L+Z+2jBbcmhH7H09Ftly6JRRYiXG/d+hsohZ8R87g34Sbf9jqu8qDTcfXcF2W37KA48eRI2vF9I4xYXDmEN8rAuQ2DIjg/om7RurW+kN7R+FWIJvppjTTmhUa9CZBGyU6Gw07k2A68ppspn9mjWII/73TO0Fl7VivHxlWbkb3I7Qdsr2xyV0cddX2axe7DXrXLt6/27vA87vcdthvT05NvmzyUlfYsCuCImbb07YpKotc1Jot9fqaRck6AVQX86YyHh2ZKvcRqtAYgEtcydbiMPladb7inteKvlEP5va0R1OtGsDNa+OZltHxrUqGWw2lrSpvjw3Of1trhFJ8uQhZvrk/atxPfMxY4uOWcY7lhflDmgu3OLY65GEhm292KA4MhfmI42I313IO62J3wSC7MesdY5qP+T+D2yYW/PvJra15TrqYbK59ubG6+c7clVG+vb1tnqasF8nUV/RHa71LPn1q4MBmuSljXf3UPX320eu7RiYUOqvbUufPDfiWFuq9tvpJk8z2zaTSxtWbrdB78pw/5NXVXlJFkmDZGzfvtZZuLXu3Za5prsvt9YZWjGWPH78zs/kU4aEv5lPAcXf0o2TSanmRrsYfJsHjLTeXTNO7TZ/XkSvpjfsPlz9YkGhrGjPIxv3N9xt2F+L1rZv3OIncUnp5MwaXzi+82dywzADmC4Q33GxK19CxXW+ZT+V5c++eW0PAtgp2Vfd+qzzkeeNK4Sy33HPfuBwmvo6x5fjtSkFVgpvAqd8g8d+4/2A7BMhXPSa7Zg03DqkGgR1Au8dnNYbkbtCZuwtPL2pB2dtO5m/THdXLKWyMrT8YOcoFHRvX+As06xuPse9CeSdc6nWtweb8e36W/JSRlWjzN3JAGy8rmfDbLd4c2ynGnsc/Dm9bY2F13w+TYcCAt2zphktDCImNi1ctdVe1S69W9moYl3uWnNZXAN0u3RFcSKM/NzqIi5Li1GX+Xlx5XtyrVVq9FOlNrDLug47IgAuaJjB376asQ+LG9ketr6A8JmeQCVIOupv/HkiF+tBaI+24H3pMb9ruRGcDJnRoGkvl6ng9ubRlJybsFn7G+z4LuZTPrJVo40tvq6XsRyu5lAB/uKyPQDnlylPIkawIvmCy/PVvQK7hbtcPklduQDHf/5uOg6H1IawLS1lr4jdn5ufnqjXYyVmjOD9nzctgZQWUXGeEpUZbtBA1Gf9FZGEk+c0ZEgH4FWZBtXwpUzPZMoHZrVWPmu8ApjAP7BxnC4InIqsJoIpJDPYK1oYAuOHAqEkTfURhc1QftgRNYxq87qpWe6jQrtrs6hp158CDynm+DEOjUAOa6sxOc9mX708DSSZdUrVfWCuGSq/Qf6ZCab0EfWM5/rIO5U4qMKv2ptPNBDo+dDJfSREO8rlC1trC/lWr7XEYG7erj+2MHc3K6jxuyTpQnJ91maC8QDK5ZZ7CPbf8ntHR/fZXqVBdEk6YX5sWvb4111LcTIFOyq2P1laSynPP692sRKfG6xV5cEVXGbIEkWUEJRVy1XOLnBRTVTHHxNV2oLOjnf5nVjkRh5dAePacp2ApzT8EJzO+aF2vjNg4Ou+AkT/8/KauclzmpPUu4pmnLvwMiyaX/s67qY+GCkfe7VDE11y3F50MTh7YkIVF4+ZndkFmC4OHN3WpKnWwqUWicDAhZf/ciuLcSs0wwPXa5SrdIDp5xneSzZ1PZaUCXbH9f0lG5G1jlxWcz7aoXpyTzqs2VM7UibrDaoQCDLJa7SAIr1FPuZYuVlR5+YUMqHJos+3JWuTEqpUAh2DQhZ8uVRiZWM813pXVCrw+cpXiVIPogXnUubSKQVcUgqDDqFpBVrXniI7rdKaLawjNqzsC+KRvOryB6nBzeo8n6r9XleO6Z+MufCd11PWbOnSzAAbXqkbSkW+oQnSdIpFD59Bz4DwvReqT8B3Xs+/iOovP9uCwT32jOY4BS6nQIZo66x06B7Q9fiOcmanOkV2L9S6w2RmTjY9Uaq2aR9cqGo3bJ4P29Qs1uMsLpk5sfjbjkq3dt56sdNFGx70LGkaqWnSt6924LiD0jaR0Qy7cpt3BWR8l+JByINZ6OPc64fqPfWXGTjFDRc1YFW4J2JsSP2ampUIrIJ1aSc7xrjlnJ4ktDs8tM0Ty9z8r3WykdzLZVqOw/6plciCVOxWZeYwvfxWhNzt+q1IwjVzGz+7ttjB7Ne5vbD4QUpP1W7Bwlfj6xuYjWRflNKtX5lWqWNSlEkCT1iX4UO5//ET4qZ2XWSFLVXdnlfnLCZmZWrWxiadeFYsLz5mDeJKQJI+KVX4NJGSJ74I4Cyu4cMsc6BH3L4R0Y4mBtdaKZX+FnKsP7mOrQ7UUeh53d3qpxqx/3HNuxMl/6HyyZhd1/z97bxPbSLalibl7xs+v3uvX76fe/19LmVKmKIoKiVQqlUqR1G9mqkspqURlZdZjUCz+BKWoJBksBpmSKm/lwMAMxnADdhsGbMAbAwYMe+WNvRzYay/szQzG3tmL2Xo/gIGEz3fOuRFBSsr66Zp+3UZXpRg3bty498b9Pefcc75TX6hT1gbVoNxi1a1EAXHuV5S2kpkTCTZ0XFM2cCp+p3wHFzddTrOP8XKGb+eL7Hw0Xy7gFqrSfrkbVqj0tUKRdiv4KM+DIKzbeEqyhq2MnhWwu7knLm1XtLVMn7wB3zfOQi1mN29U9pxSKupmn/Yi8ll54vT5MENZoXh/WMT2cLeSVPzMjih+ZiVKebQHP3LWWcs1Isr/0mFRoXvuhnPzd4oqObz5Ng6LNJH/8XcufmwJ9/lYKYh2FyvCYnKbRQQjkRyjvD2Cs/Y95s/x+YsLL755zlYonBbitvxwLk/8WEoz/q3qpLIOI/+omIf3xO6fXNFZvUY79Svp0jcCuwTHmwqrp8kWctmtdWjVu1Gtnq+8EFkEJNpPBE1obEehvQSa9vD9/g51+0jHXtGkZAeIte27xh7tsZ/FyEtyUsX+jB0cX9Wzv6oPGq/EN+vY88p5RM3th5OqLgmlSF6OVK0yFrtgYmJmvmHKMA+OjdkomoR3Tkx+UihNlw86VS7FDoxFLc09d1bni/k7GT47oO/BALcx9Moqa1WDHr6dsngvIu8lGjCS93ICy0+trrNIBUZJNB2vIdcWI3KNT9GKOq564oSRRbHDpk87fAe7K7uw5YYfQD4K7dwgxTVPSxV/jHWNKs1qrqyRfduB8F2kE45lC0XMxNJ2pHnpJPVQawMZtVbCawW40MGERqqqIkNPP9Rh0VdYKpGnWnGpYKxZLV71PP0r5+qxDBh8FohFTqbnqeHYhbSI0jJsVPUmj96bzIN9yIhWLd1Kd96slM8a+RRHAwW9nGKtfEAdKbOchOQRyn0iaZ3BGrVgBa554Fjdr79wrn1qdczn3n7v+5av3SRmdutAfp7g95h/ngBrR3BTGHqHHdztPwYwR0lhdvbYy4J4ARHsHYFBQGj/gEFljg6e405sRpFmn/3+HR282H0Kgz/lbwVnZKMEVy70AwwcYiDxQ0FxPWavGzbwwmwSk+zOIw8N7u5/pFg2xIZuweXDThwSK0i63YExZhRgZJ2tHTFE3HqyW/pQs0yE3fmj6B5lxEF5sneAptkk1nd/i9jifWq80bgPnxHvC5ybkVi2Kdw6oIoQ328EFlwvG3rdUTvGrQM2kGTjzET4hcDCAJd6x53fhy14MuJ4FCcGAXSIDas55ejtzgtYmCo2DHx5GB4XGBY8KhQSBr8benkhV215BKmUkoRemMQgkTCLJZJgMoCsFkQJgVqOgGWkyyJgGYhgtnnUPHrEgRJ1+/Mdxpahm919EU7I3dNjDXxoAx9rQGFYGOnl8dEOI8EAqoUrHUtcRobmyJ2ObQvVQr24twt0Eb7SyNnZVlSUg0cyGDhoxwDfcNfvHOhjgRghFtRI6+s02nlxyLgh+zoiH+GZAKVpe1oPPHASIQAhXDSH9g/2pZojd/Lxj3YBqPFo70AkR/D48HhrOwH+oQHMcxsGhjVcLVCtd2hy6vWFYIFsfgzfCwf7O1oxuVFMEACRAODjkTu/s8GgG4/kk9UNovihwocwTEdJqr1bGl1edkuMZIOrvFziFttNpqBRvHVwCASPvYPHu4yHXNpX75AUEkSI3dKBO29nPN1s480DqolAidE6p6uVwrwj5tnm8cExZ8d5AZDftr0CKos4DQgggqWxkeiB5I3Camw9tdAg+2aP/h08xt/iAv0efPDsMALfoArBZw/9beCHQjT8qfnlQre723C2h78N/ACyhy4vIPYwMryeMgyAYR8rG/TR1J08BTUC1TiAWbtE0udhauAqryNkxy7CPHTpaz7aLcGiGouOjk8JYoGUUGkkvmQfIeK5QbMDPWN84RyNswWPxnIVDo4iH1c67xmqGj/RqocbhpKyAUVN4HsFY6GXtwBUsEcLJk28kXua8on7F+MJXkQpnj47Noe7QNwolaL5esjdd0hl7h48K6FVbVg+1d7Zj7T3/HmK2GyvL4xNBagM9k95tIEhIKAZ/GNXQwp/QFX9kAMvBN2CgSL4KouqiG/tGE7gVxxH2BF7e7QiywVQJPEkkDhZsSU88hCDjX8ZqopDnPA5Y1BIX2FG8GdSFHBgYiSKA4aVwAS0xMf4dBy7l/XLwiiMPhOwco2TOaX4EfxHBX4IyTT9UOexgNou2XpjG11vpcrH2zu08R/aQEkCL6KoFxz3bJO2jGPMxzgIkbaI5wXC4enTjSPGnLCh6JufPaU0lBzI9jqcji0xkk2EjziMiXWsBAme0gLBtFOEyyDfzgAMgF7Y5x/qCvZxzDcsqecuxM7JgQ9tADvnMc4sNkrwNfqUAToFtQFCfKD38RWnCCraZ0xFAK7vCOBS6Qllj3vx4UkBwdnZ3eYbYNBs7R5u7Mnj4y0sEXSRGo9DOqCl+cJ3L/SWmx3QcngFV1rvzYvdoyPzYv/wI0VwoJ9HRxtbqRFCf19IYQGLiQG+7IDjIxA+/7DHHB9t6JCgWMA16uGNnlFMJSFNGZHIApr6MQUO3NP4iCK282Ng0LmCs5pn6zxiGk8q0ZkcCznyOKkwBXqjIMIghUjF0qo1IM7loXgLf/3FJ3Pz4Fz+0oFVkHFfZ5jLyLyumAz4vS9EB2wyk3rXs9RsBnKeDGvKpmH4M3WdamuE29A8IyZ/Lrv44PvsqNzwe+871k25mpNkF+9txAeH8aFhzAgxEwRBEv1xkbN3Oc64UyIoWlwuU0OeDQa9sGiZ5vnV6cmpO3dn0w/z62/UfOuaeJHGuMWyU7zmWRHZf9c58bqvHLhud+sUWlXxHh+ImKjmeVt1rdP97znhWS17b1m0KqJDqdfLS1+oBoo8Xx19xl2fXVz5yAp7rBhH2N6gz6jQLXvY3vH6YMH9kBlaUR8KntZ6yuGqUapxh9nswoIDLBDOdj/oeqYUdDzhfz+k2P3aPiXMFN36bpfxii/pViSWX36w5o2fqrWoG1yXmVvi8d1IHAIFFeim5PkReGgWmKyu4qjt9np+tQgjVRf1zd6n39q9HMLLiwi3mu5wIVevU3jxQbbC1vAsESUeXYY6dVKFAYVPUL1ZHGhn8OOm6Ze47Cmnw0psblPDi5yynKnM80Dou12aS10jmAY4oUul0pROzlKac9SKVoPUiSI1j7WvnkdW3kh/yRsw1OzLK4s/iYqNYyWXwtfI5f0ol6HaZzfnZiWbiS/Jhl7PTjoz86lIxSY18oK1JYxax2+1qDs478kvybsetFG93O/YnHBaBlNkHmAN02ZYq//1tBzhytgsW+3+pE7UT50Z1+jLkew4A3VFP2TAitVuMIDaIutAIFwfT/2rBBZzemSj+HBELlW/jCbmmAl9qFgSYrDRh8Vt6L+yRzD0EwwHMlfuObTKT1s5EjS0IMzH/MB1rbyWZwF+mS/lO+bkDcb4b53yo1aFz+nK+90KJnT5eFDpDz0HQ1yPyFn8JiIslmA9FOhoLN7it1SxENwS9UMbZ+szjJKwzt+sOAt3qOGneH8RPyXq8fT4eC8VJetAMCbvUkpAxZbME7gJSyVysj359p+K8pUk3jAby2aD/jMbj0rbm2bjcM9sHAOdl6K2toks2fmYriWzxeIIQYB9skVkw/beR2Zb7iUVFCKATYm/wwPgT+4/OjCgO+BpcgtJdkvbohFBZLF6FNnb4N9N85T+Ecv0yDx9DA6KXn1KvNcLYpMOj4nh2aR/wO0y+7tP8eo+JyFSbb+0ccg/GU5HJfFPTn4Z0FFhCYlxBB9z+PgQVUDqQ6LOET4i+viIKFMDapQuJSAxl54S4bZhSgf0d/jIlI4+MqXSk0fwn2uO8dbxXolCSH9MWT8DKcWVesaAl+bZ0a55/kHJvMjeu64f3tdOyGQY1okhvSecmXyk+SVC2tBuzJzgbf9P0Xn0iNhZOKXi1eO9CgPBqLEyxMlqrUBl2jtzG8vA5HwKuy5WgNuV6BkM5b/JW6mi6B7/EWtgWy8/Y+HWEypQM6M2BNcqRF1Jc9fc1AEWXP2P9rV/qx+bmnV81jzM3n/7y79bo+7Jzsbe8ROGb/2j1oQPEf52x98fsdlZlW+L1uj9g33hpjA83v71362xAcTlfxgUf3uDAuxpJlU+mXgPJlZ/3MpslGRM/mc0IP9OjEYQtlyj94iKO2elxb2rmrrfbESIjWtCMwSMPavTszrI3Nz/GTsSmVH92aPHBhOY3Q0kXP/t7H/EBx042ABgeWJ9VYhtwPFCpAtRsDSsgNo+gScL4KhCrLexx7Ik8xGEaDsM5Lm9eyS0j9U7UVsvtyLMv1Q/RDNOxU14TWLsRh3Zjlbejz/stnW7csu5QY/TnHCaS9GAX0vITAqjIhM4Wxr25hb/jdoUNv3Tfq13ZuQ3HNY5kKJRxH2StvolOLqOUUSg9RLdzBJLb1l1MyJsSplbInOZnYnP/zUG/W+t8lgnYA0zzMbQGsDvVjBKIKSZvZtKFwzSiPBIZEeZAmRGGTG/xBBM2Hlncwv/MxGa9ktm/x59CY+A3ML/Dmu78sM5/YK/Px8A/t02ez76nCVnZMR5zVNPhx2w3VjFkXUbdQiKjLHgzKxiFiT60DtvVCsG6mcUrFgjgwTEDY13iwSmxhOZ+UQCVZb4+9GUtvH+3CnnVyvQ0ytUVKWOLSMezuH2p447M7IgpJh9d4vlk6K0nAtJY2J23HdOZsS0O2XVx3gTAaseaZxZXNYUVqW5/rDtsdT5HS9Ip/2eqlNedaiT6MdNAUn4oVpyoLZ/5pQzeTPrTOLme0754e0KI0P9jAV5+mFzk8X52QrHlieLFVaPN+4s226xjrxNV2FZZ+xNqjwPJRSqr0VIo+bLzcYJQFfkeWmUCPo6SgwQM2mZ7zgneW7SPCrF8a9q7SEWlKXf0rZWPilzMbGmu7t4S7YpPHyNhwkNd304zxvi9IxIdrsp2itmadEPZ6fNtFuiITodqVI5jGqBvXEam8P0XXmQhjL+27+OdPAa/SAMDa3p3Vg1vG2sMlMYspr4YAAnfE0E+n59CKVw8TNplfJeQfArPi7N1rDf91glT7W9VSHPQyasVJ2wfvXGIUZ6VLTXHNXyhiae+J9T9Nt+8LnXtYp44snwzOszFGTYEyxIqxjY9l96ER6kirnozzNBPQxY7zxoNwEC6UH6dSjiL5aDCSgKBdir3piZ7JEXQt1QMEoiY1lxA2jCoOOJiNsiqKr1q63UR6KsRwkuGJcQo/0XehDDgjKYgWr8zyMTULfJml+zLCzDDFooXzTqFRF3g9aqqnVnxc6gY9W5a/JDt8lYzfMzitOdiBSxOD2MI1ljeeQeZiU+lMVW89ZIc8Y1EJenWD4+j3l+njKxItpqUeytMCGRDrYpRuegU37jOjgRKhfW2IIlk549ybPEcNI5WZsuZ6r8NFOtFKcLY4JTgLvp5KD0P3TKd29VYu3gGuOaNYOGat9TKCXi1GtVfSOI1zG68Tq9X6yI2dzK/+K8KfePKskcE6v4iG5imrWJibZ6h0Jx2s0K9IFViEzZ+JQAFdh4WiX0QUXUm+2DL2z8F7xx2OiCRhdS5aEfdi5a/QqD7f14BCucvujBv6YvamyFpfPnf0e+6hqgi/LJ7a/ypY2wVuETsezSwm+ca7pcn91z3t3112D90lu/iOEQRBSvWoy/tvMU2tKj/hJ/okLuYlEgCliRk3O5U0ndEQ+FkR2A1SWPIu4j46qQGcicMQ94DiuygyhmF90ZVDtPNH2Tgaq31NCsXA8uKpGpgEmis6rWf/JozEbIAvIvdZdoAWU/BpZK6mUHXcaPolS0xrbrNdoWIsseLzK+x0I9hlFguj3TYxuXoBG01SiFmMcYCL1pWt2xAws9pfhsiCXcYkeNrMxYkCPIAUk3pFRYbeUUw4U6dJeWNzmoLhucVvAKtbpqzedUPZbpJJxsZPJEhxXyZjKPA4/NSQNpBcLlwhtouMJS4aTCZxi0ea9VQKtNrvGZBMcUKqkCxQig/C9UL5fomWmhPsQ1wS+iU287VOUIO0Z6upvgcMu1eqvbH7xi221Qlxewyo0OPoc0fRL3gHpiLvj9q+4FaOhGpuS2gHmlIH4fne5iR+ajWukJacsOCCKh/ySaltnYQADjS2+Egw3TNT3XiuLHUglEaZi2pfHhFx/4ZJeyJa2MjMNQhqFiqdvKKTBZy79oy6Uvx88y6IJWjFwhX/D/RrYIptYIQP2c1y6Ruw+6pyY/WdPw/Dbyp1nd6TG8cA0uuukFohdoxDW9075HhAhRKIDVbRGtITjWh0G7RgO4SRSRD4/MoR5aexTcr+0TUXK6ic/o1C4YHLMrM6cLSzUe7T2fxnnTr7G74Y7pB0RTADjahJ9Bk72Gc3TBsBgEUtggUNgJmlHdBptxDftdTAepq9Icc3PKSr3jjBzgETKKcPTGS8JDhwYPrThsG+DM5uen1gqrd8xJcfr2+pvJyuvs3Bf20egTKvAvrA2XLpM0yiKrk/oNzxNLanRCaPiIEDnOEiEwOQ9DBnxCeSY/TlNTYuisd+bmnjuRUc/Y6k7j/XO7ARBFnZQgnXwO+RHwiq7mnSUGgabIZ2y4JQtsDL+Lm6StFjen0lTa3Jsm5gZHm92tp6yGzfgDdMHrcf8D1xDUahgpEDJJY0fRyGCCOIHTB5i+2sBaosgcgcGfRW2BL2Tugt+Oe0ZAf828rvCWk8IB8ez0yR0D0R7OhflUuBJp/5SJwGNjLt1F5ysprLdshaZrY9nqAs09BLuWNqtpUZQASchGZlfJwRHTsKWlaQXtW5umFXq6IPVkAVbypQkHZ+WliIyMhFv9Yf0SALF31Z5ZCIyIf0J2IwgMv7s+Hbi+oDO3kdxCBRIosX1yV4mJSAA7TlpnXskeFm9Y34Mqklucd9SivJm+rfjO9ME+mEKl8q9R0EqNjh/LaAi0tHu+LjARbJh+S7pkXeg5GqnFlJiaSDr0Ts8pE31Bs7qSN/nyqutAPUZ2ygw6l3ZBRqbRwUl/7IhAsNkx0higPWzTnwK1N/1XdggGfR7DWOSiFep9qdPIhqpxI1vqj0e/iQksi/qw+nBu/rapCMvC6HYzbn1f3ISMw8RYnzQsh/6lM/54UpSmvuNMAtPl33fucpcQKw88rqnEkHjPKSNO9MjKmoDBJWl8rhyhw1RyY2TnDbWyawXale8+nJu6Q3wevTj+RCxqYCM1GYPNZJce/DZBfWqP+pH4ikbNVJGfpikAetOH7CeKxC0GGT+amytxMFqI9Z3VsTyM3MTRRhNhoPE6FUtO7i2s2/qlWWsQ3sGt+Zi8wktjIk6VC6M8FsYHefrGQS6L5K95LXJOpvN35mBhKbopvPj8kHtnJvXw9RdGCC9XJeKQbqk7qPsPstOxWRQEY1ilUqkR8RiGCXAWyjS2pHsn+fBiytCbDxnNfLRT2mN2rPfu0dAtr82niwXZTbL3svtOApVHET3dJrTDLPwQ7S2vszE+EW6XvjDPErcroPc2mQtaR8uNEn1m/RbHAWyNze6uR2VISQbvOeDuManeqLg/QddHghdr/Ahzx6ClFBbQBc8V3IS21lVigQTjfd49r6SF+uAthEuADx77hA842AhwXu1K7+XuM+C71EA5BLbZN23/9Ayini4VH5zX+l3BFrfaI7+LqVQ5A4mhVLL3lt7+M+tEBYSi7oBgGaybotVJdgaTMmNWq1ZG1o8MWGm99xsGbiJGwd/UJYcVlxGl3PXEeUqov8TK2AiwQezCIvasMoaXAHSELq7nXcZlQGAA6F4glyU9rjThcKU7SPBhCpuQsHcdccECbxYR7lxEOHAAJrDikmUU/DceAdz+SXwELaONllJ0BKLGaflvU5u1sfyLNWTHY/wjBSOOcBMs0W6xGMa9HVkfLoLABrg79uDST+IqQAvVaycRFRrgDK/AECueQsOEXq0N9AQV6fmnCewEgCYMan4bjK5VYY0csyTQEcywx/3Czlf8/gCu6sagDkZh8CwAHhOSsfYqjba9R6YNWD2FVftl5LEFD4eX5lIf3PsSGqDc6lTMlTXyVqTXXd5t74WXFfNsj1aVNoUskFubqOa1wps7J7QGLrLQZ3Z+da1wB2BbcNmSYQg3EARrRde8XpzLfQHz/SIo2jW4dwFQDa/E0/DdkqIn9ELx5E7FvCmn32QqZrVgaF0oFC3cXTU6F8irTy4/msmq07j57HGpCMMwCj/dKcFSeR8+WYuwGjigy4sXafNkY+sDCj7fONqfgUrgY7RIkfmTSfxai9pIvW9ygrjvSYU9vrdstQRxSBpDRuOYNFZQ4wV7eUlTToJJYNTNFNbSUVZh/KXf6Esx/FWsx/gw+WyBqiZdbhSgyzSF34dA+FElHSvMAZzh9li+kAel3fliMn+bhig3PEzbZMk0E1bljuIz1yVYTxbEbORsdMzFI9Bc3ZpHajqtGexv7IPlHxn4cTEfXGmLRWKwqDlmTcAhapFZ01yUIi8WWaaFXGZTvWSNffHD5bolOQ1KF2fBaZxMgdeYN8KezrhOquw3O2GfJ1jGhkVn+EOtyhG1Rcg7Jp+5uEQHp2bFUFzSzxr7YpxD4pvUv0X23v1f2I8btCrJj/4hV9RMu+fERjGnrukUYjdTSd9KVuEWn/vfwtiyNOG9lSmFWa3okdXDRAkRpfpIcxabJPSDW+I1hFhheldVp/WG5uPD5DiOynrwI4ft4kOiWKjSVONdzRfoWNsHW1+eMT+9mvXywgM7WL/i5Irf/BH1J7yDUOGiMrqsWTF8Fx+CUCZpPaBMP+QIymWkgbLLi4vxGsFLv4eF3bvwGsOBB7mrKG0kfa38ikuGUGL8yW/4iZscDtGzt//NdxPaxtm6r1tEdgCfU747a5aafo+YqMGZWzQhbYd0oWfrKoQC2H5A23mO3nSLtE3TM3op+9LzeibHv0jo0/7GcXoGleWss5J4iZPVKU9OwUAaIk6lh0iSkbL8Ft3ziVrdxlEE8kNeeD/LNWMt8iz/evTj9anKVD2RK+TwOTnJMM57pKD1OH+pkdBP9JVZvEwfmUPrqMR3MOxRe/EnZKNsiY6gzZibkrLGW5pFM857HTRQ080QhTZwM3zKSG923MyZV6PokGgEyOh6bgai0FrjTBPBfZR0AqUFbcDIHr7Qxi0343V6g0tTazSGnSEQlagCfQ/0yqQWyLkkniP/RtAWrseF5yyOkpdQA6lFOEy+NWmyiTq16HWgiAxpPHSGVK/6JV6atP2olYpKoSo3GUK37zWHDaoCVcy7gEiIYTSkTpCl2szir7Ut0wiGcHDGXyRvt4j1xJlB4ssn9Ss4P/4KX9B29Q6vax0iv2RCRba92ivqcHy95MtZ1IlqpdGS0Vc0Ryqcn3JuROfxM3lrMv4m06Bu8kK/1nUzyDZxK4hh8adoq0ZVlEFicnY05KRa0QNbdX6YtakkoFWNW0X9bXDnScMlW4zf5DllB1K7TaMtMT7oeW8Y0ssyuUAZUzVw5j06iEw2alFJTxMnK7klK5bj6tS6l9GYlv7N6nMxxXEzXZrO2rbydfwe3khMm2Sjcm/EPcRzAy6go08X2GU7QvmRO2N7gR+6KW0KfpicrvZtdwZfFI0qF4iBA5+YBnoyUg7Fj2Rtxt6L6sHSeEjkUF8cMfCNVGPsNkpq342e493oKcv+sg0Z0Tg8K+CMiqMllNNn5/2ge+qK0ggtbAHakLgz5OuLrkY40HdxBGdz5C/xWi2sFpEtD/VHLTxrsH5Uj4Gnm7REUufyjeSSZbO3Bf7tSvjOHZOlvxzfLcov3XcRR39hh/rXzUS7w0vOk5FuwmgtEWib0CbWDUJqW6gxkLd9hD1Cw4DwiR5Y+JzQdWxuci2E8AvYRTFdGVz2eWJMx5FNYvp7WOf07ZHSk7NAo0ambPIdFAfWExhPXLM1WxFDFfcwsJJlRm2iF5u95ixJxtpJn1H/hF7/FYP2xQ1obOKx0ngqjvRK3ITU6CGWb/vqaL2RHu75xhv2Wpuox3+aoFKwtHR92paX8B20ATde0tBFxWgxoq1Ww1i1aGgSL914qQ3f9Onbh9jQ7YM4RMlz9MxEw7bn0+MlZAihZtMUrOdaLrvRhjzkHh57n8FlaNHkTXheo0dZCAN4vFFFkeWpx81Lu1dXCoUggekGegsJcpIlCD1KGAyaVsLAHyiinrxeURbSWGqQaLOalJD4KCG5+JOQAz6lyTIK+TV9Wqm5VK4yy5XQpIbLFrQvd4Y/kdYt2yLoTxrMRgAul1Bx6rMaFnQuv1kb1KR8FU5lufA17Y+Cdf1L6e3hZGKViKNsy7CoxdJNuPfOzT3OEp+PRqDnEOmMvWrLSY6kSLXh7b/6TmIoiRiIVi90YccPRTgkY9y2d8aOzDxDbXpycqUEl7SRbH+5eEqOvUmZ220j3t0VGbRpkpHUo9TMPRCATNp9SiuvUmOdAKuq99kkVl8iKIQgofRKA6D/aJMM8WOiqnCV8RibKtVjjQOFKD8kTpJVvOljK0bcrMrJ6F6FSiPfFKLX2173lPKQJQX+ZH3aaoNBDWe/bWYdht0mKMB+P+jzPodou49KoUTSxvtVvGVmvIueiMy+LAH3XpO3qXXtJZ6TXEN8olts+f0Q+1NcqjoKE4pGnYa1gmEfzee3WKGXPpZSDwDgxmRO1KxukRud+51zXjKL0UOL+SrFaMutJ4ZN1HbIQ6iTpejtTu0ialVOFXq83UYIsYlqcNFZueQi8jtqY6lAOGxRp0waMXaOu9zkdKArbisn08ElOgVxkUX7UZMg67R0cARiue1m2PS+26TyQh6KtvA1jIWCyKOjCsVDiIk2u6dQP5zV2q+QQzTlQFPWeqFn30WfcnPIgI6GlZCGg2i4SYHF0fsEym40nmkZBfJsn4ruv/J4iGBmyBzk6imJDSZNRkeCyLTFxtNTWtPr6rUfzXN0ukRFIco3yez1aArNJmcj3UUT3CZCe1IG0maTvGDYWYQRSgPc/5y/MJEzVu5o2403uKBnEhNElg1uW6w61403rB/2cwp2+HC/XVke7OwpJleaSaPjOrEaapTXvbJqUt/3iI1EZwzOfNq6ZApz++gEkhhddUZWGlTUTrcCTiPE43pIOyOrs1C7QflldKZJMcKtYEBzExZHFwJdqO24l6bv8xILYkeyC+XVWcvDaiNMmlMirUeGrmbOhTKvWGt48cSVcmvhyKp5/b72o3+U2NdE3Jdnrzwg38+xWAbEFGSpoxfdtGkxKe41fN6+AVapnC2DVTIkdaEOMG/JidK0mKhU9AsIVOAKR+PDLu/qtA0H1KaMNnraaBr6fi2Ksjr3Q5rObsYMC3RxIKanWFAeyephpwxOs3ZlT/I0tPxj/PFzUzB2D4h8WaC6BcXVzlIB4Nm4ohSdcI7Bkw/Lex86GTw+G4MCn1rhBpHyTVBDp5dBqxVa4rgHxEib9mogEPi2Bvah67RMSO8UpGm07aXk4Rp9Nh8wUWmgs1gfpNY2WrOse2KzM5Id0zunemPCz7TBTQHVRb206T+Tpg8ZH9bNoNm1lmYNz+lxQVC7C62+em6XRpL+pR/WxekYTY0hcEmVavJbOiBu6BNed71X9isF4X3YJZId/vZQQ2l3zbkISHiUeKFSlrj13Ixa0QzX8iZo4t01DBM0WcG2DFeoGDWedL0IMq+dE7M6IaDIkU8XTCZdAJhD4RoO49/Gcycv/yVgKVptmpy8phYKZo3/M09d12yaw6PdjzaOdwDLYvQ1gfHVo0laJfyOj10gATW/pm9RbvhPc1yDGA/7nO2+Tq3dCvod8N82qs9LetAlRrWgLwv3LWNNTzMpq1bQbnKF4Qlgyi0bBge6TgD8L6MPn7ylBvS6VILcBj4wnxZmqN2QCf0WyicFSLehkcyBgtGY6ImbLp+kEXKRqsghkGMajtIX6DPi3NZwpcqLqx1+CQrYkwhNUmCWAm6JnTSdzGt4/jp28UncmYnTi9vFVHGVrXBEH/QhPoY++yHGRCopzo8E8ZMsOUdas1pIXXeWccuekuAEcRaa5Cx996+K37+4rvV/Ex803CS2r1z33m9tsSe3pCGSJzmiWzt2TIMTwOWFHzii4i74Ur+2Wh/9Cp+JFFNJR+jN9CfOnKjYApBr0ilnJm9PTQMEam7eWX2YLxTXXfek+ol583/9W5xlvedwK4jS5ExqbXP74H+gOwaw+S5ONGfFhGqez7+Q7gGqM4LCi/mHlCl4n6XxNpN8PI8RARWW5aVPWE8GmkpzCiA8I/DmcVbm6+cNxB0+K12+V4DeSQ1SbegD84epG785qIjwvTUzK68+HLHdyy4v71i9YYjFI60Gv2XBmMHaqt4HrNPCqvVPwLKXhmo+zjoWG6q8VpjMW5sVZ1o13hhLR5I+uRmbfgSUPhHUgcDw9GlxApldXjlkTz+x08qv+jrbLzDqGTyBWgdB2eUH/z2rb9JYrU5Rq8X9oUqx9GAq2U2R7Z5o6di2E8D+2AuX9MWq9ahovmYZOP7LF6B2F8/lsqoCb9YrKul5ZDsOKEJCZZRLYUVUnRES73q1LgOvg09Fv0LvIjVmj7Ekel1TFbfOMA3qlpFS9D0T9GqfDT2rIc7tyBP50+ilTXExsO23WmYHZMDOBfSBPvAuQ7gDBKjZoeoXHUMb5IjoeKJkS2c1uikN66wiUhpyAgox4P1IUb+kmSiGVV+M6rnStN88+ENlBuZOOAtmP3RpeNW1S8WvnZk7MwmsKyhbTc6z8mYzAmCvpoqSBSKg1DHyyozaY85OjsJmMaqCPEhZA5l50eunHHgpuL/4XWeSteigygFDM8EVFEhB3FfF5aYf48HfqLGys11JKg4kXtX5DCjHjS2Gaj4AMOcLs33wbHNvZ6J4eLSztQvfOAzVCxRfC7F7tLOxp4rs/6HksrO/PVHkAjb3DrY+mCgKovOBuuc5AGpr7KUH0MBA/30EBFLx1kMtMXF4dLC1s/3saCcFDNTHgFESJE/gaR4dPDsGVuPxx4c74i5Ka/C2Ejns2qOyFUJawztmEwoshygo4ahr70DddR3sjwJm7+4/owcfbwkINX3BTpTR9u7TnX1uDvosdsj14TMievYAvA2/XEBvPgba5V4EsHwwUTw+MLvUrLtbu3BbMsFAJkX6evGhhVYQKOQjqsHuljZG3BIGcFd7DKn7bG9v99HHjCcVu+tisKkdhpI94CYF/bZ/bKk4c0hdya67NrYtkuXRDjvfKm18tBM17/EBMKaOHu8cU9Oix54f7R7bBv6vtXVLQFx4ivpu7zzaeLZHH7y3g3uqh3gpox/qWlzEnxcDPoiDMoES292nXjQfoHwGyDrY3+MvOoKDMoNnh8/YtdjWs6PSLjsbK6GgErU1tzPjcYlDsZKt3zJvxIIwCF+YedaoVpdeDDXoZmbz2GDmVXl2Hq/9EksRJuAMTUDxDsw6C7AVnREvXUSr0W78cPWO6LeerN3OZCJNd6viChWfNdcppsq31yvWEAPkkqXdfujwc8qwCJX7ufedRD7FTAbq1LepjfvWkC5hIihGRGI29/a/Aoza+JbouvGOKAievKGtzaRg4a6uoL/6XeQrGnaBk1RPCty+3iQ+clp5y9o6mRGVWzj++/95TtbTdPZ+7u1/i95J9qCJaAdOb/6hk/54nRSZnt5f+nNrjCdU5mQ0pYrQq4xxKCMi6imjjpbXZuElm8qEFw+wgZaQdYvixFbo2Mm8enhBIacDczrwTHtA/5QAJkZi7uH8agKC4Se0PqgyO68P2fvLPx+zqmkN2hR97+cOo/BqNANhUvT9QL4o6e3nitpzMOLAxxfPbqKKDMc3fmvMeEkd5kQW90nrpV0hOqyWbSVt3k2EJOFi4QUr9rD1iWMbE5iYzjgo5hgYJpuanrgn1lvpm4SRTGTUygfgkenL2//yF0ocPH5a5UPPKnuEoTvLnogECW4Fo1aD7FNcC+mpxyDopRjS4ZS1pz2vifStXkhEMrAfWMYcpqxutxqGBThPDVijpOdbF+JVZnJe1dq+0NYpcQ8ODYvPKT0ey+vDQSMVQR9AB52rKOgQTapgP7ikink9qlet3zG029SDWh/63sNQFFd8/j6pQLNfO+cf5CJq9R4LKkXYnML7OCcPEeh7xCuws17/FFIq1MlrQbrcbEKFPDB92AqkqEUHg6A7/lwfSnbXP7MlcGVRJQ9tY1Rp48zz2lXo42tw2LNNW70+O63HO9NIdd6ZxNbq0+AyHPiNl5Rq0WRT3GRcwqKRa1avOb0u6fWeXpf1el+vK2xdYLhILsvgk4LhIISCPUv5oQaB0VWVocdB9FA/CDoax0HEdYNqJ+h71baPk6Va1+8wZ1MVDJBmNWhVe7XBWZTuzKu16Zaauu82zenQx19VRgFCfGJGQ2l0bHSDfqfWJi7l1csqM/6w1rik4WFgny42BJgyfeIXrfdJfKXUAt3phQ1wa2dA8pCjOmmCboBcerVTj19AYNijCwZujzjRQUjj3OtG4gRuMRFxS7GDWp1a0LRczKEOzrVoCYCapdegtmjDIA4N20ad27aObclBHFi1L00fT/v2aV/zJ84SQmWa7o0zn+Y/aDye7Kz8Jg3RrvbatUuo3LVqr4K+P/DCKoswW30fPtH4JhXd+d1WYPiHhlfT6/M8ldhg2JdAz29UIaIWn5M8SxMVgPHfS82vCtUHmSs2LxwVtqDj2hv2G2c0gmmwB50efEimmAevNoDO7kEGyrdhA8MiikzxQZV8JjWHVdXgMYRBZ6g//B66AEWaUKyne/hwA0uMkJevtkC0vOxSn6bEZxhyzLEZbTtotXieX4jZTrXpAxW/IVbnIzFVNg9nLQJefuOk4xFRShRd68cJx+6jdFA0TdGiQytY1zuvhjTNvQ6wa2yQfvpekDL1DvdAMz56wJJbrbV7ZzUJ0gILy0sbHEL8/6qaSBXdSsqRW00d9huJxLiL09q7YZ+t2mUyGuwo8VtRqBrSBhi/n3jXjmc+O6Lv6gfnoQxjOCrt8Hm71woujE/N69FyUfd5haevqGpi8bdnwlqr1vf1YhMO/M8ZoIc7nfbeLk3okJarAFtKfdhqSVnsDbe1uGxauaxpLS/RiAgHaih16nUp+7YcHZ5CT0e3R5brdL0BMVEvsVYGLTkOlbAsBCHlGVKe4Qpto95LWckQoKVcVAX5TtZPddzKfuuG9OKQXhxSZYYr5pXUlRWtUqbBnf/ZsGbqbSj/1HHE2Xx5CoWr1rBxFvo1wzenvEy1afATgccxnRpNmK7p1l5d0rhCBYI+nz3Q1IQiDzuV9dvQWBrgCIvIKppElx6kqlRwpweyU1YZhlBgdSSUU8OCqleJZNU0/MhtBHbAt5SXLFa9nnx8rY+mrXu1jhG0qog07NdOzRkRUaISeUaj5pRleV0ebHB9C8qHA10vPNdQqNfzUBOdw2KLS6GyibDhMUakzEsck4pus9ePI7oBEsExLdUE8mFeHVhnl8YBn9IPokd+EDLdRCu9wQ91L1FqNG16Z6ikXO7pddlee+1hqGH7QrQ80dKANZwJAfp22aiiUBW6IlgwcFTApmk2YJ9QDvqJEHka+gX4ShNnV/QorPIyCw6g72N5CkXrnJZMbBeX5rOhh1NzqJaljNfSthrSxklt0hMsjnbA9BsmKE+BFktWYeNoxAFxh7ZR+aW9MOxCW5064CWy7dPuU+P+pw0Bo7AeEB3SYXfToAb9vicuOs+IAPKUMrHEEG0svJvpvnsZ8t5CNDBM74Ydz6evb9VpuyJKAWXYkdRS6JrqIKDRUH/le+dgMxpU2aquHvbWPiYK5bq3QBTKilytNXjopIxfY/qk9qrmt/kgsIGlvS2kMWw+qWYIWv0VBHU7RBg0fdDnIAf4PLhFebH5oqTDAXFryNBpsFcchtW4NI3Aa+L9mW/VFDIRI+UkIobdK5kMu9A58KF9zEVpdapanTgieGkSr6dG6Ac7wlRXADtwtUNUVpW4EWJF2JrXpqH+Fv4jhdOavn+BSKo7tnl2IY1Gp0HWpp7t1LmZu5dmlObvWjLZrsnKMrX8Uw11Kbcq6gG33DTBUGcsxHx0XR02e0QWXo1DX1Pu1TqWBh4qdMXclytvH7T+DoIASl4NeqHZU6omLtZAUxNl2vuRHDWSSFmijCOqR1gtsDk+DEhpUZBVhhaBPuxMadEBITHEuXUjCC9ML8zR3xL9vfIH0Vpihuc9vE6bCf2udGXb0a0QV1mjLurBBVMfvbPLKqP6UTPQUJNVulavxywbEe9+n02c8UOEWohDj5B1mKC2TWklRjLjaKl44yzoVxerFyYKXtpgNo7Ncuwp9Sr/VvlAnzYEopHQWqow0hedpUvVZqou2kCW+NtzqnfiZZAoVcxt1vWrqgISgp2ABnPikdzTH46HEGGDyXQcZjbbjKSHmi4zOpyuejEecRlH6BuSCa3c3bAtvmyHUNxN1l0akQ2OGhSHgUSLfE0GNe22p1gmha5Smkp0RQIBQELS0Lyi+dqghX0ssygfvM4m2aeaid540H6C5XRwzpR1TymUbuizRh+NZ9rDzrEBnzMF8HnQqfveWDFENQ17UWE0S2n0hkR90Gzu8fgCPcybEAIgg3qyHHDcAHCK1BwtoCBpeOQBv0BZhbKU0K2Mv5Tc1zpQsLMb1ylxcVAkBBUXhZk1EKKclZM4W8pxIEObm8gn4sAzsgtSIS+TWyDvfJxJj2jG9sj+l9j3emdEG5mQ6J++p7vggLd41hYS8i9lTnkfgXU9uMYLP2yfyeUVX/py13/FFl34gTlakw28hpFJO5FJbeqxdhyqR8F+HKobS3oS09aWC9WqXQdvwvXghZWVfmgYyCIu7BTWcU4ZEunB0ztsAKuhCzjQKCgcTfBqjGHk1aMzhGabZUNZpMAjxVjulXg+oopOaR0ZnjaUyfXildVmwDIunkMpJmXw9JEyvk3ziA3lKHAIEIAQCKelYR0cY52Cz2iHO+gfosCm+YiI0+Y21kwOHej1Wc8899tthPcwyFOiUoBiNtrtx0Ni5UOz0RdGYEsssmhYhBRm3p14h02fmyM0u1CsAn5oU9/bJSJCf6tPBxcaOqKN9PI4oNqZEssaqMeo0Z7xnrXbfQyw0o/g2jo0z726ZJUC1dbn8bTRABSE13wU9JH0iLhzr7l5KdEgS7YZw5WpdYp/JD1gk3FDiWttThe15Zem3A8GH3uDI+Rqa2OTUq32h51jGGodeaBWbY8kXj8mzqfkgSQ0x8Ggxi0eboQNc4ytiDuDf8JnNN37DM5aDYcNBnvAKGQtuCp/FmV5gDs0BmWwTSMylUiDERL0nwZNT1TbzB6tc8/YG3cTae0Q6dm6ceSxP2h7yA6VKGHrk3xpHfSJ3fRlMieFLDEmBX8qhFXwfnVRHYY12eHrvrLO1LEYI6LPzTfnHhO4I2t7kzrwjMjUU8txR4t9D1wO7IXBxmEFg1yGimoE0EsAU8mhqAZ2HomKZnO0mGH9cuAtpcSAiJManpO0umD62ndBF5+Kdi8b2jDAbrsJmQuzE7oBWOFFLJExNkkkQIacWdj+oD8U/BQIRKlKHkUJn0kf2MdiyyYhp7X+aUT4gbesp/grpbbIX74OSvXQeq52arRod3zm42m9oF6BgsNqUP/U9FmEhAricEVF8//iOxY+mQXYCYfzNOgE/aQWXnZFLmbiphDuGPIP7sXRhiVCwNMWO5PuPRMa4GzAtLUoaEPEpqISDdGrPMqw68oLr+SFc7+JAwVzQYwhPbw0lxxImToRdCLbYM4qIdvl04KEpEUrwjkRb1zr2QMHlcuKGJdlcik2dFKRY7N2yew4tLphFkX7bKzQji3CnHveS6S69LDXCehyVYeB0JgdqMUTc0pEDb8hnB+rzCoHXKsZlr0IK0zbftDgOtCIYdwb2Vn4FWU1VDzIyj0GhyD0V+UttgWFV0bJg/haqAUUYpTXoOnzSsgGnH5QmhSn7NReSktRMhprpz6L4ZpGj2hSELa8wk6k12r8FWhF8yqlfSztCU6R+QEQ8R1dB2TECNkr40amugwI/TLJxna1drSdebIpwkQbhJU9b0EspNloOmIt+hxAhCU3eF5rH2OKVKXE6ORDzy7wmgYvDNGR0siaWBgTK48ToYiA5ERNBGGtHKQ0tbf0VayWA1mE47VMA1B19kFhyhfz51NWyJO6gL4UZCbop0BzEFq2qmtjfMjUwAwQoaslhePSJFvkw18GhECa8TLCmeVIks/6kk0d15C7xgp29b36sA24KRYkVqNK4vtfgbsIYaFJq7FPrOElDTeisIgf9DoCRdT2vJ4S5JbvYgYrdfNRHQvD+RiGmQNBgxKLDZ3kPIMSDSjV1qnPUxwTeNj3ZGZaWf91KwFT8JqBzOnEYiKdq4tT0GpBrflSrlimO71qLOOxwnn5HjZQAeRE1D/9YbfLBLV0P1N6USfIMvnS1yOiMHkmCbGBMJ6YVbpyKZPftFOTl8h+086ulMSf8yhnNOLEPcshdHnRPaAKxCdZmVPREn3u1U/bVVsQ6EIwrvEX6+DhFcWOH9DhKZRiaGMbYpelxyyK4NFSlantUgXt89HjXDlHxWGt7F+OczJzWusVUvOMiQ4dvxnGYhGnAilo+xXm4UYGCiIr2fecEyRnb7ocshpAM8U835uphKNM9h+TXVlwLXqeahpa9WY4qVEVh9eLc4sLX9y1uhD8KNKHYCV4Mwpcp+hJK4v/q2p2iW3rLs6hdsNN3jw/fLZ7TGTh5T7t+E9FCf9Zt+4LHmWE0SYaB5GyQTCGm9byR7FTk7CpMIPgI/umQFH7g4TgkQLnvIkBTOwaVNUrgKq/sig9qcIYQOlt4O4JiOGb/GSFgbRUNSzPQNWskfUQkNGb7sz8bNFNuZuco1svP35aGcFK5LK+b1EYWXdjBoh7DD6uyqPfdcqr7CzjwFlnhPFxra6uKASVrRbPIvqI0qCXpAtHnkuPUYf9p+L0TPHv8FtlpwqAoYP2gfj/MCfi9cGdETVT49ZroT7Ch9RFaMbAan15x5TnZioShOqxBFR91WQK1leH+mhh9TZgSb/9QeT/InJ0gXEko4J/5UjhSo0jyD4ZN8lBw+opkdcKsK12BFnEPN5FIQqRCyhEq4Iegdl1MYIuDaOyMFCdiHt7EP4M9MIvwoiNhxkuGiP6L1DKoMX01GP8ui7LD3jfGOAsK9KIUXxDRfWNvcjORj5N1JFsxYLOVSsC05kAqZOoGVGiEWD5mQhX3irTKKb8zDUY83OMmz8DfLZHZn9j3xzumuONZ1KrOUwAGutWXUlh01lZ6Y6ZXCuIEv4bRV4vz6+OOIjZdE7W3fOyez55C5YSM6nZ9JybgbXEWr5AlaDBevLJa/PFG3XX0/Imbldm16cS2PsvIuRImigTmE7fJMeJNEO2TtB6K1DmK/eefWsZs84X5TqonbJiqAJdYmJ3opm97nyT7BMN8Rvn9gQrdluBZNDPWDVSeubO80Ma+Dix9ZrRs187t1f5UR9+YGBIGj36mXN7jh9B+hfFpigzw9F2/2tfZmjR1GITWU/E6KxX3LLzNjHlnHTCUywag4sBU9TNaq897ItADUOsAxOYk3LmfXgO6gAE98RNS/B2wjnE/LXuIPCuG2YyRXbXQJ9zMj/rTk2c+oMJ9dmdXVn5AY3B9fnZ9XWO+KlzgtpTCvf89dLCFxz5IyehLjeXfbD4aQKu1Jq3JDZIB9DaqNBsih248aNZimTEVAdKg3Dldo0bPPEKF2OfPlh4+8N/HDkCYlqiFnZ0i6wOGWYm8vhT9uvNYaX4ymuUs7mlCuM62AVTTqAV1hrrowfplh8jnkK6yfimnQ6T3COLaLNIiyBnCuKHA3ADYQ95faLw+01BPWV70uR6ez2aKUNPKZhp29qaynIc1Z/R0M9qtFaeEVnaM2fRk7JP3ynSkn52+2kJdAYQS+DnYeTREYi9ZNSmNEQyamtY965EcHYjseXFbK6yPR5V2U6kZH7wuvrog7g2HJGsC0fENYlux3NP1sJG2DpY1FdFecVBGYuAYDs6gvoaeV6qXSIRACBw7NIzHa/pDzu9JI5roPl1MSTZdRPrHdBrAkSTQFPr8UYJu02fda1w5XgBcE1QYGEw7KsZOFux2n1R5F9XWrd0Rm+ej8SPRknTjsblpLnH+3Q0EaJtDPHXXgTu4H/uBS2cAuBgcBRfNhwSrzwcoFFCmAj1rD7rgJERBmx+HyreLLHRNE0Mz9Rh14eFKq44K+pi66cSh3zCS31yydcxFFr+BbnKal8KuX7iTmGHx6LxOsuaut9n7d1zQJyPwlc/WDq42dQNNwkXZiZJhpkFi2UNEya8wbzGg+yMXdVv2WUda9j40p59kHvfiYGgfWVsylZBmqk5y+tBsAaQHHUh08PCxbp6iTZFHH4aZzVfsWqU/LG2EP+j5G2FXI3eMBJ4qRcQBKM87PqViDkLQnmPA/QSseMDq9rr9+X21OvGNzQQ+IYYQKLm+F0N2mR6S5nZkLwi7fEDh3anukKpz/0ciOhWyVtpKkFDhwkokU1z8xXrB0Bxb2NGb3UKus2OMGDU9tCR3kyapP5OO+58ln06nKdHILh/E3kxEx9mcQvD16g6Krp4UUkMCgaSTZU/eFoRQnHVKRSgWb2WZ1121r3OZCLiEOYyxdU3lYg+PNFPFTtX9SjBKK+xuwbrNDb1eoE5UTArc6N0hSS8Fe38t8wn5ZNPKrOfcEv8d1cV2M9qV3e4CMK7xQjd2KRq7TawnYanZzGfcBpQXoOAFvbY41G8tIrcvPGS1mUjmlkxxc+Lka4gul6wjK3Wt7YCXM+qbpGMCQT3HwN1NCfYyxZquGqxhkGm+woW/SHDU8+wy0vxJTUT+zpRYj+6Y2q/F2Mbr1bRmZTGL4JKOWfG4pE1AbyJcUj6qhplHZLZfOzA/dL0idjkuulyPg1zh3I+U2EHT3kDDXzKgjgJ457kARddoFuMpjyF4UYMgypvMqmIt2bu+l/oeiLIPELxXDJ4ZA/HvawcJjqWeqXEy0tmMbuSErwUVS4WDUGmQihFLmuWl1JmWPRZkLNiFpeNxAn4B7QVDATLbPXfq3Vxyt6XxO1uqigIErQBCnrYsOtZ/UBsBL2BdvnjyCobU7uSeqW4zGnrVwYNSpMFgPvsgWYy8kMxV0nAFKd1hacl4TSA/XVSriCONKO0BfgDjdwoexcCEX8aOf1STJWEzy5RWQYtPuYaIbewsJTYW6au2VwiT87ixZk3kJXQuVkYYWbKt5zKO4h6WDqx8fqJMwVzawQRQuPQFaIxR+x0AfjsTrFhzoMH/zQaJ230eQsCemjIdBtwTqlbFPtA4zOymnWJxttRewi1dbmE0XEDQ/kCDgQ5RDeXRoibkjfAih++DAEyL/0Nl83i1iHF3mzxbZH/ZndRTIvvZ/fVHcSMujaBCIdegYOTW9YRhHiyiVyJ6n4oAgKachHGcm5hMed8vbx0haUnmxk4VXiH8ylZdog9mopEE+K/Zj15Hxk7bY3JMNQ5ntidzaTgxeXaj4PDl+IqfxY7oLIeO3ZB3Y5Zjt9V/Hlrks58xe42zu6NON1K6Vab3O7gCoqjj63/DDAv0XAIE2s8zhwaNfbixY4EQMyxG4078KAhbjTK6pcH398GbgNl2urXTpEXe9yYf537gr9+Eqb6qVH5V8I8jD3hAFeKbfoVWeG6hNNIyIf270r1H1nPzH2l4yMeDQJVreDoZyv/YDc4rQpagUtTAaooIEqzhI0zr1NjNCZ7CD/SVGjmHznlSVrrK9ISHBG5qxKSIxnxOsXS0PIkSARAwq/m2Rvwjxx4Fkt4hBldne59/dUpt5D7W1+dcgtL95y7d+9eVyZFm2tcV80yGfS2G8lII48nsaBUJ4Dy/7Inxj4hcZgY+QYeI4SShn3XMvQsOWXcnsgtScS+Ry7MEoPIkknRaWfQGuNJmQVV7UbZUoWISngFGfUGYukq4dYi/oyYyVZP2DJLZUHwSlRclzi6pnJmDNjJv2HkHATHUqx0QWP6Gh4scq2mPtHWxY4zeRhwokSyJc+sDDYiw+SuB3AdCAYSBNq4i081Zzxt+81WRVfZ/yIqm5K9Mfl88Q1jBM2vgoZiGdN8HjImpp4o03WeXu78mokduMFfJps7Eg2Whqu2yXyCuipEdFehqJTXnfKdvNBohq8O6LcTOG2jYmRti6T0gHDtAuWUca/MKXUmKN8BRQ3Em4r89L3UKovj4Dsu4Yp4Sjycxx6dxOFTm6FyVsUD5z5tLe55ppLcNxhfZUZD2CtmGQgJtw/dkJ4BvwioJqnZYnJFyS0s/5mznub8sGJ0HRbyvpYIsMMnnIP4W0s++EpFr7+77Ps/0U9JA5gFDmLuP/iBs75ejOqz4MyUXz+siDem2xXx6sdP5zmz8ozg6ETLe/rKByCQ4kGWrhbVuccsu7clhgvQBa5TYenBelTqkF0zYz2IXYQLBDqtAfRkglj5YrRnBKwVcw7x38hJnJ3yQl6Kw6CE4yZ4gIonlg/vgTMTaGXB9ReuC0TNhDrkupNkZL/vTJczcELFPGdiQDDaTVq74NrmT6NFuQMWF3/DK3WGsYmIrxj225FftjmPXciUaHVff8jeX4vc43IzkjPcIBP9w/UBtI/tZVSIRkpoAPxTPlnFACmvvq7gNiVD4IEjNaBXjWZxfW6rUuOF6cjX65mvB/yRd6JYDvJ+3DyRczZ6c3NyJjanCHoCCjf65pIF8AKH7gI3qZyfhOOgPDtm4+NZMYVORQBc7KqGJmwZ7vCS9GyloK50crkl46xNbh9sAV+F27Fw6y4c7plbIEphWC+u9mSoljnJ2q2716Rgs/1JNtufvN5sn6YgT5ligenF3GLu28F6yi0ufbtYT7nFe//cmbGzZoad6iZhmYiA+yrITEUmmfDFkkBXpniMUm1TlZSJsaCiMSqQJLnF5WNFThrJ+pvBUBXEjw9lStztN62XZiT5vP1/FJoEJ5uhOUF+MglYg0/QmUxSviMkzvXUDS1np6zmFLtsG3jjEAajZ8SWxlF/wQl3rd7gK5I6lszxBuIZjQ+SW1+dzPFiIidJ2yTJGfVsFrSSOjRE5TExEzsyi3zmTY51YCru2a8x/BjSYoaZnsrfYCDqvigdDrdea5NueQsoSfGawgt4RZYVHWITTiJdwt9QpYA1PLd4f4QhWFw+dWbWhCmBd9JZYBSuJnIQCpwWHZc32wpWFM4NE/hqjWRPWXMdybKgTklziysr9AXM3cKdMRP/cGucSkXHiPiULPP7n9Ze1eR9VPCHTj5Z4Qdvf/MnDFNL71M7Mpp/l+l9jLJ6e9hXfx802gG/L+jvvq4nYnkPC4EhK0enTLPeloQq7goaQ7io8tlfAe3qtA9gj2DDo17KsF4D6xLa2CSSAiMN80EQhFxD0epm/4yizNxgwHkr+WwHgwhTuA6rnmGXs2cQhlQqRrAbX/DZZ9WtQp43FWqcQiWl/Z9d+NQB+JESRtbhrqykeK1A5KrgGM7EqjLR8p1AQmLWLS4oRcQ3RjZAlWQTyS7+2FFWMc1YkCsr9+CLbCYlJAf6k1dTnMaKRxBGwywjf3Yty4N3LAVxwS5Oi9klG5yenWIrVZQnRRfFbDE0i7pM18DhLI1I3Og+w+EvWPENz2dYSBi9QAxnGUoYMtPEgXMum/2BExVDpf4HRIjj3OiTOPZbLXuWJbW5bA5O88qzt0X0/BUzT2uVv+fIqw7c2knwq2cyy77NRG0gl116zecnXO1+kR2csTzuW/vkkzdVopy0Z8ea/nuOa8wJt0hBxYFf9SMAX8oD6ZYICvH6N2jJ7zrlW+yZ/Z9QBpPfbk/zvsJBBqKVqcG5M13OHMgkak/E9twfUP63PMyjVp5ZhS4PexQsT/Ln/uy6+cre9WYYE+hrNOUs5c3bUVa79cE2sqlW/2aZAIjXLbrFb5AHvYVcVOq7RRmtf/1c1pOowBuozNeZY7Yqafs5Rcoh8/UzyCTfn/7670/b9/fxBUDvq1YNGsiUZ6vT68T1nrypfIN582MH7xc1AyxEb7O0O5/IAP721g4axe48czBIaL7t7EeWJpFi/rvMP0UzzlRmKWh49c0tBsJsKInZpK74FjpplvrezaJKcb7cb7mFn2MY8Eac3Ibn/hzRFYBZT+H2F/ARLmmoAERybbOHztdZonmFvrUqAxFH7Y44XhWflRhG9/5z51tec79syUVxN9QoVeQ6Lf8CXobLOHisxNiT97PZX+shCbVmOsqRX7n/e7wCrmzLHJnjpynE2zdz2ZUF3mL7DHBbinUU8lOGt1y779LOK72U27VnmHZHnlEFO4GrNpnb4o80uWm7WU4zn2Y9eFt6/6acQN7DnXH5zmSlmE9RfnPy5IZs7ePUzeWi8osrD8pfvUjXvLtM+1xU+ynvH8csTCMMQXiWbmyqVUoxljHCtrrEh4kYzD5M6eKWu/frRClBq+V5ypMsLj/46B3FcdJvVOJy4ru8fn0uu7T8ju+iFN+olPu/jEtJcFoPFlb+cHNhccJvVObKT+IygaAzl1tYOb65NCT5RuU8+FlcTqfWfwkGjSbti5uLsqm+SXFLC4nP6g/rlxib7/gsJPlG5Swmygkx4nOL2XeUE37DIb+UTTQfTE/9tgdJ5fObi9JU36i03E+ck1UrYw8ZB33uHRNLUn6jkpb+YjxbzXVN6OHFOzc8n5zETjExr660Vc3vNm2RLMtmoaY9FalYqSgNgjlnJi9Sn9Vrj+/pjr1T8GL5O2r089WMOhCfnSzm8SXluRQL5b/nlPNwUSDnv8kNZ+keMeDR/uxwwS9v+JDy9PztCpwVZG7PV2Y5YI8H5HTgpg8ycQm0lbvOWqEyK4267Fxf1pX1Pa2NQuTEbfe1YRjV5CFhUiDFi/vtqB78mfenbvqoN3k3Q6VwAT8D/PzryVhzk9+eIBLmNf4vGsS4XxTHCoe7cQiiZt6lMr/pqPnIRuYRA7DG1iM34sB7CRx4CEeIKBZhzhumY1Pl2yAIS+lipPQhD6aMnCFYnmOsj3NLD+4Q93br9vSdu6tsEjHvOjCIWHcTFhFIOeMQ8cPpxHLiaip2MD43dyKjml1zzKbzxTvr5s386lrhhAUx+Bo+VaB6zqduTDY/S8QTjaIYZxvqA1CPulQVVBZDi9MCxg7y+j67CLVyZquq3fIv2nLpx0b4kBKrNlbXO2fVCciK+wCU8dm7l6caFXKYqrpFiaMhFKWiaDa9b/memhH9VWy5IAnEuUuUCtojfNTFqjHu+V0hYhTdXCNYaydM10J5+d1phY0J01Itt04jBC2Vu7f49j/+Tqy/YACDxD9nDIbLZl/dS3Xc9gjiawr2g4sj6wuqFsJ3w0GLAn6Xf+hNakH+yfLvmalTfGP34GjYjU4I+HDA89tsnnvWZ6EpMF3Uk59c4CLCnh3gFIFqJd7KG5dAkml6cAknykVJN15N/9QfHAdQNmr6r/D3NGiKW1L8PGcxvDqCBhyD8bpxRjh8eIQDBhs4Rkcnb46D+DZQIS7s6HFkEWFdMvBYZGIBCAXWzthG1UIJH9Wa/oUNQiZLQciD2U920G625XeRL335XeTDj23RB0GQHWsggK/Vq3jksuE+W+0HnajLWtSecLl16g22oIGCqxw0hwjvQadeUGTYkyAMgrpSQfVJ3fVZa+Q44K+RkxXovfjBDjeGH24I5KVc96HEBRAS36erIrpQaNsTI3PWCaFbySx84l3Y4O7Ozg4u4sGNyg/3gEtF1/3aPn7VueYf4OnaDw8aA/vmIeut+2GJ7Sf88Bk72oVTK5zwiBvMRify7Mce/S60cyi050vTMJgSHInhbxPrCXXRy2HPOph/yj9Vxu+kPzGspQC7z+vULus4de/iTx/Rd/AjmMai8p6YNAaDHYxDPpGK3IPBpRgMHAE+wqbJjKqI0yoGm4adBJajnQt/8NxnR+P4ZguOJ+ZLj6z7tN5QvoiupYG97EF/LBjwzxGVr9rS+C3h9IBdYONn2xPLEV4BOMBzBaEn6uJr90AuXYne80MbkII5zH54mwcNeXRIE15iSmKEgWAov4diF1xrHwf4BuuCDpW0xsLWRb3FEFYob4EGYbgDqSUFu235XeRLX34X4V8ydjprA1U50ccPVxwBfBWu/FUSGEQP5TMQ0s/goGgaIxjKL38RrE1oiW9gYQ3FOR7WTV42Q8SxJlWvBkiFtj/YoJvP+jFmsQFWD7swZV+oAyg/40eWNCy7vN4OztCGtAIeHDHEjxkEvE4MeE3kX14jBoHMp0EQLQ6DQKbKoD/scuvShZfc+Dxz2JVpISbawy6IBtx97vfkN8c41LIWyEO2neHBg0SchH541Oo1JzvjyFHhveXphB7SmLJg2ioL3sv9Xl2C3R3V22P1vNy9pR+owmuF7XJmiSx64zpJHQmHzwABijOsnXqZPrXNBXGnuT9zTt6wmxC8d9d5o0qFrqO0GlvapF3xIDYrpcFidVQbUCiQEbW9a1VacSStlkopVh9NKq/edW7PqBEPfmBNDcQg2PPMzzqxreL7zvoqdJfmExzO75yo7fC1ryEDi9V43m6w/iIOsdloeWZUkXHkRB8b8eix/hUfBBaF46quohohqsrilWP8m4/w1ZIuNu9o9IPEAX7PrpY0/fkwE4E+NHOuHOyPHudfe5TPp/hBdJDPZmNdDsUmYqozJcp86vPsOp3qtfIJmJcCU9ms0kRDZMthbdsrdjmZAlzb4K21oim8XpzLxf4m7piTSgom3DDc4bHI4jgam5DHmTELJDZrnUoxQb62linOsJFRyqY4UaP1RQBQ6FHFQ2cmsgdkWhkDMGIl9ahWrc1mb/HJb2Ty/JeoDL9ks0gJRXrDy6IBdkuY61s4E3zNyl65e/c/dWYAAoWhraS3NW/sB4B770sA9owUtjXQ4iRDc0OplGak1m3U+t9hYTLT5LtW3nesKCGv3wv0CaiHufOWCc/D3yeLp6ed67JN37J++/LMpR/qOiOgJtz+EewGPoah3cXxBE2HGts8ipkTDVqw47OV0RZZc75hfvjI31xbZzFjILZw0p2K2MLruMcinw2uWNdxSZ0wtUeIXMDY1f2W9cyTu/fAc2ySqUQa0fzmk1oKpkXjGzZqU6+hAPMVi9CPyC0vLDpJjyi8WI5w4zMjisNolR845bwb4SyMGrDnlnN/WwbsueXs2+/+qXWhxqxciW3ghkRDqv3zZptjsUzamMuBt9FsAkJOY7aIR6OFryQ+AnA3HMR3DM98Jd9tQHCVBjDxaUv2yZiPgAa0HXRqflfzeewFHY9WX719Qku8+iRgO5ND3n7AolBJQDo/4Dkr0YdADtUXD4FLommOnmtlKHDlo46eX6nz0XPAKFIENdfitllUy+7sNv2TYG47ZY4YnASAevJdR4z1e8zmpfxdJbVuZs7WD4OupNNovRkv+8tKhmE7/9iKGLZXjyyrU+ZYMV314z9irEJpFYXlm/xHluMHikHYqUZGJ7Uh7X1XlfgscEEEV5A0XGgPO91qp/ZpIEw8iDy9xvlGCoCw7K1db/IpKoAJFAOhJCT9iF4gbeL+IKkgCLKCCQqf1aEvhHtlIwgOqlX5tab5kVZgBGDb/NQC2bJBhMBpG/Urn7TKZ3RzzqEXKPbwmIF+RJuwiX7jpcJ4CWQNRmvUQoKjE5vt36iKKNB5FJCC+562qOWCgnPtjFE7/nHLemFU1MAefDjTQx4DaieCVQ7Gth24SHlqSjlmTKsjhSp91vXZP6gNLS4kwosJk3IZ8KNalDKCowC6JEmR4cowQ+PG/BIeNeln1WuF7Iya+5XfH8Clwo1GJj01WIYtq5rfNMHLqJENA2Kgx4ijx1xdkOjFLOIWl2cUFJSTwNo0lZIL1vDFjCJ4IJAqKr7Ph44eNLxDxOvtJES8owBDFWIYWo/OnrT3hs/UEPw9Z1UwZWgHvoL8YkZYpnnlln7uTIvssHtZEbuFdIpl2tBjUd2+TGXWavmhEmxrmGOCNE30amUCWt1FTV654TVk+n87sLk5ITp4Nu8WK2ayXFijoik8WTH5csGsztGXZ9yTtfRD4r1mkcYtIl6j3fSdN/l1SozT2qnqtMZT0vw6J06zC3HKv2JWy1U8c9NvcDddrmpijoDBzklZ86VMtULuVNlQrmsFJLzzZp0jH5ZXqeCHriPvvaH6oGyKc507Unci6vN51iNUf8dsflEa1mWjA7rVRYb5Er+boWmZvbcc4Vf1Gdg3MwhsaAiHLGxSlRLNy4dUKnRv4+19/UvLkcxvzOA7zio43N+p5qF2U3qeumyVSAmmflYmndt8iDP/ZnJKKbmH+enVdaeo5MyD7zonbhGj6LtO+Q5DCEBd8CTPzPyPoIxrmW6Qbe/LswRBdH/hluMW31nI/cX3HPDfDt18xwEEFVGeJ9e9woX+xQ3PANlEmWVR42aa7XBWabZNcWzuB87Jq1gK8VNWSZFbtyJJljaswlF5IUcD2m0Sb7aYpevrhTka/oDsy31x4+NxeJDc/Xt/JZ8lnMV1FRYBPitHU9/InF+dr7zOzi2tfGFexZFwfno1D5rHLs/o8bzltGCV1xpWtrm/PHl9q607VFlOcf9nlEL8rNYTsoc0Hzghu7PBoBcqh0qEqnX1blUOc/dXfi9pnxwfH7rUEs15HhRRVp9x+24d7O/Dee32zt7O8Y6B79oncHMrvnFL5nDjeOuJOTwosTdcc/gMbmQ3jiju+Ghja4fYsGvr4oYjxfInPfiVczISG9flV1JVXpX1I9SK/yfyhI8blZH+7Wg2E0Atm5cyVhYCZ0YtujLYwWClnIBEdp2rKg/qUlrNzeTI5yoGZap8MvEektjJBMXsBwsrf321vBmxvo+LJLLUQD6gQ28eJmvpVBrxUGlKc1Qq9S1UKLd8/8uNlFZyf0QjpZVFk1RlV931qbVpVWfnn9kRnfavpzFvJOggnEqL0RC027nw7H/y5d110Wlf11sU/W131kqudrU6oNW4Et9OCZ/cVMLZ4FspYvHGT0ioq/wN8l9Zude4qQQibv3ut1DG/ZXloqCC6hldpgRwYX9wmTkMaGBcplbLE+9VWP+Qrqloi6WXG2FvbvH+vV15X1wFZD7w6E2iDnDILm4EMgcAtSq+I6Oz3ssezd97m5JTiemRzDHMtTkDW6V3ZREOQspi+a5kUT6hHfodyed+DPKAd3GrljDL2xKN+NUYjtc2LCSarIDIC+3SbwU446452nkqFlBQdqStDrRq2hH0D1OGXgFvcHOuQjyeuOcTadr5rOhq23E3b2Nv5Y2VaPFPyguLX+oNd2dUCvR2yiIEbO7sHJrNw5L1UU+bFf1+AG/19HdIf/Ro75j+PmJf9fRz+LF6Xt/fNo/gtx0/JfifN48PSs826ff4wDwubZrdR2Z3H3vgB5vbZm8Hf8eGHcvvHdCmqT7u946e7Zv9nef09+JY/LHvbXxMm+gHO9ax/POnaDf623+G3xJlYx3L7z5+QjfHFKJcxL/81tHB3p4p7eHTSkdwO3+MEPzNo3rHO08PD8SfO9Xz2cbRsflod3vnwDzf2D1mRYUpwJugnf65Cqg2S2Zjf8NslLbM5u6+2aTitne2pAWOdnaIBqCmerLzwuxmt47w81wc0H+w8zF98z598z59y87OB4arQ2lKB8+4YkfmeHfrA/OsdGQ+2qE/TvSHnaPRevy5jJ51t8TMzwNnTZwTw/aWRfV37hg1286bOydvwIFwxeHz/oAa9UiFoj8kKqA893B1hmgvkMP5WPNnVOunyjyYqUrsFXGeOLbOS/PQsOqDQoc2sHkHKkwKAsp5wTTDIIQNG8Cd4KgTB3vA88WJPPvrY4R063OlARGFhfpmX8r4YflIU07Im4AnVLimmdg/Gbwusk0VTNP7gOdTLQivBhYfRpxtj1HdFNKkzUKmtjcAyi9dX3ltkcOAf9HjHZXJn/niYZmRf06Z+aflpwmwdu+Uq63HF3CtVhMDN/FhAJ8IOM7yzJCLs3j6oF0j4TfQcxifFDBzA7879z8lAcvqlyoOs76Zx11uw0MdcFj4cxVTnKVN7AMOYI/U5pAh0Ne9tM6j0Vxsxw21oqDhNYeM9NSAlGHMVbc9qgoZYEtUj4KrGNlTXGkQLxFsS3nmNSw/ZydBa5QxngMHg2SVjxsM0xFOcf1kGjgVREwUiX0tAteCBvsbubBdDo98uOQGTkWmQFd6lDKMUcEcBHAqsCjnV4FfUZ6cd13zRsTeZcjAY2C5n4tiWgqi99X8HOuECajV2m13mM0uL1XEHq6UjtXYUjyyZfwnV11Kv4hDmdnEy0xdrDjyIuU/2zgL/IanN8QC8FeLh/WS6FnmHiwQNS/iOWziwhb+Blm8TlKqXwg8VO7Byo+c+VG9vmnmWVreOY3e7qWJPYMPzgPxzQq+7xdOHoaGyW9HdtmNuLaUi4XfVeCAps8gAe+sf+7tv8Y2Y8807lYg4ZksU6PTimOAYFPmIuWEAY/vpmaR5G7K/MNbf6S3Uhaf4IY/HhuL36eRiZE0JQBMY0NnKTHQZcC8e6Dcm9eDPp4UZmSojY+4uhPtO7IRDNXZk/UTIwnh94G2laGstvyapdp+6cxwXVZXx6b7I30wY7FCG/C8226zSB7KKSJ8ZyxcuNtoeKKD0x8ozJrMxLf/mG2zo6kDuJBUoieUG+Pe+TsfTRzhF8wXfsXfqVjw8I6lavkHWKrsWcTc2//jH9aJv29vfek6AQnCg/s/dO5CjB919S3n5ixF6PBgRo8dMhnd4VPzs1NXtarn5v43x2KjsVMShGv1Vrc/eOW6t+7eYRH6RuYP67TVnxA9u0F09ubOntkEs7NviAjf3lqkvyz95ehvCVI9s00MDbEaO/sfmh2inHeI5N853qS/F+bRI/OoRIyNIY5jDz4PPjD7z/bMUcmUdomgp39PTAmMxgvmM0of7xNdbz46Bk0soKxEH18k5aKp1F3HTpdJZ+TEHxRFCUovLtCjmPV7IKtKpJ/Ni8o7daxZo3pl5cHbnOX3oBptEmrojYD1KvgcFMdmfGSqFJ+oqAemGbaVqpTzzWsBMeUE1CpJAW5CvOZYdfablNpHQVBUs6Mz5KOw+GCTMVH6dMtkOUOLi5u8wbAtp5LR6SSSyskkdEi9x4EirjIJKw5ewkuq+IUlWgeUQA7mWG0+Ak5K8jc3sTRmwfbrgu3YSlp5rWlGBUr0B860ylU+z+B7Rvs5dMoj1gSRMUH5BiODWWC43fAszZpYXOl3lMswFQ/uXJ8uvpVk7zkntwUg4YfOyaSlvGHN8euEJmRZ4SxmXaZ1ierHRh8ZZroTtMqU2KxUR/vSwsJPHbdsYM+RJFnfd6K8xNZjaSH7545KMvk29+PRJNSGHziqQTbDx6MvoQ3Qw5E0BgotLRNBC54IRatPzszFqTh0FdOO30koH/4zNQQRa5j6eN+7JzYUcTV87olhwT6yvDYr3rdw2N6CH70uuEf2as8PQpoKA4y7s75HXOC514blxnmQSjGjlBEMk7dv//TfiyqiQHrhucfn24xVS4EJ4rdgn1ALX3L0AI7d2UEZdDUAaFo0deLVxGcZg8jDUzyx2Y1an8Fpcb3k9hkOUnLHqdp+py6BIBRnZTRTa23J1YSUL7s+B1fKDwciWIweDtnDq2lSdV9KIOix1zP48MSli5zRZGHRsL86xo/hRxc1aKRzyOfEp+IvFrCBfAnwe1ajt+EB2bzi98+CdjNRA6xHuKVvvIQvPZr91L8M4RwVSSsQvLTBIiY0nw7Ft9tLX/yqt9mTGofEnTdr2ftM/tWS30obGycTDb1k/j2iHPnJMDyTq3xH32uPVgR+gPjTQvaSKiEvUYZ6zGWdbb7SD1+tM7mw40lZ4WdDz/ucQ8MeRnQyl3PKnm9YMYJdPtdeyiUciAdoyWVwpv3Gug8cCIb6ho6nAQ8UQPU0XibKeFXr22Y3l/xxwODipVWKOq/xl6Iq8WvJkR/ThKU/GZ8BLUzpugenADJYMW5prnuN2B/YBC3qE2pgwNrhCnqUn5hdTdFmNtENBmfiBFvEJBOoRwt7wUTIMM30UV4YpkR8MsHCDpabCGIh9i2vho7GolLUTQvopIGBU+jYKiI2CsCOCMe2HamdFNOnfW4CKkLqCG/CQsqHtcto+lLSXvKLBh57yI4TQAW+j520qfUWFEUB1GRPUV44urD8mysLS/PTWoMd003SipLSxaEpKOlNO/clhInugTDov2R/0OJumRgixoLt9AaXOrcRyzY4/IAXRK8Db4/s2mXC704ImjizV2dU/TZ70mzDd6YcczJqczMxd/lGi/K71ilfG4su+2gcGB2MUmYTDp1BSlBdqURq6QlMapnCXbSmpwYvgi07xODqBl0cy8mXcN36OEcQn5ps+9KrQYUIs15Lok4QflUrzPsIaiCAW68i2qR9aVMkv081e602FQDl7BNaN5DRRN2jXcLrTsAFZBhXSBYSmKgM67xawz03JH60eLD5Bju81Mx0OUDo3K4evAzE7SVDumUmgi5NSZnyydZkKFwYxLHHknhYYAjakQA7jIEuC3x7TetTZNT+QyinsUNFSA5RoobRvQMBqvNlv7Z+cvUBVhB+QCx9NznC1cLg7U+uLB91TFM72rF5Qtd6IqTWp++mdaVN01fb2gioGav5YRkQwrDVpxnALxi+FzQ/ukXTwXSAxkKXWhnNxu+e03TlOHmfwdcmMKV56eClQrKjdWwsH1AuYREVE2EyBsYEzHIo6Xj+duUY9jiGCVh/pFGs6ONt+0qriIS9KP5L/UG8a9bADOBB16eJRAE0F3bysBgtBXgujmERsP5xEQ74XWzLnAiuPOmCMUCXTrnmVaCZWA+al8auyN1giFdFjkMBcclJgZ4XQG0QaoycuXiSp5reDSdQArUNu1Y4lbJ5XmgQU6bIa62Shqki3fNMwTXoeEyZQcH3LLFtcvk8jXH1LlALToArpPevvDP2gV2k8Sdfk2zuSIb/5055fm71IaMAs6SVyWIIc0vEnEXIJH8BJYQJt+UO3Fcw6b79sGLPB5mD22GkmmSKEw0LdM1q9Cg98oSxQhJQryOlMBFNZQjVLsa3Swv3/jBWF84Pyeg+f21h8cOUOiDUl/Ns+8y4dgzB/1PnhMH25pNuDfacmfxN5b2rOP26BGre0sLyUsySzLCCzTVGKEbgow1xNaLhkVZg9yQAIHwhKAIgBZ3IKuXXThLKgP0b2YPZt/t/mnTIBm5UPLNtBf1gi00YaqHa4IlOq9Vqpm3G2jBhNOrB1+Nav45TI9Vc1jeTfk+bAduvNYOntPEjaTPQVCNWWURHWzxmxmu2uMxEWO/QQkuLGgbhR3alpehSO4A+achXED+tR+J7prXvt+V35xWfJx3DmZUfbohysR/y8xAmfh09XKL1qKPV64hLV91DROO4BnqFZjbrzOoVxncb/VO2bLQWpPTb7rLycWD6Naav8BuXxFS0xzUG3GS3qSQXux2AUKFfArlcYkfmoXW12WUXwfTFNySSpqCNuE27wxb8wgCwch9yCWumdUkEYUdlCWd+uMldixBrR1wMIjVhqAQT8bDbVNhNzpoxahPevJKuPd/WIwsJ1qzfGDb9YFv8cHP4KRFTfbPpn8KeWQreDC6stcTWI2vItvV412yxS+WtYT+kqm9vPjXb+yVqvaANkM7tA6psVxnk7YPDfnBxSdeS1+enbCMR+TnethL37cvunl83YlW5c9HwxKfDo0fHhgfmo664SH1EDWEeDVmn+vEe/duhv1KDWC167/HeM/xtXbZ97gwKfzisEevYQLDU452TQsfmCU5pd+Hbjn5llYbZxUseJ/IT1OuX9EtTKjRPt++Zp4e5bbbI7yO409VgrWfslHlK5Jdn9oMBm8By/fflIOFADmsPiEChSrPxhjnE+AvNkRzzHsEq05QeP93jnx2RiHH4sNaH0/TSh3vo05I16NUGLREjZyvAA+5yiziFKIROopYpgYga6OVprVvDEUSJTYlLMCYoDcAI6Yw/hjTh2fZhSYb0s0N4ufN8lPbsaM88Q22e14R5e07LDhoupc65xmyIZt6pSeJlYjWSwCnnJ2edaaCy3TGVvJy9mjUcxJrV4ipAXKIDXJUc0eJbNNN6cnvnjspOYgBxPWCGrsD6epGh34rWZTLMZvc31WMp7aYQ/969y87AEu4v/pXMGfq3dQQ5ba1JrVDHyvmpnRDqzIL1By4Zy7ZbazIBgrP4ekpaYcS1cGx8Um4OKsUxB9SjRrAtTqxrbhVWrjD84AClaNeI1uSbUSdgMV6zrgf0S/QdIELZy0Nx0j1ZNQ+x9+QnK/DvwJscY9bMm1U+5O5Jp81T86eQDEqI5bVCetbNTE+ZudsVcQtRLp5UkKj80C1XVuGI94tbPj8z5Y0tb2f3072gX2EoGKipO677WTi8qJgq9X0KoPOWoOxQW1cjadjqFZ9AzF+aWt+UvU97F5VUtTiSgvXOKAMefZ8n/WF8Dr8X9EFVUR+YZzPEuw5VFDrDVCGpf731FNUcoOqxpsSPaFzW5HOqPHC2WM/EnV9Fu9Br86vrtiUmt/W7HzafHCOvT9Ae7sleqbJqbiX0MX7hzNzmI8ykPxrBC7TxuP29ilUVMBfpGLQxLeJUoghvi6Mu9tj3HhGIawWEllULzcIHuQyhPQsVPApV2C9twiIcirlzS4v3fu7MA05sPDr1lXKjlLkEyQR6iSimE6dylWpK4Ogt5ZYegGQSkat4QJeuvmXgwSoikGDbkRojoKa+xEUfU2QX1iGhODW50pazVm49Emlj1KT1HP4zyg/n8jMpVjdBadCan6tYHdtVUOJd7xxKVtwYK39lLVi/xED+Ggh3mF7pMYN4kEnZE5qvV3v2vYi6/H/svVtzI0mWJjY9u3Pp7pnp6u6p6e7pnm7eMokgCUaSSWZlIkmCIAkyUQkCbADMrCwEGAkCQTIqcSsEwEulZ652VzYj6UG2s9KLbB9kelu9yGQyG+lBJtP+BEl/QNKDHmSmfZNMJpNZms53jntEACSzsrpnZtdMVZVEeHh4eHh4uB8/fi7f+dhOcAOtKGRWC/HYdUTvGkeTmcundVzvaOqcuL15eALfHGVmnqPMWF8f+vt6BL8wJ11tnrRqvARcC5clASt/aB9hPlxFMUh+AoiCmSm4sMxMQWqvN+p/wgFKGZpq3AlhZXl53o6BLCTigRReR5EUQPRXlh78EwOqIDjVJlpTGG/p6PW1aAyxSnQgJ33PlEZT+KAbp8SNfmXpk1/eGKByaeHBSHxKHSZI7wTx+aFFmBsLG/TiN58EPPObLpJzIWx4OhxZ7/7PG+JD/bbBod4TGAq8WvBbBYh6X3Qog4gVBYmCFC8Q4ZTBY+jwTxDhL3j9NswGb/BqFIFcELk3Yk5z5II5E211bWP9zluErE/D5tJmLAQTGDGIVnVuwd9CJKruSBgqpATuC8JqcPNhNIfx8MBRWAcdU5ZYgYS1wGsllp40MW2UOrHXEuLlEywspmsIuDl511K/XaY1txH+w1xeAl6oczyqvP6wMR3LJC5S29o8Fpq9fM8eQac3d4XDPswUBLqHj74HgFoJiPz7tOAxvn28YfKpvnELmUSNNE4qoiYuvfvHELqLklDPBnkct00/kciuAX24YbyaURmOsnBU8FjgcSCKa2745LfT+/9f09uKz4HFaPQTl2xrG5ANovprSUC6jKEBjcfGkd0RdR09fCwAToSb0+EQ7mNfW3Y85W7b01He9AcfsQ3R1iDi3V7/6kqJlCCCz5GNd0zV8h78nPDDjn0WFu/wVxjx4g5j+mkhVCSb0Ug6rQhN5xr9fBqGUZbNMhMVs3H+um0z73civunTeNQ+Doy9IZvn5Aa8dRmK52vjYwu2pKtlRJ0rRX8l+nh0eEZvYmKdAmFCMTaYRunTwU87kJjQWxe0AL7MY1kLFA47/sDSvNwssSFNYsscHRhk1nbSGzPqaI1DEvTOeuKGiMCA9G6RLcWF5jJYeiUxmHWTIPSEPsHQE4ltHTmoG4vLNtSFI8MiBAWSTyyNRSxsniMhZBdjptQkNuA33+KsPlz+yD5aW1ubpb3g7GP2sb0jGbBZm59VIVP+eIZeWfOyK8srctsU3TYlt93njIT2xpufiu60bqvkwTFgXGfCzX2ILiaItPPWCDatfrfXgKiZl4VItjqC2aLNZGhcsamKrJr379+x49JxQW3RcnEQw6q1yPY/Nl45we9szYZbvUW96yOe2Vl6TJxtp3vR7DaSxrZnebVu65dO8FtbU7fcqxJRd9xYZPkxM9eQAo484ZOl0Zhr8QhqGFhEjl8l2QCsaW6yNXMeu2NWy4ww+VveWPnl2wGEZNSOlV9ZfkgMPlzE1JE1Ar416ThsE0Z721hEYjsszI9Jx26x5scLr9xf/oV9lJge81Kd0VyQ4ArDnGoM2vev7Wntkjo169jTGr+nOmfXjCJkJvriM+8D9bm5M9TNfUojsxaFnp6ZRuxpeO2v3L/3Y9rSCbRbJEb692Sbt5cvbmXysK+sHLilzHMXjtQuYmvBESm1XSw+zcHv7Jl2OYP7Nftal7K/PsyW4WtdghdVOVsu54oFS9X7pw38nCv4XLtEO3rE2XguUERhHnbWc9ljqB3o6M9aeqNXB01imDsL8SuIsrDRO30uYnmd2nwKQTpX7i/RDtdMQN5da1y7hZydCA0ZEeSZFnVB7DJ7Y8bWvWkQiOzLEcsNGgFProsnIm6JFzdm/24ee2NDzzmOP34MKY6R4WIBRGsmZN9t9Pw65dbkOjChtaPQghjZWHOTDbE7WvjnNBESC+na6AOEJ6OWyJOwYrCiBx3HqwVWBc1vO8qKN8EYnsjqYVoSfcxrrZqJtYqWwsHCf0YvDO8W7fHspAWv+u+gdR0YGNzexnBVQ/uEx2G3Xvoktzbma3tirGb94k2PRoiodhYw0pT2hYi9j4FjvOkVox6MV7R664TSEUxTOio98pINUZnBRcM5Zs4LgxMmETKEaWV3jnkcaxdC+3d/JwriGWykoLxNafuGDZNO1ayUFQ2ucFMEJGkeyjFQSf0ZR3hiUcqO7YjwirGdkS+KgMbZmDZA20Q1zQ2UBJcsBwmf22mK2kBvFygl7Kew3GBJWYV7ywarM6rbDUNQisffTbuu0JKNj25XrLBjezC2cBsRbvoBHDBFmSvMegxyCuMXzHu3H6p2jdL2NsQoqr7TujJ7KnOUpkRKkWgqjEBhaiYelnpoFRTIEc9+Sa3ggaNc96zeGrhafd7XRBBAlURsNK0ZI3vQYqR0FMGzcMP+PvkvvTdPvnlubrSXBx2mqcIjSKbmbQwBhwNU15oTLzFl33ApNu+uEPoumq/XV5ExZiIJy7arZIjtjqUlY9+y/sSe8v4a/vqbdxgHbjUCl+MbOu39a+LXtegGCFSm9DeQqfRNrz9yy/sflbj+qJsp23sepG94/4MWYmvlTe82sop9Giv8/vf72r5M3bYg3jxm4ytV5eZbf7tvqxk1WYiw/ROnC82PQM0kypNY/VK7YW5o0iwbdoqJPQj8dfaJWdjHwDflW34oj9WLIZagSa0AcVkDci/5yK2NPImljE58F+pc0FbNSctDtOTUoZsuTBx2zX3hNX9gJ5IbMe3ifxiqf8BAupwg/pxVQNoTRfKRMhdC5T5f0mm+GJNZuBBQQFyUMA4vkjMmxhjFkXhhr6UhT0o77JUtKMLpdHJDVSfXa+yqDYaZNhCQbIyJNdbW1AYVTEOwYR+pO3N31zYWqfr1NAsdqq/fyBZ+IcU+2v/STmwyeTF2JuK4Tj8MbAKzVyNSE49/YbJF8xmG8TzWceBqoh/U8lutwwpFyNOik9Gi4yguMTTSt18T9cq9v6CGsrMSBtOaqXhDri4NaNC93oQhShSDnndcTsDKJRMR+U3NGlU63ZwcUUWFocX1OHqjm7S8bSfWEngmgNfUYGBtIHAxMjas0C1Xu5uVJXwxZa/RbnB5Q9exskPbzyh6GbZjsN1qThxfqfKw1wN+qceAbikrMgaCpbdAv4us6kfadd449FDW94FEPCNI6B/FVHh6P3aUSDHBQCFBJk4pveu9vwodqbR/cS5yPG3c2tJUrKmpm1o5oRsm0XUgsTOPBXChldZq8/sPzIvAlWN9gtvzx6zzpBEF0AamFAJ1YbC5fslxRk2RlEbvsvS7fHKXnfULLOee2BdTucPOq073ojNRFhBrdNFPo2ilc/H7H07rfuSoshAqwvdhQ0mmJaTo5/a1CyjO19ZsIIfdIkZmTHq6Y5M6Y86xGXHMsIAQLtOH2IxB6ek3/kO7uslmDo9pIXICu3Z79alN7mma/nNCBm39Xo9+aofzlofFojGl+J5dpYZz/dvRF68PJoSmzizaNRXVShXOhy8P7HMzceWLrtz7rqCgC84DYy38eYjSTzdOSMqScbkYPZDvYlS162V13Ut3xq0eQnnJlNiYstlDQUezT3C4ngZ9cx/hYNrH7PogACUHENEKAgknA68Pe0A2lxLQoXCt+CNqPkTY3OAy1rrM6WmfQ3wEejm2InlhMM9l2XCCYcAWhDLedJW/zMr937fXodpjqUTJE/PvsZoptb4hBDOs8toV+dIrK2+1IDtsparm/JrZhATq0/p5nX8EkU592m3Rtquab9W62nSv2PGe036uetCrwVKvQZvhsGGU+nLoBYOSFgIJDy1dBpOmhXd/HarFqfefsOEtu79o3BnmEOrgZ82nEVga+glioMFsVSZ7QP5y/AsPD+/Sawy5mbH9nNe/0TaXAxHEUFtisQfM7s0fxEYEc9iMVHCDaYofuCZQBpbLnCydxeFAg9poxcsBEF+CID66OIJ7bB93zjoY2cUFjW7PhChhb1w9FJUIUxEy5KLztcovsYvVMQ0MdEzMBfeXY4y1NjraTNQYGOme/TVql4hfaTHHsmonq0nGTnLmq/PrdFyrruFQ3VifmyTeI2RPqmnHvnO0yRryH4LUMGr6wmPRnjc0fBZUK8BWESkQdCxGQ8pRkEJJjAnrA30LR7OBIhHmo1oYE8UyidQYf4E1xgG1jyS+ll77Vh5iuaGLyuFlIRWJQbTxuwPUWyIGDkdjZWqnYuwKKB9X9OD5KHECTWKwd8adZyVCAslbqyHyNbp9Bi1bWfnk09++XlPVz0BiqIPiokoBZfu+TV9bcJIW7tywCTM7+gg88yqc4/HAXxiBXguCGAOfZKZkfPrJ3GMDztBVnQ9tb1AXNVXfaw4bJhabseWU75kMB6uzyIMUNjkydEdxlLk0kW8FVrjn0x5qy4ZVJ7jqNRq76+C4ba2yQRAO1gti8FbXNtK1cZNaefrkDbthbDQiKe8dSLdpoEt8ALDdCpwEb4EcZhdAJn9gw6QyUvIhzKOJ5BHpJEYsEnV01ZXV1X8mTHy9fwqx/FBwxsErK/N9DNv+IfzuvPNGZOes4hBmukqDwbnM3Es6l7u7izVe9NerR6wGo54VrYThIFfvrYQLeWyvAHbyurll9Ba0UG/CUbnXGmfiN53A8PDIiwU21HWD03EusCWyNee2uvQbmGCuQhdwy4Sfub3vRrpOnn7/YFSR9sG3M07kDABeYqo3qnDlr+yEGVLCOugP487oENzm69Ru/mg1bDp5dAofMSkIviANUe9Say3skCKKYTY9pltXKzp2x0jV8bZ8QEN0IJQNvSFfXd0zmpBv3i5dkdTz7l9/53c0u0d3sg5wUqhSHUumqrNjyPW4Bzeb5xwPT6FzGY9c0L1mpzMqRTYmGyNRj069wXsiH93AXsAFOjLeOHmPjcZYtCNvcEvEo5jBhphndE/iC6Sxh7lmpYH+H/2AVvRlv8Hw4y0lvrJiS+Hf4oMjsI588B/am/O8TEUe7sF3Rtx7DBsRWWjd/uFjYC3XB8GYauIDBoNYX/ztDokoUmkYRPCYITm++ejQcR1uHSRDLz5Sbh8fvA4+stkJkWleIkJsVYvWTYFvNRvBNsa79jcfSuH9C8OOmAssLH2jBuDBri28wTELCApKR5+8AuiMQAnB8Bp7wBCS8MNCNnDUVbAaVTZ84wDLCzdZ6MfCNodv1Lr6kMKTUeH0b9x/IqH4SDczYT0W74mPiAUuMziNlvz8lX1UH/AWYT6crh2I2ha/CNTaUKQpG4pxaZDvyiANaPqu1TvdzlW7Oww2EAk6EZWOXZmhCzzKaaaA/UqYyi2LmxGuz+BX64Nw7VOiyzCyx5SVBrVIiTjLYNA/id2UgluCNgu4ucvWatXFeF+ZmNQPHz76keZwmSzLoCf+scrLi47je8tnGO19gPlE/i+/sLVcOBXyqFrMs/rJo5+L1zD1u6U/wKIWfqw+LI445U6vMwmdXq8pxBebttj8ZJ0Ot1yw5tan8acddhHRuH+j60jVbweXtdf3FlYYfCzHPiqyc2LTfpkWkF/ceLt6KWJY52UUSVF4mmVjiT9bs7S5C29fasbxbE5FU3aWh/q7d78zbmJ/XIeLKtPEY++UKOexPwh4/zsSgFjcgccW+OsuZpqCj9DsMd0vU2wTIygGzNXXkgKm0jqgGgcwNGHVRlxumWhFqK8cWie0msRPveXXgxBAK9zs/FNby7LWnSaN/y0WS/J6fK963L2sSUCWGxUTTLeuqSGstIAHR1lMzE56ITWLFf6CN/sv7XAzTzukozv/9397d4aGIVQVdhV4+Wk1KXiySvCUYbIGW8zqekohlMwGNg8aUdZA0Fbfvmx6s3/+cxCgj2nHRDkRVUoj1w4dEIlQKyLYaOnSA3V/WT1YYXQi1fOZWv8rG+W/b1enJ2vi1Pj5yGSZii8SBn15bNjO3lIm9D+ZmxXy++7YBNmSf7rDXy/RhElZrz95E89Q1ws8eJP6mhKrb67Xm/6ae1ZuuIdjknzNffdvvu/+1923fPN9K1//9mHHLa9W7yVXa2qZDis1p6mWnCb9Vpc4sIoCKpiJtvL1Ra0bnnVvQXry7+RxqRvff/Xv7PVGHnXLs0f6/uZCD77uAy0tfEKHBMM+NDlYKU21v6OXip6CyFKiCdaL4T6rUaK4vEFtnrb6czpNO4pQAymzllcOFHK4ENIxVdYPbHaOg7z8TZqZMwk4sGmid7LXHiVfL+OFuUEhxt6f2ZvOUVpKxhbyd6WPDPj/7o67/SS7/RRgADoFy0qdZDNM2Fju58rbOq+Q2c+qg1xhT5+Xt0u5g0pZlfeprM4q5/HHd1a2Te7hjknVG1C7iVv2wMVaU+fY7PXh4MxlVAhO8QKDFMTLWr5/fNJ0G72hWz/RDDAyQihJnHS6bnBR73GalrBu35TqiXTbZZx2ZPRbftsfuP0BA7pwziB2i9+hmk/kyEsnUoMuLdOqAdy4E4n0zehj7rDjw5jRDfoNyYFyQI6j7TWZre6pS6uwC3R2xqE3F0z7zXnYIJMx2uwwdxAv6beaLuQHrpQRaAfX74VJfiFzgkIAUmseDwNXC/Glm3hPaTaSbrS9oy0l7Vf51xU8NrePCJk6q9Xt9oDLDyyiJvEwLhigV2hgu45COh6ziaboRxoewYKCrS8ao0TiRm2SWB4q6Pj01+65po/5pH/SCBPny1HyviTP+/0ejMZ6wHSDXBfczwm+Fnx/BCMf+8STVv00WV1avl8DN/XKlZeE6QlsyNoQp55cAM9Kndb7PVcHdESSXwB2enzWQvxy/hq6ivFcDQzH2W2O2BkvqHP63gkNi7Ob8m6qwGQx5wdtT2DS3PcMnNipx1rKrT+ruwbA/6wenAkEW1e+/Zl/emZaDJwUV+arOuv2eASKRXXPqNnOAINCraNdud+kTzi4jKmqznzidd1uxwx31l7xiU75rcgEMa64ikZG2HK/Rze2feJ5/d55MDqtX3lej9jRc6+5SIP7hM77Ha/l9i/d4+GJi9CSlHXF2q9j6q74yAvzhoFH00OAEK/NUmTofSGNK7+JnPC70tTVfdSCMUEAaCrVojaetIb0JcOUC+aeZggyNCQOkh1vgEa4jTZRosY5mhzcesGlIQo5S+xyu0td2e3ffO/4xfj9wD65om9w0h0/d7WiFdkMoyOpq07DbdZpM9NBPD8XEVoj6oMcGiOBahuKCMLTPkueGJcfSjP9afud0Xv1NEB+/5IPAxwCepomGXzCYZ85ZShXG1CkNCxhiIpxEJomuBD+0PNZRSsuhHR2/oA2xjS8j6lDqG3UR27cnjV2hsJ044lAgYUJlyNSA4k4zKH1oNP0LqOMsEMwLGTFo5Sh116bhlSAHE65TGFx3ut7sBlWnRgijZS5IctlMZ18MH1w0cU0tfWZCP+a4Slg7cwHZulg/Ovf8OV1llCZ0TNMq3D0m0vhp2yciZJT5/OA12lqHc2McM3kLgmGbdVte6d1haHDGiFXLI3BEDCKIh052il/fmDBMUQrfSMPeIbeSNZpv94B+iH6P55vBozpZX3UAy/8ZJqomOP1qXXbBT2tRohS/ITvbNOGGmtat9OsMwxvSER7wF1yiaxHKbd33qrzLrxPXSQH+Yw6TfPNJKljJQAN1c4ekUT+A0EcEl0z/+IOV0f91Rk000YyaFhK58tptydReOQsAMywkvidbghyymfoXiHmxqKbrrOdN5iDPqN2dQG06frUPJo0IP4yrD2z2ptFfxhwhOCIbASabARnwwE6wAzRsfPwGwevfM0ogCzTX5Pqa9OaVW+BRkfJiJuIsphp4PNxLokzo2WST3UnM7sRCGpT0O33r8ILsRNXL4ejmbG1QNwbQZiop8W3uD8Y9sLXHTmNmhULikz31iWguMngXo/OWOSJkyFIWRP3eT3tvQyRKCOkN4TFCRkI90IArgfwrSZa6ulZY1ogTB7x0TrF40CSwm1IesRhiblCmWtypl9Sn8jaMRi0tJ0IEZ5XytCNnkc9G2O8UdSc4pZhH7DuTMIxg3hd95tu0+9z+rxdbygeZMNotSYGQzhAHZHJBGWO9ei1HNe7ZD6nGV6KxvhITnSvfABzpgfJ6KnuM53JAarQYvcSzP8xB43CEMUP2OUbtiHxbce/bWxqnBW9jdGM+EFZvmlcyCp8I8sl3AZ32kr85AHzEWiDupHBeg9zdStj9TVMldnCfdjSem3FHF+FhM6Mbvvi2z3hbol8REyQyepxOMaQsN5EEDU1kS8rFCA2+cfmqIlTpi7q/TajzYIiiLz339WqTJWh/1TmidrKbD89PFDbLDHYKan9TLmSpcNnqpCpKI6VWy6r8nblQJWLGUgKVOWwoCqfVSArUE0Yw6nWcavBP31FifaZ6nypuucnqg/URqAvqAvKv+hrG5dfhZg5yZqVHMUag+rge3bVee0wFiusIxsTi3PsPvMLjjAgsnyJlyppRu35Sxu2ETqUQQaxEDOIl1gp5VUep3lOFji3hIwSZ5Sf5HYr7FDAHrWVp4c1t+pcpIHMlElmaxAqpdUtz2XdcQ1tC61z/si+K+HgiFAt/FMdC84ftCHs4APw/HvBRL11Ub8KGMqZz7udCXa2anR7V32m4GfdAW+DtHELJa6Yi9aIhLKunfkngwmayF4wgWriMep8aYMOjshqayJIupZj2oMpo8Rg/MumV2/iec1XAqQONpkRfDEFcDexaoyADGDfAQOBAsEzCjVXP/e0OhiAh8NA+3oY5+FT047A15oVGbshrIRpSKerWUqipnQzjfbuKy/yRgP1xNrHqowJFBh9zmNxUqbTNq0ncuAbJXnhHatX7ZMWoKmps6xU3OhsXtp46MxXnaZE7mwiKkzomoEYMdqj5CO7Or/hOMCtEthDNnReZ+Xsz0bQsuKO3iPAWQ8eTEljQ4OvuOkUHrLy4P5DexwiC3rB11a8qKBi2QtMXIDYQTeu3G5r+J5HtviZaduYArJyYkaiTN76cHqyWJPqR6/aOuSPUW5IoJxFNdR68HvJR6IBRGSdK9hpO1swOIPBvWicQiAhACQwNIIVAQe+++8MPvZibdxbtMEhaeodDFoWRoYWhByLMW6k0e7VOyjxHnONRh8BcgQEJYyzo3e5I3YacNiFnUY/9PocV/rFzDNCmwyBWGETYX6ET0xsf1yygrp8Wk+Jl+Oyna4uPQrDIug6bLOCafohYCyhKQf7a13DZhkYWw4TPZL2sn2vMWLU0Q21jKJgNNAs9AfrQR3igOP1GKVjixG2oeLdVJvshW8bUI1pyONfitr2ZW3+pRJNcGRdcAW9csJZtMbLRaVeixpNk9571cvPajJ7eT5HKkyJ7DSn7lWPt2rjrloqrqc0i1NMcTlmoBG7Uj3ZzdfSss6d2cZ62Vgzi24SJmSTSAPk0rHn7jBMDNBjgPLJJqRGIxraiPqdc7juBmct+gNvTD+Xxmj0+7aARKB/PPvly5fGLJGSqnr2hI1NdNwqNu6d0opz0Uua3FmdO6swGack28QmR5rjp/NX+JXxZK3qgEVJCTttqPBf2NpxRCLOwrMjBiSR1+sirLGBsczcUtNrAMI+nF+nQ78pRtlsje3Bdl3jyPgs+Olo/OX/KnQIaDD/IyOR/cZpGis21mtAR9ENAwcQLQA7Lvj4AdJsYcV8VmCxLdJZHaFvgHVNkzQYEo9+Kf5pbgMxVEANmMGPDLnoIREJEMssjm1IU4gqc7U63wf7KOG4Ric9/Qr0NF66iza1vBNaXpl541Ew8OkQeG0f2mm+S2rXWWwo4L/yTJhYiRBLD2KXb4TK7WirAXoIbWpjobrY1h3ruWYtif9s1/VqToyCGCdoxp7adu57F7EwXLKGw11lXiQYoEyBRs/w+0RcieIOLDb8w0ix2EHqRjvnBQkJYfTfu31f0V+TuN59epF9CGOuVBkwzIgMzCdEWukPycrZEH/9gE+oI+mP08+JntFfh8/CcKhprRpMsPmrSqKTM72+ygxP1Q7RuV1iFT4lHuJTYnw+pafs1wFKfaUK3XNVpF4qez0rvJfqWoaZMx9T/CtGOFhz2dZL7IvDYF6sG81u71dq1Z1yTe3tq0OrYrFpGN2EpTFuvNOP2Zbx5STXnDQPqk5Uajc9OmKsxTTj64p8ng4fOdQU9FKHMQ8ZoOgGfgUvZhKvPfna7OjZUNV2529qgao2z9pBjbZ4WE5ZoqYA/AM8tLTS70WLIc/maXtd3FLfajP60HBehZzWj+zI/F07evyBfYehkLJElxxmL53XYH9awcBENAFkNLEEbcuZI/r8xopMt9cdh6Y/bTmWtS/mtK2VvjRA2aOkxiBQc7Q0EFfGY3yhCZ0voz/FYXVmgPY0g5Dgt1xiV4oQ0MmBEZvDgLcmoxYFX3vw8HTsdYi0nXaU92VHEDG8L4WtpN07Bwxus8ydmEAQlq9/z+g5n+M5oMjMmDd8tkRtsOG/QbFpaoeKPpyAAk9zFTwBIh4tzYbmb3QcUe5LOIU4w37r+pV/qR9qwsCdMDnyBzBuItJ02q/3zjjCShgULhgeR1foJJZ/7dL41XgBdM3XNTyGw3P3vcMhjNzxR3aVx+RdY/T4OoTukhjuRwIUZsNBCmujJROmuu5KhZH7e0LgLSL3jZ9xdfYNO4pp+1q03sghonfWA4zYr+w7Ieu+yBy/HhN38K7sEzvtvFbTAu77q2iPElbU8ltXPZq4CyufPPgzezqqYVpiiK58srwX7jdmX07XrGrCqdZa9fZxs25QOo+UTNtZWFIQd6PtKpRmO4BfQcNi6X318Bn71XJFEhF4GpBbxv1qJu7WwgsZbUk+uf979jQWl7/8vuwcaL2pWdMhVzQl/k7MEcHHO2FN1QRhC2m4PCXEovzx1LR2jZKJ/RhGqpOLlrpeD2rXMXsnp8N5aM1NCy4cW6N/W+u3tX5b67e1flvrt7V+W+u3tX5b67e1/l3UCj6Ws4zP/r+hP8C48G5h5WNs/rT7lLZ9bmEbf8QoXB/TjkvEh0nnApJF3LP6J3Z1XdUEkYoK+czJs3yR9Ruz82phXlXdo1o6yb/oqOT80eTGoltT4uJi8XUOSrQ4iY55/YZ3dGsbR2+5s/WZ40zWAIXlumjWx3boqWdHrv+yo7vjBHPaoYxSd8Lu550kX6W980gB8Wp/YOvt4GvaeVXvABk6mVZJ3pe+wYejkjXr2nbvfwtxEWBxdWp8UBMswWSJTIN208O+AceUBxv0kjY0EL36KVuGqH79QgWDKyPag0DfhFWONCBXjRYLOfsSNm0EO5MVhXGoSl1ITE9b/pcQ4RqbJS1iZDCVPuAoWTWs9+iiKAjxRN59zzjBGIOOOhv4DjuD/pW2dHIH9VPK7w8Q4tPEamx1ET69r+NNc+BpidMoip4WK3e4FnVTbQIi07jSiYHb49iO+kQXCQbdNizHdcI1TYQkWzX9gCuGuNfg3UR5PYDs1zW6jIiKXaC1dGHczDIQPrgMjUYfTL4cW2qfDFt0scX9e4oQwn5DjHdO/ZOB2+BQkdpcGHGalc8h+CAIcn2EPgxx2BgflEXE/lfSlLChba8eDPU3bHtNv45gkPUTBuqEwVFLfl2N7d7tMzwzK5fox5UIwwL7xhnSBk6Gcp2B0vYOvX63CTc1fdTfgUM9YMw268acjfGAVL973B0EStvowDYntJjggOyAIoU5sNuDHVH8JP4pRvKlv4Izn8Peh5ZdZ90e/7jcSUDKof6r90Sx7dbP636rfuy3YNUxqF+6LMSnElCLM6JI25PgBToa+BDmc70+zPXj/QujJpd6hpLs84EjjwT+1V0ss+HjEHuUIaNkjLAKZtGA/4ZSdgX7aSYwj2xG91NrG8AbYTmqSqfWk7VIqWQUIDowgFEncTzcCJj/T2kmMkJuXIXzsV1NQowNMofSAUv1J4BSMUl0lkW2byc3Z+4cra9tvH5DVHx+lqs+anonArzFuEG3F6fLP2awtUYraaUBK1NG3j+ysUTedhMrHdadskEAqEUL6gclR5FtRv+gsn+4/J8ysptpFh2pZeKYSYlhh4Wu4lB8awu/WZM+tHW8sD6853H7QoEZoyJQFXfTtzcpwUqM95UQsIV0+JSluxyqjwNDQ2tkMSShrogSCJtMxe5bXKw+vFQyu+ut20qu2ndpaF27qJvGgV2THIo7ySYfabnrV6j/PQPo3/BgeXSPWRQnSAikyS3tjIWi/sh+/PjxYizo9M/sa/yeyFsfWvZ0evZ9bx9WOmun3lcuNH+hCbr5nkEQqun/EzMFQEPMTGh5gxNFKV6sWMcDiwrFwP3gOhLQZ17S6qcLI8xoaMvUHWhrhn6IX2ZQp4l3+FKzJaCZSWPOoE0LYFQg5As0bydsWY9NFmDzIes/Q8TVOThS3DDD75hIplEld0wlWrWLS+DprBouGwJomVJspCExpG8u+SuGVUxUmUnt+C010OWkGNAZouvU8bX0CCrEaOFdfiyRmgTrr2G4wnyIXvzpm7+f/DDOySePvm8fCYmwYVHxIXN59YPn8upvNJdX7753LQgHc8P0+9/ujI2BdD588PfwjE8QYpOhL973pf4tX2we/r0sNivTuhfe11OMP1qdfblAsyehqqweYpbkh+LpuxjN70TkvD8dwjsnGekZUWubbk1Dgv6pqMV4DxaOv1+OwoDFY/Og8l/EKhcwLmB4McbGo6WHcnGKZjpHsRSrvCievbNswtk7y3Q6pXvg0fKsnZidnTVwNLEblsIbGILmx/ZaTJlc20Dej2xGwggWHlO5N7wsbrO9UCIdxR+qAUYE6wvXShcF3qYKnTWdVU/99tWwxl7gvPw8uvfo1hqqRwgiylGN+Pbxm999T8z36ElJa1EM+D4UQiuMcCdb0AgZCc583eHpWZy6U70T2Gha6Qh1YwwgaaDhNeD3FIJjgTRdwA0GDjzGKm4U1qg+iGLJx1CwzDrFIJkxhCOzVEUIWEmw2hgW/7mMiaS2ZOQ5zlBQZgEUvCRrUukF9/jKgEUZdBHYGoWRCifo7dk+aATzCbZME7zMDuiiMQ3qK7QTRnyCycTGPLAq0w1k1N0QCev+aEt1dJEuNviwMmKApysvGHm7hP7QzuJd4l2qR3drlgSepKUNBcJptWZr25b5tyaytBqJehuFtU2kw4CPgPP2AcF56zz2AYWYmBACIAjQf2Mzbkl1HRIfROG2lGQghKBIlzaIri4qfIx1lVqnAmyPV1UbNQEfWUuvcbj0ybR6+xa/VbWeZiiS6gYl6BqaskHnMLrh4OoIk37njgmwDhPAt+l11LGh3qbfotxbzttAfDYYByrnyDliA8G07MI48CHomlpcSD1+icxlu3pnc3LaADM1hYOYWSSqqFiCduI0a7BAEstl9MYd+2tKwiJ6oSWfw8R9k/iQvaXlh+qs3qLxpGEW5gzKpjeos31sr9dwpdyg+4pGPY//y4cPKPPhPU6025e8y4zZV0S2YPwL62DBb/7HxurpmtXRGBCnwc83Zko652mU9Xr53htTbj9fi124v2wuPInlrrzRW2+BjXmMgKyTc+sSBXx91D46FMSCHa8Gg9qEmnAuhH+YHSnC1s7/IhYy2JhPLvIozzKzHAKeW6lF7c9g0Mc0djQogcZvmhc8/8U5FcGnL84xvN0NN2K4O4sTwEjH0sJ4mXAUhPG0t7CyslzW/iH5bKmitks5+cltZ/Iqu58t7clvtrD9QmVLJfwVS2o3k8sflrJ0rFC5cvZZtpTlb8zMPyxUUOfzTKmg8JMr7KnnpQKXuKj3O7BBWpQyO7nyQT7zQuUKu/grqkKRHp5V5UqmcljmO/zOSZdYaim+tad2sluHe2o3V5BHMhgCkSq+jtwSXytXVKWUoZoqpW1F7dsqlrPqWWmL75G3/9zYndAEqxmQ7nj4B5ac0Gp4LK4iixM1J5F2Lq5ddIgqAdKW+Q0fVDCpKed8zUq+vr/wRq3zrzPHh+REcgK0MAxrqINmMNzBoMcu/EHaSvFCTAu5Wng8O1WbC5MbjLK2hWcALyzpXMwvAnvEmN/SfEqa0OGjeRoE0UCbzRsazLgsesIJRgsNMZm1Gl2b0ZNANdiUX6wJY6cAGWI3ibB80TTvA1o1N54VNTOsbx/Pp4s8WR++SYbplQ9ILy2Pte6uvHn4BveXNUrLaLEjAzVPX9yxa/oLpAxdnppFgFHe8KdYfLZBA4mmJ3CS6ONd3FB+jgOWaEO8d9ts+sr2ndWkLQadYYLaV2ElBjcsZbFGIwhPLcV3AmaHbpmomQ+5/EZ9U6NWvh/PpLoqaRNNLCHmuLDDZQNcupkNbmnVf84hJYivN/a03/SJtOJ901v0w/Q7xrF98rbuCTF1jR953i6kamYdcYK0NrilMmk+qM9HDG9faUcThINJsDWsHiPzyoRyUTrUizpPM5PCQWfD5QqpGL45Dx9GwCJSIcZ+VLd43vzSrj5OpdfWN97am5Mzd+7OO0l1hMEyNy2+cMB3ri2yi9Ev6CWLW5XnThCy+0Elv1My/gDHdG1xniWuqWgfgt1Aykno5X7esYQ/illC8nNSVWujO8WGtT/hpS7FKHypmpE+PXowy8z/luxKb8Ox5KZk9ORl2QXTAAyQCb5x6/DpU1pjCsXilioc7m9lSnwoEZkuFnfVC1otRDCjFgwY9KNPHmlCLTXl9idyhYkXJUWJ4mGlkqG0NWFFAWRiOE32yJ1Pis8ncp9P5FSODir3+bW7Ft79VHYqus0FtVs8LOzgYXu5/f3sE7VXoTXqSSZHf+WJjIrVKBlS8+7E4UQ582KiXFQ3tVblyhOF4nNw6BnqvFzl8zD5uXpaefIZ/2y9yKp8LvvUXNvPZJ+q/ezWVlbtP6Ulk1Y6WuioKyeeU3uK1AB6+D4lSvkXTloVc9uquL+Hv+eVXVVS5f1isfxElUtlVcnl1eHBAd39LFfObeWz6nkOP5VduvFFBjUo6tTRD/GRPft5LIcjpJmeAkNAdYx/u5/oErnKaP5VdCet92qrWHlC/ZXdVzu53d1SrlBRzJLkVabwQm3l9vZKXIYvq2yu8gQOq8UddVAq7hw+rahfH9KbHdJt5X26i171cF89LxasieLuWIt+INFE1F3KmaR36NhHiQ1muhzsHp0O7106IK4d9l/YQCMXJYz09RJcYNHEs3lPgTnRg4cBR6YM+P6Ye44gAn7nd7Uy1FX15hfi2SKh4uWwrI/3tU7Ya8Zd3mRLHW6rPYSPb/e8L/ErIRNvCZaoEYl92t41/XPZdMeh96kKke6a6IcBB5j3Q20zQziZUBnseXKi4Kv6lRcHLVan4hcHbIoR7zjM2cBvwPntiy4DYSouI+4tLagoBcBYdbQIuTtA/8Blm/FT2AZ8IELlECzzRDy2m1CR0wZ7oME42MGUf3wVwmWMxD08DVORt0y37436v3JviUW40o8XOQE8nLS3nJYOSJvOdaPOucS4v1zk4jV13V9mDdQ7to16Ee0reF9rJQw4Z0iXb0IXZkLs8rqU5qA+MyOVYJr83EasMEjejt5OKmC/0r5YO2P8OAy6sbZhvDHsmBAscTPupWNgL0UiRxwf6G71KDUN02wTa0+gZSPPz1kdvBdTaobNwF+/0XeAHaomXtc4mO9DVhxSbbikQqhhMGa1EPrb1N42eo3Ve5Bq3foAWjc35+6sHc2na9Wd3ZpjjTzyrZ3UhhCGYRoJMsPBU3QQURHb+CcdaDX5SFPJWFFEfpvaXzMwVwy2OiV0FedA2TEWE1iqtPLjOGD4nXqzKY5rTDLgrcZO4+z2DYCN2OyVzQYrliG56A4hJgJYkna5YwUzA/uctOrnsVA4p0NGBYMhyElXz9O6LsqzleYhngWv1L4P7xJqGmbGgF36uJ3BmUctChg2hh7XU3Jdt11sIfRGUV34rSYbO+AJ1FS2Zgi0lgTf2QqlwQiTkU7NT9as9Lqqqk3NQ6Ue46PWWFsd9+uv/vTlbG1qcS49Vf0ZpWwdrzMWyVlLG8VNWIIQXsxHoSNe02fXZRAmU0CQY/eHNE/j80YhZP4nKoazGKsNoKF+98JKn7NzCVx7+nBEpI8HFY8uCCfmFjvctWEQonpd1kYxZzsS9W7EfzJsUfQm9CJitNDu9ntnHPeXq/jA1kCHE6NEq/eW/0s7Ltc1wtwxoGRGSJZOHXeeHkFK1uFxe/36abv+9Zj0IR49elmHn+1AODIOGBNHQgbSROEwn+cTNyaiGaGiQi1j/DyElHpHEG5mZX9gpS/DYn5afB8Xa8Lpz43Vv6jJb1SqZYjSpsSU4ZiMyWToGJxiMZh4yKkq7RSINq9t3FUpUNdJuHpN8yhmoIIoKlKNtwB3Iv8d580d7T43z8AFzhY8gmdnlUG50EKrra8J4XRtRan6X0AgSqsWJbhT/5EdQuNfF/ebsTGOoD0yEITMxAT0vXr/hL1bEV6454cjQIvpRwP7zFNPpqtzgHiFqzM6LbVZg3HM+lsJKZXmvk2LeyozhrRbfCyWMK/fTArNiGt90BcS9oW+jfhf6zAxU46zGYJDh+p7Y5k5pTZNCENm8WY0DoRzQW0jElRjlBF4W6NOIx744T8Iw2g/pg8vHz3x2qnGTHpiLB93qyi/zYwTgz2JN2Q6S/iTru6tiPXQ1nhWdeK7NYmrIUgLMKoT52q/jWkIU0TKGVAjj9k26+YmRBaFXaLcwVUQ0+KAZezcFNEigkjvxDHQteFXG1r+JrAMQ43GSeTwHDo3h9ByxAG2hliC+o221xmaDuh32U1buzsLdLrodgzEAfzUhXOjNg8HYvt1jVcLOyweynadu09zFN924DfoQKKsKkkzFqDOidezUzOb02mwWj62TiHejqWXaLy+zjMrs4QSD0uOx6hDHOcF9LqsWe8WQhiBb7/Q13whSI06o0uY3vLeut1o7tRE0javqvkDWhmq7eCEuDVWTKXGDV54FUzxMqjlcJ9fe9w3eFYUgUVW5pEHcDhbLOoC989xULXyqzMwn7b7ivjwFvXvM+ZGozBHxF4MYdXraVbuieZ7WnU2Rx4ibgTUyKfw1z7tA3yia/aPHPtmAKUpTGKsUVnzL23ecNHixPEOq3ePaFWYFudgcdI1PvCLqYXHfAkhYmmRmaEdDWwXXqqX70EfWr33ya90TDGJBmOCg/mDOjFTdP1B0o7CUjNcCrOdN7IALClMUjVN5zlLzyK18eUIJ6iDeN+sz9d6RhrbI9MC+2TNcWLvHgtzwQGHZLHXnGlsvX9mFsvXj8f0ObEw4wmJYjFJO11Vrb5er7Eg/XosSw7Cx0KbP7W1A0K8Z++NQL3UYvEptektcQkca1tV7xzVZNsMLW7aMBfI+659544wET9jgByBVRkNf/oUkfCMEpD56h3aQ8Kuu8yW/GzPL287j2CASTpIxBca8KwzelxjzfzqvYciw12ch6I6mZyvJjdqan19HkE2EK0y/II2R9/DwIE+QkevHXc6b0V2hIh5CVvdOu0vLxb+uU37kLWN7uXiepLnLvXQIh7E0zC8EL7UyJ6M2juFy6FwDCf8GnxTOrrtlvcYeQbzWqv3HmWEmLx+o7qAoKuqN7Wq6rL5QFKkHjitqtc13G6K2TFbiK7UEH+t6lr3ElXQk9EKrF1zSatKJWoc4eCGfGolZ0rufHK8tdHz9s3zEtal7kV2FUFo9ssNy7wnXa1xqAoaotXLtUTN4mKTSWuktrqpTc3xm6H1c90avXwyiYRaIy441hsqlqYrG8qcyFN1LfEnrMoT1FrNMn7+wBJStTiUnjXvKHyScODssRFXwqm+hrjleMOK7jTEbqwCFLCc2hsqv2GFyBlf0BRNxFDBGmddhLz1eJssjgAAj48hbbHgwkRppk6lhyESk76RC6MIPQp4fzFghv/DhFRiqa82+W8YNFy98TXTVBI+QCjadOJTCQl7zA4hfXOFyOAFgtQClbMzoF9/sMe4FoJu8UWXqJ8GSI/N/J4fCiihRjaVSejfhheeA4L2ppMkUPmFhgyPBSZD1skZfFsmff/FtZfljXi9pdkljgnR1SHkml5YwOz28bWYGBEv4wGxCHZX3R4HF2XfEL/h9+AJ0Wf5KYPloqgR4KU40nFiBBlJrnVPrHhrhVL/wJ7WKuTa/GOWoSaIqEr770aU/QLRVlIqpcPcgxo/Bjn+Q1tT44/sGBYWMv7YpsWPWdN5Af5beCyuEr8yhEW29bAdtISECKvxsVyv1jgW6qRT5dw/07xNjbJBcRwprE0JJ4nrddL4HzXhTBsp46I9F4L70crvOPw0yUSp/8voDYgf6bzq+Q32DDvuqUZDNdqq2aTxNyD2j6GqvV6AP7+F6TFstRp+H55VMPjRSb+JKB/EGGr0Okat5W/RbrPtHFDo+KifZER+DeJQO/36V+BavU7Q82jkI/HlEBoHpATlkSgBQlMCoYpGg9fXz+17LWKABRYzaKMgnGp6/qXX4pSuZ9jTstC7RmGC4djvErcGRoF5Mho/x8io9684DjR+GE8SiWZPDpdyuOIDMClxPJOD3+DDRdO4hV34xDJfqCbH2oD6hSMYNP2g16pfiewUPkfszdWuS5CHGPD5Wa/XY9ri9utNfxioNpU7U1230e0b0gD5Bu6jjgKM8DHtBFqYAMTFd3uW4o4I3B7DVgM5E73IrNFZ9wKY7j0+aXe7gzODn0Z3tqDI0AjPlA38UEY8NudM+6JTia4RnnvN0+iiASIKM2QPY866gnRmzjhyuTnDxzdprVIJzzFQohMiB+EJu5PR2ZClwuzsp87Rk1pOLDmX2vfwCkqvKzmx4l5M7x5/J/IzBD4c9nNtMxxYttwYsrScvyYk5mdeq4ej8V1gITo6mW+DuenVF91jkWsGPlvP0QdtUpd31JlXb3r9Y0Qjj0E9+m0N3XYqOGuhV4R3EQJAdiQaBT+D6Cs6BsHcAfuox59AwYkyi4HlRSHVwNZPwMLP/B7vAWlQ8E/Tg48ErQ0M685DBT2MlBjvIWUMNJV+JHefUce0hQhtrK8hEBvYDrW2ruj/FLG++meD/hwlv5wRHjbMcYOSG+sqBa0ScROpFLPOKaZlum4Qs0V52rwwLM68lomygRKlk45s7OaFFTFm3hGFnGPbS+XYY0TylyGWKLOREqNJtgSi/OLLm9N3Z8R4tSpJodw3BvF+N/N7UVxBQbtlYoOJy19fzzWEgFENz+cwJoIs7V74zYHW07qY722v3YW3KjL8gRxBZjlxqd1YiVLC/5VlohiwKDgcNOHgS0eIDODBq2TT6mpC6ArdMLma3njNsfzTbrfpXt6UeTWWeUbk/iu4FLZurWz07OKMiNAtzZFrN+UBSRx+RO+9MSxkLvr9GK8VplhhotXbA3ii8lKIFRF9hx/KB+vC348IJkfgbbHCrMVlTvxLl9cgYtu8S57sQOuHQ6mgT0kW0YN+3ZXgJZwha+kJgMD5vNPtt4Erf9YHWzeSFd1kcga0BW6cSR6R3qakeOGRVKvOrsOUvHTPJCLA6Ql9lA6kRafdY8xoOTQVviUbQI+uK+pSXVkst2A/5DPoJM94MRXfYoHHh9O3Mi5QkmCdHqeCeCf7Hfb5VpAvYHioV9SFjPjMNsT8EE4F3IhW95SmzSl0lcQO06LgQhlIC6h32vebnODSegM/vihydqdLX4+BDyFAAyohrAVADXnmcYKWBA7Eokk8x0KBIgze8gFoLdFCprM0p+hXt5BSPVrfiM9BGBdecPVaw+m+ROjUKVp1G686cAwwkp+TFk8OkTT2AVU8fiIdrX8HTMwx64meex4Tk0CnjSe0Z5iogCm9L4QeB4wF7t2gezKQjU63hbUBH5n9GuAU3QvgxdwBst8AHg79oeJFlu9ESb3y4oPoJC1KLArDNJADJsuwwxNEDnKtB8xQfhemj6FI9l05jK1d3s7laBNx2pKll8ha0IwgYc10Zc6FtkfER555lyODjEFhiZE6lhhTCP5EyypxCmc8ViQcERIe/Nwve6oNrACZUE3v3MdeowtJHzHFPSyKzHlSynxXHsQAJYf4qs9xYDyT1HgG5utBZ08/X4pCW2ALBwJLqBFsqVzLROoQHkbvmoiUYOSZFukwVuqSPecv9eGKD/pX8q74TC8//03I1bSCroiuabUIBrIUiaegsLZss4O3oD2l0m/DMAitEPkBawcDOoB0iEMAv02zrxnL5rDdux75ttPUFg8Q59FBngoLiA64P0jE2RbCH2inGfomtI7WTwQGwdgQoWNxFGMA+sLi7QK5IKrxDfuDoGJoDIKJcXh7CWOHNpjYuHVjzAC1NT5SgyYGGJ1AmTg/XJ5B9XH9lY+By/MHp4yEC6YOzi5YXnR51p1pisESYe38g2sQmPc0tIX+3pf68Vf6+JUc5dOdR8jICDBPfdKPlPt1v2/iKnWU2WKZeH3hK0SB2Nl8wrRUMakNG8qPCwUv/2Ocx6Hnb06r6U01rTatiN/ROkbwgQOXpShmB8TsiE7qVunT8HGKNf20AkbMkJyHS6usj0yMz0QRwpSHVhol7CuTOFpaW4byuX1iWRWAiGmmYJjQgqW+0hDjf2inUqzSfrf3D37H3mRabKwm6g1af3hLWD+lPcepyDBaBjIaYcQV9pMCstIltnfgn2OvRmf0Lehw1W5zsCSohGhSmVDRHm8zoRuifRW+rVYSBQgd2RoiuEqQpmkGjQp2XthTDQemdkakH/gaWkJHNGLUYnGE84G2wQmOk3UVh6yXSYwdpIE6Yf6L75UpfAKqq3kkOfi8Y0vjpAdlBLDtu16gp++534dQiriLFuYm/aMFvnUldn7c+hFlljr1z3mHgyt4P+oGBOtBoEGv3evKLZEA4eQkzY54PvMQ593WEA7U3F6/zwvkpfSKH3rptWlGBDIYaOUJLf70W3SwB2Kftpj/HkYF/Pb4/ejnRFQIgMyX2rXAQXzOmxA7MACJ7my6S/qLEsOGPpgPFG8kDSIfskbdlpgYLuAoGX3eip0JsLZHJUJsWg0eK5o5AJAAgSRU0gVD3DTs0bKDaE961AVXHOpeDWg5C30RjULPI5rZpidQKmDfxGEQUihfv7XgjHNnn9NMO4YsguYFvgWxfHGtHxwCL8y68hOxUli6h+i6MZfYPxE4f9GpssctTEUYFJvR/YEgwo5HKrmh7ipnMb0utiYJIjOOpaoLqcdxPciCnVg3sMXQatXYWDcEdWWvJVaPLqwuL/0zOwG0ekQboD+GLBbNqDLUTVykBSGLZXNqJBkGssDfvAMQbwQLrmqdfWBVZ5wL5zJzL+lc7u7SLhGVrVeP4GAM57OamBSLQfHq0v2ntjjsiL9O0rnYTN1ZnH87vY4YyMurD96Itc+95KOEhSzKOEaxhEUF5xffTqfv2us1iXhzECKhw8MgLcFowojHOgRyFBP5vYWOIblco94S9BVWkn9gl8ibra6wHmgwIfoW8dK2nPLi3Aw0Srd8nwI9kWgH7NS0q3pgiVx/E7aZUd58OjKlk7qxEDkX2LXblu7dByuj7tfOHO3wa9fNceyYO9XSJ+9+9N3fQdtnpySgvTPjfamcmdMB/3j0S9TbmWkN+AfnHf7hXKwKlO4O+LdPv/yjeSdnhoOe4byH7C+Cbqcs8PnODHYbzoxg4lNBLMDOjMwserDXzRn+NZDz5z4EdPz4el8fyj1dHisUPabltffZ6sCZ4f2eM3NMm89Mq7Xdkpv0adkbmJPO1ci1zpVcM9hgo5XClRN1t6D4oEKykO/UdTc1UITbiC0V/Q5b/IrMddNtXDP9Fju5DpuoOzNigUcv0GxWuvLoHu0n6HfIr9RD3FU5y8g71rklRPR4iYq1hm1E+TWkvl24U6Pzjoccz88kMgj2gDekfmChFtJDflf9QkU0AKqfgXR9QTqI9R75bhe7Opx1+cjRkExFAm6GYzDIg08pEx1l2afkxU9NRe2wc/uneA/s9OgFacps07t6pmq9NHGHNus6QaUaXqnbjZ1hnKA3eFZFvU78atRHOGxdbeu3HiLSjb7NfI8h885y+3PmosPuhNiKfhuNIX1fDimDs26gD2fS+6PflMZnVvvVV+AKbmZOvXOl8002sOuRlRmYs0q3eKzfvB7IrKMDP2ZQ7+jDsj5y9vkpj4MOcbZlPQ0w8yQJkRoO7R5/eAZ+MYkMnicDgptHh3MZp/J+QHHbJa7mAKFA9HmlGz/D1bLw2OZy7PSqeLLPEnx98tzzXpn0CxlkTQ+GIEGlWyJ+rc4jpekz6I0mTNie0ugUSDgkgO5FR9740tEYD42QsDNs4WisnhRkWnE38sgtnvBLR6dbVzBiCk+3D5AOwkJBQfaiSHZ3Yi9Bp6Mp/UIMPBYdPJkekAmhIS2mrd1T+QX3EKe0rQEE4JgivYioYJrIiAgikqTJDrQpOooE5w25GiG1bd3zOsoe3kYoOc8eiZVU6ZoX5c7sEd8Y0qC+fJBKd0c+EWd1eMpqFlCT812ZOWFaCBefGkKq52qx40UnphhLC0wzRMhDR90T4cvRvNwhRllvFvg8K/w4p3Mx6YfOCcric8Jnhx19QSaFzKuQkvZaTMVYSEGHQXPHOz9gsizpcr0tJ33sXxrmJO91zOiRMx48ItkIE2EJPjMlRBePJL+lmO3QssgTfNDdggkaEnqtoYQW/3BakAiQzDFFG3TzXZ5yA007ck0+CaciClzwKB50D3s9SUkPE3PNC5leui9kTF/JYP7KF6ohhBPzO8Okrsmq8pMTnSxHL8Q0QFd56g2YisrI4a/IVLokLxVEl5kMm5PYWnxJI4U/1ZnPGXpK1C8rftvbL4cTgdEXjzGAOJwPjyvIkp56SEP4t+MHr2iFwvhHtBxW3oD7WbLSM2yqdmuAuNsZwxv4wkcH2o5M49J88O3sGTfDkTci8zPiGe8NsYNIVKdmdbMSY+5DEfKNNlF3lpTm1d0ZceEMGfbazXw83aQjhqU4oNXq0sMH9jd7pNy28ld2whDkBGMb/QYtSbO7hoA5ToonJMe4CBlkAQCLozJpxxMNKEWMdkU449Gq4235gIZInesb4qVAle7Bp+g3a5euSOp596+/I7brkMEE6gj1JTSM7RVNnPpFncjRh6IAHQ9PT9nCZNRTsTsakw98UIgQFA/GN2qAG4blC0GBYj6IEYJOaCqE5S3CCjr5kPh6Oq7eIHRNGQUTGoEQ0lA8kYVpDEbImOBGMEJjH9CKvuw3GH4MLYqvrJzabzEQTfQ9/uCB7FxD0rwNsc2W39kBSszOVsk7UaBn1CG0sgi/wfRckoby79cvQc72faZqJe80S5xRrlzkJeLwMLczos3/f2ELLl/POdbIqN+8N3gSc4QwsxOtB7/RrB4JksnAP38rVenuPsYwBkST9Pc53l0Gffjujn6X3/ChVnrsUSOhQuWxv7KPpkteO0IhOJrO0qo3uzhv+21jOmXM9UAwfx6ZkE1ToXbc/A/a9Gr6zvRMbcSbTAILsb2hCTAGKrIF5wC2P7bEJFmwFOjMmCbPmLCtQs7eXYbaJmMYKCwYcx7boDrbTHW2mepsM9XZNlRnRxObLG3YiDRkQWnwkztReGP6Qwp2/llNc7Ls0qZ2GSdLFvpddm7bZTPnXSJFu1rBsWuo0Z7YPVNVuYgg5YQg5cSKBuxPLqRGvANV+wJdvN9tQhtYIOpUgLCBdwJ6Z3WgydOB7m11INSpJM7OJSFSZXFdpsOJKkPhUZaIgJqrKjPhqkBAWGGKVekq3tVViHIdsuLjGUjVc8iQnxtTbH9h4dfixbZW5TCYG+tplUqvs2EovJgc++5bpZ2Y6B1U+axFf+xYCBws/mRUYYG4+GI/ir8LA2qxCxVzPXbBQjgo7TylnGpinUhbDBHPWXJqZhhOg/OIsNrNmF792BbUv1EL7x9x1Cs9/GE/v3z/B7Z24hK2hXEKr7mLWqH5NeMU/kdxj9DrHpFagTa2eJlFayR8rI7y6LeiBYY+2tjS4nUi7FR2n42g6CK09e/Zm5tpNtpnN3PBBzMCXZVIWWEOg2L89wab3d1T7rNsqZwrFgwggfaXOK33jxk5HdZ39Ioeq+gbtLyzJo61KMQws0cv1sRhoC76tAGUdU1WeL6FU1ijT7zOOY5n3e4rHNndmI7SC5TAJlHsp+hEy+OvkB72xIM40JUEupLA3BzEbw6iGxgWCma81KAuO0iLw3SsNdF9fldesdVlPwZsJ0VDiTkb6Pi8YvjW4xPGG6Ctlocg6YMmtPKDJuRCg3aPH8abk4s+baMt5UP3Fxj4g3qTCyChdX0I/MfPh+CGBTUsRmHhiYhOWCSCCyy+aXqnGGRalX6CzfNJHxmtJv/SZl226jG7iRM4WGK33AdQggZNiJmb4Q0gs+EdJR4MUY2FO0GTOqBH3cB0Eiyf6xpdgpX63qXXGA60pxT1LDq477W75xwzgGOd6+/lafvFdg/ZluG/pGZWj6JjPOmoln+sVaZ9j3uP2gqARCUd2mNfeEFi6NcvWNuFxCkHLLiQ8OYGh1hAHaJRFBs0/BXEDIXNu6DRZLU4XOg58AKR2FORAp7SVhiWCTBrkZiNlNknUmuMCHB9iA2rJXEZ5M1EiuWLUJU+S8d0DwR9VNKYXQ+6xsYA42fYQfeoS35Rme0PHz46EvAe9twRj55YEobRXlZ4Sfbq1YjEVogEFXpTAUNIab+rw3Q+rwNj5I3zbHK9tqHeCp3nGJ5rG5PrGlcCrjCp6aOY6ypbzxl63+lqpdMPQee1AzNHx7zugjsjKoLQBXc+vpG7DpaqaBFYMhu4X47uXWUnql6+1JvRP7LBRVwsssvUu//9HxoGYudZrpxVjEmTr2RLKlPI5F98Tjll+retMhW1ld3LFdRWrpApvVBbxWI+m6HTUjbzVG0dbj/NUonDXH5Hbb1Q26hnO1OuqO38YRnVbRfz+Uwly8fsdgUEdru4vw84Pj5UsjuUKhToGo6VXOEQhUulrL5Np1DqGeqj5yL/kPILFbWTqWS2MvQCSJSzklGuFEuUk93OZ+RYyu5z4Ww+W0FGKfeMKtzJ0vvhp5TbotxcmR5Ordgpqp1S8UBlM9tPFN3Bt2Y/284e8CF/uJOlY3b7sILjQT5DnbObrVDh3Rz34C61t5KlTOoCyqQXLz4HUuAuAAaLpe2s2i0V99Vupax2DwvSJ3vFfIaK7JUy9LC9UvHwQH7Laq/MmExP6OcZasntqtxeAS+Yy+ee0m9BmkRH/Zq5wk72M4AOUltyhXyugIsFPikDDDFXoFaW0eGUKtImBPsQajPa8WnmWQYdQu/6aZFe7Gn2Bf7K/HMA2MGnheLzgkJrDzN7WUrQx85nd/HDfxU0Mp99ls2rfA7fOV/eV/uZA/wd4Np+hvqKup+O9CEy+dznOAEWo9qnr1+m33IZBQuZ/aw8k1EPC3lVKKpC5Yn7LJOnQQKIA/4pM9IWvV9x61O8VXF3FyOB3qZ4wC8lh7IqlnZQCihLdHKIb8Vj6iBD3YHfSo7LH2TK5edUmBKVJ+qARrw6KGW3sztoFaUOMKwOSrl9TAg6PsOIxDGXz+4hVdziX7oDYJIHh1v53LaiT0sXS5nnioZwfp9+dw7p3WgY03vSoXyAxpeylcNSQR/wvFL2WZE+cym394Su0uTDT34rs/2UEs/xV1Zl+njl3VwWqWfZgyKApsrUyfsZOhQPsqqcxeTDYZd+9nMKHVR+QveXi/sMSknjAtCUmATbVE2lhGeXX9Ac3lcV1EwjpUKvwD/ljIxaKrW3lwXGGY1jdMJhYQu4YvRB8VuiXxSj318f4qKMncMCf8/DAhpxeLDDNx7w0Dyk70B/dCOPAPrQOb4sX5x/y+pZLkN/2efqOX3ILP0yxBeNenqd5zn6YvTtnqrPiiXNX/9EQ2hm8mWgZh5mdf5GCAQBVAq9+/LAxvMqcbuLqNz+H7Bbq2PfqanJdYG5hZvkWnVjXW8MhMAWdhjtK1MqZYh8ZivPs0QbtkGzsmhQlq4DZ/QFERPqfaIJuVIZU1Px9AaMGNENGrMFef8dvHaBXzRX0G9CK8tjtjpYWHz9hnGLJhkXGxFyb8R4sIHkyc0D6aYpq7af5A6IaBeJnu/g4TQ9eEYIVClWqmPgGjGYpRw1UMi6ePF+zw5xlH4UKtctBIBoa5SQDeK6OXveyPJoC8L76fm4v90foajh0H9gH21gb70wqJ/SvuThnajqaTmaSkVzLwGt/+KGSBPRAz4WGPWL+VTc0/OXNvZEgvXN3nm8NwojIv/UludacAelnX5Y208kaPGijlcc5v/YhryhHEVNXl1+NB+1flM2JXxG30O6KbQmXb1/7wfAOtfgmuKPdUP7rqIG3gUIfzXsE2APRBvCmjbpWH70E2qCKaY7mSUTCTu6OXoMgNDtq3i7lhKR1KN6NL258dgJatL6+BZz9f7yd+3HbE7BDl7ExLzUXMzijQJoNpU5grRHj65FNz3DcMLpmc2307W51EgH/Zyam97KVcoTsOJ5oO4vqwcrllNL81CVirQ+iZIwEyG+J5UWDNtfYd4LSo/2zqbGPBbJjmBw0/Xtg0PiDXYzh/kKLeTFTMXSb6PFgcEAaA6XV1/V2m2xU6k2moNan3L7fF49vmgSHah6/Vq6Wj9uNGuXSo7Vs1ZN8sFl92jnQNsNFfQsVOGdnAa1QOZ1aJb0P2g7JHzLGWZn71XP2EXXWTSSIWUSI7kiZ+qNovzoa6gCKo4Q6VPdq3a/rGkoUDkgg7KPr2oCDMq/OKVMel2w2okxVKEIwMBZTMfxQql8WhOsnwoA6BzRWge89PpdNcOgNP+ERf/V14n1FEdiQlfi/yT3qfxqM6LKoKYm5rkEWuA0+Sei1hOQGX4OsLeauS3FJkUwozfwcE7tjSUhn0J8hj3TBM6vHi2k1nnGJazZqRFAt1T8fkS1WrfiFGU49ircE7LniHAIrkOvjnSn4EGkb0QmsmJvwOhwPMdTY09NxODtY7j243dCqrhy/VZoBm4ubSTVl9dv4gAPU1NTltNPOx39tY40drhkTWpas4wYHMii4aFzGC9IJuMsR4g0qA5TmlpooKG31x9MBGlqNvpcTvAySRMtlazRUjC7EGXrwngbeqkEVAIpUQgsIAMEWSPtUY2xUlYMgJWW3OhJSQzdO2bJTbDB3A2rLtbJH9iTM2rSmcNOb4bx/RKCrDQ1JfE05qY4XoaKwKsAXEV5s5Y1mXbm0iyiu/+A6OUmSDf71HDsSRGH07LsJBfNMNVqjAn7aDo9VmBEMv1n9lt7gcPjJc/8ZtPrJNv1/iu4BycWJQbU6v1PvqJH9uoDEE42LbxWZUKjtYnG4S2bvo0VkUsLt5eY48gsWmC/LuvW/YeP6dESHY+erKavvyymSyjnf4zbwsViz4ZZ5Vn9HLIEnw1iVdhzEGVxjn6xmJSEY/GxjZvwQD+3j651ofEf/HP71kt/qTfard5ZXfFvYdhWmc6V2oIrM8vc837H22KVIa7Rn5Q+wCuoMrezPIBzRJmh1NRzgBLih2/SyvDESBOoi+cFMY8/3qO5KPInfaJ50KskUgJyNgnkZkMBP7LX7QXdH0lakSjjLgOmf2G69E8wXDyD7k+TwWHeR4Ip+UT8fmxXRZgNBNKBr0tV2SqWlzXO+ciuzrs1sFni2S8otvBapLxevbPw79iJ6+PHwRyeu56fup4bacA+qLhRGxtV9Mq9n1//ruGqfO2bo1Kbb/s+wBkXxJP+x9erWPhTHU0N/vnWNPFPoGgcKnZq1nE6/QHdKPblgJoet21wHFb5p65xuUw0OFKDidKggUJWlv+YuV7zqO8KrgnjsyREOSpoTMyal/nt5QqND7ayndMXsFBkxHqaOEUJWYup7FL7Lu9B47a06wR4i4Q1U+P1C8YSkgXkbgbq7mmcZIk5cPT49RtcZt0sUfsPeC/R4aamTShhkO9pkGhaUDQRqD5+bXBSVu5/F2OPsRAawkuFoUNglutcVh8+0kuyhtZH0hL8P1rKDC2npFDnqbioTUg3By+aYhOMBXs2NL0gDim24DOCvgJCD+g64xH+gS0rwQs7EYt98t5mqZfVo5eydXppObLEhLjnobIzIeYgK6u/Z7/kcRi7S648OBbadK96+Vm3eLxVCxvqjgatiRSS8dA1ETtictHy2XTVH57UmHmBqNGNOab3xROlrWiP1PYb6hhCZR3wNm4xIUYSIC/jJhPayFFsJvDrBwyiSkcqYAACR8CdxYiCKzNxhm6yoTCxaEd0UyYesFFSsikgrEjZjYPjl+lgq23/EoCEfkuJcR4WFgF56g3gzQ4vjr53MgbtGUVbhcHEsGe0JaLjgsHEmJ6Lf1C1KJh4YfqPmZowfCI+vca5mZQcOlnUuubquqgo1zY2Z97evaMm00cpnlIMywnsqKr1BtgdwDIzsmx4FMOAJKB/MD5klGpxWPE72k8lOGvRX19jPHOspYVp2zyfqpZ6VfWlCRixwFKKn9njgcfUtAi+H0q0pRSHXJqdtRZ1dLAxi6yYGZYQ7Ec7o3v/CKZydlbGMVWmpy3nECVx2M6LCMfsrEyLh/NhEI2vaq/vL3zyJiWBxJwLJzl/5y1xeanp9fRdJuXPAArl2MJT6gL68lwYgWz8Rllyccmxr12c04G6ZzjuNi3LEUbPjomZzboTzWEEcURMv0MMi3YzMoEoB2Mhqf/h70b4gIBebza105i4gRXAG3GKIeICxltGZvFEPLv63jNBnw10LMq8OF+KPXr5KkCU5qbn9crel3Rkdb32VS8KAjvM9METMTYzHMDppAJNK9xt+y0rAnAuS/TgNM/TT8vFAqYpngfVWgZOa3TMds7VWT3gUzqeaR0/QCqiqaxNTFEokDBikmSbidBsATYJXD1bHEhFlnG/hfq5clbvKFjHV7pyP8x94TtA/RJ4O/1z9BRr6rLiVwH1KD1sx++rXZgRaG2X3KytaeU58N78MkKP7pzm5bHBUCQO3Ja0GtQR6kzjHUKwCdrAXXMA/aB++c/285YofpmiFE8Eavmk22q2Zp0tG7AS1fVJAXWTwF4svwTcGw1MBQiyapqhpplxY8UV7BSQMxf5roztdngSV6cf1xbnZPF997/+ISJPaJETm6zgBTNNdMoW1K7U2hyH14bNu0VXzsvUKcEZMcutLhgEuAxQ9+Vgw4aP8srv4Z0DKjscdLehqBarf7W1h/6At+UeDKBhh8pVW2qrzjAl5oEVKHG30FGV7m4fN2yXtrcZamWbnkG14Gk7UARShsTz3mZYi8Oc4nJb/gBfnv1RONoV7Gxg6TLwmlw7zrodOAvIWe+KG6222XZARgTL7q4Ut7h8Rv2yPRxYaoetANGGQq7sNRQONLJL3qm2HeN5SS3b8TAWqOAB632DreFg0O3geVSJX2/RC9NDMLfQhGe0mtDE9U+uLNp0gIXVvZalFRLdPFY/wned0Y/XwDwEsjkdn9d9TFp9yLKnM00/M4DxiviuwxN2YOBvo7h7uAlF2AuUMC3xA+NqThxWdpceQLNBad7alGHH/BwWA/LLJTllivIJylIrYLYOkR0/bJddDNhoSF7PUrswYqBOVHse4gpuD3koVbDObgvNyujA9/TBNWmjcmyQhF5uneZA0fg18t651+LXhNFfrNQu0QvMP57+u5EZramatnmIg4JR5cuAUU/hEL9LE9Lr88zNA5HBlK8QZ4DHcH30Js+gRd8DfvgT2q7qL5drgGSdhLNKD0Tcp6lPyTum2bPbqp+q0qCV155tij8nDQgYhVFXwZq/zKigFjXRHxww9GoAmoUWH/S7QDQKUE3AORhT1H90oD7lT1uWI/GASk9UHgdmQNIEaKFpMh5lqElZ1PVgRR0M+lZ6u907TId5Vnq3PdBnfLnYU7lAvzpeBZMonw+pdN5vAPYBz33Fj1Nso7nbpRVEzMEwjXGjppEyU/LdetN0DNNS+qSvzFO6eAjcgqTsfr3jn3j8/jsHucwFnKvL8GollrRZLKMAfch9wT3a6l6qfeJPY71QKOfKzZbij1ro9lRxOOBHHmRRY6tFNAbmfDRLiZ1tBApeEFcBf/sDqhGjVyPyBTSa4OVwAAOdXyP8R2kf36sky43MyRjp2GGNJiXo3NLDgvOpA0til1LCNjwYZNmAhbpKxnpJvH65maFtHWQjstp4ZqBDjkGDQcbIHpw6ZI7xCVMDM1T22Bkth3p08XK8eFkXD0cUpTpN3afIxXA3hF+NLiEgujx9TIJjp+74Da4SxHzQ0iMxTgZ22PyFPnuRSH0bD4ddbhm4U0Jjg5DIPvM9IikxWhCbc5kIV5lJOn1d7qQibVnY/knJxDrssAVPfG4S0aWKx+dlOClpcbgwi5I0SB12/NiZoXVygy6K1fKwo1N0reXBDhLiJHQs9bSssyxa2gfIMo0NDLF2r0w91btSxIBYGINmCdS8HbFqsCs67OjxQ01h5DlpEgaqTl6nAroiJlyximV2HdJIy8Ec7llOKKcmxliW0L/6FJafzWFjoE8t9eyATY+wwEk/cPW8ROhVVOYA2kI8skwFWbtwZR8+VkgUAAPD8yNsPmbeZweCS9kJeCzVW93TgNdFywSHffc/G5Y6U9p+knuWhS1IFgh3mUqllNs6rGRdcyXKKRRL+5l8LKO4u8vmGlFOKZvZKRbyL2JZWikfZdDZQbGUKb2w1JOnstPbLqntQ5XfB78lujFaxnbUwY46RKHsCzRtO58pl7Nlt1QsVoxBjbtdLOzm9sJTVsbvvCi4sKtR+eJ2Ju/uZ+hFqJUH2dIu3qCwnZXLKEwkMLeD994qIu4mLuaNwUqhqIpPYdpQeqFeZEEst1xTlHN1uZ3sLr1YpVhYipLLUfJ+lFxROWowrHIy+2LAgnPE2yzFzn99mC2HJ+VK8QDNKD7VjeMnm7RYWVTy6He2gMhWqK4sbHEKO4pu3S+W2UyhhLrwFoWipfSHNJ8v/GjlJ9uVz+g3m8+jYyvZzyqhTYX5aLT9glkib8Dg63vcHTAOexdAD6K6OcECpmGr/NMzItEcmYbjgBD7SUQK+5Fup3WlGMhIoIA4bhSCRmmYdYZaET6RcfOYUOgDzCQFVZHBVbgq1hbRMzQSnGVjl1ydpN3qYso5SkKWh41zYiRLVByUDchnZ5E132n7ekzbxPtDcGS9WlK0XByDKZk0W5S1dTGtWF9Px+Nc0E6F9h1vj+5gc/Lu/ndiO45JkTxpUQ7A0+hMoOX5pAfoQLZCbTQjUJGWWMk2zqIAL5ApSZghbeDJUiSsFUQLm62WichCZ4PWsTnDrvxEgiOxuCiW7OiYSXwIJU3Y2WvBUvQLORYgn4CYwmaiZ82+CSIjigrefeq03lSqQKg1ZEz8OuyJg8gxx1g4Nb4ka2TbAh4fN1dYXf4i6sRpLSuP0KsRNVQ5HIF5zmIrE740R5ki9oBmD3vBaw5oCGU94iyxuro0Z2+mp0KR6Wh8LROaWEdsfPfvh/JEyBF5ysREh4K4dVusdR0FOu5cxUqfGFy7jtDDohT2UsCMacGhR0yxvf6olfoZb9clVh38U7snY2F7Ru3YidtgpCXjG4UxMuzo+9k56rzbottbXggAj8myGYkgNzEYNkMvLxGtABZo0EVwo00xyN/ULlubkRPXpvHr2jRdrzYhdtwUD7VNIxXdFNnCZnDVYegVGuGbzSviEFGdMTgRovDITgKj3MzOSZqTa2uYmRsbaZml8TlK8xPTlGUKH9tOYkRqwMLqJVsk/fLJZ2syehZVFdDjUdBbwFpas4wrkrDDcWOcNunOKC7blBk3E7bzOiFo+HOWo8Inw4YWljQwgWFZOOvh6c+FQYRo5/HDt7HxQlbomY6OpI/uaNAkIyPvjQnItaaNalllfVwsLHxMsu7detePbGdrGnY70fRB1tvrWbOcdRJp7F5yho7F9G4ymkXG40Ggn2KOiv06Q0pi2oAoCpxkLN6VVv/FIl5JiKPIJZETlGkmlCFyIqNk4CYmoX1a0L660kJ1DEYjVBeTe0BLHbPp/QVWuL7XCIXsJ+HCdi4eGQ1MxtHQIN3QHREh2HQYtihw1i2RQVijXwUofE1V6Qfy5NdramPcncZHyL/FtzWVgkuQqq6vbWweqbsiap+5M5l+W6siBi6MXRYdO7W2vpGmAm9peIVC9nqAHujA0p8SQYv+6HiJ+GTdZgjG+iv78WNgylaNFB3iuGnYnbt8/cAO6bA9F6fOmiIbMh2eg15b2jmQDRRiaVtgxydpInWcfo2l8j+0deTuMOeTSNNFs/Te4fCSNVUm9jwwgXgu0g3Q3onGa3V1pWjLlIXar37snXT6g3PYFGG2IXTxYSyA/YM3ajgSz17FmAn4edsL2uRPm4rQw7Q2Tj/tI3tszvzXmMJ0wzHP83klM21enbk6TD2TE/MMd856/VCH0VbXrqzQG3aFQsyblrlikvUVzrbc+jG8psaYHoHlvZH10bMfphH+F69qoXqeWCEDTxUGi4AW26JOgKYJqpdoxv8/o6uky1q1Y38AaLqbtG2834wvmqJdC7VqZgmIFk/iTltYK4anZyHIIS1ko85dLB6XkCfEkLrQGfVdroOOeiWNHI9HYqLw6mkCoCGiH7guTGO/aVbOuCtYaKjxF2PdxBaqYb/8uQ5KL1ZREKUToys3gnONq1t+QJxnMmbU+UM7ORYtJWWbcHZQolXX1iVCxt23qpqcnJu314kuVO/cBRHh4cPOImkTNwUGu6nHm9qik1t+lACvZeJv0rddqx5t1OY3oBNKxtTKozzSrOGREI97+Q3Psic8WWMMWy3ixWjIcTTfqtxlWbcaCl9JOGQ0SpjjMCSVDuADgwDrthLrukTY+T/TL2gJdJcdGZL9vn00zb0yPc3tXNdts69zpp/8/XGmD959ZhZKt9HCblWjx7tfDj1RR/O8Acppw3NpYHrn2FYBvNNr0TLWVtDvwm8KF3sQpCJaBSNp9C0ldTIKsaudq+ge9wTWMO4JZGMo88rlWt2BMke+g+5cauJ+Rh5y1fEQECuulR6o5Vh+As6HvcGZq9pBve7G0xYwE2+7NFD3m+7AAgPcG/TpoQDGBbD3ACpt+Lu5CG9A3eAODDYgvaQ7MK+HFC3udBiaOka83A+1lykTkyiCJ/raDUOUua6YlCVCjs1iB30Atl3M6whHCHDkDgQvMwoyzRUxQ2ViUZloTPrziNdkxDvUmy5vfTklAjv+5VxLjbRKth4JQThVQ34KNh/hdoF3BhYHnQAaI1t1LKv7akU9VEsPqOdH4khJ9NOxnQu+nOxYeIOCGpYe0M8lEmrZVEV1LY1lqeUbi9HTb8x/eFMuD47RsFYje6b4bomGIyNYmU0TKDpwI/yeF983BeKDbUj8+3ZNo/slDSb8YRsmjmHMIyBb3BU/oXI2+9TdPixJAj4XnIAHigvhVZY+qOuy0A4JiHE4UcntZ8uVzP5BeMYJ0DNK3OD0Ko9/QI9v+DRvsdBwgEpALlFJHos99M9FR111RIIYTohzsU26dylMxjVzbjEHDm27E6OW3e+XqcQssa3qyfCsBVuklTfYVNy3NzZ450Y/yQ2VqCbnOfyqs4Sww1jB2OXxrjqSKK1s1nNgZtn2k0wJ77mVq6j9zGdw4rLUdv4pi/Z2dkrZcllLG/cPMCMrRTe7s5el1hWKLCw7yGYqlnaeQ0l0fqak8EN9zyGb9vLFrUxe5I+Wu5/dd3ezBTiGseANHmTudrFY2uEnxRx90BBu214pg3qeZPK7RBHYoJ/94ArlXOWFyh9SoyEBVJl0Kb2X3kpXMzrWFf07LFjpcm6vkN1R1cNyDc+0XJYrV+gXk0XdX6ZHHeKKvuAu3cP/8LEqVZC3urqqVh+s0lKLWne28mo3X1FoD9e1k9tT2YNyLl8s4LrpR03Elu5ZaTf72QH12X6GKqfSFu53S5md3GfqyeFeFk5xu9xiOH9RNXvwAKNuLD8pVfgR4bfJFXZzBbw25UhPcKurS8s19yCnlt3yr0sVSmRVvsA0ix5PNe6ZdDatDiCfd6vLKwhJiOKgHe6yWmbnBHdXuU/wfTP8MofcjkO065Abdihtosfz6A8DBUZRrMG1TYWW4DhjluZ/0SPuM1U8yBZ+nSnvq0N1TKucz8FwLmkvS7+RRGjMdGzQbxkIYdB9OWA9bsPJ2eOwKGZ3y9QNq8Jp76wes64xO9jzcA1hGw2iXxrYN2AoaziXe+J0rcNWDjSgNaxdEPo3lO5MixyP6UbBROEAejywIXlxaRAFRXQGCIRZUMVrjNiGfIlrXw5R1sRSwGIrZCitIRq6jEmuWh147AseGDUIgbCB6Q7apT3dLWHaxHiQnY54fR7CkqDnU4khWvyv1OoP1B9wCD+JN+JczIxFlx4JZOmNhFNuEiMBEAf1NwFxGoh4LhBNxFuriA6ZqIOGveYA0XfV2yOOFXwHRiub7GsWboYfL6Q4KPTPb7EAwwCaskcsSc01DC5jrv3uO2D4ZhA3TXt0uyZk6giek8RTC6UlDPHfgjrYyJB9sctC/8sAoi4RuYnYIMKKR8v3AVsS2iRqe8QR2ckYVAYbTEJEwvsXE06VwaF7HIaKzQ6Jiw3tDkPP/xMGgw9jpsIUgwX9EjHV1wPnFzrCrPH1EyNf7er3c2LbXrOfVvyyMF95Y1B6fFkLPZNGhgXGw1u9DtFYuqvlfWZz0oS7/aLFwq6P2aMdRqva7nf+pW5bfHfHrhsphLukiy9tEMx1lUqlLbVWTaawIVvnrLU08miApWhoOuv0OzlJmzE1LZKahbdHm5ELP/cPLNVE/oIPKT3zI/FcwqCjrVtaBtw1AyjYaDOCy59Hg1E7wIg7IgTZ/8LsLI4n5voTc97EXH1i7tXEXG9irjsx50/MdSbmiALEL6rmxBxlnE7MuRNzTS53QeVGsj2+oT+SN6RaRzIu1QnfTSUbnGib5wb86AHVExVpct55lEHPaNG/KKPH7eujwfG8Pt/YHqkskNrRonje0LSuz5nDkevnfMP/x967xcaRbFtife+de+/pc8+99zz6vB9XfEhksqqYJCVRVIlkiS+pOc3X4aP76FQWS1lVWWS26qXKKpLVDGn8xngwMAzYsA1/DWx4YBvGGP4ybAMGPP6xAXtg/9hjf9r+Mwx/+MdfsvfaOyIzq0jpSKfVpyl1douVkZGZ8dyxY8eOHXuVTYSiRKtRTXGnavyozOWghde1iZ5q8CtnKJSUucPpttFiXWleLl9NUSMeS5DeiysRWBA75WORbFd9TXPGtvbkRPf0J4bPEL7oQlEVVqRd4+Umv2Kx5wt5wpwRwSiGQx4fWAOrRILxx8Ig/1Nb0hIE1gI/XqDErktI8WWEB9g1wK0jnxTfAM6V7jJykwGYKHFZvluUz+b1Zwss9S/KoyiORxBCYr7OI/UaHFVEb9zg0A1kquiRUvmxkedGz+Hoc1LQV6oCOzaiBfyhk6d2zfcdVF0c1Sb7s3eUPT+0ur2y/4htY/KHi8NjOFKitKeiEFeeeUueX5kfHrvkDVR1aCiTIYZAv/xipoDWGMos0po/Q78T7C7Oyi3ynsLt2emMzGyHNK0ZBxzozBkLcco5NDOHM2NgDwEwkX24tl/EnnGRT1B8SD2msjASvmnH3I0YXyP9PDEmnss2Q8nOP8f5csfBCXO8zLso3NjhnsoC8TXROi3KufNMvopjpwL7DNiSp+qIhJiOtuGGsx04/RMa/1nEzGDWGVdsWbb2YD7YmECsHRumvFJ8Kmz2NvWTY+fk4AIeLjr2wuj8dX34hn8mTLw5kfM702b9T7BYYHEZQRthHMiAcGJTR3E/zf4gOtYSuklfCPvOGR8Xr3/UZZcF+aiZ/tNkd+tp1PNU1EMzfXsnen+DpuPQJ1Wbsa4VjpexExK2qFBEBJAa9Olh6i7jfwKEYc4UH+ytWdrn3VJU3mV9sCbFtZ48N34QsyCkLGs8REcvtzk2ep+dmY2lkL9/WODp8Xd+djNjc/3yo4f37htU2uGxbEGNaDKdwDRsBKO/7ieW9E9s5xwuZfS0hz20OhAoYSkwsLUHS/3wPSXHJNGBWax3o4OOeptXDjtSIW6MXsfZaRkxOJPA5+8KPEZT0B25QT066M7HXkokYfHZnzwfU+UundMGAZTFjYJlwOyA0+Ep1pDxiRS9+6VRvYNOHJMEcJhhsHlhJ4w31/Xel3bFGepF+nZp9cYXyfHR3rLxxQnbz77jI7yzJYdNjDaFxDqvIlA5okcEwke7QhcfeEca2YO94Imo5xlL8mgnTHwp+R2N7tMFooucM4lvfmHCme5vM8CKwW6A/Vpp7bl3GmrP8cW/1/+FCMf4Lqpn30GcwNhQaCRjLQKH+4Km1bitan6pjTVUsyFHa8I2ka1sI+kGfGAgrDUkXFSP5FtTyhc//OOXkoNxp0i5643RegmLH1pf6Qz10hLSfmxp2WpJxIkbd+YKXC1G0Qr3TjRuM1uRtACYCdqoxd3kyUYqJUN/07Mgq1OcbzKHkwDaCbjNmJNXuD4XSmp3qWn9JkOGBnqtEGJwwsKT0RgaTVPCRlMvTxtNWoGXn1TbeKlZq1RbZfYn1g9Aw0aLCLTlwGzA2lOt3n6511i+BMdeRTzFxdSBcaoNUKDArXqcMVDizIsBw73Jyldjd8ImIdQXVuSLDltMaQ1jF2TFKkKiddNW4oLWbR8F0e4ve6XThPFz3i25cZ3dGhBrM5wHs/GwHdetpQbnbLwyJZ4hGZozK/PyYjQxa/eQWLgSi14osHexfioU4Gk+H3Nm9AyRyiEIj15dOHEFfv4zcF2ctQIMjXDz7L00r4in+hxwXHQjxl6n48z15zEOntIcXJg2n7t3SuAiTpDCLk+Q8uGUVQvAPPG8bNoNHe2av9zl0/Jlr4qO4M5U2/6KM2L9B+pUEjONO1N1ezxr/NB+lTWUCv6L/USh8bh4xR+bnKK5h9UIF3xBY+4JZDqpRt4HReserf/FIuIy3n+tvxTi+XU/xuoXB4oJPRWrpXB2Cnu+DbdjpifNjI16wWek2uvi7uKGdn8RDTe0evrVo43u6p0vVEPG3QY0RwuOdkD0muNPRWv9PhuLX1w+jGR79vs4oU08q7SU+e2wuPD7adzwwAmtjW7fmbllz8/Pm+PrRexQWbKlOQ53QXp3kwSiacYz0m4l/i2911hk3AdVLGKDuybIaxd3Y2qBBh4MlUp6Fx6wM3FaYDwLmUXF1yr2LLVWKAgJQ8RakQs0SeCAjRwa/P9Cl8MbS7ubCjrd/eLS6mrx4e7Szsf6XjzsDUTt7e9uP9J3G9tLqzq4swuNMHZojN3s9idqZ2+DHmw/oBcfqt3iysdrK58UP97eXf9tePcpHIXRzcb6yidruwhtbxxsblHgwS57Uiuyae5ucWNpGSa9ci2urMHtHW7X9/aLmySDr+/gyFH/fXFr1UTBA1n0gtzJ4821rQO67GzvHOyYa3FvBX7Z1vAcWvntsNRyp0vNLtvo3SVKy7wgd/qFvbWd6AGFTfSOuPDbLcKIuPhgfW1jte8mrO3+9kMUe393fbO4oa2Y4zfFpa3V4v7u0vpG+ASe6LZW4XmQb8OHn26vr6rPlna3hASW4n7UhCPAIV+Tt1rEefKjtT31CNCWF1zOcAo3JIWdoLbK3nBJkqB3QMBF8Z2rae2nf/5B+OaatraloDlVhSMw8Xt91Ili9rzOdkvg24tBo94qitdd8SNbqRQrjB/pNhhtzwsDRZxmIHHG94udZtErlSskWNA9u2eN+5/lscbQ6mJFA9hmCKNwaCp+aY/dRtGAkQoMdsBZiTtdnJIolk94cVEpYhPTrUmYUQPA2wH5zIxZn3QvljTX5xt2NWtuxImsidMOcbVrYvFJW6aKFbWBAjB1e+ZaFMe10eMInQXeXovHYOPSEGgSbhuab8rtXssYIcDS2D/x9B21AM5FcEvqGD5NKWHB9ZCw2BDU3QZjzsei+l7yRCDmG2ANsh2gtn5o+wya0Hc3E/e7i9Znp8BwIiyrs5h7YDYYrAY4YljteEDA7tZqRTgSgGzLnpbxV+S+NN6ZpYyBClsMgROAF2sXv+zROQi9Obf8Cl9Y7D6CU1w0KQ576muRE8W3epFTNMCGfKdlepHrQSVxhGCa25E3TuSLq1zGQgYKdXhSmX01cyfjR6oROUOmX08sLXlSqAdHursQQsGMLYq+DeDQF3iLiOBDBFUOBjrc6BwDtlAufMvp6msVwK/FEkPpIKTJHE6Lm42qf6T9SNOvFBu7Z3JSQSePha8ZVbwIFgBq9tssSwq3UoPrnipNZ8dFBk30eOUA0YfGt1TO3PBQ1Ddx+uyLMlSmI0FF1AzAsJYI7fpaS1ZicN+WfqNekhzRVCd8y6sTHhzRnQbKxF/RrbntuqExRGgH0QGwjWMeqfkEF3M2Gj2Mz84NGIsJ2E9QX0RTfyIVl2DsOy6VDhRZMuC74+jB8YVHgXnEzcChMIrouFUk1tZse7GIGoOtxiJ4wU6lq/Bt/IFHrPTE64uRlWDRr8diuTf49tStPaFFIheFzfEBCcUUaAhUEKw1zRAHLBo1SQQKFQjglAaAMmcn+Ky9dgHOZ2OKlAJQjWKuu1WnKR6wO032di3H7outoFY01MpwTcZ4BZClcGaP0SkQdiduEeOHLtJ94bLUaN8yoQXdDtZfWsYTYynRGDoldUEShTWV6OytfFEEUcih0RZvTRZ7JX6KR/H9Xz+csKfOjO19XHEdqarv2zCAxE7tjRvaD6rZx+Ud3fzCUOH5BSsShaJmeQvtu/FtXET8lX2YzwDco8JONr7N8KMc/Ak8WAaMhcBRJIXzwunWD0IMg8iA7y/tQ2dcOdaoSjPqq/40tCbkL2/ntYule2xXFuYrquooHwHcRNvojMbFkZm+G/RbxquA2W/bh/sQIHkjhLMXUBrt4PQvokKn/9TOsFKA3zcvRqpc8WNlMmMHXrGIjHnACnLx/HPnzrfsvLTnr4zDpf5FlfH19G2bJDkS3ujNJ5fsZpZ21zbzh/cKE/fUvDannDf2lIsW76/A1lKe8c2iFe6QTCzyDzQIqTDZlGPb8Dj4MuVv5BHPnP1hv0uo1rfs62zMnb4decY6zYinQ7PkkeMDlrZE7bNA/ZfCr9Ct+MoNBjCatN8GI0oZ8AptO9inehNUJb2qEvxlrY7kNVVgijAOS21o4bUe4+6LfzY8gDGoc3xZaYwNo5HwtL2BUQVkQo0r9iq6eKVfJy3wUPpkBbgO9vzFDCX6pA+pI/6pqf3lAFOmHbSO1qgeOSsDL8VaW48meY8hlGL6wqM4yHFMgYh5XRtkVo1iWzdsTiu3vciWgf2haEMGAa7HOQ8Yh1PLZFiVaeUiI0E/tG+BDkD0ahIfc+4bMsY+tvg39vyiygsTG1oQjQNzN7XAh5v+2s5nJ++Jr38z+jDoF3AsUkbAAsmq7De3B8agvamMRs7g/m8p2lP1lP6dqqdnjJEVOpIrWLKDNp4/jJzLBefjTn4+3KwMQQJCOxeAy8XTiO1qDrw4o+JaroGHVoSFN/DkmdI7sVTxgUcF3nEmxrHY/2DR4lF93R4fVo9fVXS89bPIfidmTsG2Yfq4Q109bb/HTZWvB/5Zq1npurXGUVnO4Lz4D8z2VkZr4yBvqN6bN8NltXtlxS9poZsXX7z5ikd/wMbTOGhfS095OC8lbmvNmQy7j4Yde7BrQwxxON+lF9OT955ZN5RDfOb5/OJQ7hA6fOZdkF7DfX6zw292Cs6MVzYeZsTRbkyM3r9ecM6dQzbhSjEG1A/CeI4tFuJxIznjiSx9Jx4HsSSbpfFndv9hByjQejAIZMsMPGd5zqRf0VN3buj6gpVHVH5oeGT0+o2xcWsilZYzcvf4kFyeWqhwWHx8rp49FzYKSQPmDiTCTeQWzcE3fabRsk/i4s1En6h6PpOGU1HRssIFfIkE/X5Aq39iZoNeZD86cIJYwzP63qAO1lgHGOXrES1gom1gUb/KnNjTAELddhxvERaZHqVpLPWMStbtKdEfAUonVNCKRbyAYZld3JijQNGiNUPZPTyuBs1yLrqlJpLTrhJPAWtC2zyz+VExJ+ZHgKuLRYz3nVLTq4B0+n+0M/n26Vlz97PfbHtfBNVKrbVXKne6R0/2lzeXVgpwP5aCKRKMVDKsmsfEiXPC2Fzi88L5heeIf55/jtfYxEWOEC+IwRJRBVwAWOaA8ZC8mL9+KOsJvMK7AHiFyCcHLf+ZxAL1r/RaI8bsBXwXfs+wJBm3xF+ha4/D1kOLQqxmCMUWyBisjMjI4i2HnRUrWqGV8tECTOWZVxQKVoodKcOtodDg2UAOmkB+R06GWrol8wWLQ4EpgvWKAiDXWzM3b0R+/SGSM3LEmBFWxhzbElHlV9FrQ1p8iU5Lzd2cjB6jGrxAx4LW6tZr7Cql12dkBBezeYsZq7b/kl2wudvft8FzF0YVRalD3ml58SOzbZ+ZnF/MSQWaZwUrn88VcnxCXJo6gybPV9q1bsFYa3Afe1UaZD79OzruqG7LytAaavI136UXVUYszaS4xPszbGIXuzfpxeKcyYGX6A008KIcJnVsfXX0VZFcOTJxmDo/azJUb3b+8hfnYWGHF5/hxXek0q9bb5xQ4QP/TiHHp1/zpselw/sAOG7P3boJMhKyk221VOxoI7vFnTDEFW60vfhbf/IB4DhCkjfLMBouehUFS6IU722ega8/UUfst4oh3cErxJ+rwI93/A6WUeN83OeJRPKoC1Lukes3qD0obVnwuGxHxMo5WvN1zC4EFlo0VPwqrwW7nWb0QTfERIPnL7YHKclxqxIQ1yVwFh4ok1P57BZXtoz9drkW2qrLVnKt2a0YjEPtyTO20Cz7sufQacvxA95hIGbj87kJOMuS/ciwiNH2QgfTX8V367CJ74OCZF+8lfxxu8CNp12q0GJTpjUKyaajOL7WR4zFtAou8ujShNmIGKlIXyCxHKcGX5/08Ng7c4+o8uwsx69eMLCqeUceH7NvtvQutfED3/A6p+i6hnfaYnsZrFEbp1STo9Akq9WJsWThy/ijZvFbWJkTTQaUuRwNhXNHOcghq1ejKZZFLKuAo9MhpS5JCIGofD3joeeJ3xDOz8Y5Smt2RRxgpS6lgWIYe0TQIC2BsRNBTUEyAfe+vjq2Fg5YrsTRXmboE/qIh+4jwAYGPBHGXtY2zz8KHUYwzLPXkFnyx/bhwsJkamFh1K73YoenV9jtvshg+axdECnsmTJyg8rmw7U1mz1HGsWe8UR/3R4ZFz+8OFyvsfqw2khZMcHv++xwKKWuy6Hi61zWfDZ9T4PtkRAAFD82eL2g3DJQe+NU3FdbyaRkDfod+z5waUYLWpDFjHSfPaEOq7ELH4frphkKsrmwuF9/rB6PatQb8/0AfB+fehD4PtYlzs0W9Ab8pw/VyvbB1r6GihJnVxqJjYGlNta29FG8VRz5Upvbq2qLwcLgxWrvYFMd4D2rT6nx4t//0Ozwq6WVlbW9vfXljTW1tLqqlh4CV27p4cPdtYeA44qjBcbRrSLMwNA7mVo62P+YioFCayBBDYG1zKct2W7WYAtubC/rCABRqeXtVQAO7n+sGFVMLR9sfAKUweVHQAA0YIMbvFdN9VlZWl0TYC0+cIafpRXGIPwYAG/75or2MuF1sUaQXNm+ACBYuhQU2uJfDms8Q7nuAdAQVTPAhkqsEPYY1hCtdQnK4ebO+oYO4FRkHPdwb39pSwd2D1b2t3eV8RcWA0XcYmMA6fqVXWACGjTE3bVVynN9aSMERqTrHlKh0m5vri7tU5+vLm095LZiZ22Mq8YnXzV+4qMYYqLYKNMVZhkhbCLDJVLlN+FRb3+d7tZ311DYR3H0xANQDSMorh7sihO2EEVxQ1DP1h+otc2d/UcCfkYdt7MWQ1hcE9S+MLQnsIt7cJ4XAS8yVhpd8AmVaYvqblAYOSxDY/031OByyFHDL4Jo4iiMIQLj2tYaPVQPt/e3+3AY4+CLH68tUcT6KrW2+nj7YFetc7s/WAdo2gO1Tl2/uo6GpdDB/hJagiheIBoZvFFDM9Lv2h6u6ytL6GwOcQwfzVyLoBqZMNZ1Shq78QEwEftQHNd2P6WiC5zjVoiadwHZMQ7bCLxFYx9C/OIhkbJBbVxmv3QMP4efGf69xb8rBtQRv1RpPpGreLTy0c6N7e0djfb4G/wxJ1pjdMYQ4jGEedxCT4I30R8H1h88ossWFYXtcTBmTTMySCIOlG5xdShTBIgitniwb619RhwuHFkI7jxi8Dzie0tUYI0WiZIIwRuwyJV1jGBcuc30FSe9OWxImMJhO1OYeASqjr6jO4M/ubIOeEdc1h7oix6HuNn+jLgNBTS4IoVwtkXBAGpjleEq4TNwe2cJYIk44IqfXclDA1lSiHgaNQddeBRrSMvdh0tb67/VJd3dAEemy6foxgjuksEuN5Z29jiwuy5wlksrn4AgdpYwMtY2imtb3N6438Rgj0J7CGIY9yFlov93AJ29Jx21s74jPzDpWlU7GwcPH8qD7Y1Hm9u7Ox8T49jZXXq4ucSomusMur2zu06Vi7A0L2BnAqS2D0FzlX5W2KUttTX9re3yifBdyndtrwgDsDVgbG4urTMSZQSzScOW39sDi5NLcWWJeP+l2JsYYyEGZxx4c29pE/ZjANyMo24uT9PfDP3dUjQ4t9nRwENmfv0YnGjVfQBzUmej3HsaC5WbStA5wYr5/LjaW//tGv8U9zVgp0CW7v16A38rGD50ZYqgK9eUrgD0ZHDPrdUlaqgYyucKXYiJfaoYKnc1xPvkyYcuj1CIg+VwFFI46nS6IWa/rwcm3TEZQ6rYe7S1vfVoUwGTF3OjvLG/ug38SsGw5IEVelXg0G9pli0uLS/vRnfMW8M7zSnCe5JCGH2UEUmNHVsclTQME21SlfbAqbiQB9Q9B9Q9B9Q9lyKUglyBTCrH/Wmi1V8bmFLGJzXQpDTB9AOTLu0Kp+YAevVTkYswEPkjoJbiZ0/b1jGSZx+KqYEv/Wx3aWcHYJ+7mA4ewSEC6q43rn4RN8Vj1hbDNc0Yf5vG2eYrYUx/bM/Pyz4z/S4uhkL1pJ2FRo73uQ6fDxWMdS0fyg43vIDdZ7a8BIL0sdic/9IeMSdfWck9PBzfwx2BDnxkyMq94p11qsaq22Ol3oO2X3F7apPWlHTZc2nVxIEu3+8fd9sBB7oeXz/zKg0OyQplmVLah0kGO2zmBFfMYlY8scPpMAyesG7+VPvH/CzyjymGENtlQbgoC445fKaLs/kNN9DnpsfwWpsWovJGUPbYN7Va9UxQ3rtP7+1i6U4xm7TQlNdP3d6DdrP+W6/dVKtQyuw316BG3m9iyc/RBy1JYJIS2PQDWAc/ABAMJ6DrIpY3B4EHCIsIvvXXXVonsyNjaYHghP0dywub9MLfbvqNT/yGpAV39ttdrLfXGThhw6t2lmhhzgF5sAs9EcdxiCMltRFKjZ18h8k9FIWmOMvnd7DwXDvrtF0BGblYAaBwyKuuLtxS7ahJ/XZc55dX9ZkaFOhjuLFGYJ0NsHZcn0+tcDQXLgrJG3tNeLxuH3lR+yCHPV/3BdKS90NXgKUdWtH7cOoq2dMNvOyusoMeeQu4MbsevNGceDtNseVzJtGn4+IfnT1ty7ufgCi9s85ao9wEGRiK8X217B/Ry77biPnVlmunOj2L3znt51obzP6ret0GTDnRC8F9Of8ApSAM/BZ+HFe7bSH0OOYJJUu/N2fwO3sLv3MCg7LRPOJxwq6xt0QJtStm/fvsk5HdeiNxy5mEL3Uu0HeoQNj255t/YsePt/D2iOiFuLe1Y41A+8/ouIIuRB9z8gZUDor56DSSsYNk87iKtgDQPh7ZpwbUdtISFWMNywZbJvAFe7Q0LeE3qjhz1lMNt2HSDsLEuRwdrqGwAl6yjzinkwVLVBPQBxTiJgK1dPrvRrtJ9NdoNtgM4g0KFVpf8JGKmu4HcfAs/aCPV+gCoh/CUsagHR8NTgda3cLWTIJ+beU4wKoZnhqU+PXgE6mXePHQhzhSGgH7Ru7+YSHcn1m0tIvmRXYBgs0Y2UtJ3zPnR+XgBOfxuGDNjxiFzAi7uftu+ETO9abnwwj4m0ax4Xaanb3JGRrWtFCcJZFysJd3Eu5O/YIPaDyO1CrRGY25uz8w9gRAg9KGBLPw+qk9yvHGr4ZWw24vzqxj12QgrFHGcXZXLN/DQ5Gw8GLllBi2/2ehm/hKRS21Wm3oBJfE/eqyW37Sball1s8yxEyriX1BRpjRSCorAr8UIs3E8Q6Ihtt1XBvQVa6Ijbi5ggeZ8H6T0WiU2OCvekShq37ARLQKI2hJgIJ19hSzVvE7Gi+GLmD8a7CCF/f5uMACCBAsANpYw+h+IMbDDz2G4WkYwAfglqh1sRhaD12/GrQQup40n3gKbJhYT93vMA6H2tQudZhbkwRADbblnQqSTIjWQHOP2sFEy4gYYj+kduTcoSBkaNAZsSzdxVbrrjmHuCuq2RAEo+UyjAZjYTD6Bf8iG7o0a/yq6GJ3tRqXrl3+lGvAsBECkaEEdoQBLIBcwTgODGDEMxAAGKieGtoTtkx70OvudUuo/l43aPF3ot7d6zXKxG3BcalcLM/QxCAnww5oMogwC9RBQ8dqUyqEdGMcNMLzlwctZkMHLOtQfp+x2dln7AqXsROsjChUhZBf/LehxVpZDjwcw4F6uUZ3NZ/+WvR3YhDC6EokVqa4lo/jsap80nJVBXDXXo2PGwAOTHkUIV7WWzgG2yqTVOK1ggZNDtBdV8uqWlM0FVdP1RG9cESvH5Xpn09/gTqqtNURBelBXR3Ro1agNwaOKJ2jrjqi39O6r3xY09MFmficiY9MMGB8fn7a1ubzLVULQjdO9ETGABNIvaXqJwpzUYPybfiqcaKalEOr2aooyrlFdEaB04pqUzFxLLsCHt3gPbU6/UOFSaakP3pM/07oHzVKGyUIXBx6pVQCl0oXUAJBWYmzbb0jUK4zTHjNGIHXAmPsTP/wYQsfyh4BBZBoxwMrog/5QEl01jWd/n+kJ5f5dKEgz65w96/wJtGKsXxgAJ1V8Wi0SlKpyFw7vCuxBk6Hn/Uqg9gyW3jAwG3gB3yUm1hBxBbAgyKho0ojHjbae+W236LRSmnWakQbkviONpwOEWcEIdYMhn0299uH4fg+zacHbAVxwN5gGQWEN5I+a7afVGvsowF1/rfZBvYzzGVD7AyllNNiyVmu2bYgnND9VrPDhr5oAhfgeutgRzSsN9E+VsyhRmDeFp7VZ0awa1zwH+drbVhlsc0DO0oXEwg4cYEXKxEWvmfnVWhqwOunf6hdA8X99MatQgcsU0SgMrabfiNyVnHRWpO9aEMYCS0w5Zx2PzJlv9v6Y2z5UEOzw8WYkYlYUA79ZnMDjhiMSyh2pszPH9rh8VCPZCucATE++mvsTCHybsnHXfLaQGFQiMnY/W5OYl7lr+cK8A4WHu+8HFfyuuzyLNqhPxdnGqeeLzjTjXZ8tOWxMy1RNps/iO/gM1XtqbNq/qxHZelVz7QJzK/syB0p73fDYxasWyrsLOUH9sBKnOJm7HzWcRYW551MbuK+Y99LHaqh0cmCRuCMnfoOzVL+OjKWT8up1NDoYoRtMmSrLn+Ylk6A6zJpxYds+wyBF0ssDBbmlkXZ8ZcwWwGUegZnlE3iIW2xoCUy1c0JXc9iZBnLNjZD+YXn7IcrynL6Nc6eU8vyB2ywC2SAc+U8UwvPc5Ig2+5/zwba5znDfWLf7e4tEqzyiuSwrLRsHoAjQZYPBOD5bX12QW9ABvXjymmvoOqBZcmEprcYfwJbsGa1SkzWmItzJWf/FfmeZnZVZz/WZ8o90S0GrwMVD+yWnUuISz3+LZ5ozMxmp9OsP1E0nz+B+9cGeyh9o6ZXUirNvQ4gbBsTl4HT0f1+PvGaFtPVheMbWOHQcsfSx9tv2XnncMK+TqI9fAkNLah5+kfyu1qMrKVooIq1mS4K40HeY1WPNnD+ga0pMD8yVJicGLXr6XQtJMvxy51W0wgL4LdNO6layBbYY9Y1S12zrJd/w6MyBTKPEc2S/dp5LUhelAmVMiLUb9mIZd1MzCuxsNTQiQZ8HPtlj22qtO+72BiAiSTRTlEn0G6VxUdC7DCAHOoYZzRPz61r66/JXH9i8PgaixiAJf+P7Avl44sgsmomb0pMy0X2JMNzbriYDq0YDOeHVQIb3LP5YcW4c66YopO8UhbPCM6pZZpBSSUUgEJodHSalngFF/9OTsWSkzvzi5PMp6DQq7staBt5wZwy0OzmZlFyCDkLni3cgyOf+FRw++7dzWhWUXKsUE8kQY7dZI4b1Cs9s+SDbiHnMyyajtdgqlr3xSOKB5GV7++FgS74XWWbm7v7KxgjGQ/nMeJYkJn+R/Yhs7fRfndb3yb6PRxnk4IfxmzoJpnO07NTt74liO3sM8k8hplthltuMoYIEPFJ5exNToilB9K4Pdtn4+dpaCkICXrq16Oc3wmznv1rlI1ZKzwbT93BgbFuu0YrcUylOWuSnRhY7Dnkmu0sw1dZaAYS0pzmHQtyEMnYg728EMZMRcHaIgMvLDVMdSNakXF+Mz3Lzotf/Bt/atbURMreMs58QClJ8iJJgSRuLBH35Z+624YYu/QFRPtlzyf6X/YDnMVbxjlu/DZw0nipxrZLnBJ+PvWb0E0tt6GSXaaa9z5r0py84la8Dr8E0EYaCTDCXTkGCI/LK3OSZ/HbqPLhQHmTbgO/RsJ226/DVGilR/x41W0/4ccIhDEPYfXU2KWc+K6dd71CT4c9T9755Nh94nNok+3JXA5v12iRG720zcdKdbB87EuCtAbm656L6krQc6Ov9lCLsFR8Fy/Dfrf9tNuELg53uolWaWFCy/AnHNh70pPP/Xr4YbNypFviAbGZ5bZPzf6ghpaSvqKlAi1upRAPuuXjwHfVQ0jhpWa7qR7igLW8iMZRUQuZDORL/n3kAT1YfUwMsLfqIdDhoq2zZhW1R+ioqdZPcCpbWnKDlu4N2JGZwDKgY+nutCFJb3jUWCvHtHwFkijmbq4Nh6THJYhO5FBYRl0eidTF1TecMIJcQA7pXpGw6Ra5080qN/FukRha89WiF8Jc6x7/mIQa9GtIZtNtNymvTa/id+sYKJsyUCSC05Kgph652em2gVYvN2ER9W1IO/oeFu5H8Tci8pF7ISD0yqZfaYTtuklMe4XnmE0/6PR2oQPbbJbL7JNhyz1xP28KPVC4p7ZrlQ0supj+5Xe17ZaUHgByQR66IjtuzYtoiO+4iAhFBcRdVLwdt+X2XMq0pXagyt7pVqsUancVd95OjSblneZpRZO5biV8SYXvCQ/ZbfZc6aM9t1KpeRKru3yPJC79XtiqFGBgULXne42GC5DPEyJSQwpRc/fRw14DuqZY00e0se8CcpOodR/eCKDFb9bdThML6kYA9Q0x7qgF9Oj+7Bimi9Le/LtXh7pLk5hcOCPN6v+BsOXjoKbaRyVLjrNWGL1Lz/z67nruknvHcpZVXwLuG6aQFklrSk3lRKk9bel0UbrZqWkW/bXYfF2JrounmWP7ucqnhhxsb+YW2GVQJosd0In8BC/iJ89nKJfISfVyxhQW8jLvZ0CoddU18QZdUdd4VwPKguikYYiszueesywk/XP6eCrJksY4mWGBMAfCjeLhM7Fwdp5Z+oAy/pQ+ycLSFy2szvkl1P6e0nfpwig9Zck4R6Kx02YRm0SRGf7WsoyYMGe9GtxdPIFpB6dUfC72/9UnWmDu3uNi4zQVZZ6Fz6tsNidTOVLFilIKKep7fmJZg1U07i/jZZ5+uzkI6lV6lB7A6+YlLTQ90EJ3f2JLNuG6mD2jzU7NzNjGCHRAjXBR0WCONE68Zmv32CXxuexwPMvKuS1afPpQzFPeN/toiXVIH0HWjDZXWOjE9lVopzp5mbaD3pmbvvtjvcjA/jPJZs2K9gMFp5DjGnvHksINdBERFB5P4rAz2isf+yJgXZ9TmpwAjAVH9X+N8jRk9WeSwUF3PoBmMrBk9Ze+OzX3URwZqHPqH6Vnp6c3OMMPuYRZt9OqvSKLD1+Zw+z0zC/iOZRpRe55Uon09OzdrXhO8vBL5HXzB/G8vM+D9MzNO5/Es6C4L5H+rZ/F0z8mTlXzSm47SN+8PbUbzyZ69CVyu93XNxDp0zen5vr6BpFfIofZvvpgttc9c+vuzb76RI++RG53fhzPjdYST3BuJn1nZieelYn/Ehn1E3VQRsNNz/Q1XOB+qYa7+6O+HDo9EnIpeqqPnCX6989lZorYj8xbqRij+ss+LK+NODfJTqZ+f2YwOzP9WSwxKAMzI1ArfHk+84MIbWxer4qnR8003bD0o0qzjF0WTPuTKXGx/APNQ7H54evTEn9qp3mNf4hYejN3zW8IZNDMzJwdupvu0+v74WnPgTOeBjfok6iEFxIIzS1ekkpYYGnFm/f60hJ4ZO1/0uwvGJekgJugCEpEN8u37cO6f+Y3uIaC0cAqLzTtqNYGmQ2On0X58DfXjMJh5tb3ad5K9cOX/ih620mFb96eC6Pj4/sGq1KsnEzPKfjX5JesyXDieBB+CDfwIblMcKDw0mQcO9eX0o9seSl8xebU0/a46MQhjVlaJyMqmfxhWqQSkTTp5V/YRmbBN0O5BbRWPm0x9N137PzQAjUZ616+a8fzmZ2Z/Q7UISgwnv4lcEjDu9V4N75ZDbOGFu78MtZK2YyislmxNvxLOz/pZIYWFGd4Cz4uRiG2Aq2SWgT1zmYpcfF+ot2f1CJWcGcGqiUgLoZRP7RFsCP5YI81tUw13yc5fZwy5tEpOtAMfRido48dvU85dt6vFybO+BcCz+zNaSKoYc10hiXq5nYkdqHUnNTYMJ8VCvvqguv/QQcIFoQwNNXN23Y8vdeo+T9jj993xofHDeCRbZFIZ7EHJzvfaHeC0e4G8L4gW8alKxSnL0ZzMmsiF2kAlRbFsVuQMWGGKtCnH2dvzv4dLsBA/l9x9uHpy9mZu3M26p8bD+0/TRPkLimEHRV86kaspQekZeRgUAAKgtBRwjk+J0ip/PMFB5rZ83SBF0wLqcIiAuyYxXopMSHar5+JHe2yyOGzN2eOYvuIEfkQ9bwWzSiQyBCNlZj8PXrR28nszVu/tF9CTWkQ0U9DZ8i0NNWnuRYWzZCZtMQtg97SqhgwKN7XVhXjgVNcCEfIVtUmlqg+O+UWCx3jlKDjHsVQ45Uo+yuWZvR8RnDqFUAX2o1vpg/lQu+y0TxT88v6EGwEtRRiUXfrUPKHbhjYHiHmf6HP77HxScS+9gM5yBlzNgR/44Hxgx95UpDp+X+OLCmXGBpgWe9cw+com0CtiKNLIrF2L7SWMMdoQ3sJLucadmge8A4E25+uNzoeXApuNTsHnPMWvMH7ZbVt9mV2qO7AVtyl985abG8Eb/ZqF24e6p7aK8NRoNoTh8p7ApW434WKCbaXSpL9FHxGY4Bpa+592/hW4C1V8aYwz/vnC89VBoAwBkBkMaeeL+JEdm5Rmymk2I1CpNww2ouP4sgu9woCdfIXjLXsjGJz+8/te7wyvtG3CXz5qlN8AGHz6HNtdRSkrPv5aqnA7rvcoJ7hI7w4cjnwFvbKJou50ftsiEnX5yOFiYGvRrQsJtiV4l/Bwib5PdERxNxBrewchEfg+OgYBBxUY9Q28uUQb/BgJ+ILPXFjm8XHxDisvYX3Pe0Hwc0OpCNbfRdqQF9mWeUQq8ZTvSndcSoqf9b7olCvOxWnQh1VrnQKbYpt832+dAoYmLzXBoJGqVwpnCm55o9rBYmndGCO5bNZUctCEl71KCgEComm9AD9r/XuWAbKEWeUZ4Cp/PEZA+5qWEpYkMbwKuOglAxizw/wDTG+MGJCTeWbTwva/7dcEEHRpV5BvIPzL24pkurHlqm57MDet9n5diZzMRtVvG+YjMa5AQI7n1i4oUaH0pNZQTEJ5SRxaJEmLkecd+7Ff/MnxtwNSAJKmy8bg5xajRkohnOI4EoCdbvvxjAsc88cK35D7Cq85ePwsTtt/BXGsLW0uYu9Gr5nTILAgvBjjKSF0/NvDQcgYkh1fC2HgUotfBgL1pvsfHeA+1b8OqA9wBMBn6KDYaPoe+JixNf9zoAnAPOVhMKP5Db6RjwGxOuC275SYZdGg2ro5+JUQM8CfOgixB5pVOpuud3kQPh5hKoSNTpCzFxNtLkRF55wVeB3jlVfzsb4yn3i6Z3MPm/sdIXOXnt2OWrCoU8MJoanLL6UzVxcMoi6fMeeEHS45XaOY64NpFK6Rg3vlA3G6coODmAWrh3b9OHHSKgcC1bYJEzf9d0YmPYI2YNCTZ5Cw1DZuOIFYbzEzYGexYxZo9jXhzgeMGoMG32gxYNTt6XRXGCS3zRe6kEiEXqBOos31pnx5xdBBoJpnAqIVCiy5JjBjUZohaVM7uVM5iJOF5sP3Hcm6CV4NLJk9lOZ/GKG7f2cFJwEwh1qbsH4LVpYMCZsOThyeX54PTdh39f8KEszY5bN5HnyeDbKK55f2UP5oO0WAAyVfVbAwihuQPD9SCo2LgTzoafLc5l5z0nipPKdi+yplecF9TsjLFaUyx8vd25NfYJKk9zVVu0qS7vDw8NqbGzMCsXxaTWoZ57pm/FnxGBg9ta0zUJ2u1sqEHdV7RKJiRdTw8t6DXD7kvdfrdFGRpNGYxNYRB96vySOzhAd3ziqpcVFGMufMSeirKzXs8X9OEHxxBH5cYEdyP+ikRwk2axlJhBXrP3dAObcLrt9jxt5XjDvZHtprwauJjaeGj+JBlwIGWrgP/p8dGrEUJysceuliiv+vnGARGNAaKaADLUHMg2hxIM1dA4qI6uHU2baPf+PzSmGYlHyARp6iapGPIPPu5Aw3xN/+gqOYjT+RwlAJmyywzj1bLkj+Ftiw1M2Inb5uC0NoR2IwltXuelBENaTXgiYDtReLBcqAP2BfXXFP4HBpOHMGrgNzSWuZPQPO5JhyVx7Oqf2+8JjX8xHXoeTlMYM1LEb8P0xRHjAL8HJjPIhCbe6nZiTdmrq0BGqHxB/l870kVfNC8/xlJEoI8SDP8OssE6TWbt34nunbGko/uG0yxl2O+NB5q5ov+gh3hX2tNvuaVHKIRDjdGGUJmLAsD0/gXhAdzhqaHyNc2WCGttvUd+FHNg4hsVTWreI/W+H1xYGNAwd09Vn0dj3/ZmU4gtfH0v8uR2Di+EjYwYzJp3+13EOCTLneOhtLqWa+oaEP7o7kzviw+xREiJoHNW8yG79eNCFDFriGLZSG0FGkXF2HXv1c3ZXeMr2j3Owqry+oB25wk3cgEu6CEWGL/kb6pB9EX7bDhGRfmlrpCQ7XaPm6LpHXuYpJrcWcbfZ/z7yUqy3+Og/KZzWG7DWiUIX3XerP/BLMPPSPi+tgR/h+zf/O9sZNR++YzWQ187N6a/ZW7euy5w5qjvmYnI8jVa0OSfxboxEKzJeo+VjzErTKYnDL1oNaU+jg48to6MZx768G7BTTm7X279FJqEzqreQhbZFpaRfPA+Reyqf42zpOnEsqDXUSsccX9WALXiy3YDJS7fmy++6XH4jl0dy+a36NSOO7/Lo3xXsNq2UYMSXAwAM8oFlypNPsbnmqucGdmpG00EFrsvaOMwhFySxIo7HaGFgfJAhSCsKyqHEEB/hdCjwV/5Zt9XvsdrAtUfgGVS4wIdszcfizHnTrhyejLsBO8UfczxhvC0j4fc5oI4AFiMPnF0+fxJNmmbP51NZQoP5hecwVUlWuE1Z+Ap5CwMbPK8/YNVt1XIieLaoV0mogGvLZhu/dMNqOZrZ+dps02Ue504UfgCvLvjqcMzvHOJ/7a2f/fXfYOf9p45Nv8+fP2fdD62YDxeGrsuxio/sbFZFLjFlAR0HwBoOha5hMWSFrGQ5hWdQ1Wqp9IgNQENjATvcX4irmV+uZR4X++6F8LNINQ1jUVi8yrAdtg+hTx18y7Dqeg+qqsORoUkJf8RY41lnL6XkNK/FU9bUVr5e+aJ70imoqc/ylc4XJB1Xzm89Q9ewS9S6CoP7PClxcPCap7ZC0KlgppL/85UvCjkqMUW++vU8sqf21wcW8nLkBuSTZWXMVv74c4/mJirg8ee45k8bVFxNakuZB6+GG6aPql6JigLR7u9C6eEInITxTq/hkz6fymkJryJSXlDW2EhBs2oAkkh4cE+OghyEvXYOhxkAi4RhUW7WINi2NVKRHJg4UbRyhcAbUKgbOdj1ah0gIXoBdBMnGp2IOQAt8DoMkQjHlUCJVN7nJO2xbKVFvUhANtBoqkoFIamvhrNR8NhQfeL1KFzzWwYZiMVnkf4YzUdOEfJy9VhwU46l0MeQx4+ZNRwHvbry0Q5+RTst9LnM4D6fCwNiYZ/5EFiPQr45A8f2xNMy4edVioPYJgg9gBKpBU9VjbOvMXZIHWdPSFikr+tSkHrlNv1R69S9ihycJ+ERj1mk5CMr9S6fHqpDnmt4R5EyQFzytxnMEx4MqXotVlO0PlctLlOrXaG0WiRCYnFArwI7BT9PFLNDAPDw1oBbmeLfaRxH96EyoE5oc1do+VMJcGhbMLfa3GltrhQHgzIO3YMWAj5SEzvzKH0hzhD9I2jTGQmHsVwCIi+9sAj4bCugW+rABaAvcCgnRHApAWqIMVyA5YJ8O2dVLdN+Tuxb+lqDs8iZWIFx6ba49wRHAElCRKccTgJ1iu445aOycX6vTj+fJhaK9j49VWcgjbMSfXgG6s+pM6aOM1DkmeR6RgShztDtZ9zWEKifmMNk+THej8oCzpvhXkqxHfGHtpkxYHnI3IB4vciqMFjM4kDc9fRQ7vmCGr0xcv+wYHFCRaeUJWYS+k+NQ6/wxvyLfzj1QQiIkr/2IbFCkyn7Q2ULw+KorJyds6WpjHP24IHsKPOzUec0irYmeFHNcpvjaIeMw2N2oR+txkwbaiwWG2KCKOzDDeUn7IIBIqXbSQ4LGokBI3FsyHpsN5dk+VVlqWVsdpmfD29k41zfPBvwrJ9/B4pZMAAAV7uYV6Fp34FmSojuKyO6r6nM70AzJUT3lRHdVWjnb0aWCdFfGaL/5tB5QnRXhuiS6T0huq93ev/mUOA70E0J0SfTe0J07w/RfXOYa0J0V4boXsED2Vbhm0GQ34wsk2F3ZYZdImAkRJcIGFemmRKiS7YH3vksE6K/MkT/zaHzhOiuDNEl03tCdMn2wHubZUL0V4bok+k9Ibpker8yzZQQ3dewPfDMrtd60bHaz90TVzv5vDs1N2eO1mbvFazQ+3DkkkqinHPtHbnZAOgJu7YzH947v+xDc6g/TELc8KT/0j40x68FkabPA0A6/fiSZM0HUoRLMnnpg8HcZ2/Nvfj0Jx/Y41k5lIE+coJ7z/LG3dgoZfysYH0zRu83I8uER10ZHpVIYwnRJdLYlWmmhOiSvZR3PsuE6K8M0X9z6DwhuitDdMn0nhBdspfy3maZEP2VIfpkek+ILpner0wzJUT3B99LYTCrl26l/My+tFJwlPkT27i/1E6Fm9qt4V/Z4gswe48hIO1XAxlKnK1GLA0eeT0GRChvxnw3o/CMCfHinxrvlW4p6LTdckc7n2PXXNpFungV1kgd4k0ZLoW1S2V2e1w+dtuhd+WKx6AiF5zmGw/3TYMnLi6XI6D1QHwuR56XjQthceXOLoLF+3LNAwpNcAGNxHgIblYjz8HsxF08AvdUw+0AvZb9UDbhU+xIe2vTDoG7bQVsWANo0vaqQAtgz7+dY/jRNP4pj5Fv0KwCFIsbiD2bSYmRtXiJZ5+CBg498sXe9sudaivmYE37Aw5OfbQmnFdTZg3/C3hjP/YDJXnzL90ARtYHiCy8SJ80/Qr91CjpmhdDLwNljeYuQ5FpaBQZ7SNzCn6BL2JNtAB19Qo8CE/jQFQLL3tJe3B/LJQ7KYSbyqcYBwUuM3MqP7QA12Zw2P7cMu7bAZ6ysEjXBfgdvpG/waCwKq/4C0CmHDJo7PNcgUn9e7YA/nAtuepE/Pmx4d8FiPJD+3r+8LoTFCauxzy2fd+m0rMH5En4dUSDaaS59UZVbblb0rq/1l5H4QdyKfPAgHM44gNy0Mmo8Z7M24dr3k6rEPMQ6W/A/2S6LblsLamtpSIGFI1Gr13kO/HHzWFfYG44DAghChxsbOhxGQK+D7hqZdeE2sNqjERm7Qzj0HCLq/lchkqaX1wYQvNms8aJPuPYpKjdD0fvs3fmmFO79D1E/D0g0aiRe9ptrsyRgIwFtx1nDNe+aYk+LAjzRWiC+RGx8BFH8fMRVVAj6DRFn6D3Rl75jD4mvocfwf4bARcWx6MGwu9HzIDZhSplTEQuzPcjewzlQylGxogQUojcsEccwMnmu2eFvLj4BNSSU1L5jLjlkxunuzo3NZWhy/KDBwXcrsjtA7pVzp6FxMaIEsedfEGcxDtBiu8sk6tkSjT84t/8ow9CV9Zjj0foFX4R3MU7oh4Es6WbjCRE/UTMFc5MM95Zy21UKEKQQ/gdv9QG484IdEWm7ZWpETLskzFDzKXjnqkM+10M5Dt5D97ee/ieCKjs4UlzwCs+M1ua4NqVPi/4DAqBD8u+MplnBEiEffsiF+0lv+aBYVKBBL6svzDAd8jhFWfCxDQbNA+0KJ26R4MBcFkt4sn+GYjhadcN/AzxiKfdJvNq+BmGW8shJelmxjVcY7tbo6oagMZugz/g/BkLhXhzjmEb4d05Lz1DHaMEGuLF3/+zl3UNu2+Fw1bBcTTel4MmfLcG+acnBT2HZtBSTs7Mogs5hGkOPaFJp9lGSXQSmXKz1ZPfIWpLr3HUOVaZ7hz1YZWvXD0HjLHsYs51K2127Z+Bi0yucLcNgPGMnnzFuTJ3lO5xft2xy2UK0LcV/kEq+DPuZIn9oFSLmtuAhtxKDxAcxC3wt0A/+FvEHwUoWfhxRQnYY35GhJluJwzjxzLQAg4TMEkLurSYUBiCR9zty3eWfFjxGs06NSO1lKr0qJP9MtUW6DXNakYmbieXU95TBz9dt8bXE/xykvyrX0Sl/DbJCi7Eh0yd6IHENTSo9m974jXw4Zmr35X6Z9grqrnjZrDwFo2KKvHUbtsLGPwgw3nRc/Z7iwRAajxXUwvWXSo1NSZJo3ijGxxn4g1Ewy7DbmKPyhV4yjUPwQNCWgmFCRrrKCRqHjU4coTzXCmh0uXlnmQRDZG1cl1pwoKQwg+1JJJZ1JloMmSiY4rLdOAKnGtdd594A2USn7ZmlBq5Rh5acSAGSEN0eYqfE4ZjYFydJvznsmRGBWeInYYXetJFFMtR8ZKiIhqEAo52KxV6CxUP6S8koctbDx9FTT/QbC3XRx+2PO9JhpuNQ905pUdxqxn4urAhiA+Fw67WSB/4DYch5F3hhkyfJuhrL78DxYyCQyJbG7riltFt0J2zGEQQyYW0FXoFNqAUmXLerRQonYCGRtt8zG3J3ZZZ1FIqtS2j2VGg26nOxYjhUt4Eh8+4GKINmRW6O0Y5L2UYOQi+RgTmnPs7WDFX0ZxcRnKHxBga34abdtok5bjCyV86zph3Cu9CtcIM9AQTcWDTHGYsfMlaY0oBS5bJkzo7I8DfbXVK7GdwBHEnx/r1C6/ddHKXzkeLL5mM8pkUCbIFlZ9fhPxGEvTl09n/8McfsEQePtBgCPRvBBLFSN7zgVjIV46Em3R5gaXWSNy3IcD2i/8T8TVC3guqlVpM1rUUwjxGq7QWo6Xu5BRevP9Vpa10wlL83z/pgWRzvkUffHVpc+RIvtRkIEDTI1EwfBRrt/xU5m64DLHDu9dr9Df7uL/mr/j2dzfbm31sXSRpAEfdGSDoESRc7RQ08AZAMy4dC1svG0qHKiafK730cBylFw+0+LgsucFiXPLdxc96sHzVcWMC3X0/rty5b0eoux/ah/edUxjDvvh7PIpZgQYV2LOsLvgwrTgsWZL368aoHFj8Usq4vEpFNj4A1tKng5NkxvQ6CgqwA6yTQjCE8+n03DNrjChYLwOTAr1LBYqUo1b8TxCVKKVnnHLKikHnzd6++Wf2YRZEeePVRMnVozXeV16TgZZN8v3q8v39COYvbKISRRGgmsU//uByLEUOodTnVkJR35h8X0pR/QSVM7Bpt299zyaZd9zKpSez0CcyUt4hBJzcBQQvevYv2PNcoPnFewtA8bCv31CHzH7fSrwuvjWxaMX+7DTvjmSgoqIiz774c+j7qJBDtNwVYEyRhy4pMxqVFatfQ7ktALEGMhQjte7r34Wpcg/2/bDoMzs7/eKPoV8TGVo+TI9b84vUk19JPd+w/m9Q19euOb+Zlz5No3Wh/bYgAae/yfW3UvoZjQq8gd0Q2VPkPcJoM0/02RrEWLmVinJrvqtVsUGZUamP+jFgewx3pZ8AjiqECnROSQy3BJ1Ko0czdhBl16QfvyNv3rMUIPYY1w6DuFkVBVWzI/uHDVYptSteu8QK647PEE315okXB13qNupuwz3yKhr3CFpng3Tkd44lr3NLRduxAYO89qHY6i1Xr/xEMPz6tlpDHPEaVGpepMQ/gXYkQv8+Y1DVcKvVP6O04pDaMfRs+aIP8Q8Yq+Ung8h+3BIto5SDEu7Ea7f9iifKwSDcV41hXQNdqsw6MNb1Q4USYgC6QCYM/C/Q2kHHLT+hsjbL4T6q7JbGN0jbPUaeote7DdNA3UbgVg184InfhgZpYMM0xN+1ri4XlvwdDU15NctIMltUBgc44Kw4ujjWJ3RtclaO0UJvz35o54ntYe7+3B4fsXjwy45WHJ7Z4M+3vSNGhZctg6qoRUF+rGdttd2juqv0S90GcJ5P3XYDml+nREKD2RYssJigDTACr14iApRxUgVBKA3aq7HfmYZjEMEayZnozeK2FyRqO0z9xRGQnK/eGi8p0DtXoJfIxPRniwz1j/8EMlQybSbTZjJtvoPTJo3iubm737LzWTb2uwzzvKwxz2mw/zu/v8LkSnCzpEDvXIHeVCkzO/PiH+t9xtBmdfS+uu+MWijQ8LAKzVJBuyqh3KRAXzvlck7nw2yaLcqpmy+2DBXfBxk7o6ZQr0m13wSF7Tct3zelqOHziKJu356y3yA7ttH/qzotI5fv51iwyGsT1Lxzmi3IjB+I/IJiLdoLspMeTGg5fZia6H4BlcwfjlFgjOWQseH7i/zmAjHhRRqc+eGxAhqT3tBiEqjZOaW2tRQMBXhB4JTMkp6e6hhLw9kbzR8lbfPQRwrDlhoOa0stwbVFk9/X0YiKTQb0SL4ak1K8ZjPxtjrmGfp4zNLmE8J67InwbEiM6YA8eBWjKYTvhUz6NZ5JbZLafHW1eYWOHEXKDRVy7K6Mxtd4tKoI6/1lWvHtJTawrsm9R/3zflFbUpurW5uXc4L4oZl3v56If5/qE/UbdjVwkAkJ0XuTsCXEwSoWQC0tW1kpCFqWEsHLJskL+57YKFkUfkyfOHYOX02zYgqn2rRgNzp/Xct2ibyXcJKkNu9gbRJ572r3z/tFbUltrm5tEnnv3azPW5P3SMpbJFlvOhHoElaR1OZdrU0i0F3t/nm/qC2pzdWtTSLQvZv1SRR4734fvl+cJKnN1a1NIu9d7f55v6gtqc3VrU0i772b9Xm7Cjzw5USHl3CLpDbvbm0Sme5q98/7RW1Jba5ubRKZ7t2sT6LDe/f78P3iJEltrm5tEnnvavfP+0VtSW2ubm0See/drE+iw3s3+un94hZJba5ubRKZ7mr3z/tFbUltrm5tEpnu3axPosN79/vw/eIkSW2ubm0See9q98/7RW1Jba5ubRJ5792sT6LDezf66f3iFkltrm5tEpnuavfP+0VtSW2ubm0Sme7drE+iw3v3+/D94iRJba5ubRJ572r3z/tFbUltrm5tEnnv3azP29XhhamR0EcCX8As9XeHo6BkmIiICfNJavN+1CYREa92/7xf1JbU5urWJhER3836vFUR0WKs8DvTNwWRb9QRYEmufxxRUtrC1N9i5LUJjeJnPsI3aAZ+lytD78urVXucQZQjlF4GwbWcIMXZvQxA1oDMXvICqg2BM3/vvMAAmXNzd/9jnY2BHtaAvQLEayG9cU5vyAlkuqOB7ATU5oHE9Y3wwhvcvWJWNeV00GppRpHOoBmA0P7ig28DYzor/3R66XFrfpEo9StBzH1Z/MCMav6+igaRATkIX48lRPqbXH8rpZ+NJ5jjCeZ4gjn+LmKOW1EZnJzRW1wc6xO6NjmuGNF8yswBychPRn4y8t/FkS/5Lyyq/Pg5CZQoLjoIRc9bKgpa9qAMeOPPPoDYSoSkpeFEGkykwUQaTOaEZE54x+eE31ManMhjDrmoLfgH9uU1/fqqqTUb4zSpUQHvvPijH35gE6vSE9jr8SyLa5C6sv2oS3uVi6hp7G3PTMyKpd6X6d8oV1Q7klgSoSURWhKhJRFaEqHlmyW0KDPWS81mjUYqkUf52G0TBZf9OnVVpUkkQnTcI2KjXq/Wmi6IsUMUSB3aLH3OY4u/C46b7Q74Arq6i3e6/FJXHpxQqidNn8ZMwlUSrvIH5Crqyo7Yr0j24yHNKinZM8UDqWo65F+JyJeIfInIlzDnr5s5JyJfIvIlXCXhKm9f5LsgAhljLnomXZU/v1dQC4sgHNigzd6e+6U9fph3OtcKE9bI5IRdr6WpitQSnR49vfvif//OBzYm3EMZkqeLVq7Almn5SJfGI4uo3auXqB2ku6ool6p7neMmXZqVbk03pTLJm8ZCtUWpKvq53HhiXJAMpWSCfocnaF1MEdSHx2wjubMJ8YStTYjFGrkQNyTmDyYorA2JxYYY315qrMt2za9p1EzDOynQO1ggTWiYzgb/cpcs8ZNJI5k0kkkjmTTeZ5aYFOhLTRrhCZeCHPaZnZ168X/8CRs18lB3gpTwidC+MZlUkkklmVTezUlFRosoO2Zf3PmzvnF+ebkdcQ2R2DYne0bJnlEyESQTwXswEfy+ts3h1GHH542XHgLHJwv8yf+kz3a/mVnx1e1nM4P+U5GUebCbrYZESk6YY8Ic313mqMf2GAa2saJ/CYvDqy9+9Lc+0NzNF89qKRpSVo7o3oqfCUwYQsIQEobwLjKENxaWjHTgfotPVCUL52ThnCyck6kgmQre+ang93cRE475q2V0mQzEr8c+EewQJHL+Sg96+YX0vey55RTg5Q4zqM/stMFj2RYh43/7Yy1kXC3CSqatZLS8pdFChP5dm6aGSTtt6pH+12zmp1P0eya73kXsqSNQUKX81DRup6YLIo0t09cVjJ9iiq7WhHJKffd4p/8NmZK8fCZVyF3yIF+p1urdgqp1aYhYNHxtP52esxcXF3Jqfp5+8pmFwqIap+9vqILlTKvnimaMHD9JyVQztDC/WFjIUe3u2OP58XRB6w5fqkrNYmHRojakxur4zUb6ZzalOZlT2azKnz+DSD1upSezBUryxX95+wPt4bNgwR+7c86T3fmzd9+HalKbpDZ/aG+9z6z+HyRbbhIPrWI80mAM+BzA+1P196sjk9pc3dq8epDFpR+WbrSAIZIDCwpWZCn5Prh2H48pmpLaJLX5OkAEkrksqU1Sm7c6l1WayaBKapPU5m0OKhpRLAEmAmBSm6Q2b1MAHOf9h3tWDurbZOJKapPU5i1PXJHN8HvDTt4v5pjU5urWJtFcJLVJavMHm6u0QUIytpLaJLV5q1pBv5qIgEltktokIuA3gxUmtbm6tXn5NDXO2kBYrHIolcxaSW2S2rzdWcvKJfNWUpukNm9z3rIm1LFXa3ltmrOc01QyaSW1SWqTLLW+GWwxqc3Vrc0rpizthfX2h/bhfZqz7HT6H9mH4/lrToc+x0kut1LZd48+5nlNuZ1O2y91Ox4fCfTqXqMTKL9x7LV9DvDpzprbw7m/erPi1WKnA1vuEQ79eYHXPvFOj/2OjpcDklEegccnXFTHxOy0vap/Jib4cjbNYrAMLvjsn1HBqdR/Yzt70uITdrrmNo66lF2mHBy77Ra9duvn8eNpC/M42xae7hsBDMehky9MOHlLEkkhn8LiqG6fO9PKnh9a3V7Zf7Szxr24ODyWx0HZ4fzhcAFecvOHY4WJMXY84eT5lfnhsUveUPPUQUOZjKXm6ZdfzBQUBYYyOPqdod8Jhw/n5RZtn+s49yL/Yf/xOj7R6pQiyI4hHWNB7iip92g2eL/mtqQ2V7c2r1gso0i5oULOmZTxNR55cwjr/WVa8e0llu/3J5F7j/rn/aK2pDZXtzYv5wRKz+1U2sK7X89IVnk/6hP1G9zi0A9eIsbtTI6TdMeSF73GMt2J2/bdUs0j8erOi3+XxCvtCgTS2n0jrt2HvIZEqWkWF1gopNouUrnyw2MFwC7c58LoNss7p+MWPUwktKQ2SW0SCS2R0JLaJLVJJLREQntTCc3SspWVgqDFvudm7774P0lMm3fsHF6qWEhq0V4Ynb9eYKWbeMOe0NE6biIR6xKGkdTmatcmEeuudv+8X9SW1Obq1iYR697N+vx+Yp0SwcsmyQse69ki0c4t2rzjOvUau7K3v8Zd2TszD+2FcW0moH9gLVDAORsOWH0hK7Yt/bl74gbltt/qUDo3z+wwhUC3O+U7yX0wwUWJo7Vyg084k+c3n/EzSl69STF0WdB6L2p/ZATqLAm5k9kMS81vUpCU+XRUvkWLgE4NdQqWLIiU6bMvmihAy+HnY8M2BPE3q4iVU3/whjPe1l87OztnGYq+9bspem7ul/YhvPHCEy8ymjQ31sQoddoP7UP0F69xHBumDpTunR/bhwtI55z6Ne6w9+scHbMrqKzTuSZMw6ZWp7bhpnImYMjFq6n2kaK/rtiRsH9oBjGCIUq9lk5/bGNqO2RqKbCTEOd85plF34+G1jnU5PFg/pB7kDsr5TxjbJQ7d3fsx3Hqe+3PFTqTXsZi03lMdPCYu3Ju6q/Y6iS0IPkO9Zr0J/XIXftwhNeogZUvjrqZL6gLnbOlqYxz9uBBgQcYPxt1TqNoC335U3s+TIa9nmdgPkP5Tb+llpi79XaY1tzsOtIZEofybz7gx4YXCylwobnZma+J/c3Nvfjn/0hb1Tino0hlYR45YFWQ8MSvnCcajnfnlu4DomvhDvlDu6BNuRjwAujkYJDpcrMOTkEDeu5tD+jb/4kGVdNgA2cdr1EJ+q3cgo7bKMOvfIRCAI/3cDavodeGnni9ZpU9qL/p6OcWnDDLURaZTIgvtKSUfzndbtP/lf37cBnx7Z5fyBZEMcYICSG2SMn4l5aldgyBCLjudNVI7urNM2Zk50XgSJg80u6XqAFPjroKrVatp0p+o6LKbq1mcW2ccYzyH9v3+z9P8dCf+fz3yvm1OkiKh+y5m24+EriMpXbb7akHuupqp92s+4Gn3AaVvNmseW6DURwoRER14rVVo1svwRpS4DGCXr3UrKlu40mjedoQlIJlW9iHRiQo0IRA4n4zP5W5WaCfO/JDUU6FZ19aDdB0TreQ6a0xlO+ntjj/F8f/XGviBmi5n+EJtYwIIgvZLEVKIdJ/FfsIvv9/+UcaEkSwN+hf4LU7quQd+Q0N3sEAFW0XGB+VJv1rAJPiFOgagktBH3pnZa/FbSOwFG5NoCi6jdDpuQQoEpAUQKIo17oVz9ifMlCH79b8L6jZau4XPcbpqHud42YFxqhdatp6t4NNf0GqaDbaXtlAktCwptmcETwMQAWeBv6RwRgJoSboLSq4wZkAiEcIKaGhPBhUwu8cSz8d2cxgVTafXaDuUIsqs6gwKSws5BQNaAUEB0A55NVhbmxk6PljmgsAEUQSHvAWpG0DVIraqUYlrAU1+qPrGd1Q1SSfTcNIJwvRrDwps430Oc04j/OHjwsTj5X07gDiAxHAAo1QHxwmHbHlV6bE7OhvawIIQuwR7ldin0ByYZAU4IK0AN9xBDCUTjhMVNCsx1vrI0qKdX36DabGObuvvMIsefz312MiGn0+jb67UzfsTM6gbzDmBvM5L5/KMNCGwdL4G1twMtQNavr5Reon6o6hBWqlIhfqe3Y+fW8Sa/XzZ8QFOSZsnpHJFISrsj0+TOvysbExI9vnnGk1TjGWbj+MrxlLPppwZsBhWVLkZftU5q5eoVsgltj9+ewzi+a/OrXzi8ff1mPtoFUBjcrlU68dYHy4MkxwAQUXg2YXQ7JyUmyc1Io0ABuBL29UaYgVa0230hdb84/w2zp26bdDzKl8TATmNnhYYWS3PXrSJeovUU8CI4eSL7ntot844SFPwbYX+F+AZeEGsT4xZVWq0QfFchPUSzyEvmp2Os16kV4ywaNuhwpl7uq0LqAxru9aboVRe0rNM8qAUgUaDoVP226LmH6j2JXmKFMJO6pMAxCgOMis3G62DFEW3Wq96DWYA8SjOn49iqgSoZKY69FANlEd4kjFcgvEfeLVIPSrik/cgVhRrwgJXVXa7lHxmIZnTYeBE+RVJBy9QRwwkOCRFAIhfq3ZKgbHLvHEeFi3F2Ja+n0K0fueG3jUOLjA0t6rHHlU5CaNMOKkxSPKL96tiAtaxIeP+2NBAm2PHvQuxgvlSPjCw54XNJp90WdeWTirVNY78zuXJY1onTKCg48upFt1K6gnLqhn1W8HHaK1ClCM5AZHCBjOiT7nGJo0yt1AfomIgicUxNvNtqfplZunTnNRPKcjDwmThFereZWi5lOBOmo2j6hSXBGS7fruAwwRneaxS5l1A7/MoSCMO2n6JCUee/7RcYfPBqpjHyBNR+oYsEjyW4wNJomQfpdwEMVTzx/TjNOu+Y0nxRAJRPmgOvzo7/w6lb0YdHqIljnSjA+qosdVPukLx0sQj9bp0S1Ps9Re8TbzqbWoxp93g45f7aknNGmjZtROpabbrhSlJ8z6EcdCULWa32rhNb4NzGGRmlftMDPggGYFHNaMgMOGDdS8xlHnWFE7eEUSnSQON2ilmtsCuZNAwFGGQnBD6XPHD44QjiQxv6s7se6e+fVuXdUp+tSvUFYUMjE6olkhtlZvdmlA8y9N/fq4C/20WS3ASULW4IJougUnBkeOZd+sVoELxshhIXujVsFngZI69WId3mryn3zcktMxbWoFam1K9AiSSzRO2qA9bloJ6baVG924cmNat93ssPjDF8SqdrfU0wQVuFgSaaoMXCKSkBXSba8YnhCKV1D4aVGPA30n7Sh8i4oXaIg0Gn4yNvpvNS2GkUz0fXcX3ojRenBM3BRUXOTBIfed0yYVogGmy48MpfDNGRqZQz0JfeHxT1GQ4YIa2DNNCSZAlFPr+ER2KLlJiJriiQdYsu4R1bRbavlnRCM8nchcy0FpWA5yrhxCfxNb1zccfUwrAvktaoqRGz1x8E3D9WumnaMIaWqe5jo0u4AYcNWkgKAmBAQNGXD/1VwhOept5jseoNS4y3hC0mxFcOxOtBSirzIVmJtOl8hGhfKAlEhav3iMZo6Ri472y1G4b/jrOOnEC591/A6L37gJJJEztwIuhYU8hbnlz7Rwo6+uML8zcy3zTKfOqj5Nqmd6ZaHOdDOdGQZxZvjCme4RugZ8NWXlHj1j8jn7otmsq16sLD0pS0+XpddXlp656rL0uCw9U5aeLkvPlKVnytLTZemZMjD59LgM/Humw1we/QPeIwL4/6vxHSGZMQQOjeYONSJfZOw2WHIR8YWHg4YObKPHj9p+ReWPTwokoNG81UFCdAlatAqQ0ce/OlUO111gLbZoHsAkS6RFo4R5Z70ubFlSZj7LMigxUVYX02xd0/wEA7/KIxYnB3nc8I/OB8TfVicozInvnfK6RGjEgtkOlOsvCn+ihestLFAZUzLqK+4q3SWAIDwluZhkAfqlKoj4rB/GVsDHUEpAUNXTnCA4lrosn7rlY481Fkr3cPkY3Lsi8muR+4joARJE2W+XazQX6NV0DTMZzaQC/mhm1DJ66xQSJtF8lRauAISkmS2IkCHLzXbDa0/r6wxdu8g5+pJE3hh8ZBUDHqc46c/tkdAbYNRXwgBLxrgLmjXisl6NFuZ9QJNY0uPC63RIiQCfpNkpMNJdBD6JtX6bSDFc7Bskznqx3STSIXFKHbMcUtGQlOhCVgNg7R+QHFJvqSdYa9bceqnisshAP0FQ5I6hctd1WvUm0YCSuT6E7mywREJkFWArAvN6C7wr6KAqkPigGECw1zmm9592PWpQkeiJB1Wo6G2v0QJ6ZctzOwbAkqdWpQsQTjfU4TSdlGkpwYig4GQ8k8h04paoasxf+ZbVJXrCJQaNnzZFyHSMXzMndUskiXVwOjfoViEUdI49sHywSGrfehQqao7DEcQdPFZndH3i7kbSFNbeVmgIEWONXqMCnFS56Kla35ip19wzdcRgNX8hoyv/oFpwQSX5/U6h3fXk4Z5AbNLPVL7ULGjzuqxTUVNGwWXpq1b+VYCOqTTaptW/rP88h2X9Dpb118PF/IQzAUhMqKlxnc/PLywWcmoxz5f8DXX4vKAiTZYoLprtmHLiu/YhtMfKeUYMg9hM+hrr4MxmPZRtdDupnNOUJRq2b9vzapGytN/abtbdW29Z+X339rgtKh78UEWUtizgkiKCNyvw7nhM9afuQ/MyWZhQIxo/lGNHnArVdcTOi1pV6w+h6Bl3Ji2jUkRNuhpU9Yz3S7hnRU1jutmivjI33MGtqINZPR1T7PDLl5KClaclfeF8Kn3rGWjiIztWWirZAvRLP4H2H9o86PHjZRyxx+fDCCVbQ30vzN69+eKjVylAGSf5S2lBGUL5gi70d+tAGXX5belBtRr6JTrQS/Wex3G9Z+4rVHx+186PW4xIm743WeBtckcxgaTyCxkinZQDvf+jcEfa6n/GZJ8junfa/GQ6n1KFyRR+44/o1emBROtMAXc+tDmK8ihGeSykruWvLRQmFjQjM8k405MpK9UfE3t3If6EVfrBBLR/nNPcXxADUtSUkFdmEObRTu9g+xAX+i1MSNBylJ3GeizD8jl9fvdv7PFr2Jy6RiwgW0hls0TC4XbMnambC2HxAYB8zYqlL4Ew7Rw9u2YSQeHuTE2NDX6dJwZSKKScAt4QEqL3pj+0D4sqiypkB74oUi6sV049lpyz2o7JSlnZvkRm/tzOchI3BpKIlSles0/6XrOkT65NpsJ5xjQ5OkfhwSVdofvhM/swPzQ8Mnr9xti4NZFKO5lJx87eo9kkd5+YMhX5sPj4XD17Xkip130RVdm3D8fHX/MDy5lhRhcrdz9Jjdp1dMqtjP0mRShDrT1Q7YGk36SE4Pz6O9nCpRLdLvM82JfDG6R5fjP97GLXDGJVj0fjkKkImxYp6ueFa9yFPCrYtuK/6GMKmDXA3Z0K74NnMkqze6eSkSkIwxQXTAF55zRD05/s/6UWLaal9LW3kA5vZMSrmLt2PpN+5uxZto9RIBtx37cPidD76n2fRsVA04gzF96e5pB05wWOhK28O1Ozq0SDuWw2q16/S6YnqE37SvGby0rxmslNTlws3YQu3Z1qf29N0GQxPLKC3Wnevq7QeEODqrx/clYp1+pUbUcsGy99BD4AikCbxsv/LftwcXGRskxF+VHEtQstx+0m3G/ux/QuGzdNMtlTSCj+BxxvYiXupxT3+LHEPX7McbpPiTdmhTdeo5AwM6Wvo3acpd2FSxuTBicR4/W/RKZKZ6oGn36X7Sxy6vFjTMuU1znvZpHUl8k69tjw/LiTP2cRVef8eHIi91jxrynTeDwJbfCgd85nrEkSOfecGbHvpM5OZ+8N5aibKW3LKZBsOmoJK70zPfUdmsbyyikUUelZmyeNvEwbxVclYIeTwfQ0jYQiCjiqHueKOU6pJNKlHoVsk1OczKbMsKSOoxeVnmwQLOqw9cpM/SjXmWy/QAELomv0joz4TE59pDDXqGJRyIzv9BRy3XaWH8PM5/HYcHoye2+EFiUkI88vyh5jgeQaErdH7cHtw2nLyOTYQpzGS/uyE2nDfEbsbPA+WrFB7xVowivovX9bvnTyBRJe7NCOYlSxmW968t4zqyCn42U1tgCBzRIxrOxCrwAQIS3Mish65nfCJTxJpHo5LEtfIyy2e0ZMu09p7fVoRV3nCFgfOJXzW88y9Dujf+NPZp5lY7/8JHXZN/uXv7toY2VWeWkjv6L9wW9+acsioiT8g9cWCksKTvwG09ckseWbz2il9BipLAykQq8t2F+mCLvoWzOwsuGSQJQflhjpwBCpE5onXWtWmYCZ5/PEkhJnXrTsY9bzK1tizUsTbDYaukP4ER5Pxp/D8iNNop2+DacRosT0vUKqn7P82HbGm7yAcWsOfQhVV8dvgAkSt3Um4m63/tLOnz8jqqPVAeVABCnW5tdyq80ym4QyM4aYxmJwx9JeyUwJ1IjFi229aiU+1NCv8LrDQtH0YM1EiTOr4nUJf+7s8WRMX9HkOsHfpL9H8t3o/RvXC2aln16zD6/lnAn6Kn/tw8LEntfBJl7ANxzNBZEskD6iLJoa/HpauzMjfnHnQX8qn+o2f8Nk5h72J7PvBZ1rKzQ83yydmamBSn3i9U6b7cobpjL98zCVyZRc7fQTSYpWKH3N/rIGjya16bu/IULJ9xEAjii8BRJYNmW5NDXMQK8mCirbhzZPVCIXvCwx4rwZ55QXPfhqZubBy9Q+hsa0wkYftTgPw1pzI5nPLg/0uhs8ecOuugmBQUqpTKFHjCe9H0ULy7gk9B/2G2dyUSfsyKRTyZwzETf4/AoeR+dLxIJ04JenrKxdyr3EzLaUa4+PTFhygAbHZ2QqpUcyhW7Sp2NGA3YmtnPhgRnVlS4KI4oT1vl0evaZ80xNRjoypzOmjerm7RESG6LjPZLhJeWC0Tx9EC1G7szc/jMbIn16iQhsYTzNVpo0acJDIswaHcVrcO4pHYrMIc8xW8v0fWfmzl/ZY+zPUcuVv6JxNUoRWdFepQbWSz+FAqzaMMb3sTF5VxvGeo1u3ZjCQYnVEc1Pt0EvWdF3MbP1KWNS24YWibU1RrvGNlskhWE+CD1Epqt9H8h+TreFfSmqepYPd/d9bAzBZLFx4Ske0DDL9eVxZ2b2xd8Yfd0esnBLUMpRrVhz12uUFR/pViWvDMs07GLJtg2r72J7KVxKKPJ6DaPAoyaSSVqEIlVtsOJO9itqiu0YOqrWbLZU3S23m/QLEanOmrkT1svxfn8bGx3Qv6lWt0TyVDWUqbhRwBjLoV0imsh0iVHI4adZld7Blq1b5Z1b/wto9qHRjwwW20azH9PU39d7gKy7PHbbqkp3N2fU7C0i+K4PtjenpmcVR6npmTneG7dQJElgJG6wF5Io9+E8rdZgBkzLV7b0GyKO04ZQ0OlBfGD9crHAv5DTObmlSJgf6GCQxsSlT8SadR45Uaf/I6kR7yXQIIZKmW6LuejWmlBTTR778gAhxJXyU9Mmahoxeg1Y4TinAhIj2SYXi8DQX/MKMR00P4KwRi1WpSbL+92BRuQGzFlskQjJP7PI64UFzEvTaahRsyrPSs574xYxBlSLrRYd+/rQIbY4FmQf40b+hqhb8wrX+XnsdSwu4jd/P4fvfsVr/LJLkz0qU3E7rpVjYxM2m/xT+x5bF4duYF/28j1j56hnlXuinNDro5m7/yvJUZih6DPZGoJVIXtHF+0zD3WPRxHs1/ySWLiBTdAj2K+cKX6Th3cqUp8HVo53cS0l39NDovSnXQTkMxh/tDt822nqvSwtRYMXDw8rTAR9ZyfHcO6Cz1/IkUi6u4dTiilUKzoGEzytpWemnUgwr/gBlaxB1aPseAtTWz4363W/w7ue9FaX8s/BMMfDbiAsXspPYDfhc8lghVoLxaYKJU5DoiztUPUqVo5ylUYg6Zy6lUjqXmhlSsML/am/oBGl0EnqaZdyb3cb1j3FTix4AhVdR/rOzam/z8IA9U7QLVE5JXX6hVGoajTpQ+ywB16zUetZQsFv1njcdigcTlJwHvck97Apj9rN5kkvfXPqdjGqsUS+3cpO/8tff2VrXTc9c+vWekQ4r1cWFaY4QCVO1GaU9tttsJmPmEXAvotItlvrMGP4qX0YxSCxvRSi79y8OaZlXKrYQs6Kv0SDiIQNneytF7m/9QFYubvHe9huuewFwQrNqDQkFIxJvCNtS9Gt+E02Ne50GzQJuz0v8N3GltdZgYDhV2FnVfKbm15lnW1KMFXtYmtLrzgD2AJXMAn7nZ4qV+qqXOsGxH3YUqLZqPiySN3lrfsHmPoCbTfRbUsZys1Wt+aKjQQVjNttFYOdatfju522h3alOvDtXtn3aAm+49eaHYnoeDA+Lvuwd9hve2B0lW6r5pclh4rntTY8ty2hLY9yrnFwFyY2wYzyynXY3FIVdr1AkQizIpWAGUWNOOEm+9iukvRC4gRdg84n9GW1XG9BoCHOsfeUHre9p/tuSR3RgtN8f+TW1VHNw2/bbR3veXV/r6vLcuxXKl5j020/aZ5IBmx1+pCNDKjooRVPjW0+3doOxYHO5eVaxd1vtkg+AUHvUcu59UDVS2VVZyOhem2fuioQ9+A73VLND47RJw2vQ2T9hK5oBepo1ahXsTm5g2OhHk0q5WVQAaK0LWez1dnSX0HnUPe/kGZtuQ0qR4tKRcWGbQ2km9Yx+rBFOT99UlJPa36dxoArPdv25GhZRcFKWJuntD2/QcJbmc9/Scu0myVqPlS3TaS26bO9K1tESqBROfXLsGksu0FNwVapfEzUvkRt1COJDdNWgOIgRY4MfJg90sRFZEMBzpg+2MEsiHdPsKnbI9mgLmozhGBHF9TddmcV45ik2vaTtXrJoz6r7GhiDJiBbG4ggO1g1DFoQWJ0Sz4GxGaz4dMI5FKfIJ1VT452srXmSV2mXbafouI88DFtB+pBW4raU7rqO8hGYdjRW6tiHK/2yjS0LSU0cEBtb7HxFZc2Zm8SrFPr0mWX2r5RRg/RFL5PL+5RnambT9z2Lg2WMk2Ok7JkkaMaP2L+wWsTMCXDDT+yxyFkWpAbnUmwnBokTDZWSMXeW+7jVJi+tbUT5ugGTbQwxG3A+hbmaDRWiYitPiY2+1PmjTCjcTskn3cssSKgsv2cxdRTWGRULFYY5uy0HORKfzT4FT74IbRto4WBV//zwTISu2BjyvKxV37SapJMc01M7r2iWzt1e8R+6jxP0BKmSk3JL1ebzU6jScLVdWMkUPNL/OQ6jTmsQkgCqfsB3Oor0dkF4qSfpRQ29ryO2YhSRaIqeOK3VNALvPIxdRysLKnQA5PSb6JJicbAG0xKPB+xcHnphHQ3ljBD66SiLQeR09QbTNgi00lvztnX6Y3lXx9s76+prd0wYK57+7tKwhSKU9yLPI4P645SC7yqQVJLy9u7+2r5kVrZ3FMr2zuP1Or63s7GEl231drG3ppa21pVa58ubaiHG9vLuGzTv/1ttf5ArW+t4G/jYHWNrqtrv6HfnYN99cn+7vqm2ljberj/MV321cb6Hv1sr9DneP5reeHXeytLW/R7sMzF3nu09+CAUvz1wc7KEmW8u7Z/sLuldg+2FL+o39s72Fnb/bXae7S5uraBy9pvkDoFUECOkZwoPbrwFeV/wIHfrK0okxFdH67hy71dlGr/47UtRRXb39tWB1vSigdb++sbShfos4/XN+iXarr92QAl/bV9I1xAit3O9f+fvbd5biRJ8sXm7Vvtzrydt7Mzs/OxPftRRbKaBL9QZH02q1gskARZmAY/BgCruhoA2fhIkjkEMtHIBD+6sspMh3eTzGQ6yN7hnfe0ZvoTZDJddJJOOumgu8ykmw56MmuT/9w9IiMBVk+vpKeDNFZFpLtnZmRkZISHu4e7R312Cvbx9X86/vBscRqazKHzAaT1v++HbMwtc3Rx/fhes8Exb9QbHt7/i/w9VszxxE/yx4Lw8KcuyyIdLlv5V3QZjTcVihieuGj1l/l7J9RXxfspNYr+LH/Mvq5OV/oHUk6ZRvLSUuOqEeXnl2c+baKXoqQHeer8OkJz9aXZqSTfaDx/Mb+wvjaXw+VQsdaf2cHy+NvGn/4glTOFWWLIbPxR9Pqj6PVH0euPotc/X/RSEYj5y6O/TRcSnrFZeh6n55/x0vav8/c22LA3zvhmxATniECN9voGSQezMyywoegnjyYvYgliVhN6LtRnlrG8kjO8Fnc9/Sz/z5j96+3rppW1Xvxz7oS4GG8kJLuZ2+//c25nb9uUL4+p5Bx8nerl2dnw29/8yx+MS4UcxJu0TGdm51POMtBG529JPK4E2rBFitlN0r7RmAOSFTt0Act5HY4tYds9LBHeJQ2BTi/kUILeqM/GLPoWXnfjlqACqTyJwE7EgJcx6ulyHgH0vuwxzv6vPTb3Jd1RzzrAQtilR8HdnYY/Wz/i4U2NQ3q8yxaMYKMWm9IydjX1Q+DBABGXSHgjNFIcDzH4T1nmPQ061oMWL0o0OmciDcI45IDOAUzfN3Ti3Gt1uX0AsPh7TneE1JB98b9lufiCZg0Erkjcin4xjWKx4Y2tS5K/vTN6RT1hQhhFJAfDlnk6YmfdIXH5vt9lWT9KTjYQpXCi0YVh2AYrvuomIU2cRnIPiSnH596QwzjomehgI7wd2hvv2sIbDTA/ahwD1cuGL9CkhkNApQxltWPo4TM76w6w3yqf5CNWJTh4gT8VL0pID4uwUDTqE59EBIthZ/RRqbv2SSygrgEHYuoK1AvElViVCfgUE/Mx7sRYmrhuXfsRvWOU3KymoIF0lCwuCdfwvk6o3c5iWWhJSKsL0F5iOUsdDx7m1afDOJpfJ9+RIUBuhmcSOzw16N9GcvfuRvKP/4gYghfrHELwHIf60kIjv44cAh/+CSb5PNTV+sy9l8vwT8Za4LPFBi8gP0it6w3SAfPzzVv83vgCdTG7gQRMp1+K90ZSX1jnvMi/YbVSi6q/JOryAqcKePLw0V/nlUs3Zizx8c/z8IeMJPNYJN4dP8nPreWUjOXmT/KNGVnFTqYb7wzceJ9HWog6LznQO67fba5bF27r/y4xE7IKNG8qMCe+vFT8nfm15flEseX5nFbrSeI0CFbfF+vHi+K1mRiIFyJSOi+zLN7SYgvfuwDTsnN55GWLXq7NTN+bv0vCdXPhpcR0uKQ8lkbWODcKXT49cw8kdxH1ycPP2O+UbuFkaOmOdI4duN2Kzhcfrfw8L9flF8WZh8ShxW+fkUbJn/MPV2aOffN+sNS4XtkBdWPq+Yu1ZwnU7KSe/7DcHD/5Emfncxv8VNlFT57Eq9d3fjQ79XyGPuqdH2n+m+lcMr08P5OTkBZUoJmwjwVRZng+46xwz3PZxe3GDDIF5egj6HWI/DAu3TRDNhpfzUjqK00t15iRCBrNWGmSWs4mz58vISPkHFJF0nyHkJrGCilImhlKnB0aqznt2Y/u/01+mUricaR5K5dncuw5upm/PaWmG7sza4N3Rk6yzIfvNY4HufvKiTjXic2G30r61Ve5GQybP8tznM+n9A3LuoSAyd29DunB2KHj0eqf5Y/LdHVJPCzKzVz5o7fM3/5QGcHPxK/60YNP8nP1udwzuPfVN7e2d0q/rb7+Ugb038Bf5WrmRXPNPYUzv4BjFs1KvDTPrEWcxDQv2vJSk4TAOUm4bk//O/c0xr1dQqcZRLx2kvYQQWAa8zLitD28Pi4L42kKLRNlQtJQLNFjA2gmHQhBHLFsVrtvAporBGJ5XCJ/ST5gbyCpCyo3O1Y5tOdzvP0SfKtVKO0hN5Q0KbIbuR5wc+799ctBEwu7zgNuvxAyKwe1xYhoy9bo36qHplCWML/sF/aT0v5Oab9Ue5uYCCj0OBsBBcRGQPGZNALKUjbUt3nOCYK6NQSqe9qL4uaGUy9fXJPX1G/DLsH/1Kw8J/VGnT3z2E9vLrf4jBedf0hzwzJGxM/zWRkXtEf5aR4832DmoLNLyVx9AX6N8x+ev1h/eS/5dOMuPMaJiUzrl6Cp9S/za+YusajMgQ2w536jzk4u0sMfUU2c62i4JexWKr4wC4w9efT472V659gmv5fxI2nzDEZtMlySRvzSbfAvmzr5L0mz8VL5LdmD0tOreUz8NP2trScf6h/WmxJciJxbDRIKWDao3z1GTNOnyeLLJns91JefrW1AGIBQ0MyL79U70qGUszXg9HXD00zj3eB80Hif0Ok8Q3BGfPJ45ZO8zRNpJxY6v/jwwYO79i5bnrk5z3zyKaavdwi1+up9c8zd6y/TcvGYv8k7+f9MvieUAVe4Gdku9u/yaXqoKeuazNGCTx7f/0RzlGVSj0lfuQMX9XdIBpjJ7HSXO0XPvD+3Jr32TaaeP8nL3NLNSSV+kp+26DS7TxBXQ7QZrGPz6zl70j6hJ0F/9fQUZ2LlE/N0AmFXuZcbtmrJmD/LnIygX0/6uchSgFF2mScEIXJ8YF0B3CG58SLpijD/az9YXlyjT7L0giuvQXAkZK2vs9/G3ecv0Ms+/VTET+55jbYfycox8Vxj3ev6lxx8TapBNycKMzQZftpqGqQIQTneYFG5h2OPt+slafnrjYwAt5dvzBnHvDnjmJfL8TYX4rf3nafZO09/OcpyekN98ExYl3SUb7/54Q+sl+RaM8dePWAurPjPs+d7W+cZeDexqht0qW1DeG2xbzq0UD7ZdcMpv2ZSGlV5GqRRlEixIymbxmMpETvNv0P110LKiiBkOgdImhhJfpBxeqeZibRuySDCf6TqjDhSW/y0+ACC6Dwmd5zrgoXgSf6RpJJtjRk6QYjQLEJtP56RcSzw910a+TunHgZ/bENuQ5NrU6WteXhNCvrH7vbH7vYfoLsli3/sXn/sXv8huZl1sK3PLzbZC1wS9GZIf2w1p9U4OII95R+v1tMADRqfbOQ3beC8sL7peHW4HiYDtEiC+gyWD2ezZVMpt1/3f+T///lh1KPHNpDySEjhq/kPNvYuq3990BQgNjHMgpYEofv+ldySjJ1kQwSsbEt5aLekHqyRfrZGIvaLDWgKdRGx63che+ePp5OXH1RdM7bb5bXFZyCVTZgCFs9h9WC7RmrR6PntYWt4w8k1tGlGcLIxScLFlDIjppT/Sj98t4vFT8kW0r6JvWS0QSXOqYv46kN4iT+8nzx8mjx6DHfxJ6vJ0/vJ06fJZ4+TlfsPk5WV1WRl9T774q88INpDoj0i2mOiPSbaE6I9Jdpnq8nq/fv09zRZRclU9CqVvUqFr1Lpq48eY/lT0n2gIlgQqq8sfUb64spqs9FNHtTvL602xS5Oovt/ZoIpTqjHhsENknSZJCj9du/GZkORGIpWr8f+pxJPqt8kYyVyklVp+6YJqWRdyfR/dq/mmAtNN+Xmjc7kknITRnU9rIVrwhSGzIdjiK1TkQwL/ZD9liTY6nt9pDkkTUmcIPCBB60bXuAYDFtn/VZqzRIb1gCjAUu3/tCExUbwAudsuTBMdD0zeMKe3+UFZ2oDTlFoojv8DoJBbOYVH5kAh+GV9CleLoErvIwv+Sb38nPamxvHORO5Kj9tBMPI0uV2nuN7YbpYX+PkSEljobGQIFkB/YOy+Zyt+5yhhdMjHxPpxV02eNQ/cCjBP+SxVYgYJMWmK/Cs6P8Pk0wUwZzdzYTTO7Op1sbtzXHmFV7yyNAR51wMuhJNzkXN0PxGlHSflJTO9nyzaPrEfTgndGdb79T0OiQNGNkFtHo7u888fvg5zB6aU/3p+yUDPvxD4Mrq+8Z7l9U8fbD6SxkcOwU4ftUqR0UTCz1H9ZENEzhiyyPCu4VGfkNz2nO+ZV6opV5vjiZ/NoFYUOuhp9nQpsSQJBprGSvry00nAvLp08+Wnae83OANVxobG+PXWwvn/2Aup7aqpksojUY9GMbNxKmkDOcocsfqd9UaA5hK8k+xNNuScIh+dIahCw7f6pzTCR9RR3RHjJXLXlvHJI1RZF6li9NXh50vfZ9k2E6igR0y5pnXfpfNO3VjB7lhPmUSlirzxUtIyqXzuN+TaTNOfk8cAQvIyFTIGeOy6flHQ1++69/DZrXARitq5PcLY/a1H+fF0MRJp34s1p9lHkh5LLkdN940umbrn40NmfWuFpI0kY6sZzx5/PiXsFE5n0WsuIuPbrFX1r1i0014niDnljEhG8vQxlqajmld8qXVMeSXmrcv7f1MjMJ4gWRZwpGm8l/pDh2NuUzKeNgDG7mv2NI5cYLtP//Tn/4gFYBkJaHTIcZO02In7MVhTJJQwtksT0McDQW+D994p+JCRtNPn7qkZyCaiCQxqaA3XS/2NEH6YADhSQ4duEQpGF0q1AvDi9FAkYEPkQx+RzythR0f3Ql+cjH7yannEragSNqjzgV1Uzl0fU7qSLxePeBoTjtljx74VfCKOjxwRsMhu/bIzHdmYJ4kOiGd5O6LaZM9t5IuPSgaeDwzdkeD1N+iRxMrzU2nCQlc1+wvIVMj+9EJiNUU3t+EW5lbTn1ttBXlwMv3N+xEgRRlDHC/P6UJFLIbUmz3uh4v8SO5No3YxBSEqfesNcJSvLhcRQSARj/6+gRKTeBZkZz7Z+c9yZEN/wp6MNK2Iqm0ZAXlX3wcBvTb+AOIrfw9kW09ueh7rSBKLi7pP2c7hE/F78O2SLeoJwMk22oB/daFp8IGZBag/Us+SPBKxKO9b75U34tbLLoAEAczAqV59Qp5Jc4ETNXgo7nwkoZGG64k/UvveiCjiZ7GWZ6pPcTfHK8okFZREM6jqKmtk4F/yS4cXtfvxJLvGdUkQQUSxhl9d+ov9OnRiQjiJbSheIRzRvaOpIe2+Sk13TQ6zDDmNLCJOH1fel2tvPin4TBqJ4bGh/haQlL5A0Q0VKguvOQC6SbWHhX5MgYinyuJlJpoJmTt7XvmFCe2hIAGv7nzRC+Jh/SFcYAnI5PUnaR1BpAelZYBiPcDQFG8OKjbIbhJLjG08RXiyHw0HRHo0y3ujICQYDVAVC28L20Urf81/UgF1DllZSW57vfoW9PvKPCiTos4xTW/wfVNxN50qprkMhkC2zcmt+S1MFTHO+WXees9FyEhHG/Jsbj4TBKfrCySkJHPAg/fiy1zTcnYQEJs/irq/WJ8VmAW/htdokh04VKWLqW6f50nCVIEPdkYoykT1lwOWfYkx960E5bhhFeoy0dOTjsr7LrA7maY5BQFJP7Y1ccnjz+TZJRzcKnLbUz41DmLjWneRdYtDkx+3VroyiQcYG2lElIdEL2gyWu8zk51j4+v99iH7A3UU1YfwmFRWRqOex7P9hmscObJxgIpqQavXmF/8CUjrQOCycC6Ku+wN2wGLVNv3OevFFnlgRPD7mPE0mAg5hvBlzmTepEVAE3AmE27SN/u2zsf0tkUEylcO+kYRu4GIWFQ2jaEz70bF2S3bpeAukzgsqORELmyArLPcGT3ICl0u/BOM2h3DKfSMJ8/2C7ub0kQLddPKEUw11dswRgaWpmT9BJSsJdukuwIGdOFt1rDs3CCsCuOfg45pWy1+tVz4v0Mj3gomrpaAl1Dg7TAu6BYYpHEAPCEA06gGY2dofl87PpD8ekjAs6HQ7mP8bH33YELtAV2vUA4RKW2DeJueHbGEgmBcFosdaQ5UMDZKCjBRwIo8bQzuGwTbGg42haySNoWIB1CGFa4FrptLJQjmp8xy1rCa8wqhJX9S6/KPJWQvdZZ6xtfsmkbuNDvh/bphng7Ia2SIU9STEUNnnluDbIVV2sP+cT1aNphz2d3xvF23zucoCBV9Djx4CrwqAh5uUPOHs0O2FyBw6EPCeqN1xqE9luwz33H5P0ZL6/S4p1BAHniVMklcZkWqMIYAASiS3fiCVXmEij9CGmxiQKepOwLWFjBFB1EWzL9hUodfj3iYp2v+to79zs9T0D5tG9aN+yRyjA/N4XsB3TQ9GMJcRw3tRbMfEjB7Jfrk2jRYl7Lv1FS2C3XwkK1nLSIr3ULcY0ehSt96rPUYv5wm/d9uKHxdunxYLEkxUgMoq5BTDSGXzEIJHlwyxZK1R0/8KNzGjY9KLiXHrK9MzdCMAhrF71eQW5hWGNoBJYhrnBclj1OCNmGZKFH6oEM+tiU54ZP8wBmaK81QPiH3rYn/RkA91TLY5CA/sE2oj4E3hp6V6WgRCOrjdlAaFKZcnjmd0pnAXUecCK9ebvFkSQGThFMSgcsi7BbsdB6nsddE8iuF5cCAaviSUzwYc++apXjJJyaVv1YXkI+KYPonSlwVHgN2CbESqhCIf8cBIc3PXQzzrJvsu17m5h5BNwOeYsqhjPXVsUv2ebn10nMoIfnrcg5K1ePE3kjlFRbhDVzCBug4eGYAkuwGkbMwiPqqtQxqXfulhWolY0BFLFTZ0Eh0oHiYiXOWWFJpES3sN+GpWyTYOCgu6MgcFAzUhjVj66Y13WfRthY0V43U7TXzRTtMWePLGYGmkEh7RjEcossXgktTQY7g86d1EQylhJSrQL+WaXfs4RaTkd5HGOnhK6ZJzNoZHGS+gTMXGeoF8VAti5om4msnZEULCbRDYhwU4o0gcHSScZQqjBA7WBbM++8delTNyIo6JwT97+ARSDsjHq8lcbolPc+GwXYk2MTWYVSuAJuY/At2Q2iTdoDadtnLFvxlhGEFBHoYBCwu/aIFPRvvOGJvGCFdN5tv3WW0kuRvvrkqTJR9r0rnHAKIqWRCGABxIt08w8VtgSperHinVbXi5kJQeAuYtPUSOh97WkGpFpbCKF7LWwxYCmxQYIoHnHR9AwVJEGXJDEEbcNcHiKCBYJY8fSUTSgOIu/66mhbqTw4MXsJehAo8BomcwIHLYwZjj1k4ZxIh9IADugZBNXebAUXDroNE4+DXXoOusM7YLn4ZRar8HZNKQlfNMUqXi9L0AFIBGofUxECtRIMSQUItA9n+DKF7EPRyKG5JH0YIemDUugo8vZf72K3PZKL9TAmHLpEI0m4tNfyJYKOp7MEstjhmyIqRDpOsIOlEjruhfwmQRUBfmX5IGDIgQCjiJkygbWhf3bmDbdvglbf71C5o54t7CjA9yvRF+63W/xo5Usy6kldj6XB+Eh6WNJpbyHIHp+8TQ1hEc/nTFjEHXuGlRDXISnXwToXhdKOJ2uijL72I1+i/pKOf0lASzdE5THN27hAsigYE3RKKgUQDmEJY1Kh12M+tEO6ZdraOJNVeCZJKnLxCVYjIshAjFqtQXeUSbWCLOoWYTUDxrLC+yTJvTMjrjPlQDY2E6TSQtQxg/qJShBgmeAKmOME9xGOGNnpwTMcEvpQAtmI8/XCMwOz5CWIrQX2tBpEKrhwxLCaiPA9XqldUkm+CJYd7lbCAIXfFYaxT1cMb6QbC3HrHH3PTr0KuVfshLyjkMGqewYkYQt2DcVoJLAao6gMEYG1/QSpwgRm4NFAdty59NwnmnEt2BtJ7CvWe81clTZMf8CsUY477L8PBEZnU1eY12owU0ocN0eKeyaqWzgrg698Yr7DzvmN4jIQBIR5WcBDMQf5tgSRzlgfL/tRnKFS84/j6TVD4mZBFA7t67KNoSaBaD3iUiR5dkSAN89nYZ7HxlY8BGVwg2G31fMHvK8hU2phFjeaESocSdy6/BYDr38j4A5N6KTsKcbqBkM1OEowdCTbO2tWMzGK9O1OfymVVZEbJYgdSmAVHQQxXd4gw5uyjykjxREAjBdIKdWRSE+GpAOFsV0aYpkyJSxd4RE1hddlwVhJZWOeF1TUmgxSZr8TpXDHFpBDUhVkvSdbkb3DLZ25s3RX88iQMM1YQmzKrkLeUi1BKM51LKIqKBOMYqxXC2hk3gwGTSxLsW9J9LggFhkUB7iCUR9vyYZeMQnvVY8ulfjyTkxjTa+m6yIlEGhLEMBqoCmB+x/N6cgqKbTI4lrWsFdQI5wgY/YnpvEOZwyN4rDK+/5t81ZgWVrFu+Ld1zPE6sDzhGYnUcDp9AdMRUMLxuYyFfkI3JbVLYAy1zqgXLyDjcQAvKrtlcsqsBFa2t7S4zYfSZ4tkGrH4kuKmsZPCWmllLKNrXoUp28Uhfb6PWxJB05pCFX61l6KYGe6WvgmHPbsMxmphXJOiLyqZyGS5gpB92iQUtJCSSjm0W7BLZdhCd3yC0Lki5P44H7byDk18c3TZ6mcf+ltyU7KSrJ9Asgt3SJDdnpGhp52DpZkze6zmSe53YZFW9l0LnPNZPVJxDXdIRWCDaJNp/CrlSy2mUFXs1j25IMslj35MItlTz7KYtmTj7NY9qTs6jlBGXsLoa3eQntwC+3hLbRHt9AeT9KsBdI9dZhBMvW/5XqzJ3Pmk6ajwSCZAWGImX56iI1VSUmSdC+W6o4EwjO3VI23YlfkFqGOw5maWcLEq+DMJJEE0dgfjKFcANT/W8jVc6fruifSap3zhCGAvJg9B8DpJJN1AuUN54NgjMUOAlhL4YahmcGZSxiTiQSj0cxNGIoyPREkc0vNuNgwje7LEl6zF0bHHDOLKx13ZSWL8brJBGWLNDFOJKQnQu/UwOMrMZ3JZZhJkjSDkB1unlmrUazinWE7yGFqfNITVbPxoeJGGtwKIYeyewdrEdauaohbolFa1BhNBLWLJ2P4tsdL37dS1Rg4dm6MOvrmm54tdd96USlBpKAUjiyCZUeZgYXwmoeb6D9CsSsEBpdVggyWud619SvtS28Y6heO7PKYIEaMH5E21he1ikHVfkbM+1lhGsV0Iw6VqIMDj5KuGL276k7j1UJZeiXkhh0lul7BWZjsesYGJ3d77dEZ9B0GyiQGd5GaisWTzAKBkArGYVWFckVUgeQUVCBkFgGFJHO5A78594Ii/OCUWOpKZipFraAtqAraLiIiqFDE/KOwXWgSnKVjBeNWPDJ0loYFNEJvBmOhVyi2B3Q9GGAT8bqShTIqzm+dnfDirxHtqUEz5Co7m2RJv9u5lVrNUGHEIXa+w1sFT1BqIWuhLr2KlQ3nauqWh96QnZiQE4qJ3WHrivurYOM2pmLQlTOeSKYOrCdOB5EFqAkUxlP3Q0HY8Wnfu2Ibl1KiWCF0MgXGqss5YhzLJROHrNDJcCr7fd+0TQRUHiOE2O9csFuAYLyUDFgfaBXB4jXVBYV0f1s61INYVeBn5ndGPfRCCxbtq49RYC1JiQcSqyA7x6dQNd1juFAyEAYMsxn2zbBEeMdF2uuFtm1Hq6w+K5kk7lLQRdo3rMspcf/1bvHrkT+QrERCgzxM3Z7NBfZCZMSC81jmSbXSxM1Hhdfqv6BpvuyJyBuW2ImtK7rquJ6lZLY1KMyWCIVV4FfsI+J85uxtpY9LymbLZhnXvmwdZIHVbQtWv+aLxT5JTYApEA0Rst1SP16YtXp1Q3MQqxYBYJqh2rK6IdutuiFNr7zc1g3ZXkWHMVNVN1R+3w3FQIXRWBjC9wVQkTrGAPcTzM4PBniwzWCZc1EpkNIuBLA8k5DDsHdzpnAF35B1HGCk+xuE18kkYdU4G9i2LfixMyym3MI+dLiMn5CUc+a01yJ+4NE8gUZXtllI3ZZxRucPjyeT8a/t8dIIK3LGBsle1UY+piICHXQGMGZsxf1+KlwriVfVDIKUkWO3QNWLW8P4aICxnxKpRfspxXrdGJSmc79jKmTEI8UynMDQBpzyUbBxFqBUYnFlTr1lCBNLBR+ha+Y/OUu8Xq1fBj+DM4vp+pZ66Q/DgHmDUHaoqLORecPdUcCc2FQOqfgOkTSRLX1BelupUqbBMTTX7RE3t+1C01RkpSYhiQSksCxgKRIO5GOZJqu24n3Mcb2DQAVJQ7+E1KUIZJYAgoHi422VEtQCr+S4BcuqxTCc1dVASOA44qRiCMMWpgXFJvmopacmViFlVnIyJOHhShMJE8YDE5AEIyx+MOGiq4ghhgg6tAjElz0wQFSKDgLpsowehlfe0MErg76DiS+NEFQe9NI+YYc0dXM4KXSpV9EcQ6yFZ2NLBlbG/vVw4pbBXRieSRY9eOze2FUgxtJlazgz8o/IlSIhIWcp/lgQc9fbiBYOY5rT9+g7sdOfd4MlTZ2WCcGaIAdHnarv4ClJ2OwOxZB0O0BsTRVo4HlwnaSuZVoU7uPyIXgJi5do4EnOP1ucERCQMecCzsjFTHBZ1iSlQpqo3Fk65cO+18LKrxjgT9mpR6vDK0ugkLB7iokGP9aPiJAots172mud8U8h6zgCkghCgNiYDwCKApjgqXrMnPbgnnLauykFqpo7MLwbTkMEvZzBFtIBmydYF745AWohdckS3Bo10MOY1MUyPUOQRhnYcWvCBJ6JsdAveMaXkCm2kIonTqeMiJmOwTet3oVC/CF5hjY4Eg+CWZ8x6cwuIJuIAD7wZzNQ2sksqSxWbYuL11qUEtKPbyisqgrGKhpAUwyN6nIYXrA/rnSm5HSElL0kXbG+Aq/I0vYWuyOynQMEkrLjSQobPOiFUqlHXIMMyS7gKkHNGQaznq2RIekKTgYrbRt8d+h3DcwLtMZEozT2K7PqpiGC+4xdOC4sWLo1dCjBWjAIp9keXiiQWICRsBlcVsVMx7YhFjnlzCs/FhOJ8nihWsdIc9mtd1svUCAwy7tChtK4/9masMMxAzrnoowMYUvSlA7NBo2Zk8VagXHjC+W4x91C53WeMy/OLrCDQEMb84Y4UmKQgzgaAhQLF+Fb1ssk7ehMtt5ewNgwcHC6h/1UgfOite1ZDqpmChDpDanrQwiAs1vqj8TnuJ95XaxqCi6zwl7rmrXLMzbjWaOKMhqmwopSwNqHtLVxCQTo5Cc+E18TOVBfwxZiQMpb1HpeHB1F5qYMZfOGV3yEHumRz/CsR7gM0HTYCM6at8Wk0lU4xzMRUS6o1cHpKQJOQOIpWHiPzspMHe++oBqxDCDiVPZaAb0Ni6yH+hLsL9F1mSmIvIrLUHXPeCwySszFdpLUI9tF0gZ3fC8Ie0XTxw6HDQCO9WD7iRll6SBLXTUIyXphMAE2HzFdWxQTuUWqCIeyGJtAGZN+qFxDjAsTBNvHzdqsflJFJ3iTSxcCzPecgpoR4kSWsYMA2YLdSbumc6S9f0wSspStc7/XJUU5pVCtUmSvFbMeH6Wkw2F4fZOi+oGdC0yjCCYjWbU8UK9vSKHIsAARyknf75oW4Wz00qczXMChu2/ukCsmi2KWrLMqiL0MVxD3W6MuWYK6o1v8SKYYixz0uCNr16ADJBILpeNb8DcGrJVTKHNRBpFFT8ATjKrCazoK6dMz5hez1icnBi1/aDs3TJa9kWkcaqhwuDkkDVIHO5ZQwsynqp6HsVhR+DmpPxmQSb4wRqpwKCCfYFkIgOo4AsZ2PFjzhVSt5g2xWZ2ZyxVNJb8zXW3CEeGs4ywRirKwNn01zEioOBJKK1rjXR+BkKq4t7NtClTUVs3lUxm9iXDXu8qi1SuZat9gFj0Ay5MOqVVhsiuJgnbIX7KHdi/EmlSbbfQCiqpwplErnGdbfuUaQOCB+8TduoKCP4pgInW3PNNKOUzRq0UaZ1AfBdAINuJw7pBkfh8O2Nh2Jm7PZyMYO89b9MHP0yiayCB2PUZxXdwAFoFtk2JQsskkCHFGLlBzeadgHf7POwzovHDeUdn1vGMNffZCocjSwHnHymsGTE+k4Hl4tdkaKhQwaIKBzmnG2QxJYQKgSlYKqkoPgpSOLn0Ooz5+tuQXvr8MVbHjEIF9qk0YGX7P4fM8zl4dbcPiJ3s5XHrEhc9HfUl2YbazgBaavqzJiMwpOeg/r9zJQWRAP+i0SCbzIRp1RV5CXg94hKImfkCqWN8zR6T4UCNLCllzi9HIJ89EKQ3gLhV1VBq3rWkeEVZrE6iUhX4bo6Xsn6ICxrLIgctqL/UDXoI5OE1tR7JdZUbl9W1YgR9BQtfDHoKKB8zAiVKAASXcHLIGBpx9wejoyNL2BTVij46jOHwFpfsgUCwIOW2LIGq2cyz3Qo/hvSsg86ZAThl5GKBIwQSxmw+OxmbHRi9+nprs0mqJWFOAhiq4x+Z6gUmOvGz5PWYAflQ0lhkCvx7Bgc9CmK4dmIrLoMFNBtWWsAQdgT7HZB7C2Axne1tFkgEjiVDnZxMay3ocwSwksnbMSEaX9cUvR1yYuukynk/8Aju9EFAKJiKyQDTpcHawKY6X1kTNglyNz70bcdABTAPg4JSA9HTa5GWNgEcBIuey9g6E5D+EFzrLkkTN9DEHq5JISZR9H23LjBMHFkL8SPqtfS9BpYtQVwEj8IkjDtJXOTRPQPQDz3oAIQUUZXOz7gQBi1B+JAYzAMTX6Ds92BZJmgiuByChHJ+U9iydudMqVGNExynDAopAc+OneVRyL0wtmSmVp1s6hCPuL7vszAICjQOvi8UOwNQmQeon7keujZN7dUqQ8yWIH1K0Gn/SV8jM3halCa8lHz1jAk2fif4pI1Ptod6gF97IKSaQnMNPt4qFzzMf/8LenspvHOuPn0KkB50AgLigpEa5aBe6XdhP2jCbZTARZyMhyqY1F+1XrciA1C/oM+KIqc9Qax71u4v2m1ZUbZFodeHdyDZUBLCWCRdaYoy87QacKfBTEFiFOZMymQAaKypU91AJ+hV3QDqy+qTHCpvuCBEnmF6bDUJ0EN/EXrsU2Rm51z70JQ2ahczt6WTa4+ACfYQB08ti+yDjbcNQWnCKOIW4FCtBT5xxKpqecR7tUiYLT8m3PiE9nX2MYE5xDsF5dvYmHl4Wci4znlWMiJBLIKf4aFcRSyaHzRtzTktyi9FTwqflwO7c2xJ44FB22aUpcknjl1SwO1PElwn3iD5yViWr7zpZYC4CCd69LNLrjnhHSokJ/u7Tn3veYBNTtnOZyEq8G43x49AkZ1tIKBJHBsVmaz3E1w5BOvX0RtZd3Cg7pmx74xSsmAgUsBmuB18EUaBkAzFdwOehQIRNTg4HyEZTRmMoFT9Oqo5Y1B4n8/IgkTh0T9I24cf4bAGWWcXwH1AyfJNIVK8AHEEkBYG3ZC8kQeC5TZCyi8DwiyDDMALlGHqxjORA2UZanOB60S5zAzpjFSxQ7dAPxphK4HCSYJyVGIKWZghunSyDCTIcJphkMRMk9yG3c5iPnrrlVpck4zUYG/qBM9wDHe+BDvggO+KDtikic7+ehTCCn0I74qNd7QHC3jQAds3GTNbdCohVAjlKUmNkZL89dpgCaJZsAHPMmyTYzCQi4pBkiFAGSb92yDWByZmNPqEimJUBacguQLQxH9KzNqRXEF0kBuK8RufCob85TLCqTX/WbEew2d4vBWt2+yZkJ8KUygf0q37GBNm3soKFCmn0d0qD9T6Djd0O0g6ayFJ0wXoMt59vjG4+wxiZv4ilaUP0M56SWjUbLtB3QwX6mTCBvhMiQLDa9ANV+4kCA5D9togKLkSSYoAkxIAFUKZ6w0JvcN5SeHM4is4VluEnMMxmfWvPFah6jqxD/dSwKyAPgH5q4O23rpHBkpfUSBcfqTbKIF6RjsbjnmF5V0AaGcfItmTAIkBEH4AalpGCUkJR8lwBZG2TIcNgAKeBxIrx8w1in+SwJUVlGDNyTqOeVIMMIm8OArcGAPAIAPbUUaXMRy2KRNo+vDlEneqLOy1zqs0b2SQ5dMOE+yYsyfrAKYUlUAcWx1olsGJtkNc6/XFKNxMi4iJqTJ0kTV5qKarG9kMscseS84IxWbTuh0N4wEOa5h9nqRJoKYCaLJAORYGt25DgymAE0YwBgpjBRIha0UMsSjM+EjoreiLP62HLxBIqvkNjFAgWAl5j7vJ04zv6ES8DSBCWVwWyzr+pQfEGtw5eY3g0ToC4sD1qt517VZTJYPY+NeS61FtgcUcAQcLrAcFA3DNVNsJHQEKROuwEbPoMeM2Bp4bAuzIzTEAd16SukYUhULJL74G5INL0lAenRXVRITVcSLVwGxw8lGUTk65E0NT8Gpr1QShzodaGjjrHhcGm+lnt8mawKcqmxxTfh9HIwUnlDxzUcQYKTS/D6pC8D1Uj2A5H8PLq+cQXwgCZtsQFNgzsCpo5aQlosiK7XI8Ry7wLYxi82tpN7cAY2PZxiNny4e9nCtWFFaudGwpvRuwQJVGA4esphYc8E2Cr2KfvKV0rDNx3H3gmb0dqPwZxu7zFa5EMV7Pn4LCBI88ghYEgb0nrHbW9137XC4mAjBOc0m+Xc7aACbOTiQGs10nItnPOnyq/2AmepGk17jAsthWRh5nAvBSQJqkQXkeEGJJ09LuRbAA98Ok/SRlpcPaA33qAmB1eHbHQJpiUxfbDo5KE7DDplRzeJLBFsXdZL4yN+cnQxMzPfrYys6TgPsm7atSSg3q6MENS+xbceAR0C96lUY/ZB7AxFjEMPmoAU7z4RrHTLS+be133FuFfFnqwndjwXgMYqU+YOlGzUYQDXVmzEYSDgaS+KHR/P6JPaVAVT7Iob69mKBJiaVCTWsPgOqln0fRuNnuWAmSEGFivjYF0ep1SFNMer5g2gCC8ryviNFwcARsDN3tWFhP+liFZkZyoIe/arAn20qBnJUBvVz6DMsLuqBObiZhQbOfKM7gDa69OCSKyEYGTvmadCA3VynuG4EajDTJZwMZQcfoYI6rBc0AyIWRdC1BvR96uwSh2RhdRhjfcSimaSb7AFOeGIU09Q6yY6foxpEEX147iksQilyFBfONkT2fBOL3MO94yUefzIW8tSz9tGjVD3gcehwv+KeHxnAptKL7YnEBnaIOvJCbJ4OwCpilb5GC66pCVfLPF/dAakh0QNXZQmJhlGXHoWfkoTUuYEjNLQClZkhMKXnDvKWgKsYzXvj1VUN+wlJBJv2TJ1p/HpWWi6cbJadjc5DknBs45+ZEqvnKXQy31NjRrLLbnbkm15549/NiJ8cR7zjnHzczSJtLuOefUAVUJVmnMomqgE+JtjTuZCjJDH49BnDhpIhHlxLaJXUhR8Ctz3y39DELaxIqRnDIZIYfpUrFTtpsXcmgTA/BqsKDOGYCZXDNZslGss9TXklbYkEw9LHfOopmGHu8we2PaeZaaJZp8jorektJRzxzeRpxI7Cj0NLej4JPpHIV+WxpGPZNmnlBCNjWjEJ3sjELINq3TpDoXuohYYrGuLtqae26SkmnwTNzl0MN6u2sTNXtWdM3kSHMYOzVKsAZj1VGb3SlS1yYiG78bgN/wQeMLhyJsGaszFKnWMOv2h1TUXEEctO1Ncmo+dtlZ7G0yhOku5kNkRXNSJ4nNe6634tCGPqQRuy6NbzGonTUsRU+b6Q8gtkyno5GVBObYCoCk6tpJHnhZ9ngHKA8+CjgbgoIsCQ3hwBSlmZkEV+dFWU8cjthjXV35o9ap92UYeK8s9CaFYNA0yBcp5JLfcmrvbI4pUNjaCcCaCYH8NrxBQM5FxJhRRgEfjotIIKp+CJBkFxydZfSI77xZ3cYvSb4RL2JENqtpxDJUdB7GChqRV74oW9gElNzIAkIzjTojXdqIsuNxHBe+NEa0DMpuco8Dlk4Oe7y8IIRMfpxI7diuy4a5MOPGERklU9JPWtR2FKGov4Age61rA/nmgv1Ql8sFzSAVEaBc5A27maHRmWhbI0V07CNpe+FIwz8YE8ZlQtFBYSZmAF1DBXq0fZjeCAk1vcnBUv+NDFnkLYcuHzWNhdEk8ln/+nFCZCisSEa3uMxHjsu8RVxXeUODHzgbSqOP+M5/hG6rwH6t48U6zqTRmKt9BPNnx7xrAZuE9LYy+cVAHs9WqzSTsDZSY3XketQrYpKnRuPO9CAgwRZv3pXCiA4G6qY4BZ55U8ddiLBNm/Qyus0zHkQ4Z0b6NlvZpIzOnLLtnarx0iFmKEeRVysJLFn7ojEP+oiXuhx3I6HYFG2Res9H0UHU8XsazsbU4DK8qSLFYkr7WN4J55w25aRwZz731i3pIITsJn9IKTrQDGpD6aNxD31LkHGurav+4VHqvs+gdN3tbDIDpnBSfJ19mZBGhjGK1ZK91oC+awDTMjcxViDkoLM+ECPFMkzfhnoe7+IANBzw98ZmJMA/Gjv7XSfNSzthAdFtYQEgqrkj6Br+qmEBOqdGcP2Xx+Fow7qEIDEBACWa1XzJnckIMKWKvqiIGZJuzADQ8EwO46FXQnQqkAlsUoK2uAYeMGQjmqJsGEIkYQjmaLlBqgtEk+EILily/G0zdIet7arXbQqqaGkItkl22Z82kgAHYhW+1B++spET4hBNhDiAEg79b6SONFSvTQ+YdCaNYLE2IgvBqfMoMOv5SYidZCUZgnpqpngcky5hvwXTNofsxOAJeymnPjEG227dWF7DAH36IWkq126/Tk/wipShpEs0hiLeEgYjjsc3MQFrx2/8oJt+tL3JJcvIhHTIWmIWlSQgliZLjFl07BL7qg46dol2TouMncYqpYuMnZalyyw6fom2WIqNXWDYWYqNX3DjPgOYc4F8WI6uZiATjhJpOIomGraoqy8SUSUXPop9MxoPVYlSkglGmaSkw8iNUYnGYlQmCOO3ZWJVQDVmf8BmaI4HsESccJkt91v+sCMj3VJ62k6GwO6jDp52SkOxMuntUTBZug13yZJVFzVEO84O/cP0ixzyYkKUDYkR9MawscMJe38kUS+RjXqx0GoKvjFgzZy33cLGt0Qa3wI7MJY4DR4dGls0UTgeYS86E5hlej7C+skg2qrsDxRhzl9xbJ9RNgomGo97iSbiXqJs3AtQnZpSu0Shd9W6cRl7ekqEC16Bz9Bd7Xr8hCs6pCfSb+jQdEDyPK9LmBoexlQZ8NULv8e9Oo3YiTQ8J/36JNNivy4FPekJLOgaIcFE66RglXT/vjmnvgRRNnwHKOd+ODiVFaXIhDQXZHbCawg/0ehDpVntiDGjk2ZigSJ1b8KRuqK6V/vyErwCkr5ejXTePd19NIumI04TKGynU4mhOJ1BSbutgYOJQx7jnOFUc19pAxgijJUpyq9kOZoS7fsoSq8VjjIU/eLmeBRApuj4qkWgjQua7yHKBjopqoNVwTfwFlTUjBeGSbH3exAV6O3M3J7GSTGSSQgeSaiUGODNW7ixVNFYLFXkxFIBZvOrzoEWkWSFlmJgtnyZadpBt0WyMRRoXw5uh7xJi911kUBeK800e+GgLsNyHcVd3Ot4UDYz/pDuaQhTNGncVtSE1dC9s1YyCoMSqNnMPPna64Ud/dYGlpyOA5XMDbWGrdtOXQl5fHJT9lU6RcZu46nETfSmFcDR0Er9b1qXosEatSqju6Y6mqsvOlS4qCDYjVj5KFPMGE80ZBb2b31ERuI3xFfjgoc5UQ6x4+nkY4VuBpShmiY2+G0lGkOiQzGMwBIyo9xQnXFtSWPPd2YTE1fQkxVSM+2+USXgDef7GBpQ9rpSpBob+hnT2QvAfEYOM4zOsf+NhH0A5hhCBkgg7rc2ZSNDJmRTpytpwALNud0kxyXtHlb5iF0kcNTcQQDhdIFjMJFxQMi2GoFbYHDLQ/a9q6ydENeZJwfm0YF94GFLahBIbCOD7Oatuhrwo8LrHf6QQN5gc5ogNggLSQSactJixkqpjtoxJiGpplukW2JaYGqkcBDs7ogRRD9uPBxwaSICJBKKIU7REnEQvKZIByKZGQBpZQkyGdIjK0zgUeP5tJiy1QtHXTsrWspBB3ux8pAAjaYCULUUFUaqNwEejEsgi9DPAbFokUfwKznwCRxIr+552KCvR/UbpgOOUUm2KHDVFSENZewCHYmCGlikHywK87bSkvo1Cntd3xumK2dR2NfZhbfRhJykq+2REZKkwFQ6IrEj1jCd6Gvc9PWoZRVMZbFYpsk6OUS8Vyf9qF0F45KwAcrGwB0FB8O9EC9JEhXVhUP9I5WusFNOJH77pehNi0eOoJKUymDCWK78fgmxSrAlZZbPIsV1lV0QY8lixDjtCKa6A8PsthPRJz4fhgGi4qz53qGp4JIlOt07perd8JqYpKqjhHPCZJN3SOkQYplTRkhG/MTWSDHPsZ9T96cufuYpHplj4exs6J1B3lTC7+DmQci4oA+KzZfAiPW/jLOifzwm8cdjgj5wxLYxkJGGQeCVGQDqRhin4nFsZePYqANxuhCaglIEoTytAYj4t2p29jagGfigaHHGVz0W0TvdpWucAO1vgqbU65h/kOtVjzJ5J/EZ7zfLP44Ez5wTq4QMmGS0sXFzio1/EwMsYMaheNTF4Y5/jTcIy0gvliAMlwdmHB4NsAltnJHRceWE0B47EruBdanTrLtmyDr1ZGhjF06myosn9IDYUQLirAaQRdWsban8oSRXKRtkBBYThcC8Uh5fYmzFl+KRTkfjj56CiPYFhpxNdJTgufhSevGluqrHl+qRbgC5y/iWW0iiReLLqomrEdAUWlXXdIbSm6vZQJdJio2XmzhjV4TcM04tJiPybiff+oRbIvL4tBuRxwT5fgxpeB0jovcQiFlFDibKJr7Ue9Ib9AR/2RvdxBYAzZ8S5cq+WCM/XTYe+VWePkdBdgM7g7NLhUE4X6lBTFcdwTX9iqeSkXpP6DFNi6cEWf9VJJ06R9A/xcmHQd5JUibqMVyd8kG1vjFASryH4Ug11RHronAAH92qlY6YqfPvJsnHV5oabhTYqDUCSZcrdM59T4zdRMl4vI0GSGBtF14Etb4wgjpbGZFyUSjpnm4HbQkuZ5U3iuVcNfa8Iaf9MmkoQUZeTwzeHSy6QH0amXS2tq9dso6LESrQFr2/QsMwig7FyVJJCJiw4DCFtFkNrrJHFkUqWqWEcbZYLIjUQkXos1LDjrreOJ4WsOfGXEySMrVR7n6jqEgpHEt/abR7A2TuUydd2c1gkmSvlT586Sj7ZjIzNIgDl1Z990OL3Ka7X35Mcb/8uNaupyxgVPVLo6dfTirpl9RbTm/g7SlZXy/Rk/CTjjlgMuAApaPt0lXhL0UqMaqRolCEFIQGpGD6Llkcc7WSHGVGKaKpXLV8mkxIZyMI/fhKRa6se9AE2bCYLP3Wi8cvTVX/q0nTwtXH7ApXtxgVrm63KFxNmBOubrUlXN1mSLiatCJcuSaEq3H7wZUVfa+yZgR7Qrst+KC9BLtVXGWMDFeTFoarMfPCGG6khivX5HA1Zm+4Eoe4Dpy8wyFibCYoYki7crzjrjQ1rFmUELwUYOuxlmIsjaHe6jyqR+nXLuIWKbKtnlVHmyu7Un+FofJmBwZ5nj/ZJ+xKzSE48kVqBkF+C8c97AosRL4QILaVX7mc5mqSx1y54QK6R/xOfm5jrTGTNNr3r3P1Rre1dNpcaLQTUDcby43uAp2iX+DAchs5Ar36wlJzg1Ep5nl+ejp58SL59NOkQf+S+t315y+a6xtJfWlhPn9v+riZyEb0HATWTYIwTsKh1uHfySb18blPMuQ58pVQuwAwKtKJd93xZAycnAadE8f5awxXFeOEpnXECMmy8gmXzL+ZFTumICU5A9qNT66lVhfeDbVXd/ETqtx26XOq30m9tfRNo9tcyC1Ivf82P3ec1I8bjbUmGqWRb+ST6dzyfL53s7j40pycmm3mZuk04Flqhgbg69FRs35/6TNq7sLSTvPd/cWn75N6I2pUm7nc7HgBL7n8l1NcylQzmZrKzRNydyqXTGnJjWEjmELpy3QqxwWs5+e4XXmjyYQkgn7iYWfWLpIYCdcNT3ONaCHXuNLve7WQo9ovLj59+tn/LB/l5GSnVC6enCQnJ+XSPgBO39HmOP0OwI5sGcgP6fR4gyxs3yq/kruGd9PzgxE2i2BXE90iIvF6kZetGSKV6M+DK+XpKNBMNKeS/8lUWsOogxE77UccSODR7AOTBHHAjur3ifYo5ImPoQITw6Cbr84RuXmDXI/41IuLn8mr3r92vgh1e+30+KFRUPeKTdvraRTwnX+df07fvJF/kV80uarixZ/nX85trDfmcvnFcCAuHovP8o2FxkKytJQ8X3+RPK8vPW/ScHmxQQNmg0eMGSl23HygIbO2tkEP+Wm+Ppd7975RbzQXny03iTKfR19bnqcnN+al18xvNObR/ahX+EGnR1IOOuLi4kx+qt64Xr1Pfyv092Cpcf1ok/62CXhSbM5P5amnTOeP5+p3GnFzPjetdzfadHu/tziQHRhvFv8X7U2t3pnXHrZOeNuAYZJFTwLvKubMVrF3Rm/unax0HQQzXgY7aXdPxyjDi4ePEC2NLSyIRxAFD+1C48fFnYvhRYJrMCJO4rCX2+CLWl2kmolBOenE6BYkFnon1Dcc8ES6B327RjTfmKOfHMZ0YenLZuMKHd/0OPpec+s43aji81cTGiXUso0ol5vfwMeN5on+YiZZREFXC/S7nsth5Dx58uBX1J1QLMqUa9dzYBd/kT9+nuCePPiltCaMJjRpD/1rqiZ8nsOrE5ERVVTMoRbP68fUK+ZfyANWu/QAEutbUnjjXU54q6k8shuya5GnwcESyefBpJF8PWqZeNnYrKl4Mg44RKnVX2pD41j89k//xQ9kXPDm5mbEn4ckH17cnCALeDg8ISlreAvxUvcFvU5HPq480VelCwyI9xA2gJFvBjrNUBAJsNvJCVWrnTjtxBZ9r6thcpfUawyB96CXZvRYMFOm4DSqmIuv1TTGmle2vZPL0O8Ki5Ah/t/n/z/U7el9fj3RO8GpqHuesCSgc/0JuNy8w/8sjVgfcSwRDVIiQUXDHZ1L/Q2MmisuP59/vpQ0luvzefA34XkkLrCksNBYEnJ99vjeh401MLm/AtsD03v3fvFZk5nt3LFyqcY8cydmXTRL0rj8CEPkifBf548bM413SeP9DBXzl3m5YCGPwfR4IY9z9eN375vzDZqDf/3VLDVN/fhvvprFnNqcrxPU5GsfThMzPZ4S8pRcOrU8vzEll9zgmkfrtpbUX1sCreX0keAdxzTPNdo5rr5JQLWEaxcf3X+Q3v371uX3vhvXLj5ceVSwdw9u4vMw+L73y9WLjx+ufvtjGvWmEP78DJKcRwj9b7dusOV9GMY0t2NXeGIMN7zOoHspmY2Rk9N+PzkdJLzDUfL7VufiIsDKT59ofT8JEDjhnZEcSHI76dQ0x/ThWv31yPfiHgIqeuJkK/ZGXn6II3paFHuDKx9el5dQRyUo5dqnvl0/XpMvsya1hwhrKmUeY4rXG3Pm5TLTAJrGSH930TuuFr6jW/x3wh++R8PI9qK3NY+wPaeRfKmY2QWCW228yUiS+cOtxitAtzZda8gJkTJNSK/zM3md8PQ0CQMh/V1+TAMg9UAZAJ39pfKTE8NQhJvMWIFnepqG9fMXd9c/8ADHUD/+NMmj7X4ikg0EGx7yVSPyGnnajmWgkG9maK6bGyfnmPzOJb4nkkjB/15eqLi/fcKd+LBysFsp7CVbB/s7pd2jSqFWOthPSvu1YmWnsFVMdo72t0A62SwfbH1u0aQgh1qlsF8tCfj2sJhUa5WjrRr6WmmfyIUyPaVaKx4m+4W9YvUQJZZLm5VC5W2y9aqwv18sJzsH5e1iJakUqwdHFTr/ulABsy9sbRWrVa1XUvyCKrRfKCe75YNNOpT2D49q9HtyQAf6A1Yr7h3mcHuyV6y9OthO6N0Oi5XaW9Wr/nd59UIt2XybuG2wVajSix5UktIOVeOwSFe8eUVifg5Pr9YK+zUAtdL+UTHZPkiKZbqcfujq4helGtdtf7ua7FQO9pLdYi3ZPagdJKW9w3Jxr7hfqya/3aP3pyasFGuF0n5ysEM1K70u1IqoYa24VStSXY82y6WtRC+hw1FlP6lSYbVC9fOk9qpIDXyQHFEtyslRtbS/m7wp1V6RGrJVqG3hSFWoUatCQaF2KgMiXLrse33z/bdJoVIpvE02Dw7K1ApUgyM0wHZSTqq5DfrqiWC5jTcHle1km+qI6atALVUr7RVpqtuuJeWNSpE+weEB9xJ8clQH53Htwc7JduEtXVk72Jan5/L36qXf7TXrX2y+2S43SateJnYEmsL5xeim3w57i/9G6rnyeNqo3snqdP3+ygkBpI4oLYcB1+aKUm1q/CDccBKd97trVDSNQDCveRCXF0+E97mDdj6ds8fUd/ST30gtdgr4zvtH5TL18qOivEszX92obKxtrBtdZb4xv0EKzPqL5kbyghX8teP8wrTq99RwSfF31EMOqVcUk11qPBoAtWSPeuc+FX5AnbeSfHFQkdL/EgyAhv+yzPCfu3oNK7YkFSQA7zbyNMTzAOZzzun0bG4eDEJ+MRXfS3mJ6s0Ekn6sSjYpPuAOJA3NOBq0KNC4fSG9XZT32eztswTTxMCFLKuqnJBQKYrwJXN6aMGB3wOvdSXKfxjnmBFN0flU03qXV9XgFCkzPqKV8sdDxVy1FISBj2/dXRjKbTyryS0uQa6pR+3mu5XFh+/RQ7huf5XXvkRVY8J/nG8sv1tdfPCeVct6/V0zp1Jbcx1i3MKLF/RDhdAVS/WlF82E9FvQNhobyUuS8V6SoAfjhdxCk0eS3G2gB92lLkRfj25dfZ8852ega9WX7t77NP/8Bd24/hU6xa/y9XfvpZesUTdJplEJon85aX1xe04efcN2mLQLfXfPkTkjR9pZgyYyvnIuR5fO8ZGmmhx/MdX1nq7+mkTLHLrCHImWAyhgEjeAhmzQlXXuVfR1F/+tVHdqmmuLLsmWoMbcrQ9BoXQn3TBHDZ4aeKjfJlNT3+Pu9EbYi2ArmqITdGsOnxG14Dd98uSzBbzs9ML3et1P9HVx+dgL/+fO+00vZN4RV/+Bt5x23pJeciPzlt91f3or30bv11iVN3t6/0f542mM0cXFX4yJMPNqvbmbGizZ7ELEf8xPi6gLpRSC2WmOh2P9zo9YIr7LAA81KpNUf3vyo5XEYPvoOadorQusSwuJ1gDbkXEVXA7x5OlKl6vZ4UAMWO5J6e1IGsluFJ6zgRObbXkQTGh+00sQjEW1SQ1rCLIxJ5E8k7kAcy5Ysn6Wn+Y3dB79l/mX3KSki496Hk0dc402ilMzomtDeQ0+pmYDtQLA2ghxWhgg8RmXB4pR5ZSzGAy8Vmx5Jnpfal779vpP1DCBJGWHiJOmN0+qXu804SUBNkIkrSiR1WFeNCUw7PgwifCStEH9S6xqteCCk7SwNPRRw2ZqxkCwtO/xJo/WmHnK2+wi6zu2Rq3yTpVmM8dxI6fsg9bq9WCYHJ2d82caDNmZA5uR0ZdgIyg1Y8KbfIxaw25y7p+de8MafVnWFrg1xFYiW6YiRb1/zYnn6QerJ5w3HqX5SIgd9tge1Gt9c5P0sJ9cj5M+XmmZpEZIppUABlz6sXcQbE8is1RibJoE4DPTA5BFasgZk8IoRi2QCMjroo1kdwfChSwvOTDfTJLbmM9tUg3AbAObbWTtN+Kz1TrlyGz2kWYnN2vtZTNzEo3akXq0juAoY43AbP+VEo0ZuNXzW1h4R76rLh25cJ6n8fmvqKk9tRNf+T2krpHp8efU8WhGzwySv4CK2F2w0+cJIKM/VqWnQlgzs3Cj653wBEwzO03rNCnbU4IO9HTbCIIhzdxPTlgOhLg2beZoFIwx1OiSOqomHV6QWVyc1efyEKO59X1ywbfgh0WPBXmhhbyYndfvPn/xaXL8YQMixnJ9uTFO5Zevs642l3u2uEycuSk0Y0yRmPJwSJLXcaNOHDkgZk6XE6drYiZkpXwml+8zc34wlT+ma6J1vLueXOeTrTgeLiHFH+w29WfTTZh66J5HaunRFQ9MhyKSKd7kuWQjJ0sjjapMcD+keXgm3xcbN3GXFgZjECai4FJ/oDFNmntuBkLff5ufW1dmzLZencS+19MSvIYah4Sr09vhFhS4wFMKpg6awpPvXWaOBU6UiALq08+oLRTHxHwXlFyO15u41S7hdEON+/Bv8s+n140+PP0ivyg23SdPn3xCZxoLt516+nfpt7SWoU503hoOFlfur/yabrztts9+bk8s8InFJ5/d/+v87OwsfbcbGiZ9MGAirv4CBsa7pOrtEUtfXkBXfvpw9eeOGDera2d3VZYQ0X1qSmBd8uIrvv0v/6MfiL0S88D2NqnW22XSzQgkvbpKGmehXCpUE+gj9EeazUFC6GaRNHNS7AvbrBEWC/vJZrXwukiqYaW4Iwri5tvXpOxtkUpJRd8pbFYPykc1aIKsNYv2ucX65BZfv0V6fSXZgupIv5tE3i5uQdkntVZOvdou0S+Uza1yASo+PZgIZVIit8oHKLQMvX/zt/QDw8Te3sG+aOKpGr5VlYdVXx1UiFzFvaSIJltshdg64tKPuMgjuYYqVGCFNqH6lPbonehYLlSA7+DVdvaTO9XiboI643bcjHKp2ByuKRyR4rZdLBd3uZDSHv1VSHmndqjBLLB9QCp80VoHijAPQP3bP9qjn9elCr1FsYJGK1YqpPUVXxf3a2JBEFVzp1QsbydYX6wmRonfOaigbsXC1itq8p1KCUVaIwwbG4o1fmc6frFXTs0saijZPagebYpFQjpFFVYOxzhBIDUPHWH1eVWslBgW60qtuEudKDUGlQ62atQ4dEEVquvnxbfJ5yXSj8tUj3Jpk/4+h31nv3hHSigfbKGt2HJUPqC2LB8cHCZlmDX2isne5+gIUIXp74iabu+oWtM6MHzwmlqqtE0n3m6i3fbeSofBSzoGpf0Ctecb2CD2i2/o74saK9b094qJB6bQAr4PoVouo9TN6BvCJnOwQ3/7aG10uzvyke7gHe/AtlGh9j84LO7jp1Ko0bmDQ3wE3IDa8WkQqNFxssIdgc1T9DiMsWqSebC+XDU5LFQKe2KXIRBGs+Tw4POiayRiM9aktQhtXCmUqkXpS5UiDWT8HOxT16kU0UeJveCPnmZ4AjEEqn0Rx6O9ojE1VfbwMSr4NJWj/USGV5V6+1aNm0TeEKerr+gBb6o40iPoUKQeIGMMdil6tWoZfKVaK9Sojmz9oyceGkORmAiPqAbomdU3BTrzdn+LO0n1LV2+p+auV/RV2axUgemrVsEHqlXY6EgcAMYu+uPRxwMAP/QZj0y3PeIed7TPBRvDGVdT7GevS8U3d6iNqeHeFKjHvcHQeoMns/EveVNCyhRjaMMPt3I1eUNdqSi/3NAw3ySNTWhmwqWm+dNPKxOYRrnTpR2eBdm1hC3C3/6n/9LI7ZvEmMXaWdg6AJNGI1LjFuiHHrtXRDtKBylQ1RNYBAs1+k/sGuNis7hL1E264XNiyEfgoEV6261X4KqlQ+Ka5TKz44My9cwt5qbgsFXi3AfgnlvKGAs14lXbxc2jXYdJ7tAf8N1KkTorGCDzUPDC16UtcMLqYZmqtk1FFcuFwyp1iuJhlXkd9/TiF2AJMIKlZlwC8M3A7BT4gm7bOSROlexWCoevEtNdS9vEmPYKu0XhUMKWuAx6M2JFNEDpzvLmwRE1c5knpXJxB4a2ffzt0rcT9rQvrKlKTAiMaHflPn5XkzJ1y72EBiAacY/ada/wBf7At/dIWdwDuVTlPsN2O+rWr9kwSH/UOenbgHvw2E9gNT2o7Bb2S1+KJZ0YQGnfWKgPS2I1tbZTPhIHoM8hPdGY4+m4d4jBvY2/UmG/Ssf97YO90pcYslt4Dh2qinIbEseRqtF4p9lWjOpszcaQx0CvgCtI962Udl8Rjdqswi1X4VaogrNWab6WkU+H3x1RnwdL4qFPcw0svrv7GOr4e5VwFaqf08eo/g7GYIgXVDmM/qMqBjv+ivRK1dpb6gzEhOlvH3+v2GLPPbMGpk0DjJgCBjz/gHXWKmDwvMhAM+EeRv4+TylH8r2P+Hujx0NIeU3DhXschjZmNR3O1BbESXgYf0nV//KA5onSdu1VdkCu5V0zLtZlGvnj9U8zltzXmC7HzLY+VlTri8/WsHbTZOvK8fPpl8n0ixnXDeZnVFhyXJ+aJRGYfrD0+iS/DkF4KpnlmqgxNYGwu5JTG05jBdJgNDv1glSDHIuTD3+SZ1ML2wlA+pHg44u5nz2C3PvyFin1s8dcx/XxOn5MTv7syS9xfWNh/IaPis+fPf1r3DF+/d/eIlNftgMPAvGDj4jUn02K1E/vk0gdhPGd8KJ+PP0OqhVWEUjfHCP8Ij8Yts76rTuwCbNOuMCXtVt+7044iu+ShO3D8lUrHN7Rtb87WMgj4idiJGssm7X9OwvTy6RQsg12+g7iAb0oJvraHSaTGP7n+Wn2MnqeLs0vLS2ZdxJVRehc6vIMXIpsQ9y0CHu0+tPU1I7SeouLc3lrsjdWefQXNhWqj5w4Ln2an2vMoC+trYk1XKxKpEQ3F4g0LxYp6oq4DKv875sLjfcgQZusN+I7zfnIi3UZ+LvLobqyx5/chTzCelujKidb9iRKUkNS1nrkDYfhMPGQAsm79uOMt5t/ysmJrSebWC/sugGe8CuZP8WgxOZJ0eJXM0+WXTaT0QD2jEsNUtcirNXi2//tT35g70oaddxYbZ16J5x6u9bpJa1TBFK0BthMEYfeTSKeQK1RHGLB0rv2OuGFsUVx3t3+hc8el9hNzz+9kfyQOb5DT52EvW7SPpOGaPtBa3hjDG3dpANTVIe3PaHfiK1tdDLpdr2k63fixAs6Ief2hx8fnk8/A2rCtu6BctrhrRl4u/tOOLgxJlAPbp+8bwCsnz3ku2GHdzRVcu5HnPzwPI4H7HvE2z2K/Wwgu5z1tBl6YlKEqRSv2ZPtGnVroZ5keZRNZYYcztlT0xaOSCEIQDJZ0tdrDemtezBm9Xidvt+Kz+fEjSsJBzns0YFq9aMztEFgA2XYCoeAEyRIGsg3GSB7+sXZSf9CXF7paTEHwAxGSIN+BaPaSXQTxC12NAN6yq099M6oCTWJ8hBf7CwatekQSGrFFiLGvQu1uVEjc0Qph2gjaBS2N/Y4GLXhs9vpYR3Mww6Eb8JhNzk5pYYqy05SEkF6cEpX7MPb+ZCaAnkfcnwl7yl5iUwBsJvxNlCYhLgPbnoYI7kcXYRALQ6368N9DVFDGgc84nwOsOTBrYujXujQQ2ao5BKWXTOGdvN3180y5vq6439Jk+FzTIYyJ9aXFj408vc2jOOy9zWsrbCN+nbpEstSbOESDonVp/o9y9HvsYFsLj8rjr/zzoynlNz8LDExacHFJV2JtK5ZqetpY2bDmvdy8zx3L8ATCWs748VOodiptNin9x+K5Yuqlty7l1vaSJZQtbHVm/9ROIv4PMD2kbF2sL3CiMliF3B9AvZZiYegxFo8dHjo76ytQ/eGGLtVPtqGRFslxS4pQ4fZK2xVDuC5UBAVllS+MsRA1gsqhTeMO34BolKRUEMl1wq7VaMvkYxHOg9uglikqgxJ1HS/4Y7rdRImNhJ8+OfrIu/oWstG6paeuqQvLq5knOSwMkGzFy9PTH4PkYioO4ir2lwOn/2HPDHSDPVfgMn+iHgsvhEXgKN40dcbV0vNhWQWi8s8gc8msua1LAt3uhg2lctW4XvfljMOfk3x9+LJSEyr/4mpVlJ/t9hEjf5frM+6VMeuKR3mzWKfCoTOcl4yOztrRhSBf/gpaPQ6SzLvHr5fot9V/UVNa42oycia85tZT/8ygeTknIW/I39i2TZlMSdlf6wIdB+98p/EQHmffsWVw67Fnzhobj5h+76eYIho7frKfSUBoGEPLxDiSs2NW3w0s16XY24Bzpm0iDlxMAhagWVny4vr3IWbKlHc7onFblhEW1pKbMADLw//GKuttzlZPl25v5OnUyLSUfmJ42/5PQQ9GmLvWQZ+8r9maiWdhm+eTl0zzGI3+yvAN/r/5pN50Tx78fQtV/8/+DixcD+9/xSmcZr3Golpyx40rxSVyAXrSsJ+FrKu0Ggktz6ikeR9LvuzH+e/qh9/1Zz/SnxlJjxSWBam4/OkMZeTLvLtduoRfobVVTg5ykopS12JboRjjuHQRoKQJNaR7NnOmikyLXd5+9mkS6wgYSnYw14lELW8IUoWwe20F14lp4GIy9hfW5YVzzmrtO6ZDXmNhTaa9rDxCq9vcgb9PouXfW945nHsESdiIPnRLmQOWrINzcDrSbLxDvL0mOQ4mgo65mQcLOtIMi/eIjihZ8Y03Nnt0ogdEdYOSUbTZUQSgRD95sfn0o5/K42oS1Gc2WA48lSzPtRYFFn8m8+4/wBvdHkt0Qx7QWTIFz0Z8rLYaEJU/iZ/DytTc+/qcENx5/y3vPZHQs6Hu8dwzVwXyefT+qeYLKmbJTg+f76BKfPFxgsc8fHbEa+o2ykTy7tMujbT56/ya2tJ/VmDFwsb7xrvF5fZv3MmHb+3O3eihy/bBaF16Fd4JHBGjMOuOPvwOPmZrhXNqvZIpL/PuGnzjMHwLDOjlV/mVRw5qb09PKhuVUqHNTrz2/zzSTqGgMi7mLdkXHykcERqsK6+svqb76jAYv6laEzfXRgX9ODHeWq9mWVhgD/KHxMbn2Govphoix7PUds059frz+80WaoAH2o2gtyyhnKtPPz2vzYDt7BVY0fWHViit8TCKoIeRLxdEta2Dgr4OymJDyg7g7JTaq3IK0yVpLhdqh0W4Mha3NmBzQzCG+yayU75qLRtTVxsv9qpwMDGv5Dh6AmbRyV2f93dK+4fye8JPGJh/RKsXHhbrFST3cPkFV/zqnIEu+ir2l45KRX3XydSfbWR7klBeizBmk4w29foeGK9bCe/bfLbKt8qB76zjLWdg8I23bZbqkKi3T9IDvEcMUFWzWJCesGYSY9LrNkCa+4bkXxa4R9u3ROnMVRll4Pm+xDkdUvHFH3z5XfrEgchdppo3lCerjz6Rb6xvFFfalzR4FogMM9BfD/TJftnczkaggmuvZ+va4QZ/PEwppeW4MfXWMgEo23M5z8c38MNv/lYsBmd29MwJrAF0vE9SatxzimfzsOrHCmu3pmE4V62OJaJZhN2f1owfmWOHPhTx8wHIZFf+vkLrnaRnnTFsVBpxBWiopJ1uz5ONb/1VA6BU5j1Vp78Vf4rthvaR5a/K0bS7LLGDB8PmGNfLnU3AUP3g1zq+LT4bcescLSQWQF7lqsvkrWbJGkzOW3Txu5LYjBq38SeTqoaUUm/Mt11ZEeoTuhB/e5oxhOnmHQalvDL8ZBLPuqr43oEYZ7JpAzrRhQGgIZcZJc9mKiMW56DDaLlIR6nOsesGXhXrqMTT9vGQAPjho3vFAcnUtat9aujIe6Sqm0i+PMspGY7G/nSr5xqAIXg0IX+D6eos4DujRIO8ZKIcj+gKdhnYCAuUc5nZbc3fB44OgVmb96+ycqrW01yhnk5wIjjm80kQ32xAKlMWiRysIUpjLNNQgQ2/HAigls8p0bYOI+qT2dkq0X9hhY3WwXzXnFaDtysUuFl6Dlw6mAlGV6GJNLwPW7djYVRNhPDQHVa1cSOIHmayTobmwgccbYSIUh8rvhgulgGczqa8cTSvMVpexEEAw1Smmg9R5ybgS2XIkIaLywZbCLRTEirGnSynkcY+1gU+/d2g2/kX7wgcQcxKxy7AhuRROV+QIzazMvmussiG8eNYzDKtXtqItqCERIBNshCknDSk2Q7jI1jtXi6v3v/bHFZYl+mMw4yP1M265B+kj+uz06ROkw/M+zUlS6dLDurJqr6NlbyzOU++3YnFdQRP2jy07SRkqcNsxmE4w5iqXsmLIkG5AXJ6H6fxyeRhpyB3OOMfDRcaESct3yI35x8/tTk56NZCmk0zsDgzobeDYvmmANw8TksjT62hSVGEwmEXW0gpwdhhweddxqfc1YAv9ulavHZ/ohDOodJgG2AaYTZx4WBh6u9rt26BWNIy2dISiAGy3tudcV5kJ8g/ZYdCM/9IecpRBQsDa+o30JiCz+KRQq3Lqzf/jfG17TVow4Kp88Wknywh2gsbYed4xgQ/iPw70lmREMywuZhhqKbqB+dqS4kZAZh0xwm3Q5vNioH9lMVEKOhi5x58qssgnUm/NDYoZ6XcCYXmLV7vMveGbbBpd/+QEzpgLD3EvFtLzkP4wv6VlpjmmJiDYjt+afyw4/Hvsj8Y29E7cMh/7WQsc4CQ/YC5Q8+aEEDGoQDfsFBaPY/7A9iWw42LuTTsguVA0pTqP0Zm4NwKlvsGNRpXfKPF3DaPJu8tJUmDHbehLDIJI6WMglAS+o30MvkgPYTSBtTEG4E6s3c9qNAm4ttzCiJXlOYNEPoHHSUhxLAN19SRxt5nHWGf2h2w4cwMDewwtJCBgO3tbDUWDGt+FWrd5FcnZpzp+wuHcHv9YZegZmO7cafkI7UeHdvaYND2llYMQ6qU6RUvKu/u9dkw3D93vsmG3BcPfHbf2/ZSaxdmddm8MuCxijQX28oR+m76AtYi+j6p6fnmIQB0EhrMUAv2GdA8qFAMOjyT3t0espA17OgbHIEiIs2ANfmlAQU+DFH3MW9ax9bTZBs0CUNnB97PkjO6RucjzDK+Rch3pjc+ljv4UL8AA2pexgJEp2pvHA56iU95jqcqFQWe5CASx7Fb9RvXfOzcBzg11D5Nemob9mH2MS7ZKO5uipkYDkkgJiDQP3eDc/2oU/ymA1zlz1VL/mHk2V/PfJG4G7M2HTfzLSO2vPxbGTilC6j9ZXBwL9Kob7MEPWpYZ+zEnFlZeI6z1sLOSw+GXf+xFmJhNEGAh3HK+BXJm6N6u+FxKzUXMBrYTeSPdQJi/rNR80iyIWiE3thaUfC5L57ZmdbCBs6eXLnYKFGlNP3aC/JL1Ygl66lztEdiBjsUa8WI2zPLRWO6CPdaUWygCUX5tQXoYdZua45O+6u67oSZnL63ViTdaR7rMH8NI1nX1teBOXv81/xXP5V0mhswBrHsVC5r/KLw1HgkZyDsPUrVbloUJq13Kx1dfVxPT+nRhJjr23AcE1DHStKjg3SyfPC6gzdQCpNU0NU4LON1awF2N751Z6urhTzw405+G9IueNWz9uFkK9HkIOXzBLU6uojVbNYOXAVKxYiMZRZj4IQ1VjObRh96lf/InXyPTlRJZkDO/oI4YDVj+RexFiY7BRYP55Qf6i7S0ftt2nIcB3UmHgWUslxSG8/FlRhdYQo4eVotSGG3RH16f4oljgJiNy8WCphCj3Jui4Gw/PWkGXob7BUnQ1UwPvOIcaankuzCicXRABCLuEP5mTDYLPy2mmvBV4kWV1kQPyQ+gY7wPyQ1fk8zO/PicIGqNUHn4gmDfstiCYdDZ162LfJbmggIZvRnGQ2Yjg3L2EHZjFiRUi3LVD8gTUINWf+K+qpukL653mp8YfUWaFRpztclZNDWU5YXT5pccauRF+eLbM96GJD7/QkDHoSx0FfVxvvhD6pmFqjkygm7RqTYBNLvi2SNWVbEXp/uAiZJonm641c411TWubBSf4DjdmkDpPoMRtHSA+orxMXSZbq60tiE11PYCKlaq8nn5IKsI5sGFTYGtYU1wl+TjDWGNeTJcLoKnF8AQ/6N4aT3qCdRAU+oa5G14kB4IatDCQlEaUDv3ti3Vguf7CaPH6YS3wCnyYrjwlJVlafJnQntoSUvNQndil+NIeA4oRvwnU5TmmCUlV7AleZo5fJjc3zf05nYNSZkpVosAfmDYmTHEGa6unP8y+njCmIV9yern722AkdNVwGq6PU0kBJ9oBKhQP95pAUhE1Ud4g11HO33aiJqA4yJho7NMEwbrlL4si+q7y3zC3HrT7pkIfaLgOVeZKkkaDRj4rP5b6r5JN8g9lVXdZhmm5M8TwHemCtMt8wQR25hUa+7veja+T/evjeLrzMJHx+cfnZe+rCzVxOWvjJt3t/MmFfiiwj5CA2Sc6VmpPcQLZz1vPUH8lN0HV7ei61DHGeLrYFjaCfjwW1RVAN1OYDlx6SQ7CtDaw9xBHZ2EMjNWPuYesOJFiT7IeHtppmqOPSL/Vd+qXuS79PXW7shLQxs+2FCFmznjFscYHkALuKjUqTGK+BZDOfNJHYILRTE4EWpRYS1hKhKyK/Zc+ycx1wduDdZhmZTEGWDUGjckb8TUZ495G8/EjefiSvP+L3H/Fb0kQhV5uYNanYCFaahAN/xGoChQP5RCHjXiKGz5esiBfjec98SfZhDa4yQ5R10fr/khUFKL3VRm9DLCpFmwTEhNk+Z/8LZpYvkqUXyQfjeHrv0+ME4WbMdTcaGxvKODUlSV288U6aEmf3U6w108yS0CBrTs+wx8bx9Evjutdkl4R5LL+mWOM98mT5ARfw9MHq3+ch/9CZnHORzpQ9ZOsSKzuu3iQRT+tWR1zcUtO+EOpoPYTO6l7cTHr8G4CUhHHOsf+wLX5N7D9IXASBC54hJkEPnt58MaMLwA+eOutl/LrW+o631otWMhc5Bnq+wJiSPnEu0mUyc+rYnmIJr9Gg6fsPN6W6gHw85Dnvgyk+ePj1LcU3Zu6Ole/ONxJbvfzRsyKpqpyaWK/OnD7xQZJ/fnf7gF3EuXYvpmYhgiRYajPLbFhiW0h59fOp2VuuwGR+9+7SUi55Tr98IX15Au4uvaC3XKJfYuvszvNC1tUfPMrlnVVCt6ysU/PTB48T5A7k/FhdCNDRi0Z+feb5PVnKiKR9DV2J83+wbE45EL2gOSMRMA84B8cU+lp5qidX84l42E7K86mHgrrS/CJPQ31mPAr8x0T9SomL37b+zBrJEFUrqqJOSuwuSQfkaGQ3UGaVbfboo8MZzQBtaP70E/EPscW2jcNuj07x55/el8OKuz5CP9f8+03SgWNgR8PebSrKzgV4Y6cfTi6NYPr0A5n5oH078d2XbMWgX111ASi7MnTYpNv19K2chRWeXAgQumTExpHjwHmTBhPLjz+uPo4qfnRtXQFLTaFNmxUQgk1GP4a5XtCz7cRIiOomBBnXUIAw6PIKBiOc309B/pCs+dKkx+HsgAdeB367BEruZAaii+yqzgAKzti6jjvj0+8wik9EZ7KLPOnKTshOsDhe8A+72KbrPeZVCcCMhsj3b+7LYYWFhlP8sQImFrkT7jzYhues1VPE6HId0imM7sTR8VjaMQHysibEO9SY5KJ2jQg2xjHJg3eN4Mri54QEeQG4Kj3YWEhDaat9SHxeZU2Jf6WP9HgvG8zoktKQ+pTRKtXo0Pe6PjU2UfkV9GzA/hZUK3QmlnPQrent6U9WcGDN73nilEF/GDN8WFGRaAipaMALTsZ1mH2mbXLIZIAiB2HEz0i7zsBsYGg6kO09rhDV693n3xX+5TU5AIj+H/VgKLzpeaS3dT3ckaVJvxpgacjaszryi5ECwHbSIQ9nTfLY6rEzsIhuZ1js8vgGk09A1HJuqSG/3BBLT/KL9lFgBWblnujr5jksXeluRsOYn5dtZgx1HPqw/3MayMSMHhzla09IhvTd7+txJc1bwNkKRnCxv6/HlUTGX9w6O9P9WFJRcnR2zntqmH1HoD/zZteMjXirDLyneU3zllQL/IHgM8Z7YODr4hctaPdrEL1a9z2gJoGSLS8M2/7oCtt+pot0yFHvyp3W3C25OQkMOHH2xX3+XUlTK9AXHiLn9VCW+HSdDz7gyTU6t3UpWjczDHawSeRwQiJM28DEFBTqYSBJ0pY78y/Z/LdH89X0NIRUK8zmNmbrYbd93ryzIaLuN9cnnP0A95GQW18+aebUfdJzbIk+kkYR/u798Yd7mFIlSQLb4n7CTsDibCFewEtLywvs9EMibHjdbk7Js0iOnSJp4/7K6Pqbq975EqGph+mv81ON6sLGlLHaWDP+bN5ke576jrAYyVIxq1laTC6Fb5es7ih2FQ3vkBmbujCiEXyMTQxDdVgwJjaz8b3O16x6tcPuDSZlWNfao8g4AppNI0wghqw4m7ATzInGSxAsIg6tCVmMxonu3yzRMcaAfOvc4A1pZMlcyClSqBOKEQ8vwIolp2+33J5URl4Ys6zZD5gN9kz6G5io+62BcFc2yTPf5DwRkvkEW4JFumivPBQsGuvxAzHWp9plx+uiIgxRcxvudsb+hYh4MLt4pMlquTCreqrfIfZXgEXf2BNFDx21ZajCzRAuiFhR59t1yarFO4dyahPZYQSr6hi6xobMmy/oQBVfRbPMrrrhr1xzvOOg+K/zqjGyuvgyP+v04lkzehY0n93JcnNhWn0WlyU6aWwsfWXckdbWZa3903WTKr4toiSnixdvw2G6hNBHsssEQURRr0V/1CbY8WvYy/ANH0NvwvMWKdITk9WNabOzOXbO+/P8FMezOQGH/Jrf/t3PdfTsJxK8khxytuEvki/2yujvdCCxo0XsqN3GGg16QavdwR8vsLfaIf4uPU6+AzM2jzmkjGvxT7eLg/yI0QVQmLBYgZ8ufSo6nvGPmsKHZ/LDUoZ45Q7PRvyjaY/of8f3k3bS3qf/qHq7Rf+7+MMP1aJNR31kG/97+AuvJOtOmwRwFudo2NN/rHq3+/Q/7PqnPvWvNvEDHiz0fu0w1psG9N+sVLWHLMwbiR6/inANAJiDp2Yrc4AkRRDvi9Aehvi7gn1rdEoNY3kPDvSYUYA/jgJqX9F/f8CbSHSSzj79ZyF//5T+o593WvSfPxSOHf4RPwi6m/66bfn9P9n7DsC4kvLgnffeyuq2z3fm7uCO87lpLa3XvciW5e4zrlj2GU6Sdavdt9Ja27xvV+X8fPTee+8ldEKAJBBIAUIJBEJNAoQ0kpCEDiEFOP6vTHsryWcfx/GTnK2dNzNv3vT55vu++eb7uAj00j0z9OTY5VwK+EOnpphs8KH6CrLNFPBHp6WQL7g+H5Ii4cI5QnacF3QyOUifAKEy5tdG2ZW54QEeu/QdePi7cYIp/AAoPI636BDnBVwSfyj6URtnX00+EG/AmsHCyRRYjkEe66qjXQCDGXa5VwCCI1REB+tCA54p5fBHlUAsPC0fslvLKKGGvyzRUwUKl6sB21yGjSJDjlSKW6yQky9QYtowcryHVIs2cVZhpyRlyuGrSg5/VAs95TIX4K+eR4oNBSxo/mTq8FdKkyOrWC8huM9Au6SMNp5Xj9ZhifGj6vuwx8GszJDD9kM1SxQFSdBRexP4i+SkqxN41k2H22PsokIweKLSIXyywDn56vLBCfhOHfoI2UMPJ5Ci5VmU+8gDEl4Zx7cBHaRmz8MfnmVnC/BHRGdVSodAInnPEEg7/GH2fkgyKXgqlhkv++xWOVRkNxijZ4kE/GB3tg569XEvJCXxBZ8IVHn+a50CQ8c0UrG8x5N8P3JB8ZDYnBTDjh6yGOE0bv+MAvjTdfzRsXxOIgR5tFCErpIFIKrTMJulIEGenAD1q1WZIg1RCRn8EM5AVXN4FRWdDLs09dHHsdlyRj3xjYqk2YdezkAGEUdBNMUWW5SSi1WUi6qQk2YXChgPx9PwV83SPB73CxVycuxiC9Azxi5+jp4au+kxkm9gMVucJuoCaz4Nfzy38wjV8gqqIV50Hv5I4AEQIhZ5oEWe14ucUCZax3lrHefl/IG5hj+cP/k6/EGH5/VKyvNKOi+J43qIJQXhRDjh+/irAKFGz/Ps8lvw8VoB3Os4/CFQKRzP4Q/HGaBTAW/SEjQuGGhcUNC4QNC4oKBxIY33dPlqOYk0kVwnJIOv1adAeQMgLuC9W4aSBYCDBR55qRUvV0uzi5s13yLBm75cIhTHZeGcKvCkKozBH0LrgoHWBYLWBQWtCwpaF8YwgONZ4PlQUBOiAFXSgy3vE8NfGn8UyOMPfUX4g40UHR/dCjkZdmkkC9ARyJHAxVRgkF0gkF0AoFpgkF3AMaaPy3RjmdBBlHxC5F4OC/gm2cVMy4giEzQvlPEznPgwbXHSFhgAFzQALlTxpjPB3QKEoGSYtWGhDn80UwqQ72S+yI2VnrTxYX9AbSRURvmZEJtMLca6hVxBtL+pLveUAIKSi5gw6T4vQrIJf7qagUeAP0DDcWGCr0IO8gyL0EL45X12p+hRxG/KbDyDbwsV74K/HP6wncW75C5WCkujKEdnKAYaiZIeiVJ5HH/qsjcvL2t1Afhkog8eJfxh55TDMmVT1tkgAYIn3lL/Yk0KECMpAn/0EfzPhFLUr4J/WfzBaq34gBOjk2W3DOQKCufhr04OePGvTHoa+TJPldg+trwRG9cAaoa0FOSy7KJtEXhip7D4Wk49ceilzJ+W/atAashJdkaldhx/2G0A0/A3FlIGNV5Xldp5/CHMqtQK+EtTbAl//BW+MTXEkmpy1lXw1ntNElHYTqTZpugiPMDbykwOf1RtMn0QXggvpOEPZgThDeik2UUTQ+rKfIZot0mi2TAMmzw6FCyjQ75qeko+AvWspWv1QPKomOrDEP1QiBLNgpG1OqL+NOPKx3yoOdW8VIJJ7qh8IJYeViE9yqDUR2fIybJbpkeOXWxoFWlAZJZNwh+K+aIt5uPwh10ZAOmEZCXxsvDKPyA6o+VpeCpKIkDhy/Skj2JQo/B3HH/0KdATAdERAdAKgSQWglEM04gFQC8EhmAIgGIImGQIgE4IDKEQAKUQKHQ/kJCUxDylsKevnkoLBAfp/DcMfD6uBUhLjsIPwD9GDpNMKCRKDpFMAaSlqRogQA9k3dGeOQIH4uYHefQUqA/yRfzhZhYUJN1JLWSz30VkBpKlclyQAa3hQK/hANUpEMIUQKbcfsBR4AdIYVAq409+jgRsoOAze3z1xO/Jsre27s26GJDpGBJMy8oHLhzyjZXLMi4vHzT26KvKB+7QBfbX5QNAL/um5AN5lkrpQwU/1OOGxrXVsNFpOP7onmSVZebG5ENpwaCQvLZJfpnOvD+PP2qBsjGeZ1d9hNJ4ikdSRwvjJb51BNCQHOw5rFs9IMUdAcxegu8oJUEHTrUQ4A+DH7JwPYq/4+Rw3GiGHIKo4MmSU0aXwgRc4Zkjh3LEZ1U+AnpZICfNgSI5uJ3As0QOVIgeXCBlzqJNaVga6Kg+Bj/lLLu5hswR7GNCBmsZ1LyBvyw5ZXRz5ODKJ9vX6SoSHzX848ppxbjnQ+5pWBcMYlG3Bk00ALUMaZHDVK4QggQw14BcFC1VNUKpBoiRYwJQrFYvUS51ZEeFClckxghNLnTOs4tYI3oK7CKaA+MZyjEFop5MNRXK0houyV6X0DYuDnO9oi7eTpI10lFycNSUbZNJnDLo5HHNT+aR98X8LwCEocJDNBpiYSGT0jgroLzwIypkktb1pF7Xk4BpTeJATgbwR8tjElJz3abCqePwR8Yd0yiyXQinxjWvjQTWMuQU2fBjGd0KOeUAH7Q9TEFCGocpeKU7f+oC/KXxh7lW82hoEmID6oKpSfiTUH46nE7DH6RCimq6CH9QtWlqx7RuxzTAmGkasOkS8dAI+kxL6DOtoc80/lHjZsKZdGlC3g0/tlyzl7NhOh+mJ4phuuBXxpHRVZ7CSiN/rID3DvDjdHE0P5XPwjQE31SIRsnIkQzpKnLSwAFwyI9gPI16u2EjTFelv14rMxJPPuhBfKJiHmR81fFYIs1x3DnaR5y3KdT3TVdj5IUV9LIUEfpgUvGD6DP2YlHsYzYa+oKJfIW4aGU82kJqXAZIx5PyIw0wSp9nKQm/BLJilF+NhaPjePitFCKN5svBBLuAXY6CdyITjuJhB/PNkCs2IblhlG0Af+yB6BryxKQAPPhIVD2LPtoPkU9PbI/MZJjJMnOIYFkGKFgpJkZKztF0UR7+SvijToXnBDn+TIDPMjkSFQXvFDnlahZP3/OV0TKe7cDAjLPsO/im8EKeDEAVioFUWo9P5PMU+dqe8vCxGTKG0jWy7spW5WrGQ8qSVAAxYzxpmGAXug5HT1W+DD9AfeGnaozJA2QnYS8wD4qDaMaDfIABZiaQa8BBhLjax0dbHFQQJxMg3yzgDC7kwMEiAHxmeFlm6vC6XoBfFbZvqbCfAyQFlwHoQLwncDNllCwwihKQATXK3ukwO8YKsdDBq4QwaZBNRA7NKWI3VWqKWwTPCorXShFb5BZkZ0IgRnCNwE+bvvVHQ5SRzlqdDpXwc8UQWT8oCJCxtHABxMpRxX2A3QBDfVT8Jc/oyI89QYKBgKwCJUhe2pTYRxaLQz/I0JQCKE9HwfKeDV+TxZ2ZqLgcbHG5TBDmkF8D20IOsO9ctoA/jCzCrxQiYziXrYU55MpgXdGB19BleJUkx4wj3QA7wK9klYyXogu4KsA3AX+4eHJA+OaKUHaxyrwjHkn0+mT9mL2kmww8skHoZY1U2kdoDwWRpPU5edEHmoT5TUUWjwwogBbAiulp8pPUCtdQFoNeXOuVtHqhJjqHcCjQ4hiESVQUNvOxTDUcy8KflGQZg2Eey5XgF8BvKhwbh/fMupL9gl7MaAywhbEaGifI8/RFX65cqqln4GvvFG7i4MfLYdUyau+o51XVwIv3VcaQ0hrVF9fAXyuX0dy65IdBh6JHwg70IqcnHM+F4+PheN5c9xkbL3CSCfjDkSIXH/ArwB98BNNFU+Swv+SR35xnmSBSJ0KDRceZgB0Aug8LAw/16MIcsiHyRWSbATRjwVXYeOAnZX5gy8Wf1EhSREEUVRJ0uZFDoScNHPh1CnqF0Eq+QS+tDPBO4IEmGnhAqVmgjLiCVFCRDUxO4taLjzy5E0V6WLsvBdUGjAHcdOWT9908SdyQmx5VT+wj5eOtl4L8adXE6P1YBiTglaEq3wWdNBuyHcA9GcNT7CIPclLuw+QzeyoGtYd4lpNy1yQfbpzK43McR/AHuIfiU2+LEMjkyM2zW5IPVXcLEFKIjyTYy2WpzYa8er/BEFXebB06oLYLiuCkvD+gr57hR4Ef1kahw1JiepI2CXrqzQFDVBJtB/TkDYC8cpLC7k497FOJ3AsRkI9hapuB8BgoU51sII9BA94xJGE5eqllNGcnDSynQJXaiEAaHxPsyllpAVEIjWXZlRAK/QwywDdO1/gm5eJH3wS7Mie59snHD66jWf2lSZ7cDAPgaa39EhIH5GbkQ614DFDJ9tqd5JU5aS/Oyej6zFPpSO0QoskhctEsi+QcYWiU1hAWxoemFAgq8km9gDzbSqE+Jtc1AER63IVuMc1uBnavep79Y9zQIlW1SImRxckPX7WLuTSq7zXPhvxVGVcP/JzxlTP1QIfGWZJuEsgEcomzCT4oYZKeSIsDLCKBuskKEJvsoToqxqNZP0Tq+FOSDUwRdEUWfZMUgUCFCGbyy2GnS8NVVCrh87Qw4I+BFnHPiJq1Axke02qBXequKi2vKn9bZ7fAbQpoKgcZdmUADXASd4FC9FmA2qSomQEXSLwlZByN61DNp5uoEMjnakyOUKhcJeaWDEzJGqI3Vy8UJEjBIHPBVUBOt4AaGxTZBTxDzUoKmG6moFyagSyC+i3g9c6ccvIAdctcRxViriSFuFfYDTh9LS0f1ZqBIoDDcGOn0ryzk5+mFKeHdo2aZQWhql9gNRwcDOgCPvpH8/KRlR7q8ZpfLeooUrZKnukaKWCRftVJNS54jFdVLQ+wp1xhb9FnKVHw1ria8nOZgJpas9PVZkbreUBbSjKUS8tsCQZOUg8zS2FUdinvdFPpKn0yRSmm/HwVENJJVmo2OZUb5wf1OsrMER1OfrT5JJEiHWaqmoK06KaKMnWVlwc+Sa8r+eVGzJtwaUb7zeY7heajcvjjuYjTCkVmcfLgBhjIq+R4PEiHBBaAO4/HfDOhRDnwQfbI5ReISAKWMgHzAeAzYnR0NoRPbCEyoyTn3IKPCBwLsLQMdGQEmVyi3wlUosOkKEJMRt9tmIkAs4Dp7go1oGQoiadMAOHwgRWkpVVJ56vyWjAx0QELVxsueJEIzfoV6HW6+F0xfr8oH7Cxknw0h2pAixZh6y5iOdBU6G9AFYu5bAjwuZgP1PEUfV+AP4gBH6zNIvRVsVgLNdBWniC0YLcG3AS1CTSHEnBbUNuAbPIV5YNGiLwyCWN45K3JB/UB1KQCSQDAFO+6gD80LV8vhqhWsoy4KLh5dGCMwbUQUQwpPBT8iIbyg7FQ8FfJAZjEDxgW5eHaYIg+quqwRj/ZL+EbBwj5ZC9PecuPqCcEp8jB0zk59dFj0E4IqSfqAS5LnBM9iHLKp08xFKSkiG7CQ2ObpXIGOyeTJ6fErqynhX5hgPFM8lH+CstEn0YyIYAVNSim8isME8OUjPFL8NQz5BbItZBLFaRZVSoTaokPjVlCAPMnvBIfjFaij7HKUpnONn0shZoawSghiK0w+CT4y1gJG5sslS1kEgISlwRfjRQusdYliUiiv4qNQTQS3AlyeEpZOGSpPJYlR2KQ4GUEslRG/JHcLOUwPkEO5yBxR/RU+AgXDW9nyCH1TxaqCIEiORl2JZ6IfizAYInoz7ErcUT0axQRLXuDY8FPCKBjgT8IjOIUN+AP/UGFH9g8G8pBqIKdDFAOT5fIkcBOnTbBEytWxGQkalnWsIW8CqaogM9JqhxDMEV5CKrIAMGVUhkPuMvqiLtMeGCpbKGBpTJjgSU84CmVG3BAirBQQAwTBgieSQxq/E/xq0kDmIX9YViCHIIXBvWz/BkapmqBHOyRKk79Kn1UJ6dA1Q9w0gUZctir8T0MYHqJ7YGHirBwPRkgVA/9GtOj+xsS0ZN3OYoyVqN5HGIsT/p5wgTYqKBIjsLwpF/3ocbv0Es5Y78EtPoYt8OnRu1kgDE7DFDTyQkoaS3NrkbqMMStUigdenFeUFILn6OARucoxNgceEfz7Gb5Sdo3FCZHXmqaxuPYK7uhRoWNBXzzhXE49DFqhr4a1Yq/45ckTGwlMcgbBQh3Ax8CnUnsOwtxK5VpoyC0DR741kbaIJQbJxd7U2Ns6LUQNhVkfA1DuDYIW4NHlSazxtVKet/SmJr06t0K8LRSVfEsecnJrOtTIa28MszJcq4eloulvLQyoBei0iEn4/kR6FP0SpruCZEjxQ954ZJbK4+NoSwF3WBC1hX5aGzogKGCpVeQHVtB2wScJFcKYf+oIFcQ7x7lw0oR/kZhGYGLL5F93QAQJDiQPRgFDoR8ytaQX3N5OUSFoo/YlORTZaMfSkYk0a+poEmmmJUS+OBfvajqMAltAFh0wQ9J6wkAHsRHNGBisKRl+23YJCGTAUkRgATgCIERgCKUFalBHnWU5kBIRK5kyEqxDurmYLQcAnhC4ARFhAyeQgtKsZfP1cmLZ8LSh7q0MihGQbcOMtxiCc4CvyAvJOARAftodKVMleogBHrBeCbH8hPQClLeQQHUrsw+6ib2svCMBSQNiGTfjPpoWn2lwSZ5eYIH40W+poUKnEIDTRFO8h6poKoNUw1E1fAUPciHRqAWjF8IAboipaM6Unup2/Ioh3E+DAok9yFhrw15NdwNiigIAqXDAsSTexJpKKO8RYZlK9iFiUPy2RwiOEo+YnWTL6iPjaHKraCSQ0mM0ILaFswOKiiTAX/wAx+KqgQkRJEuhDbYZtpKevEVdnsd/tLwywFkQqka6cHD8ABKUQAePXSKEAD0Q1jP6g7wvm4AgCiYvoCSFvgjUqkQStsjtZE9e9E5iM5RcPYNoHM7Oj46ZXQCcPbj2wOHwTm4Hp0N6GxEZxM6m9HZgs5WdLahsx2cwwfQwUyP4GdH8Isj+MUR/OIIfnEEvziCXxzBL47sQQdrdWQfOvvRwVyOYCWPHELnNnSwLkcegc4RdLB+pzDuFNZ+AH0Do+jkwDl7Eh2sxh347R2nwIHur42gVMkI0EbgYHtRbGMkU0QHG51No4O5ZPFFDuMmsB0T2PwJbMwENmYCGzOBjZnAxkxgYyawMRPYjglswgRWaOI4OliXCcx0AsudwHInxtHBMiaq6FBBdXBQXmSkiImLmLhIQUxSxCQo6DECc6k2gkIxIwGOVoBvUcZkBMg4cDBdHYN18tXAmcT8UO5lZBKTTOKLaRJqodmHgi7pMR+PttTysHAG8ErLOjbuoDEHnNU1yB/QB0YewIWsUT4GNxxEIUKNR6BHbwuMUmiEQqMT6GHAQhgF7BJBul7F1kjMQiEN8lnAO1iEYJCrgyheTh55sIRHWqNA2conHTmheAe1Fza/GqzUGvamzt8uAKVygGqx0BSFpMCT3jGdDx4Jr8DHl8SmQsBigO6rS/kaOniUQjOsvY/9RNZDuTBck9B/kwicJSFJi36SXdhy6Q08FeBXoibyFijJE1j40iRqekMNJIgwAcCYysBfMZzCS6EGbUKkCVGmqfF8ZpwQoKk8/I3xPVHUfaI8RfLJU1WNX5GH1NflUS6fazaVx8Ql5jcERhm/hYjZaJgRUABfsSGgkyjPJPwgMygBaCjC3KaKEMbWUvXBgT0A70xqRE6jbzbyRn4WH5maYoGalVpNl9TDEhoFLN1avdaxFCkhWbUK786tJf0kfcvILnjf3cODy/uHUT0VX7CjECu36pc37PKoZQJQXGUqYJE28N2zg+6vtqTOnTpwDAvaiGphBldff8OwtN/cpUxNjAyHI/IWan84VIK81kjLzqUUKi/bRyoXDuD9EXQO58IDAEUOTLMmn3244QX1oo4YYIFGSHbKH4MRJEUjoyNsRM4uJ1yb6EalG1onRSKFdnlufdhN1H58XtxwCRVagC+xhiL29ZOajneklpv8oFcHU8nhBOp6Wc99zEYG+KVOiDYqjyVwFHo5Va8yGdOQBHoAdZTcx085Zrm5DXwSe75BAw+ah9f6dw4Y/TvhqsHbTgyzmkS2Zzd48NT+4fBM/+DhowPDfOPy4TyzDtLFzuNlvG89Fp42Fzzv6fSUtYBs9jZSqVENwYtKUE/kwj3EottTymKCQoC68/YE4V6AaTCtw70zp/wcuLAf7J25HUDzPmSv7UPUaB/hWvvgM0zMafbhqt6Psnv7Rwvhfj8THgZodBQqdGL0fDhAaQZIz9EAxA0AzXYaIdoZTHUGk52htwnOaB/p0+AJt0/dGdtXr1YB5M/IYvwMCvDiEy/8w5O5QvuVwqv9AC/2kzTMPoSt+8vwR4qvDqDqCpzB0IDDqLnvAHWB9OIMJoMlB8iw3QHSaHAA5e0OymtJByH6ICtPPqjuCB3y0ZwiNQlNWSs9VpDjIZZWPlQeqI+Ce7oc8kgEuDIOGwXnh0nPBTxL8Cd1nR+W2isOa+0VhyEygKEOjwJ5czQ/Cj/AAo6iQO9RvPV8zA+PlbP4Q1UTx+pk5VHmF56QerQS4TFUXEf2AamnE6GuMfig3VM4k477U3xFFsozuRALSeZE5gj7cYSR1oApdaIUnlAqzE8Q3Kab/pimihMcOh39da4L8rcCOy9dwyA8iVoX9tDl9ZNpvv19Ul7JPqmUVpzUSitOsuavU+l84POInQKy7QSSbad8nAinSCOxWgOnfNJic4ql8+XkZHHXAejXgfE0Kh/EJ93U5mkLXQI1HGA9EAM1vwJOGR1CCQZIAwSSWDjOA4BQH8W79afxRvZpEs+FkT9dncEfzUeaK+hAt52h7uWxprGUa+EMXfY+Q4rBbsfr3tCwszjvzmK2Z0n49Cwe4GCCs3kyOkjND6CXz+JWRF3wKH2FujtFSrpSQ0PndvbtWrV894qVy3ALGUEVQwSvpD47YxZvbU9vP+4gD2ezePMakDhyL7ez7djV4c7VUv/B6mFMsWxXQr4htUYtsAGgLU7cyHaTR+8Nr5Xm7dhi9G0H9h1h63No1+Tw8TMHwn1n9qPZ54OHjx/Yr56c5AAa2j245zCZtdOm7eBJdr4PH0QTd6cPhMcGDlGi48q8+AE2T6cM2Em7dWisDkpi69xkq4633lMphuJ0xTx9HNYuXl6E2RpRu9ZlWflhgK/wAwL4SncnZ3mjhPPh6TB6iR8VROxcGa7cFartHkfqYCpiDZEV2e7atQstACEKsexuQi+SqZVoErF7Wb8xE8zmgTnra1JDXTvUIO8YYiMeO3awMbyHphrMvN1Kdt5I0VQ81WcqnS7g1Qsgs9F8KMZv27T5nvcrNdSolmDjhjCHCgJRVeCWTYQlrFVKA/AqPd749fN4yfkuo/UJ0cyRwaA+PJTKG72aeJ5CVz0ytbvCLKlRH0ph5tn8JGrqxA+gq/0Ld/VLdUcqD6xEoYzCb76VcKxmBQr2GwRdXH/S47lxQ0K/sb9BQgjQzbCIpzT+WD84aWQdkb7ZciXDF7FkPaEOVZ9tlVb92lBqMJcfNm2r+kXKNQSgN1ioDgNYQkU2VY4MLtBdCsCirSr1o3YJnCyljKoTFKOzhPeIzELroYdQzQJWmCyV0gCMIdBCskbqvdu2bfs97Vp/eGmGGItSgwgC95F8LhypyS0BL9NTXIkFUiEK6JK0NA9WwCvHWo0Wq5+i7Mb8GqKg8oYP3exJKJM6Rq+vUsWEWj6kZVVbnW9FTjfWh4SsOsQLGrVxzFEQi3BKdT2+P8LlsGYOVsZBaq+UEV7U/De0YnBoatnyFStXrV4DkHVtqhfgav9ugK93hneTJpkvWvBgCOfMCCx4rWhXhxtt/VkvIqCB4k1QZjTP+/3DKuPKyTkyRjuEqEcxR89SGjfr3nkL48ykzuJBBjUPm9ei0AzqMZba7TDQi7pftX5PqSJ6aG8SNx80Y45qIW01gcvIQ/obD0q9gxhGWgeVvNDZeLpSQOwH74DBE20S7WQdgLuGw530WLOLTAYh1Nl6Txx1UEvt90oPDgMUVgSAix/P9o1Rl4DCSqE1faq0J2FcPyr/Ag8+dI1DmaxKzAKpuYW/IUW3ZMnbpAbf/MlHr6yTWKPgnG1nTZ6oMRAVecqOWMAdgWsUyVao1RUVI7UW/m/qiq9jP0gtWUCW/e9q3CWlblmOs33FIKopmT7tLuan80j183TH6hqtefzuSiuKFViX6upVHXpFHxxOXWEn9PGEjRiHIinsACsIUOk22fA5U1wN5Lmn01Jb/5s8I7RC6qG1FzdeIj2nV7rkB5GH1Mea1Tdt/Z7kJyBhtpfv9e7Njx1GHcdMrEHoTN4KAmklKaT9J44pH2ACt+OlvYOoTXrjBk5KAfXdwWr5Lr/E/sOoT1l7VXLwbmPfiVE8WMQtQdKLgFEBHRieGbhdFngmb7I4kzd5oH+b5QViuAiwgGJ4h/8nie7QCYm1bagl1aB/G9A6tZc0Lja5t8wxJ0Np2yxsWG62OmzSX6ZtjeGxLNPE1ukkKbzOyj0rqq8QhT2qljZAM+W4lc/VSF04mid1lqOSC0RKWqXCcNb9rbdf0mWt9mBpPacMedaUWjSjgZE3aKWAe6Y4yvdD6T6UmfWkcZArNGxt+Umcqtp4qjQYElVhPYcC69CmvRJmVaNmYaBscBmEg329/Tt3JYcjSp3X9uwYZtX5szGbLmPelBTqnpMMfFs93yektrVqemyExQdz1XKpNoKWt7QtyBEUoWYbbiMk+s4qSxFdRhUliHc2JJkdR0lhZo1Mlat09bESGBMzQRrnmUwkA0VUPYmEkz8tX+gvR2THUzNIBXnPDamu3QnZvqGutYDWsSGRTdsv4RtN2uFxtLrbZzAqbD5pG2C1ftRGJGzKpNAjT7dO0tJSH1cYz0+4cla1iPzAMTP9uwb7N1dCKDw4YswZkGXcnQS2tZbFj/BQjOZrZOPL1qMftSwiPdgMrQo4H5BCS0mm8E0wWPVSa6e2YawYgGgZBzXMlEn5BjOqFMkBYAHvGzeok2eKIo+n/6SAU94lVm2Xt3F/EDeGAsJ0pszOOCudg/Wq9DvmS+TAC5hJ5Gwgd1zZVeHHHqSo2VdSvn0o21f1D0yz6rGz2Ev8RkXJ4FHUyMbeY0DYSh+WTL4TVekZQDpU+YECZd+j0EgP8oslNZ8mTWF4RRSaQ4dXR/H6YmnsDr9K0RBzouTvzddk4HQ1nS+Y91KFM+r2wiceCOZLUjMlKwDOliFQyU6Tsw8lTH3yHqS7lxXUCAaOeTFDL4Aexd8G5BCgZQaqgOJSIHQ+WK5O4dSg6/eyznvzNclAyBXTOPszuAYwqxwfMfFDlsUBKk2yPUIWHtzLFi7xurs/gCQ9XT0M5alpoTyGvw0ovjy4IblpeJpcw2XITyMljBJU1SLZmjSmE1DN5Ybp9VsYiKsQqqIo6lBdhzZNbwvsgHyDsjm1akjiwZD76fLB9VvCKnRAGqVf/FyBtV9y80k1dMDjJwU9CA5V1XOEhEqraB3L2NrJ56BLc9J3iqUgWHkH/cbDoFgu18YD5L9KpgdudHsCqU3Cr6j1thctH+K2h/pzcSFIo5X78wCYAjpSlDGH0qgONBqSi0JF0tSX/uP14lG0YhbYEXwSayIGqI06hoPR0F48fonENBQaiaQSom8OVU2lOCaaiJahDIys10lHNthettGjIzaad5n6qB8JNCSl3c3OTEXMmS6Sm4maM20RIHCeZ0nWLmC+eDnidhtV1BypZlVQvcC2s/pV5rECyldHEx5ov6MUXUAmzOvEhOtWWC8jHeS3k36GV66G9nKyMtC/GXUM496mzKKSTVS9rd3EGwKZr5F4O+BGaIQJP75pLm2vPRKf60mi+bXB6UcNG1v0w92D+TozqJYNrq2cRFRfnlgenCO1ZDhZEY0cpu7B3DgeV+tselKApymzUsjjwiy60awSoWqUPJK4mzC7K0h8KyZuTBRNch1b/8BI7AgZu1TGcst19Bqi9s6Fd4dDZBAtTITqWH7nznDXrnAZopJk0LojtQo7bBWTRj30YXdfmETLcfBL9YUr+9CsVLgKHmEf2ktBcykJMtxE2O3OXX3LhhN9mEvfLiY4V2A2fX1ofw6SK5MrlBrKwa8LxEojzvNg98phQoaRXhuaSiS4bmTnKElnKuRFS0bLhlIJLLkpldxFdscHd0t0t2fHzl29V2jGZPOWX6NBjs3rd6eQ0EXx2ok8KThjlUkwv6EiQPSGO8lo0+wEu0iMYcvGDZDB/J8rJB9yGVrPn2zesNJYW5nF4ixowyttqXN93WFf9wrqYtITfmPqXFcfoKjn2HQ54s/rU0XMcyMM/2r8l1jbTYT5ehxVIImyPbfQmwR2ETQEvkFfwiTqeTgmuMz7jtS51au7Q/itoGHuWn1xQ8/mS1gSFI+lb1qaOpe8uKnnElTGNhm2N3V4YO/xW3Dgtm8d3LZ9ePCW5HA/swmy7L+4HSZMdnqY7QidPHZ4f3jq4L7ELd2wkKSe6cGhQSxqGE1ksY8OEkdGCFh1j4yQxZ+hi0B94dtL8GQdzReHLlLE0CUixs4tJ4FSQAlS+SLanrv74kZoB59KhQ3WztYoo4khLCd2zoVsMF6tYjQeB43f3AWjgnYU0dxPiGYUw2Q4uGZ5745l4bBc6suW4TDtSA11DbG1GnoMnlsDTaKFlkCzOGhMDQPwVq6VBM2KBA09n42tnW2D5ZJknwAuD7891bFwTyZTB3RpJtxLJyn7yyxeoMiKw7nwWLqUr5Ahb3WsfxxPkNA5ivdEjqPNCnWUzbTFaSJXzqL0FZ8S89ZwPevCvrMbtpVUD9ksYZpqMb8YwVRVf8yfxpgVpHdeW6pcagubnNYHkKOKP9Y3lIUe3IuetQiJetcNjpZpcpLMS1afYsDw8FOdgcxHwp/v50PrZyApvjbcEfahgaZzCFV7+1DLOIPknTSYu8LeXTicZItqZzLcvXt3iH8AiXeHfQBP+/rwFyJUhUGHmZpKdq8E6GZZ++yT9j7huXNwJ8Dk/nDXID0GV4Xn7sa5HGBd5IRIqRmRgoYTkF2TCH+p1zSxUraLk+aG1K23Ght9t+JEkvY4HwbTeeVQlw2tEyuYTN+y7iGpc/ButnHAQ/PZGF0ZsQFleZW9Jvmj/DdvG1Sg8dbhhLZmgBbU1aHwSlogifBK88U1wvvM9iUAAaBnAJIa61Y3pZYv60chhaH6xnXr1sGXOD+V9eNr6UQDpzRyBqTZ0aXKkCHyXoeyI8NraM6aaHBMNBpbQEYbBlS2FxT/T3EPjNW9qL09beoTbeIgwRI1Q2oM0Um+HFkKIdXQmvbnBbXx8uKC0SUixTrQ4C42cUQhjMi2RWuYeeTD8zLRds+UvTPS0b/y7nOrwv5eGI21sFMQNF7Mhj4RP5C8sHvHDLZu/jViBlvWXwfrgGxF3rp6OERnBY7+lRrw2rLh12jAa8vGJgC1KRwnstW5n8wuoswb8YhPAl1yCq/2VPdLCxwJSr1ty6bm1OAKibgNrSArb8u7aVDv7jsHcHdwaGotbICceHNLarBnbcicTpNs9zDvqADqe8PBFb39a3sozZcg6mDvYJKz6JceKKGHofnuweRyWn948jzVvXZ4aO0aGJWQTqNxyCASBiK5fM3au88BfUHBvqEBljVd0QeBbsJo1/StCefLr7sxL8hKZbnmslnCuoD/2HRNM23bsnU1Cb5CAxPzdRZ11ZZO6Nfei5dUX3wd+uJRB9H28m94d1zqfdTBhj7ZtoPGHnsDia5uie8NqqZCz+AsSOmpZH27fUEKPmL5ZjIyC1NoH30dQjzKkgz2XpQGg7dtXRdPLSPIu4wxwRUGxG7buv4EYxvQyeGV1Af9kBZeydyQ1jRV27oBZjuMoBRQuGR9Ekm2sZWSrRhmk+U6XbShWzddjxNnNaEGKEc4NAroNEGeJYTo3Xor4nkKw1vL+NC8NjYtGV+EztelVg2OZsbLdblFDRMmnSJ56wZJa9hQwHMSGetphvtaKO6eLzpzCPpWKiGfbe1BEIZcNBQL3IM3JLSQL21qe1EaFKV9b0cpGBbnbRT2PchHaZhq3yE6qtNCugXY9RpFdeXBmxbZZU/tGOlDQ2FTS27XltdFK9502DRVOo0CyXPJ6pKQri/tESn53Ixf4TBK6h6QpuwYWY3I7VoCu/hDAczDeN9BiemeOH2iUTA3KpDbpeWr0CoziWxKM8b9LJBrxHAZV0cB2nxBC8mqQ7wTAyQBasu5Xka+VfbnyVqVhVy7pKAnFDq3gCuTA8RVhbRlNEQ9gHYupHwrnhQORORa8UppVLiV5VpRmpWQldPYEpZnLRMBQOKsZ0aJtXtmzp6BQhtEWCENnvugeCrLsbIIK17lwLad5VIlWnMutZPR711krpWsyw4BASAvPViS7JDVPjpQORzs6ScJaBJeLkN/Q6Ywx01aIwzbnhoEBKeXJZluSUl0A7AA9BmqDjCOFC32nQD6GfnpH+Ld+14Ro+3rt1+bakAR8EOgcHcuC3etCAclhATCXWJPWDPYggCN2Llr9a20Kf0acautW9tT53bT2Wk3GYnCPYgNjknLn3QKkizwqbMM0EVEdcs0EfYSZKUM2lLG3w5UnfViueU/RwaBV9COAZhdYjDIQyhf0JvGAmYDAKRkzI8HDlPCJJkamt6zLjk0fRDl44gFwIyzbVu3rZidPpKcyIb1qS7oMiaNuhrMquJX6xFJVHQ98VV6Ul19l82WkfIVkkkzGN695tyK4X6Uhz2UkkMGQ4ro61UVjcNFaOTW7bCZDWVL1H/NJHIInq3QeYwY86azhpJIfBaiEBFlooLMRie4l7atu1V9h9TGJFoqyGYTJhGeoS9M7UJK+m6iJaCoPNJfPOblKtkTJvx4GVQ+MZxISKpvKIC1G3Tr+EZ60DI73G1XSmUMlVvfHRUHZHtiNWlWoWod9ReQAzaHpHpL6ly9WsB1hhNNUsg9p4k1dAW2dEmifa40q3Wa1ZgjlIFiBbR0tPmxFpQz6MGxeVyKlxW1f8fFoQAHn/sGuia8H+uSIMGFHaHs0IvECd62bRMyo6CSNAT3Y3Gh5AVgRFeCWjWkgGliKMFwZduGp9MwXrwEUwLmND3pw4uXdgDssufJxeH7uTt0R/B0X08Xs+6v7HE5PoKnaBQGIMBl0IBHO+bFfDBjDa2zk3NldZUZcXt7eeEuTi1jvgRsw8o+IIFY3l+HKTH1zEPR1KbkQlzc2LPtEiUn218997wvHouuwz2FfMbfi8br98CWf6Hun0UjlOGeC/U0OcV0FbeFPXfhHZm9fn4M3HyABkn3FlCSCtxSZtzP7ikUy7CkKSd0bs+XUbBibxXt0O6F+TpzFq0g7Etn/RolwgtjtaqPN2b3jZczLGGyr4yGIMEt5QrlKb/KKSEY5AsT4b5qvoinzvtmAAfen65O0Gv06JhDpHfoFJREoepg2h+ekX5U+YC+I+PpiTz5jgGZXqqlyX+ikJ/0TaITbCqSvRlUVITeUz4/B9LYXPb6afPVALZC14pCdh1O16sX6mUUcsOQ7KL9vl85iYq90TMwMcOf54v6w3J2TPbEwXzV31vNQ7cDKg89xWN1kFTucCUO1jPjQT4dHkrnS8Eo6tE5NF4OapwQOyc0PaQK4C/JfbSPSsLC28olf2a/j54aVe1wCYUFsPXoGyuHhydRfp978mh6klgd2gN1DcYhNFXirI8CklvaN44KsSGAwgHUGvLxiLMXB5F8uo6yPhwpqysDlDF6qYLkk6PCfjUsHJLdygF7WDim5vsFk0CXWvTJURmVwFVT5li6WoayjpGtaFwox3ihcATlxV45ezhwsl5FeQIO6CrKoJ47MoyqT8bsFGb6cJgnEI7KsXy2pPv1WL5U2wcUYhF8QW3mFB6LHytnMiRtdDw9mT5f5vkA/pnwRCF7FGUVaf6zux/1vskFwA8sQzbkZLrgmzlEIaoi+kwFMWSqdzJdSc+kodBKeBKvYpys54Ak9qv1kAbvZKFeDE+Wp7JymsteOuWP+lBrHcqG0JQZhiinyjNpHrGBdBZoJ46VE2AAkAuZTvcxeAbIpsxA3i+V0vAooBkhNTFM50dmx0AJ5oE9EGamnIbJehqtUp9G629QwdNl1PgN1BWKIqSRbA5Nf8i1fnYc7WJz75M7UCxP+KGccPygghpEH+X1ufGgEFbHRhOEpQ1lL67vIangHhNa2T9HeCgxtDeMZJC+yhx6mGu6LlzXTyyRcH1C5ksHrts2LkkhtsB7znrYczB6GeKWkn+yMmyQo04wq1fuRWuVwOhcV6zlCTvtp1JoAvZK6VM4Wp4xdGR/7+glTA0z37lsaHDf/j2n9xhCj7DmYab18oRIbEYiUqfTWCem4dYhb5E/Jgxss5/q2kmm0/kEGttnZcB4FFBxQ8O4rw8jiUaZhUSjNlaI0Ly+nUMpynEXVoowra2PSXXtRkS5OmbMyfLVKMVASsgrIBclBgZF2l56rhm6lMBf99AlkoC3aJ0VFrqxVhE7oTyI2rb9Zug/rKWdbAjZrfwaaSfZBMJUhulDZf8veR7gDFuH6tm+bhtQOX2SZH7ur6ZZ1O/zNqy3jwg1ZDkODUfbua0J6Fmo18tlvepj0gQGscl8yZKyZLx9FDkp55b1h6gnidAWNgzPctr3qfaDWhwWhXRkAFBJ7uotWpSUJBvRNAXx4PKk3LWcmyVOzkdSd6hDMJSxwybkSHGybghzuoy0OjYgwWfCtNoHL46sYEldg5VCtyWkqBMmt1MPXVyjXl+X6tuFi3ctHqbjQdWaYTqoQ8ZN385deD9Zzoad0OsMGej87wo7jfpl+7pNQPsNDtVu4SPpNcQASQwNrF2zAgUH5pmKx6FEf5qE0TTZxnTubkO+YFy3df1ijbp7sXtoKqRjXp4929f3Ii9J1yGF8ulDLH0+tAZhJNQ+wS0c5L4EshJGBwUbmvGmNktaaPCSCQI0Yq+C4zVIaL0OJsewG1UQTVagFfeea0wcKYe7EP0KggtT5+4M7wT6Vp5BXw809Apk3F9qOGfeFBWdATL8XGp4Dkl6I0azbfuGxXjwS1eMVeTn6biaJiABNrzAaI6O+5mZARMkWENmvq13MO9D6AYrRZe+8QmIbhn2bTymyMCkh42a4gewBFwLuSrO5gR2fOLOLuumM7Z1vrkVmVrEroHExLC5E6DznXxUun3jY2WLcExCVa98qYQ3D+t43/C208eOYpW7+/t+FRXYNCIrAJPgV5H/5gkzZGpihcXsr6QztzzRlDV2oRDKSWuNuT8NewGK/NZQD8WvpBJbdYdeKPwq8t/WAgBviGSpruW9dOgcLBul6LFnqeGX2guwI5VMmURfSEm+TBIZMuC37vmiep26FdwEQaie0UcAlVs3uC65dfjiuh5UxbN+w8ZhDkMoIwHScLg2kUg+IKVAT2xft24F4opTQRaLqkjgjkA9b8s2bZ0t7jI0hJyoQcWnGrY5VNDLBcx8/c2EiA5JMclzK7rX9Id43M5qIXtWo0jSFRS/PIXdsCzSlsTgekA4zQnojZBmgq7urR7u3mXit6/b8NDU4IpzVL89e0cP3XHXsHU0eS71q+thugHVtTNEYUOqFoowwJPgtZYJG04R83AIobCuPx42kG91OLirdzjc2Y+arMLBfLZYCurTZ+jkPGkFE/29qGgpOnmh7YtTKE5nRyZoDsNI4OphDL+HTlhhAQ32d1tSvx0p5EqrjqRTgpR9QpOinXRNFNVk0bft6zYiXzgFe+8KOqU4x3jFCpKNOceCQ7yN8V3TxunF0lRXvOx5vm1ps0iDk6n7DYLgIdS6rWdVLXsuDkvFVIkuFJSZ/6RhQ+SkYYPmIRYLlqaujal7yaXxqASqc1RdS47ixfa9SL6/U85ZSGbJn6K7uyipAT3NxMP27TlGMlbMxR4dWRHBOOdG6yV7FBVe2Lc4oYW1MuGxfBF4P14ElgMdoQrwnI2PNbBNUshrJu8X5H43pJR+KXIuoghniJ6QJyzlIal6pxsmZ3YsX5ypB7hMt14KzeeDke/Dq4jFstTvCsqcjAbx8If2VEuA0cgvKoFFiF8RUo49a3f0XkoQZE0xjkvzcNOXYexxU04s79eD1EgZXHacgjWDfb3DjDLRpVx9l3lUwUUWT573YCm8+oJJ88GuhH23MKlh4PZ1mz+W+s1sjtlKoBFPSXWpII10933IuF8d/Mkl2DXvqZ9uQuSYD8mq05dd0fMceMzZtX27mDEDmR4yB5pXWy+ZEedzz3ckHECNKUF4TupJQDunfEN8Kp2PXjQl6RlLatRIjJJ1SBQf0VdO6eZ4mC2rS6f1olKOo6BkToqykKBptVw090/H0EZXLgJGjfTpXAAVuYhk7Z6ulufoph/eUlWXVyta+KTCytW0Ap1aVIhV3Wcl1gUbIkYLwgA7yznrljeKueIFb20ztzYu4ST2f3QALd7SVUw/ArddRCoP/xIT0RwNwoD/WOupIpmnLq2OqYs0tpHaAMxdqVyK6BFI9Ev5q1naErQAllaFQDoNWeWgEf4v1QrhIwZOHMfSUIqFQMOxdAWleBLhMdQUfpwtMkjpIqX6AJ7TqPqOb2Se8scOTBuJHr5/f9YfxUuTxdECqzqI4qz6ghmyj6haDWluUjLUMuEI9Gx2uj/BotQ/xT2eJ6BWq3JfIGSvYRkT6yQd3CfAZHN+EqQR7X7JSs6YUVyJqHmEp8wktp3XrVEpI9tyHwvVEhqqKLsWstiUllRX8EQp1kI4wWNBA83sup6iTB+BWASsNICSgMgGOvmchgNq2asVz+ualzRNFsinWi4k8QC2Z5ElW49PlMwY1cCBYgFU3yBxLGgVdhzVB94hAvZ5Ic+b1w5LhiAt91EFfZE1qc/1GRprrpu1lQ51hdHORUbjHGD7fgbYhgF4kQpU8NswPVffylXRAB0ZGj4pKkuYVMuH5qj9AwP271eQz4Na++WxwS4642H8qVIpzJA6ClLPQjOoH090ChE8J/tLIGtXUhouxs3fUOdRK4g2iuiBXDc4uneYtDt2oVI+UvO4ptQP8eUTTIzLF+iTb/AKLukCphsh9NoEKQ1TwyN4zLWmZFSkcATVuyEOZcJDdSlXRnVFtVLaafm8bQWLVd0xFzl5H/uUSEpDUS5m3SwW46oz1bfLCg6nkkm+GYs85b7+sG9XuGpVH2u7RDnRZX3DfXTdlpVekqpLvOmyKjy3rI+vwLD6l6H+Ibry1T+0FtLcTXqy9/0yU5Ih8eaeuTBYZhtE4oiGHWQwnC1n+AQL/Kx2UBrkSAxI7SFaU0opPZkfIw27FWk7BHVdsDp0AryaNLkF8kYYVkbVlQQakbETuffHekN3dCV61vZexVkn7DfXp+yEIb/FY87LH4JuX7fdPgSFjMbwEJROVe7fU1DKUh2Dbl+/7ubL1It0zp7DS0B06EQ+eeGHq7l+/XroGYIBdMkIlwMyPoDIH7DOLjfweUYQ4OnuwlSf1dD1G1gqjITbsI10mqGU6nVd2U0i7vz1G5EpBa/7+CD5ymsWPcFanDrXJ3X+kO22oGdBCsqnG7mRqm+656Fy+9W1Z83Oo7jVjBbq1VAqiskU8qQVq6g0EUEqFPRm1ZpsnCARZkcLnJCMxIVkbqwLz0DwAATA0oQ/Q2tiqgSfJEjZKpsrVLFoWLsKe1l6Eo8fwUEjC6jrhNKjpSEy0YMaUJTJF6lgpFCuyaoG9dFiHjU5UPZT475fSNy34djcCh15a3grcgj3p5BBtwyQkC55dmtQtZA8CeND7p9hP05fqPvVGZQZz6WQ22IkgRUf8KpytvhvxHtruPa2ff2W5hRdQyNxdDnbe4e7e1kdVmT2b33lZW/IdUcux/2K6452CawbdNvXb3t4ahXxuO9ikZEdqHIfwFs2CdMEdtyepalVy6f7bakSTIJs965eBQh6hxLWoeNyi6+5HoqX1VFnBOv5QsBQ1/K13f3LkUvNSs2Q7bwCpS97qd9eLGVNpJxyhmxGIfO7XE3CfMTrLJZKOcCRsiHaJYL1kqbbFFa6HNoqQq3sGB3k0drKGERL8aBK1c/42Vlv6VuYrb29Cfu46LFcrV7U78dq3xCHCUjv7S1IP+QnQ/8CoLB4pyaElTIG6GSWTNAyQnmLwijJxBTggKgNjiyZAmqJ2unqJbqoiGf6K2RJdgXu+bhC5k0dEIfHliOFmgaYAlh4sl7Nh3S9JF2dSbJogWSqBDWsaAY6hfdEzbrlQGUmqaURAi3lYNB2XRLj7cVKbeYWxLfpJBhQfgAsARDY2r4MajKaIZweDVvMUvxlo9ysya+QniZMGy2GzRKPKJWTKh14lV00qd4Pui/r4yS5ZRRKRLVpNM4qkcLGodlBLo9mnTLjfjEdBuUimYHCq1Os248eFam9uAwIOrQNOw2xdIm/ozIaKIww9UIeQXOocAdUxYboB8JF6DoGTbNGtOfhWr69t5d9WrqaUOFVqS6fCRPJu29IC3nU0mN4aU4vhHkTGhVw91zvzJo/lkZfWsKhxqhkBZCyySBOVRpL5q3ZgkqAwukAWTwHjp8+fPrwgYGQPI8OD++Hv1MHDg70h8f30aW148dOnzhy4DhGnDi95/ThE8fJckL4SHLTpZk9pOqMbnZBSD3PnDpMM3rLpr1sbDaqXjEtndMoJ5pNz+BTXffF2Ut2LqQSxqyKZz1EY/vTM+HYMSBRx+WDIh7tA+lFLr8a96dlyfkS65lEOlbtPKzKsYTX8PKTvjJEUCqXjs+OOkn7uh0lVY1lJXup0pBAKn2UhpOwhbXyBMxJpfUR+p1uHJK5EMv2Qb1EclDwmvsUVsGMao++Cz17Ri5LNZhX6YreucQ5OdiNdMNuZiT0oyYJ1Lcz2LdTK3ygLRCl4pNGHB6QZXktvmdHb0peGm24XSLtI5Bgk9aJIM9fIhfAVsnbDzvo/EWSUHyFf5CkGFn6/2Esmm/HIzxnxKMpNYS7TCsi8Wzl5wZSWjmYWjaMdYAVkDQaaoZSFzdcoqqtVoI5u4cTmf45rTbQec0m2AT5eKiL7ehk+vlwc62816wt+AxtWEtCZjN4Z09L/TRYfhgcqu/ftg5on/r+gwf5rJrODNeG04N8Pj2U5RNswA1MxPqeLZeQbbeasocW7t3NaAiJ+xhQc1weK0oujmTaIEJHaojxNvUoHdLJb5XEWa9mzBCXYmiUTyJOpKy08jyBUyJGSzsB8U5Yty/rZUD+j9QLIXdApYehp+een7bGtEZkyZJe1q9zHEIjDBXm3iZ38YkfSxrSed0apT4EhcEkKxG1b1Lr5zsZgpe0L9JZxZpJvBhBDQzpa0An7vKrZWgvHQgxk0BVQR46jRJ+DjOCtYNZBh3092SfAa0BVCUEpGuY6aA454kIIA8FzWaEbRfBwSwuG7LJLYZatSqjiFaw+GswAlILJ+7BJbp1CM6EtHkJOy6MTobsjUtj5EE9QDupkvlVhT8qh8cxlG1HxhcZDShaGjyzyOTJZLQOT5mRYoT5ZF0OpSelzQCAtLaCW6yOZT0grOM2ZDACZpTx+GhdIInIVEVw9uAY/DrHIEGLMOh+cBh+vcOgj+rUCFwOCBJbdrBvR09iWB2VPwh4H5xtDwLe36AxeBDw/v8xDFcPeJUcxYb19zwe7wtz9INg+MG59yAY/o0bgwfB8P8fw3D1YHiHgsLv0HZeuAfZHMNIvZ8O32rMB0SHPAEz4jIjGJLsx8wICXSoEUMbetIsTAmSom1BrQBq/YZtiRAVbHdF9EJBNFsVRNYh9ynNE238RQnt31PVxgYfnGcPzDyTOoLn5K/VpF5SNkwariuzgAqq9dXMOma7mnCDangrYaJ/tj1UY/ywW9kxXzqnMvue46g5im6BsNbScDDZN7yLsAMpGoIKTlGOgFWfJrvXDK+UYiDnVoU7dy3rG06gYEg/KfVdnBpc29uzQ171Yc5uMpnU8tDy0CQBcXT7FFYYXxofGU4sJ7Yk8mmn1vQmupaHuUJ6LKBWDfWz3Ps8OsS7rCuQM6ToilP1UjLkImN0MtXV28V5ZvnKPNrzSnTJuzpYCdTr2s2ZtCuBjmFWA9Xbx+1bLrueLrrzNbIhZc1v7ZrEDvr4FW58IR3rldKFZFAfDfyaiMWamHUvHtvRZl3FEY/raMuWM9gvyVp6TDy+w8O5JZ7Q0bxA8pzFpY4mmN+F8pi4u2OBTCxELE6CD+K9HU0siSCu7Yxn0DiouK7TxbxGOpr44Nbp6kx0tqj8nIHO052qNt/raDVyLOL7HQsk1BBObIE8XBHHOpvVCIqvtjfxzSDxpPZmdRApLrZH2rSws1VX3tUN92IL2ZdU17RFPNbmlwuKuS6aYrr4BTFVzgetcpp1FjqqJdZJ5yA6xmmNtcUi1WmPiUi4I2aq98kWVb3OWJw0a4iFsWZpA6cgFsVaq37Fr5EIhlgcayW4wKFrYi0ZgELJah1GYUnMo+e1MVPb66LVWBpbfIMx3oR3H+y3n+mIjE/zeDoYH4X6iM92LFT9lZRVvV53gxL3Et/tcKeLBXFDbM6Bdb7f8YOOOF3LEj/sWDzr8oW4q7WZYHkauuSnZhLcOPckuNiqBqep0zT3obGGSeBeqytuv/h0R0ekG8RDdKW/3bHof10vmLn20QWqWg9Ts9u5KXZzrEUfuoovtOtSH25K/ZK1BG6J5r8s5sG+VBW3xpp1M5bHFugyV+iueHlr5MOVMXvhr4qZdq22pnCXWZEJa9WE7SrXrzabD9foxE53rEcv4GSkIbqWayMVSFmFros2cX3MlStzY6yJb42KTdEkb2h3FmRY1bPYEn31sQ7H1HBb9N2G1nbdpK/qwdkQW4hdms7AHE1SFcXmWFOac9gaoy8AcxLbY63pUqlc47x6Y/FCetQviB2my3ba8MLpi+2KmfnVbzV4d7Raexrg1dJOJxI+1KaqelvMXcjmHfKTfpJsSIt9sRsaopKkzQMNe4n90ZIOxIQZkMPWtNnRvshkwviZ2BubVdZBO4o2V3EoZipn5y3X3SOsWXSHmQ1Oa0ubhsTtLa35LO5caG1RdLaY8VvYovv2iJlVi1vUVLumxXTq0WhTr2tx9Leno69OxNrn2Rvd4EJBHIuM83F72ronY4+MnYotgPQo0C4GYlYZptpPbLdWgKrrGWsC3B6t0FlTIfEo3Z+P1ivqjlgLipGTOIYYBDA4E0AgqcsbsubZsFWPc7FFxXIpnc1nzP45AkM4E426ExocoFAB5Z+O1m005mZzJZExk8Xd0/HZ9qyu5o/0aPimhU4uNmb6Zjyy9PPRAs5bjQ/bmzVsn9AlFGL2/Cha06yky4iXY5XYhVg1FljtP9JpjYOEKY9UUNytxeqxSWtQpqL1mo41ywo4480fb2ewmzdY2vnm1mI6Uy3zVjPRXGhu0WtDFJs7zULBTU2UmiO5l5tbgTyqsqyymIktsvJVRcUpf/H3QnXEx9vtfgyaFxEaCQ0oZQpJ1DIn/kEskS2ORP+juFZNkEj8N8W1ele04/9J6LH7jjBzq968CEFLoeAXkur9ZLM979VUeFWr6dfp5oYd8oHr17ti1mbw6vYFY37Jr+YzIow9ZP7+vhhrYtEz8STABtNTCv94csyMQxvJ2cFg1ANfPN2e3t4zYs+MPSv27NgiWZhZppdiv8IBu7Yx62SmUhF3m0X41Nh9Gchup505GEnUX1kSH3bMwL6gEfWx0aYHbIwfE3PVuDzOWs2H2iLffKBj7pnw+MutvCdewUy4sqF/ynzj8JvZ50/4ZXvtl+4hGxA+LXbf+mvuGfGc2DXzt+2xvyrY8FzT/OdZzX9+7P6cIAukWWLxwlhct/HdTarqLzJ1eLHGPd4RXUe1FguDfIm1dW92VDYvlSTKy2KdUhg2yVLe4uUGh3tpmzX7XhFrsyRLxSutHb7WpreUWDOglPkA0dpXWwv9NdEGv7tNtPmlyXy1zOjM62KewTrfEHujbtjuZpPHm6J5vDkmvFFcBO+KCclSEb8TEwtzeehylIJG9gt89u7YIlPT34rpvnhLrENDaVptb429DaLKVSmYDs0Wb4+1MdKVLPi5mnhHrMVg7e9Usyn+3tj7Yu+P/W7s92KRRv2+NS0+bEbtD2N6hP/IdPUfx2ZV/E+s/vtItO0f1R30sZhrUv12IwEWqc97Yp7qsEj8681Ieh+IfTD2B7EPxUyHLl4QjPtE7b/2ge27WXV6QHoTaOhMugAL409jFt3lQnHi4zFrNXwi1oxCzchwF580BX8q5iEvXPyZBjWf1pl/JkYMwD+PtWgV1eKz0Zp8LhYlKv8i1k721ZPFNFogEJ+POa0kBp8kluKXol/n2qIk6ldiTjunHvfTWfj8rxrTuwtNbslqeSoQX47JAoi6/EtAhqwMMIn465jbmilnFbX59VgHhZS4tfibaCHfaKCb/64h/A8wgfXy/Gfdbf8SzeVbMc+tVwviv2Me2pIU/xFrytfSBdgJfhJrp/KDUr5S8Wviv2KG6/Dv0Uy+PTsTLG3CF/95mUy+E83ku7iKGqswfz5xM+v+Labz/J4FPL8fo0r9QDf9h7qaV1KAqeiPohX9cWw2w/t/rprhHac5+5DO9qDiZ/KQE7LFnEeJN3utdGVhMl2o++JcNLcVnS36PoNY1XmdxTS/xp7Pcgp9IdZKngv1cs0XX4zFac6Jr8IWBW11vhb7W4jK12Br+PvYP8ac8ar4Zswr5BGjjnVATyWreJ4FOLUv/nWO+TF/36luns3I/6li5J8WipH/Bi/KyP9ZzGbkO82o8DSb9bMipknBb3dY0c7c0d7c0U1zRzfPHd1qRS+1dvsWzTMTP9dw6B49CZ7VLBlAv4i1ob5GhSgJ0ZoBbEiGXNFyXgfioqWYVYEFojW4oL9qES3BuAoAKGJ71pJ7JCQjrkMsKOShPumC6BQe9fVCESe1+2KRaKmgZdQMnkIsFoskYDf41zUiHtTHADgvEQ3oRJNEXq4VGhRfJ6KJHtYQfriwAM8yYdbprdF0yxu+W9kQXi2aWjWvOBA7Bc2qW0SHjsT5KVYINSNXCZ6jXdF8EiIeCd8sJDq7F75kZt8+0Vb1K4V0hplM+zXec0AsaKLVkxU3iTZm5Fd9DK7RM6PbwglfE8UXe6zW/6TdXthJ6CTd/TdGK/xQYbd7rYhuXTeY6kdfpMQCPPst12vObrFHLIq8XCfk4t8gFuEKj5xRbBGd+RLymPyshBzbhJ7s28VC0+EQUZ0RO0R0YBBy9InWCl5HpQN0sQtSZItleXbUL1qpTJ6pW6+q/xdjgqQ8dOfqHmwY0PVXleHSVoK4yE0LxNJozz9EdMhmy364XiyuALKF2irqY+MycqPokEtNRmwSbeXauAa7m6++ixkMi977v68jc+KX7vjrZvWPnlb3W0dF6/+Addv921FuB+lYqCmw3RU9j+putRkKN7Y7DYeEh6x9pzGrNVeX1W1WVt4iQLMBu08q1eeBOGyYnSdbbb7C+mgxG1q9php8Bvv7ptYlprtNTo8Q9udbop9vbV3aZt0sE290I4cQ10aPiiUn5w4xKJia3tmquDu7WvtbW7RAitjdupCQK6sL9rS2sTRMknbBva1LLRWNyXxpUqrEEPtaOxUnokgWBsX+1hbKjXCgIdEOecr7nwDAD7ZaR5fDdmObb2s93PqI1iOtR1uPtR5vPdFqdek8cgWN/HhxyuIZD7Qu5JvohrA7He3OM62zcdCj4mpx0HY+xX9Sx43KUpZGCfS4iuNmgrxMn9qLl3c0pWv09Qnel1/X0awyESd1Td7QYY403tRh0Wdv7jC98a5odd/d0fLAFOO0ayUKgJWJRwqJhy7udADqZAp1wACTHHVKRNMOCCfOG/ntkR3Euanz5k7HQtIf2mnv+mfFQyxS99HiwSVxfy4J1+rb0cZhGY6IB10h9SUuR301ddJuYsq8U8yZ642dt3ReOU3X3pYOKnpOHBEWiTcHOXVMaHKqFb+TJNWZeYmrEWF3Q2ML0iLShWYdfrLFejGm190PFiwoY2WzvsiI1nF/OimHLis6RunmuIqYEJ3ySrqKKQjD0fSjHV0Wc3FWP9ViOMM5EalPazWp8xoXuk75SJ3OX12dihbuXmqs30K9VCviAg97VfdKYBEENTEXx7UubL60ErGYtA4bp4Rmv00LRYTN2K2+y8Dli8KsozBa1UvCqsxjRZuu9ydb7maI+hhd78fZ2T9e2GvT5PEEU+wTddvOduj2nLLYpk+K1uXJwnz7asBT1BYjzzGiiZ8urN54pulw9ylioPObzc16f3qq6NQZMdL4DNUip+w+y2r+s02vP8fU5LlWOc+bgzZ+vmAAiOpDxAusXnnhXJjfi3SfvNiaPy+Jtu2lZhzEz7Vw0cuELXnxcrFE78XW+f8rhC0N8MoIyvUqq3vFHCcnzmvEayMEaaRSrxOttgCaruApXcHXC8nVeIM9wdt0oW+cq1DxJqvIN0f74beEkcG5WRdzLq4+nTJSaW+x8r7VEhBbHm3EW0WT/uSdemJ/UFgs8j+wKv9hPVpvXBDJ5/esfN59dflYpwbWfP8daKryv+9eM3Q+LN4/Z5a/KxqqaXL9wHy5SgbRh+61vn8o9LmY8zbxdvXhO4SCUPF3ifeI94rfF39kjekfR6v0Jw1cnI9Ew84Rd7jDI4D5UWHvih+LfvanwtoVPy4YxH5CmAPdT+rmfkrMMV/+LAK+9Lr/tFXxz0RLDDscm5D6fPTtl9oa6aovWHRVVKJK46LOn4vPalj0OfEXYonJwtfMvi8KPPFI037+pcjGoBrzZQDMSLdRtb9itWyVZ5puGtba2XAI2hapnqr2X9rAw/kr8ddmtn7VrkYzTKQ04RBfi3TqXKLRXxcNRZs59zcNE+NvxTXQqkK+iBwC8Q3ROZoPbPHUvzOoz/9+oaAFgD/9s91g0z5D2fyLqcLXmlW234r26r+KB04O4t9Fe5wGTfzbZcbq2/OO1TwdetWdF+2B7wtPFfhdYUuwf08wufsDCwb8UCzSx7A/Etae1ymFrRVP/cdisRGTVZH/Ya2Hn4jrs2VAZeT+nYS/0Spe16kF4j+Fpgio6f8lrm1MS/H/LZZif0hsFJD5PO/0GfE/ooXfYLKfijYrmfiZaMejUV2rn4sllSouKxJTlfULxD3iOhO9Xss/BuIX9osN1ouGM1PhNC2olAmCCcdpAQq5ysww10HwJAOe0wLtLmXG6VDDEs1ocnT3luNuB12SAiIzCPBss9mxpmFLBBC3OoYYWOAsMRPUCIW2OWaRtGt6oSMiJtNpBGIXOraIth7BRY6abYutal8T7YQljpmq1zr66OE6xwj6LtU1+J5Bix9iidtc72jc/gYruxtNDR9qVeBhjgG0jRPfRhhvcgyYv9mx5XrnkP1/uCnrFufKr744y5xbnYZKxIMMvBbLHT50WuE410c5F9ZYrnQueyekcYtd5ZgtNrqHXSuXZzT9ap2+yx5751RHwrR3zb201+l2epxOjUAxxyRpDcjaxh4wZPK3WkyvWxM65ZhtcJ2pyXprTmywa6V6fmO0pE3WJDNk8Y2tDHC3OIpM3GqK2GayHdVbxnar3F6rYTuixe10omFbnuCN7aJhrPqsZbpD4/K7rJb3W6t0t6niHlPFvY7Fxtpn1Wy/05wvoa52PysO6PXwizbTjoMNlwYcnepI9M3P2s1w3aY78bATL/iTgOw+IgI0jppqHjPVPK7zPmHq6Jx0Hhkt6ZRjIN6Zxqk96DgW9lNYoPg1tzuNHTvoLF1MJ76S2OQMB5w2vu3AFNlpu6jIPaLZl4YW85GGZZdSnHUWmSIk+vAo59Gqe5w7nCHn6q4WGQrEG3bOOSPOnY5928jMhLTp4tG5V6Z982iROk/S3y/ovAzi2851ZpupIuM0jkLOka349izYk7Ngj2vPiVfryT0eHe+8AcAi63RQxnpT9p1GjGLMWYAsZX8acCZrQU6Y/ijMBROKjdDH4lI59n5QdoTFCP9K3Eb0KtA41ADqiwuOVyqXfFF14vCEZRc4HmF+NXgi3lvX9XEmnalo4c1twgzkjOM0X6in+VTsUjThxzpcGP3yxFS66ouLziLl1yhz6HSqb5Nj1XK9Iu52mprSxXId6v54x6sDDiee4CxEdabQiUEShcmgN57o3Kyj0gU6D2HcwMf5RzwopxM/tmKePKturfA9ykfgyD3WucaEdP0e57RzZWTtnuJ4DZlwFZ9uAa1nOM1K7aZ4puPGUaStKp7mdKpYmdeznA56pQt7tmPkU6cdD8kvcZfTqTuNP3uMs8iqKMc91WnjrDj4HMcIMT3Xhjc/9Bqn+0vs6W6l/K3LJZz9TvMy3zlrrb3ErDUjPv3yxmXhPc95vvMC5+3OQpmTeuG80HlRBDa/u2GJOS92XmrtNu9V26HzPuf9zmI+zUha5MDvmYX2MmcuMeEPWhDrDywkbH7p4z+MzqzOSE++wrHOSl7peOnqWCBeZY3Qa+wReq314g2XH7r32COicIBEFFd8s3PZQb2SLN4a2bHedplp8J7LTYP3mGngGaj35bgejN91otC24SLDEmvuWB36aqcF8Mx0idDM1zmMEr1+1ux6o/Mm5y1zza53OO+6/Oz6bed37tvscn7f+cBVzK8PzS/d7qzuaJhhf+SoY8g/jr54WUs0/JEISfVRx1VXS/+kcXw+Zg2sQTff0NS4ff2pWT4fN837hCFtPmkPz6esHe7PdFs/ba2dz0Qr/OcWOmmw6s9GxuhzTnvV52oH4/mK+AvH5o1/3pmTSf0FqyZfNBX3NbnzJatSX45W6vYFhtH3Fecv5Sz7K40m/bXzVSeqYMBsj18z/fX1CJ6jD5z+xpmLGvmG87dWhf6ucfePhj8Zt4f572ctvn+wBldYuPaX4p5d7382k/dbzr82SE5bgrefj0epssY58o+O4R1+02mWJ8uB+KcIMvnPzr9Ey7sKVQz/1tgfHXSm9e8WqfFt3ebvOC1F2B2Zovuu46GcufieE2mCBE7fN6P1A2tYfqin7tOjh88/ssbox3YDzBL6D6eVpMFzaMpI/MRZUPTTQR3wof/UFXyhJRP4X6YG/20y/B9dgZ9aJf4s2gs/dyKr/ReNZFwjhSFcq1zPOr9LtJolBGiBSdRkJTqk76gscM2p0T26UYD58DnCaDuNjeu6fmlSxF3GM5td3c4WVwOPVlc3+VCHyr/NKrXdjTQqiqL/qM3xSGrrercJuiGXnxaL3VlR186OWjo76gZ3QRwwr2rW7XR3egvddjbflU3iDQyxyO1Q4XQVhfivcTsUpcoplridOoKTXOe2QM3JmkhWPMT1svlcTtxo9d3FFjrteKi9ZT9MX/P7XGtTLo+orrjJ9VCfj7jZGpmHm+68xequZa650aR79laLoF8e7c8VrjmZM0pD9naYE6qV7ipT1Go3zqoDulzmAiXcBqLbMwtyjWqKs97ttup4XXSr/0l70wI2bhCIHl2Ul3TXuil3nZaVEZt0z6y32rMhkrETuWG10f5YNKGxeUCWt7iGMbDZbSWT8Dydtrr2QdU21zqZ2m76oNdF2UgUgkwSl1TscIG0yvpip1WVvmi/7LK6uV+34xlNCyS7WOx2bQ72Hpc52HujueyzCtjvuhKEHbTXaPSD29woy/yI6+lqHHAXSLVU4rBL13Me4Uoc46jVQ1q7h3vMPe6ecHkrPGm645GuJRJgL84BNRWd0+6ZaL1ut6p81rWn/6PMkD3aXaJFsSwWxpJOG984q4SjxB3uogj27GbLGTFosjvVLvtrSPW/e84dce90PahGUaRddeVx1B73jGsEELKuVbBvrcWcXnRjpl/GXYsjp5vr5t3z7kS0NwqzAPWwu/A3qvr6qwuuYY0U5VwpaTBQdivuImZVWEz9qik0MBtDTVeqbk2WSbdlXC/9Kdfg1dPROs1Y6+0uvd4u6jxDU+YlqyfuNkU5j3EfG83zca5NFz3eNYKChXpaPCHy9om4gEdnxJNcS+WFVsXS1LqQ7xoY4ZMnu20yiobzKe5cx8NPVfV3n+Y+3X2GVfFnWhDxWaYR7rPd57jPlVPkedHmPL8BNrzUtRC+F0XTvtiNB+O+XxMvcT28Fihe5nqVdG2caDsLQfAyfqEgXuk2AUlTL5bEq1wXN8JXuwY7eoFrkKAWc+3o5W70PqR4hdKO8xqXc32tHrzXmc75iiXV8Ppond/gRsNvjgCn33KvMSy0pCLA3+JayNY73AaK1JaaepfbOZ9M55vc0502f+6tch28Tbf87ZGqvNONylq+28zN33YvjyJ773F/x32v+z5rhbzfXYq7U70260zmd90GFNo61Pw915pAHzUV+JiV85+6Wv7ik65GTz/jXhf4xTzRsHx3tUYKB8WfmeSfcfXR8OdcfZfN/X33A+4H1ag2/4H7IffD7h+6f+T+sfsn7kfcJgJ3FfFx0wefgJ23HsBcVhIVn3JnsbPdT7t/7n7W7VDnsKTXUPyFuxTgRGYi6edyMIJJvVLdz7tfcL/otkGdUGaQjkO/5HZO+NWSX0gqYPRld3HgX6jjTA105Ffc9iKsAR3+S3eRLWxL/fdX7rXyHoSUNgtmSrX0tPhr9wZIO4k0bJkswCZZ6JWFMtx27k6Z+GvzdfHX3ZsygGnP0AG0r6gx0zjnb9xvuEsQrvBkMC/+1v07t41t83CZf68n5z9Ym/8/6th72jst7VGI7XzT7UyzgWgV8096hW5vMtPmn6PT7tsWqfEvbnuJJJ7TaMMrK77lWtPtJ0Zn2L9Gs/g316L4/z367kTDDd6XtbTOwV74XocEX7BrsvTzd8yc/+69LLoIXfq9xkW15H5ShvcDd44Tnfum/+2Hrn0iw3j7jwyi/WP3P1yn0+28T2cyi9B8c6SRP7HGcNY5zZXqzvu+a/gX1/xf7zQjrvJfbnOHRBNkAf+pO+q/Da74P2YG/1SvyZ+Zyv/cvcf9hRszW7cjvIZzDtdrvaKJLBYoIRyn2Wv19CJq86yemS1r226xhN/bbkhW0wsd0fp0eo04covX8sBXwr55EI++bPI0H3+RF+XEfKnNeuW25WpGN6jndWDQ5LrQW4wR0bYu9uaW7JtXzek13r3AsCUW3nat1zDhzMy/zmgVEUs9xx1LV8RDosmv90R7RDL6YV4rYouAst3gWeSLFmMw4/PQuWtppMH2LGjM2tT6pmg1DjU1GRFjLRg2abrk4RZn4havOTPuZyaCelEsi+Zzq+lqS7xheYRtusI0YaU1h1Z5NiNaEb+rvS7PdGgh0mTDgItWYo0ntARWt+e1En7DtHmP18RX+0TSk6IMaz2dOOXpE8Wmdd56b4O30dvkmc7fbGq+RYuUfjDKj3lDuy1W3OsZSuq58QWSCSa2ekZQY5vu7u2ePhDa4TE3Tez0ELkq4snseHq96PMeOLnFXV67lW+DuGK/rvW84oq7vftd/lN3+h5rsuz1Lgtr7Sbtm3UquN8zW2Wrtd4aefQHzNAfvDxcPOTZzTJdcJuu/GFrHT4iOnWPeGYsj3r2Oc2HFixSRsoB/NVpvh7zNBPquFXqCV3SSaukR0ZLOuW1RoAij++A7o7TpsFnTINv9+YAh+5Z71Heo62i7mgEiZovMegZOPOGpgVS9ZMY8lrHykkVGjZFn7Ny3d0UvZjYdjkpuRc12eM+Mmvc77TGPYpXakHXSW/Ou4UirT+9y5tnAxm1p4hNzYZz9Z+4ZLXybq8tqKDEEt/jfky0Kx/ricWacYIcWTTYLTLedRbUbVNah/CDrK6sr2dFLgJF9Toa8yxYMe5ZfLA8XvcDujFfAspYnPeUjqKJCGi2+6II7aymx6hGJW+JYc4mi3UleOMtsqLJBK6omJG/YPVJ1etUm49MGHhN5dHzqOapFu2gurVPvbH9ymfI1KwZMn3fZ8jMvc+Qi7/CGRIJP96zLrQ80VusW/Lyjsd56tbwE7xZt4afpNvwBus448neU7y2Yn4aAF6dJJKfavX307zolWJd46d7C8b9aaJy39LBylact3a8TV01FW+XYkHv0GdY77zchWS3iS1zi2dD01HXwHi5gOqlnmNvCm3CDjyETwSeYVCqQGsNdp7pPUv3xHO5J57nmZ54vt0TurEviBQWafjVN3Yhc5+T8GBo/8Joy17kWbp9X2xPHVb3dcbq7Jd4l+m6pf/H2z9bHcBLdeuuVB3ANfcTj+IV3v1GbkcESV/pvcp7tfcaby619c59prrvB7bEyy2Iuvj/YD85c57IvdabX5/C67w5P3m9p+SZ3hgB/veiVuFN3tz3+W/svBptap6Lmh3eAt1G/Z7Pird6HtZSvC26E73dc5v1gn4HX2Z8ZzTJuzzHJPnt6Lv3eJ6H5uPF+z2T5ncZPH0wmvT3PJhZ5Xo144vftxJ/YM7Ef+AZIfAPRV/9rF00hJuUYptPeCjxMCE+7cXzRdz4PgNgplyulVBl3J97C5AoKs0UxWc9D9Ey8TmvhbVsfdhTl1/+0PMyMF/EH3mkV078sUUE/omnacOPeF5QgUn3UaslH4vW80+9ZvPuvdF37/Pue5U1N+yT3HOf8hpI29YWlqbHoXy3xzrwfseTuo0+bpXcjCWT3rE/u/qOu7wuh5d5s2zcNGpv+C3P1t7QVBmvpgNf/IXntLFIiBTfkvPrS/PEf2We+L+aJ/6r88R/fZ74b8wT/3fzxP/DPPHfBIwvGh8RxPh3G5P/dnREv+M5lv4n99+873rfi6Z4TXtUqpYPZn/kXTPHZYvPe512ZNZ3vuB90WuVdUOo8WWvQ4XKuZzvi7/Ur/3qqPhrb7EMWcDua55qXQFwdfE33kIZ1OTP3+oUVLm/18EAy/xHr1MGsbfw+PWfPCUa9C+eEmv5lqcn2L8yqPq+XKY/8Bq2sR9He+g/GtiV345Ig5nJ/BPP6sj/1Fvhf2my7L9tvCbOyP3/eM36euRPG4CVhYD93DNicLGo1rcPmCth4h6PqfynxFXpTzUCxb/wZgsXiLim3B2tbuAZ5qTbfWb8p03PiltSBc+Om+30OfHGDfCKyTE33kiOeXGDPLhtLHTMxkWa4u0clFvAgvhCDpvubo53XsG9uLgu4vFKMWVL3EYvWuOPb42eNrfFjehmexyqhddQpayd6drO+JyoxML4XGdiixp7TaqpXBKXnuviTey50ZTw0LglJK75lQ/TBdwSzfSmeON5wM1xw3haHAcMvuqjCM01ugj32vjS+EPi5tL+9fEbdH893CrIujQaKXNZ/IFjXd4a75ifdbk8Pifr0gmaV+jWOivjq+L3hX25On4Z9qV9T0nXr0tXJ2GVuMaeeKLbGt4eM+rJuH2isjZuH/823ECyE6Yul7DZkHjntdL3CVPdhZpsa5DtzVun1ofa5iDRxCK+TGWty3VxcY3iE1nRpWaHROo2xyWauyXuLiTGj5VoY7yzks5XrZhNcQ9jxNa4s6QOiBUs71zZet8bb9HRYkfc6SRoZ94nWj2MEX1x99p8ZbZAgHh6R2u+MpnM1WsokNwfb4fQlmQ6m8V5J8qtTqv5TOym15v06z1xb0m6XhsvV/H2lsl0e3yxqWzgM89sZ7ydQbEM74rzNbO9cdGJZ+/WPa0TbXF1S2193HDdNsTjzCrbFm/RxYp9cT663x/XZ/cH4p1VlM4IakmpuPBgvH28VqtofuyhuBuNOBxvwz2iHrDkwiPiHVU/jVopJKZ1JD6bzj4Rv1o6e05iJXblhErT5fHIk/Eo0vjIuI00QotZ5TiV5J2NPyr+6Pgd8TYZS0UMRoFqorW1XfUkocG34UYUVGBJ8y38eiCOxpemK5WC3CNsNOdYfFHkDeqLOB5faMehFbtT8WZEY8g/EG8hP6pOFqflC0R5zsRbyQ9kNOzct8ebpP71IQvID+vxMIqERgxoudOCOOm4Ek23AEcm2vhsvGWOgz9fZ52LL1QnJaqIsbjNbzZF562iz1slTkRLLNhaE0q6oHJcqEs7T4xHv8i1SaG4StzIdT4hbpKraj8pjtcOWOVCEF8svdaarcWN0GYdlhIgszjHq/HOEow+kO/q6+m44aNNWh/NAPS5TNK74q0Nar+K8fbMeDmfwZmExM8FABCFOoInDk/F2/lrGb5o+jOk1vJ1jkvxdvQHE0hsQpfcDcABw/TNY+KdOkDIsnhstANf1mJu2z0ufo2uoSXXGXfvrWvNKduT47PR0dk46NNMS55+P+CglqjI8+ISy3t+NNGJNsc6tI37pCn3BfF2C39/oa7yi80l1JfEpaLdl+p6vizuTSJl83LTiFcYHEq8EvzlgKXWXxVnrO7V0cq8Js5U3mvjoh1BKZRQZ4Q53vbA18FplweOPCtfH28gfVD5d8nXDKf/195Xx8dxK4+fdm9592wHm+K1KSRtnTZpyvRsx3HAdhyfA8XX893Zvvgot2fHTttXfGV4hVdmZmZmZmZmZoaftCCN1mfH6YPfy+fbP25Pq92VRqPRaDTSzEgMsDMluld5tuTM7uf4s/t5fCnfAdcD50ujcBMLmB69gzteiy+g+L+Qteoitlq5WALnr+nZFMBMLg3SBavzMlr25azsKzwkXknRepUkx5NO3tWg3GskA9PeIp9/XctX84spM952nSS5Rk7XS8DG7AZO8NuXOQR9PLCuk3hd1U14eeDMxjdLYplAv+6zW/BLztR0q1TFHcC9TeLXR2WRfrs3Xh+hCLpDgltXj0rMdu0pSXZHsvC09Dxs3wuwfeJj0p3SXRJoY7mFkvCSeTdF+z0A2S8HO5GN+3uloUz+HpTCQjqJ7qMM6n4psB56CCw3Bc4EMLC65jb4HpMG6y7eHjA8VInsxec4WjjHlLjPZMIj0wn07PALqBzGKvjhQYbcbCvY+4/rf6D3KYJehH3t9+5LQ/UuHd2vSL7x9asSU3y8zr//RmCAvCUhwMDfDjx9R4J6rneD5PDegAXzexI72fO+jxLpA+lD6SPpY+kTaRTz/Q3WmJ9Kn7HJSRopj5JHy2PksbLf/lXAImpV/rzDarJQBcr0I7lIAOwvADa+4bHxbaC9K8mjoVs5ieMGb0pDNg0YwnyJZ4autI2+kuTOTL4dL3u+ljxPR99JTD/1vaTg7u8mYs4P0miGD2gK/qPEPHmC7J8oxWg/S79Iv0q/Sb9LIRnJgizKASEpLANyj0iyLCuyKmuyLhuyKVtyRK6QK+UqeYRcrg8YZx4ns+lx5eH1jQoOfXXrwDRjdQgTWkP2YsC4U6EQldeUy3Br2ot38yuce3gDzrVlMLTWkQNsgA21tehCfjzRsiVSnr3gujIVc9fjv24wPFOV9YP5hqPd9WPMyUykrZYFep5nCv/VJjI7FTZR9rZqhA3lSRxuNgI9sLHs+aTJ5J2Vy2TZN9CaCtu8KV/PZjJ/nnwL2ndbMj+lW8miYvdks3Es1E2QDdewoaPoWDDK4Wwer+y3ltl59u1knoUGBGIxcM+/DA8v8TvDfodswxW/razHOzuxUBon4Ri2lzXit4QskWxUA2iylrWmTi6rWpxGW14PqHZ6oDNlylFnyEyyn8m/NUsOsr7ZrC14rcfAaqRk1gS6sllmfGCOXEkP8vh6khbWmLlymSmhlTVAiMltcmXCW6HQGubxAM+XxWS+hBbIIzmmtkQf9paz8rj1hPWk9ZT1tPWM1acPd/sZ9evLH0heIjvNN1u3WLdaoPHAkekeepkgsfqyIs4P2HymXf03XQS86lrLlQwX8ji83vKkyR1lGbx9jTXCtTUme940dwdIw8JN1h2WkuqLY4ym0E7y4Kxs1JDnKLi+21n+Y323q/yfOTrwV3k3OS63y1D+Scjluhclyw/Q/8Jxi11kJsKO/BOdg6GTKbyFlNxBcdZZTuXdxY+SZaq8teVQprPGZPhassuqRTEw1qqz/a42No95L565HYZUAHx4MV/qL8xArChL8Uw6biNb5mb3kiwE/I/m+PmyR2bKnF7Z6+4ltKF9srti6GdMYGk5Dr87aOAePJR7Air4G5h29qKV7C0L6QLaR3b12vuCyWY/WUpl4+kM2l8m5oLJtMe4cLoj3em7HPu7DDdDWH8dAGo+kM6mBzH49+JjmB0ss33WQyh0h8pGb7qI33H2jdBhcsRTIPsIOVyu9HKYxusI2SRn8eg7R8ojXLtIR99HHfLLEWKqSsKMenr7oyiYR4NGHcNj9Fh5+Luwx8kDvJMBnhJ8diJ4NqTDG+EE+SSPNE7mxvwpjFBOhYTiqZ9PY9QsnC6fQVt7JmjtWXJgeDMbhrMpfOfIrjLnXJkaXJzHyWHnM0AuYIAcDbzgXijT+KvCRfLFFJZLACyX8rBcJqPK1GL3ptqv90qZqeQvl70diStk1X9RuEq+mgFzjeycy7lWVgnROJqc68AQv56v8AaZHXe9UdYyJOals8dykwzWfjfLYqGrgG4Bo2sl6hZiZd1faa/i+U9dVa/MxLPtyTgTAIQ75bsYjKvrVNRYA9hyRCmHXpNFtlkLcL3xOjR3WJvfXFxH59U5t8lqJp3pL+BhjW6XI1V+JMpqmnuH/L/dHH/P7m6+z+6R+XX6/YA+bpUraDu9r++VWdMgAd/HGvAAoMgH+coeomT7sMzGySOQOh5ljJZNwo/J/un7x8GQfEJ+UgZaVykYpwiaBj7FA/I0YdUFzHWfkQW2f/Cs7PfWczJTbDwPWPwLYKH2IhgI3wXnOvba57LGYrF9G3yvUiEDizT3bUY/zLPPO7JvQOoB9q5sZdJ2gYka72GYyY5dCr1Pu0D4QP5QVrBEnyF+PT+S3QCZcXfj62OGs09od3wqy8lUB24m+kyWcKonh16WZZdQ0SuymMBPfuRgF36Sf8YLHgcYcqQJF/KGrOASSFA89JLMsPqWvEK3cZCe/CbYk4Pi4s0VAxffU1z8MCguJK1INpvxdzb6Qq5yfSW4LXYzv5TDGCYbfQXa/HUQUzIo5dVypbzmlfL6UKUodk+7cx70GzkMxiQ32IYYoP+7A284HcFszLc1rSHEq1/Zwus3eVuzbJyTEHUZhRRBERVXrBbCisSC2MhKpZekcQiQotD2qArrKE3x26YrcEYymO8XwVQsPq5PRAEOTX6RA4Le70DQM1eUBmllqOo3Ey4maYMrFE/grFTc7dAqBugIWvtIvoZRyki/2NGKRpWsaIzi2hlLY5WVlHHKysoqCltkrKpo7CDPaooj3K2ueMuWNRRynMg/PhRVjGw8QW/XVORkPkuOd6ylhHt60kk0XnE9Ba6taGT9V+2sh9ZRXPeN6+KWYFEVrcdwylx5TgBugCbyrVpfAc5CqhVvPhYnKRspGytM97uJwgT+DZQNqaumyRRbU/xv0VQfu5sqjB9sRjEsbK5swYDcUmHVbwXA3JoHcxtFl/M9JWKduC3blmExw7ZjHbi9AtVsjmbNVdAq5Y7z1YA6a/k66xRgYTYd0Nc0halEIv6hF2+JVq/40WEbQMtmMPBmAjBmgcpn85U3KkF3/bSEOawv0Cf0iECTAsXDZo+wW1jFcxW23m2l3RZTlGzadpwAtXEIYpDN4yGbr9AOEBYozGvXDrTMHVmlO4EyZwMlzc58mbso9Pgu2pWW+FfFXfPvpjDnVyQ4MYorZXeS2gETSTAYkpAg3FGS8mEVOpROgJcuxYsUnwY9s4iHtVvhIxYAw7WsAuPZufrVHHBrVsb/AcorYXLKGRUYwIsB0orKiFIqZ+eL3DRjA/BKPHg9mLNT9rNEgZql4M6G5Prh7PfH61JFd3KqyUyNdmdOflGv4plk9ClVzgzguvD04gzuobglhfdU/qbspeztl7eP4p4q2Zei4BYFagP2Yzxhf+Xvim8/eAAA+kC+cQcBOjmYlnoIpbxDYVfDL8OHKYcrRyhHsr4W/6EcpRytMFf9xyhUV3Asg0D+p3KccrxygnKicpLinS8+WaErxlNYr53qDbnTwLg/nY0VdAZ79UwFqNzPAu+fTVsC49GdyyPhPKWcfv/8QOA+S3AmmwspWi9S6Kx+tcKUqWUc6YEdC+DTndfu3+7vH1yiLHv/4AKF3z+4WKH7B5cyrAzYP2DTz+VKdPh7CZcpnG5q2MrvK5Uyym82lq5SGPoGVYRXeB7QaY9+XU43/o0FdOPXKNcq1ynXY/kol1+Sg2cJfrR+siil3aBw6nL39IWNbiSodJM3UVTKv1m/W6EIigSMHP0TwWGgWJciQyvWsdBdJOxAjXjsQuN07RV0uy+eICYTyIhUZuP97fBQBDIjIpZlkEUGL+ZlGAORP7rncYXCRNM1/uz2Fb3bmVB1M5gkeBOcW8F0+JLpBaElqr3bKBu7nXGROwDjvJPniXcpgp7NY1DcA9n3KkPwlPuU4Kb4/WByp15/hXuUBziyeFABJ/oeAqz9YbAqeAS06FGlzIbJY6ARj/ONeEJhWzJPUpw9xa2UnobzyzMMN89yEh7wEurX+zyo9wW+3hfBVPYSK/Jlpex23Su0yJuAJPkqX+T3qm/l/LriHBh9QxEt/kza20qlNym70wmxRn5HGcnnOWWI7yrvKe8rxDek+8whwQU6F6hRiXBf2ugDRQxmfaKM4It3CvqUcIm4c26ZRNUm5He2KZru6cKkm/GREqjMCzDlixWfKezY1WuK7EiuKfSmLy69xQSQDxXTPxLgSFCfA+R/QTv9S//Lr2h/hL9WvlG+Vb5TWDiF72lX/AB690ewnmk16VYH+sntiZ/pR7+wDv5VcTckf6MQ/K4o/imPEG8LhVRkemyVHCazkaiKunMa1sXnOP71KUDzrqiCWSBbGUXvELKsys6XNlLV8GjfHWY1946p6q4k5wyACnXgawQMZAWrFXigJDfYSIPBZF+BxiANq+BkkqQqXslIw2+k4sVEF9LZMShDrQyCgCIBIGmb1Uq1Sh2hjlRHqaPVMepY1XKhwsRFLJGEldSVecBXUV0jmlVVwT/hurrKmM3aKpX11mDbC1EG3Zoq29Ogx6fHcyUwf4mrQUO9dXhA1lVBFNGJKr+3sYEKicyHaD3PXm8CsK9bX4X8a0MKUjUDeRKIG78RD8TGapBZT1EZl5xMO3ATlcjEwlR1U9Ui3UBdv6LNVMavaI2bAwC3UCGfo4BsyQOyFah2a1rt42xG2AZY322rsql9O4D67SksfwFNrgnaGgKPLLXqf8/ysk41QLkBy8tptM31rOOmq/+qm7iGYNvZTuYMD4SZFAOz1Nk+AsVGtUltho2do3oss0W1HEGCYn2uqjhpQqoM9hjs9nE+QNWZdDcvp7aBnprHQztfRb5mbCe1gnp3XqAuVHfwgN+RAt9u7gzB3YWSwq6qkkzjgY5h0s1RjnCUxJwBqj/+ysDeTY2wVxxGEVfBzt1YGvGZhfd0gnQkVK0n585LSZRUPdEvBRrXwTeu879IeQWGvYGUtxhEijapTo6sx4vqIO4LS3+ILpcAZAxl/zsmGFXb9ZmN+gFP3JKeEl3KwNqdg3cPAMSeAOC/UcrYCwC0Nw/QPoAd/YUqxfdVXYf3+7E692e1CH9XD6BlHwjY0kEqML48GFR6CF/poSqTVQ6jvXI4q+wI0KQjaVX/ACUexZd4tDrQ2vQYWvJwrU35qel4lW04H6cGHlFU/ZNBfTpAxRmgBWeqZeT3E1R/Vj4LNOtEvp6zVY68TxtOXazYEZheiVUxLPEkrgJhtcgu3KHzwZwDRTknQifzUAZsbtkQLGtze6w6wHfLqAhvhnuKCmGKeM3wSz31X8FJAL3Q/PQcxpPOpaRznk99wiXqpfzXV6jqsr8W43YWnU9hDF+gXqhepF7Mlcr2rC5TLw/WwdYDV7GWXqey1T+gnpv5j28BY/sqCtOVkHmIV6vXqNfyBXukej1Xx0A3z8KN6k1D1U2ntFtVq4yId5sa8RxMUNMyBsYdgI3dyUC6C3Tw3Qy8e9TKjnwxFU90sbn6XgDyfZSD3A8AfoAH+EGV3005BCh4HlYFsFp+lP/wMRCW6yFV9X11oUdUsh3uHPl7XAXmzE8C+e4p2itP84WeDtSqz6gKe4tW9QRoynemVHL23Z/lS3mONvx5hsQXAhI4XMi8SOF5CaD6ZbXsXsor3Cz0KgPtNbWSikHUMAv0xxsMmGfKOg1/k2/GW0yeFN5W3/FhFN9V31Pf97y0iB+oH6ofMaDlj9VP1E/Vz9TP1S9U4l8o1YVXWrgxX+J3fIr7CgD1NYP/G4q2byGSeaC+V8OAJn7gcPEjK2ugxprhVdG44HO/8hX8prJ++Unl9V0/q2B/6RdfCPud9t5vprutEqIOHkWkCZqoYQmxN02MacKau80lad52lqxBwDhIVI2nGEtj8r3GPhN0zaDToqnB1VpEAx5vKEyoUqOEUKX5OB+hefL3SA04WOchGg0g6NOqPIUQqHAMBWSsRllJ1UraOG1lbRVtVW01bXVtDS2qramtpY3X1tbW0dbV1tMmaGW2OtBEAPz6muZEJnRmsg0ozBsCUKt5UCdpIMjQZFbBpgDfm2lU4BM20jb2YRemaJtoQJ8wdbCvmWS2ubYFQ++WAKqteKi21pbTHf42Wlkl3tXAufW2mru7tR1FC3RptL0WFITLyJ01GmXqtQDrdbTEaaBJ9XyJ0zGBO4TjsNwZWoCfiuDhLM1wb1xxZjb/bmMgIGyzFnGOMVbTENUtGhqYxWT2Bs3sdXw4VGfjpUQXmqlFHLuqvpK7G2qjJs3yc5xyhDnaXNZvrVq5VUUMNL2Nh3iexg75ztc8hekCzVHTLeRf3SHQuF0Yxv+qlTdP4406dtR2YpDuXJ4q9geBXsRsvIB2hbWM9l0NkHP4jNh20+DGbxy0dnczQDph13tsnpIFdBV8mhXo+Ur2LME6ydaczc80pb0lWkBB1K+FyYeoVwN6lEWs8d0adXKb8biokNVyWtDJbV4rqxcqAOg5iBdrMAxf+woCsu88+O/WigEv45+pFQPDFbCOfx3g/xCUQS1rP8Y0FXe7VgxMiwMgAWBz75Y0fYRL99XuCVM3O6mN8qmLy+/QwEmgTm0U3SGFLxU15gOoh+KAoQkIPgPg5IBbCqak3TUVL6xdRnsEdGJzJF2Q7cFQuydD2dGUlR/DJnPhWPOfPE8+zuT9kh6tuQLo3lr5/H0Hyd9/kPwDBsk/aJD8QwbJP2yQ/CMGyf/HIPnHaEw3dAKP9hO1NcJkLYpO0uR2PLvj1Mkadwzh0eE7COeOIXxq/THTyz9w9OBb6zvre+sHq/zRg7LnDX6x6HmDX6ncuAKeN2Cr+dOAHHY638lnaKu7SsOz/uzaFahroRLzfA1oLS/gu/dCLQx8IgvnaRfxzxsMxfk2nUQXa26hblDvS7SxlOf+TYOhNV1N516az07ipUIG7aMFfCHvp1FfyIts9HfN94XsKi/aiSXGgRrnC/lg+k4m3esFfUGHagMcJB9OP7MJoEfSmokytsdGR2m+Q+RjtVEMbsd9oHvC4J+a7yj5OI1qc4/XTCcUH1nOFPMZdAqbRU7VJCdKiHCmdrbmq3rP0XRQ5Llu+PZLNfeg4GU8li8P6B2uCtxfrTGbi61NFMElpnLEMM4dHdcEhRHhOu16nJfM97RTz0boWq0yYncRd3N0uFyhgQnySs13hCveoN2o3aSVcXp9s+YNyFvYjPsynbJvBWv12yDR3Q4W7ndod1KB5K6yaoi7NXIEI+5g/R6wOrqXR9p9gQXeVVoZJERWtDYxdQ+z3HhQG+eu4qmjnep4jviRz2NyfqjMQ9dsAvf5wyzuySPao4DLP4bHjc89PT/2j/vqqCc0dmDmSdqupwDUT2vlDEw+txwav19ztgKeYePjWVDxc7TA50GBLwR1JhUGMV+Ll6rJ9gx6UatyQuA6/naq3UO16CXYXeW9e72qlffu9RqF+XUA2hucP5s3NeCW5C3WmLfZCv8d1tXv0ma9B5r1frBZQSvyVyggIOzSCtQc/oQLd77sQy3Y2I9AY5lQ+TlfaLXORsAHWvmIUx+zgmAbhU+1zzRQ7iBhLQeY6n4BmvglD81XGq3qa0pu4W+0b7XvtO81f9/nB42dGfuRYu4nBsvPmu898RfNNcb/la/nNyBlCzpbR4o622z71RzJPOgy7zi/c90cYh8LSA/ro8EnoHMkaiQus/M4Cm+2repsU02j7+v6IHpTQwd7HQzfJkWzBQ6xRPQAJQF7NL2cb91KvRJ/m0i5RwjcQqpYjScYaiqTSRfstI1G+DUKI/VRrHWjQfVj+OrH6sySYiXdDe8ybvnM6NFqrKb/kBE9LxJM1EXLZ5EunOvrQ4zGLfTgaNxQLzcaW/TAaBQYfJN0xTuIiTbSw5VuaNFqZvK6sQ6KgVQymS90io7AdvImeti3Epuqj2Q+/1i5m3KFbcYXtrk+mluIlOUYwlb61l7fbeM3W9hO314Hew5/0SucgxIAaTW6UUyVeore4ZlafQwM2p7O9XohKlGdHvGPqHprgmm6ezbb2aysD8RRmK4Dp4INsHXqDH2mPkufrTfqTXqzPgdidLjsrBXQXEyvIMUmAaG28fibN4COJiwfHW0J6GjMcnZF2HHmve2fXRLoEjYe19PlhI2RVUA7gtwFZXN3ALkDDwntTPtpuIeERG9/ZVcOvD94kuavfBsDJ2mY7LOnZRXjS/PsEMy6uhcdZr4OuMZCnQJXRWJJER+CbGbYSS9zHGcXfZnHcXbTuYYNwGF8uXG4zghv8oVvp3nnfGVgbV82rCkO1oBu5k91zP+UOkZ1eqxL9/syoQ89WErBweLDmdS5YcOR0dp/EtX/KaIayJ46lp/Fc6+NiUAPuxEodXVyfjS72SQ44NhP1fCNU/+ok9Ls0E5K/11uSf8lr6PDNOHMAOmp8v8KcgQhXkI5sPLJw2VGgS0zFuvL4Tb1T5e3y0t8RUB86/4xQWXRsueU3sHnlCX6f7iXhjejLNX/1emjfCeXmzxgb/637IqXRWuAdIKSiv1HJZWeISSVdf6kqv9bVFX+COZJnh5gL90Ai3i0t+67TOH0PsCUfD+48C53BHP/oHoRBjU5iH94owX1jUz1+nfKHA9gNR9Yfsl/MEX/IWClfyhf0WFAn3o4LfwIwOnfMFj1R+oOmf+D1X0Uq/toWt8xoL5jg60G1qjH6xVDOcJlkFV4gU+O0weEJj9RZz0He+Zk0IRTKGSnQlRBlnEamCZPd1t5BmvlmaBBZ/ENOnvYE9sJYGKLrBhN47W75wTuzwvcX6ALfHysC6Fy5KLA24cE7L0uDTy/POBv9iodHETbyOIfXsM/ROP8FZAbLJsbWvpQT28OQHFb4P5uXXGDit+h+0HF79R9NwK+pf1derhI2NM9eqVLAkUSVtzdc79X53F0H4/z+wP1PRi4f1ivdGN9C+fq5+uVsChiHIIu1g0n7rervBYu0S+DfXAFG1JX6m6UMuFq/Vpd6Cqi63Q/FpZOvTc4rfJ2Nm/QLQ5t6CZ9lLfjx+ffQkCwS9XtPZkMXv/dqltkBiX+Ld3nt+t+kPIHdCcwufCQ/giPhUfB3kerZ7P6GB0Nj/uT3hOMjJ9knP0pOBBc33tP6665xTM62xN7lu6gPEfH0PM8GC/AKDIvgl2vrZkJ+ku6hnML+ZyzRwp2yV7xlYGvkhFGysOU8ZquLklnko6V8Ot8ZW8EevptXY74kd684JEfOKh0NiDcd94E9b3lDu1PgQ+zz1h3f6GHB5Y29AeIyx/4teb0qcORPgwC9hEA7ONl1FOmaNP3RPmvl84j9ZPyDYnb3f+GqmTVTpUwBXba6B1d89+x0bu67qAqEbfx3Xu66rXORu/jQYjrttHnHMh0dzcA/Xf6mJGJTN4mNuMw/0u2IvpKZ6LM154o8w3cRvhWj9AiXHcq3+sjM+kOZ1BUAxOAH3QWF9iRtp0NwB85F3nlw0V5GyQg62d9hBs7CB61FX7Rf6UDWPhN/x1MayHDsxpHBpu8BAPOgl8bQHwSqbe+MAzPwGFPAiZusjH6T5QtL8rYpo7CeypUDUW0F2eQblS5IchYJAUbrW5E8DOYY9CatzQqccqR0SnIm/Blb039Z25qMDOtk6yNDLmzmM/39iPLYP5ADDIjZtMweGlleaD+LSCImZ44qvhv1s887o0wdHCcfaQBIncZTkRZd/YZC7rwOzPi+nqg9DjeEPGraKU/Cg5r+mhDjrvVjzE4HA0LLuYW9A+Dov1/QQA7rryyIZOIERkb1yK7m9doFTBmVjX83NWMCIchi3YjgQuNMgw8U1S72LTRJAN08zgjbJdSBbQZpDnYcL+OyRgFmZJ3M+XfSoLAmHpNw3Lx6QOzljEQwbwLrrWDBTOKXhekJxhhKZ0j3oQ34MlpaKBXdexDiXBpI81ZuCaqCWcyca0k7bGMiPeIDN8qL41xjtYwNCeNScJG0eE0boyb4+lrfMTYaB2jyn0CbUvWMzQ3M5VLook+v17f8Fq6oWG6gqLtAlAdJIRBx9UgvV4OQ0wAngr6tAxVDTQi3wIgH5i2DuhQ3xZtW4PfyWkw2ERYy0oQ6ozNIywasvAXo8YY9ndg2XeeRWOrom0MwzMMchYa2xmOudOZVIt2tsWKPMeyqLmQ8/b2hgVC5OGMaaC551vU7ukCy7N7utC6yAraPV1C40pB68jLLGZdVM+38nJLDPfY+P3pwda7PpY/wc/TuY48mmGE24krnpmGaXelMhnfH/8sL2Y2cU832/CdcTcavAw5x+DiVzZDkaDFoIuouQYMMEhdWHPiRCt9XYgZbZR2xHnGfGMBoM+Fhrey3MFgZ3h3ZELHTpSudjY8LdsuAOO78vj4qwH8oSf4Zx3wWSr4jJ3h7PWULrvRIRA3/NVgu1HhqgXYWa+kMZLoZvLFeLG/msn1nWy4dBkDlX9C2lgEmtHNg5MxBNnOxsm6Imc44X/yxlBhoRYb8MRT0QieeLINKGUy3wVZzH/9iDWkloLfZKHH6GUNWGKAQ/d9tEOOMWmp4X5jqbG7sQfo2D0NoE7/G0NBIC7X3gwL4j7GvsZ+oCf2pz3wd0hbwgHGgaCigxigB4N2HkLhPNQIO08PM+B5T4r7w3mAjjCGY35/JBsN/2D1H2UMcr6KRl492iin/T2GB6EigsKdJGbA8UY5D3zHGn54n38C9etxhv+NX8PvBjxtCuScoPk9a6L/6dk8QGewAY+nlxPx1OPpgIh4dJIB9tlPpsgQTjFOhXRzGoD1dNBPZxqsemaf8Kx5VplRg+Fi7TiHh/FcQDjn0TLPZ51zgWHRWcvJuBAQ0dVAj36R4SqGLqaYvITBcimA4LIAkzYEqE7jyYi/82b3KymcVzE4rzbKHku+hkJzLQDhuiDlYCmkE0/qFL3XgwXfDWzoYyhuNFw+dxMF4maOg9/CQLp1MLr2QbrNGM3OwUKAbjf86Cx3AKjv5KG+ywhD/nU/oJQHBifcB0GH303bcI8B+uBew6QrakKq9+EGOvs2ccwf0UNsVnrYeMR4FJDDYxTZj3NNp7A8wbfgSYNXOT/DMeRnBzDk5wym7mdD6ynjaSMQiw89b4SzZBPxBSNMDsajFw250F/qItg36Iz+MhhPr7Bue5XB/hpt0OsGt33DHPvwLXrLYHqjtw3IBukAf8d4lyOY9wzFD3/yPq3uAwbDh6C2jwAU+/P9+rFRLkDGpx61fkbn4s9ZQ7+AneRJCV9SEL4K6DkYFN/wbf7WCAf66XtjiFn3B/7rH0GfBs3Ufx6qnF/AhxLwqeiA+1s5Nvg7aEMoyM5HUux9F6Qm4SfjVzg+kEkdAAtmhRtZij0VTaDnCptllVOS6aFbZlpvBYbtEXPpDFJNz46PRQkyw3k8LyCdshDDhL1kmpA+GAuzwKwZCfgeMYNewkxfm+sUWWkyTywjTdmzMRzFFzKawT7GlMD7ilcWqjId3y0jTE+DP5Yv4DszBAOMbEg4rhu3e2UTPpg02ION4YMw6KwNTMhTVjItF10dqThxMozGmarvsRitYiLvCPKqJvLi16vciYPV2EywurkGFS2izFEms5NZE/TFWgD/4/mWr23yi4l1Tc6mdz1GIBNMIBpO5Fq/Dmv9+uYgiJw8GCInD4bIyUMgsjqIyI0AIqdQRG5i6uEOEvZpqomXXJjFbWrKBaLPjaPNMM3gJ3hNhTZnkt4W+L0MCZHkhF4jOn60FY+weywA1Nam0h/PZtJ47baNyaS+bVmMJCZti9ubfzFrQK/UmnSxVWdOMyU7gTsJ1TOMTwfd1sBDMcMEezmzTbY4mGmOIoGFBtjuzTJHcWa6fn6jydtZga5oYpA0m4OIEgzAOaylqAW4K+LAnmuqQDR2tz1RzB2bbRRp80xHlBPmmwtoQQvNwTTaOwQ4yE4coexsBmfxXUzA8b1tx7+CbjnN5xG7mWxK27F8FLZdTS3VVyLB7zAG4ia0q2oHRSYYJpOsHSxWWIc50veYDlvSCdDbxSMybTLFWq8p+C3KsopyJt10KphhENzIBB/6ANh86SUTHOlYwvpMXGR2mxnWMCFvLqbY7ClXcJ/pMLJ+vvyloGG7myB20t/MQQXHvQCR72GC1UcCd0hnvtiP9jRVvJyJO6e39jY9YX0fjr73ZTDux81VyzjocwAPy4EBpnmIaZkebK5P5YMwe/Lu7QzJOJhCfKhp2fmeYiJVnYn3Y66DDjMrvAxPMLTR4eagzmUY0P9gbTmKwT9s9zLiGF62oYP3BHPIs7Ar8Q/BUDvRDPoqOikwNE/nOuMcU4Cjjp7GPSPw1dmsoeeY/Ak/V7o8niL3ZK6CU9iHp8IeHniK7Eyz3ProLChKncsAPA9QxvlBV2pUw3CBKZoOd6l2uxe9b1W496w/LzINN4uEI7PRh1YEdPaFJtdWvRhf4vOd2QOOG6JLzLI6j/Cl5mXm5eYVpsfprmQ4uao8U6f+aNE1oJ3XBtvJpLvrBrDYi81yC6X/8UbwQ/r6wP09lsSMHlg9N9J6bhp0grrFZKFbbgCz5F0mK7FsKcAXsBkocaBRxq2gtOEZZXCvDTC3U3tyjpvoJLrNrOxNYXEKP/ElUeF28w4TyEF3cs0a2l313eYyD93eaw7P2O+egCzLG/uZ/3+bAJHJzoKw8Jn3mRWue3rGhu4Ha6YHOJZECehBE+yPPESp72FA5Y/wWHkUiDGPmWZvVzJT7XrTtNHjZoUnDtK6nqAAPgnZ31MMhKfNsqquZykwzwFgnh8w5PziXwBeksu39WUqIKNXaOGvgsJf4wt/HQhFbwBx/E3Yz2/R9r3tipnoHVr2u6xl7zEw3gc1fsDX+CGo5SNa8MeAlD7xBZFPWYGf0Qo/ZxV+wZf8Jaj0KyiOfWeycMdfm9/QSr+l5Yvfmz+YPwIYfqL1/cxX8gsAnxHmbybYQPqd9YHGlEi6ZVhlRCYTONnm2QuKWOXGQKAqwPK1kIUswRKtsCVZsqVYqvXvAkQEZF0Z9G1a4VRSnc65LMZGVRZzv19hVflhLlgRIyzg2QqNtDS2ZTyKLcdHM/DHWBGqlCGhVW00ltulWMkySYuoMnGcVdGFRQTM8GnWylZVlyM15OMscxVrdBIzyyzmltyD8KrWatbq1hqWAYuIMhQpa1prWeOtta11rHWt9XiMTLAGTjUTreWdalx1xgaBI76TLO6Ib9ggx3CrvTO4ky33VO4Uyz+Vuwlf2VRL1pwFZHU7lgG3s4Y1Y+xqDTVjjBia7a9vDcX25Vx+Sbo7jTa0PN0NnAAsdwPSL77aopHZN7ZULAThVUPaRpta5NjuZpYTMWlzawu2pS1uaW1lbW15WlRhG2tby2s8qWt7vlV/AWOthvZVLSPGOkvxvCWjaZbUnonnulG9VeGdKGHxl9nQaqASygwwtGZaAebOuV9vHCpoe5MVFBqbLSY0Mil/ltUWKe+NaLYV1LrPAabDLRYY5XM5W+BWKwaMY9osN8DaPIae+eVYygIg9S0EONiBx8GOZcbLTss9XoQhRbPhCUdDkzov3e4WGJntoIGpwLMk/4xNM118hR1DPEsHLAWyHofIBPJzgbqzsFfzgZcXB+5tcHqk7HjeecjxXGYUM6qJg9MmCWuAj7NOwOJdTeQiq5LtEXhvdVujWJ7LIDBmc6hgjQvms4D2RczlAw/JUdYUKlnMAXwPpbhef+AKS6w+qLrsZ/S+FPTo7nxH7VGGnPdafvbPGyhZckDlX0nOUeM25ogb815y5uZQCwgGh1uAdI+wAJELR1r/AMAfZQlU+wGyj7XUSMFO9STz1amMe+ruAMv0clw3kwdakps4yBLSSXQwpLOjcTuqS13CP63jMB/JZ9vTOdfWKSg7gLgEJ/PPTqEoO9UKD3WaaICv9ZFhzwn4yv4pIyqqs32ZE1hfnsgO+Zxk+ce2zrC8w1LsqNJZgxycYrq4cy3uJNa/77xU4IxU5YoGsGD6IWmqE5hirrA8llEVESLpXCLTQw7muFlXWvy7V1nlwohfx9dwfWC83GjJTCvy7wsifqe17CDiN3AT503WHRYNIn4Xo7kBvhmEQe3n6MElB4R7h/3mfcN+8/5hv/nAsN98cNhvPhTou2ctGiv0TavKDXEBn79gySOJDtM3iiUOhkj+c9YYkA2/eN7y3D69iOUfb/73angFizXkI8KkX7JYvUjvLOZ7Ci7/fMvSdFY0ennIUl61rPZ4opuaTAmvWa/jQZpLdGHCegNUITk1CG9b71gw3Oq7lhHPOLOHA/t71rJVoh9YAZUoGmg2/JG1+vD9NfzpQfp/2bvMcE1tPwarg9X+7N8Vpn+FkXQCZC5CUWVk8DlzRKTsJyMDXmADToT8qOYrRQJLp9UjApAeV+GWSOPoZ6suz2drRPhT8GtGOF0vWAKvFUEclMNbuY2PDLVyGzP0omb/ZS9q1uPgjfQt7kkVqV4crU9PjW0Q0RwP4E5TNgS+U6sj4Xhf2kaTIpW+WSclnY2YM+qNATlOpvX4IviUSKWXw0TtTdj22VRKv5sywhQ2i2zOI2cLEPaKhXbdigGxNaSTbSJlt1e25cvcjvkJFLaP/MUvVaiJ1Ho7jnUMzmn+0bV66MhKnB5piMyI8FFxZzKoZgHUzKYtbSwPXjMP3hzcZK9csSUyN9LK74mygufx380HRS7wSQAt5Pxv7RDZG3lO6eUm1zd9yPGeGZ7R1tSIQmJfNiMudFJ2b6cYm9+AQvj9Ulc2g98vdZEnYdvG78diThrXlg3XkNC3IbFo22JrLIZTWBYW62KxHhGvutLdKbnOie4shFwmK7WS64Gizoa/PgsnY07yMFFYZHP34Xh7vBCuqa1pEXGF7bkOnG6eLoVMz87Gec2scW7cb9SQGE/GxZpkXMNfdCbj4Rp80UNCPCPUNBohLOKUMsWpck1zW2Pr1IqQ0MnSehyTUlcKc7yOUTVOMlqH0+lOL3LZqBCxnBRjcxtH47ILqb5wDb6MxTUWMmJNS+NKISNewBK0C5ZRQ9IuVOPwO/jLmrmNK4dQAtWtihFVKIh1G2ywRkiJF5M96VxeqXH/1wuJ3F04XuzA7W6dPn0Chr6YjdtZs6a1KVpj21hCzfSvT0rIVg/MdixPwrX4sklIsLukGDFA2SQkOYYo/l2YnHIK71DT1Dg1JPbTpOoHQ1CbvMSMkJBNgjsMSqmnmJdrnL85uIHFEr1Rceem05hxqTUkMS2f2BW3g7/3XI0KdeNTISFhO/9yMl/KpUpuOm4XcNqsibVMaq5vi06oGz9xMW6rnd1s042nWORCG1skNWJizaYyI2rINVozv5U+tXHP9pTyXfkSHqR6DU7OcJIlXAe+SWO48d/MUi8upTdt9+dKXWpNbzpGEktxw3ptcItfKear08kMzivmozOnNe6Om9bL3YvxJd1izYLZe4TCnTgZbnDSEu6PdEKqrYnNrNuT3JUSXVItue4XktvbySpDrq0lfweGNOd8JklrMT91YEhsb18k1tYuOgh/nU6kClItuR6KezpdbA/X4sth5Imdz+En+HoU/iLXIeIhc0woXCTDp9VJi+2Lc2Lt3OZjQ1o7OXvd0ZPo1mr91D9DZnsx3dlV8oZXrXPjEvLx+NtiXqwt5k8MqYkO9w21brr79GRM1h0JcEvWI2lvnNfhpJt/Gn4tnRHrZjaeHpJwqjsh1+HrRnhYyOS2mt0rzuNCQXUzyHhR3Ve4vDDJA/dKIpNf1FNMKXXu/xm4nmy8OyXVNeHr2fgu357PSHVzauc0nhsy3YgiXnPrnBsX0gsxQM5tIFfDPCLRgxc/tlbnpy7FUOA0zMDcsDC2zj30WB1L4WyyTd2Sz6QT/ZfjhuTz3UQgUuu8xPW4l3ra+8Ot+HJrSMB96qaURLEfy5EZpc79f5CU3Iv57PyHcKonJdbNq38Ug9pf6EoV5Trn77EQSqJpj4fCSTwww9Pw5ZmQY3C5JBXvTWnTcGoBST0bEpPxPnFazcLnQlKyK45ZwzRyfRl/mcaMZxq+vBGqcmeOak/sxnNmlTuJRFnOCFFOLsKtyFvTnL+NZqVzi+JT3gzJi5xEMNtK5uzqpflcqprEnLWmNcei5C5K7t4Kqf7T4APMIxLduJnTnL93Q7p7Tx7SPCy8liLT5mCm0VCMF7p600snvo9Zfe+AvHCKjIp6PCo+CJmpZBrPoAmH5Zv1zo3L/z8OySmMhlRGrnf+PgmJqUW2WD8r9ilOleJifSn+KX4nk+5LF+V65+9L/CSTFesz2a9DxPRcbOyJfxOSUiWcHlvvqRaiOBNg8Fv8TbFdrG+t/Q6XViQkIdc7f9+HrFRfgpwoyBezPZm4VU/uotPdu59D4b6M3RfMFHFmME/ucLnu9PG/47RzvFGe7v4hqSOesVPSdHJV0EodaSzs4gdEf+uRLlHh2StN9x9E/QdR54GBwiTATXg6vkSQgkEtFeM5Zbr7X4nEjlJm1enFVIqQTqoYbfPWcNFGb1UwBomd2cyIBiyvkHFapA/GoqpOnEmGcNFfQpR9TeyMF7SGmhY8W9TEJq6MpE6HrTY4OpxVkNqZ9FhWwzR3LK+K5M5UEktZckP9tLo5TasjpTNVIhto/v8aSCjk2Y3YmS6JDenSmijcmbEz4YbGWON4JHTmhIbmdfHTXNpJWMRZDgkZ5NRS1dA8L9ro5ETdetdDQiZZNrszLzTkJyCtM1/tOpXQGvJRNzURA+vk8lnFeBLTfoPztyGGn5D34ozikPncxknIc76A3yB/k1GYREMKN+LLVBS2scRmxLCYGJ0Qw4LbxC2QQhqKR5PS5v43o3AXERJm4MvOSGfxlfQZNLkrErva7dCuSM32YA6FRSe1yUvsihS8cO/G0oYyw/3fDQldNrvBpfelcOl9qSQuJZERZ9Q1pnEuwe4MjN1unM7nc+EZ+JLB6UJ3YdSMtraWaEtPO+ak1bNTmKemc3YWP7NL9urOsxgW7BOl6jZMeDZZbFP2m0PhRXhqDM+KzWnOI2NJqj0bz6U7MEFXLki1R7HQFm3yMvJIxJ+I81pnLiWpDE41LsWVlEqFMKlkH6SlE13pzvyieFab6aRmxbP7onAa85DwTHzZD41IJ3qq8SLFJote19h7xMy6edEmN8sZmPHSEUhKJ4tpW5pJrkciEd/5aTndmcNjTZnk/h+FKSNdctP6JJo8CqldnW5Sm+Sn8Lu5QtZ/lyaPQgoxTi5mN1dnOv/RzY/FVebS4sxc+ngkpPPCzPwJCC1Cs05EjplTmAjlpyPJTsQzcSlGruchYggrtsxouRIZ5B3Mhomob5JXpxF7fXxznqB4jxQv+yoUcWR/TBrd5Hh1qpI8iDr3USfjJiQtwjNkSppFrrciYdFiYdbcO5BOVlqeLNGGk+6AuRMJJZu7lxbZuD5pVgzXtocYzk1dZIebp86K3Y8kkk76N4QKNpUIGWz6gHtXcO5aHkTmIpsBGJkVg+A9jN/tyaTj0ixyfQTp3alUIU4CiiVHzaZJunBIPYpkLGpiGpNnO3+P4ft8CXMHebbz9xQSukuhp5DYXbItN8vjBU8hqRuPobw0m1yfRhLhlX1SY7wttfBZJOK06KT8HX8F14kzSs86b5ZS+E18fQ7JNh6F2ZQcc/6eR2omnekv5HNJtREnWnDiFcyM+sGdnEkv7kkn5Ubn71XMMNJ2IdyILx8iCXPhhE1vwBPdeVINc1icNb0RJ912fYrLy/RmlcbG+U3Rma2fITGT71Qb853OBP85UjL5DGHXSuOcxro50+q/QlKWGHYYTeTqcvavMaPBrJ98oDZ5iW+RY5oXxqvV+PdkrVvCy3e5qaatsab2B6Rl430uKFpTzUIXkh+RiNcKYlN9489IyabwSEwnlSb3/zfknDnvwLhVm+rbaqbPaW77HUOSXhovSk3kGhKUbB4LNMl2pYn8T6vVBBnn4O6Wm5w/XdCzeX+Zqjfl/UWqJYRJPp+Tm7w4E26ePLcxIlTkMGOdUkphHmZXdyUzI5rxfbQtj2dMkhWdMa2xQtDxS55sXYmf47ViL57o3eJG4+JwVvl8Oxturok1jcHpFOZTzfVzmscKUi7Vm09KzeS6Gr7rTOf63GtUEHPprNiczo4nqT6c6lsHf2un8biKzYytK+iu+TPu4IQxx09W100QwvhBIEvKJ/A0Is2pw9eJ+IVkOheegy8bCDLZIU9k5Dn4r66xWiAqjdxiDK1KcubixCQhHLgX8kuFOUs3EuRCHC9SCkpLTevMjRpaNnYybCwktjh/m5N7wrvwPfnbUjBdkN1cy4Uw6j/U3GzMzrUWP7W1IBbszLiWmrbWOY0eNrHERkWPbXEVCaI6U1rqqmvwf60gFPrYjV5I5QuZFKFrvcVJ1uHkNEEqDMgKF7CQE27Bl3pcaFcBczMZs1nMzqZj0LD4U6ruyWbUFpKa19Q4U1CdTD5PKmTsxbi9jRvF5jbOxtXnl6SKjlJObyHJuSTZiGFczN0rWY9YYab7saM2cPMd3UEzznejn2A86C00OUfwdJdyi/PX4txnCTD4b27jPOc7ooFOY5FxEkvPF8iObynf3tNR2UISiXwmWtuDBe6ivZAYwpDgi3LM+WsXwqUl6c5wG74kcNf0dIotPZ0lXFVPoZAqyS3O354YX5gFO+turQWnaklqL/xWewemHz7LseKVW5y/fTFi+mlaXuzKzHPHHyAIi23nHy2umhud0J1s3yBKFlW4itTEAwVxcTYjzm1qPBhTKp5ow3Px5RABFVHroYKMZ49uDFqr83eYIBa72Q1RhpRwB7aSyCXRuvGnC5ITxARkiIvsPq01hWX16KzYwrMFsUTv22ILr8Dlp+J4EpNbnb8rhXAx1ZkPt+LL1biwVA43qDWVW6/Qfw2uGtyoRY9Fq60eg74Bv5CywW2YyPtji6kYXjzhq+NnF6MuSQTEiQ/it9MFsTVdeAiXhdfVZAGltnqJh4UIySt1kB2TJflidwV5UopO9++fwcCRnIH5eC1sl/AK2C69IIh23BZjNbEPhDCJyekLrPg68RPB8lyruKp5y6HOqHf3uaDbXYM9cn2yDPJQsrN45Esxcv1K0MhdBq+9u7WYn/rW9woix5y/HzGYuP9jTY0/ka8zuUUyTm/UPOsnQbWxMINXlP0jY14iOqGe2PemerITf8bf5TPln1j4iesx1Fkkx7w7Z6r8FX+XyQ3My/ePieVxMXWuIzy6zpr4O0ZGIdOT667Gf3rMSUZjLY0hUbQXd6wZmzt9Kyw4x0s9dnRuTz463VM3RyfU4CkxuslEQVRtLBEUi6mMGvMSohgmW1xh/F1OEiXitCqukULi0ZpkXhWldCphl1ZjRBMlVBOdMLO+LrrZ5MmbTK7eZKImWnYPic6Wz2AUpIpWjNzVeXe6iCUYsuoLZkv2knRHSYqRa0RU7H4bL6WTK8fc/2gC6m4d5FSJVmkq0GFYbVM5/YWEnybsMTjXgdHHm+3oHseKQmnqoM+k3vYcHtzzayc1p0rjnJJ628u9Pb924pqiWIoXxLaalrVwCi942hKZ8ThVmjKCLonb8vlMd7oUnbKOGC7l8eqrbU5T47qiXCqmsnit3ub8rS8qZJnTjddq3v/6+O1ivt+5rC8SkTnPROa8O543FtWS7SJHbYu5gurGotmTwwwk4ynB5jk37vtTRKWnbLbQkxjwYt5hWxXz5kRdzuU+mSqiXjR/KzHci1cO4fn4sp2o+nYb6nwvMV0k1rppPGco893/BvwFln/C87HEM0MUe7Ecgn8zRbM3bfcQJ7aEeZvznZuow8lni0Jve2g2frc9Ls6vrZkt6ksw7/aQsAAnXYgaxfASPAUYeM3nq4mbRQWvBolqVyErwZnTGltEGedwGeElnXhZuqAh1tiK0+nutLEAX6KuemwhLiGfIayucoH7H/W1FTuIBtlMwSJyKZ0goixN7yAKufZRICPanC+l2vP5bvxkSSa0A64Hs+/wAnzZWZT6UhjF0kJy7RY15y7R057SnJw6nOoWw335RfnKhfgSndBaX9PoYGliRpTdXTl5oTOvHy+G+zFw4R1qmhtOEMWl6U5xx3TniaJJ1lk+2CZZWfkyzkl4BGQCOf8PRG6zlrl6CQA=";
+export const GRAMMARS_DATA = "H4sIAAAAAAAAA3x9B5gWtfPwbPLuLlWQenQEjqZUUXoTkSog8EMEFCxYQKVL5yhSpUgHAVEQpEsv0qSjNEGEo4r0oohKkaJ8ZDO7O9l5/989jy43l2yyk8n0TOo3qlXHAoAWjwFUA4BpEqB2HgtuZAbIW8mCmtkA2tQQ0N8C6DpPQGsJ0HWngPd/FdB1pAsxAMgO+ke9ByRAbgDogrCHDx8+tATAWABoR2DqeR8AbAIT+JI8kXZ5LIB8ACB8mAVQywJIqYfTfS2Aly2AqTnJuBbAjVwARen7LIDsuQHSAnhz92HFcwPkwPn4sKa59e82mcsruQHcyPza5AZwIrC3cwNkRpgaR02+d26AYqDbevMDgCW5AapGYL/n1jh1yVzS5dF91btGqddZAJXyAGwGgBQIU9/7MA9AfhzXh+XLy+dcJK/uR2Gl8moaAJyPGrdTXoDaCHPxO9blBahD19wCEE8APG+Z73shH0D5yBhJ+QAyRWDj8wE0o/QCAFfyAZSNwPLmB9hrmbDfCmjaoO97LFGvL4XlSNS0QmG5EwHSR8YongiQLdKuViJA6giscSJAlghdvZsIkIvSswUwODEyPwvg60SAVyO4ihUCeJ7OxQKoXUjTPp3fO4UBigsTNrEoQP3Id/xaFKBSZM65ngRYGzPb/VwCoEqkb8aSAI9F+j5RMqRnDyYAni0JUDCyZ1qVBKgR6TuzJEAC6P2aBmloQ0mAxyN42VcyXPO02C5WKoJnxW9KAbyAsMeQxtuU0v+OkXYflgJIFdm/PUoBfBB534VSABlwH/mwOwhLRemqtEkvHg2VjuAFAJ4uzfdbhdIAy3NqOlIw+Yif3mygx1Q4Cd7bQO899f0+ftI1xH1G3pe+IcAh7JsB9+HZhvo9FAd/NdR4Vz8Z8Xm/Yciz/XaZGwGki8AKNAL4KaVJG3deAegdoZfOLQAScS0ULiwJMLuF/g6K+/ktOP7WtQAoiTSZBdfyymsAN6UJO/UGwF8UBgAH3tbflI7smd/eBmgrzfm91M6UKQrWsZ3mu3Qu37TjfGNDO3MvqK33QzuNc7oXTrYDaB4Zo0x7Trt122vaSE/avdI+jkxpz+c3s72en0tgi9prmqKwNe01figdrG3Pedg2hD1OYD+353wyuT1A4ci3wfv827K8D/BJhK99+QFAAWHCdnQAeCwC+6kTx/2ZTgDVKUwCPNEZIG8E99XjwF7vzGXyO51N/qzo5ePOAOcj3/ZuF03PtN2oLpExLIDFXUw6UH03dwn3mw/b3cX8No/vdgEoE4Gl7GqOq57Fu0b45KMxqnYNx0B1x4D5tF67K8DLoNdYfbeUADO7ap6TjrT7uitABfx3btxbv3YFmG6ZNETHKBRnjLw4Rt+PkM9T2iXj+voJfV/+OO8rgO8b/hHAX6isPAFa6eudpP8tyJrT78iH3zE9CWBLhNZeHWjSrmrXZSBAXYQl4hgbBwLcon0tgOWDNY7o+34cbNKGet+NwaZcjeLAxx+dc0Gcc/EhAEcifWNDAY5HYKeHAnwUgTUdBpA7rQnrPJHvj3ETTb1EjbtyotaB6fcemBjSeBHQCP91YmTvC4A7E7WsTE1g1iSArRaBKZ4zGeDNiO5dcApAy8hcBkzRfDcD6TtxCkDJyPfumKLHzUj51RSAyTGtZ/pjdJ8BMJTCAOC/LyO6qAWQYRbnxdlmAZSLwF6axeVlmziwDlGYBdBvFkAJIgM8XjJL4z496bt7lt4XmUm7v2dp2lGwJ0ETTPbZAKUj7erP1nqskr9PY7u2szVvp7h6d3aENh7pQcNmAwyP4O/xeQBNI+3azgvXozTumYnzQlwVQ9i+eQC1Iu0yzY/wNQmQOF/rieqnONJa5fkAwyLrtmNxqMs8he2SF4f0XBJh9xaHMq8UwuwlEdkNAFmXANR1zDV6fWVET7QA9q8EKGqF+oaC/bMK50rpebWmIYrnYqsB6mG7EvjssZrzkkmrub2wdjVAYcu0f8+sARgm9D708ffht5rv+uMq+6PXtwCLrdC+VLBCGwAKWmE7pYu+uBEgXwTWYZO2s/25CAmwejNAOwJT7fJuAWgU+Y6OW7iu138Lt62mbjHlpXrO2qL3flYIZeTKLSHenkEaOoftfB1T4efPLaHN6dutRbcC9ME5Pwt6L8zdxmXU8m0ApxBWFtv578tI3jdmO8B0/LdP60/uAOiJY5RHufTVTr1nKK/7ZyfSIlmPIrsitrgFUGoX18PK7Ar3jJIZQgDU3MXx12CXliVqzhVxLl13cb7WG/uqdpXQp/DxLi13bTK/ebu0rkBhu3ZF9DUL4PAubnOm381tydy7ATqD3uuV8W/jd+t50nYTd4f8uQqux/zdHC+Ldod4qYbtNu5Gvwtpt4W0ew7bHdodsYWUDRGd86N9dG836h4EluP7kA89j+8r/j3H8zPfA/yHsJqgaffpH0JYdYSV2hPy2KoIG7xHf1M2ss+/3wOwHtvVwHbUD1cbuB9O2cvKD/fxXoCuCPN4sgD4Z6/GaXYiux/uNXV+9Sy0L2JDCIDS+/TcchBfUPN9oU1cB+nUb6f01W5St+u5L1zfupF2Sl8die2m7AvxXC/SLrf/vRbAatKufqSdb5uqdt+TcV+MtMtD5OU18r4G2O6/fVqu+bxYwZ7cr/cR1XPK7NdygsqtGghLR2CN93M6bbYf4FZE9673I8Ao24Ql/8xtv3M/I38ksIQjoVz1YSWPAHyIfgYf9vkRrqssPqLxFvhZH+2drUc4z9kT7QsAx4/wbzt9hNuhV46EdowvR+yjpm9YPVMd5b7hIgT2kk//R7lv6ZWj3O/4wVE+lx5HQ17cGJ/9j8aRW2SMJvhccJTbsGsIzN/b249qeqLtMiSH7/N9ofmTue1XJpnjvnIy/47ayaEv7WV8JiVrmUrbTUoObS8fti6Z64THklF2KvsJ6T/dsdAOeAVhicfCtWyBsOrHQru2JcLePqZlhS9TlB4xC9tlILBdx0L7yF9L67jJY9X7UhzXe1nt11Y4xv+O672ahrQbeBygNcGLkmW/4vuoHnE5DuyP45onxggs6wlN9/6c1fsKntD9qO3y5IlwXX0/0YAToW/kfziXOac0r6I+mRWnuJ962ylNp1Qm7zkF8Bm+z/tGpfOfAXgWYa8jbNrZUPa0Bb25p54DaCMIDADuXtDj5qV2KJEznYDLmbdRzqS5qGniCbJuH1wE6IXt3sHnpYsAAyPr+96lkP7eRf/f8EshD3sPZc2Xl0I6eBef8y6FtmQ79EXKy1p/yIvfpt5X/bLWkfL5fS2AdpfDvd8en50vhz6o97HvisuaJ6YheNl9GWAd4q8N4mXANYCaCHsDYTt/B7iLjOhNHHezsOA4KqNv+euRzgrsgA/xuT6dpd+t7ErQRJ4jvQU9yFwUXsantzybWME6YvsZ6S3PBlAw366Znd6CXRE50y6D5dEtjUf1yWB5PCczgQ3OYDFdb0sGy/QBKLmQwfLWLTOBnctgQcWYOW7urHzckln1+xzSrkJWPRcKq5HV8vYLnV/TrJb2V5B2fbNazCc4CN9H6W9kVsuIYSi750BWy5A9ar9dxznT90GCxeSWnWDpdSWw9xIsKJci3B8ePee14DqxQxVsTCELbkTiPUlFLTgVieO0KmEFurwPa1vCgi4pzHbJZS2P7ulc/itrMfmRspyldWTyvfXKWYENFtiX5SxmRw0pF+KqG9LpnHKWEZtQfVeVs5iuvKGcBRcIzMNLeUv7Oghsb3k+56PlLdNHIQGerGAFPoruyDdaVrC8edDYROsKFrM/Xq9gBXJf7THVuVcFS+9l0u5kBSuQoT3xex9WMPGixk1d0TL0CAUrUNHEs4K9XdHy7DY6xpcVLUiZ1owbLKhtBTFhH3a0tuXZb8H7LID7ta3AF+TjPlMdK/DJ+H1b1rGYftWrjsV0mqF1LNNvIQHm1NFjBP4rAbCpjuXpXBR2qI7FbIhTdSzDF67e93hdy4tv0XHP1bWgX+TbXq9nsThE93oW05uG1eNznlvPpCsFO1jPgkWRvn3rW9pvRWDf1Of871p9TpO361vwRmT/Nm/I6b51Q4vlQrzV0DL8jkofmt5Q025q0u6Lhpah23q+3IZWoG8onKm+qRqZ71PtnmtkmbEOJZsbWXAaYUnYt+ZL5pxVu/ovhfTcH9u1fcnksapd+5c4XY2IA5v/EufP37xkaTmp9CUcI0Nj3i6hscV02xKNLS/3Q+3NGkLbMG80NmWU2gvvN+Z8vF9jzg/6N7YCXX8g6ms/NbaYjXO0MZcBJ+PM+WxjK7CZPsbnn41DXjIYn5ma8LlkaWIxOyBPE0vzW8WD8TmhifltSh+a28Qy/fwCYEsTC/6O5Bqs/J/FYgRH/qd5DoXJZpF2j/TYxGYmrSnkv9rMYnHTDs0icloCTGlmBf6DT0Dz3cXNrEAHHo7Pjc3CPTgCtN50t5lec+qjzf+yZeRHqKcfn6awDi9bRnxQzW/ky5xOF75sBX4rH3b5ZQs+jcB6NLdMO0AA9G3O+ca65pzH7myueQmVUQebW8z3dbh5qF+Nwr/RGFoOjKH91tyCzMLUuayWGs8FCCxXSwvWZDb9Foc7WrAuZsYmRnWzghjWaHyu7GaxnKIN3azAHvRpI7kb589XuoW4H4NPGh8cG+fbPsVvcz6y4KVI3Pnl7pwffNhd40rNcRz+bUh3vlc/6W4F/j+/3dQ471vaXa9bRrK+G7EvjUvu6a7lDPWv3e5uBb6lQOfqofGSSGD5e5gyXsEa9dB9abs3e2g5SPXinvg+aoeO6GF5/j/a7r8elqcXZSewhz0sL65BfUvFelrM31Sup8VyEmr25DLZp136HS17ar5WkMDa9tRzKURgH/TUa0TjKZ17cr77UU+LxdkH9YzIZAtgdE8tz+lcqC05GZ/f9dR7VfWfhLLnQU8ryJHz+VWlXhHaEABNelmGP0zR/Ru9LM92pfPbE+2r5EIvi+W+ZettGfkgnh7Rm+veb/W2mK+ga2++HiN6h7iaAprHTu7N9+/M3haLb+3rbUGVyH5L3TciZyyAXH0tSBtpV7SfFfiRfFibfrov5XWd+4V89zOc39h+FnwRiZGWSrKCmI0Pe6w/15/r9Le0753ARve3PB9fYQK72F/bENT/QuXR5ziXCgOswC8wHWG9B4T2xwzQ8ujAgIj8kADXozALIO1AC/pG12igFfD0h5hHm3WQxfyYTw7S86Myr9ogU79Xz6HYl7abNojrrHMHWZAUyZlIHGLByzET1meEKbvVUs8ZEZGhyl88IiK3BMCOEZzv/jDCtF3U/K6PsOBaShN2bIJl5gtYAGUmRvQIC+DViVzPfmsi/94OE8P1+BKfoyeGMmoWaIY+c6IF1xyz74jpFryRYMJ+W2lBAdeEpd9gMR9ykQ1WEFP0YZ02WNAnAvt9g97nNG5wd4PFcljSbeR6RM6NppxRvowSGy3Dp6ro6r2NWm45pF33jRH8qdyFjSH/+wr9YZs2WnA4vbke4/ZbRrzM85vttwy/t4JZB7gukOGAuX9VuxcP8LVsekDPWRLYGwc0L1EkMxfbdz3AdWWf3xfx40xKnzgQ4vRrfM49wOX5SgKbh7Sx9YDFcmKSD2hbg/q+zpJ2ft9/DlienaV+5oPmJd1/tIJ8gfmI560/hjLAb2cdtOCCZcIuHuL8/sEhC/JGeHHOw3x+BQ9bZr68BGh0ONTvF+CcOx+2gvymxTju0sPhHlyI7Y4dtlh89e/DXHbfOWwF/t1F2Dfdz5YZg7QAyv5sQdkIb/rwqPaBAtkLF49axhkE9XwlWfMmyts/SrZgKslRUnhOdzzUbX3Ys8e1zRQjsJeOa1+aQ2Ddj1te/JDCFhzX81Pft8TPyT+h7e6ilMZPaB/FkwTW4URETxQAA09EeKwFMPNEuD+W+rR7QusCNC9o9Qmtcxm5oSc033BIux0nQt1iGT4Pngj35XJ8pjnJx8h5ko+RG9vRMYqf1PpGBgJ7FvsaOmYcWIWTEV1U+ShOanpWPyvw2fBkOOeV+Bxx0vRnq77jT1pG7MnLuzlpsbzrdSe1LKP6Mx13FT43xMHBppPhXliNz+SToTzfiPvoN4UrHHgd7oUHp0J9w4dVPq11M5UD9S3GXXqetsDFvuuxXf9fQn3Sh635xYKs2G4DwvafsYLclLU4l4dnLHgNSDtlx//KeUnfs+Y+V3HxyWctI0al/jbzrMY91UHmnQ111u/98c+GuugmfH53NtTDvsf5/XxWyw9KGxdJu834vH82og8JE/f++yjut8TBvQ977hzXleueC32MW9HXTNdoG67Ru+e43t71nBXEvLZj3wnntO9a9d0RZ3134lx8WSbI++ia++22n7OCczuDMLeC0sGuOHTwXRw62IV0kPa8adurZ5Hzodzy5UfX85YXk6WwH89zeX70fMjXduO4N89bQV5VYA9e5PxvxEULfou876NLfH7jLlkwPgJLvKz3KqXTQpdDXPmwjpctlsvU77LFcvimX9a4ojrDvctc76Q25z582ldCWbsH16PQFQuKIA72Iu4bXY341yyAYVctlqM0/2okXqFk3TW936gdleOaZeYwWwAVr1kezdK+/12zdM4ltel+4/T87G8R37rKyY/CJMDI3yxoSGOGEuDEbxGdUAD89psFwyL+ya7XLZZj+PH1SCxB8ZLrkXFVLOF6ZP8KgGvXOZ3W+sNiuTOt/7ACPu/zukw3NK0VI++rdIP7fJ+7YcHz0oQN+duCnyJ62Cs3eXzmi5tWkMvhr9Gdm5aOw/8fdHUYn+/eCnX+H0HvrVm3Ql3+INLa2VtaN6O0cfFWGA/9CZ9FbltBvs0hfF+v21aQv+PDfrjN8Xf2tmXkkKpn/X8slhPz2T8R34PiC/9YZn6TAPj3H9P/rGB57nIfQIu7EToVAG/fjexflSN31wryE/y+1+7yGMvDu5wfpL1nsTMcpe9F6E/Zpvd03I/65mbe07oe9b0uv2eBndocd40tDN7kodIRnh8pE4FldQSzOUs6wjiTqdq95wj2Hd0dEZyx82G+H0StyQlc3z2OYHz8kCMCPB/F52kybjJoWsvqCuPcp4J94ApmG3RyRRCzPoZ9J7uC7a0ZLv+OhW6IA//8xHZXBLldfrssKQSzQwulEF5OEYV1TSFY/PdICsHiR5dTCIPuPZMlpTlnBXNSCo92lb1xEmVGYWxHfaDF47RrhDCFm1ORvtSn2vn/064ExR+289YL221OKUwZaoV9S5K+v2BfpTf8gn3tVBqnNP85SyphxKJV3xKphHEmzrMDUglPHlFYs1SC7cF2qfgarUkljBxrbz1SCcaHIDWnXTe1YD6UTKnNcVXcr3BqwXIly6YWhvxVOGieWni6CsVBt9QCelgm7Pc0guUc308j2HmcLGkFvIv27znMb+qXTsDjNMYsAcY8LmB4BJaQSeg4GYH5uRDBGAJgVibBdOUrmTj+rMwi0FvOYyxmf2Zh8FjlRzqe2aQhJS9vZ9a0UZrkDWfJIjzZpPB6Eb/tYhYRyFoFUzJ5Wlbh6cMU1iZBGLkpXu5MgvDe/zjB35YEEdgEft/+2URgv/nfNiIObEI2wfSNr7JpeklHcLUsm/B0JP88sYobnMom2BnUB9kEO4ebJbtgdkXu7JzXFcjO+dUzcWAvZBfM99Uwu6ZdRatXMI79WnZNa/kJjffMLljcuXd24dm/6puv4t/6ZRcs/jExDmxRdmH6aAXAz9kFi4Ndzi6Mc6Te+bycgp21HJyT893JOTmeV+cUno5JYXYuwfTYUnFgr+YSLDbRIRfHaY9cgun3g3IJLwdW/VzH56lcwrPVKQ58P6H6+QOfk3ML2I//vgGaobbNE+LKh/XII4J4vA+bk0cE58J9ul+GMOpD3piHy8s92I76RnydkOqnR/MInSdPYKnyClZLoHZeAQci7bI+IYyz0h5OnzD5hhdPiQMb+gSnl8/iwBY/wXmY77elsJtPCFbXIGU+vi/z5xNBDt9fuGeG5jPpSj2P5BNwJwLbl5/zpgf5hRHjU8+nC0T4vTp3EAf2XgEuoz4qIAy9U+3baQUies4j/er3AsLLY6VzeSVReLlx9H0/JnJ+fzlRMN02bcHIHlT1Wwry9ShdUBhntSBip9zEZ7WCej1oTYn/FdR08LTvI1M+34KCnZccjn3LENisgoLlavxSkPPTCwVNea7wcrOgYPGtXIX4t5UsJJg/4sVCJp7Vc10hLuN3xYH9XIiv79lCgtWZuFPI1Dc8GV9YMH/xk4U5Hy9WWDDfZvHCWvZQnD5bWLA4XcXC4b78B5+1CgvvDJQa5y7of3xSWMvLxwn+phXmeF5QWLAz8ysK8zVaV1h4dqj65nuoNzwoLLz1foKuRxHB8kVbFhEsJtKpCOfZfYpoHCgZlyD1d3xcRLAY7uwiXAYsKsJ1ZUrjD/G5m/R9gLg6WMS06RQse1Fh2rCP5OX/ivL1aFFUBOfA/wWNmB+LahxQHfN+Ub1u6pv/Qx7mPilgQCSeMqyYYD6tucUEizt/W0wY57EVnq/G6ZuiuAjy831Yx+L6fTR39ePiXJc/WDzUabwFV/KouAh8VR5MAogS4Zr7sGIlBKvRU6OEMPwHyofSo0Rkzo900UlxYCtLcH38QAlhxlJVXaqSgtWKKFJSGPkHqt2HJbmt27kk1+EGlRQshjajpN4LDsaTvDPBJTkv/qskp/F/S2o+LpAGFK7yldL6GrW3ypfSMkpg7otq17GUYL6+PqU0Drx4B7ZbXUp4sS0KO1NKsFyca6W0ba/GtfE7Hi8tvDwAGtt5prQel8Kql9a8k8IalhYwKYVJ9xcqCKggTJ0mT2UBuxwTdrGG8GwYCrvygqYD+j63loBrkXH/qiU8vzhtt662xkuAUwnwd21h5kSr99XRMJfQRo46/NuKxIGVjQOrWSeie6u6THVC2vDWQwB8WIfzsO51hBmn8/K9NZ3S/KtP6giW5zGvDudNi3GMUgS2ug6n+2/rcLtnax0R5F2nQGF1s44IfKApka7q1dX6ldo3qZCGetUVZu0YFfuqK9jZB1rzLI3Fa56lRVz9WlfAtEjdnj71NL+iOvX39UxdT73vn3oiOFPlw16tr/FC9aG36wsjh88bo35E7qs8qPrCO4OnftIhXq7XFyzH5s/6Jr9STdO8GOF/6nzei8LIafPqb7wojDwUBfv3RQHNI3bZ/xoKnZ9FYH80NP0vCpa3UUQvsQCebsTtt5qN9D6nOR0vYV8ae3+rEedrHRoJdga1XyPB/LvTH407Dr/jcVzz4o0FzEBYBlzzPU24D+DnJnz/XmkiWKyodFOuw1VtGs45E47l67ZqTTIi7MWm4XdkRlirpiI4k+a/b1dTYdaMU7L9f8KMYah8/v8JGJ/VhN17X8DaSC7T8i4iyHvIjng51oXv6dNdQj9hgqXPRUNXEeTGZ8N92aRr6Kfx+yZ0i9D9Ix3piW6C5VhX68bXsmE3rgO/1Y378NojjOYadO7Gec5H3URQ88enje8ezW84gSn5WOcjoXkN6du4u8ljPT96d+GdeaTttnbnemdyd8HO1kMPTi9pewgvV5La3TV6hDZnLkvL73E9hJffnobM+XQPTVe07sfVHlpXpu/L3VPj5VmCgzI99ZqXJbC62K4cgbVGWHkC64B9KxDY+J4R/eWRbra4p7nmioT29jTXUsF+6inYuZjknpxe7vTk8uNhzxCnebF+SppeZjsFy9TLpDURrU2Fa09zz1WtFKUr5O8lIHUkL7J4P067lftxOqW2QUEc4/l+od+iAO7BT/qF35uIe2tBnDHW9dO0QXXqFEkCvom0W5PE5f53SZwXH0riPPZUUsTGUWcukrStRvWDh0nc95++v2C5zoX6C1a/s05/wXKEk/rz9R3aP0JXKheif0TGS4Bd/QXMjvRtN4DrL0MHcHk5a4BgtTWvDzB1CwUrMVB4Z7jp+z4eKHQeDYFVGiS8nHLKm3oM0vYChU0ZJIz4vojYkk8hvfw4KPRZFkV6eTAolBVPoix752PhndGic7n0cUhXfg0NZ7DwcgzVHihm6ZyTmoOFGYcVAF0GCzNHTvnhBpv04uUDD9YylOpN3ww2fTJqjN8Ga3qhutS/gwWrTZB3CKfT0kMifrhH8x4wROPFqLE1JOIzsgB2D9F+Lgo7M0QE57ECOTOU2z0d48D6xIENG8r9rJOGat4pKe2S9S0VZ31LxFnfkri+nw01bXEF+2GoYHH2MsP1/Kj8rTbclFuqy9ThIjhz47crOkKw2iKtR3B7teMIHhtLGsH1iI9HhLyuNM5zzwi+z38aIYJ4/NPYrsInIa3VQP9FzU84X2vwiaYhur6dPjFpVz2nfMLH/eITzrO//kQEZ+p9XGUdGfGVWgAlRmr/GuWJJUfy95UdGfrRy+K3tRspWG53/5EiyL96BtudHhnqEc8izBml46tUBvjjUh9Znjjtyo3itgut99DA4vUeyiOPoHZUhTh2VEWL5zpXsnius4JFc539djTX2YfRWhF+X1ororLFa0VUwne8Myq0o9R5FuU/9etCVCRj0LoQVbHv/lFC2wlKV8Vxz4wWusaGsqkQL9XHhDZENzTQ6o3RNnZagueWYzRfo7APxnBe0nOMCOqXPIfzSx7D6f7XMRF7UMVox4T7vAbOvfKnIf357+v4Kfe9fvRpKI+eR11qyacioAO/7xNjed9CY82cE9WuzdiQ1vy+Y8ZyHX38WB2bSCB9U40L4xp+31bjIvxFnQ0fx9/n4562azsujFvVwffNHieCc5o+7JdxWm7ROnw5x2sfGdVzmowPv9fvO3J8GO/xYdviwO6ND/Nu/G+rNoHbBi9OEFreq2/C9eg+MeSTdbEvrXnmz+/0RMFqXlyaGPLs+vi+2xNDu7YmjlV1koCRCHvB59mTRFCL/xDy4sOTQnvfryF4aZLGvWpXG2F3JoU87EWcc57JGs+SzK/VZBHcH+DnSe+cHNqcPszf5/nIfss2RQT8paFltqvkn5tQcmuKCHLQGkXaqfncxr9tIe97KdKuIjlPkmZqSKeNI+0UvZVBHLwxNdQxm0TaVSV1B1dPFUF+XdNIu2okNpbqs/B9/4u0U3prORy3BWnXLNLuOZ/fKx/eZ6F+9bKvg3wmzNx9tQemhfhrju0aTwvzryz8X/tpguWpjpwW+sz9tVw0LSKn1Xn7aTyn7bdpnOf8NS2k8VfwO+5PC3mxjyt7ugjqC7TAOb87PRzXn8uY6YLlslOZ4r+PxvJb4riTpwt23m/1dK437UKYcQ4yWrtXjTFdsNrCWWZoPdGI95Dv9e8beG4Gt7femiHMc3dKZ51hxuiV/XFmhgjqC/jt/vc5f1/3z0VQ06k1+ijufi5gSMTfRPH3Fs4vaU5ol72O6zF9TqgPvYF6xPI5XOatn6N9cyouMhTz20/N4XrdhTnheryJ74vNFWYNU3X/x1xtL9B6Rh3m6nEp3feYq/ka1fWGzRWe7kHH3fG1iWelH1z5WrA674Xncbun3jxtd9O6g+/M07kfQd0jC2DCPBHUk2mLus+RedonSNuVnh/mM7yN7SbN5z6FOfO5z+3b+ZH9q/JB5+tx6Ri5Fgh2jvlsnHNyTRdw+uuxILRn3kE6mLcg1NfexXWzF5o5OwpcaiGnDerPaR/Hn9MO/TkVFgqIReKhVRYLyBXJ2W65lMf3dy3l8ctMywTLr0tYFllfAVBxGbdrX1zG/RHvLovo6Iq/LBNeTiiFdVmuc49Sk777lmtdj8JgBc8NECtC2d1R4UXFzlaEvpZOiL8SK3jMofQKrnM9u4Lz50oreCyw1opQ3+2MYzRZEeKgC8I+XMFtyS5xvqPbCu5vGrkitNW64vu+ijPneWSMbr4cXMHpavWKUDf7CNttW8FzTiiv647tYKWAQfjPHqhzDVoZyreeCJu+UrD6onNWanmpvqUX7o8dK7X8SE1wemSlCGoO9Mb3VV2l50zfV3+VMM7/qr4tVgnzXJHSqVeFeQB98H3dVgmv7h+g7qP2/olHfYcirAPaR9SWTIpjS/a1eI3afrjP31gtgno4Sfi+S6tDGeXDqq4JbRwLY+NT1oTtuuH8bqwJc/MyIKzuWr0/VEzlG+zbf622A1Ts/gMc47u12g+i9PQPEXZ3rWDnnbOv03RPzwDmXRfKy/6Iv+fW8VjCK+sifkwBkLROsBoQm9YJdkfQqW+FUVNRwVqv57Gs99YLdgfFjPXc5ztvvemLVHM5E4GpvgkbhBePpPGFQhv1PqJnbp/aKIIzqj7s5EbB9JwHG3nM651N3CbuskkwG+fjTfx7R2/iNvHYTaGc+di3mTaF+t8QhF3exH14tzeFfHI0tku5Wft9qA6XajOXl09uDu1Q/1xTxc2h3Tgc39d1s4AD+Peh+KyxhfuR6m4J122EH1vcEn7HJ/i+PluEeb5b5fZsEaweSvIWHq+9tiUSU3+koz+1VXj5XpRHULyMjOCFntOk3zYK93niNmGe9VXn37aFsmcwtqu+zZShXr20bcI7r0bPQRbaHolXCIAa28M17ym1ftplu9D+VdJ31g5O48d3CHaXxr0dgtWXemFn2K4nEt3bO0O904cN3mnKHjX34Tv5Hpywk+cBzN+p+Ybq8ynO3a+VQ+nvu53hnvHj3nt3hjQ0HmG0nf9tP+3U/C+4F0D56HeJwIfn87rRu4RXp5LmsPT7QWibnsD27BGQLEL9WcFm7xde7g+N7887IOA1y9QnnYN8T6c/yPMFch40bUS1vs8c1Gtp1KM9GNLGRLRThh/Utj3Ngz98kPuzzx3UuT1Kjk5CGs91KBInUbkphzQd0LOg7Q/xnOP+hwTUjeidPxwW8FoEVvgoz9949Sjnk7uPCna+8cejgtVfO3tUn7mgfZcnC6/uGuUHlY8Jo3aRes49pvFHefvWY5w/7z+m7QAqF+zjPFct63Hul8p7PJSN/p4pe5zTQfXjXCd84bjGvYoxzMT17XJc8xcfRtupnxnYrttxnSOnhlyO6/vZcb2+dC13HxesruTF42GMYBb2bXYi1PV82LET3Bd55UTkjI6Sbye5beCf26G1NQefjOT9q3s3T3JcUV10LuJg2smQn36BPHbTSaHrmao+qJuVPRXxvzyiq0anNB3QmBI9H+p/7/unBNyI8NhWv3Cduu0vfC3b/RL6vWfjO77/JfQ3fYVjZD0T+hN9eql6htsffp0JCqt5RvvrlL9tDr5vxhkBPQV5nzqndE7oGAfp2+i8eV7Ss6fPm/k5iq6OnxdG7SL1fOYC9+8+d0HjmdbzbXlBsJom+y/w9aW0+4LAGMEFvi/PX9B7S9HLPPQB3I/Tzr0ogtoYC7DdUxdD/XkZ4mrIRa7nfH1R05XyI89Hujp6UefdKLt9IdKVX3unLqErv6ZOPcqvEKbk7SJ8X+tL2kYM7gGUAL0IbCnGdiZeCm2XxTjn+Ze4X2/ZpdB2WYL2b7nLuh3lidUu8zjx9sv87Mjpy5yez10OZfw3SEvXL/OzBdaVMDdvKdoa1a9oWUbvPex5ReM+PYF9dkXj+UWClxtXtG3QgMB6XxVezcWGBJb5mo7NNvJhAuD9azqvrxFpN+OaHvcl0m7vNcFqwZ2+xnP8L10TUESY7dJf53ZUqethXM0fd9x1E88Ktui6qeupuexGWGNCB/9d1zw7gAmAnH8Iry46bTf8D00vFAcz/oi8T92Hi+0oDvbFaXcFYRT39g1t59Fxn7yheRhdjyY3tM5K2w26ofFcgOB04g0zr0W1W34jch5CApy6Ye5z1ffKDZ4T4/zJ/Sop/gzf59Pk039G+JAFUPlPM5dOjbHzT54nk+Mvzv8K/yW8Wn/q5zPcq7v/CvWmaQg79Vfoh5uOsDp/h+cmPkfYx3+bPnPFi7f+LdgdRgf+5rbVkb85Tzz7d+iTXoFj/PO3xgG1hcTNkE+uRN2i1U0+7ns3uRzsfDOSx6hk0M1w3FV+3PQm98EvuxnqFqt9u/Ymz5s7c5P7yO7c1OubSGRevlvCrMWvbL9b3G9W8lYYT16D4755K7TPfZnc9RaXyb1uhWcp1iKuVt7ivNOvwWTAbvE8ywO3wvNq6/B9N2/xszwZb0fyd9Ua3eZxg7duh3G/9fht39zm+2PZ7ZBnb8B2f94Wwd0Xfrv2d4S2ewnsn38EqxH/+F1+nqnSXX7G/YO7fB/1uhvqTT7s2N1wH32H87t+l9Pfnbth/v0mbFfkXqhzbUYfXvd7oV/Ah629Z8oyz/a7F6dWxD3tj6U+6av3eJyp9X3B7nMYdl/TXxMC+/Q+j43tv2/mbHtxiPtcV5EP9FrSOI79QNOuGnsX4iDLAwHDsO9WhH3+QH+H307R2uoHoU64DdtR3Ww7wmjuzA6L587stHjujD8XmjuzK07ujN+O5s74sAcP9N6iPhnrX+H5ayleOv5n+gnVXL76T+/VpqTdxf8i56eVnf+Q67sfPOR7q9tDnrc5LQ5sy0PB6ro8eMj5cwqQ3rcF8TLPVpfe3dX0LqthIL050/ySlSCD9fD5302QzP8nLMnys8tZ0tPLHJKXVsuSgT70A9LGK5Y0c8+VH8SSJk2qml2WNGwIBUshpIlnCVBGSO9MJJ1fcSnN+xKUziwlOx+QIiZZLDpbTLKaSc/HpMmzVV54TLI7Nz6PSXhZmudYbrnSiw9S2Vg2hWR+rudSSE+WUR/eWykkq1P5YQoJDdKbfTckSJbjWimbZGfnmmWTTPa0isCUvvZGNslqGPTMJr1ajulJuz+zSY8P0TNOt7JJj9+XIjjokF3TH825u5pdevuDwmrmkJ6fgfLELjmksRcUbGoOyeh+Tg7+bb4P4P/KXTiE+31hjhBXB9DO25FDerqo0tl+xHa3c8hA9hxAnlMop56zqudzENu1zilNX7MAGJ5TevYg9Rktyik9eU/X6K3c0pNlNM7eKbdkZ3nG5JamP1YCfJNbGv5Jby/kkewOnnF5OD1PySODO5Z82D959P6l/slUeU2Yap8zr2T1fN/KKz0bksJ8eURhGfJJ74wb1fWy55feuVkKG5hfsnpff+eXTK/LUIDzq7wFJNOb8heQZj1zpa8VkJ4OkpLQWp8CUt+XpnK78Ht+KiCDe98Oo0x5KlGa+r3KxU6U7J7liYkSpkbqQPrj0juRiheUTFY8W5DT/XMFNf1lJGvUsaBkdO/XmnzZ91uoGE9ByWosfFlQ/p81g1Us8ST2XV8wxHMyyunvC0rjTh/1bakLRXi24n+F9HcoHB5D/DUuJMGKjNukkIQ+yCiPK/mh6oqXlsx3+Etpvr5nS8tAJzyBe/qP0pL5jO6WjuwPdUbxaS4XPnxasrqDc5+WXpyJ4nnf0xJ+jfRdUkaCE8mjWFlWz6UFed/2spxnny4rWe55xnL8O3KV0+tG92XBcvw7ypaTrDZkkzjve7WcZP6c7uUky5MZUk4GNYjP4gL+V0569waonzOoF08oH8rfXxF2o3y4f89h33QVZGDT+bBSFWQQX/BhrStw2qVzuYLtelWQ7C7xGRW0jkRjJ/TOydNIz7MqSM8vQOXvZhyX5hAcx3aUZ9+pIGFCZC0/qSjNnCdVJ7CiNPLRvRhLRclqZ0ElThvZK0mWJ1i9kgzsgF9wbyVVksz+oLi/EAf3F+Lg3of5tEHxMqSSDPTdi75flMAuIezXSpLlBFJ6uRyHXs4jDCpLVpsgd2XJZErpypLVz6lSWRq+AkFyG+l3tKksTT+/8jFWloFNdw312JGVZZCP9BvOb31kDEVDpypLVnvnWhSm+FBlGej3V5H+ylSRzP54t4rU59jJd7xfVXpntF0Cc6tJ474iBStTzVw3BWtQTbJctcHVpHGuw8uPqCaZn+vrajKoke1/R/PqktUKe7e6ZHcnTaxu6i8Ktqq69M560LNQGZ/j61voOcnujPjqOc7rVj0nWf7G789Jz3et6PJbXLekGtomaUV1lRoaB68S2O81tC76GoFlfV56/pfWlP6e1/pfGwJ7/XkZ5Gw/xNpoK5/XOJBkPQ4/L5l/w64pPZuT2mpVa+p9RGtmvlZT0x+thdm/ppbJmUjfrTW17kPbiRc03VNYjhek59v1bRLlP33/BenlUVMb56taegyqr12sJY2z/0ovqVeby5S2tbme80FtyWowDa7NedjI2lxuTaot2V04s2tze2tJnHFX1w7l2w3cgztqS5aTejnOXP6oHfLdP5HXFasjzbipOu9SJ2IbWACD68jgDLwPm1KX63pf1ZWszs53dSWLJx+qK4M8Mh/2Qj2Og5fqSaPeq9Kv1taTzE94tJ6EfyO6/OEXNU9MR/B86cWITaxqKTeQzM/auAHXI15vwPHySQPJ7i2Y14Cvxx7sq/BwE3PLbjXgelPRhpL5Ir9qKHX9FTLu/Eac52xsxOllRyPJ7pM700iafhpV0+QlyfzUlV+SXk11hYfbvt70kmR3MC5ozMdd3lia5xaVnt1ErxutfVe0iWR3rr3dhNNV5yZcHvVvwnXqQU0ieFH1aJtI5nf8uYm29ymsUVPJzh52b8rx/ElTjtO5TSXLLzncVPMrmpPwe1PpxYd8H4XKa77+sjTOvnp1ipprGeXnuij0Z2suoRDN2VFxzlekd0aC+v5nv8LtvH9e4TiNtZCszl3FFpo2KI/9qAXniZ9GYOobF7SQLL+J+jLu49y/aaHloIob3kMetrOFZD7kP1pIdqfZvRYRvqHsnpbSqE+tcLqhJZ/LlpaS1ZD8vSXf5w9aSpYXDq0ky7XP3Cq0JR+gzvVyK72WdM6dW+m9RXN/J7TSY7xB2s1oJYOY3L8o9wu+qvUrWkOoxavS60dhG17V8pLCHryqeR2FNXpN0zit6d79NWmenVO232tat6U5DulbS+P+X8WLb7WWwV0+Pu6nteF8fG4byerwbWvDZRTzg6iz0tH3qdqkbbgP4HQb7l8734bbJP+14fb5Y69Llqea53XJajU9+7pk9cOavS7hz8i4td6QkCNyp+Mbb0nvTDiVFePaSrP+mjpn2Fay+7Lyvx2RKUpevs3tgNZvS1ZXrdvbkuUoDX1bQoJt1hOc2V7qM3gEdv19qWOodE9/KL3zftS+TN1B6vsPyLhHO0gWgzzRQUKNiJ8hdxe9vtTGKdKF601Pd5EshlatC9flG3Xhe5XGilIKHiuyENa2izRrwQmABV2keW+GALjVJbR7pOBxJjVGNM4UEzzOZCOsSFcJj6U050xjT67gsacUQm/asn1lcG+8g7Cv+obySAgeo/JxQGNUChaNUfntaIzKhx3qq2mX0niFfhL+jvQtliThwwhsWpKpPyscrkji+3xTkgzqIvo854ckrW9QG+xQkjTrfliPeFd/GZxL8XnYkAGS1Qw5NIDLxtMDOO2eHcB93DAwtLvT4rdlHKj5EJU92QaG35YaY080zzcNrlGBgdx/8NxAGdy76r/v4EDO644O5Dz25kAJa3G/+fH9RUNkkPfg93WGcv94g6F8v7UcynWfj4ZKdh5i+lDJchFXDeV64sahEs6TGj1qPb4cKVk96RUjJbsb4beRMjh34sM6jeJz7jdKstyZaaO4vrF9FPc7nhnF8XxxlEkvap//hWNQWZtudES+KZ4zWtOV6p9eaJmbfbSWUSnJ+3xfH9UjyozW+KN6RKXRGle0fkSD0Zp3Bn0lQPPRXJfy65upH79G/Zs4F8VTMyAP6zuay3M2rgAYNjqk3cdxL8wdrfX2N8mc146WQV2XjEj3P47WerbaM5lw3POjJcu/vzxastyAlGP0uOkJ/gqN4TZdlTEmTSr/xstjTP3Ao6Exkt0PMXyM9M5RZSbt/hgj9T1ABPbtp9xe2P+p9OokUB295ljtL6FrmTRWGvVLFOyPsaZ/TfG1/OO0DkdjXnXHSehM+yodeJz0clKpbV9iPN8flcZznL46nq/5u+NlcDYjAddtynju3908XtMG5c8Hx+vYyVsEdm58uLeyIf1dGR9+R3akoZYTtCyjdWKGT5DBvTf++/ZOkEZNYwU7OUHr9xR2bUIYg8yB47abKM06T+qszkQ957YE5teOeTvOt71DYAsmSg/v7xKYX6/5PQLbMlHTeDtKLwhrT2DHJ2pe8j6BXZgYxhJyIq7876W61KuTQhmVE7+34ySue/t9Kaz7pIjdLQEGT9K08QFpN2mSDM5V5hZaufkpOoYM7Z4AJgCOT+IxyOtkzj6NW5NNX4HCeeXJoX8oD4771WTJ8tLmT5ZBjR5/XHdKhHYFQPEp3KdQaooM8uWfQLofOIXHAgdNCfdMPmw3ekpkXCW3psig/kBgL3wmg7vafR7282c8dnzzM+7fSDEt3JeJSAflpoW4KoBz6TqN+zemTQu/zcf9b9O0nKG5VjenRWLRSh5Nl+An2AWwzyU7L978c85z2kbbqZzezyWcSGHi4K2vJZyIjFF1gWS17t9awPlVhwWS5SMtWMBzZ35eIIOabb5coGfSC+P49Ex6IaHPpFuLInMRAAUXSX0WjoyxcDH39bE7S5RvbrE5P2V/pF4i2Zn04ku4HlYn0k5N4f0lktWPXbREstrgJ5doXkxturNxYJcRRu3G60v0nqaxxb+WSK8GJv3edEu1bUr14sSlpg9ePUcs5XHTOUu5DXZjacRGVOf9lkp2Ts5ZFsbBiuJeeGZZ5H2PfvovC+1Gv13j/VrOUhxMXCaDO1aD/btcmnciKXmwXMKtSLtWK7Sfgbb7YIVk+bGDVkiW7zh4heZNVIcbhu0oTkeskKxG43crOG8/sEKy2miXVkiz/qm663dlRNYqvKw010jx5w9Wcj/msJV679M4sX/PLZ3LxJV8fnQPFouzB5/CPfjVSumdZaR26J+rJKsZUn01jxFUWcv97WvXSrM+v9JV1pq5Peo1TddJVu9h0DoJzwsz5rVrPd+rZ9dLVhdi04ZI3qGy8TdyHlZjI98fr22UrIb97I08Tnd4I/ejn90oWd0Pv67L4wT2z0ap7zAgfW9t4nGwtJu5Dyr/ZsnuTGy3mcdDe2/m7xu/medF/rGZf8e/m7nOn+k7yc5zFvlOwuQIHXy3RbLaRce2SPM+FqW3b5XB/cV+u3+2ctql9RTKCl5PoZTQPid3m2T3aJfYxn2R1bZxnabmNjPm4OUibuP6xsFtWjZSHjE1XXgv4zO4t2hth2eR//k6HK33dXJbaJOUwW9Lv93ElWrXZ3tos5dGvWTV9nDOTyPs3Hbp2R/0LhJ/zgZOd+g1/5CsZdYdET1C1WvZEbGZVO3jHTKwccoJfUbn0x3Sq6NK13fjzoj8VfUFdkqYGYEN3SUhXeR81KTvJasNueh70/egYN9/z+MQt74394dn2//A5ULjH8wYpPq2Pj9wuh//gwzy9CugXy/FHhnUafNgKjaxJ5S/FXA9ju6R7Ax5s70RO1nl8O01cxe8s+F7JTsjsWWvZPVoL+/l/qaS+/jer72P7/Nm+8L9UQnp9J192p9DY22f7ovkNyldeL8M4lA+LM+PktWEafUjj4f2+1GC7QJ0oHg+GuHZ6vzWUU4Hfx+V5tk5xZuSeeyzUTL3RbZK5r7wt5O5X+r95NAXXgXX0vcxUv2lTzKPnQxODnlYVew7IVkGNfKq4T6/GGfc35IluyeJ+jb9dm178jvb7yWHOfTVcS2rHOO+1+eO8VhHy2N8Lq8fk+x+2N3HInJaANyJM8b9Y5pOqf6S73iYx1MD99HM49Krr0PX0o+xuASW4yT3YxY7yWV37ZOc1zU5ae5p5fce0dsy7SgJ0O6kDO7687+t6SnJ6mB0PcXl4PBTMrjby4f1PS2DM9z+GHnPyOCsud9u6hnJzsMuOsPl4Po4sB/OSHY/3b9nOI27v3L9pdyv2v6ltkb9X7WdTOOX7X/lMb7ev0r4IfK+mmclq8+w9KwM7s70YX3P8X05/FxEL1H32ZwLfXhfY47N/86bdrzw7l0P4xq1hM4b7n9eGmf1FWz6+ZDX1cF9ufg854nrz0svlqTorzbu1e8uanoWZC0vXZTwrzDncv6KZHevpLrKY4Y5r5p+ARVXKnBV5xAEuVYCoOVVTeN0jT66yuf8cZwxJl3ldLrwKrd/91/lsYQjVyP7XIY5CbSdfS18X13EVeFr0qip6OWlPWo3O6UJ8+9yprD8t0wdTsHq3eJnJJrfkqy+z8BbfO+PuhWRg+reyFs89rTtlqnzq2eK2zzX5YXbXJa9e5vnKH1ym8ujXbf5nP+8zeMkae9Ids9Kszvcf9XtDqe1aXdkUDsw0Knv8DEy/SOZn/qZf7hPq9U/EV1K5df9I4PauD6sxF1OQ2Xvch5h3Yvkgapayve03Uh93NPumfmTqt31e3x+me9zXvLEfe4DfeZ+hDaUHXA/1G0bID/oSvq+iDJ02H2e0zvpvmR3/+y6z2XUsfvcN3zm0bgrhdluwn9Sn5MksOYQC+5T9WEvWDFDD1N4OW7FmE/wkhWDWRHYcBFj8vIrEfPsCor7UyLG4nmOjDFfaXYZM+tdP7JxmsgYy2/6IA5sqIwxWTZJxsy8LxVHlDG2p9ndy+o8u4x5elh+0i5ZxoLY+0u4vlljMc+GoO3+/Ufbb2nJd5SJxZg9XfNkWPO2sV+LPxZj61s/Fgvm1wTbNY9p3NM82i6xWCBXm+L8BsVirJZAGjtm+F8UrJUdY3etfmJzOphixwzaVcPMtWOerE1L8CecmKdH5CftnnFiTK8r78RYvmNXJ2bGwC2A/U4M5kX6fuTGmI7Zx415Mk/RwstoR61wY4z/PXD1uOkw9q7alU0RM/PW1b14KfR6UPu8WQo+bqsU4Rq1whgpi6co3p4iFuzzV7Hd1BSxIL/9NYTtTBEL+F9rXPP9KWKG/FXy/FyKGKt1+l+KGDtr9GzKGMtrrpEyBmNtE3b4sRhMwXavIP7eTxdjNe2S0sXYucBz6Ti93EgXC/TTNvht76WPmX4BC2BU+hjTBcalj3n3o6uf17HvR4+H+6gF4mXo4zHjfIDab2wMCbDycU27Coctse/Wx/mcDzweY3lL9O6kpzEI9cvjMaZn//V4zPBRqDnnyhALbLWRWDfP958qffRNnEuXDLHAl/uWMNvReuurM8QC3aJtpJ3yg/6Of/svQyzIgXw70k7FcV9D+VA3Y7g/3om0o/XWx2cM5/dupJ3ynf2O7c6Q970XaUfrshfJFAt0gXaRdrTeesdM4bjtI+2UT+wNxN+6TCFe3sd2fr11GnOlvmsf9h8Z4wPsWz1zzIi/eXeGZQ73uYX3gH6eOcbOJG3MzOXR3swxZmPvyxzy0w/xO05k1vRMfdwpsoRr2QHnVzdLzIhbKVhSFs6bBmfhsmdSnHbTSbuOOMZibEdjIiuyhHumE7b7LksoP3wa/yNLzIhvKViJrCFe/Hr/VbKGe3Uk1g14I2uM+Zt6ZY0xnZDWq++M+BsYp92IrDG25uOzhrKnC37H/qyhXuJ/x9k4fa/hnBVdHUFZmy4h5vliKa1lSOC4z58QY3VsSibEAt27O35Hs4RQV/Frqb2eEO6Z3jjuvARNf3QuuxJi3h5Xv/ZBWPlsMY/feLWH0baan03zK/XrRziGf4ZNEt55OFssOJvRw7fLsseCGim9ULcdmj0W+NeO4PtmZI+xnM/l2TkONmePmWfIlf8vR4zVcKmbI2bU+lPPwzlinl+A2nRf5jT1HPX8Myfn7VYurnNtHcFr5bD8JhXfz6W/rRvRGQrlinlxZwqrnytm2IhejCUX158H54oZPmkV756VK2bWYVFxulwxz/brRvbWmVwxdkd9/dwx2BSBpcoTY77rvHk0X1P/9cO98FSeGGyTZt8/8vF96eaPmXc5K/6dn+tcI/JzPWJGfs0PqH61KH/MtMHUuaL8scB+64/0nLpAyBMHYMzmxQIxT+cMzpwJgI4FIrqtipv+bLHYzswCJs9WeF5SIOb5FD4iNW8PFIjBz5Fv+yoxpvPlCGxNoRjz/e8vFDPyRRWuXi0cM89pxquxQM5rqHy1ITjWF4VjwV2hg/w86SIx2I6wj3FfFikaY+eyaheNBT6ywdj3q6KhruLDbheN6VrpZC4dnzJloxdLeCrGavsXK8b3W+VinB80LhaRlxLg9WIxo36dgm0tFjN8D8rPdbqYqTsq2Lk44/5dTPMNmkfWt3gsuBc54CXFY/BxJA++eemYx1uoHGxXWssPGvOfUzrG/AfLSsdgeEmde+7JFHVfwpuxoEaUv3/ffzNm5H4o2PQ3ueyZ8ybXWZe/GX7HMNy/Kd+KQfkEc9zn+sSYD+/lPjGWF9m+T4zXx+wTY2fsZvaJMX/25j6xoNZFIGv78TG+7hczauN651iSYmbdI3XvTRL/3h5JfNwpSRpXdD2+TIox3+Y3SVw325QUY3dQpO4fC3LjfVjP/ua6qefC/nzN1/SPwZAIrPKAmFELU9EprRvgf0fNAZH5qbjBgJjpNxMA0wbETN+h0jsHxIJa1T6s4aAYDHVM2JHhMXa3WLoRMfghEjc9NjLyvYrvjoqxum9NR8XMeIDKRRzFaXf0KL0e9P7G6aO47fflqBgMxLmMQj6U/9MYy01J/DSmcxpJO99mp+3ansG4uZoDtqsxjtNVo3GcZ78zLubZN2pNPsV3TDsL8B+2m4j60PFxMbiHH/Ip8t3DU/i3HZsS8/IAaN5N2ama71Kdf+o5bTMHYyif29QYrI+cGXh+Bver+LKiB+m75xTAZ/jvSYiD3ZcB1iFsMn7HgGsANRE2BmEvzzD1MC/PckYMHDzcMtP3baayTVtcAqxKZTNb/FgqO8iF8GuFlU1twwyKZ3WePbUNf6Q0cb8tsw2ZHLPd0Ry2VxdH/YzFdjt/B7iLTGcctrtfVASxnfHIJzcLC47jBp6A39sxpw0nJVlLpcPltaGEY8J6F7QZT5xT0Ib9YLbrUsiGHyPvq/GkzfZv2ydteCwW6VvChhYpCEzZjWVtOB3RNxZWsD06oPzvmwq2kbvq5eVWtJm+0amibdaiUWfIK9pMT1xS0YZVaHRORVy92clmNP5uJxu+QthnGEPLGad2tG+LKzqdgn9M09n2eAQ9r0FzdmbGydmZjvpf9s421E2pbaFp2O6t3jZMR0Y0w5/AYBvOIexzpF06xuw4Y3yBY5wbrWlcydUv8X3px9hBDtpshA0YYwf3c82KM8ZSHOPCpzbLb/rvUzuQW3N8vIy1Wc1lOr+vcH6ZxtpGzoSI1Er8WvDzavNwfv4aURp6Ccel83tlrM1yZmd2heDs13ycMx13kZ9TRPC3xOfJY+1Al39NcpwuxXY/jrUDXfQbxB89szc3zrctxm+rO94OfMjzse9f421YFdHrvp5gs5hXbKId6JMLcC6ZJtreWV/1sxDH+Giizer07plorodnN06ymQ6ca5Ieg9qwxSbZTA8rO8mGbBH9qtFkO7iPz4etmGybtdXVneOTbVYbMs8Us516tp1iM/252xQ70E+Xo294zhSb5c7snGIzu/bXKTaTtden2KzOzr0pJu6VjvTyVBtapYp822zbzI9Q6/aVDa9E9HaYZzN7NWGebZxJ986MzLPZXSTL59keb0pDYOvn2Sxf9Mg8m9lqlO5Xx6HJNUgvJ+fZLH7+cJ7N8vTzz7fZ2cPq8212p/Ky+Xzdtsy3md19eH74Hatwfn+ovhG6erjAZn7+NxfaTN/tsNBmfq7+C+3A/7IOZe2PC7ms+Hmh7dU/VD/fYrsnF9lMhyu9SNOaoqP1uAebLLI9fqO+eTN+xxuLQvm2Ad83aZGmA9VkI8KWLOJzWbHIDvxhm7Dd6UU28wX9ukjvX39c1e72ItuI+StYxcW2EXdWz9GLQ1r7Ds8ZHl9ssxipXGIHttAW/LbXluj3UTm9bImWH/TulR+W2LCE8BLlR+rxjf4OKj96f2MHdsBWxOnKbzT+glwX5fv6xg7s/W3YrvxS2/MJ2mSMUUttpouOXRrqOdsRVyuW2qzuzI6lNstV+wlhtC7Jr0v5ul1cage5+ztwfneWajqld0PLZfp9FPb4Mk7PuZbZwVm3nTjnMcu4HJy8zA5yG3fhuN8ts5nNuX+ZxpVqsht5Z77lph6mxmi23GZ2LY09+bCPlps8TC3s9uV2cN+sP27GFfzb8qzgsqdMHFidFTbLj+i4wjZ8feq5YAXXX7atsFley4UVtmlzKv1lpW3a3creX6lpg/rR+660WT7SmJV6T9O1/Hql/l56pnDFSs2fqT65bqXNbNOtK22jXpV3XnyVzfyEFVdxWVZ7ldaHVKxzn9C6yMerbO+sh4LtR9i3q2wvPq1gPyLsT9L3IMIKrtZ8nNqDz67WOFXwA8gPmq/W+KNznrM6XCO/nX+/FZ3zL6tD2XMI24k1dpCjtBdh1dbYng9Aze8nnF/nNbbhz1H6vc+zKX8Zsia0A3w6Lbo2ojuqu0jW2mbOsQD4eq3mxWqOP6O8TLzMbYhDa+0g3n0U9bpU62x27umxdXpfUt6Zc52mF3p+tfA6bdPRGquN12ncJxJY13Va10skcZfv19mQIyJDz39rs9ytvOttln9Vdb3NznTVXG+zGHPz9eH6+jGWcettWBBpV2mDze4GbLXBZvmdYzbYLC983gabxSrnb9B0oIY8puhA3Ve5wYadCre4XxVtfLlR8yF6BvrGRjvI6TiOfetusj3bxav3bGnY3k2h/nwi0k7VhFI6n4IV26xxSsd4b7Md+K5PYt/1m23Tp69yXDeHusop5MUnNttB3OU09v1nsw0VIvUPSm/X+jitO11pu8nvvTPf223jDkvVrtH2kE7P4BjDtpv7SLWbvl3Pj/qpF2/n37Fhu+3RCm23a7sNiyN46bojlBXncNytBObPJf1O27gL2/u2nbZ3nzl934hdpk3i5Zvt4nrnV7vswGd5HvOzr+0ydWXV989d4XpcQP4idpsyXrVzd4djXMR2WXdrHFA+mW83x33h3Xbg17uEa151tx2cD/Vx8NZuG5rgmv+Cc16z1/SDKDm9b69tnp1TdL3XDmITv+IYt/eG/rCzCMu/z/biUXTdGu/TugCFDdlnM5/bsn1a36DrcXyfDZlpnE7p8j/qvU9z3tMdtFmOV5WDNvNndzzIZe3Ag7ZxLkbx+yUH+ZpvIn2vCF3f5seDdhDHvoqwEwdt5oO/etBmNUJvHuQ+qFSHIjJZ7ctDoR16Dcdocsg27sNQc959iNtWvx3ivO73Q6Gv5XfksbcO6b3aR+UAAdYp+knTGj0LmvMnG0rjC6/jXBoc5vrVm4e5X+CLw9zO23TYZjLvO9LuBsqe03HanTlsB7V3/sR2T/wcmYvKD/vZZjmudX+2WZ5+i59tdtajy882TI7AUh3hvs2njtisllTZI9oOpfWVGx+xWT2tbkdsGEdgisbdoxF5+cj+SHuU62bZj3JdL//RiE2nzoYftVlebpmjNjuP/VbkfQr2wdGQh/2NeO531LQXVLtycXygQ8j7bvp+96M2y3Gdf5TT/cE47a4dtVnea7ZkbpMUSrZZ7Klccqhv3MW5+LEEWvu9XnJIB7dRN3sr2WZnGWmNQf99HZJDHnEHYf59x3R+NE78D44xINlm8ctJyRH9RcapYS8Avkm2We7vt3FgO5Jtls91Ppn7UO4km7xE0WSOY2Y7ha7ix7ge1uAY95e0jtMu6Rhfy8VxYCeO2SzfosDxyJxVPbLjNnREoryHZy2/Pmv6LNV3PDhrs/vkcp2z4Xbk2zKet9l52ALnbVav+aXzWv7S2pXvnuc+j7HnOZ3OPG+z85cXz9uwPtLuywu2vjeZwIpd0vuD1vepdclm9TLonSUP/FymS7YX/w3itaqm4qUQ9w/QL5D/sh3U5ayGucTROlnq+drliHyTAO9etoP7Ifw42ObLGveUJ565bJv3zVoAS6/YLHfBvWqzfJosV7nfInccWMGrIX/5D/dlg6t8fVtftdnZr0+vcprcdJWv5d6rEfkWOTPq0+nVqzYcj+je2//Q+hXVac78wXWVv/7Q86O6VP4bfL+VuWGzs6B1b3CdpsUNjqtWJSzjvgTV940bWr9S/ETtK1X/YOwN7t9decP27nun427704Yc/UzY6Q6OWTdP+W46OqzeerOODnwamcvFjo6ZK67OUHZ0TF3q0fwe7+SY/hx193Ic2OBOTmCz+3T6bScHLkbw8kVnh8WFfu7seGtGdaSTCKNxpnOdHVbzNnsXh8nzQl0cdk7pxS4O85G930XjIKhPqO5U6eLAmYi9/3pXJ7CJbfy2CV0ddvZmbleH+aQXd3UCH14M+/7a1fF8tH1Ju+rdHIAIb6r+kWPUKFPPNN0dJj/ydHeM8xAK1rO7w2rlfNXdYb6+pd1N/CketrG7Y9bck2Gsg/alsjsFKkvHuzuBzPPvJKF1rF2pmdl/3fUaKZK+g3evlOqhYcG90iqvoIfj8Rx1pn0gxolH93C83ArKd0f2dFidwPk9HXYerEsvh/GcAb0c5p/8rJdj8AOF04W9HCZ/9/RymH5wpJdj+iwlQP7ejlFPRr0voY/Dasyk7euY53WV/tfXMWtvq7haX8e4kyve+Ub1TOznGLW81bNfP4fFDIf1c8wYnzqn2c9hOYG/93OYzgBJjllHSQIkJjns7GHDJN2X+q/eSHK8fEXablkefu/csSSH3cnQrL/DfF/v9XfYvWkb+zuBrvIY7sHT/R2PnqkcvNSf74+/+ztBPmZqqR1YAwc4Ac/23zdngMN026UDnOBsVRrsW36gw/TYKgMdJnsaDnSYnGk90PHsKDVOWtxbtwc63tlXWrOmwSCH14O6pe81z0JgTQfpvUB53RuDHM/PmpHAFgxyoGsklyT3EM3r6LiJQzj/e2qI/l7qByk1xGHx1aQhDvN3fj7EYedctwxxWMzh8hCH+Qp83kRra94Z4gT+l3RS290Zh2oaCmJjys4ban6HghUb6rDzya2GOoaNqFDUeqjDzvr2Hep4OQSKz6ZHOig9TPNdtYcz+nlaw/R6KFgmhNE8Lb/WR+Nhmk5VO9+v89qwkHazIKzdMCe4hygB+W6HYSG/r4u6aJ9hDqtNMHyYY8axVa2mYQ4siJwHazDagWGRHPAjY00Zr2CpxzlMfmQa57BadTnHcf5cdJwT2NjZcawW4zjfbTuO7y0qo3L4eBkX4j4nwrrHmQtdo1zYLgm/g7aj65Yb2w0bx3Uafy4DlL0t+VrmibOWeRE2YxznB4vHcX61bhznJT9EcKXW4+dxDvMXnx/nMF/avXGmnqNoKM14h8W7043X+1LdgV4Gzz2xPH2V0zbeYfru2+Md89yEqtEz3mHnPyaMN/egGmPbeIf5Xo+Nd4wcYe9uoglcVtSaoHWVTKRd+wkO/CHMvi0mO6xe6YzJXIZ+PZmP8e1krZcI8r1HJzus5sBD0q4A7tWcU5ygrq7/vpJTHDgaGcOd6jDb6pmpjuGPVWO8PpXPma2lAGg/1fFqM/vxLaVf3Ziq5S+t5f3BZw6r67f2M8fL6aDnjlNM07yd2luFpjnsvO6BaXx+x6Y5Zr4ouVeLtqP7vCh+kDPdCc5jF0JYzelOcA9CYeTFRWc4LK+g3AzOr6rPCPlQEalz6TrNiMg8AdBjhsNqHUyd4UC1iH5/7HOH1aO48bnD8owqzXTYfYsvzHRYHtm0mZz+OvezmK9qyUyT/hQOjsx02Jka6vN4EvF3dqbD7OmbM8P98RS2Y3e8Kl/uF6GeWAzbtfrC4feBf8H5+HtxYB9+Ecrz4qiHjfjCgY0RPNeaxfvWnxXylxI4l1dmhXTg506/M4vLo26zHFYD7MtZDvvetbM0/dH7Ou7M4vZqbDafX8rZThATLoV06tfqNOK/sx3m+xo524HWkTy36N2oCkXX5jpmDTClB33tGLVU1LP311zO+HyD5un7Z5IobOjXXE6zs9Kq79cOlLfMu8T3zHO8PDiaezlwoV4Pmhv/6UJN93R/zF7oBPceBXtwscNy1aJ7UD3/XeyweHz5JQ67l2f0Eq6fLlvC13fTEi2jBlEcYDsa66A8rAKu34UlTpAf9gzSeLlvNB9S98w9i/jr9o1jxCE8m+Qbx7z3S51rr2Cx/Ku1Sx0G69E8zAcpi3PZsDTkL+UQdmCpY9yB4tVJWOawfMfKy7jOUG2Z49VvUmfnyuPZuYXLQv7ij7txmcPuOk9Y7nh6lLG+yzmfnL2cjzt3eajbVsI/blke0mllxOne5aG+4fOD+8udIF/U93NlXBHuQR/WYoUT5MP5sIUrnMAfWxHHECsdXfOJ4K/uas5zmq92WA3OmatN/596nonT9/pqTpP3V4f2eTX8tsQ1Dovddb7Ja8FVWeOwOkV91nAeQXPZX0BmMWxNiPuqCJu9Ru9Bep742zV6zhS2a024B5+TOvaec21If9URRnPea6CcpjUzn8fvpTUza+J6nKxgMf3047VaF6B8d9RaLrcmrnXgVceE/bXJYTltT252jFwmrzbLZoedfxu6mfPOcZv5Xp20WesbVOdas9kx85aUD3kz51cXN+u9SuvT/LbZCepm++8bdEMwf2emrVxHyrXVMeq1eHWFtpr716u5stVhscoTW/lePb2V4+DKVgeyZTRh4ogDdfKbsHp3HXYHaPu7DouDrbzLafe7uyaevfjC3dCn6tvOf9x1vDPpwZ3yAqDhPRPPCtb5ngNfRtYo431Tf1aw1+477E6LHvcdSBmJdQx4yP0g8x5y/Xn5Q4fl2u97yH19GcFlOkgCuEzfyAkuTI+0WwuumWuqvtNymS2Z03KZn+ZJyzXv9FaxcstlPKy35bK7B5KiY4jw3gfad6LlBnLrRSSweZYb3B/v8/Zm0vXuiqd9X4u5zC/VN+bCgQisvu2yfcl0QhGntqYAaGS7ZkxE3dlpuwGPbYjyY5vtBjWcfdh3jgsPI7DNrguHI7DxKdzgvgl/jNQpXTNG4NUBclldut4pXdP+VTknKV1wLTKG8vOncuFapO/S1C67r3xsGpfVc8uV1jVilV5eWlpOBwPTumyvsjuC1N0NaV2PP1O+NimtC+toPrCa+2Nu4C95CXHV5jHXi+vmJ3PZ/5jrjUF9pdcec43aCeo5P50Lv9smbFJm16gbr9D2dWaXxRx8HluA8qHMrjcPajufy+x6+imF5cnievKNwqrHgb2ZxfX0FwrrncVleYJDsmg8U9i4LC6Lq63N4jIZsCWLy3j7lSwuyx/6N4vLbNOcWV1W/96vk09hjbO6zB9G9Y3mkp/Pa4K6wBtZ3cDuaY18/LOsbqAPNUUYq3NiAWzP6jJ9qMtxwea3J6sbyMv/4VUbp3DOpcj7fs/qmvxZ1XpOcNm9h/kSOJ6fTHADva4Z7sFyCa5xf5kat0qCa+SRqW/rneAyX8HoBJfJjylkDB82J8FlMnlppK+Xy45zoe2+S3DZGZNtCW7gL3kZ7YDzCa4hQ70zh9lcFv9ltSJUDeJsLouhrcmm50frDm7JpnlESgLz84yoXdYlp2A+j++zucY5NIXTgtldGBpptzi7a9YIUPH9A5bH16hPMEeOcH+0Qj5UIofLznOWzeEGPq0W2O6jHG6Q19wS6X53Dtes/f5ILzmQQ9MkjcVEa5p48ekcLvvev+PA/Bqc9H12Tje4z9CHdc7pslr3X+R0WW7F6pwu86uczcnpj+7z9nH2+au4z//I6bL8RGoHvBbHDmiNdsCgODznYU43yEdqg30L5+Jy/6lcbuCXeh3b1c7F9asXc3FZ9kouLvPeyeV6NVzUt7yJ73sqtxvotm8grH5uvn+b5Xa9ukeq71vYLn8ejWcFa4uwhnlcpns3zuMGsay38Y8d87hMv+qUxw3o4B2/9kAe18uhUmO8i7B1eTgONuXR66vavYft9uThfONgHjewZ9phu1N5TJr01jyPy3I0/83jGnlk3l7Na9KGgj2b1zXu+vVsl7yudzbH6JvfNe/HfvRMyu8ye3BofpedBZ2Vn8+P0vNkpOel+V1W42Nzfk4veyLjqrn8lJ/TAd0fH+D+OBVnzhfyu8z39UQBLvMKF+B9S8ZpVzYOrEoB18yNskK5QNvVKuAGNs6HyOs+LMB1hh55hBkjUPY56eu3W1mAy9CNBUJ+2gH3/oMCnP5EIt/nTqIb+Ic64vyeSXSN+kPq215K5PIyzUXwaEjJvU7Yt1ViRL+yAAYmcj1nXGQuas0nJXI8z0h0vTyUBAK7mshp6HYi35cfXITgbp2uvu8r0Q34ZGekoUsXdcwPyHd0KOiyuNC3Bd3grgAfL/8VdI37FxSsdiFzfurbmhZy2VnQtwtpnXowadenkAtLbPN9tF5pF9TrihYz96CXd13MXDfVsGkxl9Uh7VHMNeu0qbPDxThdvXcJAv7cDf1Swy9B4Dv8yM8DJT7fbr5tegkCf0l3qXMFZxZzgzwZ35+YpXgoQ30YvSvZr5X4VHFOz/T+5B7YTj7gemzp4m6QV++Psb24y86E3C7uBme0fVj9Ei7LPX+7hMvi091LcL8AvaO5l+R3NPu1F+kdzb2x3ZASLjs369/VSMfwcZ8vDmxIHNjQOLCqcWDD4sCGE5hf114QmJ9fR3U9WreiD37bnhJukNPh760fS7iwG7+tL8qPKSVDeumHsHSlwjVKQljbUm5Qo6I/wnaVcr2zdOpnAMKeKx32HeiPUZrzjRmlXTNv0wplAP02/z4Rmt/5VWk3yHf066t1eNr1dPF0ZK9+/HTIdwcjXlY8rfXnEeR9+57Wti7tewFhVGf992nNcxRsCI6bsowb1A3w2yWUcdndy53L6PnRXOyhZTT/s8n7DpVxvfWmODhcxmVxcf/8B53f32W0r6CGV8dcf2+aZzi/z/gMl8k5nuH6M609MQLfR/lQoNeRehSfoGws/IzrwWgeAL2v3KfJjs+E/H4QjrHyGdes12cBZH7WhYqoUA5DumpU1oUNaky1b7AvrcMyHHFK70T3eR29E32k5Hei++3oneg+LFc518tXpjaiLG/Sn0cH5bnvht6d7r+P3p3uw0qVd709PZL0bVVe25Kj4thWo6nNWV6v5RgCO1ae+1V+L+/C3kiNt3UVXS/2mZ7glNax8XGaq5ILxyLvu13J9XISaJ70ylvaTjZqSd0WrDbQc5Vdln86rbIbxAj8uRypzPW1fyu73jlhaovXr+Ky+4lfq8JpnMpfnw7aV3FZ7jSVyaPiyGS/BvE7o0SAq9Eok2lf3/7oV4XzxEFVQn1jDL6v+mXwdL18vty3ANpdhmD/fortOl+GIMY3Fr9jbBW+z/33VSS01jO7Xo9PKY+twvVsOu44/OP+UQIyIA2Nx3G/rsL1iMVVtG0/1rddlI5ZxQ3q/k5AWJ2qXH9+sWoc+7dqqEtN9HNJqrrBHRSTkA/drqpxOo6sZfpqLsvZfqKay+oJlqjmshzNF6vpcWmOdbNqXK9r/Qg2PCLfLldzPduKwlpWd2FLZA/mrOGyWEzZGnouaUi7/9XQtn1+AutWwzXrx6qz4TVdlvM+p6bL6mrsqhmxPyyAQzX5nvmlpstyIW7XjPA6VRv3BZfdqVLihYg/R+GgJz/LWPMFTkP1XtD26ngCa/MCl2/vvOCaeVUqnvyC6VtSsNUvuGYOiwR4rJbLztfmr+WyOpXv13LZ3bJrarnwNxrUU3FvLWjsQi/bhBVo7noxPiq7dzR34cNITOnpFi6L9dZq4Zr3x8eJuXpzaeGye0atlnwtH2vJ1zIx2k7lIbd02ZkfljOmagG3jNihEqB5ywjPlgBJLeP4QVryvf9JnDlPaRnxjeD+t/G/FBi7SYl57GpJ8mKd/Sfw9yextksl3PNVUeY1xL+/gvu0Df7eDtt9gPp4B3x2wj3ZF9/fD+H9sf0ghH+M7/sE3zcR203G/rPx+Q22W42/b8Xv+QHndxx/P4v91b0Wav3uI1zVHpBeXFX/PQXmSiVY+u958feS+Hd1vlzRzvOWxl0dS8+3rqXHb4a/v4y1G1ri763w+So+X8P3fojjd8L23SyN5yH4vnE47gR8TsL+k/H3qdh/Oj5n4t+/wOeXCP8K3z8P+y3A35fg70vx95X4Xevw9434980I347P7y2tP5zGv5/B51l8nsfnRXxexudVS9MYYE0GC58C60rY+LuDT1doPT6t0ONmwPvcsmH7nFjHKzc+82JeW0lsr+5xVePVE3q+bbDfm9i+Lf7+Lv7eDv2GH+KzM/Yfhu9TtW7TYA3OlFhfUmANSIF1EAXWdRRYszAr1hGTWIfLwx9+1wF83wl833n8XdUW8HQxxIPqnBrPylh47kXgORkLz12kwzz51JhHmwrzAF3Me3MwJ8nBvCHVrxb+vQE+VUzNxhiIhXEPC2MnMfTPW+h/T4G+ZYHxAoE+0DTo00iN9qaF9mQG1GXUOJ9j/7nYfjm2W4HjrJF6HXfhfPdJjb8fsf1JbH8Kv/MS/n4Zx/0b53MLn3cQLmIaz6ljul/mmP571pjunxDT7y+A8ILYvgT+XgqfT2P7MjFNH3URXh+fDWJ6vi/F9LitsP2rMf3dbfH3t7H9u9i+fUx/byf8vWtM46MH/t47ptenP/YbiM+P8e9D8ffh+PwkpvE4Df/+OcK/wOcsfH6Fz7nYbj7+vhCfi/H5DT6X4bxWxfRZjN0I/wGfe/E9BxDPxxCvF/D5J7b7G5+3EB+38b33EG+2rWVThv9H3JuA/VS9/7/r83w88zx5iDJlnlIyNRFlyDwmpJCKQlSmSqYQhWRKMqaUItJgrkSjQihJmcocKZpw3M9+77Ne/+/vd/7nd51zrut0Xdrvz3rWvu/3fa97r732GmMDOUVj9bzHBvmLxQZ6SupaWvmvVr7qutbQtZaudWKDOKyn/M31u11soL9jbFAOXZX/bunrFhvEQ2/l7y+9j+jvj+r+Ico3Un9/SnLGxgblMUP5Z8YGz+2r+r04NrD7bclfrfvW6ro+NvDf58r/RWwQD1uld4f89KP07td9B5X/UGywZ9QZ/f5d+c7p95/K/7d+/6Prv7FB/ZkZF9h1WVxw3+VxQf5iWmZbPC7QXyEuiIsblK9uXPD8t1a+NnHBc9BJ+e9Rek/J76v7+kv+w/o9MC7wzwilj9J9oyVnYlxQblOVb67+Pi8u8M/LcYG/XlP663GBn5eLz6q4wL+blP8z6flC8ncq3179Pix9J5XvlK6/xWk+TLj8OD7wX2686htdC8cH+crEB/nK6louPmgH1I4P7L5e6TfEB++TtvFBvdMrPrCnb3zg3+HKP0r3T5We6brO1HWWrrN1//z4wN5Fun+x/v660pfqukLpK8XnnfjA/jXxQbl9HB/450vJ+To+8NNu/f2A7j+k6y+6HtH1mK4ndP1V19O6ntH1D+k/Kz1/Kf0fXc/LH+kJwe/MBMWtfhdNCOKjrH6X17ViQiCvSkLwnFyfIL/remNCYG8D/b4lIbC3ma7tEoLy7KZ890leb137KN+jun+groOkf4jyPa7fw3QdrvRR+v1UQlAeT+v+8QlBOU5Svim6TlP6LF3nitci/X1xQlA+K8Rrtfy0UXo2Sf5m3f+F0rco/SvJ2abf2/X3HZL7o37vU76DSj+p36f19zMJ+laXHCOR395JDP6emhikpyUGPLITA55FdS2dGNhVUfkq6Vo5MdBzlX5XSwyei5slt0Fi4MdG+t1Ev5vr2lr6OiQG9fa9yne/5PXStbeuD+jvffS7b2JQvzyq9EG6DtHfh2rP9EmJgf9niO8s6Z2r3wuUf6HuX6T8b+rvb+n6tq7v6roqMYjHzbrvU8n5TOm7EoN6+qjyn9DfT8qfvycG6/gSkoK/JycF+a9ICvSXSVL7KCmws0aS3rNJQTnfnBToaZEUlOcd+ntnXe/U9S79vXdSEAcDk/RcSM+TSUF5jJK8ybpvSlLwnM7T7wW6b6HuWyJ57+nvq3RdI3vW6/phUlC+22TfIaUf1u9/koLyMJLml7jkgE9ScnDfZcmB3iLJAb9yycH9FZMD/TWTAz/VTQ7ktUkOeLTTfe2TA/vvTg781lvpD+i+R5R/oPKNSNb4V3Jg/3T9fab+vlD6X9H1NfF4R/k36v7P9fctuv9r2bdT+nfp9w/6vTc56Bu4oPsiKS6/T6N4SsCzfIrq0RQ9hykBn5opgV31UnQet/I1SQnkNNO1pa5tdG2fEvi9k+7rJj29Jf8B5esreQ+l6DtavwemBHaP1O/RKYE943Xfs5IzUddJkj9Tv18Q74W6vpkSxNU7suuDlKC8tyj/VylBe26v8v2s339I7gXJSUgN7ElPDezLSQ3uz01V+yA1yF88NZBTTvkqpwbyrtfvevp7Y/1unhrIv13yOqYG/HpK7n269kpV/4zu6y8+g3XfkNTAb0+lBnZOTg38OlV/nyY5M5RvodJfVv5luq6WnnWyZ7PSt0nfd5LzvfLt1e+fJG+f7jsq/Sf191Oy67zSI2nBc5ipawldq+laLy3wW8u0QG4rpd+dFujtkRb4rU9aoG9gWqBnsK5DdX1c12G6Dtd1pK6jdR2j6zhdx+v6TFrwvCyR3qVpwRyiL/X767TAnm/SgnbeMfE9rusJXU/q+quup3Q9Lbsi6YG+aHrwvGemB34vmq73ZXrgj+rKVyM98Gd9/b5F14a6Ntb9bXV/F6V3TQ/i7970wH8P6e9DpHdsesBrXHpg3wTd96yuk3R9Lj2we5ryT9fvWenB+3GZ7l+h/CvTg/bv5/r9pa5f6bo1PYjrnbrvO/3eKzuP6fep9GAf4dyMwI7LM4J54vUygr/fmhHc31jXphlB+6GLft+VEfi7X0agt7+uD2cE782xyjc+IxhHekt63s8I9O7NCPx6RPcdywj893tG4M8LGYE/LmYE5ZWWGcjLzAz8WyxT3126ltC1ZGYg70r9Lq1rGV3L6u/lda2o9Eq6Vta1iq5VM/V+1++autbKDOxvJD7tMwP77tTfu2YG9e09mUF53q/0XpL3kK6DlD5Yv5/UfU8pfYyuYzODcn8pM4iLFeK/UvetydR3iK5bdN9XmeqHyAz8fVB/PyF/npKc32SHfTzk949nqT9S1/iswI7kLJc/r6ms0stl6X2v+67KCvxSV+n1db01K9DTSPc1VnrTrCAuO+rvnXTtkhXwvU+/e+n6gK59soL6d4jyjdZ1kuRPzgrsfEF6ZkvPa8q3UnLe1e8PJW+L7Nym9B+U70dd90nOyazAr38qXzQ7uC8+O9CXlB34Iz07aPeUzFZcKl85/b2yBpAr6+9Vda2m6zXKXzNbcadr7ewg3urp983Se4vua6hrY11v07WZ5LXSfa2zAzs6Zwf+ukfpPbMDf/SXniG6/zFdn5C+4dmB/RN03zP6+0T9niR9z+v3VMmbrfvnSs8S/f2N7MC/q/T3tUpfJ7kbdP1Q143ZQdxuU/4d+n1Afz8keb9Jzhldf5f//8rW2HyO4j5H/W76nZcT8CuVE/ipck5gb62cwI66OYG8ejmB/5ro2kbpbXOC5/kOpXeXnAdzAr79coL6bZj0jdJ9o3P0Ps0J/DdecibnBN/3CyTnDeVbqutbOYH96yVvo9I36ffnkv+F0rfo+rWu23T9Rvl26LpT1136+3f6vVvX73OC5/5YTuDP36TvnP7+p/hf0P1WiZn/EnL1fZUb2Jmeq+clN5B3dW6Qv7quNZS/dm4gt06u+vf1u55+N1T+xrrepmszXVvo2krXNrq/rX63l5zOSu+SG5RfT+m/X+m9coN2zFilj891+WPor0rOa7ou0fVNXZfpulzXt3V9R3Lel/xVuYEf1+cG9f+O3MC/e3KDOD2i3+F8hojG+yL6F4vfUzXWaLi7xpUjSosVnqb5YxGNOcYLz9C4oeGZGjPN/07QOGVE45DJwg/qd4zkh+tTYjQ+GdGcm0zh8OyEiNarZQtnaD+diHjlCsdrzDa0MQ+2FIIfCgvP0px4w7betAj0FoX8yyH/CmE7I7CY8EsaI46R3pLgUAocrgSH0sJzXNAWMjzX3qHCdiZpOeF5mo9qeL71JwsnaCw65FYJeisL29hwFXCoKv0LtUYs/zvFninhRdpX3PAr2mcp5HwtyqiG0qzMayndxqdrC1v51IE/r0M5Xo9yvAF+vhG23ARb6grbXj71hBfb+w3c6sPGBrDxVtjYEDY2go2NIacJbLwNNjaDjc1hYwvY2BI2toKNrWFjG9jYFja2A//24NMB996uNDtj4w7o7QS9nSG/C+TfKWzx3lU4V3MUQr13Q2833NsdPukBu+6Brp7gcy9k3geZ9+PeXsjfW3+PUx0R2tIHPPuCQz/ofQg8++OZGiBsc3UfRp5HhF/XniBh+kBwG4T0wbBlCGwZKrxEe/Hnt1Mwl+NNzeeISM8w4aWa3xHaPhzP+AjJztGcj9DG0eDzFPAY4LHgNk54mew3/JZiN8w/Ab59BjY+K7xcc0BDOZOEV2geXqjrOciZIpyod08ocyryTEOdP0Ppb+v9Efr/BfhnFuLhRTwLs+Gfl2DXHNw7F+nzwGc+OCxU+jjVEWF5LUK8vaL7VurZC+W/Ds5LwPMN8HwTPJeCzzLweQv+XI57Vwi/Ix8Zflc8wvrnHXB4V/g9/TP8vv4ZXqV/IYfVwnZdAz5rdc1vW4PPB7DlQ/3d/LARvvoY8jdB5mZhawt8Ans/RQx8hjj5HH7+QvLMxq3w8zY879vB8xvpNJ67wOdb6P1OV6sPvwfPPcLmjx/Cs/rsW0/pthb/J8jcJ7xe86pCOQdQ3x4UNl8eAoef4bdfhM3Hh4XNx0eEP7J+P2Hz9zH45zji4YSwlcNJxMav8M8plONp2PIbuJ2Bf/6AXWfhn3Pwz1/wz9+Q+Q/88y/4nBe2GLkA+RfhNxfxfosIT9C+jxHFVDTiORcQtviKjXjfxmn+lsVaUsT7OTni/ZwS8X5OjXg/pwlbbKZHvM8zIt7nmRHv86yItzE74n2eI2xxnRvx/i8Y8b7Ki/jYLgS7Ckd8WRSJeF8VjfiyuDziy6JYxJdFccgvEfFlURLyS4HPlchfGraUifjyKgsO5SK+vMqjvCqgvCqivCpBb2WUURWU0dXw8zXwc3XwuRa+rQHf1oQttWBLbfi2DjhcB9/eALtuhG9vgm/rwbc3Q359+LYB5NwC/9wK/zSEfxrBP43BrYmw+eQ2+KQpfNIMPmkOn7SAb1vCP63gn9bg3wb+aQuZ7VDu7WFXB9h1O+zqCLvugF2dYFc4//MTzAFN1zzQMAa6wd7usLcHuN0De3vCxnth432w8X7Y2EvYvjV7w64HwPNBcOgDXX0hs59wruathnL6Q84A+Oph4S80vzXk86iwxdhAYVtTPwjyB4PDEOEt+fsWeXsfA7fHhW0foScgZ1jEt7eH494RuHeksJ33MUrY2uajhbdqXm4ocwxsHyts7+dx0mXv5/FKt/fzBOEd1v6Er57VnFrjPAVl/TzKYirKbhp8OB3cZsCumbDrBfhwFvK8iDyz4beX4Ic5SJ8L2+cpbs0/Lyt9p7Uh4ZNX4JNX4ZPX4JPX4ZMl8Mkb8Mly6F0hvfltP/jnPfjnffhnFfyzGravge1r4Z91wrs05zm0ZYOwtac+QNx+KGxtq4+gd6OwfVt8DLs2QddmYesf+kQ4W3OrQ26fAX8ubHPavxC2dtyXyLMF+Ctha999jfStwtbW2ya818pG2Np93whbu2+HsLX7dkLOLuBvgb9Dee2G7d8jzx5h66P6Qbia5pNH9F3+o/B+zS+P6PtjH+Tsh5wDkHNQ2NqkhyDnZ8j5BXIO494j4HAUco5BznHE0gnIPAnbfwW3U/DDaaT/Bl1noOt36PoD8s+C8zlh++78E/L/Qp6/he179B9h69v4F7F3Xtja7Bf0nKZijn5+n2h4hqLm6ofPRVTY2vgFhH/GPP5fMJe/sObzx6i9nyhs7f1k5bH2forwMc37D8slLcb7Kj3G+yojxvsqM8b7NkvYvr+zha0vN0fYvsVzhe1bvKCwfYvnxXj/FIrx74LC4mzfH0VivM+LClv65Ui/AunFkF4c6SWQXhLppZB+JdJLI70MyqKssH0PlQvXUVgbFfkrCFt/RUVh+2aqJGzfTJWF7ZupirB9M1UV/k3rKyL6ZqombGfEXi1s3/3XCNu3VPXwXE6tyYioj6eGsH1X1RS2fq9awn9aOxZxWEfY+sivi/H17fXIcwPwjTH+ebwpXFNi/avIUw/4ZuD6wvad1wBxdYuwffPdiphsiFhtBDmNgZsIb9CalIi+F5sK2/diM8Rbc2H7dmwhbN+OLVGmrWBja+hqA3vbCttz3U7Y3qHtkb8D7L0d6R3B+Q6kdxK279fOMX4s4E48+13D9SuRYO1NRN+1dyNuu4W2RIJ1OSGHHsJHtE4nom/fnsL27XtvyCcSrOEJed4P3/aCb3vDtw+Ez4id0w27+kBOX8jpBzkPQU7/0M92JifkPCxsa8oeCZ8721dM2L7LBwrbd/kg+GowfDUEvhoqbPXnY/Db4/DbE/DbMPjtSfhtOPw2AuU4Msb3gY2G7U/B9jGwfSx8OA72Po0YGA/bJ8D2Z2D7s7B9IrhNgh8mww/PwQ9T4Ifn4Yep8MM0+GE6/DADts+E7bNg+4uwfTZsfwm2zwnfFxHn5iIG5gmv11qxiMZxFuD5XYh7X8a9i3DvK7j3Vdy7OHyuI8Fas0jYTyts35hLIPMNYevjeTPME3FuKfIvQ/63hK2fezn8v0K+sj6hlTG+P+FdcHsvxo/7rVK69RutFrZxpDVhfR5xbq2w9SGtE7Y+pPVh/Wb7WQm/pjV1IecPY9z/uVfaZ3gvfI667gth6zv9Miw7azOjnvxK2PqovoYftgpbW2sbbNyOPN8IW1trh3B3nRUf0djlLmHr9/oW5fUdfLs75KB1gRG9d/YIl8D56TE6Nz2ifuYfQx/qbO3Q9n3guR+6DkDXQeg6BF0/Q9cv0HUYuo5A11HoOiZsY8vHhV/Q2c4R9fmdRJ5fha3/7xTknFYsldI5vxG9y34Xtm+xPxCrZ2HjOcTqX4jVf2DXv4jVC4jVcP1lC63BDGM1EvWxGhP1sRqN+lgtEPWxGhuu09T5fWGshus3r9QaztCHGVEfq5lRH6tZUR+r2VEfqzlR76vcqPdJQaTnhWs0dU5SjNq3RZTnoM5tCtv/V+DeYsKldHaS4cvsTOtwPaq1XSGnFOSUhpwykFNW2Pp3y0V9eZUXnqYzZyJqt1cUnqHzUCLqD64sPFPnlYQxVhXcror6eruauBn/a+Cr6uBwLdJrRH2c1BS2vudawldEgnMWIuqHriNs/dDXCW/RmQihH26Arhsh/6YwlnCm7dpwD371Z98MDvXBoQE43AIOt4JDQ8RPI/BpDD5NEBtNwa1ZGNtaLxzGZAvIbIl4biVs44GtYVcb4UzsCZyltcehve2jvm7sgOfidnDuCD53gH8n8S8U7lkq/ndCflfIvAty7obebrCxO+zqAXvvAZ+euPdeYRtzuA957ocfeoFzb61vtnGJPqGuSLB3Ysi/n+zKDfcJFJ8B0Psw5D8i3Bf74tn4xkDYPii0MRKs2Q7tHQIbh4L/Y+D8OLg9Ifyo9kCLaPzkSWEb6xyOOnAEOI8En1HgMFr2xmt/rpDDWOGF2uco5PM0+IwXTgz3KQrH/aH3WeidCL2TYPtk6H0OuqZA1/O4dyrkT4P86ZA5AzJnIv8LkDlL2PpFXwT/2dD1EuTMgZy5kDMPcuZDzgLIWQhuL0POIuBXIPNVyFwMma9FfR/7Esh8AzzfhMylkLkMMt8SXop9AXK1N0DI+W3IX4lyeUcc7N73UP+8r30NLP868FkPvAH4A9SBHynd3mUbkedjYXuXbcK7ZjP4fAIbPwX/z+CHzxEnX+C5/hI2boHer4TXaz+EMH2rsH0jbIPe7eDzjeyy9tvOqJ8T8q2wjXPuVn4b5/wefPaA8w/CNv65F/x/hI0/gf8+8NwPPgfA4RDqh5+jfq7FYXA4ImxjrUeh9xj0HofeE9B7ErH0K9JPCduY7WlhG7P9DTzPCFu78XfhDdpfIvTzWfA/J2xj7n8K25j7X8I25v63sI25/wPf/os6/LywjbNfgL0XYa8r4O2NFPB2xQjbmHO0gLelQAHPOVY4/5yCAp5DfAEvPwEyE3FvUgHflk6B/FRhG0dOK+DHkTOUbuPImZCZVcDHc7awjY3nQGZuAe//ggW8//PAp1AB7//CsOWyAt6fRQp4HxaFjZfDh1eAWzHg4tBVQtjmWJUUzj8XA3KuFLZxsdKwpYxw1YhzZYVtf6Fy4FZeuNql7/oKwjZHoKKwzRGoFO5BYm1gYZsjUEXY5ghUFbY5AlcJ2xyBasI2R+BqYZsjcA3srS5s8wWuFb7ezjIRtrkDNYVt7kAt2F4b9tYRtjkF1wlbPFyPcr8B+W8UtnMdb0J81oX/66Gsb0ZZ1y/g64oG8OctKOtbwbMh7G2EOGksfLf2dgm53QYOTaGrGXQ1F7b2bQvIbAmercChNbi1AZ+2wtamagcO7Qv4OvN2pds8x46Qfwe4dQK3ztDVBRzuLOD7b+9Sus37uDvcl8Xaw8I2B6S7sM217iG8GPvaxGhvm5DzvZJvc0buR55eKMfeBXyd/yD49wH/vuDfT/lt7kl/2DIAPnwYHB6B3kcRhwML+PfCIPhwMPQOAZ+h4PAYdD0OXU9A1zDUXU8K5+/VAV0jIH8k5I8Ch9Gw8SnoHQM8FraMQ7k8DW7jwW0C8j+DZ+1ZcJsIbpOErZ9kMvg8J2zz+qeA//PgPxU8pyHPdKTPAM+Z4PmCsM0tmoWYeRE8Z4PnS5A/BzznIs7nQ9cC+GqhsLUHXhaeqb2RwjyvCNv8pleFbX7TYsh8TXih9lGKaI7tEmGbA/WGsM2BehPP9TJhs3G5sH3LvI3nfaWwtZnf0b5JVs+sQjmuhn/WwD9rUS7r4Kv1wjYPawP89gHK6ENhm5/1EXyyUTh//SXSN6EcN6PsPkH6p5D/GXz4ubDN//pC2N6bXwrbXLAtsOUr2Ps17N0KG7dB13bY+A3q2x3C1re5E3XFLmGbd/atsM07+07Y5p3tFrZ5Z98L27yzPeD2A+LwR5TXT8I2N20feO4XtnlqB4RtntpBYZundkjY5qn9LGzz1H4Rtnlqh4VtntoRYZundhS6jgnbnLXjwjZn7YSwzVk7ify/Qtcp+PO0cFdrSwvfFQn2/DJ8d8S534Vt7lu4B1hU+4BFNA/unLDNg/tT2ObB/SVs8+D+FrY5Ev/g+f0XcXge8XYBeS4ij4v1eSKxPj1G2L4lo0gvEOtjPjbW84+L9bEar725bI5ecqx/rlNjfWynxfq+nYxY/47IVLrN6cuO9fGTE+tjO1fY2hsFha0eyIv1MV9I2OYKFo71ZXRZrC/HIrHeJ0WFre/6cmGbSxjuu/a69l4L8xdHegmkl4SvSsG3V8LG0uBQBveWxb3lcG953FsB91bEvZWQvzLkVEE5VkX6VSjHarG+PrkaPr8m1tdd1aH3WpR7DfitprDNu6wlbG2A2oiNOoiNGxEbdREb9RAb9WF7A8TGreDZUOkWG40RG00QG7chNpoiNpohNprH+jqqpdJtXKYVbG8N3EbY2vNthZ/Wnnqhn9ujXDrAb7fDJx1hyx2I806wpTP83AXldSfs6gpb7gLPu6G3G/h0R/n2ELZ5svcIWx9mT2Eri3vB8z5wuB+ce4FPb/B5AHweBJ8+sf6buh+4PYTYGBDr3xcPg8Mj0PuosPX5DwS3QeAzONb3rw4Fn8eAH0eZPoFyHAZuTwpbm3A4fDgC3EYilkbDD0/B9jHKYzEwTunWz/O0sM1THg/5E2L998KziPlJsHcy7H0OeqfAxueFbbxgKnw7DTZOF7b50eHejTY/eib4vxDr22kvwvbZ4PMS+MwBh7ngNg/lOB/yFwjbXOyFwjYX+2XwXARdr4DDq5C5GBxeg97XwWcJyv0NpL+JGFgKXcsg5y08I8uRZwXyvA0OK2HjO7DlXeH8vlyU0fvCNvd8lbC1tVbD3jWoK9bC9nXQux58NsDGDxBjHwr3zz8nNsA2t30j0j9G+iakb0b6J0j/FOmfCdsc+c/DvUStTat0myP/lbDNkf9a2ObIbw3rTGvTCttZ9dvhz2+EU7Q3aETvx53w8y5hW1/7rbDNu/8OZbcbvv0eftsDf/4AP+9FDPwI3/4EbvvAYT/yH8BzfUjpNvf/Z2Hri/gFMg/jmT0CmUdRvx1H/hPCtobgJOz6Ve/iKPZHjdEeqSG3P2D7WeEvsX9qVHuoRrQu4S+kh3uq2hqFcF/VVO2tGtE4wnnwuSBs6xguCg+Ts0MOkThvV0yc1xWN8/wLCD9pc+rD/VBNjLD1W8ZDTgLkJwpbnZaE9GTkTwFOBYc0YVtPnC5s8+czhK0tkYn8WeCcrf1e8/t747xP8uJ8jBWK889p4Tgfh5fF+XdNUXC+PM7H/xXQG+5dW17710bUrigBPiVxbylhW0dyJeSUhq/K4N6ysqW69sWNhGvE4ny5Vwqx9eWCQ5U4/wxWhY1XwSfV4JOrYe81cX5Pixpxvt6uCf61wL82+NcB/+vA/0bwvwn864J/PfC/Gfzrg38D8L8F/G8F/4bg3wT5bwPnpsIWJ83AubliwNb3tMS9reL8e6E1+LSB3rbCth6onbC1mdsjzjuAw+3Q2xEy74DeTvBDZ+jqgljtihi7S9jW3N+N9G7Ctj9Ed3DoAQ7hXsq2hqlnuD+yzZWFn+8Dt/vBuZd8bjwfjPP1Xh9w7ot46A+fDAB+GPkfQfqjwraOaqCwraMaJGzrqAbj3iHCtqZqqPDTl77rHxO29VWPww9PwA/Dwli99L8nhW0t0nBhm1s1AvJHwg+j4KvR4PMUbBkDPBZ10ThhW+P1NO4dj/wThK1P6Rlhm7f2LGyZqNiw/qjJiPPnYOMU6H0+LK9IsP91WL7TYMt0xOEM2DtT+10bz9lKt3VpL4HzHNwb7qudq721Q13zYe8CyF8I/LLwxIhzi5D+Cux6FX5YrHjLn1eg/bcn2VlZsGul8GQ7u1DY+lTf1b12jsaq0M/WVlS6rbFbp3RbY7de2NbYbRC2NXYfCNsauw+FbY3dR8K2xm6jsK2x+xg2bhK29XabVaa23u5TYVtv9zls/wK2f4n0LWHcWptQ2NbkfQ0fboX/t6HstqO8vhG2NXw7kH8nynEX7v0W936H9N3A34PzHnD+Ac/1XuH5Eed+hK6fUI77EGP7YdcB8DwIvYeEbRzqZ3D4Rb61vvcjSre9Lo4KWz/8MfA8jufoRJz/jvs1rGe0t3v4LjgtfFZ7vYe2nNFzZLacgy1/wpa/hK2P/e+Qv7UJYeO/sPG8sO0FdEF4MfaWj9H+8qHtkXhvezTe214g3tseG+/vjYv3tsfHe9sT473tSfHe9uR4b3tKvLc9Nd7bnhnvbc+K97Znx3vbc+K97bnx3vaC8d72PNhVSNjOsikM/pchT5F4H0tFofdy8Lwi3td1JeP9+/fKkI+15SCzDHSVjfffJuWhq4KwzbWrCNsrgUNl2FgFNlaN92V6FfRWg96robc69F4LvTWgtyb01oLe2tBbJ96/g65DenjWwOs6byBMvxHpN4VxdamerBvGlbX9hG3t782wpX68H9u6BfF2K8qlIexqBFsaw5YmsOU2cGuK+GwW7+ur5sK2/rgF8rcMfW79mcK2Lrk1OLeB/9uCZzvwbA+eHcDzdsjvCM53gEMn6OoMXV2g605h+7btGvrf2oeQczfkdIOc7vBzD8i8B5x7wlf3gv99Kq8cnTER2tsbtjwADg8K21yRPsK2nruvsK3n7idsY7gPIX9/8B+g8yRM92BwHgJuQ6H3MWEbA30ccp4Iz9OwdqCwjU0/Cf8MF7axgBHC1g8zMkyPBOdohPlHx/u+2THQNVbY5juNi/fzncYr3eY7TQDnZ4Stb+1ZyJkobPInCdscp8ng8BzKdAr88zzif6qwzRmbhrKeDh/OQDnOBLcXkGcWYuNF1I2zwf8l1F1zwHMu7JonbP2688F5AeJqIeqxl8F5Eex6BdxeBf/F4P8a9L4ubP32S4SX2pi7sPVLvAldSyF/GeS/BfnLIX8F4mElbH8HNr4LG9+Drveha1W837tpLXStE7Zv1fXQu0HYzmz7QPgta5dC70fgvxEyP0Y5bkI5bkY5fgJbPoXez2SvzWf7IrQlEpz1Eubfgvj8Cny+hh+2Ctt3zTb4ZDt88g347xC2fSB2wpZdwrYnxLfg+V1Y7pHg3JmQ2/eQvwd8fkCc7xXO3/9K2Po3fhJeaePywrZHxH7E5wHYflD4nUhw1k1E+1X8LGz7VfwC/xyGvUeEbR+Lo8K2j8Ux2H4c74UTKNOTKNNfUaan4IfT8NVvKNPfUaZ/IP9Z2HUOnP+ED/9Cmf6NMv0HPv8XNp5HmV6AXReBXYIvl0iC5xyjM2NszVoBpdu4QKywrVmLS/D84yEnQffaXiBJCd6HycI23yMlwfNMFbb9QtKER+NcoQd1tlBE8x+yEry92QneDzkJ3q5cYdt3pKCw7TuSB56FgAsLJ+j8otAPRRJ8WRSFT66AT4rBJ8XhkxKwvSR0lYIfroTtpWF7GdheDraXh+0VhG0PlYqwsZKw7eFXOcHHTxVh2y+lKvx/FXxYDT68Gn64Bn6oDj/UgB9qwg+14Ifa8EMd+OE6+OF6+OEG+OFG+KEu/FAPfrgZfqgPPzSAH26BH26FHxrCD43gh8bwQxNhW5d6G+xqijzNhG1danNhW5faIsHXGy3hz1YJ/vuxjdLt+7Gt8CKdcxXqap/g64cOCf77sWN4NpW1e4WtndYpwc9V64qyuyvBj+F2g73d4c8ewvb9eA/80xP23iv8qs7fCuvA+8G5F+ztDXsfhL19YG9f3NsP9j4EewfA3odh7yOwdzDsHQJ7H4O9j8PeJ2DvMNj7JOwdLmzjFyOEbf3jyDD+I8G5YWGe0cI2/vIU5IwRH3vfjVN6Ks4YS9E5YxGt8Zyg/JbnWciZKFxK55FFtD/0ZGHbS+k5YdtLaQrufV7Y9lWaCr3TkGc68sxA+kzhfPuRZxbqgReRf7aw7dv0EvLPQf65yD8PMTMf6QuAFwrbvgEvC9teUIuEbS+oV4RtL6hXhW0vqMXCthfUa8K2l8jrwjYXfYmw7RH1RliO1o4Vtm+cpcL27bNM+AFrI8LG5eC8AulvI30lbHkHtrwLW96DLe/DllWwZTWenTXw7VroWids+12tF7a9gDYI2z4SH4DPh8K2J9ZH4LYR3D4Gt03gthncPkGZfips644/E7Z1x58Lz9D5dxHNB/4Sz1p4Hl6KzsSL6L3wtZ4R268rPCPP9uvajlj9Buk7kL4T6buQ/i3Sv0P6bqR/j/Q9SP8B6XuR/iPSf0L6PqTvR/oBpB9E+iHUGz+jHvgFZX1Y2PboOJLgx/iOK93GuU4I19VZgRHNtf5V2PY5OyXf2j5nvynd9jk7I2z7nP0ubPuc/SFs+5ydFbZ9zs6FdbXNLxW2fc7+ErZ9zv4WtjkS/wjb+P6/iJPziIELeDbDMw0X61zD0A8R4Bhha3tEE31MFkj0PolN9M9RnLC9I+KF7T2SIGz7bScK295sSdCVDF0pwgVwxmKszlkMOaQL23duBjhk4t4sYRtvzRa279Yc8MwVzu/j1XmDNsZaWOn2frwMHIoIL9A5jxF911ye6P15BfgUE7b954oL2/5zJYRt/7mSsKuUzkS0NSmlIaeMsL3Tywrbu76c8tv4WgWl2/y08MxJ29OuEnxSGeVSRTh/HB8+uQo+qQbbrxa2PvZrgKsDXwtdNSC/JmypBV21Ib8OfHgdfHK9sO3JdwPk36jysnZyvUTfl1sf8hvA3lug61bwaZjo+0waQ28TYetDuy3R96E1U/o6nckZymyBeGgJOa0Qq62FrQ+tDTi0RZm2S/T96h0SfZ9nR+WxPrQ74NtOsLczyq4LuN0JP3QFt7vA4W7EfDfw6Q5dPeD/e4TNJz2h917ovQ957keeXsgTnlOarLNKQz4Pgmcf2NgX9/aDzIdgY39h+2YZIGz7OD4sbPs4PhLWRToLNaL250Bh299xkLDt7zhY2PZ3DM9Ktf0dhwrb/o6PCdv+jo8L2/6OTwjb/o7DhG1/xyeFbX/H4cK2v+MIYdvfcaSw7e84Stj2dxwdnotqbWZhW9MxRtj2ehwrbGtDxglb/8/TwrYH5Hhh2wNygrCNjT4jbGOjzwrb3pAThW1vyEnAk4Vtn8jnhG2fyCnC9j34PMp3KspxmrB9D04X7q6zZyN6f80M/Wztm8TgTJ1U4VDOLGF7v7+I+JktbO2ol4Tt/ThH+AWdaxvqmids7aX5egZtn8uFOoPX9rl8FXoXC9uel68J256XrwvbnpdLhG3PyzeEbc/LN4Vtz8ulwrbn5TLhi5HgLN2I9r9cLmz7X66AjW/DtyvxvLyDZ/ZdPMvvCdtc1vfxHK2CXashfw3kr4X8dWF6jHPr8bxvgN4PoPdD6PoIujYi/WPI3yT8tM4MDvN/IjwHZwjbXK/PkP9zcP4itCXGuS9DbjHObQHPr0L5Mc59HXKIcW6rsPXVbEP+7cjzDfLsELa9VnaGdsUEZxsbTohx7lth23P0O8jcLZwU49z3Yd0Y49yeMD5jnPtB2PYi3Quf/Chs46E/Cdsepfvgn/3wzwH45yDK+pCwvbN+Rp5fhK1NdRicj6C8jqIcj6FNdVLp9n75FZxPIf/p0CdW1yDPGXD7Xdj2W/1D2NqiZ8HzHPL/Gda39kyC599hTMY49w9s+Tf0uT2TwraH6wVha+dcBDen853z/wnbPq8xSZ5PNMnzKZDk+cQmeT5xSZ5PfJLnk5Dk+SQmeT5JSZ5PcpLnkwI+qcK212wa8qQL276zGeCWKWzjUFnC9n7MFrb3Yw7k5OLegsK2f20ebC8EWwqH/C22hO19XQR+KJrk4+Fy6LoCuopBfnHILwEfloTMUsK2n+6VkF9auKfODQ91lQ3lWBtb2PbfLS9s60oqCFsbqSI4VIKcysBVQh/qbPJIuA+YcP4+YDoL3PJco3Sbn19d2ObjXQs/hGebm89rJflntjb8U0fYxkGuE7Z1K9cL217CN0iO2XUT7KqrM8fz9zFAeTWAf27Rvfln+8G3jWB74zDerF2N9NuErc3cNPTPpfq5WZKvo5oLL9aZ7aFdLVEWrSCzNfi3Qbm0RZ524Nkecjogz+3I0xEy70D+TsKNdH58eG8X3Hsn7u2KsrsryX/rdcOz0x3l2AP23oNy7IlyvBfleB/KsRds742yewDPxYPg2Qf8++I57RfWadbGhsz+yD8A+OEkXyc/gvRHkT4QZToIeDD8MwS2D9VZ95dd+vFkkv8mGqF0s2UMbBkLveOEbW/sp8FhPGyZgPzPAD+L/BPxDE4Cz8ng+Zz42Dzz6Uq3fbhnCNtZgjOFbS+LF8Jyt7arsO3V/aKw7dU9W9j26n4JnOckBe9Ja2O8ihhbnBSc6Wj+eVd87Dldg/fIWsTAOvhtPWzfIGzjBR8I27zlD6HrI2HbO3yjysXqtE2o0zYn+e/ZTyH/M8j5HM/UF8jzJezdAj9/JWz7lH8dloW103DvNmGby70d6d8I277mOyB/p7DNYdiF/N8iz3fC1j+/W3YZ/z2oD38Qtr3S94Z+s7YZbPwJ8vcB70e5HIDeg+HzG+PcoVBOjHM/C9ue678g/2H49gjkHwU+hjzHEQMnENsnk3y/yinkPy1s+7v/FsZ2jHNnEGO/g88fqH/OwlfnYO+f4PAXeP6NuugfYWvf/os851GHXAD/i+Bj/wvjJ5LsOcQk+2cwKmz70xdI9vxjkz3/uGTPOT7Zc05IDmTbfvZJyZ5bsrDtbZ+S7OuQ1GTPMy3Zj/dlKN3G+zKTA9k23lcI/Asn+7K4TNjqgiLCNt5XVNjqgcthyxXJmltqMRraa+uGhO3cn9LwTxnYWxb2loON5ZN9GVVI9vVGRWFrz1RC/spIr4L8VYVt7/+rYGM1+cfOAbgGtlSHzGuFrW+2BvxcE36uBT/XgZ+vg59vhp/rg0ODZD+ueiv83BD8GyUHvOwd3RT+bwbOzRFLLeDnlvBzK2EbY20Nn7eBvW2FbUy5XbKP//bg3wF+uB1+6Ag/dIIfOsMP3SGnB/xwD/xwL/xwH/xwP/zwIPzQB37oCz/0gx8egh/6ww8D4IeH4YdHkv0z/miyr68Gwd7BkDkE9w6FzMfA53Fh6z98AvKHwSdPQv5wyB8BW0ZC1yjoGg1dT0HXGGE742KssJ1xMQ4yn4bM8fDnBGE7B+MZYXvHPStse51NTPbvjkngPxl1yHOwcYqwtUWfh66p4D8Ntk+HjTPAcyZi4AXonQVdLwrb2R2zha0f8iXUz3OE7UyPucJ2psc86J2P8loAvQvB82XwXwSer4Dbq+C2WNjODHlN2M4MeV3YzgxZImxnhrwhbGeGvClsZ4YsBYdl4PwWOCxHPbZC2L6P3sYzvhLc3kH6u0h/D7a8r+fC5ruuTvbjHWuVx57TdSjf9fDPBmHrJ/wAcfhhsv/u2whbPoYtm8BhM7h9EsqJce5TYZvz/Bnqmc/B5wvw+RIctgjbWVdfgc9W8NkGPtuF7cyWb8Bth7D1A+8UtrNcdiX7tut3Srd5AruF7YyX78FnD3T9APl7he0cmB+F7ZviJ2E7E2Yf8u+Hrw4I2/fXQTyPh8Ln2tqB4HlY6fYuPgI/HEXsHYM/j4P/CWGbn3wStvwKfErYzqs5LWzn1fwG/mfA/3fw/wP8z4L/OfD/C/z/Bv9/wP9f8D8P/hfA/yI420dJJDybMcWnxwBHUzz/AsJ29k5sirclLsXHZ3yKj8+EFM8zETKTUjznZMhPSfExkAr5aZCZLmzzbDNSvI2ZKX6OVrbSrQ88B7pywacg+OQJ2zlChYStT7hwii+jy8ChSIqve4si/XLwuQLyiyFPcWE7p6gE8pQUtjOLSsEnV8IPpYXtLKMywnaWUVlhO8uoHHSVl0/sXKOKSrdzjSql+DipDP9UEbbzjqoK23lHVwnbeUfVwpiJce5q8L9Guuzso2uVbmcf1YA/a8LGWrCxNmysAxuvg43Xw8YbYOONsLEubKwHG2+GjfVhYwPYeAtsvBU2NoSNjVL889gE5Xgb8jQVNj80gx+aww8t4IeW8EMr+KE1/NAGfmgLP7SDH9rDD7fDDx3hhzvgh07wQ2f4oQv8cCf80BU23iVddp5VN6XbeVbdhe08qx6w9x7c21PY7r0X996He+/Hvb1wb29hOyPrAdj+IMqiD57Bvri3H3z+EHzeHz4fAJ8/DJ8/Ap8/Cr0D4fPB8PkQ+HwofP4YfP44fP4EfD4MPn8S/IdLV/64kdKtLTQKtoxWHtsbfAzsGpsS/N3aseMRw88oj50z9iw4T4T/J4H/5BT/HnkOdekUyTSeU1E3ThO2Nth08JkBzjPBeRbyvAjOc8B5HjjPB+cF4LwQnF8G50Xg/Ao4Lwaf18DhdchfArveELa235vCNt60FLGxDBzeQjkuh/wVwvcavzA+7ZymFPWR2HtO6Xb+22pha2utEbY2/1phOxdunbCdC7de2M6F2yBs58J9ED6D1m8pbGfEfSRs+2VtFLbz4j6GHzbBrs3w5yew8VP46jNhe4d+nuLHTbbA51+l+O/TrZC/Dfduh8+/wTO+Az7fiTbAt+DwHXjuBs/vhbvYODL4/IAy2gv5P8IPPwnbGXr7wGc/+B+A3oPQewjcfobeX6D3sLCdy3dE2M4CO4p7j4HbcXA4Ab0nofdX4FO49zQ4/AYOZ4StXfc74vwP3HtW2L4lz8H2P4XtLMG/wO1vcPsHfP4Fh/OIh4uQaRNbQr2RVC8zJtXLjKZ6mQVSvczYVG9XnLB9R8cL2zmHCcI2ppCY6uuTJOhNTvUxkJLqn5HUVM8zLdWPxWQo3dahZIJnFnhmC1u7N0fY1pvkgn9BYesbzIMthVJ9PBQGh8uE7czGIuBfFH67XNjOcrwC3IqBW3Fhq4tKIE9J5CkV6jK/pPrntLSwnQ9ZBraUFbZ52uWE7dzI8pBTITXga3KqKN3+VYXtVwnbd3o12Hi1/G/jLNXB+VpwrgE+NSGzFnxYG2VdB/del+rXidyUqjXoto5eeeybvT70NkgN5Nn8xiZKt++428C5aap/vpqhTJuDZwvkbyls/YqtkL81+LcBh7bg3w73tkdcdUCe21P9u6ajsPnzDviqE3R1hq+6gOedqYE849Ad8ntA7z3g01PY+rrvTfX1z32pvq+7F+T3hswHkP6gsLWR+ghbf29f+LNfqu/v7a906+8dkOr7e4cg/ofC9sfA7fFU3/c7TOl29umTwtYPPBw2jlD82JmoT+lei4exqb4uHSdsZ6U+LWxnpY6HjRMUV+bz55Ru8xKn4Bl/HmU0Vdj6jacJ25mr0/HczUDMzBS2s1hfELazWGeF8WBjssJ2FutslMVLwtYPP0fY2oFz4cN5KJf5KJcFKJeXUS6LUC5voFzehMylKJdlKJflKJcVKJe3US4rUS7vo1xWo1zWoFzWolzWoVzWo1w+RrlsQrlsRrl8gnL5FOXyGcrlc5TLFyiXL1EuW1AuX6Fcvka5bIWft8Fv28M6JOLcN+C5Q9jO190Jzrtg77fg9h107Ra283i/x/O4B/HwA/jsBZ8fU/048r5U3/4/gLruIGLgEDj/jLroF3A+DJ5HwPMoOBwDh+PC9u1wAnFyErb/Cr2noPc09P4GvWeg93fo/QMyz0LOOcj/EzL/gsy/IfOfsF61NS/CNlftvPAo6w8UtrORLwr3z+9o094eMc5F04J062MvIGznJMcCxwnbmcnxwnZmcoKwnZmcCDlJwnZ+cnKatz1F2M5SThW2936asL1P04XtjOUM3JuZ5ssrC/dmp3l/5qTpm8PeZ2neh4XTvA8vg8wiwtZ/XjTN+/By3HtFmi+jYsI2VlUcfEoI27nqJdN8GZUStjOirxS2M6JLI08ZcCsrbGdHlxO2s6PLC9vZ0RWE7ezoisJ2dnQlyKwMXVWE7UzpqrD9KvCvJmxzM64WtnOnrxEeFeNcdfj5WmE7j7oG+NSELbXSgvXxdk513TT/DX6z8tj89vrCNs+tQZp/3m8Bt1vBuSE4NEK5NEZ5NYGc23BvU+H8NSzwVXNwboH0lri3Ffi0FrY+/DZp/pltm+brkHbg0x6cO0DX7dDVMc3Xk3dAbyfo7Sycf4am/GnnfneFrrug625w6wZfdQeHHuBwD/T2hN57IfO+NF8P3y+cvx8RfN4bfB6Argehq4+wreXvC1390vzYXH/wGSBsa5EeVh4rx0eVbmuRBkL+INRFgyFnCMpuqLC11R8Dh8dh7xOwcZiwrT96Er4dDntHwN6R4DMKHEaDw1PQOybNj9+NU/1sNk5AXfeMsJ3x/qywnfE+EZwnoawnh89XjHPPgdsUcHte2PpepoLnNHEwnjPB8wX4/0XYPlvYzpZ/SdjOlp8DbnOF7Zz5eeA5P6xXY5xbIGxnzi8UtnbRy+C/CPxfAbdXET+vwZbXET9LwP9NxM9SyFyG+HkLcpaj7FYgft4Gh5XCky7Vje8IW9vmXfjhPcTV+4irVYir1fDtGti+FjzXwYfrhSdbHyA4fwBuH4LDR+C2EXo/BrdN4LAZHD4Bh0+h6zPo+lzY9qT9Anq/hK4tiPmvUYdsFbZ1TNugdzv0fgO9O6B3J3Ttgq5vYct3kLkbMr8XtrVaeyDzB+TZK2xrtX4UtnfZT8izDxz2I/0AZB5EnkOw/Wdw/gXlexj8j4TPtbVpYcsx6DqOGD4BXSeh61foOgWZp4Wfs3FtyDyT5vtb/kjz813PKY+tTftT6bY27W/c+w/K9F+U3XlhW5t2QdjWpl0Utr4jC9KI1vhHhG2uQoywcYgKG7cC6Zq/Y23XdO+H+HTvh4R074fEdO+HpHTvh+R0zz9F2OqN1HTPPy3dl2l6ui+jjHTf5snCvdm4Nwf35go/H+NcQfDMSw+uJrOIZOavDYH8YpBZHPeWELZv25LpPk5Kwa4rcW9p8CmT7uuHsum+P79Cuo/JipBfCT6sDD9UAeeroLdaun/vXA0O14BDdeFK1uaEXTXSfR1VE3xqoUxrg1sd4ak21gye14PnDfDPjeB5E3Bd4fw118L2nXgz8tQHzwbC02zcWXi6jTuDQ0PIbATbG0NmE3C7DXmaQlcz5GkuPCPGuRaQ0xL2toLfWiNPG5RFW+hqB9+2F7b+8w6Ik9vBp2P4zMY4dwfs7QS9ncGnC/jfCT5dweeudD9e0C3djxveI2zc7ksP5L1gY8S6d1aMc33BoR94PgQO/cFhADg8jLJ+BPY+CjkDkX8QfDUY9c8Q5BkKux4L89u6aWEbI3hC2No/w1AWTwrbv+HgMEJ+ePHS9/topduYxVPCNjYxBtzGgs844KfBbTzyT4D/n1W6fe9MhG8ngc9klPVz8PMUYWvTPg+fTwWHaeAwXXi2rSWBH2aiHnghPXjWTdfr4LAE3N4QfsnmJYLPUnBYBg5v4d7lsGUFfPI2eK6Ef94Vtm/q93HvKty7GvLXpPu+r3Xgsx58NkDXB9D1EWJyI2z/GHo3Qddm+O0TYRuP+BQ++QwcPgeHL8DhS5TFFtS3X0HX15C5FTK3QeZ24Tk2LxHpO5C+U3iuzUtEnm+BvxOed6nO2Q38PTjvEZ5v64iFF9haFeGFNkcRZbEPtuyHLQdgy0FwOARdPwtbH90vwta/dBj5jwAfhQ+PQc5xlPVJlPWv4HkaZf0bOJ8B59+FX7a1w9B1VniRzUUUtrG2P2HjX+D5t7DtrfcP5P8LveeR/wLSL8IuS4ioTyOS4WMpRtj6Q6LCr9iaFGHrN4jN8HEeJ2z7AcZn+LouIcO3V5MyPOfkDO+rlAxvY2qGtyUtw/NPz/B1ckaG558J/lngnw3+OeCfC/4FwT8P/AuBf2HwLwL+RcH/cvC/AvyLgX9xYduDsQT4lwT/UuB/JfiXBv8y4F8W/MuBf3nwrwD+lcC/MvhXAf+q4H8V+FfL8HXm1eB/DfhXB/9rwb8G+NcE/1rgXxv864D/deB/A/jfCP43gX9d8K8H/jdDV33wbwD+t4D/reDfEPwbgX9jcG4CzreBczNwbg7OLcC5JTi3AufW4NBG2NqobcG/Hfi3B/8OuPd28O8I/nfAJ51gS2fY0gW2dIUtd8GWu2FLN9jSHbb0AJ97wL8n8twr/KrNUQzz2xxFYZun0Uv4tRjnegvbfhcPwMYH4Yc+0NUXHPpB70PI01/49RjnBqDOeRgyH4HfHoUfBsL2QfDJ4Az/nThU6bYv3GPC9u9xpD+B9GFIfxLpw5E+AukjkT4K6aOR/hTSxyB9LNLHIf1ppI9H+gSkP4P0Z5E+Eb6aBJ9PFl5i/aLCb8Q4N0XYxqmfR7lMzfDj1NOVbuPUMzL8OPUclNFcYXtHz8vwY9MLlG5j0wuFbWz6ZWH7vliU4cemX8vw84uWKI+NR78hbOPRb8LGpRl+PHql0m08+h1he/++izh5T9jGo98XtvHoVcL23bEasbRG2Maj1wrbePQ6YRuPXi9s49Eb4PMPwPND8PkIeTYKW3/axyiLTSiLzSiLT1EWn6EstqIstqEstqMsdqAsdqIsdqEsvkVZ7EFZ7EVZ/Iiy+Ak27kNZ/IKyOAzbj6AsjqIsjqEsjqMsTqAsTqIsfkVZnEJZnEZZ/AY/nxG2Prrfha1f7g/kOStse0KeQx3yl9LfjHHub+GltocMyuhf4WUxzp0Xfsv2kBG2PSEvCi/X5AvDK2KciwjbnpAxwm/bOLWw7Q9ZQHiljVMLv2N9fcK2J2S88Ls2Ti1s+0MmClsfY5LwezZOnenLLkX4fRunztS3psWQ0lfZ2LSw9T1mCtscp6xM78Ns4Bzg3Ezvq4LCq23fmEz/jigkvWtinLtM6Wttjl+mfy8UFba9AS/PDOTZnpzFlW5xXgK6Smb656KUsLWprsz0MVA608dnmUzfP19O6RbP5eGrCsLlbN/FTB+flWBvZeAqsLGq5Bv/auBfHfyvBf8a4F8T/GuBf23wrwP+14P/DeB/I/jfBP51wbkeONwMDvWF19kaE+H11tcH+beKg/FppPQNMc41FrY+kCbCNm/htkxfJzQFn2bg0BwcWiAOWwpbH3IrcGgNn7SB/LaQ3w72thf+wPr3hD+09Sbg0FHY9m+5IyyLS9/ancCtM/R2yfT18J3Ctu6+K3jeJWzfpHejvLqBc3dw7gHO9yCueoLDveB8HzjfD869kL83OD8Azg+Ccx9w7gvO/cD5IXDuD84DwPlh4EfC+LF2HWwZCG6DoHcw7h0CG4eG/K2Nh3sfhy1PZPp+gyfBeThsHyFsa+tGwpZRsGU0ODwFXWPAZ2xmoMf6+Sco3ebbPAOZz8KuicK2V9WkkE+Mc5Oh6znknyJs3ybPQ+9U4Y9inJsG26cj/wz5YaPNewT/WZD/IvTOhvyXkH8O5M/FvfPg2/nw7QLYvhD+fBm6FqF+ewV6X4XexcIfW1sRul4X3mTrsqHrDZT7UuhdBr1vQdfysB6IOLcCet8WtjJdKWxj4u8I25rWd+GH9/CMvA+9q8BtNfivga/WCls/8zrwXA+8IawD7fwdpH+IZ+ojPFMbYcvH4LkJ924Gh09Cf1qbUzjV9lrEvZ8jBr6AnC+Fbexvi7Ct7/gqzG/nReLerbh3G8pie/gesT3JM/08h12w5dtM3+e8O/S57T0u3ML6P8Oys73HhbPtLEjhHNt7PIw9W6MtbHs67QPP/ZnB/C6z/SjK7hj8dhx1yAmU9UnEwK/h8277h8P20yjT35B+BmX6O8r0D/jhLPx2Dn77C377R3mesvYq7j0PH16EDy3YQx9GsrwPY7K8D6NZ3ocFsrwPY7O8D+OyvA/js7wP07O8DzOyvA8zs7wPs7K8D7OzvA9zsrwPc7O8rwpm+fjME95sa5+RXhjplyG9CNKLCtu8iMuzvK+ugK5iwjYvoriwfceVELY+8JLIXyrL9+2UzvJzCcoqj80lKJfl5xJUwL0VhfPP6c7yZV1Z+BOb9yhs+65XzfLP4FXgU034U1vjLGzzEK4Rtm+E6sI2D+FaYfsWqCFs8xBqChv/WsJmV23xN79dB79dD1tugN9uhN9uEv7M5k/CxnqSaTzrg2cD8LwFPG8Fz4bg2Qg8G0umfWvfpnT7vm4qbN/XzbL893Vb2NIO8dw+y39f3650+77uKJx/7oxw/rkzWf77umuW/76+W3ns+7qbsH1fd0d89sjy39e9lG7f173x7DyA5+VBYfu+7iNs39d9he37uh+eqYeE7fu6v7B9Xw8I/WZrh4Xt+/oRlOmj8PNAlMUgxPZgxPZQ3PsYuD2OOH8CMTBM9+bvvYN4GIl4GIV4GA0OTyEexoDnWMTDOMTDeMTDBMTDM4iH5xEPUxEP0xAPMxAPMxEPLyAeZiEe5iAe5iEe5iMeFiAeFiIeXkM8vI54WIJ4eAPx8CZ8vhTxsAzx8BbiYTniYQXi4W3Ew0qU6TuoP9+Fr95DnvdRD6xCPbAaedYI27tpLfy8Dj5cD59swL0fCNu6jA+FrXw/QlxtzPJ9a5tQ1ptR1lvA/ythK9+vUaZbw/egtWHAZ3uW5hxZWwXl8h3KZTd8/j347xG2NuQPwrbmaK+wtQF+BLefYOM+2LgfNh6EjYdg43HIOQEbT8LGX2HjKdh4GjaehY3nYOOfsPEv2Pg3bPxH+PMY5/6FnPPAF4StXXoR5WsDLKHtkWxve0y2t71Atrc9NtvbnpLtbU/N9jGWlu39kJ7t/ZCR7f2Qme39kJXt/ZCndPt2LiRs++wVzva2XJbt/VMk2/unaLb3z+XZ3j9XZPsYKJbtY6A4+JcQtndoSfihVLavM0tn+zqzTLavM8tm+zqzXLavM8tn+zqzQravMytm+zqzcravM6vAz1Xh5xrgWRN+rgU/1872dWYd+Pw6Yasnr8/29eSN2b6evCnb15N1US71UC63Zvt6siHKohHKonG2rxubZPu68TaUUdNsXzc2y/Z1Y/PQPzYPLdvXjS1Rpq0QG60RG21Q1m3h83Yol/bC9j7tkO3fpx0h/w7w7yRs79POiIcu2f592hWxcTdioxtiozs49EBs3AOePREb9yI27kds9EJs9EZs9EdsDEBsPIzYeASx8ShiYyBiYxBiYwhiYyhi4zHExuOIjRGIjZGIjVGIjdHw7VOIjTGIjbGIjXGIjacRG+MRGxNQds8gNp5FbExEbExCOU7O9vNkpig9f+8+4S9inJsqbP2u0+Db6fDDDGHzw0zY+wLsmgWeLwrbe3k20l8CtznC1u80F+U7D3rnQ+8C+HwhOLwMDoug6xXoehXyF0POa+DwOmJ1CTi8AQ5vQu9S6F0GvW8hfXm2fwetAJ+3URYrEfPvgOe7KIv3wPl9cFgFbquF7Xlfg3fQWti1DnatB88N4P8B3iMf4j3yEbhthC0fw5ZNsGUz8n8CWz6FLZ/Bls9hyxew5UvYsgW2fAVbvoYtW2HLNuDtwN8A7xC2Mxp2Ctt38S7k+Rb4O+DdwN8L21yOPUj/Ael7hb+0cVLgn5B/H/B+YTtj8YCwnbF4UHiL7f8s/JXt+yf8te3/DLsOQ+YR4KPAx4TtHMPjqje2xjh3UunbbFxV6eaf04iB34TtDIszynPE+qCUbmclnBXebnPqhJPsPDvhb2y/FOEdNpYqvNPGUoXtXMV/he0sxfPZfhz2IvhYsIQxGcnxcRiT498X0RwfPwVyfP0Zm+PjME7Y9gWKF7b5wwnC1m+fKGx9v0k5Pp6Tc7xvU4Rtv/TUHM8zDRzShXfZWGqOr5cyha1/Jkv42xjnskMOMc7lQFcucEHh3TaWKvy99XdBfuEc/0xdJmx97EXAsyjkXI78VyB/MeQvjvQSuLek8B7b6w98rgSf0pBfBnLKQn45yCwv/IOtBYbMipBZCTIrQ2YVyKwKv10F+dWE91qfGORfA/nVIf9ayK8B+TWFf7Q9AIV/inGutvA+a9MK77d1GcIHrE0LOTcgnm8E55uED1r7Fvnr5fg2QH08Fw2ErQ/2FuFDthZD+GfbA1D4F5trB7saC9t6hybCh20/QOEjMc41zfFjK81z/JhvS+WxdYKtcnzd3jrHvyPaCFv7oS2eqXZ4NtvD9g45vv6/HbZ3hO2dYHtn2N4Ftt8J27vC9rtg+92wvRts7w7be8D2nrD9Pth+P2zvBdt7w/YHYPuDsL0PbO8L2/uhPnkIefoLj7P2s/BR668TPmb9ddD1qPDxS3X1QMgZhNgbDD8PkY0nrP0MDo8Ln7S9/qB3GHQ9CV3DoWsEdI2ErlHS9au1saFrDHSNha5x0PU0dI2HrgnQ9QxkPitscx0nCuev6RA+ZeOw8P9zwqdt7pzwb5fq5+fBYSo4TAOH6eAwAxxmCr9h7W34YRbiajb4vAQ+c4RtL6+54DAPHOaDwwJwWAh7X4b8RZD/Cux9FfYuhq7XoOt16FoCXW/A3jeFz1jfo/DvMc4tQ563kL4cPlkhn/xh/Y1KP2vrjlGO7wqfu1QPvweZ78PeVZC/WvjPS/XwGsTVWti4Djauh40bYOMHkP+h8F+29yB8uFHY9g/5GHI2gedm4E+E/7Z9s+GHz3L8PJ8vwO1L4X9szxzhf23PHOHztmeO8AU7P0X4Yoxz24RNwXbw/wb8dwhHos7tDG2POrcr5BZ17lvUgd+B/+7Qrqhz36Ps9sCuHxDzP6KMfkIZ7YO9+4WtnXYAZXEQMXAI/vxZ2Nbo/YLyPYyYP4JyOSps6wiOIf043hcncO9J8bc2w6kc33b9DfnPIP/vymPfDmfhh3OhrqhzfwrbnPO/YOPfkPlPaEvUuX9D+VHnzkPXBWGbc35R2Oacm4BwXDImN0i3OefRXO+fArk+tmOFbR54XK73SbxwQtS5BKQnCtuehEnCd5qPhL+2dpVwYtS5VGHbGydN2PaxTIfMDGF7n2YK2/s0S9ja+dm53p85ud5vubi3IPLn5fp3euHc4D6zt6jy2DfO5cI2b+0K4fx9cuCr4sLW31Ii1/u/JPiXyvVldyXSSyO9DNLLwpZywtbOKQ+7Kgjbd0pF4aSoc5WEk6POVc71z0IV8K8K/lfJD8b5anC4Rjgl6lx1YdvH/lrh/HNYhG2uQk1h61uoBbtqw5Y6wqlR566DLdejLG5Uus3/vAk860Jmvdwgb/75dEq3Ps9bYWND2NII5dJYZZ2/Zw44NEOcNM9F+xY+bAUOrcGtjXBa1Lm24NAOetuDTwf45PZc36a9Axw6IVY7g0MXyL8Tz2lXYTvf6i5wuxscuoFD91BX1Lke4HMPfNJT2PaovzeMK2v34t77oasXuPWG3geg90HI74N7+yJPP/B5KCyLqHMDlG7jgA/DJ48oT/7Zc+A5COU1GHqHwG9DdW/+uTDg8wT4DwO3J8FtOGSOAJ+RYdlFnRsFXaPB7Slh64sYA71j4cNx4PA0OIwXzt8/B3yeyfX9/BOF7b08GTyfA88p0PU8eE4Fn2ngMB0cZoT1T9S5mcL565TBZ1aun480GxxeQpzPAZ+54DMPfOaDzwLh7KhzC4Vtv/GXwXMReL6COupV+H8x8r+G/K+D/xJwfgM+fzO0N+rc0jDGos4tgy1v4Z3yNvivhI3vgMO74PAe8Pvgvwp17GpwWwPOa+VzOwtmvdILRp3bIJwXde4D4UJR5z4UtvfvR3heNsKWj8F5E2zZjDL6BLZ8Cv6fgdvnqOu+hPwtSrd4+FrphaPObYWubeCwHbq+AYcd0LsTenfBV98KW0x+F8aw9Q2Bz/fQtUfY3u8/gM9exPCP4PMTOOxDee0XtvfmAeQ5CG6HkP9n5P8FeQ6H/C/VvUfA8yi4HQOf49B1Aj45KWxx8msu+oGVbnv9/SZc5FLde0bY+lh+F7Y+kz/gn7Pw4Tlw+1N4orVphYtGnftb+PKoc/+A/7/w7XmU7wXUMxdhozXYQxsjwDHCdj5ytKC3vYDwecuH/HEFPed45E8QtnOTE4VtnXuSsPXlJkNOinD++S/CdqZhGtLTkZ6B9EykZxX0dU52QV8P5AhfEXUuV7hY1LmCwjYnME/Y+jALCdv4bGHYdVlB/zwWLej9f3lBX45XFPT+L1bQ+7w47C0BXFLYxnpKQc6VwvlrcGBvGdhbFunlkF4e6RWQXhHplZBeGX6rAr9Vhd+ugt+qwW9XCxePOneNcAlrAwuXjDp3bWhL1LkawtbuqhnGT9S5WsKlo87Vhn/qgNt1wmWizl2PcrmhoH/ebyzo6+SbCvp3ys1Kt/ZhfZWjnTl7C3x+K8qrITg0gszG0NtE+Db7J9zU/hX0z2Mz+Lw5dLXAs9MSMdMKHFpDbxvEW1twawc+7YVtDKsDnrvb4Z+OwtaOuqOg7yfpDD5dIP9O4K6IjbsK+rr3bsjvJmxjTN1hVw88+/eAc09hOwfk3hBHnbtP2Ob53w85veDD3uD8APzzoHC5qHN94M++sKUf5DwE/v2RPgDpD4PDI8jzKPQOhPxB0DsY9g5BTD6O+mQYZD4JmcNRL42A/JGQP0rY2mmjkf4U8o8Bh7Gwa5xw+ahzTwtXsPOgha09PAHx/Ax4PgufTERZTAL/yeDzHPhMAX4+1Hupfp4aPi+X6udp4DlduFLUuRnCla0tHdZjtmYHz9oscHsRnGeD50vgOQc85xb0fVPzlV4l6twCYWtjLBS+OeLcy3gWFsGuV+C3V8FnsbDN03sN+V8HzyUorzcK+u+CpfDJMsh/C/cuh40rhG2ezNvgsBK2vyNsbZV3we09+OR98FyFunS18O6Ic2uEv484t1b4u4hz61Au62HXBtm12fqElW5zJz6CjRth48cFA/usbvkU9n4Gez+HjV/Axi9hyxbY8pWwtZG+RjluBYdt4LwdnHeA807k3wXO34LzHnD+AZz3gvOP4PwTOO8D5/3gfADpB4EPgc/PkP8L5B8GhyO49yh4HhO2d9BxyDwBOSch51dwPgWZp4VtzvNvkHMGeX4XtjnPfwjbnOezyHOuoO+P/Uu4qrWHlecq6+Mt6NvnF8D/IsrR5QXY5vVFhG1eX4ywzeuLCtu8vgLCNq8vNs/XyXHA8cI2/zAhz88/TMrz/JOFrV2XImz8U/M8/7Q8zz8jz/PPzPP8s8A/G/xzwD8X/AuCfx44FxI2fxbO8/0hRfJ8GRUVrhZ17vI8H3tX5Pm4KpbnY6a4sPXbl8jzcVIyz8dGKfjkSthVWvjqqHNlhEdFnCsLPuXyfH1VHnor5Pk4rAhulcChMjhUAYeqkH8V+FSDnKuh65o8XwdWh/xrIb8G5NfEvbUgv7awlXUdcLhO2Npp10P+DbDxRsi8CXrrQm896LoZ8usjrhoI27v+Fsi8FXobQm8jyG8MvU2Ab4Pepnm+ndMc8lvk+X0aW0NXG8hvCzntwL+9sI1rdEBZ3A75HfN8X2UnyO8Mnl2g607o6gpdd0HX3Xm+bu+WF9Trprc39D4AvX2gty/09oPehxDP/ZE+QPiaqHMPg9sjwtWjzj0qbPtyDBS+NurcIPAZDP8MEa5xqc4cClseE64Zde5x4VpR554Qrh11bphwnUsknswLZF9nfbawa3RecM2fV5Dn6/xn4M9nYePEPF/nT8rzdf5k1FHPIf8U1C3PC19v7cawjrI6UdjmCk7HvTOEb7B2I+S/gHp7Furt2bj3JdTbc1AWc1EPz0M9PB/18ALUwwtRD78sfOOlum4R+LyCOvlV8bkp6txrSrezLF8Xrht1bomwzTl8Q9jGQ9/UvfZ8LdOzZn13K5Re79K3+UrY+A7sehfl9R5i6X3hm6POrRKuH3VutXCDS9/ma1BXrEX8r0OcrIfeDcL2XfmBcP66JOH8+bfgsxE8Pw5tjHFus9Ktj+4T4fx9gfB8fYaY/zzPz4f/Uul2lscW2PsVbPkatmzFe2Eb7NoOu75B/O8A/53Iswvx/y3i/zvk2Z3n2zx7hC1O9iJuf0Tc7sO9+xG3B5B+EPgQ+P+M9F+QfhjviyPIcxTpx5B+HPgEYvsk0n8FPoUyOo3034DPoNx/x3P3B567s3juzuG5+xPP3V/g8zeetX8QD+dh1wVh26flYvgMRoOHzPBya0MK3xp1Lka4YdS5qHCjS/VkgUKef2whHw9xhXxcxRfybb/EQj4Okwr5skgu5H2SUsjHWCpkpiFPeiEfYxmFfIxlIk8WcLZw46hzOcL27sst5GOpoLDFW14hPyZeGLZcBs5FhJtEnSsqfJu1J4WHRJy7QrhwjHPFCvl4KC7cNOpcCelqdul7vBQ4X1nIP4+lkV4GPikrbPM3yoFnedxbAfdWFLY1+ZWE82y/SpRLFZRpVWGbD3NVIV8PVxO2OSFXg881hXyMVRe2Ppxrhe0dVwM+rClsc1RqCdscldqFfP1wHWy8HjbeABtvhI03gX9d8K8H/jeDf33wbwD+t4D/reDfEPwbgX9j8G8C/k3Bvxn4Nwf/FuDfUrio9Z0W8s9465B/xLk2yNNW2MbE24XxZu1JyOwAfDvs7Qg+dxTy74VOiIfOhTTfx9ofkNMNurqDQw9hO/fwHmF7N/WUT+zcw/sg/37I7CVsa1V6CzePOvcA0h9Eeh+k90V6P6Q/hPT+SB+A9IeR/gjSHwW3gcJ2bsIg4RZR5wYLt4w6N0S4lbVFhW1fi8eEW1tbVLiNtUUhc5hwW2uLCreLOjcc947AvSOF21t7Vb7tEHXuKcgcE8Ze1LmxymPnWD2t9I5R58YLW3/XBGHr73pG2Pq7nhW2dW0Tha09M0nYxpUm47l7TrqsrfK80q1PaWohvwbwRcThbMTJS7rXvkPmKt3WAM4TtjWA8xFvCwr5NfWvFPLvu8XKY+sBXxO29YCvI/aWFPJr6pcr3dYDrsCz+TaekZVhnW97Tgrb2sB3hW1t4HuoH94XtrWBq+DD1cK2NnCNsK0NXIt4W4eYXC9s7cYN8NsH8P+H8P9H8P/H8P8m+P9LyNkC/38F/2+F/7fB/9vh/2/g/2/h/93w//fw/x74/wf4/wD8fxD+PwT//wz//wL/H4b/j8D/R+H/Y/D/cfj/BPx/Ev7/Vbi8teVQD59GPfwb8pzBvb8LWxvjj7CejDh3FnnOyVfW9vhL6flnyiD/P8j/L/JfQP6LyGOVcUTvnUjhIL99g0QLez4FhK2tGCts7e24wr69nVDYy0wUNr1JhX2MJQtbezVF2NqrqcLWXk0Tzt9bsrD3YQY4ZIJzljjcYe20wj4+c4U72Ri3sL2j84Q7R50rJNwuxrnChX2MXVbYx1IR4S7WZhO+09pswvnr7gv7eCtW2MdS8cJ+DKUk/FAKPK+E3tLweRlhi/OykFkOfi4PmRUK+/6lSoX9WEkV8KwqbPMurirsn99qhQMZdj5XdfC5Fn6oARtrglstcKsNbnWg97rCfv7kjYX9PMm6yF8Pcm5G+dYHzwbC9p+dL2znCtt5wiNTg3OIn9B5nnbGrZ17mZvmXNfU4NxIOy/Szia0Mwnt3NJTOlfVzj3cneLc6BTnhqYEZ21GZX9s+D1i4z0pQRvY6rgktfFSFPufJOYfH5rPMUM2Z6ntl6O4K6iza0MOdl5tIZ2nWth5TnZ2qp2ZOiQpOM/0MnEcmhScOVpE54Hambh5Oqf1/yuZH8UH7cPLLabtmz7FuWJWX6c4V1xt35J6rq3sX0hSrFqMWmyqXnssxbndCc5VsO8HnVVUWXKqWBxa/Kmf6hqdh7Ygxbka1q+R6lwt+0ZIcm53vHNXWxxazFl8WVxZPFl/l7XnLZ6s/W6xZDFkfk5zrmGyc40sdixmrF1u33F2X4pzN1vb3NrkLshj6U2s/khxLinRueRE51KsPBOdS08M5jVkJjqXlRjMa8hNdK6t9jxjPDWz9p+16awtZ20v+7sL8o5KCWxvZ20va3NZ+8raUtqXt5PVR1bHaN57V+tvVd9dN32n1kt1bkuKcz3svZHo3D32jrV3qL0v7T1p7zX5vre9s/T89LF2rvW1WrvW+latHatzQI1TqyTnHrY2rM63GGhtVZOZ4NymFOfuT3CuV4JzvROceyDBuQcTnOuT4FzfhGBuk/3N8uyLBPkHJDi3P+LcAXsnR5w7FHHuRMS5RxKcezQh8MXsJOcGJQQx9z/RM8TaeCnOPQZ9Q/XdZHvV2f1Pq50xwfpZ1Yf1uPuvXJ6wsX/3v/KpGBPsIzxFz0Gz/yGvYTY3wQXxZmdmG8cR4DjqPzj+J78x4PL/hsfI/43O/07HOPdf9Rj3iZDz5P/Av5OsDW9td/d/zd/6ZJbGBf0u9t5fkuzcw4nBe//amOCdP1Pv+BnJzs2ydr7NNUl2braVu76HliY7Ny+cd2DPe4LORdc81OV6r72i9u9i9ZvY3K4lWju3QnNpVobrwKztrX6mdWr32PjPB9Y2tjax1UfWb6z66S3pmm/tdHsn2Ni/ztA0/XP/H+j+Tzn/d1w+Vj22SePvn2hew2fWl2vvGGuna/3JV1o7s9XqXqsvkp3bqflQhq0tvktro/ZY29r6U23M3Z4baztrHtVhja38oTOR/rR+Tnv3IP2c0k/Y+wd5w/Sj9j6ydrG1h61PU/cyzxlrB1t79r95v+elBf0hiwo4d2dqcHa0nRNt7/1t9n1h3w/2HWr9wNb/a98HaqceCvci+A99pt/aDLanQNuIcwsKBG2Gf51vM1iDwt6xMboW0DVO1wRdk3S1mLY5ohfsOblUR1w0EbZWyva8tD0EbL91m/sZCfbxtD1Tbe9T2/PU9uO0fTVtD03bO9Ni3vbNtP0yi0acKxZxroTtGRkJ1nOWjgRzxq63/c0jzl1pcyMjwb7dtj/MFZFgbo7t7dzA5vnZnuiRYG6TzUOZk+xcJfvGSHGucsS5yyLOFYk4VyUSfEvYvTaOUDcSzBO8KuLc1Ze+Y2tY31vEudoR566T/hvsDBhbf2NzGv8bvbaHebX/Jt3257T+RPs2usb2OY84d+1/6Kjzv9ETcvvv9BUS3/+UW/N/IPt/J7dcknMVk5y7LMW5hir3CkhrpLTGEedaJjlXLSloz1RPCr5DayQ5VzPJuYVR34a4I+JcJ+OR5NyNSc7dlORc3STn6iU5d3OSc/WTnGuQ5Fxn45DkXJeIc42SnGtsMpOcuy3JuaZJzjVLcq55knMtkgLdYfvW3vOtk5xrk+Rc2yTn2ln+yH99zkZfamc0v1T+My+1E19Ida7FpZibl+pcS3s+Up17OdW5RanOvZnq3NL/YZ5WkeCs+tbWDxlxrn0kOE/ezpG38+Y7RJzrGPn/3x/dxKsLvhn+l3on4uuduyLB3y5LC869Z510W8R/jzSLBHVLO9QvXSNe/t2RQK99Q9wbce50vHPdL7VXeti+nZfi6AGbKxpxrm8kqFs+TXSuZyTIe5/t2R5xrhfyPhgJ5ktY/n6X5D0Uca5/xLkBdmZOJHhvPhIJ/PCorX2KODco4tzgSDD+MDQSnAnxuMWGeD0RcW5YxLnhdrZNJPDfyEgwJ6VDatDPONrOsYkE7YhxdkZNJNjrZEwkKNODCcH6zvHGLercM9ZHeKnem3ip3pt0KT4mX6r3nrtU702JOPf8pTpv6qW6YdolH0+/9BzPsH1eUpybeamOesHmNV6qD1+8VFazTV8kaHvMsfXtqsvmRYJvodYpQd/QgkjQnliovC9beV6qO1+xOjLFuTtjnRt4qcxftbo1xblS/wd37wEf5XH8D3+Rrhfi7rgbXEBggVtcCCCfTo+kg9PdcQWQdQIEOkAGJJBEfwDTm3vvPXF33HsvcYt77y3ucYvt2LGT+N3vM3PowDjx7x//3/fze/mgm919dmdnd2dm+04IuLQXcGUvucd2G8/ykT+9wE3Uy5sJ51nua42euX6Tbzfo9xt7SdpbSr7fXpL+TqOXL+PbnL2AK/j+ptGX13Bd0eiqm3lm0LTd3b3k3fF7e8m+Efn0vl7yDs4DHH/3Ah5km/UCHu4lZXpE2+vRXsCf2LZGHp8yPPlsEHi618bzR9oKepzvcPcSeyS0N/Ks8spzRm6fZ//iEryB3jLGK6Z9oRfwYi9Z+31Z07zSq2du/WoviU+7Fm/wbW2+o93rv58/vKc4mPZ9vuvtAz4wcvFhr583dv7YpP+ohI6/lNBRzHfTPD83MvYp78BQXrmmZ+Try17Cb1+ZNF+TD039f8O3jfjGtpGt77g2Z+r/H+RlMw/5F+9Y6yJQrzKgjPdNaM+P9ltot4Xv8LoBnxmv+8uAQBngpU2WMiBEGyxlQG/eeS6TeRztAWxZJm898e7KNmVyHoA2Azg/5d3kX5fJvuKOtJnCN6zLpG1Ypl3KgF3LeuazvKeze9nG6yN9+H5PmcTfg2/2lAF7lcm6xt5lG/NSvzKgfxmQDgMVfJenBBfnCdzr4b7OIMX3gV/yHVwG7Ms3d/jWjqY5gOtSZaL/dgwAB9FuHd/Q4fsrPuBQvpvD93L4To4e3rsoBAwrk7Ey7yDz/f3DyoBIGVBdBkRpn6RMzpH8EARq+dYN36/h26Lsw2mPhG/b8B2bMrkvmOCbjXyrkbZEWLYyWTtsMmWf7gVGqzvDetRv1ENcjxlDWyF895m2f8vkDalN12Z4h30c353hezNlslbTwjKWbbxe4+3dI3+TymStnXVfhNTBXEPn2nkr99TKZK2d695c156u+GZo3XMdu4Nvn7mBmWXALL7vzHed+T4M34Xhe4pl8iaFLwjM5zvMZbJWs5DvvfBtF8PDywwPLzc8vIJ8xbdZNA73j5Ya/l2t/nV8e4XvGnIuanj5aMPLx/BtxjJgAd+G4fst3DcqkzXJv7rERjTLRntyRTfhlSV+2jc+vkxstNPOOc/D0+4LbVzTHhNtTtP+M20q0X4SbSXRFtLpWh+0YXSbygTnsbRh0zsstpJpP5i2dml3lfZWL1S6rtG8K0JiK5T0lYbRXt5l6r9G6S1+f84tNprYXrco/bTDS/ustMVKu6u0S3qJloW22a7SstCO1LWbKQvtNt2ySXlu13l5v7CUifZ4eI7jdL/YsKE9ENq1uV/putAj9jNoK4Nv3fPteL4Hzzdj+fYu34zkm3WUWb4/x3fn+N4c34pjP8t34vjGWyEkb7rxLbfRXnnHjW+b8e0yvln2ssoA39J6VWnmG17UEXxri+9kvak8+pBb3sd6W2l81i1vNPHdJb639KQbeMrdo3/4ZhbfweKbToz3fkncUp32keLn+0d8L4TvF/H9IL4tVMTFN2/4tgnftVkXkHdpvlI8fGeGb5TwHZGTyuX9Eb6JwvdM+MYK31bhmyo/qF7iuyh836QioPPIclk/4lscfG+Fb6VMDMk7KXzbg29l8M0LvtNQF5Y3Gvi+At9D+DIo93F5Z5xwG4XbKeR9WL4vMNQl9+55H553r3kPmnePea+Xd0IX+uW+Ju9XPhGQu5W878Z7brzTxrtsXLfhPTbeX+NdNY4Lq8NyV4130XhfiXeNeIeG+pP3WHhWmndYtg3JuIz3VnhfhfdIeN6b57wP1Hj7a7wDNIxnM3mGk2cxeQaTZy955pJnLXnWkecXeWaQZwLXe+QMIM/y8Uwez+LxDB7PIfH8Ec8dcbzE80o8z8PzNzxHw/VunqHhvj335bkfz314jme5X859de6nc7+c++TcE+f+99acswRkz4k6gHtM7Pu5p8S9ofHlwIRyoIVtWQ5M4nsJ5UChHJhcDkzh3a5y6bvayoEjyoFpPLNQLvtMvyS+WeXADJ57KJdx90yeaeC7CDzDUA7M5pmFcmAuz8vybALPJJAnTDvaPHvAMwc898ozBjxbwDMFPEvAMwQc97NevIDH9E2ryoHV5SIXawzfruV9KraP4dmjOOY3/HhMOXCs4cXjDN8eb/jxBN5l4tlV3nUyPHkqz6WWi2xQLs4qB842/HiOqfcTy0XGzigHzjT8ea7hz/MMf57Pt4a8wAW8n8RzpIYfLzb8eAn5tlx061XlMr/8XbnI9KU8S2r483LDk1fyTj7v4pf36IZrDE9eWw5cZ/jxep4RNTx5Y7noipvIO4bH7jc89QBlwfDTnwxfPaLwCcOzNzNfng/luVCeBzU8e4fh2TsNz97Fu/W8U8+79IZP/2j49EHDmw8bPn3U0PCY4cnHDT8+yfvshhee5ntLhu5nDT8+x7LyPSW+o2T48aVy4GW+l1QOvGr45zXDM68bnnnD8MybhmfeMnzxtuGZd6hfQsCfDd+8S3nyAO+xngPA+4Z/PigXGf3Q8M9Hhn8+pkwEpY8ojs3+YnjpE8NLn5ZvrEM/03rZdH/ri3IZ+2y6D/XXchnbfGl48CvDg1/zvCD33Xr/eJzzt/KesQ73vD4v//Ge1y+dz7dGHr4xsvB33jcnDuo0vpXEOjSy8INuEPZyAWUuoNwlZfe6AJ8LCLiAoEvyCLmA60KiP8MuoLcL8Lt+fly3C/C4gC1cMmcjdFGfu4AtXT/e09zK1dM2W7uAbVxSpm1dwHZmHLW9C/i1C9jZBezgEj2zowvYSdNxrhPxyvddXECdB9jVBczhnMAF7O4C+riAvi4ZW+/hAvZ0AXu5ZG7I/r+fC+jvAqYrzgoXMMAFDHQB+7iAShcwyAUMdgH7mjHUfi5gf1P2A1zAgUrTb1zAQS7Zd+Xa+xBTB8e5gYNdwCEu4FDm75K+bZjr5831hrt65nlVrp553mGun55fRlxAtbZv1AXUuIT/SKNlcNRqGetckrbeBcRcwAgXMNKkixsab2c/4wISLiDpAlIuYBTLWdJ+GdO+WReQcwGjXdJ+Y1zAWBfQaPyHazs2uWR8lncBzVyTcgGHeWSt+GQPMN4FTHBtLCNzXECLC1jgEh6ZqDTbms8iF7DYBSxxAUe6gEnatq0uoOACJmv8KaxnF9DGenQB07SNZ7iAdhfQYfDPdAGzXECnC+giP7BuXTIfI31zXcC8zdA3v4S+hf+BvmWsa5esPS418rfcJeuPK12y/rjKyNdqI19rjKytdcla5DrDk5eYMfmlYeCyMHB5GLgiDFxZsk55jKnjY9neQflbzzL4gaNcwNHkPyNzx7uAEzSfEzUu8f8U7pNcwMlG9k7RMuU4b3H15Pl/G/9prh+v8W6qp890bV5/ck56ltEDZ7uAc1zAuS7Rpz+lQ0v19BmuH+vpXzqf81yyrny+0UcXkMdcG68r/87Vs0a76b7RJS7gUqOXLjN66XKjl64weulK1pvRSVdzXucCbjA66EbqIBdwk9E7Nxu9c4v6b6Ncu2Ssy78Hjbw/Sj1h2uExI+uPG1l/wuimO1zAnS7gLiOnd7uAe0yb3usC7jO65H4X8AB1vtF717t+GsdDRqc87BI9+AejK6+l7tL4j/xEmuL68+kuOQ9TXHu+2NWz9vykke332K8ofF7hiwpfVviqwtcVvqnwbYV/Vvgx29zog0+MfviIbW10wmdsz5CMk780eu8po/eeNnrvGaPrnnMBLxj99pIZQ79i9NlrLuANo6veMjroHaN73nUB7xud84HROR9SNxjd8oXRKV8ZnfK1S8Yu5LG/uYBvjF751uiRv6scfEceYvuYuvinHubhOPBf1A1uYI0b+IF9uBsocwPr3cBRbuB7D3C0GzjGDRzrFj6j3ip3Ay63ztncgJdrcyXzTbfBs8wH+N1AgO4AEDQ4Q24gbPD1dgtdv3LLmGkLxb21G9jWDezoBnZyA8+FgJ3dwO5uYBc3sKsb2NINbOUGtnED27mB7d3Ar93ADm5gN43LNcA+7p/XD/Z19/SDe7h7+sE93cBebmBv98b9YT93T3/IMvR3AxVuYIAbGOgG9nEDlW5gkFvGkFwjGlziPsIDTPMAvwrL/LnNI2P7or7a1y20/cYNHOQGDnADB7KvdwND3MBv3TJfHmbqdl0YqHIDHdwPcgMR066HuoGhbmC4G6h2y7h1Pzewvxs4xA1E3UCNG7BMWWvdQJ0biLmBEW5gJOO7N7/fvOk+M+Up5RY5GuXukaMxbmCsG2h0A4e7gSalt94NxNnubiDhBtLkF9NWWdPOOTcw2g3k3UCzW/YgxruBCW6gxQ1MdAOT3ECrW/righuY7AamsI3dQBvb0A1MMzw5nfXnlvXiFW7Z25/pBparf6Ub6HID3WxXN9DJ9jTtM8cNzFf3Ajcwww3M4l6IkYOFbsB2A4vcwGIjK0tYR26ZDywlf2+Cf5W7R67Wsp3+g0wdb3j6BG0rjutONPx9kuHvUwx/n2r4+zTmZeTiDCMXZ7qBs4w8nG3k4RzD8+canj/PtMPJ/8P4F7hFZ/zODZzvBi50AxcZfv+98urFpk0vMW13qeHtywxvX+6WOfUVhr+vVLqvcgN/cANXu4FrDI9da/j1OsOv17uBG9zSF9xoePcmw3s3qx54grrH8PKtpi1vc298JvF2N3CH4d07S3TJXYZv/uQG7ja885jhm6fNt2fcwAuGz140vPS44ft7DK/f6xbcxfH+fYbP7zf894rS+oBb1s0epowbvn/Q8Pwj7p71M+rDxxVHcf2sGM61YI7Z6H9uk7AinY9SfsJCK9eNNkfrS0X6Suh61fD8a6Ye3jD8/qap47cNr79jeP3PbuBdruvp3/uG1z8wvP6h4fWPDK9/TNoNn35i+P1TwzNbe4BtPMC2HmA7D7C9B9jJA+zsAXbxAJ+5gc8N339l+P5r6kwP8DrXEf8N7i+MfPzVyMuX5AkjC98Y+fjWyMnfjYx8R15mGxu5+KeRi3+xD9FDor08QBn7CQ/g8gBuD+DxAF4P4PMAfg8Q8ABBDxAy8hD2AL2pEz3AFh5gSw+wlWfzZdrBA+y4SdmmBYBdPcBuHmB3D9DHszFf3ReWtfY9PcBeHmm/vh5gDw+wtwfopzp4gMKBHqDSA+zvAQ7wABUeYB8PMMjMLQZ7gH09wH4e4EAP8BsPcJAHOMQj6whDPEB/D3CwB/itBxjuET6hruAf3ZyjFPlmqAcY5gGqPEDEA1R7gKhH+KTGA1geoNYjc896DxDzACM8wEiP6MI443qAhAdIeoCUBxil6dPMxwNkPUDOA4z2AGM47whsPBZ9wujyJ7kXyvNDZpz6DGUiDMwL9IxR5wc2PjdbHI/eFgZuDwN3hHWeEgAWBXrGqMXx6eIAcEMYGGvq5qYwcLipv+vDQKOps1vDwN1hoMnT01Ycl+c9P4/OcZ6fHkuP9wATPECLB5joASZ5hP5Wz78fszd7RDf8f0VDwQNM9gBTdKww1fPjscKmY4npHmDGJnE6PMBMDzDLI/q40wN0eYBuQ2+7B5jtAeaQJzzAPA8w3wMsKNJl0tgeYJEHWOwBlniAI418LzXyvczI93Ij3yuMfK/0SJ+xysj4aiPjaxg3CKw1cr7OI2vSR7HfM3J+jKH3WCPnxxk5P97I+QlGzk80cn6SR8aWpxg5P1Xr/nTPxvOm04zsn2Fk/0wj+2cZ2T9b6TzHyP65RvbPM7J/vge4wCN1yLWBi4zM/87I+e+NnF9sZPMS5sm9KA9wmQe43Mj2FUberzTyfZWR62s8ckbzaiP/1xr5v458auT8BiPnN5J3jazfTB1CvjUyeJsHuN0D/Dog+7E7mfnbzgHgHiPL93K9KADsFgB2DwB9AkDfALBHANiT58UDwJ1G9u/yAHf/Fzju8wD3m3Z/0OiSO7hf5RE8fzQ64yGjMx42OuMRozMe9QB/MnX2mEfGeI8bnfGE0RlPGp3xlEf6d54F4prb04bvnzG641mjO54zuuN5ozte8AAveoCX2N7KT58ZHvpa3e94ZC/kzx7gXa6pGv593wN8YHj3Qw/wkeHXj9mmhk8/obx4gFc8wKuG7/5u+O47j4yP3vQALxt63vb8cjhJ51dKJ/G/9V/g/8bIyreb4P/cyNgXHuCvRr6+1HxeYx9r+qI3SsK+0vr7uqQOfykahoWAfxpZ/Ze6eVmjlxco8wLlXsDlBdzcn/ACXi/g8wJ+LxDwAkEvEPICYS/Q2wv8w8jwDyp/vwQ+lo9r7s68zwts4QW29AJbeYGtvcA2XmBbL7CdF9jeC/zaC+zgBXb0AjtxDdYL7OIFdvUCu3mB3b1AHy/Q1wvs4QX29AJ7eYG9vUA/r+y39vcCFV5ggBeo9AKDvMBgL7CvFzjACwz0Avt4gf14t8ILHOgFfuMFDvICB3uBQ7zAoV5giBf4rRcY6gWGeeX81XAvUOWV8hzm7VkrrvYCUS9Q6wVqvNIfWF6gztRBvReIeYERXmCkF4h7pf2TXuAv1NleIOEFUl5glBdIe4GMF8gq/pxX9o7HeGWfqdELHO4FmrxyhyHvBZq9wDgvMN4LTPACLV5gIs/ReYFWpbfgBSZ7gSleYKoXaPMCR3iBaV45uzFDy9iue1lcx+7wAjO9wCwv0OkFurxAtxeY7QXmeqXP4fhmvhdY4AUWeoE5XmCeKaNt8C3yAou9wBIvcKTho6WGj5Z5ZT14OctneGmlyW+V4aXVhpfWGF5aa3hpneGl9Ur3UYafjjb8dIwXONbw0HGGh443PHSC4aETDQ+dZHjoZMNDpxgeOtXw0GmGh043PHSG4aEzDQ+dZXjobMND5xgeOtfw0HmGh87nXpnhoQu9cvbsd4aHfu+VscrFXhmrXGp46DLDM9d5pZ8mLZsb/9xp5uN3cT3SK2ObS7wytrnc8N+V3p6xzR+8Mr65yvvzxhbXeGVsca3SUDq++DIMfBUGrifNPFtHmr3A383Y47swcLNXxhq3kBbTBv8KAz/wolZvoFfvjdcVXVy76d0zFvH1Bvw6JglyT6Y3EO4N9C4ZJ13tFR3xv70stykv3uGV+eOdRr7v8gJ3e4F7jFzf6wUeMHL9R8PrD3plv/x+6jUj0w97ZW77iJHDR9m2hl8fU5593As8YWT6SSPTTxmZftrU0zNGpp/1As+pXHO/9gUj0y8amX7JK3e9XtH0r3pl3+c1I2ff+IA3jFy/aeT5HSPPfzZ67l0jy+8ZWX7fK/vwHxuZ/oBtYuT4E6+sk37klfBPjW543eiEt4xOeNvI/YfUT2wDr5y1/auR6y+NXH9l5PprI79/Y55Ghr9lG3hln+c7tgH1FnUE28DI9A9eeRSjlw8o9wE7+OSMt9cHeHyAzweEuGbmA8L6jXGoM8p8gMsHuLle6AMCPiDoA3pr/C18wJY+YCsfsLUP2MYHbOsDtvMB2/uAX/uAHX3ATj5gZx+wK9fufMBuPmB3H9CHa3xc29PwXXzAXj5gbx9Q4QMG+qRc/XxAf97T8wH7+IBKHzDIBwz2AfuSZh+wnw84wAccyPU5H3CQT9rmYB9wiE/a61ATNsQH/NYn6wBDfcAw7rdxn80nZ44jun5Y7ft5a5RRX88aZY0PsEyaWt+P9+nqFG+9D4j5gBE+YKQPiJM2H5AwNCV9QIrjPJbbB2SU7qwPyPmA0T6gyQeM8QFjfUCjDzjcJ+dw8j6g2QeMYzuFgPE+YIIPaPHJ2HGSD2j1AQUfMNkHTPmZ5ZtZUr5ZGr/TJ+uw3ZuUc65v4/XX+Tzz2BtYwHtwPsD2AYt8wGLeSePdLcOXS1nvflmTXk48ht9WGt5c5QNW8yy24b21pkzrDO+tN7x6lE/uqxxj8jnW8OBxhgePNzx4guHBE30/Xh891fDjKT6BJxveO9fw3nmG987Xuj3N8OAFRi5ON3x4oeHRczaJw29n+DZ/3r54pv5M34/XX0/ybXy/9yxfT9qzfyIf5n8R74sZGfg91/MMr19pePzqTcIvNrguMTJyqZGJy4ycXF4S9yojF3/QNNcaObjR8P/Nhudv8wG3a9g1pM3IyvVGVm7QODdpPO7r30LZKUlzh8rhnUZO7jLtdbeRk3t8wL2G/+8zfH+/4fsHyBtGbzzoAx4yPP6wT9bAHzX1/Jjh78cNzz9i+P1PlD3D408ZnE8bHn+G9cD+R91P+mS++pzh9+cNr79geP1F1Ucv+eS+Ls9Ov2r4/TXD769T7xpef9MnewucH73Fs9mG59/xyXn+dw3Pv2d4/n2euTa8/KHh6Y94pprnqHl+2vD7p4bfPzP8/rnh8y98wF8Nj39pePwrw+Nfkyaf6PhvfcDffT3jBa8f+Kfh6X/5gO8Mn39v+PwfvE/lkzE1L2L3Mvxd5gfK/YDLD7j9gMcvaX1+IOwH/P7N3+vdwt9zr3drP7CNX+72zvMD2/mB7f3Ar/3ADn5gR56P8wM7+4Fd/MCufmA3P7C7H+jjB/r6gT38wJ5+YC8/sLcf6OcH+vv1/IMfGOAHBvqBffxApR8Y5Af28wO/8QMH+YHBfmBfP7C/HzjADxxY8u1gP3CIHzjUDwzxA7/1//jcx1DNi3w2zA8M98s+U5Vf9AZ1QYRn9vxA1A/U+AHLD9T6gXq/8MoI3nfmPWc/kPADKf2r8wMx4vcDST8wyg+k/aKbMrwP7QdyfmC0HxjjB8b6gUY/0OwHxm9C6+F+oMkP5P09501I5ziNO8EPtPh77uJ3+GWf+5yw0DjJL3vmbX5gLsfefmCOHzjCD0zzA9P9wAw/0O6XffIOzWem4pnlByb+AjhWhv97HIVfgI5p/wbHz0nP+FN/ATrmKw7e7W3lHSXeZ/IDnX5gtuKbq/LFuAv8cu70GN475t1uI++L/LJOdWIIOInnRULAKSHgBD9wpF/gMoUrFK5SuEbhOoVHKTxG4XEKTzRyfZquS59h5PpMU5bHwj9vHP9JePPrncUx/Nfciw4D34SBb8M9Y3iO3/8RBv4Z/mXH7+dQbo0eOs/ooAv+F5fjYqMrL/EDlxrd+XujKy/zS790udGXV/D+mR9Ywn1Ho+uXU/aMjl9tdPtao9fXGz1/tNFxxxp9frzR4ycZPX6y0eGn8I650dlnGZ19ttHT5xsdfSH3IoyO/h351ujgq4ze/YPRudcanXudX/YWrjc690ajc28y+vcGo5OvNnr6GqN/bzb69xajf2818W7zA7cbPfaKH7jD6No7/cBdfuBuo2Pv4Zl6lY/7jJ693+jZB4ye/aPmU8T9S+Dj+hLvAz5i9PajRm//iTzAM/lGTz9hdPeTRlc/ZXT100YHP6Px2eYPGp39rNHZzxmd/bzR2S8Ynf2i9hMv+YGXlZbX/MDrRi+/YfTym0Yvv2V059t+4B2u2xn99a6R8/eMnL+vaV/1y7z4/yQt785+aHTOR4rjM/aTATl7+jHDjA76xOigT/3yrfQe5+d+4Auja/7ql7cxvjI652ujc/5mdM43Rud8a3TO343O+c7onO/9wD84tuDaHMcPAaA8IGs/P+jjLr0CgCsAuAOyFuQNAL4A4A8AgYDITDAg46JQAAgHgN4BKcevAsJHWwSALQPypsFWAWDrALBNANg2AGwXALYPyNr3Dpusf+8S+M9r3zxbULxvfEgA2EfPwfB+K+tsUAAYHAD2DWx8//gAvYP8m0DPHeSivhhCugP/+b6tFZD7tnWB//6+bf+SMhwa2Hjfo5SeYf8v0tSP5/oDer4/ADQqzAd+PAcaF/j385fxgY3nL3sHgNEBYGxA0jYFZE7THNh4TjMhUHI/eDP5tpW0G9NP3CR9oSQ9+4T/TX3B1AAwKdBTh91ah60BqccN52X/f1r+yZtpb75ptBfP3wZk3790v/jn7mvPKNnX/jl72pvby+ba53SV0/83820PyHmvmQFgVuB/Vu5fej+fddCpdbCpHB6xCR/OKeFD0vs/pfNLpXVzPPdTtLtK6vA/8VqxnCwX5a5rM3I3+9/I3f/m8hbLwTfMllDmTL+/NCBr2su1j+C8dIX262sCcoaGfftK3nUy44LVGm9tQM4irA8AR5nxwNFmPHBMAHgzCBwbAI4zY4HjA8AJZhxwohkHnKQ4TzXjgZMDcpbhFDMWOD0g9JzJ89ABWd909vrNeOBcMx44z4wHzjfjgQvMeOBC5cXTlBf/T3FcZNr396bdLjHjikvNuOKygKwvXWnGEH8w44ZrOZbg/oTCW0y/fBv38KmHTH98N/fsTX98r+mL7zd98QPcgzd98YOmH36YNPK8nelXLzZ9/eXcZzfjk6vM2ORqMy65hvzDMzJmPHKjGY/cZMYCNweAW02/f7vp9+8wff5dpk9/iPsMlHueMQvImtnjAVlrfjIAPGXCntZyPsNxmenLnzN97fOmH3/B9Lcvmn78JR2XvWz63VdMf/5qAHjN9MOvB4A32Fam33mH480A8FYAeDsAfEIe5XhPw0v9n2rYhwHgI+5BbCb+T337y3/4/ucA8G4AeI93s4zu+0zDvwwAfzM68AvKS0D4l2FfBYCvA8A3AeBbyo/uX35HPRcA/sHxreH7fxle/0EfL+zFfYig3CEtDwIuPT/jDgKe4P99/N6gnA0OBIFdg0AwCBwaBA4IAr8NAr8Jyv2OwbwLFQQO5t0njftT8X71H+JtFQS2DgL7BoHtg7Ieugfv0G4m7rZBYLsS3KVpNhf/5+DcUb/vFAR2DgK7lODfJggMCgI7BIGDtBzEuV8Q2P8nytOHd3KDkt+eGr53EOjP83wluIvp/EEgFAR6B4Etg8BuQWD3Ehx78e5WEKjguUC+DRUEKpWu0noo0kScByotRZoP0fyGKD3DgjKX5z2WKONwLTIIRDYTznsuQ4PA8KDc5+EdmIt43jsI1BjaLv4392B438UKyp2XWsVNvVgfBGJBYEQQGBkE4kE5c5wIAqkgMCooeqEhCKSDQCYIZINALgiMDgJjgsDYINAYBA4PAk1BIB8EmoPAuCAwPghMCsqZ64JC3pWbEARagsDEINAaBKYEgakqA208Ex8EphkapweBdp41CAKzjNx1GpnpCop8zeA57iAwmziDwNwgMC8o62PzjfwtCAILg4AdBBYFgcVBOYN2pJG/pUb+lhnZW25kb0UQWGnkbpWRu9VG7tbwnJqRvXW842R44qigzGWPNrxxTHDj9dpjeT7b8MvxwZ550wlB6RtPDGo/FhSdfBLvoBm5OSUoYXxX4zTl+XO1r7/Q8Nx5yk+nE/LNP97z5Xt/hs/PCcq7ZOcHJT7vQ1ygeTPtRYZPf8c7UeQHw+uXGH69NCjr3pdxzSgoexVXGr69Kij34q4O/nj8co3h4WuZTst+veHjGwwf36hlusnw8s2a7hbDz7caPrktCNxuePqOkrq4MwjcFQTuNjx9j+Hnew3vPRgEHtJyP2z4+z7Dv/cHgQeCwB8NLz5iePFRw4t/MngeM7z4uOHJJxTnk4YnnwrKXc/n+F6f8vHThpZnDD++YPjxRe7ZGH582fDjK4YfXzX8+Jrhx9cNP74RlHHHW4b33ja8+U6wpy3/bHj0XcOj7xl+fN/w4wdB4EPDix8FZR3+46CcyfnE8OSnrH/Df58rXV+wT1B9/pXhya8NP35j+PHbIPB3pfF7w4v/UPe/NN0P+lAu2/9v7DMMr/6T/UMIKOM7B2aM5TJjKncI8IQAr56X8oUAf0j2XINcZwkJjeEQ0Jt7AyEZp2zBe66G97YJyfsB26l/S8OnW4WA7YtvD4TkbbZBCvdVOJD6PATsQL3MuzchOUe9S0jehtqNb9+G5M2jPqGe96H2DAF7cw+dZ65C8tbHXnz3QPPaT/PaT/PaT/OqDAGDQ8D+fOvA8N2BvOvKt2+5px4CDgkBh/K+a0jmeNRNQ0NyFm0493N4lprnrviWbQiImng1vIsaAmr5Hh3voIaAkYb3YiFgBM9Lh2Ru22DGTYlQD+8mQ0BK919GhUSGMyEgy3NXIWA076CGgLGapjEENHFPPAQ0h6Sdx4fk/ZIJIXlDd1wIaAnJ3vkk3iENybm0ySFgCt+l4b64aZM5IWAGz1sZ2mZy71vDukJAN+s7BBzBt2xNPtNDQEcImBUCZmu8edSBIWCBvtu8WNt5SUjewCW/LwoBR4aApXyXlW+WKQ8Vx/ar+D4q+SgErOG7ZXyj1fDaUdSFoZ69ieMMPx0f2vzexGkhmY+ebvjpjJDcdbtI6+Q8vbtcemfiVMNnZxo+O4vnF5SW80PSHhfwbTK+I8O7KLr/dQnftWJ/x7v57PtKcPHuxRVa1isNv13F+4GG367m+wWGx64N9ewJXm/47AbFeaPhxctDG6+3/Te4blJe5brFLSE5H8K4txt+vtnw6b0h+VYMvy0k3+4I/XitY9P1tDsNz99leP5uw/P3KK7iWYD7QhvPPx8Ibbz+dn+oZ/3tf4qnmD/XhXk240EjVw9pOz1s5OoRvqnGtjdleiwkbzM/YeTpSSNLT4Xk7exn9N1n9mHPG1l6QevsxRDwkuJ6hW+j8awT37wxuucNntU1MvSWkaG3eU6WbzYYGXrXyNB75AUjQx+QF3jGiTqb7Whk6RMjS5+y/SjrRla+4J1LlYkveQbXyM7XRq6+MbLzrZGdv/Nck5Gd7/X+KsvJffUfqHf5vhvXuHWOHQoD4bC8hVQaj4+f9+Lc3LRdOd9GDQNu3o/k/j3fRg3/e1xb6J7uljp/3SoMbM12CAPbct2L9/D4pjnfM+e75WFgpzCwM/kkDOzKNwnCwO7UzbzfYsYXe/DOC9+l4XprWN486s+3mMI/5rWBZtw4KCzz2v3CwP5h4AAz1z0wDAwP//T7jkW+GRDemG/2CW98B6eSdxv5JmwYOCgMHMy3zY2MHGpkYQh1O8e7YWAYx7hh4LCwvPPNd3WiYaCGY1qOZ8Py9k893xQNCw/FWZ98qzMscjwi3CPHSe4F8N3NsLy/luG3sNyNGK3twHcbx/IuCvfkeQ9lM/Xz79a2S+tjAtdgw0CB9zsUTuV7ZArbuA7ItcMw0K7uDu4bcw+95O3+fPin3+5v4d5/GJjCdacwMC0MzORaXBjoDgOzwzLuZj89j2tKXEviWwJhefNwyWbKd1RYxhDrDU8ezfv/HO8avjzO8OTxvH/P80Z8T8Dw82rDz2sMP681fHqC4c+Tud7Cc1DKw2cavjzL1NnZJXOS4pkFnhU4Ldzzpup5YZnfXFAyxym+mfqf5jh/+IVwXB2Wu/PX8FxqWM7+3hiWs7+36Fj955z7vScs535vDvfcabo33LNGzTWqBxT+UeGDCh9S+LDCRzjeDwNvGd58kfcNw8ALhkdfMrzxquHTl/Xb29xj1LDXwsDrRu7eMHOuN/X7OxzrGj581/Dge2HpPz8IS//5ka6b/2/dK2c9fawy/7+1DFv0Ft7bqre8pVXc3/h1743fb9ihN7DzJmG7mfFSn949eqGvpi3VTXv0/rGuXrGJbulXgmMA95+pv6mzewODegODewP7GvnYrzewP9+g7A0c2Bv4jRnzHNRb1isO6S3nMIcY2fgt7zVqfQwz443hvYEqrnXwDRmee+0NRHm/0YwvrN5ALd+M4bnV3kCsNzCit9xniCuORG8gaeaDKd41573GkrlrrjcwmjqcbxNzXG7q8cSFXsdmyakK+UTRmeo+VyGvql640OvYLfmDQto0uW2h14l/p0Jug9+jaR5Y6HXi0C7FYxr2lEIu9T230Cv23hVyuvfSQq9jN+UNhbSL8u5CrxP/s4VexyYK/8ptweNVSHsmQVto6K2Q9ky2tL0O3p0V0rZJP/0+QCFtmlTaXsdWy4EKaZPkt4q7SiFtlET1+whb6oB2SkbbQmtpWF5xj9dvtPlRUHdp2DRb6qi0rro0jwW217ERQ7sbqzXesbbXsQ9DOxznK56LNV/a6Dhn7zKH1uuUZj4Te5Mt9XePQtrseFTTPqWQ9jte0DSvaF60k/GOuj9WSHsaX6q7NN73Wt7SeP/SsF6LBNIGx5RxkodrkUDacPEt8jr8FVZI2xtbqXt7hbRTsfMiobWvQtqn6K+4ByqkvYpBmuYAhbQ9cYjmN1QhbVG0T5Tvh2k82qOwFE+9QtqjGKnuhELapRi1yOvw+uEKaaNi0iJphw6FtFOxUNMsVkh7FTMmep12WbpIIO3mLNPvKxdJ/dGWxdHqLg07eZG04bkKaePiUk17hULH5oWW8zpNS1s8t2m93aOQ+T6o30vjPaH1URrv2UXCk6XxXtF4b2o8yvB7Gu8ThbRr8ZXG+7tC2uH4l7rLFwukPQ7fYsHTe7HUH21htJ5W5rhLw3ZcLGXbdbHUPW1k9FN3adgeC4SGfRcL5DvUBy8W+qsU0pZG3WKptxEKWbYGTZNVSDsZTYtFTzUrpB2dG7qF5tKw8VqOgubBd18X3Vzm4J6x2OvoKtobmfKB6NoVmi/fU1yt7nUKaZvjaHUfp5A2Ok7UPE5XSJsd5y4WfjpPIW14nK919TuFtOVxqdbRtQppy+M2xX2nQtr6uEfb5o8KaR/jFb/ol0cVH+19PKE0PLdY9BXtZ7ytZf9Iw2gT5Bt1l4a5lkjagELa29hiifB2adjvZ6iuXuJ17GXRtkj/JT+u+0FLhK79FdL+yEFLhHeqFdL+SELTZhXSHsn3W7mcPA5fInnRHknzEin7RMXHt8Ena5rpCmmTpFPTzFZIeyTzNpN2kZatNOzO04Q3Vmta2hlZp7iPU0i7I6fo99NL6DtL8zh/ifAV7ZTcvETq9wGFtFHytOJ5USFtkLyuad9RSPsiHyzxOv0mLx0S0tbIr48UWndWSJsjux+p/aRC2h8ZdKTgPvBIaQ/aLxmRlbIddKTX0SO02ZHW76V9fPZIr2P7rHCk9G+069F7qpRz7pHCp7QxcqTSsEIh+5Q1Rwr9R2v+tENy4pGqMxXSBsqF+v1ShbRx8gelvwhpJ+XGIyXfWxTSbsrtSsMDR0r70ebAE0rDMwppV+UFTVNajpe1vK8qpJ2V1zVeadhb6n5HIW2xvKu0fqz50zbLV+ouDfunxitfKpC2We4ZLGXyLxVI2yxnz5HvW2g82lXZbqnkVypbv16qba6QtjIO29rllH33pVIHtGkxQHHvp5C2LQ7RNEMV0h7FYUulvMV/TBvVsFqFtEcRWyrtNWqplI31fLjiGaeQ9iomqnuyQtqvuP1m0U1HLJVxIu1ZLNayldL3tcY7cqnXsVVHmxe3DhY85yztGTddoO7fK6QNi8uUrusU0qbF7fr9boW0b3H/Umn/5xXSXsUHWs6Plwq/0n7F5+ouDfta3d8t9Tr29PiG8/bLpL12WSblYL3sqe6By6TOaPvigGWSx0EKaQPjUHWXjm2HLpN6Ga6QdjIOWyb9RkQhbWaMmCdlql6m8wHaTNF8GxTSdkV2mYyvxy8THcv3zO8/uszhk2nLhF/4ju+saLnDY7OXeR17h7RnsXLZj/uP9cukDo5TSFsXJyutpyqkTYvT1V2ax5ma5jyFfIv4d0r/pQpp4+RK/X6tQtq+uEndtyukLYx7tEyPLRP5oD2MV7ROX18mfMA33d/XNH9RSJsZXyhd3y8TnqSdjF8tl/Juq5B2M3ZSdx+FtK/Rb7mUrfiPYRXLJd99lktdMezQ5ZLfcIW0vRFVd71Cjn0a1J1WSJscYzSPxuWif2kTatzpKkfLpa5o/2h9u/BY+3KBtMkxR2koTbtc6V+rkDY7jlU8pX3e86pLTlwu9UN7GWdrvPOXC1/RTsYlWt7LNV/azbhOv9+qkDY0rpsj8e7R+LQFdr+WrZTmP2rZH10u/ErbG8/r99cV0gbHVaeXOe73NIz2Hv9SkDJ9qmWjjHylZXevEMg30mtVZrZbIZC2PHZcIfntpZBvge+7QvActKIH31B1VyukDZD6FcJjoxTSJsjhK6RspfTlV+icUyFthkxcIXXUppC2Q2aukDTzFNKWyJErpF5WKiTydZrmeIW0JXKa0nWOQtoWuUjLeckKaUvaFxk1U9ylYdcqnls0jLYx7lMaHlXIfuEZxfeCQtoqeUXdbyikrZp3lNbSsA9WeJ3xxDcrRO/Sxol/pXwPrxSdQ9smu6xUukrC+mm8gQpp/2TwSu0/Vor8st0s/R5TSPsoDStVthTSJsoYdRchbaLkV2obKaQtlInqLiikXZSpK6WtZ63sGW8s1PyWKKTdlOXqXr1S+Ip2U07QNKVhZ60UHXbJSpFZ2j25Qem6VSFtrdyl+O4r1gXtOKyUtn5MIW2vPLNS1wAU0hbLO1pX7yqkPZb3Nc0nK3UuRvsHGvadQtpj4UMWzrhUIekLrZI62FYhbbTsqt/31DDa+6jUsANWSR600TJklZSpapXUBe21xNRdGpZZJeUco5A2Xea1Szs0rRJIW0rjNI9WhbT5coTS0LVK6oA2XxaquzRsudKyRtPSTswxq6SOSsedxyldpfJxhoZdpJB2ZK7StKXxrtbvtyqkrZm7myS/+zVf2p55RN1PKqSdmec1zZurhF9oi+Zjpf/LVSIftD9Tvlrqw7Pa66yj0UbObhrWVyFtvuy1WnAPVEh7L/utlroqbbchq6Ucpe02VMOGa1rahUnME3dpWM1qGaNYq0Xv0j7M6NW6flXCk4crXc0KaTNmgsZrVUibMlM13yMU0v7MdM2vNKxT8+1SSFs03RpvgULapjlytbR56RrASsWzWvOlvc716j5WIdebTlQ8pyukzZeb9pU12HMVL20lXKRpLlFIey5X6PdrNC3tu9ykZb91tdBCOy/3qrs07BHF8/hqmUvSbsu7mvYDhbTj8rG6S8v7qeL5m0LaevmX0lK+RnQy7blstUbGUKVhu69ROSuheQ8N21uhYz/8DBmXlNZfxRpxVyqkfZj9NM2BCmm75WD9/ts1wuO011K7RugbqZB23fZtVVlZI5C2yUarO79GdCftqYxWWtoUH21Cdq+R9p2j+Li2uXCNyNZKTUvbMLtMle+l8U7Q76Xxzl0jOrs07PI1Ij/XK+Qa6B1azrs1Hm3GPKa4n1ZI+zMvaJo3FdL+zCtzpWwfahlpf+YzxfdXhbRH87Xi+U7jMYwPDjm22dd6HXvltFmz3Vpp/9KwXdcKXaX0DdS0g9Z6HfvmtHFTs1Z1nEJGGKvxmtZ6HRvitHHz0GBdT9ZvtJG+RPNdXcyftkLWqkyt7ZnTnaruMxXSTs65a6VsF62VeqHdnOu2cTnlvHKtlJd2tK7TcpTywZ1Ky91re/j0PsX3kELa0Xlsrei4Z9d6nf0G2t35dK3wy+daB7Sp41knaUrDguskv18r5BhzL403YJ3Eo52dw9YJDVGFtLlTq+6YQtrgias7qZBzg9+fUebQl14ndNKOZ+M6oa9pnfAhbadMWadzcIW039OxTupotkLa71moeIqQYcs0TREybJXmsWad7lHQluM6acMzFNLWzwVK6+/WSRvRhtVVGnbNOhnr0Z5Qx1YuGb9oHrRx9qDSX1qOZzS/0nxfU/f7CpnvF0rfl5qWtoZ+UHdpWHC9lHOr9aLXaIeoz3qhb0+FtJF53EOy5tuvJGyApi3Ft9966V/2V0j7RQeslzIdrJA2jH67fuM5Im0VDVPchylkWHS9zgfXSxvRvlNivdTvaIW0eTROaSkopA2k6ZrfTIW0idStuIuQtpHmrhf6lytkvseul7o8XSFtJ12oeC5eL7qTNpSu1fxuUUh7SncrraVhf9Q0T62XcQnn8W8pvncV0gbTh+r+ROPT/tK3m9QVx/LfKe5eRwk+hm15lKTdViFtKe1wlNTfrgppI2mPo4QX91HIsN8cJfVRuvZ6iOIpDevKS7yhR/XojSqNF1VaaIMpc5TUQaNC2ji6+h7HhAzGa/wDyefqnqKQdpGmKe7SeO0aNkvh6aWLcmKaxrFd7PSBvSDrRbsKjO0qe7SX7CrfvbvJHvD3u0m64hjFv7/AvyTk+z8SwvPupOz7nnq4c6wXb08W/6hpEu/xaZLPsacJ/idOk/3kjrPl+8cXCJx6q3wv1kNRph54VPzf/0ngyMecY2aY8Zjkd/RjQv/lCl97zDmSAP97kr7wnuAv7ss0pns5+W/X1Muha8d54m+e38uJN3m+hL95ZC8Z5z7Ry+nz6l4R/7RXeomufL2Xk8++n/dy6LjDU+b4T/KXOfiKeyq9AgK925U5OqRl7zKH/uKebnEtve/8MkffHTq/zBn7JhROmi97Zd3zy5w9rOL6W3EPrbjPUFzfKa5xFMdVxTFNsS944ndCZ3Hvqri+Wlw/nfyy0Hfqm2VOeR95T/x93i9z+qSD3y9z5swjFf75Q6Gj8yMpd+DjMqcd8h+XOfx+58eS358/LXP6yKO+l3xe/5fQ+clO5U663M7lTrkW7F3u4Lts73Kn/NF+5U693XlwuUNPca3x4Wi5w4/vRcudcm1dUy5jxhoJzyu8+3BJd1pe/NcfI/GePlHwrz+53KH3FIXnnyz0XKH+m04Wuh7Q8KdPLnfofutkwXPcKYJ/qwcE//IXykWHaZ9V3H8qrrMX18iKY5FddhH/A3sKPL6/yylv/dkCF93gdsp3x51ux9/nLrdTP/5n3E67HDjb48A95wlcMs/jxKta45G15xM8Tn0ddKJ8f/Yqj0PX1D+If24/XS/QtfLi2Ke4z1Aclz14gOiq0CEyNxt9qOrxQ6VfeOBQSf/8oaqDhouOfmW49J2uwyRerlbCf98k4Tc0ib84r/1jk+T7WJOOdTX8RfW/pun+oum+Ub8nL3OQbfISb4e89H998tJHDcyLPj8wL/PcBv2ey0v6VoVFHT4nL2tD6/Ki30/V9Oflhb6LNf6NeaHvdg2/T/N/SL+/oPl9nhf9z8dJGf6rZqFrh2ZJt3uz7vvo90OaJX69+sdo/JZmoa9V/e2abm6zlH+lhh/bLHScpHguapax+03NUq5HFb6h3z9TOv6m6fmAKus3OE6+7zRO4g8eJ+3423GSX0zjZcdJfebVXzwTMm2c0L9gnNTjaoUnabxzxwn9l4zTPbtxUp83jJNy3qx479Z8/zRO6Hte/W8r/i80/HulNzhe/NuOl/z6jpf4g8brfqb6Dxsv48y0xs+Pl3prUTh5vIwvpo7XPSnFN3+80LV0vNC/bryU52TFc66GX6LwGg2/Tf33a/wnxku5n1f8L+v3dzT/DzTdXzXfH5R+9wRJv8UE8W+n/j4TBF//CVIPh0yQdqqdIPWUmyD4xitsU9g1QeR6hfqPmSD5nanhV6j/Fs3nfvU/pfm8pXS8P0H47LsJwi+9WyTfXVpkTnNAi9ATaZFyjmiRdhit8QotMpdaovGObpF6OEH957VI/pe3CJ03tEh5b1f/H1uErmc0/lsa/rGGf9si7cYHgfm990ShY/uJQvcAhcMmSjxLvyfUP1r94zV98dxP8dxRl4YvnSj1dsJE2XO/bKKU88aJUi+PTJT6eFPxfThRyvWVxuNjxaRj60leZy7cX+GwSVLemkmSrkHhaIXjJ0k5p2v6JZOErhWThI6zJkn+V08SOu/U7/dNEnqfnSR0vKH+zyep3moVuEWr0Ldzq+RT0aprwLrGclCr8PGQVl2rVX9UYV2r1GNS4RjFO6VV6JmteBZq/CWtwhfHtMq+7hUa79ZWadf7W3VPVul6W/F+pPl/pvH/qfQGCrr/UJDwnQuS/z4FKffBBcmvtiDlH6PxmwpSv60FyWdmQfdbNHypxltZUP1bkHo5paD9oX4/W/ebLiwIfZcovusLQt89Ch9X+l7VdG9q/HcVb3Hf6q+a3z80nX+y7otMlnjbTJb8t58s5ew3Wejdd7KUs2qylHvEZMGf1PQZhWMUNk2W/FoUX6vimTFZ6n/JZOHnkycLn16m8a+eLHTdofARjfem5vvxZCnn3ydLfQemSH1sN0Xo3XuK8OuQKdKPZvT7+Cmyj25PET4/dorgO2OK4LtE4Y0a/94pQs9DivfFKULPu5ruc/X/c4rQUTynsuVUSV9c3+s7Vdp9wFSp9wOnCt4hUwWPNVXw56ZK/ec13mT9Pmuq4F+m/qP1+6mK99ypUp5rFc+9U6UcT2o+z2u6txT/Bxr+qYb/faq0q69N8G3RJu23jfp3btPzlhq+d5uUa6B+P6BN8A7R78MVVrdJe4/UeBnF09gm+ba2CZ2dbVIeu03qc636T2yTcl+k8f/QJnTeqf6HFT6reN7WfD7S8K/bpB16HSHptjhCwnc6Qujte4TU1/5HCD/WaLzMEYKv5QgpR+EIqd95R6jc6vdj9fuJRwi/XXyE0H3NEZLvHep/UP3PKJ73jpByfaPh5dME35bTpF63myb57KbhldMk3qHThP6aaVJPozS8WcOnqr97mpRj+TSRm9OnSTkv1fCbp+n4SPN5WP1PTRN6X5km7fSWxv98mtTXN9OEbt90PZ85XfXhdMm3v8IDFR42Xfek1Z+dLvk1a7pp06XeF02Xci+bLvW5StMdo+nOUPj76VLOa6ZLfT+gdDyq6Z9U//PTZfz1osb7y3Sh+5+Kv9cMKY9vhuidXWZIu+w7Q/IZOkPqoXaG5DdKw5s1XauGd8wQfF0af9EMKd+qGVLfpygsnlm8dIaU9zbFc6/ieWyGlPe5GVKOl2foOTH1vzVD9Nh3Gt/dLvW3dbvg36Nd6BvcLvgj+j2p38frmY0pCjvahc7i/uZCjVc823Fiu8pdu7T/de1Cx82a7p52nee1Cx8+p/Dtdqn/D/T7Z+1C73caTmMIxOPuEH+wQ8/pd+iZ/A6d13TovKZD6BjSoXpFv1sdqi813rgOqf+piqdL8c/XdIs03ir1r9Pvx2n46R1SXxcr/qs6pDy3afy7OqRen9J8XlG6/tIh9fO90hOcqWu/CneYKfnsNlPiDZop8YbPlHJHNF79TD3XoWclmjTetJnCl4tnSvuumyl0njZT6LlM8d6i3x/Q789ovi9p+LsKv1D836vfO0vihWeJHPSdJd/3UX9klrRX7Sw956XxM7OEvkmzpJ5mKlykcJ3GP36W8O1l6r9mlsrtLKVzluwvfjRLyv/lLKHrh1mit7btlHL265T4v+mUejukU+e5ncKvqU7BP6ZT6M3r9+mdUp45Gm+xxlvZKe13Sqfke67CSzqFf67T/O7p1PNe6n+lU8r3gdLxcafUE416kE9cXULvdl1SzgEKh3fpurrGG9Gle4tdSneXztO7hO5ZXUKHreGruoTeUxVeot+v69L9NM3n2S6h980uHfdp+s+6dDyr8QPd4v91t7TPfgpHdAs/NXZr/9wt+c3uFj5c0y3lPbtb6LyyW8pVPPt+W7fgf0jTvdQt9fFxt+izTxTvt5rflrOFjt1m67nZ2YL3AIXR2bovMFvyb5kt5Zyt4UfOlvyOni3td8psoecchb9X/NdrvHs03iOzpZ6eV/8bGv999X8+W+rtOw0vm6PnoucIHTvOEbz91f/bOVLOhjlSf3n1t8+Relii8Y+eI+Uqnr29UP3FM2s3zpH879L4j2n4kxr/eYWvzpHyfDhH539zpP6+1fS95sr33nOF7q3nSvjOc6U8e86VdIPVf7DCKo1XP1fkb9xcob9Dw+fNlXpboemP1XzOUnjpXKHjSo13y1ypj4fmSj0V95jf0u+faPwvFH6teGn8hvjC86QedponfLfvPO2f52n/rOfrimdTi+dDsvNErpo0fds8oWOe+ldp/HWaz6nzdByt4RcqvFjxXan4rtfwm9V/l8I/zpP6eWKelPNtxfeR0vs3zad8vsAt5gs9u82Xev7NfIk/bL7wQ4N+z8+X9FPVP3e+tMea+Xomer6U51yNd7nGu1XjPTpf6u3N+TpvUvg3Tf/DfF0XWqD7yQuEjh0XyPfivZkBC4SPBi8Q/MMXSL7xBSKPExaIPM9fIPkds0DKcY7Gu2KB0HfzAqm/2xfouovm+8wCoffPC6T+vlkg9RJeqO2vd+L20Pt/lQoPXijpa/T+wIiFOh9dKOU8XNNPXahn6PTO4WwNX75Q6OwuzOvuP65pXL6peUC+qaIp35XPNA/sXzUs3zx8z4qhfWqS0WxjyupfNaRp3PC+/Zryzc1236ZxfZsH9LX7NY3r1zygX8XA/lVD8k1OlKF9+20mhj20f1WfPpWVFfbQPpWVTsTKZruyf1WfyuEVFQMqK4dXDMg357sGVFQNz0/sXzVkYmehZZo9qaV70lR7Ukd7d1v77ILd2mEXpncV7Mlt7S3Tp8+3J3d02pNnt0/qbutot9sm223tdlt7V3dL+6RCx2S7vTDXbp89fbrdWeie3dlud0/t7Jhrd3fOt+dObZteqMhPHJcfMGhA/wl2vwrSnx9k96/qk9+vomlcPp/vzLc3VwzI79e/yV7UXPzOL/ZC/da/aliTvbC5oqu7s619Sv9xdr6rou+gAZM6ZswotHf3z3fZ+UH2OCfpgMpYIpXL2vmqbNKOVEdSlZlkLh217Eh1ddoaHYtkrRo7Up3hXzYdiWbtSDRqpYoglqhzXJlMKhmPRRvpSaZrJDiZsSPRbGx0JBtLJujMReJ2pKaGf5XRZDptZVLJhESuGRGJWomsHanNWmk7Eo9FMvJrObAuYUficf4lo5GsZUfiqfqIHUlE4o2ZWEYchzNhosaOJBrtSCpl0emASJ2lLierVCoeiypN6Wh9bLRlR9JWxI6kY9n6Bisbi9rMPBMtJsjEEnYkk7JY+EzGSjvAIckBrCDHIZEzyWhMsWcaE9H6dDKRzGXsSNaOZCMJO5LNpmPVuSzLlcvWJ9OxbGOPqzJab0VH2pHRdXZ1JDrS+alLJ3OJGseZSzlgTCRNf03Mro5kLLvaqk2mCepiCbvayo6xrIRdHauzq2OJSLqRwClIdSzLv0pWEmEiKf5k2gFjCeNOrvFIQn8zdnU8Wc0fJzwZdUJyll0tRPE3ko5ZGXESjLVq7Oq0FRlZmUrGElm7OmtX52prrbRd3WhXN6ZYWaSmMWs5P5XRiMKEwqTCjMCEfk+oP5musdJ21I5G7Ci5gj/EGGVlRCOZrPMjIdlovR21YnGb3MVUDrBq7Gh9JJaQXxUBcaetUTkr4/gSdZYAB1V9JJGw4hk60pXZZGW9NdZxR6IO3vpIOm4RIdvP+a1OjrWjsXQ0F4+k7WhsvB2NRzIZ+a2MJp0mEU9NJBtRpzXaSmSLkRqsbH2ypuhLJZNxOxq3IolcyoFpOxqPUWiibKKo00TReJKVkLCjDE/a0WQkbmWilh1N1jg/Tq7JeJzcHE3Gk2n+5hoSCjKE40vYjl46U46r3ooUMYwfaTU6MGHVRbKUIseTTDdE4o4zlczENoRnk1knuKHBIVhgxnHExJ9MOCCXKApnNNmQiqQlt4ZUMqEJxeUkTaWtTKYYNZdlToloJKvASkQkqMb5sRIZ8cUUeyIhdeBADcpkI4I7kbXGZotQAmKJnIMgm2Y7CHS+jHZ+rLSSQieTpigV0WSKtVSq66gXo8lMvR1N5pwi5RLZNCONJh+l7GgqZkfTlkM8gZMmHcvGoqzBjB3NpdNWItq4wTG+NHsnLEuYYds6oDJjxYtlzGWyyQZmpI7K2lxCPtWQ4dPUVQ4/8sdRL3TEErVJx5GxsoQMbYzH6uqzdk11Q2QsWb+mJj+4oSE/uLGxxOl4GhoIrA3au8aKxhoi8UzRMT5TH6vN0hePpJ3G5ycrZddYtZFcnF9qrTSltsaqjSUsAawXcQj5VtxycMetrHxqoKKrsVKRdNbhuhprg06nMx2rZnRqiohiyEZicbsmFokn6+yaWNqKZpPpRrsmlilyS00sk4pHGouwsoFSVRMj20TFEUs40UbzL+Z8JNiku2Og01w1Sbsm19DQaNfkpFeyelwZuyaXVspyjhzUNCYiDbEoYSqdtC3bikTrbasmlnV+kulKRx9a8Yzl/MRqbashlW20rUSkOm7VCCQmK6GqgL2klaiptBL1LALrqTKjvMLweCxhZRxXsraypLY1pDYWt4ruFPtZdfcwHPvfLH8d7exA6mQ6HA1Mh6MXrURNTZK/JaQ43rFWlLA2mVbQ4MAi27JFIwJqbW1eB2StdG0k6uQZTyZThKJQHVeyJiekC4pUOuk0l5WoEdrpolhaiZox9VLKuljCstKCv5TEnpqTDm/zdbkhjEXNOl2mlZAcRsfSyYQgG2VbozhMskblYqNtK51OphusTMapWnoytpWJRlKWAIeW0U5C6TessRyiWWOdIZoAJ/eiqzJLRujxM0U0nquxFDoInQofa0WpUa2xsYyDlzw2NpatpI6mXFljU/xTZ0TrfWwqpixrjSUbO6lUd9ORLgKJnXXYzwGWOjKSWMaatZTHWosMUxuz4jXyW+n0Rxn1ZBobqpPxjTz6iSBu8Yc9tACtAPEwQiLCtAmiTmey8utwvV0bG2vVaJPWjrRG2bUj6yy7Np5Mpu3aeC5Tb9cm+YleMiV/Io7fGZ/VOt1nbToS5U+DJb8ZuzZt0R0jp9m16WSDvYGViw7p6ou+SJxDxNpcOltvpe26SCpj11l2nZWw0tQXdVbWrouNZoXWkco6UlkXT1ZH4nZdOpLI2nVOZ5ImtBK2dOZahXVZuz6SqIlbCtJ2fSTdELcyGbs+kqm3auz6iIO6vqbaZuevCoFORnaAeJ1YVjxVGasRWBxJ1VOu6mN19XY9q7I+Ga+x65PZTCqZtWN2LJpM2LEaO1ZjJbKx2mLnX/RaaTtWk7FjtXasLsFRrgOYV6yhwarh/CTeaMcaUnFHtjTxRt5Mj9+qcdwOX8YaHHYU4CBM2LGEM2Gx7FgiGnd+KBoKM+qQuNG0iH+MGkp+hW3YVXJayuj1FvttJz5zpO6MxIswdrhSm0iwlIlkjlFSzq8zy4glpF8hJkcyamMswAbFtsEl/LLBK/HTiYiGjWZXG0tkk3bMGSdYArNWTaXTlccydiyTtGNZMlQybceyiaQ9Illtj0jGEvZIdsT8YTlGWumEFbc59BtpNWb4MyaZrsnYIylC8UiiLkdVFecgPE7c8UgjyxW37LjySNyKjKavNuv8VI7IZbJSMnpT8VzGcWRSLGLcqotEG+24lajL1tsOX8YtJhxtxeU3Y8djIy3bqXr+VMqoynH29ELijR0ucWot5uYwcjxGSmOZbGUqneQ81iExlsly9B6PZbOknOWy48lIjfPj9HXpZF060mBz4M1BTVx+LQewDjmCiCfrVH3Ek3X77ctfRyHFk3UxSeKgTabseHIM/6y0HU8xl1TMjmftBruB+q+B3WRDZEQyTdFqiKSclmiIpOuc8PRIuyGS4Q/VpPPrjPUbImP5F2vINdiUFAc0VFNcG6wGjmsarEy9XexdFDpZiDOjDic36TiLE5IG5hxLCO5YQilryA/mwK+xscTpeGpqCJjeISzJntr5pXg7DuczO+SG5Gj52WTE1JCLZ2OpeOMGxybfExE7QSXLn2yk2k7IlCRRbScsO2FlKPoJS2aFCWsM/0Rc6XBGLnQUe+sEB/+JpJ1IVhZHfIlkZU//lEhW1kVSCjIOpD51kHNmKJyeSFZmoumkTE7p4ZpBIlmZjZGr6EimkrWSebLycCvNDGss54dIE5WcDEmI4x6VozNrJ1J2ImMncvG4ncixSQmStZyD2kk7WT2C4xcBGTtZHY/VRZyBbDKqUwarxJkRd8ZO1trJWuePg/xk3LKTCTuZiDfayZSVsJMylBAQiasjYyfTtkzIk07/5PxmbAp9MsdeJ5nLpsSTymUrVZI516kl19PB6k1x3YE/rA3KQCpS41RiSgLIjqkIe1Di3ODS7nyD34mUdX5ikXiceLNUhXbKSnPq7yCz0k5/rdDJxEpnkgk7VWunaisz2Ug2l7FTscRIOxV39KmjX2U+y2jJzHinP6ODhUilI3UNkYydSlucicY41E6li3MWzlKttNOLptKxBq7IpNLUCs5vZXFGmUrHZDEoleaSmWU7Cqkml1ZXhvhF66TSyZSVdqIms1Y062Qi49dUrjoei9qpXKa+OpfNktpc1h6Vs3JWpdOWo3Kx6EhnOpeO1MSSGikdiWUs55dkpp2lD+c3Y6cjY+y0FalxfgRHWnr/tBW1KGQKa4qO4hcHlRNcMnFIWzW5qKWA32ptp6YcrkxbtWkqpbRVZ42105bDyGmrIZnlN05+HJROqxSh0wuLW7+yWy8OPhQ6ObEVLAcyPJOM55QiZ21PElOhZGLkqbSV4dRTQMaBDZHihwYCDt7TVjaXTihwZFWcDjZnfuz8lvRyjt/p5hyX9HPpWGaknW6Ijt9oCWQ8x79kAH6JJUZH4rGa8cqeDMo0ZrJWQ08syiz1jbN0KMs36eSYjJ3OZmN2OpewM5EU/yozDkNnZGiXYcc1voRLNw0Yn4nGdHDGbwl7I3/ROX5MLFs/Xnv58Y42y0SdEacoQQWVumTYaPfoxozFhVg7Y3F5xvnkuDJ2UR/rlExAZVHz9HTvG1yVxSx7Aqzsxr6SdKo9NviLn5JpO8OZSYZrBxTFooNBWTtTHyFby6JFpp7s5vzW5Bqc0a+j5/kzPpLhKli2NjbWzjiDUJtryZQxcdbbzpgkMzKWcn6cHiTTQBWWSTZYdsbBnUwrncm0Q4Is0AvjkHWFrzKpeCxra8umkiznqDj/uNKRytqZUcSlmLKRhhR/Wd01dKSzG0/bnSCHmqxTAfx1JG2DK+M4yQIOEG8u46iWTNZKVTojm0zW+XHWRjPZdC6aJaducDFVIwnKVXNMmclVOwMYhuequTKYyVWnk7kse+pMrrrYujluRjjU5aplplh0bDIsyORqncrPNfDP0b2E8okbAaw4OhodwPVEOzMmxpGUAKe4GVsnmVzQd0Z0DElkI2MV6LK9ekiIZYtwyoqMukum3RtCYlmb45VspLraqrGleZzfjIDRMWsMXSxwyuYOQjaSqLezkTQnflmO/PiTsbNUd1kd4jirl/xx2CFbbyXsbH06OcbOxhos5ycjvw4j0HV4MsEPHJk4vzrRc9zVkbSdTdrZ5EgrUZy1OJ6MnU2mijGTqQ2rQE4NyOKQOLVc6UjMEfhsOpLIRITTHDd3B8ThTKI3hDtzCMdVnKVl0w2RqJ1N5xL6KzEchyRrtDn9cn5kYrTBlbFlYpZzRn65hG7j5BLszYpjrVyCaHS0leO8jT+la6y5RGysnUs4Q5ZcIhuL27nEGM5/cik7l3KmVLlUiigz+rNh1STn9K+5bG3lIbajzvmbs+R3w4zZ8WXs0WRX/jDNaCu9YXZcWRy0FykaHYvYDqNwWZE1PSYSy9pjItIPjWHz88di3zym3kpbtqxpjYnVZOtt0p4coyBjU487PxsGso5HeINOju046+PPSHtMOpa15Ddtj7XHNsRt7iSNzdTYY1XwG604h0mNVsZubOR0wD7cdjoIMl1F/6o+Tfm5lc0V/fNdsieZH1BlD20aNry5yh4+rMrOVw2zmyoH5gcP43bnMMbKd1XsvXeVeKYV5s/t6Gztn5/L1JXDq+xhw+2mxfbCRRJ9bsVM7sTObuFmbBODm/YZNKR/RfO4vZraupr7Vw1xYEUVd4bz7fnO5gF99+JGb9O++zUPrHR+7dZ868DKfOtAe15TpLI238oP6qhonz1jYqGzJwnLMMhxVQxwEjoB+VZ6NySXSEUUAyr6j+MerlMNVUPyrQPyA/KtA2wm6phZ6Gzp7ujsP65p93x38wBGaGqpXNDs1NoAe2jTuKHDnZ3fAcOlfgYMYxwH49AiStkx5RagM02I8n+81o5mueBdF8vaNaNyHGbVW2NrYnV2PZVSvNaOj8mk7GQ0y24vZY920o7JpCq4bf5L4xzewwqds6cXSuj/qeIOyw+usvODm/pX5Ln7379/1RCnGvO6L75w/0UVAyrye+YXOhv7Cxc12xs5m8Ytah6QX1TBv4H5RROcRHLOwP7ZqZy9+T3zC53d+QnNFQMmOJQPaq4Ymh9clZ/rNHXXwKZx+a7h5OGBw/r3LW7sa17EsH+FED4gv3/FgHzXgPxgPXDQ0mUXzxx0FYoHD6a3dHXx+EFXt91amNwyezrh9EK3cxShdX57y4y2SXahZdJUOZdQmNddaG/tkvMJmz+lMKXQ7ZxUmDFzeoHHBLro7OjslrMLk6bPbi2UnmFoa+8udE5umVQQF9G2ddntLTMKXTMZ2t7S3Tan0HPUoWNOobOzrbVgz2yZNK1lSsGe2dk2p6WbsKO7MKm70GrPnD1xetuk4qGIrkK33dXd0t02ye6aPbPQaXfNbWPRu6e2dZWcmOieP5PkzO4q2HNaOu05HW2tcorCntvWPbUiPzE/MD/Qrqy02YAD85UD8oP3Gtds7713lZ2383aVPXRolT18eNXwKrupz7DmYVUVw6rspsVVhzX37V81pG9fm0qhMz/ZOVjRNz8x39q/asj4qnxrxYA9mvKtkcraZidA3Tx8QcHe3JeKqj36Vw2xmgZWNleVoKmo2girKouSzz+ZyOGOiWyjlold/OvubJnUbbdMmlSYKaCry26Z3tbSVWi1W6ZPt1vaW+2Wzs6W+XZLtz2xMKWt3Z7Y0TpfOavDaV0y0qTpLZ0FMlTLfP52t9itbVPaurs2nHMpTO9qm2wX2lvtQjtboTCPWZKNCvPaujdlrPZCZ9ske0pHd8eGszAbmKfLnt42o43NP72jY6Y9o6NVeKajW/lmst3RaXd0Ty10dtkds7uLjNTWPqWElVqmzGgp5ahJhdbZnaW81dnS1lWwO1vapxTszsKkjs5Wu7Mww+4sOBxrdxZmzS7MLhR5r7Mwp9DZVbC7CtMLk7rtrsLMlk5i7uqYUbC7Zk8k09ld89snTe3saG9bUGi1u1umTHFA1zS7u9A5o62d8bunFtodDrVn/z/svUtzI0mWLqadNKM/oJUsH8xKBJlkVrKqq6uYSaJAACQxiVcjwHw0AkQGIhxAFAMRqHiQRPFkLXRl0la6sivtpSszmUlms9HubmWmxf0B+ilXS9l3jnsAYGXNrerp0VT30DIZftzh4eHP469zvhNlQci99Bphqx5KN3FiOeO16e7wqEwHh+Q8x9THc+Hgs53dobPn7JVp8OxlyToYPt176oyZK6K7XFvbzti53RVuso0Os+t8pC2Ldnf3tgcl6/bjv/qv915+ywzSdzNXV4H1YMdy7J21ieWhk1qDiwNmr5C0OrBKF066TTIzDw7p4D/51//OccqjIe3qycbibmirbNUBuScluZfFCfHnVObuqu9zNwyyJU0CFfroIuiRM2nJdVbj5x6zjiCaBDfyDMVJCgZEocpo7npJjB6Th4rmeZa7IUXx7sbH4oWKuMuE7oIWbgZWRYs4zfJQugo6H75WdB5hQt/ncabkWY0jSKKJ5zR2Q6H6KpmvuhIYbjSlRF0nQcZ9I3NvKHM98K88kuS0W1NeuKLBu/DqlZsE7jjkDpIU3KvEtauuVJSt9essCaZTlVhOukN6ztsbWs4exNTQK0ZD53pblgJOSRpID/s0VUmmkiROzPhfTS2YOeLrKDNjHKObP7wa03HCc8qGaNvahMHN52YuePcnJogw9lwe0RsjdJq48/WRqhbKzSjJozjywgDfT5WXJ0G2nARhpiDShhlhkag09YN0EaeKMoUO5GI+4CEXmyrSAw9Tw9qYw4OLht4r1SPlEScl1/fdSaYSEGOFYoOaBEmagQhduIlyuULn43BJ3sxNsoWboPf7Ko8CEGE+j1hIMIlD1/eDiLxcTZM4X5CXp1k8D35QKQ+RIFNzMlXnx1mkMlKmXlWUz/nB03gqbNZM6DyY8HSzLAnGeabEq98Wj3xzReoX4aBKaRLcKJ+mSYAHol6qJf5SCt2xCuUJzxIseB77wWRJ8/hKSS2B0tUEUuoJFFfUgnm0O1WmzLwS55BVgbjqFkk8QSN9n6tkqXuCSkCAOzCTTjNOLvVmau4azhwnlC5TdAKkkvEw4qepBPEUH8N4XlUXfEVEZtapSnSr0ZUb5opu5iGyYHrL5zcDx3d3J0MefqsV/rZVJlnpY9DqOXvHKsN7Qs1mmc5L5YNms2yViwm8micJfkZ7tGPqonQ9LrBFN+We8qgn5e7wBJsiQtFr8yyeS22OgynGGbr8OJgywxqH8ZjGcRwqN6LxMlPcSUkGFRcUXZW8GCMYiegxw+whVFcqRN+NFI8Jjo8OOmZW4WYur0GDSeBJBrjzerHEksckTuZ56DKdBXOsKLxg7oZmyaq7kx+4YTwlP+APYRDLACjGlniRA1ma6A/mmuD8BtEkFopzqm6Ul+NXT3PvImCOMnPvl0U0k4maCMEvcx+UkYHONs6D0FcJTfPAp1mWLTRbYhLJa3qmXB+rFNC6r85VmqJBJShdxFGqTBjmskS5czLt9l18iWeKOgCzBhWPv8MKBGQWX6qIKemTl2qJbIcBjzVMgr5aqMhXkbfk2pBAJqM4UlhTrZpr3SPNJp/iCohlLRfnmc4iqiFRKbYZxZQHJzAEciLDFI3u3uXZlKoUIy9VWRZE01QG5J3exWE6fqbSTPNkkMLmhMLvKz9zAyaw6pKPsH+dW3APwMM0JWjZPfHgj7yYlyHcSbPEjVL5NvpKuB7A+eSZOsroSiXjOMUqA6tFZPUqUNf8SOlajVOVXAWekjdNP7wbLrXKA/FmHq6Y0rrHi8NQ6gnBHi+pQIg8N8j1cQFv7OXFT5rmrN/MQ8PpbuZhsVubuxEa2IQJA4VHZwsu9zPwQczdKZYsgV7l6Y8myvWl46Twcmlv5iEviHQ4+Naes0cHg8ODIc50tp8PD8v06ogGr45AHZLwtcgnP7iS3UCcYQcgy2S907/9eLD38tnw6Zrw+1Mt+/60NLgYDOnuSYDjWNuO4wwsSPY7Q8txSuWDXE5SJnIKc/vlR2zuC/+O89GiwaI7dG4Hhzh7wF5/cIHv5Ivu0GK1AvN5Z2jk8oeJmqqbEs4DVgoLH62fO0zYOFe4XR0s6D9nzAcIWMkh5rPSkLYsq7R7xAFYrnP5+NdnrKWg9wW8ADzgBeDgomTJgYljWWVLJ/fS+lbOJg4OnOsd7GZ5E+Bc73AT6HOGmRtFmPmLIwNstdB9sGqbu4lZuYfqRiWywEuJWazpCgs3SXkOx85K79xTYmYmq69VdpGtA7RyZfeP6yEcWQfjMRpu6460e0QD+nFIg+2d8tAplwcvD0rW4bB0MXCyB8NtWfpWeD98IoxFPF03mzXAGCu8ST4JQtV254oq0psrPnbalTCjSpgdL+uGP7Cvj4FUnaFYGdVkJlt5Uy8JhHsWb525kR+qhBpeHPFjLUXxcpKNaJGbXDbdaJqDc7WYh3NWO3m2irDu0e/jYVEF2315trgJK2EYX2OdoUVY+dPKt0M3namUWiqbxX5KHXM+Y4hmkGZWmSpRHC3ncZ7i6KEZT+tzNwhp1MrT7DS4Utrbjs9TlTRqNHqjkmCy5GC8jU2yXr+8jZNLlZy4vC2s5NmsVD44dtPAAx0nQSYnRhx04l5qqpvEVwFYNvvOU1ULpirNKuEUr8zmVDuu4dvdt3/gRaP29pQbzk1I6xRrWjQyPFxZteMWokkYp8gNXiQaz90gonYceaoZTGT1UmTlD/GC7Nlcze3gB2XRSZzM8fZmMXCuUgtSsNJ2bGdYG6NURYmpGeupuBlPgwiVFCTK3wy1c+6f64FxnhVeaTxqBXPF7L3rpinOwldZtYNMIXQxS7BuQ4YJBQebt2hVL81apbsqww+qmyjsvo+DyL9TriDya212iq/p3l+No0kwpWqMZbiqpPiO8dXanchWyZVKqKYSNVGJijzF3VSlko9KMfdtehtprU2NKMgCN+T8SMJrIV29r2+5N3Y+5rdrapHNqKfmcaYQfZX4KowTtpWbeDOdpnl7FduEVHmteJ6EFrVUMsXQZYYRVV1vpjC89Pxej3jy1A1wEidkdzgO9YO5ivPMouiHE28aVGfKu0TdRkVjyQ81NQkiVQRydy366g+14xr3jH7c41pMOEh6Oqie8oNEeVkRIv39B1tF/kmcjAPfV1EnOnGDME+URcduiAOV5DSJr7NZ4W1EM5UEWeFvKdxxFN4uFjxpRsdg5ioRTrPuacdV9LfjfIJM+s14mmoPd0FTa5p91m8WQaKopjI3CM94GU21IGmqaJrNhLrCLKTHk6lkrhEdvTGN4kRxulW9dZOgM70qF187brpp1op97edqsllPToec95q2LFYbvoqwSMbbr9Xy2E3xI+kE8IOvuVkz9i750XJvKlPFJKYY9EhdtpZ7g+xy6VtBZEKDqAhtq2mcBW6m/FrspfSHPPAuzdTRU67PkUCgI1EvjjOyY09XJLo+J+3e8M+tIJJod1+0ymRnbqg6UZ1PgZgzSW588Rhuxc+uHItZVD1t1Gye23Q/RkjLXdSLTbXmArpJjVfvWo3XjvPEU/XII+7/6CSdKFyKz16oMERLVGdJHGe1AOyD91fCoqkax5eB0sxZPJL1VPt4TAppZ8vQ0P3E9S454ThRtXy+qPEYiZMlVflMohlPqeZe4Y85RyOaBBFW9jX36lTOr9GmtWMErChdy6iN2nGtfrPgeaJ2XANzgvhF7bj2WqkF3JZ7w04Qwem6iTtPmdJDCWSC4wylX0wC4ZZcnbx20HSxOND+Hs645grVpUNkimM+AgdHnZhs18ZfPOfzsyCOeGiRrCTaOKVsRPxCEyejeurmyUyH9zD1cGo45OFY4IlzSedtEPnxtcyLNRVhCtQ1zS1s+nMR2oh8dXPHa1jYKpgXK1TTOxnu+jW0KXfPIFRTlRKatdHhRZSmZY2kmUXd3FCcxfGlDmu1Kl1Ngj3ytl9GBT/N98SHLmKIE9nj1m9cHJ2Q7oMVObfWPr0q0z4zKni4YPmVuVmewis1rxur8Jthc+KG4dj1Lnsq5ZHDPK/ed6e6xaozDAWThtzbiK+bxFnsxeHKK/OJeLn2sHLxlOlO3STANL+UUM78SZxgcHso+ykO59DHTvHqJA/tWZ7hvNiMAJ4nDTsWh4fjmXKTbKxcXmH5ProdYXGpZMLmRUHK3AYnW3QWpxlWJ804vsRBpXDhTPrPps98uTF3F+DOTJiaBt1SUU4NfXmpXalZNyTua6XyAbLaiHAurmcA7fQUVvSmITqJz63EaTNvsWdKZZYs223lU8OudBso4wKnMM142o+5v6S0FiLTMk9TPHthSciLZCzt2nFm5wvsp5TPDLuCIyUZthaBkVRC9LCCMhXwWi14jPLY/kl76rUdf7SOQz6wS3j6/SYYrD6D6cZxuBlikm8GY5yt19Q4n1JnsZGQ9uJFXpAkbngWL5gtFAEp9ZTEhrus8b2iPXMT5a9qYs3PxTAf7yd5mim/ymduVbSSDjkN47Ebroe0sO+UDYh0K/xoCY8qlQ8a+h6ih6MpnrI0ewM3A4c7kTNxdqQqg0hZEGlZ44OW6bziHLveJYZHM3Z9WUnHri+7NlpximY8Ff7YjKctff7XzF0s/34oRmYzd6uxL2sYeNA34/hS72DTlPu8kr2TodnVe6+T4IYHDPdls5GMp9RyF/1Yjy/q4zALfJzHJka5Tgo9WdZ86xvRlrswPHtj/9mVq9cqr3K0h+nNZQsvUnC6aGGsyzJZd660C+4VhP6qO+taxqZ0fpIoRT3c13bk9i4VX4+vZrlPwZvSxu4yJZtnUMNU4OnPcDKVknZlAY8lQRAiTktlLtgaXDSghNj5BPsf7Kxa7jTwuGlbQbSRvPGbL7Raruym0BHnduZGvpv48CGd81QVxw6tPMwCPiiUpXMrz9QN7yjeBAkuMsEFqR13k/hmSe23tt0040AlWSoh54tp4vqKl8IbbEo3FZgS9mj16Iq6gfTO1YTJg6WYJAxR92Yx8VeFW5vV87GrSToOsdjVazBmcMXRQf2GFxW14xZ/a+U1MyG8Zu2eYRFmzk1OskU99dyFehuEvucmGIXZAiOsE5kgOuu3mrKMkTWMXmBivo89+YSkXeervWKuXQ0MHOhjUF9KIxMW/ouqHKOmdN5rttyFRY3O2koJ6/Y4ueYsoTKZj5hxgvRiDCZUsbRkT4sOaHdjxboRhr5glambKJwHK27wnvJUcKXWPi+7Ve2YL+hRYldPGyueptdMCCwWM7iVlxW3mXj1usMw1zeBa/FMMxd+8KkM6IQNYTIhvq5K5m6ERZIJ6av5Apw/5KWb7jSS/0ZXT7e8fZeMSw/f8KHZuQ8GKtWxdeeXyOsePqXi5K+U6UziK47YxLvaScG3zuIkpFhUi3eD2UkQ9zBd+UWx2Gf2VqhRfY5DPZEEkDMuLLgjn+o4M0eXWhTjtZeHyqIeT1HV7rmmWvWWpqDoXSXbzYJ0sgQrTdRx7CYymGU/xgdXdw79pGsmKlOJtD/JHDWVlpX5iDfXduxdYk+IOVHpmc1WhhX3cbqH7rTWI4T7MXuYB5E+cJQJn/sQTwPC+YNp5Ga45u/LcS/pnTVPBBgEpfIBv4PHvq5ni6rJcpFhj1ENFjPsFmQrtHaOtSJRERa2S0Waa3tASVZoSZxqLCXX5FttmSmF7qpEjoBY5EfCzhe4uWTaIgzx+o0sJYs+LF7Z9XMtZogmTmNSEGB9hUcfjdgqM33SVtl6h7SZqa357UY98rHmBwWO20qF1mHrJxLsV1PXW+KjXTl8t+2GnblJpuOjr+qFiW03ziOfNx8+837bBo+tVjDPyAWhLM82QriJq5VaW3cTHaPw69976kqfVMrifT1Ev7IKkHdW3+CdjcS6m5WV/7VaShB3FDuH7M3a3lb3pJrCfZsZfieNrk1ncRQn8pZMmegLGAI9FelzGLzfqdrd1TFVj29wEVtPNGbmW/1QUCt+ILe++mTIePGzfamucbKnK40Pmy3qLFRk200cplbnfsEo0OO73ONrcl2+PnXzbP3L2mxV4XiFm0UWBpiOZDnZVTy8q229eeXRaW3UccHJvFkQqbWvcKKm4dYSLnIry3Pt8FmLhZWcH89txbueSE03ph/DTtm17eY6D+GVsuw/zG4h8C5VZrqF+MB3et3z6DKKryMMcv6S3etyJgJ9smpn7gKHT0W6PNI2EsdmrZ8smyyUwrtknAf+6ibv8VVY8ZreJJrl4voXLV6heJndbrzBAkHaC0VgJneeKpNrXaGyS9qsXR75q2022IBer9r5OM2CTM65ISChHXxAdvMSU5i7fqtYtovfzlzvstiwdXjD5uKEjwcI7zYmig9PMH+m+o7gPNIHHsx8WizIdw7pALDP85SLVnWjOAo8NzRlLQK6s2XKLm4emWvjgUW81NJpQ3aC2oM1byo+KRWTa6Ey+QnNyelFOEb++pmTzLc84eHWtdG1yvQW860fT3nGvXJDenccZGeud4m77/165Mn8qD3mAAFebgpm0JYzXiQQ88+WF1pmPHOne9uDi6MhhAB2WeDjiH8a61uaQfTD0Owc5ROrM82CksVAHdJ8eDQmJDscfuqVwoQaE90YjYneuDYmb7REgzQ9P+UEbf3aSgi9g+E2lAWaHqy8MAmpEi1xkaYsWtvbWM54b/tIkPmc68Phs7K14wxZMH5v23kx2HoydG7LLNzq7JUHuzsHQ8T4WHYuynvbzhY5F3B0fYgmEUPLafy40w6juWnUOA4TjDgDD9d8r1HeDPia1muqnPc7oxW8g0Fdqx0X+Gq91/Vm/T0CGqeMb2ZQ1voaKw06R3jUK20BQqNjqGHW6bgP7I/j8+ZrQKFp7DK7WqnVa2WNXmZQyXpSrDo0EftWWRDFSuUD1j6DX3C+mue2hjNb4Xw1m4J7xXBe5Q3MrUa/VD7o12tWeR0yy+Bg2Q27LzHbwPprCAnwJxuvQYWLX1xBYQnSlcGq6tgGnAqfGbEi1IgVzkYrXbMR9KGQjAaoel9tCsQUVsqA+ytbZUaYwicbrTr73lPtuFq9AyFl0KM0blR9HS2qAUiNWr1Zec+gUQYZqtGClpJdplq9/Z5BoNaRoPp1aIMDw6kKKCdWWQP2E1Qka1DQXcN3EgIadaAF0a/GcE6dc36v1+kW0E4trCGgDYfCFEBPQGgCFzmxyhqgCbBMaNeahmUC4BDV2+ctYP803zQ3IYBq5RXQT71aKh+c9/GBTcSebpNBlgzEzhqWzgodp3lSYZ1Xg4ADAL+TZoexbKC4BRWwkw565AMATj3odd5aZYRU63jWoUMHVBvoG651FI1t01wh2dBpvdOC2jSLIzS1rqlVLuBqOv1OgVkDlJoVKI19ViDRdJo1hro765z3NE5MX6dII4FOscrriDEa6EUDtXCpDeZKu1M7LqBXNOgK/9VP+Xf0FowOg6NSwKh0XuN3u9PUGC59AePRiCnv7TK9bjSbdxFR1qFPGMEEHZKRSNqdApAEMBWs3KoRRzS6yGvGC8EoAZNBXVsCHsIas9ARwbAWpA8TC4WRmK16DyAfjVqtWUdoq9HG6F8BcgCPqoDiaPfPBGgD0qqrDAmYSbfTfH/aaVsksGmVJojzHlxW5VqBZ7RX/AlgFY0T4FTUe40qQCbKGmnCLjPORLfexnQLiDnRb/7DeR369WCcaE8ofbegLC3a36x91nyPHwR84hxdT2Ce0PkYTE/DQIgr0A0CA0HdxptOH+gO7c1CMYRDXYAnevWqgLR1e1D/BgxD/c1PIRzeNJp1RqfodarcCuc9ZKAAYkC9M+iCgCxgBDOAgl2G0wRWQqd90jhlDX6DhAC8gWYdMwLDHjDYQb2CIurBtQ6CYDCToD7a4FSg1spJ2/2OBPR7DYZSADYBmA4UoDkZ9GSDVLAGHcAa173OWx5XANQ5PW/UMML4LZ7HesBrsStv6mvTkl09q7cqWn9/pbbfa1Swq2z8UefeFtxGzBJ6OrDrKJzxQMEeOvVvyT4779c6b9uF/nyLwT77ZLcrXfusUyjKcy2xxjs016WISArK6faafjqxIjXUvgU8gXV0ReG6rF1WrO/XmWt3emhsw9JkhmAgAM3soL+PH1jDutFCXfA8h7BG+/1PB2K/0y2zRjNiysKFp7x+r3F6ylrQRqfZFiQ4Vlku03mbgRPqNTpvy1TeZ1omu9pdtWVmGOdt6efnbY1TK9rJvAZ4h+Y6Zy3ic7tuVJVZ05i1j8vQPEb2ZXUjCp4F3ClUki1ROYaqMTDQtLaxXagbr2kZ98GfHqB/nXepAY6/Uh1e5eZ9vdKD9N/uzrbz/PDJxY/ranoPISdaKh9AO+oVHVllOhocHQ7LIjDKkLYa+Rbgiw0GhQKil8aHAmwOD7xTANf1OMxmxNoHTL/r4NMlVnJ6Vro9GJIzFpFFC1KVzgAw1M5wuO0MQ31SuJt+H37L4pKFVOrLZwd7r46GorQj4uWiu6G1NTZ0ZT6hSgnNNy2E76Q7SDvdiZGDHZFkBLCzUe9x0u3BK2cwtFh7VH49EHUMUcUQ9awdFq+01rUDM9F0YmXAaGkUAlNyU4+gURDFkPcz+kHB1Ejtb+oTsN7QOA8vabzU2gWin5pmVAiPJoWmKkswQ9dgHmgFsRV6tpcnEAdbrjQHPqUtUCi4qtQTXaUcW8yVrpLU9IYiorph6dSfUX8NY1frNSXxHAqwInA6uP34cmjRlO8XRW1RlGJm7hW22rMg+odUZSPFemqK/euNXAj6b6hGxfRdHEQUBpdKVCFFoj+Mo6lWiXQXNMeV1aZiJB4pie65lt1nZcmI9SVz9IOf6ty6ULpT4Sc0Jn+ig5sE6mqlEBmLGMJKIzKjdIYipx35dMoera+bGSWtldruhrakKOuwmP5cRBhFbWtNtfeOJL7QfLhhNLugd5pHulPkfFRL+YLrXWvUyXZT6wQXcvdGA5O17FgnrFQ+COROR/krBTGcvzjpTjpzURrLGVuWCB+vRKuhcFeEQQmzkMWGZve2M2SWBYX1DYqd7SNL/lvbJafETOZ+iN8P8fsh/tc5xEUZF4uJgXNdGt4P9vvBfj/Y/7oHO5bv24OXh89K1u0B4I3Gq7W9xRsHHky7kHa8H/D3A/5+wP8TD3iM42PWzydA7hS4XNS0yjh4eHgIOJXDQ5zHOGXArXz2GR8/AD+IcYRYZfXiM4Ku6gGggw7LdHT74tkXHw/La6cAe0hnSI8HDx8Mrb3trafMK0RFlZ4+tbaf/n1Zw3ztlU1W1GDn7zVeAP09/Ze4YfyOo21ADOzcgRjYeMUqH4iSJONlVXb/CHfbGf8bDt0xsB2D8Ojxv7kYDnZ3/p//8J/97WNKb8rbo3//8JtX/uGR+uCO//Z62/qx9PT7JHv23eH/2Pjv/4f/6l/9N//t71/3/u3/et7+X/7nyvFZ/D/92389HDiO87z87f82++qzJ8PBnvfB/y++/vZADf+7gTN46QxL1v/9fw0Htx9/yK+W/+nlwRCq11kQPd7jkozvgCYcr8q0KwVyxoPPDj/4anvH2XWe/4eLodYRNpxSuBv4RoqLVCstP+CWx8lLHGVuEKVlePxYpQ8w6EBETzPrgf7Z4m6TUoBQCjiS9WD1uvIfjJek430qKiMzTRPBqAhVmloPspkLwYQHcfKAIWg4yoMstsqSL2AN/Uye5oo/vjEBfDKHnPB6sp9MkGMRPx8A0QVEqtOQBDl1V0qRqEmRYqGdBy9pbWw3vaOQbVkrAKoc2D8QrtKYKVNUfkYu0DgeMGt2kzjnVAJf6ZCMmB9p2BBuzQiDfqxmQeTTWIXxNY1VpCC3MlZ4k8Yqu1YqonGeYdLCLIT7b7y2movixZKrgVQwnWWztflFqoQVPCCJudTANq5YbptkMxLkEoG6yRMEIK+TJIbGs8poGlypyEwsmEGgKcAARmLgTbn+A5krYkBbBRkBNYtRUAT8Zq5oHvg+AIuWFAVRNjM8H6/EeYbXwfbB0hdkxAIIiiwGGcdgVMFhNg0gBV9YOqPazCgNAJKUBjegAVqVqTCkjH/LZm4Gdl2w7MRnnp1P8VuSM+tGm8JNBUtnnY3nSnNuAOusc+HrGaB4Ntmv9BFAZ797wCKpvdPjB14cxokAk5G7WIQGk8IsTTzFCk0ZBFYMDR2vNdQ74C94+TjwHmxE3gjhVzhkopSJHkTerAjfeG3jjSUL/MpyRk0TpdIHVYCe5WnhP3FniYpmKsiKoNcqvAoi4s9xaaduGEJ6a8raXvrbZhVxGYSx/ABK50WTyIksIwIODgMO0pF0hDkLc5gVRB55KqUFBlpK3+cu5MQT5YYrxA49rkl01ClFJCWVo+m1jGyG4HM6ZPP3O79xjrRH6pC1YpnEFHv7sWQdPPs//vd/97f/+bA0uH3GlhWZhz10fCyKqTR49PT//DA0gfsro4fkOHsMj2hwARC1iPjiJxFflAZrCX3i92+/ZXhGZ4wbCizK+apLVt246HXGGkDg9LQHI2d1EScxNgbtamFJTUQJjHiAsTjTgc2VSvdMTIuIxbzVNXOHXo+6lf6ZTa9HjB9dt/s6gG1ciFkLXBC3gc3LwP+4Te/wbaekBmz0N/W120BGI99ITUCkC1xa/nqB+No/QwkFenRvwHXF9j66vXMgLgsud7/zk0jGzBhMKXSaNR7nGpZbb35uLWf8ueChOuPPbwaf737DgEkbazBAKdHgxe43QywDViucO/BJzvbt/rOPNDh8OPwRKI2CFWLWZrwmezI8OKBBee8A+Hi8Chs6tsbDK9AgHmNvoEHzBMjDcZ4PyXmO/rFtkfPcYZSNi+0hOQyv8dyygMT6nBgvBG+QJGpZ2680vgeK8dCAtDpja/1E55ObxE1gNi2RLc5pUxM9aC7AC+0EN/L/wPCERslcC7SKsxGjHjGQYSWZpqIGAT24qZLni5pxK7xl1B6dA/bt14y7FmW/dtoU6ouacU2IliNm+rRJr1USqVA7J1hvinq0G9oAmqkkUyj3QEitXWMFHuoGAC4IXQYOggAZ48HZb1oArvAY28t+04K6TlYBephXeKsxhOcK7wlE2IwHIvmsWLwe8Jax+UwI+yQOq3GKFCFXGiywDl49GhoEF24ovUUUVCW+kwNAKGPA3OkbjBlqDLU+2kCs5U4vx3tuCPF4BuicRvGE3HTOu3eeBj8B+cqb8ZmbvPhqlDHxxb4mvoar58aRe+3yBn2k1wlePFoyWhLjfGH2ZDG+YgefZiPZ8oNUkGAUCiLrTAWCZWcs3SovFCywn8LOyn5eo89KqnrxxRt7TPSbW/okMjv6tZ18gLVaARZq9uUhWlfvwbkGgijjCgii7KsvxUU98LZ7hQnJUqhrqLS8AZczBt6AL7KEzNhd227//LZ6ChUJwNkERsVCCpqIzGNawNfK5jqYRtguBz/gCKHYXcMZCRaj8XEigqdUIN2q+SIUGFHZVivXH8kychP/1lcTdgOfHRSXclNPuamo3NRUrqsqj7DoyiOdyU/sua+g3MRLO3SzUVbYJ7YMrLGcmTGAkDkt49D7Xn7fy/9Ke7lVpvsuft/F/6q7eO+RoMY5D4a3nz978dVHyykZdGnHcl48uu/49x3/L7rjC+6g7NOYk6fbBwfWuuSeFMUygni8rrEGFy9vPz566qTDwqxDEWAu/gYvb4cbKZkey71I15Appt5I3M8k9wPqL3tAyY32HejOg+IenI871u7bi59/XPu9wDr9j1+zfyJ1SFTLxaXciMug2bzuXrvm5hG06sO6625eS3/aUsq6IYtP3g+v7n4L+ycrqyb5orhfNRZNTMutWy+BfQZ9fA7Vtc7pyFh9KvScYGOn0izCoeXTE3vWMKJVGWm1DbZVaSwLd8/7o+65FsRetxLcrjRfvHlR0PtvfvcVNeu10fF5o9lvtNlGrbblKTYWR5It49O5gST/qNtoj1i1xH5v19+NWCTfCNyz/UXLGR/B1sWrV4dlgLia+9XiTK988OOQXsGQE5/ufUYX5tivAAh2I3+kvqdxAMVZOHEil+txhnAM3gTEjaAHj9T3RX3mfhDTsW03anScBP5UkVacrcZRGgNBpN6F9lI9XYRx4hq3f9KnOiyRAJ3fEPpN49Ugl8Z7XutSoQvd6LBjy+X5SYCTM5dOuz2bTu0W/o5RlFO7pRM9tVsMJQOi22jDsT2XBRRAyqdO7dabGOeAsKdxardGdsumsyxb6EQaXQP+0eiBXwDLcAwMiYLQgIk4AmsG3+eBX02WaeaGm75RY79KLTcIx/ENtWLYMuHn2ttdOWzsCkQ09Wy7Qb14HGcGkpE9rZgP9WCysEHcCLY3U2DPwD5IAjfUGBPsxGTHk+xaYHf4t0wtIJdgCzQ5GqUPsyvn9jGDqLwNTgJ+6PKD1OmBRIu8hUr5+zzSMd7nBpuU7ej4PqPzKb7LjKBsj8PDNRJgbGEuBiN0oLlaEb8cNK7RG2+k1yrhxnKzDNY0xOFuICTrEic5bPiwH9Z78ixOPVQzuVduEPIkhgvUqdysjoEyqAV+8AQkk9I2fuyadlu2JhbKvVTaAgjqTwjc8mkIdQmRYoyDDH/VULmwLcAnqXABLjPWx6g0DoPoUp5GdXgsx8qAkJ4q9F6PwQUK4vy1ED01JS9IvFCRF2RLaHvzJ4xHPuDx5/lpewkugb0w8C7JC+NUbBi4aSrviYq5Bpc3rvK1WRoA8Xgx1kU5TBetPrfy6y/yzX6V11h5ksKWDQDQuknANpK0bSR32Qq8JJY7WFwOcpOKs2pHNp8ElB7XN7R8xA9Sk1HYMuFExQXUb0p+4l4ft7rsVqWQpCIPsBYAaGNTByw65esWV5GPdlaRv9GeKtKn3+omAHYQbr7fsBmBSRCyRJXPj3O+1Z2EeTqjqZupa3fZ6MrVt8oqRgYoztNwiRDmV3DzLBMbYlUWBcuqbpIEsJmgskar3oD7WvErGqgkSeHpqLkO7jba5zBTNVWA2cBUPFUZA8iEGOiMVYOQmEs5VVnB8zSk0VRl76rc10C+1ySePNZmLA1As2A6O8YiYIZb8WAuhhh0M0E+QhDAa7CXEKQrlfogFWwcvutP0YmDFNBNyHKQvnHDwIdBBhN0qZY9FSpX08xlufEvo3jMRKgmWT/ucaZ4IYvHSQywbo2REAoYjzidiC9RZjFLEri+MFpe+TW6FMbXXKi56xleD8ApSLGI9Jl7Q9rsRKXgHnPut7hEDgM4Ec0v/QDGXLI4Se2MrXGBlI4DkUJVS8TOFXta8ZUhTbnZU5ScAXeiuLLiXVF8zIwiivWlUxRXZWxFcU33/yg+CThqY9UuUdz8STVEsZ0l8SW+0EdzxZFGr2KKIVW0+aeFitrqRlBqsKCfQLSEcen13Zl4TnjHwWQj0oQeVQuXy4t9gFKXtAgi8YSuAI2AaKkQIIKLGPyBn/0YpqYCsXaDTwq+KzE8DXYUbNQpiDIsBTDDGdbJgRueMCJteMG4gnS6yIHrEIl8CMOoaIcxTni6xwMAgqFK5G6fQ45DNncGeEkeukwuM96taEp4AbynzHBB/V28TLPAu1x7ywTZsppdD3q34XtPAiYynWW2itDo8Bs4RKbRJRcztCa8bZVdx8mlZKmny2OHDJYo2COJGN0y5CrHQCHDFg64HvDDmpCHLRl3TeNWeGEu0GSaaIs0hXi6YnaI+7G2J3ICgSAjXQnOEkTT4p1rgKMXPCNBSftxU00ySuYYWgmWP8WMU/hkgCV5hL87TDbJI3umwtD01Dv+n8YWkSDPjYrak7GnhxfnZiNEeFCKfp2qyK/wqoXJmsxUqIWuGyR3w1IO0I3A5DJVN5TyMk0un1M9RcANMkFaAlI8MARrgcBepjxpoDsAPbpts+NmLo+wVP1kcKQ8h/BPZtIAsPRCCdFXNxnj0YDWkkzpLJhkjUjcDgcIdi0EpXgrTun3svFOsib2bWmm8GCKmUyajyOVtbDQlG0b5oDMjcT0mLSgmJlB78007g1leaSbl7d/IuXa6LGJqaIjGI9EvCoW89d8ya13qNeBD8EqjsJPHsFMyfBk8u/sTlsoM67Es75G4ZDe6bEmlE98GoQdtBGogVmTO0IzLDCDrVeBjS+m/dAnVcgCXFqDFpIiW5LMVmGB9XrnEe/kH4kEzqNH1vajdbHY28+fffkRsrFPHRo4198Odxyt2ttsAKilCZSJSq9eoUqvRRWb5Vgq/X6Pqm1iw814vPiKnS/2Ge6k06Zql8FFqFY9plq1hr8OHudUq57U+AGyQbXqH/AHz1v8nVOtTXVgFgCnQwNy1IBkARfB7VqX6m3Ym67/4RxQG5CzEadi6824QG0wyAadtNeAMI6bFTyaeNgEU94aAwO4FQawonrMgkPV5nkNyswnHWLhnGa1WcGjiYdNzX6nd0qtSrXXIQBat5DXFuN/tDsnXQAmALrArvfe1L9mmAL6Q5shCDrt5nsADXSqa9gB7H4NFWm7z0gA2NFDpb/Pe3ub7LaxPX9+3Kf+2XnrWJ7vCCjAb/F5VvwuusMdYzyJE5XJiSxLLM6IBGth3OXz3W9Gw21jFIYKApJA/MKOCGtXdv+4J8I3B854sL/7zXAEoaI7wsU7nxYuJmf8OT468YcjurEK6ST6rCDNYUHi+BTC9lC6nI/j8NURvXpFR0ero4rDh6+O2IwRm5d98rj8GV0MSQq0c3Dx+CEb893blnNLN8ogSuWkL+kzEWkuBIEAcoJHp9u3mRhx368bT++0WlBvhKq2avpX4Pk06+hcTFZwINOTnzS+CNO9OsOFiEcjbTDNpsTRxVY+DJ9OE6JkvZbBE2LcoBGsfzOykU2143N7pPEcRqArtVqvbtvmlMoWIbRa3X7d73RNTKoBawZYE7WG3W1W3lP9vFGj01rLRDittUZAT6HTdqdVH72uv8dZFsyw93ud5p3QLt7tno4qp/V2f8TFYAAZm84adt+8A5rRXwwB8Ab2CAEgibOO3WcoCRBsR75xYkNor19pV4HvcsyYLmvALtWixCB5UI4ElcaYa0dIq16xzzWmFLyddr0PXIVmdcSfg6uxUZrVUbcC8/HN6qhfb9a7ZxD/gwdQSs26bQv4EyjAphjgmM6ppGSPuNVssIQzLkKr0mgygBTBCH2l3+m9l1Zpd0aV/ui416id1iHH131bA7uo93oMs9KuUad33OiP7E71db2PDtWxOUXOINcap9NtdOsaXqOLtujaL6hr71PX/oK69peEdHuVdq3TYlHF9xogxAZCSKN9/m7UaDf6BhXEuPwh07NalXYF8Bj2Wb3ZlCcPE/sMuEg2BsV5/4wzyigdhO503uWTx1H9Tb3dtwtv0ZomAK1qaJMJBsQQOclGjd5pkLD+e3pX41540jjFCLPFL+KQI93LOQzTzirGKeMj9YpQDmzV2+ejbq9+0njH/t55G21c/G7XK/2CkBYTn9TJ+tdMGPK65v3JO1ypCHjTb/fonYb+6dmWMzZy1c7WPTu6Z0f37OieHf2zsqPShbPllIzYyY7lWI6lg8xtEayjm0skvk5aW5NhLfb8yasjraw3KP94MMS7ZUJCZXpGLzk1uvhAjrVFH7ZYwv3RreNsDa3He9slZ2xu/HBFP2ALkKXyobGqKI5llY20exGDfzba/s6tFgWY8AYXypeW1v8VRYMgclLLGP/+xNLwWi9lr7V8wU750CpdwCL77u2LZ/sfGSNz54Cl5a3y3eiDQyeFycjSBe/tynxLu68X0o69t33h+AeD3cPyzrBMg4cQh3/8uExPnpTJuXAuyvTsWbnExbufEu6nhPsp4X5K+GecEljRYuCOPVWfREl25TiPhtQpDz7f/f2QlbDpXG/fK7snw9uvP1K+7v/yI92s+8E9LXNg9WpovXq1W2Z1NDBPJzXyjnxkUXYichLL2f9UfDk147f2f+a9L0r6BKSwRmyJ6ojEJkxFgwtruONY5Gzh6K1k0YfBxYfhzgdRJ/mwBWUSTmYLJylPBxdPh9tPnUK53IFem9ZAQXj5nmff8+x7nn3Ps/95efZWeW0VD+Fx3AaAi64YHkTNhxYozfGcLVhD/wiL62CGWODS4HF5++G3uFf4yRoZtxK+Ty605WOolAN7INtl26hMQX7BXcDUga/ITWFmlCVq5sv0e4ZFyRfkXl/S2E1FVHIMe5Njj/hQBAJh4ymNfwgW+wRRS89NpjEkCMmb+EF6Sd5smizIm10a2ZMZgBK8GW6YPLZlSt5lms+NFMt8AUCdfB4xng5Lr8SwO+AtyEviiB+ZOyYvXYSQtM2TkLw80/roHvk+8TW/x5KL4zjOINiyIH9CfjCRxxcQNCHcOvpBwhr3gHBgw89wU/LnKp2SH7MdOXF2dU7Izwkq7QtSjA2joitS2SyDQKW6WeBGT90s+BfIBE/8iWiBSm1MpjThl1kFXkRL5hDlDX0yEWHdbZJ6lzTJFjTBBRhN0QLTIKMpcCMgCoI0GLgHrcuEr0IhUL9MQLc+H+/OTdVPfwiA8xNmBNuJNAPaT8rXsSw0MNPWJWmGu73Ai6MrCnwKJvr1YMLXgsEkX6wEjSH9FlKwoO/cK5e+i8epQP5cQk4BD/wMABBi4YYwYsGMDPIZU/4Y9PzjTELiSwoXHoWLBH8QARDH1+73cOcUphSm8YTCZXRDc5hDn7sRzT2a+64/p6K8WmbjUu1PUppfToJJDAd0kMbsRrFP88v0GoIgc2B4JJDmSKHKmkcZzdGsKc2zBNLRGc2vKHKjmCKPIpVBFpkiaBtHkMnwIW4xyxeQsgwmy11c+1K0mFOUhmywk+KFSF3oRoTE0jU7EJ52s5k3Y/mJKS24+hZ4eRH7KJ04RSdcxAufFokIQHjuQgj0xUVKizyd+bS4ou/zOHPlyeJkmsxCgh5x4iaUeAtKeJTgLp+NbSYyzBPFJUvUFSVzc0e/mFPCkVJvgZty3K2mPKzkqjny2eZ9qr4nA0iUohenM0pxMy+5SGf5ZO2aOYR8Xqq7hUAt8dBO8RaqmMG9cM1Mae7HBGaR5umC8W2u3QXuvTlPyxRFy1yPYCubMjehTCkNt2SAO+IFZXEO0WKgLLmeSoAnRRl/OMuWlEvT5yIXHukxnUfB93hkKeURai6PAJ5EeYRBJXfXuxhulIulY4xbjE24GJpwMTLhppTnvvLQY/JcRUxc0ZW3uJzSFSr6KqCrYA7p8nRGV3OuBVZUuGbR7GuPrsG3GWEkSCEWjdBZjD93Huir8BsXqu43/nSXe93STSJaqpR+UGy/GRn/IZ3RD0vIjAI5YosGlkwfn55JWDqcxcAjCIEHE62wkLoeTYJNSXARAteQWgynYlBRIBP/Cz7m7NGBBkIZM+qNBmVjqCTMNZCJ9VhRg6U/NnQuIEqkYLNLibEd1tRgMz7r0GlTlcUQoZphSpupcEGhMmg0YTxFf5m7C2bVPL4mtLhekxwSUXpQMVTlV2LsIkwBpQZAiYiROeCBGdgYzEesFYIH4ucCjpbPIUORR1LqHEZ/fklNCUoP0GfuxHaOP3N8XPmWXx3RkUPk7BzS4eDwx6EGDX81eLWLw63PHH9YPjoix0eqn5U58cFnwBD/bHD0GaDEafAZDct6yWJOCp09Z48Gtx8HzvAlNnB89oY9l8atoM/Zt/dsqHGrSgNn92CocQNhMPJhqXzwauBcO7tPHr98Xj749rPDna1new9/3H7KYBXDnSPine3uD5XdPzr+7nD7oVW++8IeR8f1N+I++JvhzmD7s+HgAjvO4e3HZ/iF7gaZqH/uLFhli9O1ygM6GjLNF/nrm16J4NgCtcG/O/vas2Ntm633gbP7bHDLUgFrCf2V15qlpR4unNS5+fzzXefm86+dm8/VrnPzYvLw0eMnnz3dfubsHhyVvx04ww+39NG5+f1k17n5+kvn5uuvdp2bbyZO7n+NV3N/Mpk4+WQyUfycDKE/sTv8dOLPuJC/JjVLV4e0y8PB44Oh9edKm36mCv6EXFrbZESM1mF+HlFxQLIW+tSACDmp5WZJjqN3EUexnuztlHSn/BcziHku8m+//Ljr+I5flieSyvpD0uMYQYi0/1GeK/i+tf7xRyjsDM3rEtEqW2CjOvnbff2ktRSLuKtEOVOHJt0tekY44PrIBeSGxNFb+bFl/YtsrM3p8L6WPl1LrHn3430N/XwN/UqOeV+Nn65Gvn0FmtnNwPFFkvDzmO8lRCJxE+x0Db7VQJyRsxdEE3L2IjeyfmFN/7mLdLfqdnd3aXAgE/HuMzoqD3kt7Oxd4Jfd3d0tx9Za8I69Y20v3XlYupCLccmpVbZ2d3dL5Yd7lrkVkR9M6MURlwrobEfWthY8/vCBu98H6XwfSuWHHyxr58MHPh2U1eMHvkwheD4MrZ2LkkPlP/ltvEh/8tvWjnwbCUQcWmYIf4MT51CZ2/KgvHv7xbOPB2XTsg59ItykViTFM/NvtnDW9pZDVBTht9wO/9iG2Lr47Zbtt5y3f2S1/8a7v+xhnUjLsjuRCLtLVB1myvEAN9BOZjEC9p0yrn6zti9KHz582Nve4ALm/kQLIJnwiw8fPmxZ/IK1t/PhwwcEGFbLPx4e7mzR7u7OFoR97nz08HAHP8l0g6xuWRePd+jxzlbpApMMsLov5IZ7e1e2gcyqnX0LgJyyg4JskQZxHWzv7A4hqO/scZqIvGddlB6WnQF2jEOejh/p5uBlx9AsNyTkKYc8Jbkg4iCLgxx08gHw1R8eyLEQEpU0naHkixvb3mHICHn3CO/uHBU5/8d83irnSXjxsHTx449l0xyogRdb1o8/lksXe2uBe1vWYHs0LF2slfsQ2g8XzpBrurz5A9chDrow/VrDHb0X3bF+kllEtxB9b+N7e1sWhOFoNCrdUbZwRAOH1SJGI9nBj6wiWcdxIicZ0mbPeKinb4t+9RvWzsjaGY2cMUvnaezd7V/+wT/hHWvHAd/YdoojpU+X/tcX/k8pPYrPpf9Tyv4nll7K/w+UvoROK0n/+GtS3re03IrgKH9YcUr4Co+1/UHY6TorFf6Kc/+fzxcGsS7x8Nfka6jvj2W0lA8Gf/NguPOTwWKVcbn84G+Gf+pXLAs21wWbGh87cp4fbr16orGf9EpXh+vA7UPZ9zwaXDwagrmImA6+lz59dMTRDgdOeoQGF/L5EX9OJEmfl48+7H0Ats6GGtOauztwrnd29R4E1iNuoV1Udp47H0sXzu1DxuFZ51Aft6zCZuUsm4fOLXYOoKwtPVc4H4sYXppKBC9NP/X7d/rn7z7569yXX+f+2q8SlH7/ye/xnZmOMVuL8O/2tsm5PTCT2YHzkZzbAoPuI13s3n71sYiOMjvl8sFTkRYQT9k62PQ+ZpqBtsKV+ZzUCwIgbSS00m0sqKY7ViEuZ9xkCQM6gJxgSAhtY4K1IMd8Z8SX8wHfDCGymi+ypTE6ALMBhc0BADBoqwNQOcdl6ApcSNuT0G4nqXMCBm7IYF6JGZoU4AIUchZD5S70JbRKU/Mew8fLTU8gNz7X0LpH2SM1dbOANfQL4Bx5SZunmask8Cj2fWDp4OqWH1Ihotd+xbrsk+AGV0d8nzqFAjAuFfmGCBgLuHNUbKQj8t0Ql2qFdZkxR8onSIBtzbCf1ey009TZL6wO8I1SHnE5c4aB0cZggkzjeQE4iW4iAf2hH1QSW05ZW6pIyQX0Bx4zcr1UefKEB7q8/JwRC5OIKYsQeFzaUgH3l2kIkRK+l3UTIE1NU3ITXDWumWFCupIs9IvxAMoLPpC50T4/Z6sel5J7pRLo6hbGMCJvNncTAKqo4lYQt4HkuQuoX0NjWWCsVBBC0GRRAKQEiwITBVYWvHg+Rp/x4ui7O0YyBAUlnZGXeMSVIXXBVSE1YYBP3ORSRbh0JH2l66sJUl1ZdIKqvVhLuArEmoMfsCL52ojAJbrGyfGDKe4KGQtFTIvwlet1BHAL8mH7ws8XZKxDyVCSS2QVpdDqZ5mU1HOBgHKjvFywTfjaU5uLgsMWsyYuFPJTiKdcQSgFLastfYRuBpCNSRizzQ9IqLDFj2I4uvO5S1PPFwwUIH/JRepyEYsNqcijIPIVo3/56oaCaBLw1XMQTWIKGKVhZU2KhWYYcCRV+g45usJv37mJNiR1qZYpXeZJFqeBsR2CG1vwkHSWKbY1NZ0ZbBARN9FwYzK8WT5BcD9wky7oH34A+RGgfEAcxKDhhQUv0EB4YAXJXHqYMAUNYCZQGmyZiku7cCHVEaqM5TqiwDMsAsBQC5Vo5JmU6ZyFXxYBZDrwly8EEAPZxaBfxNfI1oqZGGSMdB32wgcS3vc5uOgK60JDR2gldAZq0HgNRsRD4CK07ZRF6HoFmMPKlsoV8kGCpZQyHDwVXdqYy1Ae8fgoTGglV5rPzUJKZwnLfEzwJoMKRDONLHCpriOUIA1ZVkSEPxBFJEAYeOD7XCnEzdhGV5YEC/DHFXOcr8xwgS+mcFnYKF2mlEE8iLEIMGYz1D0QFDUBwQ/YcMkjFj5Z46LMLAzkX/B9vuKsLMVgxD7AZa+AFZTSlQsyCYB5ByjAfK5gmOsqUNcGt47Nv8SJfw0BAC2jUXDjYGE5490jOjyCms7BwasD2j2g/5e+pccEhR4iZ5scbFh3aZeeECwv4PrduaAf6RCGv8lxRJ2G58+5uxzraxBjF6r0aWtZg51tNvvw6uKIF497TPHPhvr531gJXeui83bZIbMwHloDejg83L4oOc9vv3z2sVjBlC+cFxfOzg45OztbF3gVJ7BYkB1YFwcH5YvB1och4bFVwnPTTklho+TiKT3d4kNV7H4HkGdgo0zOEP+g92St/7y3U3aGZfxEr17t7ZTxM1aFlmTg2c5od7hzMTgsP3z85NutIT3EEvTg49C6cG7J+bhFyJlzu7fjfORknz4t02jEpx4FvXVRGjwdDc0S03mxdYEtSJn3L2V4zC/bnMaHD2VydkRAH8pFzpazRYMfL4YEMQuntEr9U7E+DMmxWG7U2hR1x51EcX1hri4unAE5wy16Vio/vHDSnS05beH1PzbcjvPo6ZA+YTimqHDtDi1kfXeHnL0dzp8mt0zw9g6Nduhw9WMRIO2xZ37DIcsO/bhDzgV3Bj6tO8SZl+6tWl4CeYksa2/buqM7IJG3LkrOzk962NZFaReB5Ox98rddcrb59xE/D38aqbj3RjEQ+8Wz33Fy7Or7Az7VsbBturkKILOLQfDAKt6V3jXkuj643QeUx8uXcsVulUpr6hNWSZ9s6OOoTSWJPa3jto/r4S3rwnmOrc2FNKGJhipFhRCfG9KP/HQuxNmBY23RxSHn/8HeDl04e3JktwdbfBcHg4sD2aHi4w/2uLIfOBuf2NsuW9tWeVU36D8PnQF3mcGjp1t37RMVtonI9LQB+poJHpIJ4XdN6MVTadhXun3LB9XKOcv2CwRIBRZ2Ov069RtdelvptRvtU+ugyNSrsuNvH71y/J0jQTN2/KHhM9sHB2UjX4KroO0/ZQSU1jbtJbbb8w8k8pOK0ImUzeHLQxGbejCiwcVo/Wpx504/+HQka5uPVY75pMFJrb2d8p339nbK1vbTp84xYhXfG1x8ADoz8S2VtTN4+mHIMUqDp9s7j4fWKmPOF4x588UdQ1Gfyt7PRbW2nS+cY2HQ/0BdfblRV19u1FVpNGJGyiquzk6ZHj9eccyfK7XzO2KJeenY2CoX08Eno69PEZ+KADE54c0/l4JmyRYflVapR/2W5VifPS7zBegP0K76+uPL0gU9sJydLXMCdCvnL7fOrT6Vu0V13Op6GXw8kFPmi0dPn5csOZqBcabB9vMhm2d6bmTJBrrSf95i08ZRr+M8KszxPC2sP5mJBHpT5/nNUO5utW7Y1x+tpziTK91n6C8uQ8z2cCxkWet/fMN8UAwTq+ys9P9+Zc/8JTbD/izFuVO999/9p/vur+k1F6Xyw0hdC/S4MMhvy4JKtTIrYJWM+XCDYv7yUHAJGCLqzxWu8y22x9f+ypa+l9NVaobnL/MVqXIVbDx+gyP+PkN/cRn6meG27Vivnuzumi3K7u6TIzddlJyxHLvEiYHXkEW9NbQs3Wf1Kq8Ip7Xe7LA9m+JjBqbDskyq3zJ8B8d/eeukWLJJWk5q0S809Pf0Z+I8LeI8tWRz95IKM5m8yr796KQQqmaXM3H78eWjpxsluh3+mTNSZKF08eqhM6hCixT30itRAywSj7astV+LCxj8Yu6YXqXZMlSDC7bOAC61iq/XwEPCld1DZwjWxO9i/fzTr3LtHL5ynnOKR1bplRy+4Y57O8kjNzscPH00LPPZGxvblI+udO75ZX7nyCpd8GXcgNff5Ye8AreslV1Q7DS3LC9ND01JLmjAtY5ScBasX3ej9+qJk26XB1uHTx4fANJy/yM9OVrfRjlb39K3zhZf7D96RCv9/1vnlu4XxPcZ+mdfEPOXbh8VYBPfouc6WyYfv7Cj/ktYL/5L++6v7USPbvEVAYHlQ6DCIBZbf+JbsIncxrCBcmNwa2zxnPcbXVPr3P6Ws6gl7//Mq37RxJVyf6LQljGRVlzDrFJ+VrJeHUF/8p+iHn5l/fyKyvjlVSMXMFztz1AHOMzjg8Nn/5LLD0gP/q1UfvjLGYCIX6xELlJPRT5b9WINeDFmN4bxleIX3NnLapblfWjLsuS+PozHrkaMwOdwHx9kEvOlJdftuFvHTXE8MUIwct0tl91ArB8vGcwAtof03XJxAwwV+rkbubCJwVekRhxFJXIVKt+6tWBZSIQRoOoNyY1PWPNT3qUxU/MJy2QqhMAO66aLUAQj7K/Z0FsZz4PFsuBG+aKtHicKNmnW7OfJGyxQhJcgX5QSyzbdsYunL/61Lbw8W7OHBxNJ6T9kFq/QGJ+stMbdcMP0nXfpwsh7YQXP2EMT23Zr5uziCa6rdQXlUepO1E+M0xm7dHwNbRDtrd/u4UxpZXb1N5tHa9ta5cFhtLPyJ8f6ti4NZBLJjHUxwMcm9yAy5ysvmLvhHaOQ2tAjA6HAbF48ZsiZlN/TJhNFYAxGCinnSLn8wOIIsJl3z1Xuucr/n1yFfrMj9p9o7cdD2hx4y8mZLuqzgn/dL/nul3z3S7575vzPzZzvl3z3S757rnLPVf78S76fLIHMJVqpfCBNNbh9OYR085a10sZLnesjqzxkawCD1QmZ6KSkqZqPw6VuhAm+RnOVzVZC+lxBqJeFSrICgQ2FkaNSOXUrmwXY/bR7P0Dup92/xGlXZ/O3d3t4n6G/uAz9vHBNMR7WN+73k8b9pHE/adxPGn/NLPE+Q/+oSaOQFxxa/1GBOOtVqfzwieU8L2t0DA2OsbMBlgEko9IjeiqQHFoQbk0fiXWR1hK1oHciEBksZ/etZKNitlAwlZ3EITWgvjtXUB5uCIR/C+jzSal80MeuqUydPFvkWZXtQ3SheN9N1FUQ5yk8iEM9ZTTVe2oa4G2rTE/0d/e2QeEpFqprVaq0a1Sxm3RcrdJx1abj+h/ouNGn41aDjtt1Ou426bj3mo7fVOn4jU3VZpWqzRpVmw2qNt9QtdWlavcdVbvvqVavUq3+jmr191Tv9GABmhrtd9Rov6e/a3Xp7+weNWsVatbeUbP2npp2j9qdLnV6Feqe4a9L3WaFus0uwUJNr9OjXr9BPVg2Oa7CTArZ9RrZ9QbZMO3cf0d2/z31K++oX3lPffsd9d9VqP/Opv77Crm+p6f6kMYejGKkNFbf0xgT/TygcaRovAhpDMCCK4/GVyl5oUdeiFOagLzwSkxeLG7IWyw1jMAN+WpJKk60Cj0055f03XxB36UJhb5LoX9Dob+kMIVS+oLixKXFDH8LWoQuLcIFob2TOKEkC4gt0o89ragNqP4AUxel2Q2l2ZIy94Yyd0lZekPZjUvZTUrZ0rWc8eOys6WBG29fPPvyI0w/D26W7lDbgIYyHttzplqtJ0SpfFCrUddiHzqwT4PPd/eHjk9fDD5/AeCzMZvhY0VJZ5zoOC/WoujUuf/UalSpNd5KR2rXGlSxe3RcbfbouFmj495xFQ+bjnvoYT10MZhKwvMPdNw7rdNx7wy/nOGXBl5pIKzZwaNPxz30xB66Yo/7IsxC9fp4A3aheuiXvTc2Hdv1Ph3bfarC6lD1uEHV457urme6u7YJ+YLt8WqzL923+UfYcIK59Wq3StVug6pdu667sk31BidXb6D/1pvdFnfsk9Z5kx+2PM9JonEsMX3OHb5ZqVKzYlOz0qdmjZo1PQ1/vvvNkJBY027yKGh13uDvLSFhTleSbddP9QihTq9BMGre7XSpe26fUY8/2av38degHj5oRg2PluNqg+xj/oOvgUHUeEv2MX7vIahn6zF1JmOqDmtDPVgZgsV0sutvyK7/kewmrLfb3RbZfbL72tj5EHbU8dcg+22lS327T29rPXpXPZORh+W2H1xr/BE/IDdNaOyFCY1DYIPATE0yTmmcYGwmGJxiRSDBGE0AK5LM8MsMvwR4JUBYGOOR0TjBGE4wiBMexTB9k2R4I8MbGNHJVUqM1jLG2peBSMYBeeNED/SZHugRIV9eCAaQycAPfwAGCZu2WXjkLQLyFqnSTCAlFXByKsDIV+FizixhAmQKPFJ55iTROBYvjD1mFaHrASGDQjej0KfQH5hugZTCNGTmMY9h9eTqmvEuOFFJk1EvmLFQnAS8gGZ8ijydUcLfSxRjRASU4GuG2TCTGXsBpWP+gy8A7wmuKR3j9wRBSapZ0UxYEeyIKBgBTQU1Ql1Rqn4wtkEWc0px7q3hWrkQAgGBj8B4S5ZmdO0ndOPN7vCsfeZZj8tPwFZ2+DeARzEbc70foqt0lgU3y6EzZjOpbDD1MzF94NDAIRCD3Z3t508uHh6+OioPD8uDkvXsQBs7eLm3XboQ6D/LrEN4kYEFi2AcbjvPWehTlh5FhLVfyxcloyx+4aTPPjw6EDAEgzxoVPkZk+vRI2v70RPneueJU+bVUPmwTAeHyO0hscGGQzbYsDM4hOHS3cEhTDw424PD7WGZAQDZJiwdWkBIwMuDvYuHhz/CFKzw3HYNqtXU6RVcOM/ifhLM6Rg7rQbjthzzQKqGgcfPxVvsbatm62fWG9rV0cRzEnt5ajynKlsj7/7Ujdd9fXVTRG5hM6tpG4A2a3TPvV55zVtx4rcAkVNNgozhnmoK276zwPdVxHHWA94GkR9fp1RLAJvCT+SUCRubzBNYaapHVxXfh1MLruAgTj26amHXW4+ubPHa+RjOORuJoTqQePCoLBZ0EoSqIpBJIKvAHjJELUiEZrirTZ+NCx+YvUJQTZCGQNaBA4TNJTynKqswVpfxbbwFPzBYNN0HSJWm36gE+DTsbWgTT6C50g1hMtQDwowhmkA+Eo+39MINus5IRRIwX0vA5iMJUOveOAQ2jQSsF8M2WWVrWUyequy1WtqMo3MagzGc4sDgFGcnFS+Tbb74fF+IKsNAMVlTbhEnD/BnOu+KRLuexRkQxRpzd6ps5SbejBpRoOu+EQVcD40oeMu4LjJI+Hkc39BrteQB0gzSTBJKmUZ9CfXGTVJqAqiopaKcWnGeKhk2K7KWuFPx6rHBNLdKK53iO52Iu5cs4mtqnE+py6hD3eBGoRhVRr5iny5EN06zlkpTWesLoFA3iacJiJ5gCfXUVBe0p6Zc0J6aSkF7imGpegIi1JPjkl7Of5UUTy44j1E86nz2A0qqCJT5PNMYpCC6obskM5xtlR3jqEnqy1ZZ1V3AZNSltDoCpKVqSl7LanL4xDVkL5TC17N6dAVH+g6o12pZvMFRC187n2+k31PTN4DysVVme0kchs31X+0sTpTJky4Cd85EiCxULeTf/PQ2iIovvY2TyyCaYjjYxiiWzROfjQ2aDeClY/HmkY+uaIi37pV6I0hDHCRVBso2sezNWIvQTWfchTUNzteZTNZ9ETxB1gVkFQqYp8duYthvESCtylfRVTdVtopSpf26c4qnqSZZQUaGYiwuoVuBr6meRqDSPgB5aZozpGlMRGuJwrse9ZwxmWxtH8xepqiw/oxxsPpxHPaDBfUTN0phbg/UEiHnvWZNI6z1Y2ZFb4Oo4B1r9HGcZfEcIcJC3gYRPiAOR1KoonQjhNtfh1T5FFlo1JJQXLeaNJHPcFj5Nohewxbc2yBquTfBHBwbtIpyYZSNTHF2WkG0+lXTFf3iynse+TEHgWe8DaKeggFAJm0phr2WA3sWX8PlttaulMj4ikqApx3rX826wR25s0uGPmPqSk8r7shdYC50VxSMeMkveRZnWGq4ozEGTMgD3h15bqKyG0MsQcTzRc5nwHPFXh7/Po8qd6TR+dwRtggj3zzZEc4wx3BPmTMgLL2EabiCKjLk86pgxquCDK20GXStFwruSEU+y3W4Iz7eZog7dwTcvUS5KacFS2LKzNDuSAw+isCH8Rn8Snc0zQN56pJteOQEnUPWyJnigcD0deBzvU/z4EYcVMsszpF2wBYSAdfIpBRFe6J8PlYmUhagTgS9zx0FsDaJeeHFumd/3fPFuudLeNKvvhwHGaAlR0Hq+oDZA4XmC0Ku/ABKqbIog4dh8iRcm/nTvjwKGOXQHV2qpWloA5bKJA6jEm529BtdQpBFoQAFKJIEhg6VAJquBcAE38onjW58kzwMdZc2QZDBuROkO6XxsnzOp8LuvMageJvey/GdgPl6AAzKuR7mbOXfCfZ4oXg3dB77wSQogsEWGTfVeKdY4xSetSwnaprm441fP5nelAH03NHc5+aR5p7P+aGf7PCA4DFoWnLO2KCj+dKPvVzOKN0RMBb5mWf4Ee24zhbiVH8uTlfcZZEEcTKT5Zr2GTKeJu6ca3LlXSeLYb/IEt0YiZoyhp87EoOX/iIo6GLAideMOVGyll4k9FqvkYDZNY4stEdXs5Rf7rDcUZq5STbHWnCNLvLHITDNa6i1XzAN4nYu5TnZHcFcrjvK1BzRcUUFCE9NFtUEj6DlCq2/bMgA08yml+0Jj7LAu/TYYibouQp8HnSGXMyWqR7ZbPwwiDy12T5F8GZ2MAcxRudchvxmgOHbsKapa+9aOhwYsu5QILkNrmWFJZ6lxFsq5tXLa6Uu4S6XS0aIHcdu4q8oPs+J5wAnJeYtYL0hrfekYrYrMHRTT6PbMlqswNAmWirPi+fx+DtXZlHtYXRcocGAcUGrfTyGtUdYm9CT0J2atHBdLJTgfwrN40JIud5FzvwwlCOlG7FAzIDLvK1iCFMD9cqr4yAc4XwtCEc6F0GIyTFL4iXb/QXGMnck028aaUeEFQ3qKs/j4RUnE16NNCBuQXlxCM9UZdJ/hI7AboXMNKkhYgtKv8isZ7midHAKPudOFQPAAjk1yueooijHeoHiaK53G4zILDCwTK4AUOVWAzUFA9ga+jTh4qRj/oAHo7NM4n491TRnmBFOvxc5zRDnWlliUk6zRAOb5rhTF1xSqZ+sqJ+My64dbxaEvqG5lrJVLQm5cBNVhC9gr1dIuekHR8xWtZkV1XblAl3WcxeuB0Te6yDSffI6iKRbjEZV9JXRCAvc0aitrmk0slVW9PcQ8M+yX3FDZkaLRYrhi1oTNjZO4utUJSOuR+OZuFcx9o7pKiROrjHsjH8GdGzjSdQkUXzwKv5U9q2FF+u2cQr451QwyDOYBM+SUMspZEnIeQSRLyCNUGAzI5jRkCFMAMhkA5s8eUGTF5/T5AXcfZq8+IImL76kyYvf0eTFVzR58XuavPiaJi++ock+TfY/p8n+C5rsg/6CJvtf0uQLmnxJk9/R5Cua/J4mX9PkG+JyARldd+nv4uULfnzOT6H3+fkFP7/k5+/4+RU/f8/Pr/n5DZ4cfZ8T2OcE9iWEE9jnBPY5gX1OYJ8T2OcE9jkBjvgFJ/AFJ/AFJ8Bv8ov8Hr/Gb/FL7o2Cpe/lOM8yIBl/Fy95xftdvGR+/F28XMRXcBI8cjzYe4PHEo8fKEQXCl3IR2Aj8GKN3jc0AzYbGkjNFMo3KTQL45BbPMSeMBTLu+E1xGNkbS5EvqC5fo9TGfEIEnIRusuRgDPrAIwiIbl3RXIWwCzE9T/X7gvt7mv3C+1+qd3fafcr7f5eu19r9xvtYvgLJTjlQqObaiq4MlScFdR1pEm2Mq4p9GKhuacJif4mFFeRkHMcUQq5mPpRQeYLTSa8shEaR2pCAZwa0TmioFCLFfAETZnoGk5MyyTcMpJUIk2ToGkS0zSJNE3KJypcx8Z0cjDR5sFBIQrzEyxl8oWGVx5xBE3PgXKu6XwBOSYlw54pLjlTkhkm8wXdSI5fGGIftweCZWzOvsc4hKmM4yvVZvRvwiGiO7scyXwOSt0odkVaC1QgURaBT9iEV0JIjVVCXNFWwszOxzD3XAmzvjvWTgXHYFGufXfIWpACM5wq4bW7TDtRP14QDuX5APfY9S6nMketSD7ioGMVxtc622OVXaOljoOsgqi8X4fTSfC0Uc98rmI8cqpyHGTvEAP478csVEbH0srHy56aUJUn0CoEnMbxjRDKN+4pVjbVWYxTAnHklIbk4EBOI6vxfBzj9LJqDEfowzyci1KVp70aViB48IlvzV2mVKs1SZ/ykZxOoqprim1pq4RqCgJcNb1kqQFOn2pByvbAtetTLYkXOPnhT9V9HM3zGqYOObW6GA8Xx6c6L8DqPDnWxSx8/cYGFJKcTC9TLJJPtBjbCaPon+BYjU54j8/PE4DWyz3HSQyx9jgxwn6nuIHkM2l5okpwBi1n1XIYrW4y7huneYCsn/BW5jQP6jJvneYB94kzPyG5ySA+RjoLpjM6e12t4tHD45zOXtffj6rNim3X7VGv0+nrkPNer97uj6qd9knjdDPsHHe3HNLsVCvNUatSPWu06xKEH206e91s0dnrczqL8ySlMzkspQZWTHjYcywqGjVq1JqoisaEGhOxrdGYSN02Jqfa0kdBGZsdjUkj0j2oMWnihFqc1e/6ILwxaRuTHUL+f+y9S2/jyvYvlmFyP0EQBBf9tmm31G1373328W5bTUmUzNMSqU1SfhxR5pYs2tZpSfQWpba9e/WeBskk9+YBZJxMEiTAfxIgATK5g+AiQCaZJQHund98gWQa/NaqIinZ3fuc859edFusKhaLxXquWo/fUiU7yaJQgmbsxRLWmY7Hs4yXlUXVzcsZ+GXMQuUxM56RrXg26so9jPB8vrxeQD+R3VKc05+gtCk+QvDpDZ6yWUjKb7Ej+FwswD/4IJYR4Bwq7unBfaZWcplcXFAruSHhqPIvK2a2B2MlxKL2YH45nlHGPtQBlNoe3PJ4ybiHOsA3meeIi86zBNHWTmaLq9pgItIHEvHDcrIYk2OSk5CTZIxTJ9ET1El4HDoJDwQnKdQPThVILVJOwjxvuWAQO4nP3lHmI8Jy5SRYMZ2EWespOcLWAQPb/UjujNybWZ19a6QIxnPqgMylziBN2flJZ3y+gIcMFoBA9EGd5IY6OJCCClbyDwcUjDcYjRMIQC4h5GARx2DkQi/UiwcTnFrJi0fzwQ2rQSUz8qxmVLUd0zvlYP3Y9eocsk46plOP/D9zrN1tBbaO4KKdM3jCNfJi1svyhBmkGbReDIVSr1klXzZcPz5PZiPIQoTI9+M51Hz9eCEjjJdwtcMwH9cfs4MWfzLGGo72rYPgzZpXabIKgz/n86tQrc52Zx/BnceCp7Yw/y7l5SgYDHfx44NcYmZ2cBVPYzDekxsKwIgLksvLScz7ggqr5RVceTUUsK8FyfU0SRfCpJcNgoPqnAOOPQXzOObJEMwRuTMvB+MZsXZadyavWMK3BbO2uopt2J0xgdFlBw5dXvVJpAX8y9Omm8a8yrf4lH80TvEnK/nROB2jukdqRROmeM4DH8wWtcV8YnKoscsXJQ47ZsXeY3h9OGG3LnQ7pdtruk3pNE7pbkp313QHRgJsi398FC5ehrPtrbC0XznYC8Pw1bsXzxmqnLEZN43e5y+9sL9p7L3sZ8oHT6GhnkyZb1ZinhCdpxn4n8JF50zMFpB88Wxk6BKejmfnk+UIKEYMVCgaCwfwlPtEwk/620+Mzd7zZ+/7BrxF7WTA3eFOuJOrJ4qiQ7iT140BJLd7z973tZcpyIywzae50oBOhRDUyHf28ZTqCe/Hm5U9+8KokDUbbVb2GuA92BckYhDyRQP7eLy4MsgCuQVJ6GZlj4urQF5M/EhTNlvsOzMso1h1MGAdaIx7Md6ni9QzArI3KT6AjnyQqEF0pDW3j63ZSPcyKhAO3/X2D5TmSPhq/8UBtCt6Ffh1YKJyJsuZO0efh9yZZdEpEfXOsKdUWsMelFp7GslsSxy10e/cZ+3Xvvzmtqfs0yS3L1V2pJ8GEwYVe1KRTj0Lb7b3n232Xm72MXpCKLbcbAPrcbPyeF98idSthtltBVE7iNpu3YLGX9u0Hb/m2Z2AOp7b9Mw2SdSo255kEFoBZIIB74FMetg16rS6vhF1Wt2m7fhGOPwrUDy5EmD3a16EuDyZJeIN6y5nyomBAlsdsEVB5rxIRsE40/DH8ioK+FFkOfUo4hLaAWoqS7bt+IHp1Cxy7JoVNexWwIpsnm227D9DZ7Rj1WwQRYF++Tj9ZtMbylXUSEFmaJMGo5JV89NgblTELVoF7JUJvGgx60AbV8Sf8BmiywuFLWXggeVPyk6uF5G4dUtuuAaDJTa2wSeIadLzwUx46aOb86vBbBZPpoP0I8W8NOO54fdvoU46mA3mi+R6AKJ+fjmkT7s7r+nuTbTzOsoD3xu0TOObwaeYvUzJevlptBzK81eD848G9Lu4X86vYmbtTge359dLgihhfgd/TJIZJiPnd4PJ+HKGtYpyHq5BV/HtZmWP2ZpGRVmvgPsqrFa1nGCNGMWzhP38JHNx2oaQURH+pzA7wSG8mENXLrncrOztvDYq4hUK7qCWExy+2TfTDftV0m6Qxpfiowgu28DrG1Tg1KhCgwq8huG6GMx6u1f9Cvp2yAsRO5NKFnRbSebUm8z7FT7b9gbpZNmvUHqFNEoHfMHPPIF6waRC86Q3n/RpEVfShW4/nIqMCp1P4Cx9YFTmdH7FLzEql3HFMLTjNKwSw8t5HyzoZDroLT/1abKcDthotze/HN67Q+jf3t3yU3+zsp/7JcMsmyfTa6UOTosELBTDMH43S4VLw6vQtchVdLklbT0d3OblsAmUcm7FXKVJcjlNL0kD3u6NxtAZXi4ufjAqzMjOY6ChshiPtklyqUx+wIVHHSFQvxjPRsIzmo5HBedXn4RdYYA/qzjhvcmyz9SBsvRC80+vxxU23sKLCHzeRcLvJKYMwStWvhT5HVImjbWUKplrZ4YqYbOyp2SUem0YLseT0TXoVMXKnyRzZoLgCxdJfmcwGkFqDt0FSDi4LMyo8+VoYLDfsJi9Y8UL8e82XfC8uxpgdZLF4NN4FCeYV8IcYTHWxVxaUtjO8PZlSBqCX51bJBxpdvKWclvH7DhuMI0NGI+NoBqfgtxKptfJDDM7CzHBezVIB8wn4cdlLdis7M0vh4OKURGzr0k8+BSPME43K3u7b+nNLr39gb5/a1TobrOy9wMteXmo0N2ugbRPmNi7tPM97b6ltzs7Br3dfU1vd3fp7du3lC1qBr4jrw0VmhitJBMZo4jXyZRG8IGGVXoSzy5hMLfXu0j7dDWmSWJUVJONU/1wtvxjbo5lHMZGJU2Wc/b6N4/PF+lVcqMSWIiBL48HINhVqlwGs/HUYLdzo+lE34kvsVDyujf4NP5KsQbdDD6pezyk7pafsGTC0R6Y9Ivkbnm3q1MWqLfXrK41M2U9Y1S8ZtWs0OkPFTo9utfMp90jE9b3b3d2ik2OG6e7Biz9JkuMIRiTXM57g7h/l54PJrH2/MfCtpQ0R2cazy/jQQXrEwcxOnntUisaBsnoL0ssklfJDc8/jKQh9odLYVPGI4M1hpefaHED8QCWvUVy90OF7hbJ8hPxiJ+IxHgep/HC4A1xMrhj74HpR/iHTbFJoAZsVQhpY7ocKiPJ0WjIbLJUVv7zJZSgh2PsFQPopQ/OP04H8J64hD/Swez81yR9qwN0nTB9ACVu2V/Qpt/Tm+/R7sZcDoXn8+SaKQvoImEFnIwRv0rm41/BQptgVWGFCu6qh9Ir83i0PI+Hd7vEfgrnYN7BHR+kKgSKCC/+4fXK8jWcLOEd8nY4Tz7CDyeafnnNPgFBSV7GM3gkxdhJJkueGcAKvx6wASpLjOeDiZEmF3DQmF4N5hA6slgNK/bMqPB2H4/w5ecxCQYE9NbkwkNjxPPvMtZD1Gh0fOLlSEQ6SzyLmcdrDo3GaZpMPsV0MRjFTGPROIE6u9F7vdvHEg7ngpI3X1vEY6R2fSgkFfZZuKqF01dMS1TCqLDjWkNVsDdc9C8uVOThxS8Z8nonRlhqoRQEmBt+8XV8vpyMB3Pxbnq9nAgTO42xhS1kPZ4sp7NU8DBSQn/JkFYJXE4hH2eoEHfSBZbH0RBRaVF258ieHHmVGi2xosa3yIA4941qaElIhFT9Qc3yN7sGTJ14aTPyVWOazBJiMbzsL+KX9NNwPr1+w6bQl0zEFMZWRa2q9HE8mazvSzzVsmV3Or6Vu3jLIoGoNk4Krjnn6rMkU5rC4AAedONfeG9OF3PeD7GG8oeDqp7rITUas0fWiSzPC3aPKesvDwK1BYLoXub+L5m6X5xjDgr6PmWLLeScikBBh47ZeHgOmojXd76vVgV2hDmcDGYfxVMtVqHhYI5t8GoEUi+ZggdCo+X0Wup2OR9cX1F8fpXQ1ThdsEqC+FZVMm4u6HoeM8MijRf8wGA2mNzBf6paJPmLNPExvYYIejyNDb59Mf4UKwolFbPnr60zWABZbxBEn6Zq9EHod46fynpy0xBfbWxCnKXRZlg2erllce54LiQcE/e1lURYDZ+xdYUYfnz/hXTwhy9GOCQNLUNhtWTkfjC34Cicwir7wgRqDHsW68HYA4f2Fy8ohPPNXmVv69XzUh/+KPi8/uPLcn5ef5KZkxYcLr5H4rPwplzqw/k77v7c3/7Z2C5Ess8spnGbMdCA6HzARD2BeoNCG2ALcz7iptsG3tBXrrtZkQSNHQ9mDDWVKtfbq1hThaKVr20xuZe+GWXnSUGhOh9MRElnMZheR9NUgKngQ1fBDcQ3g7t7dUxxvhvoXpYa88BCCSvF8ZFduVpdjkcMYQU2A7ftTblvlLSbtWKfKd+laKjedqlfEYemr3Ew7A1KF7ARktw6Js9k9/Dkdf6k0RtdTPoVdici7+QWtbXHYmfgYHRugjPT//zl3UF57+WPpXsDQFkYqwGQwRzdsNMVYBHBkhkZXxV9422Fr/htVatpO8S/DbtlkeXU8cfhIujCQwALRXgFmACscjvihXhHZ1fpLPrGDytIshT3opIhHQiji1khmDXvedNkziDhiKGn9Ioj2Xu90BMTamnpcAhfm9vhNj2u/EYHL+jggN69Y7tuOPPrvTt4rGz6z/qGnnI9etHHpOv3Ng1u8pc/CivLhAWx1aFqyzXrVPXNI4sNMuF70Kz6bqsbWEaFaqZvUe3QtB2qHYIFVWtZJn5dpMM+EzaZbrvtOlRzHT8geFuBVWbL9GCd2UCBDYce+VaT6tUW2U5ALadJPv4Cz6C63aa6S3W3W0VntXz5sRuq445sz3XI8lATy4PRpHViB9SwrVad0Kk+NWDq2XVq7NmyaQXUdGHy2HQDl+wG2U6nG+DFVtPyyHZrQYs+WKf0wW61qGU71iPJAWlcYOHygVqu06SW63aoBQvL9gd8vGO2LXKsk4DcRoNcB9+GBngk9XqEQh8FdtvyYALesRxyO6jToyoqL0ahHyzCuzzLhFgDH+9Z+PMD17Nw7bZxCbqeQ14bb/VQAa8Lk8+WVQsecZ/4h6YHbtmh1WqRbzvNlqXNPwMzgB1pwGEXP56NxoYRKOw//VM/sNoUHFoOcWUpcCnw8EkBmjo47VjUdbgZuk5gt6iLF9CRbR0/6njowGPTDugY/XN8iGl17NmBJd5nCD5zXv64t2n0z/b2yltq9r7Y7Btqx5nHUx6CvbOzF4aavmdrjEpj62yvvMXZRgBtwRw6u0jm4uthtbyLZM4eM19he6uwc6NHe/0CfADMAZ+86of+Flv4Pwr97Ufj2SPAERhwNftolAiXczqKbxdaA1Zz/gr6iqLRNUsWXJ3xRTgMz2h/X7jR8S9Luox/ocvFnCbxLzRJU5rFvxgPVXl88bfVGHyNZPGIl4iVWj4KR9u6po/Cm+1CbfkW1xgfTIXSNyuPnyi3Kvv7BnyWcsH7+/ToG9/xyFivoNTvDKtl4SON7CvlxlkaL8Kh2KnjS7fCV8+3w9KLM4J7ULiXruwbxVRtP8qWpL3Hv0X7WL02Xvbvt6Nw8VRD/nXt+DujjiUrvA2F4ZM+ShBHNWgy3V/sjunRXp+eGXswDcW7wyGVOFQCFQFd+BLz0M6wXe2F/vbz55Xeb3sgMp5X6HHobz8Oz+590HuRHgwV4MYDdUDkWx/Qe/GeW6sPd8CvKvKLZtiH4OubuBphHxgYYT/Lvfqs4MD8FSUImqdAcUg5f91jDL2haYG9Pq8T6XZ5axMOuTJPwhSGRlk7EtYaw4ppMJnQYH55TsMYovrhXUyZ9qls+VczrT+MXxwlzhcTgirzKD6f8LFAEQHjKcFkb8QWT6P0V0UTsJbjaHyBecYUwiJh4CXIkC/GCl2RiYZ5MqVLNqMs4i4p1JAc+SoL8bkmmeAPiwxQqSQAu0CN18gX5JQQjMeBU3UNNtvFrRAhRUgmsH7FkCYtIjSlvxZRmvgnmseKnzWPJzEaS6Cuolx/V2wT50qUrgidOduYQ0uDL+k5pb9M0M7pLxNwPNN0Jme1HOMJ9Vf0UXoHoCewL8ZTQvYlSwShEMEQrJxXgWkpUkpIvOpfzI4dlgOva5GONMyWb+VCQ149QBCFr872XyiRoZYeJHO6TSA23CyakRvFc5Mk7RmrOTa0l6pn4p0q93n3DE7vCs9tbPAo17LjjY0NNbQ3+r9byln4LPys/eThcPPlmYEk9t/HoD3hl4dL21MFrua99wJujITtWwXJC2Q5+00Pb7a1A/Ubrb3HuwjjrAFMhalfBR0qZ5dCOZSNo8Vgfgkrz+Q6ZgFcOJxXcjCe8joOj0Bf9eXoGfW3FEoBOgNHS6EYVAIJnpxG6gXMlyzCN1tyCt4WWWvvx5f72I8yINT5YuUEoEwJID7PBIEyzZdTAVKjiwQSv1QUzOaDIT5/FoMKADwaHwESP46HGeG/hmQGxY0MUViP4XfhzfYBk/KlUnY0zve83xiraR+MejWAn784o/3HcpQOK7RXOOGHw7PnlfAzPa+EX569owOoByjFgxRqB0alF948U0fb8wmEkc0Wf2CzhdWi2VrCxkJMzcazy4jFGsPxQtYygVteQqakLBgi5uWzXAVWM1BzUUwllC26jYwdy+xIplhg0JdhMbPFlqEP0cLzAmec3tBbAkdMmDTTwWyEAn9ZxqzUEDFHJlIoteMY3Dh5zbko9H0lzyj+ND5nGWx8G59HUNUHGxl36eI6YhO+SxqPSInIcE6fxlP5SgRYxirR7LPEWlDx/Qz9ZpGiLeJ5pERDkwvhT0m9PsbzWTzJqwlZrCi76qeng+tIbFKmMQRfKqLyC4g118SoQL67gGQNX6ZqDzFVcgEe+aU8ouxrUJL0lxQkb2P8oGGthQJ46SSspkY4VJwPfc8ks9r0gB/kWb6vVA7aHRQauJFVb+Kc2LZxArLqkWd1LDMgx3VwikHYIBMKV9WmZ+K0WfuAs0S122hYXlTzLDOwIpw4Is9q4vhW7dqtOt4iZyrbiVgRwvJ9KVSpRUQN0251PYv8bq1m+b7Bp1AoiKHKtZ+6tmdFzVbkVv9k1YA/ZHqebXlUczunyCIVwEd4Vi0gfIrdNvlb+Ko+T7JBBNqwW638QclkUNvkhlCJUZbqfbA8attNzwy4KP+obVSittXOKuSYgX1kRR8sz7Fa5NQ902lmUZwO79dS180gz2pZpr/ygf5Rm3vSsyzUitpWG1BfbauNmlPXaZsdgwLT/yDhQmVYmUTOcN94Kbdwx25ZXuS4QWQemXbLxJFdJUfrPYP0lhUg4ATWCeuA1K0ju2b5fBj33A5ru0b+qVMjp9uO9N1OywwartdGZ3csL7AtnzyrYXmWU7Oimtt1AoPqVic45LYNLKdmt4wKyfM8AtRordqBT2ajYTt2cBrVXejX4H6rt1N6249qZu1QTvRRx/QCG4d1/ian2zYNyr8RozKIbEd1kJ+3RZ5HOBhRo6OVfi2nbptO1LKDoKV4F1HN9dCqtutEfrcD2C+yTqxal1NqZses2i2bP9g6CSzHt13Hp2bLrZo8+tBpmIGoNzgXkW//GYyb2uFKkI/wiBt0ZHo2qhd1uAUxRwM3MFuR3D50/SDqOnbDtuoYEq53SnYrOrI8vDqbC7v1qG2e4NWHlt08DOjYrgeHBr3J0rk7aPVuBL5HpPvCbNlNp205AfEzpueZp1JpjqslQRI6dlA7LD6hGssAv+bDSrMrHWqrLY/mUW4EVbsaFp6o4Vk/dS2ndsrd1w0sfHngC+fKdILI9JqFWLFGqguy1uREvMVstdyaRDGE/W41anput+OT60T5gLSOLCfw6aeu1bV8gzqmZ7atQJfesTuWvJxnPrd6IS5Ts5Dqm5hank/HrvdB3icFcdwOrHZUt9t6+OSJyOPTenEGf0jWV9Ls1LadCMw8WZ05TX0mc8Fk+TqyaoHrRdzf3M6HpqdZeY2WawZ0aLYawvQDR80/5E7EAoJZmnViw+06dYN5ZrVWVMvGX8dkjXlpR8rmKD+8Oqupeho9kMSLhZ+HopbtBxFzFn/qmq3WKWG5suo8UNB52RqULz1oAEP6SA0ns8Zf71m+5R2ZAbdyx6x9sAI1rQormJ51THjxIDIDt23XCqP7/mooo/heRl3s/Tt/X0cYxPy8xspQ73gu88rlajvNiLmE+FqwhdEtPIzxGumKfJhzK0oh+rt1mao11ZJTTCiG15Z5xdosLKrZBItsp251LKeOAdJwvWPTq+e0gtoOpZ18WllZa67pYfP0sBmorbuBxfRrKcIxNXggYMcxazWrZXlm4HqEBYCiWqdLUa3rB26bIqXXSVGz0zUqdGQ5dZf3U7vOUR7aBtU9+8jysqHOKwR3XU7I5FsDuLpdtX6oAam21fs7I57C05q2WKE0pKBIdqOG60WyMmFvA1eX5wdTO1icsFPaDjj++LH4Dg+mRkdqyptZ6zTyMH+telS3j+y6Ffk/eQHVLQczoNE2yXYakWM6xNmY1nIaeUSVnSf82fJc8t1GEPHbDLX68hCWJNmYuIfzbUR1nOxEVsvCxJA7mDOoNV+itu23zaB2qONYjdT+YtX1FobFvG13opZ1hP2e13ZedX3y3GPZoMhvYdxLWO15mMuObwenZDtHZssWgtRr8nA9AS0sVULgyGyBfyHWDsUpKESwCA/8jLKVzs8oj/y2jAO1SKrJmK+VMpFUspShIrxDcv+r0ZeNAL3fuY0GpA8qxhuJ2g417SizOVAUcVS3RF/Z1Qmqje+lczFqTMpFtjYVrlu8lGNiqBTedtTurz+9QMNmfYVNxOM1WZZsWX8KFCVrVWtiVWYY70FqGTpVq1thA1DbLUl/cStk2+s3tmDZClT11SjgzaOmDlJ8oME2BPLLk73edVqnhV1fbdZINVbOYIpI0VODNwys5kcQYWVlYjw23DWCnVuSd3VdkNrT+Xxld1brBPFRLaAjt2UGdgvnADMIPLvaDayMDI7WSB+dvN42eqjyCsU1wzp9b6Vdu98JPD+T78k4uDcgH6QCEeQ1Lt80ZDJgm1qrst7/89ryk+pgxvOfx2e+sa19nJgkdXggcS/ktdGD7t7mtlqtlReulZ4RvqtdicR7By8ZC61u23ZY0x6nPT7ky20WPRYHl1qoUGU5hAtBiKHKxG02xU3fd2u2Gaijgkw83ad8ss6ycsw9sryW2aFGy2z6slI4biTjP184OJCPfY7mo17PH86AVVBqjm+SRpRqZLXlmZ81RfG0vlPXVzl7ZLFipt26vhYzvanzvDBIrYcPztT7pMufLaZDNBGyNtbVa0XcCutRHusuE4NIyBuzuAYopkLh+K5mccCmpQ4vnNjGXOzWbdtnGhF0WLeqyTz1FTzfHdeJMraM2w0it8HHPLxbnQdB+HW9GpNqdiej84Tg/QrhK9RLdoLl4u6RkTyVNbkpZFJOHuXk5ypNlLEVQMTzUl0HUePxdGrbwUNLnpGt9+BvYL/Fsi4brzoUqYgm8dQKVtfbS3GjiFp21cOWHaEFjUrOs1o/JeYnbWq5TdLbltBgxtrO7ZPdKm52/gpPBGHNfLg30rh7DN0aGXX+MGWgydPsfFo4qWb3ZCC4Xt3y+NPZQimyHL1Tqq7JE77Cp1FcCI88M+Nq8cQRlQHFgfGabJQJLWj83JLXvIXKg4NB6d3qDbjA2cHL2WhKf6OiWDmt5TJbQq62w7RB8T7oUjE3imqu69Uf4C5tVva6jlHxZe7YTqDVNd/sGuSjgEKioYYeyEfFj6TuWh7oeUY7r/FPX6NdQ2Xj0xi+7rvvvqPvvv/O0NMAaTvRa9qJdmgn2qXd6DXtRjsGpcxPTdFqKTcbfm+ZpcvGLFXwezvC/wVMwCz+wOxnwAQAMS67xTx9fgA8ftwG5/0nxXWHHV6nyE5X1vP62pgnUzYYFTRM/sUSiuubOql3yiW1Z/qtnfF1TCpyzF5y9qrj2WB+R6j3wp6pJzAjfKUE6gu3XV9XawZLWvUF/nJYZ55/CjvUOSOlwpZRCxLwrsF8Po7nsOn+KPx7lAYrVNiH81de32VtAuV9GIMFCX8WGKLKqCBIJIfyT9mARUx7cG3kzSlPUHt8CfXgdjwVcKcUDF8oy6oGcth2WUX4fYMRMTKssV4N/XoD2wleCgjl9gCAt1OpQDyFD4T8ldSdTQfXBgXQwOdwVg+2vG0k0kipAdSFMQMtAKC8ycoVxQFhQ3ygep7D0tBiinmYpAqr1a6nZLM8gsuFewMtlzAq/Jwlhm3JrKF060yRP+F7knlHiTaMChUKxUfzwx+0HMWcX3IC//jLIcM9cARgsFnMoOx7+SYGnwTUe6ChmFW5k8lMeAqpCqtBp950Db3OeMRVEhTc1ADawEc9vrmvRIzuxQDjMNZaMptH0oLSUHq65N2jy1Ov131ustMk9LwBU/W1sjvakaMy/pVXrLydX1fTkv2VWSrtulnZ84/anYTVE2AsfBufr7UlQ4IszxfJPCsom29i7W6wsfgApjR5l6r1Z7429MLh8/CzlpU/D79Q+BlS0M+9sy8QYBOk2ZATfwl9BnU3WPz9Xsl2X98qJeVtgu7k897zSp96tPcj9EzfHfTPWPHneZ+es9sYY+v58+xdz7mEyITRxCAlCSQXFJmLBK5koypEoFGN7Q1uKWrCPgPp6H5ZtCInUeLfSKydIyVsjgQyNxK0iSgSjMzlIo4iGqRTgsXZikQaktKv+f9KMsXjTEatfX6xyjGLqLWuyUw0VbXQVaOxZWJq8YHLdiIFf1wsuhYnbFqCfXcdj+KL3AkXKxjP1JMs1V71vAXTY23oLpo+7B6ov7XxDn6nEIF2wYGobO/t7Rtn7+jg2erNvb196pFSWd3arvQpLH9+8+XsqfYG8Kq8peD8FZQ/eyISBz+9cFn/4fXrUrisVxuNPqI1iTYajb6x8aQX3vxD+Z/+i/62DmxhsO2XMbrKBuE3c4OGPfmKvhvTd8f03Ql9N6Lvzuk7h75z6bt9+u6AvvsTRd+dR/gxMuddKJjLLa8o+PZiq/8P0O69l7GHX9abGm2FZXGuIOrA/8DqwGTpkFGhf6B/Sv8CK8pf/uGeTvf2mk73Vx83Ku97pe3/8//7l//BP/l36X/Y2Hx38PP+KB4M/5v/+k8H7f/tn//n/+V//7/s268+eP/pP/9n/9k/ufkvHvd7P/+r/+u/pf/wf/zX/3e/9+//z//qfz/4j/+j6L/6f/+Tfu+f/R//3abx+cu/+X96Yb/yP/2vL8s/7lX64baAs8WjkqhUjcIehf1e+SX7shnO4yltGHD78JRVFo3y9pmAL2Dwx4JTwMAH22OgFcSzkY4pnfvxhbEG2/A3PAmtMoy2zy/7qgilOjOC2gtpVxGsZcfji5XvjIJ6z1eybIZDM5X3Zap8Zsr4Cxac8Aki0iSNxxdAYBA/BhpVgbXMGXVfcBU6rM+l4C8EQAHIIPCEoCEUjgtqUar2qCR/U7jJujbDdSXzXjzqQ89chsOLK6iZhyNWMe89f/H4ab+iNc1zZx7vDsR/RxiKFkpv72y/UlCqYohIVqxCKeWXP6rJK9rmLKp0um2tv9WwT8CCcusunZycZGYK4bO+8RRqv72ggQdF+Uj8FuvmuUqSj0auobRZ2dvbC2/kw6BlrzacEhtXLqEHmI4vUxiwLnkzYlPeMXD3xhezCpY2Xk7FssiojC8IOtc4keIMZjBh9wKFD0ajiJE6lRpMfHs9nq9bD0iOeHY+v7teyHCLrgazETY8eUByCMYZ8D3FGhPLenItRlN0Dd3edBGLLp9g6swHN5HSs+IdRb19zouzmLhHvFkDyEDF2coRhmJX82Q2/jUe8SoeiUmbGFWpcgyMW55ARd0v+WjWDaLBZDCf0mB2pzSCZM9a3anExjkzo1jfq7S7Suw8bDPxEJQEulepmGHsZ58kO6jWOgPllFxQcj34ZQlXlAveBrlk0YFU5jN6tzu/ivlB9oojtjTpcjgDQCg3vVibj6cxPPQov5IxSBt258mmFxUSk6bH+3D2wrpa+xXa55hS4WLdrHCLwlf0G4VnIDbYcKXcN973wpuw3N/OoUlehVuaBBETjlf0zOhFz0TtLbw1X5fC20ajr9allC2U8mTtLK+3v9dXbk+Hui3FSku5/4PvP2i6bxra7R6p8v6Gd8HoZv/AMFb1bTXhws5LC4bo9wkXZVCj9WRZsU77KS0OAt3xYigDk3KcKgsKrULYZsqr02SBOfDLcjyPubdZ3+4bqnjAJ4E6nmCU3E4nhiyc6da+sa6Qt7cHP+u9x/v9/X3lvOgFnWmLtpC7rUx7BuvjqWXwXGPvxb9QzLhp8S+f6HJBl4D+hWuplIDWuYgLK6ZSRZVCrsXyljG455cKwfv8Er6vxtK8ycdxrOZDCp09gOjCMlP8pn4azMcY0yCpZU6pyt2RMmwTmlXbt7Fl2yUsxhh+YHxOgn+sp4lQg5lJmW4zbZMVCnJR+Hn3C4bJMybbmVinlSBfoYmq/tZMvp48E4M/RcJlerF/fYHYgHWZ4pZyo1hkpvQKEhxDE2g9ardkOtTI796jymWEa23RbHSvKo2uDej72Dgr3m2L41BeHQ5fD3uvdzZwhhmKBR6faTa0BZ6KKQs8fS+3wOuFI8QZKwV4SKPCk+qxqooULP70U0bvYjnpf37Njr7u2+wxkhGb3qkm2w5vjJw84Anz4gXt9fbg6kvTDz0orYpRGr04E/Sm39iM82cmnNgX4s/wAXZssFXhr6LunBphT62YCnopV/KfpWNG72GPnNxV+OGT0zCGr2NWXEXd1VYFDJLh3afBBAHtahnnLMDcSKcu50BMuVsz89S9m9t5rjhbxlqmD2ADnK25VgiPMQwG02SuUsZiCj25Y5SBZLB4syvX79/S1XgUD+/S8SUtK2Nmlig2oyBxjAfYBUfw54CKF20ItHXpeMF+loEmzhAQBeOC5ezjjLF7YR+NXfQabcC/mNWT64XEb3DRfqyVscGMeVK5S1NoPccj6D2nEyxbzARgZA1Q2dfj2afkY4z6FdZrvqasAp6t2b+k8Xky/AucaV7H5+PBhPH65tD8n8aZi+j4lyXcf/AaB0i+8a+8URcfyc+rhYUqvUu5cxfc7drXReakG5BF+ekVkEeblT2lUcsr52xR8Cg9zuw09fliPmCbsFmS+7deAFp5OVOgC9lp2AjLYq6VzD6FZczm8bLf29l9+0O/Qsmni7BcSOBpCugGmuNK87c0/8GgyeicHx2/1fQ7Zv603d+hsAxu7PiHPGs8YZ3hlXIpLM97b3/A8RkorgOjQpgao3sVklzoSkoXKCkso1Lj+/crBFMAKeHB2zHjysnUUcb/amlELQfMWwrLvdelN2mfBhxJjQrXbJKcFz4UH5gylEJYTj5dZG0ERenl5KHkwWj0UHK60AXLW9HM8cVgdqf6nq3naThZZA/pWtGQMQfWEy8fynn5QM7lbJjccmwwu2PcHcawGk4+Yv4YbJ6EduQxh0LmbEmeFzqLUWIW5yYa5Lfnv8bzpBCFEXghCuuMQhQrRBaFUc5lXrCCu1D3ruaFEamGFUdG40955LzQYpRjjJ0P0oWsq5MRvutiMYM336z084+8s8Q0GaUX4oZ3ASQUoWnA2Zx+lP7JKLrzywXPi8H8ko2itPnQAgVo/tUsvsG6AkP6+VwVTpMRm6hMRvymcYo2ULRgukD2dCHZeCEcIWUyAhDVZIR683N0fo3082v0m3Z9GpZT0G2UXokTT/j1BDkH9Di4/YQ7TwB9n18u6Bx+UpNbdrCazGko1B4b5L++7b0u/TFnXephKkmwfBGYyh/hLXO/D91c3BX+UX/7x/JWGGJLPoMJoLarf9k39vZg97G1/biy8e5g/1W51N/eFH5AiUoHVDo4IFgMlfHDJ5Zwm97Ru33ah0HrAR3sk3jEgR+gS/aNhN8S74MpIrC3Y8Qm2N2VZim8F8A5EDyysC/GkrhdUHh7oD1LgDsY4BCGn5ImQSVyBxQRhMT/E0LqDMlh5eAJQRzwOMCsTQ4JP1NxXQdpmpzT4AbQovxbAk02ZDQHODOZXcK+pYSa4opewxV5xihqfLEoMahKHhW8c8TR5xk2xHwwO78KKzRcLoCjyGARPP4VhYEGmMe50WE8mJdW2lFhiPJ1KT5KrhVECUOC5Sg3oDzPB3zhY8Zf+PQtR/DBbDG5kyA2wdL1PLm9y84iYUWdzIVxga5SIbVnio9J8ZerrSCZuC2JaTGzkjmkCYtRfDEdnM8TDgi5gBDDF4/iCzaenvHTyUyyX88TlmhIUDAuRnBJwef0UXyh6jKKL3hJHjHseA5mBwiivwgO0Tkui/HsXPHEYfY5QmoyX85olKTxL/gFQM4oYYwMXDPuOSMBjebJNf+U5CQYA7M8no3CikLZEURIxiUKK4LvgesFg9iCe1HCa/L9bcQ/JdSDAwwtNBuVQOSrh4RJz6K1ixldzLgANhWFPdllPEvvpsCYwJ90YUnGzdUgveKpwwFMnzG8FAAxJqyoMJDiLmh8UYLh6PiCB3VGIZbYVwZ8oMMDmTBm1exUER7uKixjfTwDrbUoCYMki0HaqCnNsJLzaATwiYOpwlIezyCLmC2Skhw8mQZdwKnFeEYABmP/nR/jO8aUVtewQjyTJoNf70oY7xLAUBfXFPHFIlXWsTPpBDGTHaeLcEusZfFTYg4ToIox3XmhYDQqHraxwM4XwqUdmg4+xqqmHJwJrCYeuS4pJLXp4DpkMy3UjDEXB7clfMo0nl7MFJgZ/5ZuxosrkNIDwWcczyRfAnJ9XlJOJkDGZqIGbBthRRkW3vCkEwPDMbqZqyMbDJauO05alPQInSWLfYKLirQk3S5BxkLlICPNpCV5ZVoScpzvANpwrkKC8jVLS6CYr2m2uMIfD1Ag6DAMOHz1gDBnT1zXcPzEPq0TLDTXgNnBupLbIs8WeXwy01eVhrgOywIha5cM/+ng+no8u0zpl2Wy4J9Y4Yeiy5jPx4hT87jEU3Ael5ixmiLEPolY4qWCnKp5hXMZO5n9c4nbex6fL/EEQN1AI+KPJxy3EUghZRatLiW1+KkYcMIEflwuJR7hmeG0BsdU2Gqkm5ubdx6ny8mC9zKul4CmzWXtUL4/8AsosmRBc3kIeVPGMNeQtXKRN7OFO35KALiXvL+Ufh0D3/aXsKKchC8ea3HgZDm/phQ+T1KOJ3Psy3yNRzyC8mDhBhcjB7NSejcdJhiv7KKpNFioAE8H9LMc15BBHdhky+LCl8MUP5/g05zLobw4LOeLwceYf0oYmByQ5XsRZ1SdsHL1mqMDpd0RYe3ixgWVHFaYB6Pkmde0ZLfSaufE0g9+gVjuDuYlrMq4pnINK5o9LBduUgmGFWYZ809JOo+DWLE4gCmMxigxtYv9IZU4rxUcYi9iElrK5LmdTrjmuOJdIPvDCv06vka7/ToG8joLp4CQRM8MhfoEiPFMOth7Ve5/HWaIMYaot1P6Yz8cVebay/220ZtMZxrRictTnL+NvgEM9XUaM69D7+n7s59/y5G+XvYLzLxnfdL27M80Fy8Df9LATwJx3jY/WBGEcuHNdqT0d0RjXqm9RRDYaP1yqBUeum2rAx3zrtcidsmhtKkg52+bf4LVRtt2cOmwHUAUHFvmB6XFYzp1z7XrZHagy1t1vRZcuYuKn6DuQP/PF0s7qkH7kfXSFGgSNN0D21FqqAxPBF1C14F6pu3UWt069AI7rKuOqrPhzqkyD3SdKCuIkbJbrWKB9I0C8uyCKp7diTqW17Z9UcTUuTTIuFn7YDahTKdvQL/ZPiHfYp39AG17bHrO79XMoFpg+UGmX3laqJm0nVLhVDFW/az+2cuT/+xF3Q4rIWeGDYdsE2vXqXZo1T5AJ1HnFmOgruj5ix2DTrIKmY4sD+PgXoJ1EnhmJGrJta7Xyl/JJjyiO5nl5SZXHWSd1CwZZRIXQxIJd6Dkmqm4SxJXR1La5ond7oqaNqww0VxuN+h0lZGKvu9021VW0s2soH3uAtthUz2VqwOPMw+VYrW5tSK76QBRqqMUeTlRYngGeuyFZM+SVPz4+lH10sI36xT+aoNqR36ku0YiuqGP/PXOrMPATetnS6xtBYduXcI+NKizUFSrm/5hIY6vZU8geRIbLUtHZn0F/Vtq2vk4QRh2JNB+brv1LqYj0lTllMVWIUVX97CZlXHYXL/ZMqtWy9eWBR3PFRNsUZeW1s91ljPznUz714Rhy58LZiwwPmKlVtfxec1QFl4OLJFapxGrN7P6NHXeRrWWzbaAb7Madt5mRXXerlfW6zqZ5yE16/1aJ3uWG15W0sKUFX1WXkD9IyfPfOTklT5y1l/Fg5EB5TiECmNkBJ7dbLJpU2CRbnlV4loJKqq1X1lTGKrwLbPr1A4tD0rTp81j2wEwHOU62XoKdMzgkJqHfomNMch2fVLK2is52rbTPKa2f1RjsHra2SFALr+l71/TH17TH3boh9f0x9cU2XUL2AAuQOAySz0dAO6Bf8qmoqyHz2ta17FP6Nh23uzit2bht+4e+1HnEOr2OiZwbyc1t24ZmZeF21ve6NhUqHYIoz1VadhYZn3DegmZiU1uKJWb3XTqValMMUEVVdhxZGGLGp7bznYNXp3JbosxHF5stzstu4pmzCywotzwUloXit98g40XGmYNPeY0u2bzgRtfe0LZz9g1GM9lK4XjRr7Lb86QDlxpAX6y47k1q971TFnD2/af5bG1Xs+/eu1G/k2yG/zjKgurlKztlMGq68PWvXZoB1Yt6HqWT8VXZ131YBd5wN9rW797g0sQ4D9tnKC+B4syqJYOQnU3cCzY2ihld6jtP5SONGXK4CuwAmwcDyV7hcwynKPMPMwokm01DIgosOunuQWjntVU63RkI6p1Oi2bLaJlbB4fmkF06nax2q+2m+sHoFOObN9mw95T1MW3ADdS9QPPrAUwlxNEB7hY+2BFwK7UNJlZP4JtVJ3Mlm3yRmp6QI6EDdFxVO+ia/MdQt31SRGHTPABLyB/g17BzI6NP7Y7QLfDaMoK/KzvMJaaXZv+ZHrZNKohUZnptuzq19MLZfDA9322c4BxS9f06llAjT1Z7HyrBqoIne2rlA92J0L9FUhkK5L9Zm3VyYebGQSgduu68VaikbK3IrMbuE3LEQwREHkgHl3PbgJJgD/JZ+CDVgt2yLLlsIUbqeaNGm6rDpMojupnDC647db0VVsB8RjqeJaYPPkk+ZWlh1/YHaht1jxXGdWggGwP+3ol5K1eraavRQsgnZR1uoqvlIfErl3T1/XnkVR8HnHfQhdwJ2UWSWhEbk6xjcyGojSxxx1aCGOmRNLoKvnYDg4zkh1tkBe5ek+X5dQZ8QSXKLPhUsgi2rTJJ5lNjquJKEGBzdb9SC1RPNvNwMYmnS+fGCKu2yJF62IQ66DtKMTSfI8TX0nZNtewTFlIZYnLSJ9vLaUozA/Uca1u+R8C0JEwu6l1gQDC6Y4Fg3wQk2LRJ6k4Ppk4vqk4U2Pd+08Llda2nO69W8f2SWTWWlTzXN+Xr2LCut1tMYhArVs3o4K5HMc7wYkyQ5PNhRPZeu7I0vZa/mm76rbUA76F2YWGvvcYbIXrWCFWYhHwUGzgyNZOTlbef3JSeKQQKTyxkr+Q+4G8davabUYrZzbMVraFlC+gYv/qtaJudVruKVvxFxZaWYIK9zyr7QZF4rVu+2iFehaIshFj1Vp2x9cHwJqm3JT55Pp9Rz/lrBejEnIiR1LgpND1UI7AFjM0xwqdBbSIbxBe8rwMYxUu2NahxT3ebMQo0Tq/SpQXTizAsN7ttkwcUvVxAigW9YwkYErarr7ZVSvMQze/f/uNmydffxTQLVW/rmljGO417BNuLtl4u508IRsZWYpvBcgg638D4DgwgIZm9GI+mEUawEFF5ShX6PKm5cDo36rrEMAt2DCdrcWzNNtXniMVcdY89HlVanqgIMxOh1OY5sxXcjmSKcpHDc5IxjSbE67dwZJ4WuOTptNdJG2fDk0/qp2c0KFlwp6SKya2zlaro+CZmcyu2dmul/OKPNPxGbtAU5Yr5PnXl92V2aYotL+TmIcKd4Ge17mKRLDxV5HsbTWkmcekYn63wTH1vUUiR6c9MLDvbWiru9hKTA1fmMrLvcJ3rW/F3zpXZfNfJ+iHHqp7oW11ZP3uWntnG5nrC3JHEeEGpLWiV3wF4R098NrfORbZThR4p9q6GefjbPevue0qW47/ya1GHRx5s1CWP0tAfemDZXUKBIJwRUgPlG8dwRjJoJDR+aAgxPS6ryeSgjkvtpxs+g8d0b52OssyZGSfkFkgFjVauqTIFq7SimcPwC/gwAHkr8BkfPjsyFfDCU9RTSsxQbDoMJ6KupGtbA/cE16sFa0XLQOaSVjAVDgMW4UdEXg7xZNC2zL9rsewN9R264zpppE99IxESAYP7z7ZkqKgBHQXqKh0nf97Z1ipOCjnLrhROgoTfJ0kMF7ZEAA/76FZ/e3j8NcnBvM113nb+mSgD3fZ+UKtP+B63ntGoDtkpdaHLHBgs2CGMpbxfXjgU6dbbdk1/aRn8dqW4TFEKybysvspUkbDK2SBiKH3PexwckLO5t9KmpDdxSSelZzQtnyfF+tvcRAicbupjoNyeMsjOHBlEZyDsggONRwpHkE4QfwWrK1VGW+RfFez0B7kVawl5mgJ2CDBJa0W1wG1bQj9aNf0oVGdYXEwPo2q1orIRmXJGkfFFfaTv5oXnHDhY+plVjiz6yk+ZXxOuUZmg5EGWDKg0T3U0PMVhlB+jNItUmBk2A7spfzo0K7XLQf8FcFyuC/x6JwCLsuVjhUyuykwCevMZ9NrdttC4hZIU6xEOIgUjkkFwlpRxcWknIG/xjLy76dEXD8Bo9ENZjvRkY/N3g2ycxRjkn6wTpWnb015aZqN/FotMrsnMspqNSkxi6lJKBwwiQOCzCO//qFYPf+QaS/mpPrCMi5sjBkBz21IlhN4pwzForYb0HktvSrmhKWaVQW6Tjo8AwARskd/qaorgaHMx0wP/GVG/WPuDLjDHgsvRF6o4oWDliQUPuvEbGvuzTEQapkRw+znIr9Bc53VkYIXPHVyvDcE6NgzO5nUS1h6EERBHmA1GpZAH2Y4L/qoIsQrNw03AYcKSFEt0w+iD4577BQydTy33q0FCq+0dmi1V9BbM0kJ3Uthkk4mmnKWko9w3cEM9hocMuwIsxcBDnfqmO3CIgNphV9IFXDRjh11sUSsneOy9hQmW5sBh+iB10TseEXuR5IZQMm+TsJuUxXGlMSZplBlZN8o4LZux6hQvo9UrUPzyHa73oP5/gwiztKgwIZBJyyWzayLRqPoXAzwI1boYz9tKRXTxQxRpS3TRTKNFBx3MUnQ3TllvaBRDO3PeHYOXA4kAHh7KXpkiE7GwzkskCQ8+7jyxnQ5FGebicrBqh2D5W0ksPJRfldp4jKwta6hxFgF5xxaXNFVki6i9C5dxFPGvQZYA1Q+5O50PBtPl9MoMyGTZNZzigrmV5KaTMbnrFZ5Mb5cwpITqie59aNCR4/xQq4rK6adcwLXS4WzArK4+BhW0Xh6vbiLxEqr8LVycxpPz69i+LPgKJuCqh5BbVKdvpxF4lRPJaSTOL7WYXFrL+HlcDrWEW5qCYo6TBZhtTpxMxNlVnhi1CemzMrT9WQwu1ziU1Qcj4M7Ec9GsMyBATSC2txPudKYjUSZNJ6NlDYmkNoVeDnJ6OH3Qh9ZW5DKRQ+m1UEn1qXj2SjKQ3rUcURbFqoI/PRySL3yYrL4GN3MB9fRcky64kU3YJEaEbopkJR11WoyaoDxGOUWkkheyaOGNrKu3pBZtpaGLslS2GJSzCXVNasIWkKniZ0SoO1TrWinb10uB/NRFpvHl8vJYA674LkyLmR1z8lEX9VA0zHVZnmC1BnuZmcfV+rCCdINElXeTQRhXwXVPJYBwY2cT4HpYP4xGqTRYPQJ6qfIxTqW7KRRmU8rZxTZjFa11R/9y0L69fz6Ogsvx6tKfSsLmrbdU55DC4uCUp673+/4uLTYa+lqF6frGVd7OUuN08VqVthri+WTFCZG5Lk982g8V/MgVdFUeeF4cNFfu3URDxbLeXwvXa/OKvmhUaZu3evxYnre8cXUtcLlw9g8Ur+fw1DsXs7Q4ss0jqaD2eUkHkXwvErLBbw53KlHM/NXPQByg9joZpC55FPG7+w6uuA2U7AJ2BeCOHjTLhHEIlKzFzKYzcKZTk5/mVs24SCo84XejVU5IMs1Sh+DUFOT3SB41AJwGJ8bIPdzAwL1G3iSyQ88nc8PPM6q1SQkg47pXDqOrPzu8GabsRIQvu8hlP0yHsC29lnv3ed+uHVQ3qLcTehWeat3++sl6wLuFRx1FsEvaCNL3+jTxgY7xHm8YRh5MXAOCkMU6CSGw+sx7LIw7IwK7HFFva9XCm+evXq5t7X97gCma2ygTc8M1mXcRBHw5qVs6W9KrONoVgGlD2jJjlx8yHjrmnBU8l4wWploJIWKCHkvma3OoVll4a8EILTLgqWWe8wPZAndTkcnON225ensKlKy6nbARfsumS15GzPuA4tM55TgGdH0LJN/fOL/NTgLQO38mm1DZgwI9hxvs8RuFdfipZblNINDMoMckhWixEPXY4ki/5RwMKeqWfvQZHzlUs1tud56Qhcpvq2dQloNaKewC03m5FfhZVDjFNsBVVum84GqzG9g8EiqugG4EVWUCLh1qp5mHhmrp4ENDwjwL0k1iN1bAsiNtJqvT8C1OtUaVDsUf5N4rSgA1vkKnGCAmps1NGgWghzS9NVvCaqCqE5J4forN5Wub5Xqtq/ZR1RzIXKqCXxg3SoBDLPGKS0IzfBmt9VtI2O75FlNOUXzrx3wWSBzedludx1bnYlxbuOf0o5cduXyRi5v5fKdcj5gijxrNaaezOO7a/E3a/G3a3Fd+poAgGESTVujRTsC22o7XQFQ9Pjj+VqSY6+KcX5AQ6syjrDccft0oMfhefxj+R1Xhq9gPtY8sKNItM7gbaHr+a6nXINi4LI/TGh68U9Jg21KDLLXwHKobp7ir+Q2SseW9YHq1Rp4w8LmKGUiO4kCcFkFwTxRQT6cStDvVks7hfBuIfxGsU7wBXWrZrdN3QziyJQ1MFhiyeCY6spDqoVK5ljVdYuhSetWy27zIqBDnuJqyyuy6V7U7a1bAQ7v9cYhGhRX4RWp4yyuHyh7p1zxSQy5zhdfODNOUGPnq4L+X3ePHcoUWrKzLlnVWh2XZs0nq2krz6ttm6x2JzgtiT6OwvdULnRLan3lYF2SeFJzQI07hFUzcFCqh6CF7zFVuvh3LSlO/SlH3EapI6fueqljeSz0QpgRiyVQs+wjS4X52C9BkdcjLJx8CTIqrIRYxsbBblW0gxDpOoU7WRmSgD5jPpD8lrRIZY0p4LbIcjtkuf6qj1q/ZgJc3bcp/2yNtC7Kd1qPGJwWn7/q5NDG6sr+bYVVI15g6upi1TMRMDXE+S3/lPQchqsfcV2AHLbnA/Pe5RnLPnJdz1rZBdYSuhC9um1qdFut3KGuDpQ0NrFOKMpWLWraR3iPEjQ2XWq62GSo6dl1Eo0Y8MmQ59BuHpZkcOdBn8MtBt+3Sy7+su+y62SD2W839FoLt75KYqrkiGRDvAWMff6FmNSp85gnnp3MheQr1KQlyPfEOXCnG5SEnQfZYQdsOiUb0JIz5T7YgVNhQczGFQ59bZ/+1PUD/hGpywfT+ZNNHzBZ2NOwdVp1oR0hooJc8mX6AbWq1KpTS7VNy2oE/MPLmNrh5aLmZMuuKgKnZVczRzJa3Ea83sgvyxWVhM1sYph0HcnqcNpqikghJbsfaBRx/Jagrco3tGvkUl08JTvNEkubW+6x6tAs5JMQTi33WDpVoUm3La8JNXXmwVO7Xa+fnp6eMoeVtIp22/WskpIntt0jizJs9Wy9wOCrk6N3UR3QxJdozZFjNXUgYIUC9t7suOS4Jat26JKDoY4fXykgkSbpNDXHX7pG2ukof7uQ93r988itYb8jtw430XKQUNjArlP0Cm22iPGV5bd1Sq7XNB0tqXUDKEaqEQlecaPlHnOAew+LOgNvY7HlHYs6UJJxmsRLaKfY35n2vF5UOw3qHFLHruEPAj3qtLoQPMsE5+mUUUsSOLLEVwxLxWyH15TCOUgtjVkoWyyyFCVCs+palLbuiwHUmw7qwdzx3DbEcl2MGfFd8VPXDdSvT57p1CEEq2uH2kr4ZsKHmuwV6oqbNZEw4MLA0hyCAA4dJnm1LqFnsRu2Ro4MTQWuu2e1ZFgpR2zw4W1i2fE45H1AFmgl8eWIa8Pj2LNECdGzOi2Ty8RVKsOtLpc8IZcWkmfBCbj4HGJhIQPRi6NwvpSYopWwlADS2iphA3Z1DOVAHEB60/Qa5B2Sx1NUuXERb+MsUYFfeL/mWZAM1pWYnJT2r9IslQsEor7V5E1RXUuyFInbcvKxj/nYV9GYoqsG0wNxyaUDvE7jyzIH57hUT0Fl6LDXdUDfc5w9mx/ajaAEvUEOQBTHCngydfkkJVj8aGD8ZPuKinhWKctQ4g01j8pypYKyZkmEDw5ZNtURSpIrl3xJ8DvobP71CZuLbbZKMhIyxTkdKO3kwV2NbC/ef9bcuZd4QiB/Ft4thN9QRuv43XZmZKIkprnglB1O4efQcx2AopMIOQJ2j8W/eGEAeoZldQHsybB8qUAgUlFiKydxK8+SDHUpyU4SHHput3mIa5dFpdr5vN1mGSpOiHBE79bNU1+6ToXFX4nbocAzWXESbBmnxupeLDnCT91qsJRElkceHxl1p7zYd6jbcR0SyQ4UypVfeyWR5T3ryPROxdm9F4CpIp7u8U34yU8qUJyF7KyeSdCyTVKm1Sm8JmFnq9frfMVOR/BsVGKHjAhZPl98Q8wrwcko8jQYdYCtVb+Sga04iwiwgFcVq04dWjP2hOGokZcGVE+F57m/vfXqRX+l+BKDeQiM3SVLN+ARHu7gBbZucTWY5WX1ynsvN43+06dPld/iytOnT8NXn9980TiHHHkqyG7lbS0rKP1l8GkgwoqfGUpOw/ieheHPfWPrZzhSzp0oP3nyRMeePHmysf7EBpDengpu9LbYlK7cF0/qmpcvjsr/DjzECvPMgIcmGRTUYpj2SQpkK1ijiLyokOZCQ/pwtcRiFf5q7Mf9A2Pz762Eepyh4ihM6cwQn8qDlAZsay3wKV9HwVuFqB4uLy/j+RoYao78KFjVSm5TQIHUcHlwll6Ur6y7S9dAFhn0RHJRgDmDbTWjJrAz6ouHcCO153MNQqaY+rlXcgZQXEHoy/AiM+hrEYCN1vw5s6U23QF0jifDalcZeR/+DeOLgfbQsxT2/xEjDT+fjSIwMKAONyuP9zSUJ0SmIka9+xrMYda1WZeyGC9H9My7dLCOg6jxPPNOS2mczpR7e+BxFNEvboCrxhAXqiOBWgCRzpyA2aJ7bbWr4Dy+2F/L+OFOW8546RIH88pEX3pvNkpuVCfGqerIcPg+b7Yi0OWDsK0UvgIiOVycP+zhnMEO4eX8a7iZXwW5zDEut8MveKJK4TA1fu81Z+h6CqnoQ55CembglyUBKoNeqxGWyoWpMYovFA6w8sK+LilYAWRkIITBJE1oMJsBeZixSzUUU2EtYTTGDDpJRp3gJcU5LuMMEISCnqRAk5I0HmU4Rw8DcI7iSQ44PL5YRR2e331thGaw+bwAKcDOy+slir68XorDbrUWZQvQGFclQQU8zXQICDOGYy3CzOBzZEjrSmajeiafSYzzAMRhKADMx0XE28H8QvBWLpI5N+F1kgIb5cFFbZ584oflOl9f5a4G0GzQiP8QnTFiWrTIgP9lRjHCRnEqodOgbp/KL8PPrkwwtNNyxgoJmGGCm8zYGfcWSBZAMcBpv/d6J+pvtSrYeIpApxHw8uGuniPX2yU4rSeFYN4LR1F/S8OZRhmcqb5TJHR0ht7oYpL2K+8AaLa/DzDf0gG9KwHL/MX+Pr14d0BhZY/x8gXdGbilDPSrMH57j89+K2CcD1Ia8ooJCLBbhc6llrRkwYC+DOS7XwEQOaRtAgUII8he7yzsA83UqAhW24+8AAwHaVxazsc0BFRRCUhq0/FtPCqxU/vZAp8vQE3nyWymALQEWjEBKvoc4uDx9BLgneML6G9M49F4oNA5Ges8ZqQ8UQZJF3foj4Td3pTSOUNpJTczhhwBkFUyn5YGsg1z2SX+9PM4XQCtTElrDRrPrpeMUbWINR2FnOcThpaZsACYMddng0/jSwCrLBISOPYSBk5KokzDn87YOnOG17mY8JAu3aYMmwP8GcgHE1rOx4YGei6l8zEjuqWD2QiwepuVveL38YeVNJgvwCwNWl5fzgejuASIq/PlPC6hLAjYFWrKj4ya0nv07wldDWw9BYFS3i4B7v+hbBuzZBZvfPXWeVzqlbZfhTf7/e2v5EqvAOa4+9339OaHt/Tdzq7xe4/crxr2nt5ZmP74cqO/ReFWHlbZShoGOIsaDJvfC0dbfcGDKZRgVB6u6nKWDi7iEgoprVVObuVZH8qDHGGvpPfOUtinUqm8tXlwANIGb9/r88a319+SmFE5OChv7bGLCEPtie+f9reNs6ebZ+FnQ8cFReb9U2yUTwv5ePd8+p69x+SEVjh6tv1uXxNiP2iKa9vYPHu/+pb3m73wM/X5PbT1vL+9+dyQU8VWiAKf02a4ZTw3cijq9/+Yt/+GF+ElQurtXdFVspyndDVPaaoxxJaLWFzljLbPfvtNFXr2/ulvXIGsImebT9FA+db/5ZnxvPfLT2P75jiVE2PvTGrxuvTHMP28Gfbe7fc1rSrERBE7O9yhDE5+Faj7oVRDA81ntMzqMw+lahhvCnuiQ9AL+6tPPZxubIX8R+/49ruDlYceSjS2DvBfU1D5WZGeatDxEFNiHs4UdWQUSKynGY317l2v9Fu/splpUhjsUQSjuLzVU9kqyhPHzlU8j0fJeUm0dZ7f/ts+2Dowfv5r2595Abrpf34+/7ett3Vg9OLL8XSWpMtbwLZ//+UrZ4unX4XN54PNK/iiQJu94od6or4jtApwuKh31nuljxbb4at7b+VTwWZl7xnxoH9Z/vGL8bSvDpisQsLi48FkDN4CyKcYXlmKnAUm9BU9DxXTHFKUj26rZ85JKjqjGVCnHEKLx03Rh8ychdxkOIqac3U9ZzW5b3AIBuOUvaskmuoAQN/5EhdQvxkHYXKROV/gkygoZz50fvXAqQ+YT8tbdLbPjRGmel88249no7P37Cvp2dmmAtwP/cy71VboG5X3Ya+8VQn7Z5vh53JhnS9joT+DH7XPz+EH68vzfvjlmfKkhie+0PPyVuW5EX5RmlqhhuHf/SLTrkxL3DFLDQUKxxD9GDgrSd9/Cb8YhrFxplZBfc0WQyqomD3TdzdoIw9ntzdW8urbhXV141sLq3h1kCEkPQ7PDhQO+UQJPwWMUlcOQ3as0Fs7zZbDdGsW34RDo/f+WX979by716s8Bv0vHLu9vrGndN9kXjzJTtxPlM+FwtOYiOm/Uwpv/9DAObryGGjsz8qG8ju1+bIPeom3+n9siZV9xdM5w3hkv0mj+CLzb7Gnv5PdJIm3O5h7RBFFbAPJ3pkQYcMMBFRKfsZXk7dwvGf/dd+aysnX5qt2XKcmLXxlMHQtnsp1mYVlFKkj6mQ81DrBay6AloDeZl4gOH/35/Ni/sAMVnNX4WVe5B7wBJKyMKGBRVzkJQExEgq08EjAXCXxh/c13lLGGUSvlBVpN06jASpzncxGabRIjFB6xWTIyur4Ei1UVUjVNW7RmnA9pPHr4zlZt+exKDw3wNOQXA28tDG+xfMNZm4cDtIrsl2yZ4v4kj2eLs6v6oPFgNqyxralOZ3xRIpwlBOY3AHlObGnUvLiS3hPgINDUqADvrSXL1idQdsn8XeoLuyBk+C+k4L5UurIfABMwn5P9m451euJJt4ch8IiALOAXie916U/cKz0hz5pT49mqYE0He7zdBkJLwGMhBGfYzJuAeLs+czqa68nhVywOeotxxf9Ve8bcB4QDvf2wvLn3ZdvvtCLsEz7+/v0rqL8AlV+Y+9gyl/Qu3cEVPWtcIt64vPk3cHjsxe03zfY8clevwc/eb2wX375Yxj2Zad9+aSf+ZtbcSTHZyes+L0nG/3Np1vGMyMMwx04Ju7JR6u1+IcvtFxNefuFbldTsLyP5Ct6Z5t9A5TsVrhJofHsay/KGcq8+j19ssGExVNZsp4U0Dq5wk/CXUW5gZhAeFcTVuwir8CfNoytJ0+e0MaG3oSgLAxF4Y2/qYyNjQ16UtjGVE3+tnpQcSNU9fjbasFM/yeAQ93VsKsivVMEScY6ZDEFeICKy6dEZ88yod6zh6V+6xmEj3q3gKGLwhRPBvDEIKP2AT8ytLP7A5gxy+kQbJblLFZWA/kb3vNlO+Px5m/kffhZn+9v3btf5ioJYw97TcQBY0vNW52GEBJ7tyd98V/QYAcH6m4WN7YoE2ZGEFkKy28tjb16aN+aKqk4u1fz4s6HdjPo9McVnu/qk9mlKEUhRfTiRUV5cOvtP+7/BqHo/mPmAPJErmDmimeF8l5fe34M1XBgrFrKfE4VUjc299SSDx7gz5zj52yL/1mZHvQ+G3t9Y7ME6n5L8kLycy87iuLNHFVNt75d9P2nh2JYKRrvTl2pna+onvuWF0B3Wylq+5ZSeYbmLzDVtGKwKBKzmQHV/KNc69WvrSq3AiYMqqqB7dQCqrsM36k0TUWlFKA2NiyttX4insg1+YBBYTusQ6f02oAuCYtmk21VxchadDQcce0uWlcrSlaiYSVuq6qnBtSgbBfKr5lWDqvYaG0av2a2TNgdm46ookCDPlPEgE4OKzl0HejAdB37py4UDlipRjQKtL4AMFShJ3DienRqW626NsNAZxSFKYVdTfyArPnrzMe1UTHC4R69g0PCUqlywJ4593+rZHJ8uKk7oz679gjLFQiCnj4urwuxtvNL72y7T+G2HAGNrXA7fMX8jlfhtqHPmxVOFSkXFWVgEIAZIoTHzzHQ/gzthS0c9ua3/YdF8L3zmxHo1+EvT+TYqQvk9VVHDHqnwweU+4cOvxhP5NFMSGc8y45Q4Y66qY9GW5Vw9wlt9p78rA7GqjJ4+I1wCoyt8I1UKRz+krme/rzme5rd1CgWTlh9H95shc9IEdSihsFqK5bbULq5WoWWdVJEuRGoE0FwGmX3WP8lMNsdUYo5spy6mxnvGFFEl0qCAwu0aQwHCyKbSRXkuHGPTocrHvEvraRw7NAuGa047yzK3iDMFwGckqKds8cR2V6Kwrg1h5/zGH7SOAMLilcUAC7FmZqIjePreQzQ+1HBj/VIma49qCPAXtUyad1DMjttlynXSEPm53oE7AtbvYtPGPzsGJ5WxKmF3ppxiMg8WYjntJn2Bjbmb4QXChHvqVPI+BYc2QKHIZGzvwj5HpTpzQeX08HDRxT4OYkWmvlwveTDChy5xrn3QPaitibMEyneg37QilLyVR+w8fR6ghp8TWyu3X2PR9nJh8fKkgfFEg215KbQh5/xgi2Hl1Ir9ALS13yD8yApHItuFAWijOJ6ZrVW7/dahyd9srDoVTtUt8m3ye8Y1Kv6/U6LelbNrzcbfWw+vde7b972qVf3+zCa8Hqvd3bffP+HPllS1AmdVNptOTTAQn6n97r0XZ96P/yxb/Sqx/V+hTyd0+PyyePCKPB6b/DUSbu99hydFpPCEZhcFA79gA3T+F3gGeIY8/o2LFfEsXLEZA4Wm3JYFjeHF0pCmftu1DmNSm85uRiLI8ZN2QbK6iwzfD0My1gzCeXkItFC0Xm594ShebEh9QheGl/0XuASbve22Wljr8TRcoXdQu33DhB9zH7eZmk/HNK7g4r2ewsCbKjTNyt777D/VOjgAFtSeBaeUW8rfPX87Dccfr7qLVRLR7/q2HPOwgp1WsiX8x2s5hv9ogbE7ooGxK4kGe/Dm21moYY3Yfqy/KKiOKpfj+Zh4bLyf0XtlnMRHNZ+xVZhGpWPtCuJnKIOpAhu6eeYB/P3Fqg5V9tCJfZ+fLm/afSVSgaL8PlHMR221lQ1HlDK+KsUvM4TvRzmCzwLbWU5v5sNpuPzr+t68ZUXBW2HThcDsem+7wwY6l9wivkNHbBM8UvZ9MtqnKuAzaBaIQ604KzmnmNg6H1dsQe4+8pf99Ug8lXx64pfWMXG6WOlKwCNAF4a1jwKs6tUdpr6G9Nf+zjH8BEjfPX8xRnBW6r4FhYeCbt4EwFvePNqr1zZf1FiLuZyPsOg1SmiI3Gz/dSorLATw/BJxk7kDPrEsQdHHr0nGw8QRDsZQbRz3yHxcjROaDzFdsbOvrh1F2DFQfMkMbiirLhBqJ6EIF6QI/YrfTYS1gfLE4raFYOFjETNO9SsQWgbQM9CadVAQyxVXT1XBv/CqdOMOEGv0Aop84zptKrHlHvWK++97wv7psQasb/toxse74PEzj1/w+fzV3TBWBEMWhAlppKN8pZ2Qly0gxZK91FR1481QkA1P3DjoaShuBohQMPxzyF+A/45hLWzWK6y8TM7/XCaMI30laFzixFoBSFZrJ/FEA0hx2WzXs89Rky09pHHYV8onntit6FyrU5zYulp+oC59m0HVsimwz+HZIo7Bn01deCEqlZghmWUoYK2c6SsiWtmqwY4XCsPiR56zWxZUIfPAmzbXLNEFbx2aPs/qSIL4bDsZXG8Iw/KnZaLpqmaLZgjt10nOFxL+6lremxpvJLKWt0112zhlEsCmaguprpaSpO85rKKOqvHF8InYpgLzD4rLDuwxikmBKuWugigQ3RYKbSvRq0T6Pgr61zgHBOPCwwLHhXKKBe/prqcyFW1PIKee+xL6IQKg0TCfAgvmvMCzk9s+gSGLjPtlS7LTHvBcKjzqGk0OOBXreDYYuvewPJtR47iEmsHKvCTDpyqgDKEZVvbpmexLS6MZbnSOX9hZWiuxNTY1saylum1bNh38tUPyKoru1S3IYOBg3oMcIS73nLVbTHyPLJgv8nWpDKNrJMOW246akQ2cE8QJVR7anRyAOiKiSa/mkOO60g1V2Ly8Q0bJo2Nlit8EqDhNmv1gvmlCmCe6zDw/QBDa7lty3T09USsMaunwKV1HUtVTCLKKhOmoDCxbIRly2Szx4Z8snINIxj9+BA2lPSl2ra/urzYPtsS4yoP+9xidjGH7fg1twMbypbbtBkrzneUxxzbVzZ5tu+GZT3jbd+t40nXcT0Bc7B9vVopCEykdKuBG3BxXBbASnXbK7A5YR7BBlOsGc1CDxQjyrCx1tbGmQ61HGq5TfztvKaW637odjLzR8uDkx78mfg5obZVt01HXU6obdfhgAR/Jn5gNN22ccOtkwyvNhtiEeNPmy3bcSyPp6BKQDVcGBZJonUSYGrgKo8jpMcuwjx0Hdc5sn3YtGDRUeNTglggJeSvpPv6FhKOCc0O+8X1hXM1Tb94NZWr4HoZ/r+a9wzjh59s1UOEjfl1QNmtcVyZw3YsrwZTsZYVlq2T2krcdorxk/UMJ1mOdjegjg2bR9/P5muHu6/jWYBY89GqOiyfqmP6I3WcP0+h2enrCelcMFZknz2eiSEgZov8o1dDz3Q+hGXrJw6ciH0hm+rxVRZVYVbqMVywIAwy671Wq9tRFxiD5pNA0mTFlvDKTQw2/mWwAA5xxmO2ApS+wozgz/TNNixxc1tAlw37MAE18bE+Hdfisn5pQ7bVewLkqNJkTikLPv47JP8n8GF/8oKOLexYvWSriG50FZUqB3XrKCx3dMCXwEmWdMJp3aof2AHmYx4EA1eY0WJE126bHlv96VD2zd32CfnHNqN+quEUaGJktxD2OIyJFSiCBHdNh5h2yizj5NvZBA7Gbw7/dCyP/b5xhPnS3IXYOTnwkw5g5wzAoTd9+F9qM5KR2M2BZQ38FL6CZ64Y2YxqAzBKS0ze/UO7w3Hxa+Rbnlg623WOwAq4ZnfMltwOalgiukFNarxuVIeW5gvHTlSUmx3gHngEV6fbphPb8+jE6RwpGzrL9BqeWTNWWeZiqJuDK+ihxqx+5vNrdv6RqQZDmG4DKkcJKVbxntgOPEN7yjnwuZ75djjc22f18PDV/lk/kxkxB2EfjHg6MCp0IGwThRiFtRPISj+KD8TPX35+We5D8ZXCzyU+IJQ+96mEg9cX0TZ7XDK+dc/YKoE1Ugq/ZPZzo6vBZAJvihR+0U4V+5k/xSeiOSYyqvxMwucRMFVoYwMPQZyKNAqfGeHwarG4Tiv65Fnee/742YuNre0f99//po6bD6QL3yKs9F5VHrhXOYtnn8JhPPu0p1hWzLenrJb7uppGejXY/e77XCLy+fu3X8KhpO6tJ+sTt+JtyLkxmTNg3YUWuyrHvOOUT4Si2ZG0B9fqiKgMFChc7u6+fs0lOsksJj+ZxjwenIETDqlUCYf2jAHU7sIhCYPt98U38YrsJnwVhnxGDMMwzDgDUCuARsE+38IplHkHe3sQ6Dx9v79XgbFCiAru/iFc7g6+e4Pw9zsIX4zC5es3w2G43N35426fuXe5283yq/4ZmypB2lnCT7j9+c0Xo7z17Cwc4Zcht/rlLaV1WaFwRmJYBuGPYWxLiPO9+1Y+zrH9uzkOvpVjqaxjRpz10beybpZzLQljJZ9RAUedS3j8rRKGyWQEZfLn0kWibQcFus/PReImndwTRbrNkFijCqwetr3bmyULqFmxUBnhIWvrZdps22smU8qG5C4bpWu2RamyiRMlRXZGnI4/aYb5eHGVLBdYTUrbzzWDAuomYMpi2OD6rvdunxmxPb70XtDZb/1e46LPspSeM+tjYPeCRR9OcEUWKXwQZoP82N88C5+J+yBlAhb6EB6GqfGev4agYfiMFzdBCFa+hoKgZegMkh8o1IdU8+kQ0Pz3b5pkfk+maZpkNvx6lcxOi8wAOFumSbW640PqW6v7VONjrWA5HdbsOtVbR1SXuOSCGBkoM/jruECScRouYf+CN5casth+XeTIH05Iofa2TP6tUrtK7Tq1G9RughJvuNT2qH1CjtkJPHKq5FRhgU+O3cajDmdxfHJ8s8M/Jc7nWzX+eSO/DM2iAEZOAqaHO80OqoDcnRPyEPY65Hm+3SRQNXYTNM4H8tt22zLJd03yOw3yvSPy/cMGfFRRgKeClm9SgPzBSUBdbMlcqS5D11DXs+n4g08n/z9777bfNo6tD1739dzN3Pig2IJkyWUnVbv/iiXasZ2U/+XYacup6t4EpaJEymaZIlU8+FBB8kjzAnMzbzKPMXM5v28tgKRkOal0V+/ee2ZXdyyQBAEQBIGFdfi+3W8X+r3VomjtZr1b+K2wdi4160Szju/m/IzA3ekb/JNDcaY6vAPaQu2OKVNljtQ6PrPVtsAigC9s3SmuIRDo77lLWOy/+C9sgemubgF6WPH7WPBSX+oF8ijPpnqq3w364b/saf9DH1Y0/hONs++PD04vvyd4pX9pS0iD/B874v6F3U7uS4dvj6CagNz9n2hAAAbtv0fCf9xIwN6mJezByp/gp/+vbcxBvz74TzEK5V3zD3rvFUs7dofkygvzeoHLa3wDL94ofJAE71khwWCy5XdAUyWAwMp8qSHtAH8FBR4Uf9x3DCL1PZBjgVsEJc7BKWkO1I9QmRwTcM7RyQVLKMaWr+OPpMO7SW55ip6qlb20JDPWE/0w6+3GE65qaoAeH+xVYmZ6NVHspAEwns84osQLrhJ3dq34b5qPKCHslT9RNzeN4R5WxTKUE94DxUFDtSyzE1RzKgWh1nhn3qiYX/UZvFIT9UUm2T18GubM2qZD9zp48djKNzZFs6eQh1UGrDFo9aApaHGkY9c0uvFfqNG2tF9u6Xb/F2q2VXZ2V8wNJN+78vVoAiYE+WuRo5YeWXJU72AAV96UfzceOgpONrZ/5xjX5UrgMJmjW+3KOW2b/q/RW3a348DtqOfYktyrX245sj73yQpp2QOL+0RagzqHfQnjMkMTNLaphXONwUYSvA1/IpMcybrd2XYU/kgBuKyX2sXbsVtd1dhedeyX6067ATWNbt3WqtVuOPaqxd61SjYossJcdUqUc7vdlOUhVtouTTZ8oisG3W67sVa3BzblLp1f5c4aTn/A6Yq7K522Os+05iwSMhUNGcm08Uw9k31lD54Vnh5YDp5hany2qZ0sNln7ME7iNFXuFbz4jKNoqIzrRZqS02iWgYzBQyIJRjlcRJlvxLgF3ULLxlwn6jBPEp+cgrTvp3YJ8lEIuVhWosD8xbDNmRt5vjfv8wlfIOYh0KBQSfybHxlXIGa0uPYTwmBJZwzCYlyTwuDGL4BYtBolijNfxaM0Ji/UOPSAvuJDu/KO1SukZ+FAU5UQUcdiuNiFn8LhieM+i6AxpoNQaTz1WZ9okIZ0FJhp1I/sLuRH6j5OCpUzKWMQE1UJh5IeOag0CCjFvh+PHFYqQmYY6kgnuOWMNCIKnZYegZG1DQhc5SSrHYVVOUneinPHsm11uiZyqS4VtJGC1I9tfEd3QpVOMh3LIZ2lZN9ypT+CbfuT3IbK2+7tkQd6q9kYdD85g71ndmtIF1pDx3rWqw3WTaDR5pqjV2BgJnjxWLvSevFYsGZtqc9fAXq0LD5/wQFQfLKTC6da0lOeTk1yJ5Tb6jMehU25y5HixrFKmPOC47rNeemYCzpM3Fz4aM5/pDnUnO7p0z1h50E6vZ8kTuOTPT5M+3c//Sdp/ZIIfXuw/nueaJy6jrXkTX7+RT7CstKxt6yrNG6ROpDCsjj2lXJtOGKDDDX2kNc/5KRAWfo+dKA6u1Naso7qunKb/XihxrdH8b1TuOKqKraQ9q2tavTNCWODmAAfsQxzr/pUxhFFsyNQ2Q3DkTu+KT3k/SKSE1PcQpSrimZqRr7i8TgOtXO3sCrIep6aRAuqZK0//jXH5Gci2efmNExlRdAq58tTn+YpdmWM5EgbuGwFPTJ9+J2OiSrRHnG0dEPn3Or2HNXrqtUuVNGvVhX2rEjbvU/wb4Mv8MCp24M9B/LC6p6o24OeI3p1a7UnePqx21vPeCWti8JEVuLFFBHrm5Vtju2OJlGS3VIIIWSZewSTFZaYXH6oHiNkfbOIW6xGbxkjEtYisghxT5JOQkscfEamzdINF4NCH/BmJW262jBQnF/IxWg7adNURNYDrp0HTsrjRsPrmdZoXINJcB/yT8JmLR4l8aQMVi6Y3kapcscx1vg79wEFB1jdXf6zq8Z+EKLocehOZwRk5YKQLE7VOE+SB+X5V4nvp8pXE4A6TcJYw6S9i0M3UYHnR1kA/qlUW8R8FaRn7pkK46tXeIKpe0+oNRGP8gjRGTQyZ4FKXC9wiVxpqpI4jzzgkqn0VziTujDNcfByFnNlmSE5z5I8GlPoQp5EGLrc1srK+hnbG0KHeTDAqDGSKeYB8r7dbnTbtb1eZ0MNrGfr+59WnQ+7Wx/NpfkrOlhBT0JtUXh1F3EMlUvFXMWLqCITizNAPJYiqVja9e6iACgd1W6Iwr99YUZUUv5mJk2ZzmGlDH7DXh9AJ49L3YXr6Df3PLeVeFA4qIYhUEdpKUF35CtVbg7mO1SOhDGNL15YAJdcIgXq2B6O/6/G67DNlqS4CmAH8DrczDhw82hHzIoJuQeREyqdQ7rE66h/cISASPJssKGgXoGdjKxkTmGrt7ufnC679rYRFsqMQ4ge00b7rZeQ+Juq0yShhoIlSKAhgI69Z11LPetxnTUC3ezrri80C0k+etisLJKFaI676mLpJTeLp5WVhbEWKqsKdSN7SMcIExr7sBViajfzeE1Kq03vcl2Dfxlf8WX+DWLxLTLWmLzb57hfHfS7z2LGSElLsE81Z7G7cnuv13G6qmt35DZM2bxItNDDDbm9WoXSizxCjGQ8PbxkAtVLQzVKNbieF9yatx8nNHwwXfC3Tg0p1xIcFavJXLtN3G7n5VZ7XTks6dbl6IwhVRfj7jVA75Jw/NXapj2wAYtTs/EDoBybUXJqhHlGG16l9aq61r1ew1rbfLlV23AauGHxCnt/wy9/tZRsuKtlzaITTVnD63h8WM42+lxnIY/ig/K00pnwdottR5PkJXB+mXgDXcNIVWIQZI2Ju+bHTvNzYwcwioNn3Y0txNSwSbpr2fRBvfzwUTnkArENbZz2qMfGH9+dENXt/0Dae6oHMBx516yp+kC9JMC4+c6y99pNqyedCqCARrORHjweDBqC9JwPuyVcAg5ffFTvK4d/hozwymKIgwrQtNpfo3MAaaF4iuVhreKVhc1Tg3WIFdGu2LWa2BVEq8QTvWYDsOZOx3QrmXakZTEuXlveObrjaT6jwjHFmCukE6WQDsQSDdZZkjWyIUU9qjC4usb2OPJVFN+5SVSVa6AsxS2QJ/T0ClHQ4Bl3VglxVqiFSCKjNUiKoKIsRgwQAC3nYWE0OqhRIBgSzCLCCCUG5gTEWwLWLEFeF+JJET0a4fcuorhVJDIARAHepAr+6gH7Ncoq8rUOK63EIM2hwQJ3s0CkKVYlSiAsidFh5yGmytdKvVuNH9V1hOgpHT2aqDANVZgmKsQEx9EsU59AGTTkVRFXamQ7E6u6iJNs4GQZpgVAOAQmm1TjTuEE5YfViFMiUH0EdqXjTccq9d0Q0aVayRFcVWJLEVSauUGIDYzxoCowYivRoyqf0XshHNggyQAevxAKOg+Qw8iwVQ+qutU5fa1CYO2wMFHCS+QP6kELzJ9ZxezJ1FELAokGyD8JT9MHR70/Vbkdpg+kIBnVEfKzMXCE3KHddKPd2ettANEDcLEtAnvBwrZnSfVhZ+v5R8Q4Wpgk9gAtixB8mu+eATdWSAvIsdZgw1Gf7OanlqM6PdWRVs/SG9NKENIHDZP2/k3fgot/3eq8Pe4jLOwM/CYW/D/P+5b661+b6vuDwx/6lvrp4OKM3G/e4KEtElVX8ZfXRbakrK60G2rVOH3ADFJijMEQMu8UsgqJkdDcBGa0eblxPmuJr/Ho7DfAJqEXpTT2h/J4TwbV1munKZYXhR14U7at+auySdeaJsOCG4v0mq3llwwpgvQahX6bxoh6vE7N33l2cIa92dxIXP6UO7KNB22omFKtf3MaytvhWu53SFeA+xtiVmmelLJvN60GpMpBDXJlWzl1uS3swJumCY3vlkkTTLBMxYXcliktNaTmlXIbShGKqOOcDWVuKe9daHY2captUM/kHYLy+KJGUGw5zbVqRWtkVFtjtDJHK7JfzhfMDtzoMviIWR1sSRIZaVc8fSDTxsuydghHmw5awEUAI+Po/PDLZdDVufHxe4YswaN2ZOpoFzaC5yBNaSr7TW0raL5kE2NNlL5pNMv5mMM0/TT0RdpOSV5UZVo+9mzbHQV6gtvNgO0cyIZ64QUzNYqza2mp1J360lJZEuzr7TYACePUV89HgZJWMME12VC7N6Dtfk5/kTHwPT6ndcq7VPQuZ35B2UbBvqIcFJrLSh7ZoPJaXFcwkQ3WkI/MOdmg8lAW7t+llpHX4S799YPs2k+kpUaB3nI9x+M85wLLsucq2i/L5xbx6p/6ahc3BxP1HL2j9VBZPgt9yqd2i2LVFLDn1JWyoXCXLsIry94n7m7ZCt00ky2yGmRJMJWta9/1ZCsNgzG0ETPZgoLHHV/rTABv5pcwlS2sbBQrHLC4NpEt4mFX7nicT3PgJciGSnystqu6Qiqlch3lj+OQ0a8lEKrpFN+EFnAr0rx616rarbRpEoch4pLzWeJP86lsjcB6PVs171E3qqhFzVyPUOIS38vHvmwFkeffY7dMMbvcJiiMTGHl05qeGcc5gMTpifjuSRCSJrPy5Kv6Kag8eoqAAeX0EW7XbSjwv1kGCn331le7eHoul4pgdnvZ0rfoEj3/nq5SabMkpmt812r5TGrsJpmfBm4kWyi2csh4IOWj6F4tmsiDRD03o+E5N6u4YJpOF3dNLk7oppa9ojFJ6eVxx1V7jO6kb8oMpDCUVnV8uKma5em1bPHHBblOtsiGNT+I1G7Ro5w/mKhdLq3asOfUHDd6KMY0v99dfZ29qmUryq5N3/LT0X24o/LZVDuV3kb5hujbAI1Q8eiMLGhGKF2SdfMW6KIUuivoYvVzNXfLOp6oGFUS0D9ZMPVTJetz9Uih5opWC/cV7SC9IxQiaC/0qHTAzVg4LLKae4vruLe4SqqX3TGPaKj0e9Cc02lOPdfX7pI4upKtWzfMwWUeow/vfQ/lBmx7TTN9LwwDpkR6En8ywWxR+H7L1rWbXo/JYWBG2Iqe72MWoQMuZZdCCL6hvxGnNzbU7saGek5HO/x3Y0NFOLexodKpm2SyVawON1QmxdmnxVzCgfWpyawXCG5tzyWsSnMJa4ROAy+guGCC91O5bUrj314K/P0I1UQ8uMz1ypguT3pJPJthntN3z9Ve/Qr0qblPtnoPqsPGCagR1LI90xDlzgAJPF9n0Sf6xxSvS+YsC/2kr80SP/WTW4LkKTtQmcwLtdGnOPdWyi6UDZVi+ja3zrcb+QGuv9ixj6USTCVRMPPUC7RbZfn4Rt0laEiiomBm0pil3DBMM3d8ozvaC3zl5VjAzYUyJS313Mtnqhims2B8o16gwFEO4oqeoXyhuschdu/f4rL/K2g3LNVV6Z0789Qutq40vhK1iyKvfOrOzCU02PENbXtJTpAW2qOec5GQ1WQriTPP7IfpAVkx0dW/qAt5jECnRrHLNVQeikUseiSUgEfxaEfNf1UShyHVSk0mLQi6VFHdjBci6/SIUhQ9gvc3C8BfhJn2BRpOnGrS4vo9N3O5fq1K2aXK9/T76BnOHGkVZpfKrFCeMj1DigEjJ+HYv1PfUpF4fHRCGEKPunirqefxyGEdhWzRG5sGKWsueAib7m2ZgdclnCyfdfZanuIu4dXtefnFLdwpLWVWhXLx1rBenqqeHOeZbED40ZLbL3EQaWFrGmPS9H9dxeQ6dllkGeWZWeLxuqLsOsUfVTSFmozLWDOlpfYo0SvKQ+aq1ERrOlZanGtoJY60jMZj7plSvOTQj66yaz1jgJYluFdBnLkwYoW0M8gjDwJeksQJLWM4bZZJrjSKK4tVuSK2/PsZ63O+lIHenker0L5+S/QJUgvxiNKaBEmK5aesVWOls8CicdMncZ6g+4IJObCl/q+ylWYAgyEppuhWaVGn03unkl+oneKiAWzjanTP7VeGTdF3KIOFjxfF3VP3vuhVypX6tJoW8G6VZlDVu/zzvJCuiz7mBqT5ZBLcr8KxiEaleeXquR7oGnSNsunBxcbRskrLPNQqpDZdOwR+hsGTLQpLjLxg7Kc0FE3lexgLPVaWFg0qhxDJZGbJcFN17Ya3KKH45CAyurPUN/finVJ38IAuhhVLflkx3LhCa/64ApFXjGf/nmDjEnXtJrc+DRF8GfwNUvO0BI09GI+Oigxpqi0/T+5NP9K/SfGd46XzqSKVZqq6l5vFM+wzy69RNsoP3GRCf0pL99kqTRjmK8IITfw0+I2esFIyJupiVS3Xs3imKh8ITxvUt5h1lo03zB/mcXpm+NB7ezQ9mK/Hqs40q0qP68psqE/50aNZU43j2YOil5FdB4nHw5z7R39AfEbPOnMzDRpqPrceVOXMTJbmCdvlx3kGK/78l8bV8GYEA5q60JqfCPREbcY9d31CUyxkGS4u5VsbZouqO2FVXYW5Pzd0deFUKW0F3bFffrhcr5vOzZqPlzHGP+4SdjyE8TvMjfFEtnaVtHZkU01IsPbHAS3OwLnS+1TCuSL4yN4IwJtckrTojsCEBEM9Aux2fT6NaM32/CieBhGhkV2NPSUbSlc1CrK7IPW7SrZU3kPoL5TJoyCDXFFtHhbG+GrXTOTVHUrkX2G40XXVU2bKL8Ce0dyexsDcldtEAEsNzdJeBT2avjXM5gmQvmg4jrMeWVBwgJP8THASHQUZJLHehJHmIWqE/j1Wku3AtMBclNsTlV5Fqsddo/uea873VN4jY0fijyFFEcqYGyrdsl05MMUpLo6kmSt9oNJfdYerHpqLdumu/5W7PiX8ONlCt+tWqj1cj9yoxwibvUmi+c64k/j9joKMnA6mSufGEHgIY9eju/SAeOKd0DTr35qnZDTWPIoTDxxAaCH3uy7ZAnwrarzXOpOy92RLO4nne10Ve7h3D8MEXdYzPUMNsorO41fP6HcLnwCs5d1mT7WaPUT19h59IF3+rxJ5PAnzlD15ez21R/+pt1KqV4b7HVHpSt/GWH7aFub5YTANMmIOLbBf9wxjfI/+0yXuQfOGtcu8o6kbgokOW2ZzKqFpOo7CB31vT2+YeUBp89neHlRoHjUY0Lw1EKnUiAN1/lEJYL9D5Ho04UFGBiwgGaRast/Ebf2m6tmDHtTHcEGkRE/pM8UV2bQHTaQkclmUglCl00X+nupVStvD796eBpOnm+BWuYrUqrIHDZk6sk9cAoO2TrcfT2kV9f26JawOOaSzC9pLtL9urb7EuxZVlTguqk5v0UwAy1QDXp+FZvvjI5V7eW3RLjRY41aa02uPbAkFnam20icOafctIb3mz3Zrdb32DIARW+3tzstuz9qXcjD8WX36v/4fhx066mLv1dH5/+4g5N1ukwHFgZN8FSEPgxjXBbhuZA1Q0uXlNjqZ2RfrYktj+Gn4z7II9fVlAotAjlzobuHQR83VxCtbsM3TsYlMsDsvDV4nKXsLS3MwMQCH2MBpW3ySh346NJi6pFEYw9XJAEfYe73VrnG73n6mXWwITEA7RH09rTS7Gph2aQ7Okg2Cnqtj+GTUV9ahmae5B+xXI0drB16bbgBGAa9ddj912PEPKSYZcSOC+8RmB70Ey7LxB6o5YOqxOoeag2YcwqUxnrm/5r7xjUSbasJkf8UQtEfBZKKOsY4c38O54Qf/IQUBCgBC3iWAEs0eLmHavvDHceKp/rU781U/H5G9u59ThpnPiKpFJfIDu9N/tF+d/7tTh887rG3EyNGUO/WNKl4FnD1W2eYFt+ahsPgGnIBNei6ziWdprM6DXlB0J18QxpW6zZ6pO2oD5VOgAAPeMNZNm3gS7jQL5Gcs6sdHTtVsqm+ilwgsoYNDwgo8BzLUX9XR+ftXp8cr1ruL48MTwJgTVhxg5AzG28Xxwanx2Tw+O1qxqNBXp+eHP6xYDCZ4rjHUzwEYVkKpA5UOwHOvAX7FkOp1a3Xl3cX54fHR+4tjAfitN0BeYBApQDldnL+/BFjQ5d/eHTMuv6n74PT0/FCDFur0sXoFQ/s7lF8hQjg913QI52fzEI0nZ++P1eHfDhn28EAdHRcFHZ28PT6j5z86Z8KDv7w/+REolofH4D0AXuAl8JVOC0i/8xXr8lydvH13enJ4AlzpFQqOttTJGXMU4OEZfO/i5Kx/cqj7oOwABWCMUwJxe396evL6b4Q8UdIhECzFMYGXnVNPYik/uzQLunr3/tUpUSMcHBkEpYtjIjfoH/x4XPTq5TnQKC7eHF+qn77Hi/rp4uSy7Nc+4j3foqVHx68P3p9equPTYxwfnGr+h9P+8clr+mGmBAo3ZeoHBhY5OTt/f6l+QM0EonF+dkrPcgHqB4Vr794TacPh+4v+CdE49FFR//gv76mHCbODqRr61DIsp4SvA/6eLvkoatoEAtqRrUYXM2hbe8a16wP6iuqirTnyBLzUiAhBKLsutl52NpzB3nrL+KnXB3ty2xL2+r5j/ILpjJLbVq9WyWi1Wr0KW/g8Z2F7KVO4lASZTWEZjAnFgXd1gcg7TWP4+48KnkMEb6yut1pCoX3LQvVUhetnju1EO9qB6eT/4yURXWL1ZbFYWbwx9d8v5l/3YkqsapJ59IdjwRPLECi2Zdvea4Axr9UDIjehaxkZSlrMkMUi1Kom/6YSrzJ1lfkqzFSYQX6wt162OyZQdKDJSZq92iQLB4S9pkkaP9bo9iq6+iOXxngOMD1gVgt2MwTQeDBZ8HrXAOVFfGHF7b1TetA5TfX5pbwKRwZSAOYEMH0CbKntRXCpBVApCgwayIHhTPpU8esuoo/IJliJzHjzdkj2oCFBc795W8i0vP0Gf0rRRdATMW671hBn8UxQtOoVuUH6vof8k1mqpgHCWkkflwrjpKnDB2KYmmIyrs8CwxI4JPH41g0DFiEFMwDC2PxbHPm4zLfn2VgUUZ1wJqUmcuCr56dZEj+oNPNnyg3dZKpu/IdR7CZw3MxTtuEH9HzcAC9x7+gPSmH/WCIgjVkxJ3A/TIYpEokf+i6RgAVX2OKTe+4EmjjPgy9orBK49IrhKM+yOFq8ri9yccuvmRqosWiSj75R2n597fvhEI61OpnPTNcOlxen2/HZPNycz2YxrfolfkizYHwDrg21K6jLqIYdxb+7+ve5/n2hf7/Vv9/p33/Tv38mN2FFVVJdCo8U51kKT1nSiMIijNE15KFHSbyhJI6n+hwlcS6Kh9M48YdhAC28GwVTUr4MObzZG8aT4czNrot8174bZtfwq06kp67yAP+GPAqQIutC5s/mx0YUJ1M3FELd3gxptwi364cb/0EhgJCdgfHJJHFY0OzgKbkVeJ1+OsZO5RpBymzW4C6IYpQyc698ugGJfKZmLgbuLAmiLB0nvh8Ve1DqMdYPcrWZO1L5TE0kvqEpbACecuFx5o+DKSiBAvABqBBtDk0bQy6BiQPCB5XgamKuJrr8fEQe5kK54+vAvyX2B/rYyQ+IOyIczkL3Ad5HE/c2ToLMT4ekGpokAQgn6EAUR0E0iRX9CX3X8xP6TvlsnCecmAXjIfR7TK5DX2mlAYhTudHlDWEV5m/FlAWzygTufrM8GV+7qT+cJfF0BrIcQTvP4RgYnT40TXSYjjEsipOClPr8mHGUGSs2jSEMOpWOk2CGV4AqVcohczM8uIJLdUrTV8jR5zdRfBcJ5mpAic8p2CqMJxP6zu/Z/37oBcywqh6dGVJMIFlcafotsy6eKHKiajcpMy4cF/ngcyfUNI5iaNyG6UOa+VOE5ZtkmvmJHws1mtIb8Eq9LabcoRvOrl1OjmM41BfJHLrT22ElV3HIOecOde40GVcy46jMa47yhEIZ+WNUWFHKu4rUMHUzVd5fudeMZ1K8CzVK4ruUhzEYmaZkm/Qn8b0KfBX4w2k8CmiGz4buUGdmMhOVuhM3CfSPyZgFvxH2AL10dRdEXnyXDtMsxpIyyicTrotovyY736nJ8101+e6FmsBYxxEPV37kJ27IZpYruDDo5ZF0GpGf3cXJDebKeMKmI07zRJDufKfS57sq/bNKff+GZzIkEj9kryk64vlTM1QRX0i+853Kn++q/LsXKv+zuuW2kg+KUGN6+b/mrhqF8IsYwRzk3VzBF2WSj6/TwFV0cEXTVAiG2TCjM1M3ieNIRe7tg4oxP6s4IQ3vLE/g40DsWUEIZ44M+v+7a3xEDz5UcUKNpzOovXiWobhZ8tRAPS4mVP3LJ8lLB3/4sIhwpUOhxjxZzWb88G6Crh357lQxEEchBybulbp2I7bLq+s4T65IgxXRYAPHFyQfSkR+eqdTqf69S3WmO4ReUC1CjfOQ1thxGI9vYGNiN08/KU9EMTKBgUt5PpSKNDuQ+2KcKLJoZsWlIE5Jbpq5nsKfYeJnQeSqYHaNRvLPt/r3O/M7C/NUp80NxfTkBSnmcBIE3MjjhapIDWFXx4SBmGuKMTEJc0UoTz8iFH1q7PmIjvdgExAKrMqYZiHAJwGmp5QdcGdJgOXiQf2a+7AwwutGKH+i+yr3lB+GwYxjr8OY5Dd8oPQJTEifiGAlxUxr0/jG57/5TKURHHdnbnKDYhOhJi69/2R8jVE4irMMjiu8MHtB4jP/0XXgeb6WTIww5LserWZ63X1IaW3J4hliaPKpH3hCTUbDML4KSG42I2misQWGWTy880e3gX+HPcU4iK6GevYwh+ZyFA+X3QWhkGfkoTumoSNU4JJ84t66QUgGljGm9pBFYwRv5VMfSWPrR1Ivh0hDpo8TSlKCjGkTNwgpDonzwbo2yQkVBoFHeTosa9MncBvT3NGhjmmqnOF6Kify6FEhJYd3SlXp5gx1c8oT8Y2q3C7m5AczwrShFSvwcBpE6TD1x6ngoDuTxwsS3n8IqPiT4B4nZ0mMZZ648tDpd3ESekJNR9TN0YOal/kjIyabOVlvmSbBlU5F/jgboh3gH/SCFG3GRBxQIvdmyo8en8O7juJoOMLUQEMlHt/g2+dfWj7C3M/iGA4x45nKvZmWaspqFZzYUKc5nitRnxRCxZNS6uGtFrY5ASLBIqF4lnEjL0HAWBCnECRy2APHcXqvZulzNUtfqFl6G2TFXKLyuxluf76Lv3+OeNnRSyF+eY66H8X3JH3Mrh+GBFg0TPzI0yKlOxqVW7bhzA0SilXEn8QfplD4p+TvAQ/W0UjxGS6MTnPDx9dxMtwZ3qsi+WCSu+XZXTp7Ffr8d0iG0lR57hQ+rkNtbU/Yv+NBe34Md0xiV4XwDRhWboaIMsS3TX5RQ+2sgeQ0zuKkcomPsziBUQQnTLKaj9K0zVZz+eHBSBsdyje8XzzxUJ7Qd3AhWeJGacgcYjl8Gqtt506k2Itx6EM94A4nocuD2s38K0yTLFdpmYoN7TEDXiArmFDDeBxkDwuFFeXgdoqtvNKF6AMfniIIgYzvSLKeaQklSgPyfkrHcZ6qOyzAdyQB/BZPR4G/UM0ViO6LypLgKvBUGoeYp2c0viAP0yKEBMSgGU8HdC4DUtRV6E8AfaHTcxfoBqFmKU8laZbw+BN87E7hjGQWris3T+F0BSmuSNPWgIVy8uygYoWaZTy0qYuCZIxJnVZBL0hvqksgrXxUyCy498O59a+y7s2u/cRX6a85svMqmNEST64WmvBTXdE6gjBZ7BrvgzS85p9b+kn4KLml4Bb8QWSOR7EueRGbeh3noecnYZkaFcmkTI2UET2D8U3IP4lQ4Qh7E2oHTazkMRGM9STO2ynM45QzjRP+vNMxQqojIJ0VSd7RxLcLG0aaPaagRi02paRSoJGizO419bMsiK5SofKrsd7k+uXMagogHRd9Q4JEmSFBiPHG11OvKWbI99Q7RPOmAG/r5yPsGEe+p96nvneevEOFnvoxznzvCHMmpc717/uZ+ikIQ6RPMcgF26FRzUEYvskDz0/VQcIbgUMOTgniKFWHvHcP/eRVQN2RqhN4pQAazdP3nWT+VP8dvs3uderCd72Hy/h96qs+6RrS6zhL1Xtas06iN8Bh+xGUgqn6yR9xUQJSW0Lj6WCMmG7fex0nyHrhRje+9+qBT0MsOSJ4OpLWvVcPr/kNmGzUUUxpSPmKvvxizrM4+5ufXaBU0xqTFZwR+fQSMSsXPqRV80Yqt1/691nfh0ioLuPMpR5PD9KxusRSRC+D/qTvZwJK0DzMhmk+pqhtjEJyIRrSYwVxdI4jdEY6Vkd+OhaVPBghcfI29nz2C1Knbpq9J1pED3nNEJmZttHJyyALfRSHRvSx9HG5t0EajIIw4I+5qmQpg8vpUaGs8pPMvx/mqcsr/CjQW+dRSJ8M+77SwZ1PAu7c3O75swyczldmx11M9jPschA6iW0cZjDoZTL/fhzDJo9NJaWKFpjviP3bvPlqiNH4heBYCsqq6Jv0mW7U3Au5+Io9ISkGgbADQw86F9pO6AXAKC9KjYwyWQoFMvTMvO2Pk5yBEKAQjRPlj69j3mcGv8HTDaAx2Gu6yVUh+GFvORL0lNxalM9PBwdkeIgOp256o6YB7eOTOHMzH04AnXj0i0pIhYQGEle6AeghxXWF4HOY5gxfQAyxJGursgt4Vwy9B729+Q4FC7fuqWt+rde89l9nJFOzEytUa1pFolN5wqMLqy3fcMs33AUeDAjqPh27oa8e1AMlhBqN4nvWadCOqqLTJStBRcOiG0IlCTV2Z8bQoPWxrL4lXZyg2A+tavTcB9qGw/MVkSLTuOL0i6VB3fn+DXI9+FjjGEdyqF8/y5ZTuA57fpi5JJHrHR/5Geqdr+sq0rnwFjjNVDymNniCgSt4RaFb9BZDqwXJlUXB+DGZYb8DJAt4CRKGEtTWLCWgEqX3GCp1b1lcgNXDnfqCck7dG+6pWRKrxL8KSP3mGQpvASXLLVYg/TssnwK9qG6Ffsfcn9gh0j4AwvtUf/88Yljc5XHDnzgPCP1kXIx51fpFmy+OF0NEqUKgMnYWnIUWG11H3OJI4IQRM+h71u8Yn8aQaywsHtpmgdt08l49CN3JOjNvSIwejpUhjHJRdBGUtGxA8fTb0rdilsx48i3nMJ2Af2gAyZKfmB5fqBnKTDPMaxAvITfFugSWYYd6TiyNS2N8AaxsNSJwWRsXi3LoyYBFFboJj3DaalTFZn2TyV22kF6NUejq+0Z5CLwYUiAOi0bi+W+xq0gRpOYnWeAW3NA3QeRPGUsk9P2ZFsTNfos2VuJpEx0pwcn8QpsChnNhr3b9kdMXVOlAbrb+9OkTxwecJz5/mUbHv2wmIMldF8DfdGUy4ZerJ6d4MoHT6AP/Ynqezoalbsco5fl5yIkfUffF+0nyKCJBml8/SXhBaQzFNHkTaNNQWrVFQl3AG058VXrm0pt7z3yaNEUmnvm6BJ+/o1FOMJGVY9I/6OlFrwFDQLbwzCyKKfrOH12FQ1MR5EFsWMsn1oOHZhQzfiB/C9Si3OQqx+oK9zGoIGi0DPnTlp4ors+bcdl+CiOtkKNB/cqd9US7qQFvE0aJYFBkASe4XrshGgPkoj/G36ZudelY1SoEUBp7SjvaGbdUAMprB4MPO1s733zcNJ4IdKnwRiAvYjUPE8XW+AOO4zuBYekkfUWr4l/en1yqy+ThzL/P3rK38vtoFDAWWoGexP4ChatAvIBoNAnmIfOqaHlwCifbu8fgn0FW0ST6rndHqxNgfpaA6S3g6GkKgl5LA9sMPnVXHYK50e5SXUICfQmQzley3m5YUshXcmS/eevM4YMVOGN1wFZ5TbvTcPYJjXXR8yliTxrbuL/soHvVJnWw9vqoXqfOJsIQDSyFv0PCb9as84Ixv9WAAaZlnV0jlRy5qb5EjhKsxCLEooTvUfZW3eEkfFw5oV0uVatnUL01xDojPFZIzPnl86ukv6zYf9TOAgGLX3b1TZNHSAGLjc2jee0GgIrWNCgk+IdY6yv06IQNFeG1PyiCiSDcJ1a6zqCCyfQP3YiwGxob+NFn2OUErhGpn135BAcV0S6eZvEMFqXCCUXDhdHb1txnjQLunOjPCMJp6DCuXAXtiU9pjxWG2y3Rdo3nikbafQp59+TstTo7OAOb6+XBeyFHrR5GqHHv0fCy5NyzoVb3euwv/Wng2O1OCfs+2Jd3trxbXYMbel00mluyBVf0vW7PsgGNPPj5g/r4SYPoT/yVdaexXzM4atJrrmDc/z2FrDQJBHAF09ofVByBYBqIN+k1/55y1lfaDaO5ixNEYmByXpftdsO/J6Om7xVnO+1GAvx3RKQVJ7faDSjFyltVu2EWhvChlUem+LKgAg7wEXvlYJpe4VvN7jMSML3hLMwT1ithZbBb/4vTbgxks90o8aXbyxClZdpqocMH7YasrVwF2QpYEPf32439/doADQmyFXn34cU32o1LCzZuOtUT9TAnIIcCI98ORl7uWLf+2N59/sKhSGozA7BhU+N24oP3oTQJSkQ8KM0I/246JYlublbwrKmbUaFYWykB+GdjOwzSMfwPCBWPYryqE8hytDsCd9Fgd6GJ/+L5pWg/QbFeu+FEXQdX1zN1XVyxg9yxeBOe7B697WO1A0YAQJ7nLl1AlqieesUdUT11mI/8RyeouLmz9s7uc+do8ZRzVMlJ241l7dEXytbQiWpb6ETZkuJwsfRqK8wJ0waDCqhRAGF/Ic0C4rnmUAELrgL3AZkQgw1t/kxNfS/Ip7Mqzl+sy4tg/yeyAzJn55mGeqjgFc1o5keYVUAuPPil8wzwV5ED0jhPdCQmRZaZiZ7VKo96t3/tetDvVs7Pn+KunT/3nLt78Z3OZ8Jpc+baTfwivjr4zY8nUC7D3jSPP5jmoyTOM3RKiqiLmfGJzCg4OaMI2FTjET7MwOug6EvNowABZfiFCSLCWuZ7mv311k0e6HcBpZD+QmgibyI5GsgaFi7IHx92P9bg73nXrD3y0/6w+5EctXFQofBQVXlBfWMQSRENgjv0vLdmJj5MVpXJr0T1DCaF+oYFDbMpgAYGABMaBH6GKYicuSq9g3P4M752g2iBUNkoQMazvFCGaDhwJIvbzORTOXMdp3wfJeIUW7XMuHsGCR9e+VF5EOcZHWRucuXzvTppsunDOC1SfAuWd4vcWwlk1njr6sXeRlSYLZ2ttlNCH5Z7gE4NPq3bgtxhX3Gf3zUI8xnkAoaKg4k45rvnG/v+r07lpRGuoLB/eAsO4F4PXrJ7Xatg7m21CvkDsQVW55NTiCAD3WhbY0uX6M+GxEt8+IY2HnOrIWdZKxayNfWzPfjZafz8yNX42n28jhRAqhPCScVS4IYhMEvyq+tSvLyK61Yni4U1R01rJjBWeo5v3Cs4QsCtphQU6ZPX36n+KklR4hYuwEO9BhHuBcC9M8OAYqAjhwY7EuJdwNif90xnxJwMFeByLR4WRyQfzkp8ys4QL6ghrMCCDHAnviBkVtke5sVMUwBYDJ4NONxONu1uE+7kdhc0wVLZXQXXaAQLqg0lB12AePbqVgdDoyss4sjACOmqlih2ULLNnzIjTLDY8EAYZzOY4shxh/3f9G/d6nz3Qu3s/llw3L92/GTvLVrK4fK3q757IVRuBbTZ/rPa+U7xOY5qhyVZQflHca8zN4IFNOHMYSQsDo1O/DGD3uSRb3y3MJvOMgPBreGstxxxq0E2mwYOHh1ot5pAKSbg+NUCFhuBlzRnylRcxYiXrO4YyRN/UC9p6fx7htq9KkgxdPh/hdOCPUZL138pa0sm44L+jqjvnt5Wqrq9tu18Rn5EsAfFjQ62a46iwm2k8JTbNQd6iG2OAQRUp6yZVxzidU2g/4TjQTQGnZGe04n7g0wPrqECoUk8zOENzD9poc0lsEiEqKOE4uBB8eLe9zNMmulNChBeelWMXc081Xiagv1O7tQEY10byHNsu9fWBIDP1wzKNQPTFwxTeuHgnZ74untx7lULiNKfoWoAdH2xj9wvUvObS03mwkEzdQG09qWNBaC71RElwPoJJDM9Jb0y0ackBJ8cwX6pmG1CzK8HYEqQI43rDfm6eGNpZYKE1nXsEmkFYSFD3iB47w0gezO8t61h8/EYcjRJ3CuUQhjg7Q/PP9JzrSLuVszpGOpyBKQRCsnVQcaVS2SMXDyv+ecSLToW2wJoknS184+hRVYz2+vq8FRUvtYcsSsVP2Y6vvanLmFwGHPi3KOP7NWu2nD0o1UZ0Yv0B2GvYiUELm6nu+WAHmNzc3PZ17m5uamWcCU0NhfQyUstjH6/ei/GU2vJywO7QcFstrBcVgN1lm6uSC1DkAcFhHixlSq4LCq9W/K8a8NGPFnYH9B2QDsw8czMS20FwXseudusviw5F7JyMM4mMxaRzVoMrc51EkfBb/DHISmZ4Mrob1oAeUMDTXbV5GGZPGxCrduO2CeJCYKRWbiNVqdYpvloBnACbMcqC/gilZKORroKA28CecpUUrc6n1S3a30iQIV2Byst0Xq0u46SDVpjZdve32BGvj1VkneAnIiilWTTboKxY7VbWYN7xercs/T6vGFvdHklV/S7jVV+AGqPriUKBR/g6SIguBHqh7oKboFh5Gf5jBWpGtzcT3zRAWVIhT6t5pRcB0R9YHfqwtknkt/qTPbho6NhIWipEhQtx4cvZeoogndAaL1oWMUntN/UvO7QGX3gNDYdA7qJOTuqF35XbftPV6cLShud/X1LV21/eOkwa8G6w1QsdKFN99n1l48aQQlBY6I5tDQcd6MjKBRXbuu+IY44fJkl1SBDr4apjwDpYCKsYlqLyRR9B6XInJbcfHwsTDDMfoXuAKwI5RBfEeTmACRhlo+x4q2IjWd2C6wLlVdGoAhN3WNLe6uJXqGI0BbBQLSElSeh5lOxurIv7MH+SyK9suiV8MFcWaBgkzWuXH4UxcSJJnxUYDEafHTsQQdv0O58cHAouE55BwmFf5eW0hGG/Oo60IaxApb/1WrFuzieMcAM8mvwkVYTErGj7O4q0PG7xPFB9gwOAjTMvnu8NoCkhThSO3ur0j5EtDyxz9kD6ThK0phxEPwpHen0mGC0yCeKRaBudffkNhfZE7+4ty6n8XWtbcqUejuOaEHASx+FeaLhb9U4BDolgyOS6oQtt9pLLCcHGaG8UcgZtVgdj/OUUTXiHOxrN/4D0RbC+XQmFGnVya5szlaj6QiZi7Q2EKZz9uwhsg12aBkTHqPZQIVxVmBwjeDZmUdUPAXiCVHCcyxQrSpCVl/raZ5RmfYcIRB6rj/EKv1P2kTmHlgbCdykYo5ZSjEIkbcsXghLNDD8tq2elqeb8mNd1gV/DHjnQtTxxgaSKHJwxhHQM287BMjfrw8KKlZtyKvbA1UXIFYmTkIMCTpwSGb/SOmPZMPE9TptKIobhIBhquvwmG6LonTZrg0qLLB/XEVA0hjYjXXedf7OQpt8B//9/bc1CByfmHIktSuxCBifxPk/7JkGn0A1rF+R6Uip1ABPuvYVrQUUEL1z2OfWvqZ77LWOUx+s/rEvikiTKUnoSjxCqXSauGnRWRX1weofPRI7ot20V/FEdYqj/oqeaIh2k1aPXZg4h8O/+15pSevvuNWSlqgP9r/+zn3U+TVD29TYFPVB6+vva4n64NnX3/YMzQQYyHCo8LDKbgyf7Tdla/DJ+aoB2xg+s/R9zQGPnz/uewS1KlOVIqP6o4uf+9xZ0fHPLF8Ie6CchmhKRWIwb1Ol54j6H/AqGu2mJXfRkkq5A0ja/WZtwLfhJhx+zWRGc9lah4cNlMXbzC1DbCF/8Ez1pYkK1T3RElKZ2FC/OayzAMljcSvIzoHTpC7U5VtBEGgyIdSpfsU9pqZoYTGri0yMms4sN4Z7nXHTVGudSVqqK5LcpTxtgJ0tvxniHiiR7I1Vx+oK0W5s8ZUnSjKXxdNV/e6apPp8Veb6k40XnXGaLtyNtGmKkilL/eaiEM1xPJn4vpZQnyyWMn1lyX4yerJAXPu60p4sqiJgf12JCI19slS6+HXlTd3kBtL1k2UWGb6uXHBzPlkmXfy68tLxZ547/foRBKfvIPSfLNJc/7pSBx29a3+q2EKf8A+MIl3YXvuJC6urmNRW2kx3ZQ/WHcG72oJxnPYX4BivY99DuuplWl5lDwhEExqHTksTdzVWrS4aaW8JR9hdYD6Wc2KxJCxvmf2svQ4OUdlabzsNSjjV6Vg91U5VliwaNihRncXppJiF5uen5mBdflDyY+2JFn3qytbGqtOUH+SH1dKwLD8OcEZ+sBQO5Eerpj2sDlqvCRCodLB6Et3Pr6D7EastNG8kewh7HYt4v2kVOne+UCPYz9W19Wcbmx3yKWrLbXgU7cuKS5FjDzgLex09zqDJuewBAYA2ml1rY199AgHfgDaMaB/hQ9Wtbls8ma3dUDWxwBiu7dqk72VMSApS9ZOAaDkMANMydu0i2qNCsx35d6TZjidQyE7ZfbUg3tZKv8I2D3VKySSuKLxjEvjeUk7xutUpMhAluOF2teXdplNlEdcnltGNP5nXkI5zi+TIMI4XFOHjOL0meCWm5n3QsOmvofd1Z7Mkvr8w0MxuCiTM84kmFE+D6LpKK46/1yABDcYn5xd5QQLK6nbDOX6dVBjHCUeffwC4aRTxUMmn15oebfyA2ETPByA7m2qqqNpecBVklzFMNyAN9oLbt7HHHCD48xN5cmiWJQT4KD8qC4I6/zVUfSZxiTdaPbiMy8NYq4QQoQEdcIGeQqHshXeVpkx3syM0LeX0hesF9yYJDY8mVScSqjj0Qv67Qz8J/90hzvUjNj8gSTClSOBp9S8DZJt0QvEg8bR4ZZM0I+DxKz87hMEDv6xNTZE+hTsNxyUSjj986yJuoCZ8ipi49jKmp2F7BcwsQXxMnRGkBwyiwr9nMI4hrC0IVJDqGEEVpEc+hy+QCSJIdWHp9/69SZ4cHx/PM8qfItJZM8sH6Zmmtvh30EgF6fk4M3e+I0eXIO2T61SQvidWG8BPw27CJBTjaYGrT3j69/rlhP79acBdQ+G5wPUuaOzDOL7JZ4a97S39GTK5vXvPnt1T957A66fuw8gnzvtpEOlLQcSX4JvNBLbknhtnxxiH5KZboHUD4ZvZrj12eiecDtiACL4MLlKYd47vg+yngFi88MwGbmFGQLWvDZr5LOcnmuVZPzM/p7DjxRn9ufCnxoUDf/vQRRK/FP4c+ew0RjMAJehbQep7DcZ9cs4/EZ8+DVKT4IopTaQ33vmYL71zE5/P9Nn/CsmU/75jx3Q3vIzxDAYRHo003uqG/82gUmlwOA46o0AabmU6dqOQ/+7QT8J/d8DuUFK+mMSQdd74Qw1HAk+FX3oqTmTFRX4MpPRjUJL9I5BM+S89ERzNgkkwxsSaMlY95k2aNlOcI8PdzEWwThhkB5lKf01KFCyF6E8iECEmkgwuG/jDUxqmXZpvs2v04WV8cn5BQaMqi2meyGhOpL80R2Qxf09ZXEwOWcyfSpbkEfVuHvGUW0ab5BF/FhwjkEd3ceLh6Ldgxn+fE7IZzwV8kdzmaPAgE2X5LZjRqNW/z40pkcxhC/4Z2C6z/Xdz3gC8qcndm7VB/ROYU0tHhu2aQOBk7l75rcS/8u8HnwiptfZJ+2rIbe3CQS51TbnNgOf1edMxCwpzNt6lhn6YZ7WLoSCzu7G5rxf022Hqw6MfsaPw2Ws39juwlAEx3DwvGv4BWNiwyJJr/IIZu+rVRc7DvJAak/UjREkTbvXYUq3dgbXBOuYFY9FGtsxWvcBsPXXHScwk1BRkMDOT162fkKWiQkC9YL2et1lra3XVSK1N0nFBJk0OnBGlSmdNbadjM+9iyAFLqHv2AHI3cahbcDaA98Ejx7xWD0DAyL5nqR4ROxcYoBtq4AiECcBzjxQecltB46EWPArhT6hqYm+vZdXJJF7Q1w90+MNOvXC7JQEUw6XYxzwikKfovMwtXHUFS3hP5oaJcY33amswFHwQdYTsYthpudV4CycxQPkSTsA92E8U+SMjxEvLkVTOU9z2nOefWjo+B7Px7PLjwGAp22ZL1wWHhRDLymiuGYD9LpSKoyJslPqzCJJCowlZj3E//SRxyTdYOyq2Ub9sOM2/swB7VdaK/c6yHZHVcTT+vEFzxpyn3ZcKuFsz48F/6aO5UqtcYr8zMrMoWWuyvxn8Q2sfHKF+b8nkWlxCx9IUNLdNnHfRsLuSg2U4zI12CX3y+cwT39Ne9a9COotP3px5yPwDz0O8uz5zGE9nQUgO4Pooz8ojwpJ6VO4R4ob7GRznQi6+euZHhDAexVM3iHQ5b/x46mfJgz78Pg9DDaBIHmDvaCqF9NvPEsCyndNI5tPvAHOib3yH8C2d5+In3ZiLnx4/1MVPj9p88RMwH/IE2pmdI7Wj4wV2j9SuTj4/EuqCYrgQ/c/PdUHARJfk90zP1dc+87RpCtI44nz6tD5YrPtLNSNcgv6YhiiKgij89YW61AA0+uF/JGAF7pVyoztFXMyw8Cdz8yyeX7ZoxTJhMEXwS9X1Ksyn0XDq/hLzvhByg/4tyy0ctOBq7i53bWYM1EpMDK+GnH8utC4MxkFWjbHD0kiLYkBuJPe8ISI3LkrqGIWlgR6F+1aBsuP9YtB2yKWLMb+UIVWrxHgQBBuVMIs1QNJCuEexvlLAx/hGxxxzRB9GadFDHGZYBoE86TPGcf4q8bnixNc9agTr+E6/jPmokMU4DZZ9dbgGtna0pvuE+lVJDilZeqfhh+vTPsULTuN6pGT++DoKiLrDpHa+qaR3KmENPNDn3Nr0yC0SeCVVqQK/FIW5GBrC6fkAEWZfZlyRors1l9sTbnLskw9/bu076EEy1h6CFFmFlzUNoKze+YZP7+zi3M53BrSEssDjWgj+wTS+09KhYEgIS+tyvqDf848r+r35AEzoTCevr78PT/P3cL3rdNqNR7F3ak4aB/D6M1YzRQ8Oe3E1xT776cPNpOU0jMOJ0B57smm3ms4K/LEtndF54gYBB8GBbMpGV1qOWrV7ex3Z7kpr1VFdu6c6W7ItW3Kw13y5/Uk2kEdaOK9Py+bGp+7+qgNXPlkbPtPnP8lGd58yN4kUqikbjurYQ1yTzU84emYPdWY6AR/Dga3LbW580g2SNVsNn3X2esi48WmfTr60O3uy+VJu832f7J5C3XuyKbc3uO2tlup2NT0PuaH18xEvWAjmvW+RrBxErfTa3f32uyJcNyE0oVYWm1QOFFhy8hTs6vOy66ia+FLJXNzcLR3tHaP7vtluOY3OOim7259Wa1qIedl91tnftpzGQFr2xktnYA/gODTomu0XnTDI99Znbt+W2/u1wbIMKGTZ6cb+QHrNjvQatcGtqU7aOiWdmra62988b/0PR3qWQoya9D58s7X7USCC//nHJy/XqEWaAGpJ1aw3JQ+1b1r/gz+XTtv5sLv14s8f1W15Elwhj8twmkLS17FYNitpO/SZLn3s/W30B5OQjAba2+46y2ap3ogghElTbQm6/v3l5Tu5bUuvzY4Ih+dnZ6BpOTo+Pb48VmBp+R6ELswC01fvDi4Pv1fvzvvE+6LevQdtysHF4ffq8uLg8FjIdGmNMp2raL5WRFt5zUqj2vM5VhDU3G7WtStnC1MwPOIrAERy+7G1UZMbaVdS1nw/hn0Q9mDlT8himFgWa9EhGGVFaRwpbNj0AGjDJbUpmjgPS3yTTgnxT27G/TRc1or7afhPbAQWTKr6n1LudfZPKrhiOv1Dy52FbhD9gyXTR6dL7wNoJsgeWu/iMBg/iI698ieH3DtW/uQIM2uO0xndxSBxrR/8h9a7IMITthhArnWOuFPriduvZzd8f5+WgtYlfPfpNlP9UzemWUo32oOO03wi04AuDnhp75RwK6Z3oNkgLw+E82yqi+O3THoD/xGnITjeSNnM6VcXjS2p0QYG8m6lKVttIgR8tY45lCZQJV/9bH+z80X2kuNqlBACeI6P36lX7/qGpev44EIdnv4Avi51ePpOHZ721eHppTo8/ZHYutTh+bu/aQaqsyNNMXZyetwHA5d6c95//0q9Ob88V2/6r5hrDHPjD6+O1Okx/l0qotY6PT84Uprl6/Ti/Zk6O/5JnR3/9ZJ5qU4P/qbenf9wbKi1fnqLLlIXx2fv8bd/fFlQa528+f5SXVyeKZTCDFuHF+enp6p/ikfrX4B46xIpMG6heZfHb9+dM6/V5bl6f3BxqX48OTo+Vz8dnFyS+a9G8VW0RX/VVwdnB+qgf6henZypV5dn6uj4kJ/94vhYfX98+k59f/xXdbJ7eIE/PzEF1w/Hf1Onx2fqFLxp746Pf1DUkMML1T9/T026UJcnhz+o9/0L9ePxhfqRMv378UXZAhoc+2Cf3GPiGHiHk+ZtY0NpH/+u2hh8WtW0hQeg+jq/VOcXUKRIe+tlpy6k49TttU1nnicLQ3HI1EtDPqvHpzLgPoYUSHrNBAIOXKLUZ4LOBJQfFMI42tDkjExa6pIli5DTCbPKoF+OsQ8z4EvEaoM/TH7KliUPEf06OLOCFA38+1s3zH3ELYBo2VgPfRf7GEQVgZg6Tg2KQEg76dDPgPSiQv/WD3mzCRFP62G1Gu46YK4bCha8oh1O4kYe4LP8K2q2VkUC5NplN3NGlQNKHfTOvsqpOoNwhmA8E+tjwqj01t6Q4SwSGgESHOFi9FQazIl2zgS6DRiEeEw74TCIbgxbD3qFwgZgXo/HvpdTbCcxLi4QIRnVcUpRs2yCjxcwjJiG0SvjzOz6B4RUNFbhu24LvPgOKRMVLb3b1v7gGeKImrJpqVbLQtxR11Kf+IdceGnwgvEIcUStnqX2rK4lFMUQkUiHOCJMlN0O4ovs1baU6pNjQ2mmY73JuUJAL9fpbsH3wd5bl/nu7ncv4GOhr2JM8sitToL57u4OVKmN8hbKD4rR8XUMsmw+ELJPj8QCeV9YA1YaEGenh0o+VC0nH2uijfVg4t+pKaz/JW1SdhczcUWtC8f9SrOLmhF0rXFYKIQhTryAokSeaEuhl9x0sKtctT983Np0hEJkn03FO7zXdNTmpmggy6b2tvnvu/7j79L8ak/+G9BAqS0bGTwenhwHIwZDBaLi3ABaHEesSuH5NddotgYQk/MA4C4MMY1iEsPCRzV2OpVW8akC5mIMIpEwLOjFWU1HGCxAERz7bABONIt8A5yxxYBH0Jao9KWOwNEEgP/JT4PFWDR//9/a5ubTo4OrAXcc/U+0G7VFH6w5yj7S+IwmUZLdSrm2uUEKloPWv+/b0hkMHXVw+IN6dXyqXkGeO1OHF+rocEcdHe6qo8Pn6ujwBTa06uj0WB2/Vcdnf1HH55fquH+oji9fqePLv6rXr9XrvnrTV99fqlOggv0A7lB10Vf9E9U/V/3z71UfstRfSZTq/w3coOrHSwgGjDzhNNV9dWcvxOac+QQzch82PIlYyTUaFoUfl6HkftoXiwYzkQlX/NLGMVmYSLkNXSjpwfXSxz5rsfLSUC+vrLReihnAam1jvUWQG+M2Gv+2p7zcKjrs0t9tmpN+s9RWY2V2E3fqkxhC6EMM0JzlIauaC5UzsrK6Gb4m/ptY40nQWs5IhOlDlLn3ZvXOwLhH2lbyoytCEEdz6+AjoU19Y17aN+atQe0y+nn+RUBlaQ9J1UXHmm7cuBEWXoT2E96FDUQZP3GNJaPPVLb0enk4WG83BqtGwLBKpwhbx88hHBKTZ+FtL1eEwhRkFVma0tHxgNrozMrnG5hZZtD142WBJjmeAIeaTf5sjGBKGfgnaDdMRyzswDQ59MCkCrlKaJJMRkb1Q3KKm8BqMQF6cgQJlTiM6EIa3INYgZxVfJXd+SHcJ+9ipgJfbQlTvY61Tu98Mg8QcEYQXa1ksYLHoJve0OkM5D0ERuuT4vNKWGqUJxHj0xKiE9iAfE+N3YSQMvD7QL2QZ4KPKFcYTEeciFMGpo3GvhtyqSoVFn2ZoK3jixmrC4qLOaH4Ky8JohtOxDNCuAVOO34ilIyOSi1F2MQUH0qX7l34iFEqoMxXzAmAyHL6ifH32q1bHbBcqFu6/zoOvUoL8OXj0E+B8xtE4ziZxQlBwRRVMv8feaSm6peccXxvAubOCQk1l1JM2UJ+bwGtiW71WeMZZ2Nzf7X8GbNJqVmeXvMvPwcRgVUzAmWSHi0lJHxO+ZU6NCsCeVHRbxBd0a8BDk6nPteV/pr7/m+UymeY86ql3Pkum5fIrkS0Hu4N/6QZs3xwKdm1fm9kOqJEnOs79HjKaKAgFJdIKU0dt25iul090MOBAZ4mMa7qzqUnRVPK25aP9wk+05EPFC8emhilanztj0tA2JXs2l/RDn7knaVDmLsrjY5QXrwSxdk105rwPmwFtU4wx66khBCTRwi8ELw/W6HdFG3MOCwe64Hv4rViorD0YnBLjKOg+Si9EkunvJh4WmGwXymrSfLQX4E9VUMcrxicqdR9KD5WsLpWnyjzifOkzAAXtAQrlKfbzaH6jLBAqKN+urwzvV/cMQENr65ksdATgMeISp75vjmFj9nHMpvcEK8H02b4Hq2b/nSWPejv19esmjRr8lTnT4HeTViKK0G0wrBEJFeCzy0kZPQQWOjsnNnCUupVvk860FUFkQFZJuYowtzOlB5wXCfIoVAh4lx8D/27gg+XP9MIfehrN1MGEMkzIqSLWsTshiehtiXQDzJGOnmczlxYWfFl65qEpSVy3WC8Y2oBB83fFit9+GByVJ9PuwIZgzOQUcyVPL1GQSsjP7vz/WgFkN5p2SCeLOAYmo9oRgbNChQJqU8LCAOY68L0J4/UnZkh6FMv+4sH8kStxJGwBH/W1d4kvBO4oRNEYDksMPDMSID3Y6Y/fTpc0vt5VPZ/Dvs9AWRDIYEadRqvF601TlEl74G+gFmCLtzFSbR8XI/wMZrRjQURzlgrILFdiSdq5IdEMUh9q7lgyfMBHzuLVZMkjjK6QdExo9EEHgFpwCNQWCDeyNBNdO+dn2Z0ju8nwIQVfLg0QdCEwMVpMt1KOZA5UgsNY9UTBsIKnF/j/FH5Zn7IZ3SGxL/giU5g9ZvFcPNBVi58LiRnXAAhb5ha1DtYjFOr+NJxnXH8kTB0BkjHdC9WVsoE5PXUopUxtdTUdn0Hvhmj2HtQZpqN4hy38m40tTSCemqpmR/DcQKOHFQ4E/4AYzxdQQ1gKbSMRs7iYa+T+CIsmkC1DCes1OIPAb/x1CeRCq5N15WVj+qnrxS//j1aQRnwC9XerX9NVCWWuov5aUzv2u2tzkuCfyExE0qivmjUIUlOZCZvEXu0/tIxyv067K+VSwOdZqSHTnGpOXdloUCSXCOZsHhrzVdG9+FiJm+7SwstLwqNM61v7ooBQVm0C3Cz7lMlf65gbm8F1XOpz6diGB+13m5oFLQqfAaQ0DR+xpq5ylFrhO3pGFRPGsbYNjHK8GGcxIfkdeim2qmcPWqMT1UYFl7AGAlaI/3GTUZQ52q/KX1nFUnei8kh24vf+inIeZQX61xz7sqGiN7AiRo0nSs/O45ugySmue5HM4ld+Vk/jOHSktIvpInJa4Z5nJwFIf89viUN8CWAWYP0gF2bgpSup/BZn2p1MHg6dfOmDJKvp2f2d2KGaj8hjx39C2/yg+SKXPVNSASo1SJyfYpB2Jn6/LesiYRQn1oMNBbwfJMMQ3hm2P0mfUibfSaWNzjoEbEp+Fn/iUzcFSkIDuO7Q8AzAs/lDBto4+jMTEG86b0O0lf0apEi4+F9VjgpwSHp19w/8TQqDRUN8bKKTFvBXTfAx+oAxM9HTFVC6bfBPXwwgysE5nCFr+J745t5+Nq4gB++OQG7V5yowzxJ/VQdvXqrjs76F34aE2Hu0fkhEzki99H5uyS+f1BH530/oavkkVlQQRwZXd3RQ3QajBSHBxzfg6ELp1+/vlQ0IF9HjFv/GszXr3Py5Hpzqt6cHqs3p/1xQBxJb07f49/hQxjQS3hz+v4vueuBs+3N6fs+E8+9OX1/qb6H2eQE+MzqZMozI5w8b2h88J94NHpQp7A6pOrt0bfq7bvnRxRaliB5HOmkO1PmU3kb3wbE/kWxHNT+M1ZBnrP15HzmR29O2VVUvcO4S9UF210uEIyg+m/entKfY1bZUPqdm4BXpv+XU7zLvolM0R3av47vTANooD0culmZOiTWIdUnlk7989aNXKgz+xQT04cLY59YV/WXfomt9/ujd30eyu/fAanZD1Db+4tTkMUl6ieX9zw/+e4NOo4BWqsuwp+30Pot4yu82th+BiSHDeV02Uii9mAxUR2rg8jcwtKidR/bcttSz7SJZWNDaxdKOClt/4Ghbn/fIrgIi1FUR2evAEsPXePmJuHoVnEBYZq/gDrQ9UCjhVnxFzPoNdAfGe0eCMYpcj1a2BVRbvHjznE6lG6ttpc51gJdx3zkx4Qy6/l0iJAPuJRSIpio0B35IR3Mw+gaH8YH861fB2GawZ0JupdBR73EStJdBYEBr08UjNxWHbI7zfjFtC3VEcgGdC17r9dsyNazmtpadxhJz7YGDjLZL6XtdMCI8HEtoGvKPjj0j09+OY0Th5BB4Ca3LeWvaX7vqKElPQHYsGGhDeo8QvOkXZhyE2X7v8zuHTG05nKQ58BoaNGo+q0KGPgbgAGFpYZswANuyKePcKPalpKbO5q8RasytNTuutzioWxvUCEdPLWl7HZn3zzn6pF+qpfe95e49Wc8rRyc9p2OWquvk3miAk1ZnGHNncGSShsMx9K01xnItu3Y7b2ew84UJqZbIqNowEOkIVOn3agVYUnwbdJaNg0C2JANe7DtPBYtwCpDijxmYuEOXVPAcK1XkKBh5oZs8VmYaA1zzXCKj56mYZSTcyfNGR2FcQekP/vlVrcuyIZKfnG2TLdIOYkgmw7kxsi/g9mfTTtfCKSqQmBWYqq0kphhKYVRqX9do+WoTs0RFeRYQql0CKmycWppFpJ6FaayidiU5QiWTUKwFF8mKnmMIV2csWxvEsLBdg5SFqDjiOuAU2ltzQGmPMXx1yohcdqQ41TRixsU3V6BNjMovAUg8QDW7ifv1UjH+p41HRf3u25cE8vwyne2vtNw5RobVO8k8GagKm4shrb9o/Csn4Fmxaqf/kMQrZ/DZzVoACVMK1QsKWsOTExcRH/SMgbOT4jjeYlXPmtL0tI9Hx8A4T42DJr9Xq/77BO4aiw4zWxTbJqBv07LtYNa8AdgwcZzQLBMSgZdPfSHkAsRg7eULAHxnUYitfd6dbGFKdraUM6e9rJNt9qWA5T01Q2h/rGTotEr/l+Xo3kb3O+bMConlWxoU+9LUYUMNJkLvMLiJGEugQCiUjd3+1c3gr7zsn4uRUNN69HMVTCOA18XVhGCt2S8mVFVjJLirdK7pPfINjZq7Op/f57///o8RXWMt8vRLdvWXgthsQth0ZXXzlAqJDcnxJtYOn4txBtHzB4+/4ZZFu7HU1+jJ+uXPGe61sZqjqhyf3sw3GZF2DFvuyq668/EHRcvc+FV0Kaeen4ucqhAwtaqh3JHriOQq8Rnc51q2Cp4q0RzhNk2fWnTxFsmEhEq4NdEKdLjrVOrhwgSimH+IrOIdv6MHtRB9HDhT/DzoxsqA3eP2EVFgAYaWkTj30fYHUdX2OmScrFPo1VvHt9HAUgWNu2B9GQKafyuIa1eTQ32CGVydj1j53/AafPwIYUEs1romqG/glrWTAyalaoIdzIOOVMiqKq+6yKImt8bt4mofjDYseJQcKtTF85gb29v01L25kunRmm4rTQ3VSEPvqTTa5ay13QWg6jbXCtzieoNwE4udloFTAHjPjXFHAKUFsc/IMC3ydM7C8zMIKkN9qrVIxv6HEUNif9GrYhZxhbtBp6gTo8gNov9QFtvDUTDkjsvo/jOi8ct7hX9OHV6HrH2xC2qXj7o0iy7LwXeVBaMb1rkxeHp8vEZhP78OX6d8+fqcCJXAzEXob8qJTFM8iWSJK1KBtEc1NcLtGeGDq6Jwbq0lXRq6xovem1Tbq87TLNhN7Ydo4qtlZ1Wo0B9yt1wKAZtVW7DnQ09vDwEXVMLVE5vQocgABJWMF7UgFFWY7wGGhFvTs9fHZzC4+jy3fDi4KchomqGAK2GZ3Ln8Pz8hxM4m/+o/cwRi0OBNxfHf3l/3EfgzQUcqPvH/f7J+RnRoI7x51YhAGeY+OksjlJ/CHQeuHJcz4bkUTxNr4zmT89U+ssg6QCRfEpK+FHfSek0O51iMNI+hoAn6oVzD+gn8tTnQH2DCkFQVMveEe/N5eOtXrkY0zxK0sWy1y9H1ToWABywBZfkCfvULPJ4vjDktYa6Q5ckBGbu1phN/nW7vmU58wXzUi7rgmvA/EQaYnQDzU3EQKyLU6JatTEG81xlWlC+g0etqXFrrsG0I+EhqyOCpMVQa/+EVkUw/j3dNjN38spIcTFPNuKLTz5XIj2p549Dl/XAdam0B2blAQzkybJnempga9j6jhaTW2NWnNfliJZhjCcYIPFl0MCs0AKlvQ5MMx1tTuyZdMeBPqsYFoUUDDQ0GnwVJBb9IuYEIrbDLIjAePKKKBywfnB8vaAk1B4GnrnBjzyISPzDPAeRx9pELR/6kceyB8tbkEfIavOERB3Nm3OM4lO75S8TswtvEPodxuwhWBG6yUtkTnUTpAiGYPsNS2qVGHeMQEhuRETL1hxjp3kqRL3gKzQUT/TLTZnjptWDeQ4/Rktw8HZBq2AzKgW2+zhheU0Nh9dumA21xYw4rez6lp4eFqYkqDk7Qpg92ef0WZF/Rx9OkxpYbteIBkiOaMwYXrklE6N6VD9fWZbZfCrlt/V4oqZvgFwmWvD+eGgVQINPzOtFmV/5qPiWix3waMnjfmYdedTfsrYse3Ht8fvpPJ0f14qJf0k9xbXP1fjEfL3kBS7J99knL6Y/zYandZeV3JxXr4slpCUmnMcLLMkpL7vaWULPsqx1HJLa8ZvW/xg61TKl1AKrvHOElBYXpjUuEhTYhpkFDWj1CuU461SJao8SUPJBr6pdcvk8UuZCYUSiSzpNFyu7I6btk+0yAsYQ+c1tmEof4D0L21VLUpgOAz1ZFpjLiakP5qYOWZiwh1rYQGlqaAtbqO2BetbY2Ou1my1wMzIfFXh7Xjr1fSai06ZLjloKohsKHIVzktmbc1QXC1FsCCg4GkYamdxhZbpW/pSsZKxWWmd1qdYxMb0MEZgJSz19rb5PftkYC3umvF5dftiHJbNkpGE39pS0unTSlulHR8xre5cn53TA5p/5Oj6K+l4dVQFkQGWZ6IG6BSd6ogj90E7z/YJFaE9uy92eGFTwuiEuw8TvrYweVD+fzQCu4xNmQUeUtmP42jHkneCAKe37bMu7mtOslXpxBM936BvEJcaQ6qiaqPMX1m83nqq9U6m+s6zmFV0no/Ni725qAICGsGrcMri+dlfEAC9dc4wiwLDOBGh0qqOD5oWAHemM9FYrb9n54X10E8V30UqfocBqBctKg+/gJyauDmgL4BDaU3xS8Iw7f07TDgG4d7n6h5D0bHm3X2s7IEqt75udmL3fduq2TLedp+/t7FMvNFvM+dhFAWboMx2LaNp1sd12in53sxWeaWrtbUeV98tt4oXi5gPDzQx3JpLTMIDwNuOUoJdtCM+Rh+AGHmdbsJUVm7019tSpU4MZwXcc50kAzNjpiDw1ORrzHVQiHG5JydRP4GtBVmmheSvpTUM1RFudg6urhMA/U700iFIpkDYpG9nYhGWCpRpLr3ah577w2WttoSxAo/V4gigKeXRFq4WK5ij7JHCMDJeq/+neuvSHARjU/4zDwFf2aejE2unhPPJ/Ain2u5kDH4dxHKqiPeoC/gtpdqH3qyygcIeUJFPj78lFiXxwdegsLWQuRAvT4RxZm4LHssJbC10gi870Pugv3Ez9e3+cU/MqYrCfLPViItDDSkRqBefQCL1BVnnPJOxQnNgSe2WQDg1GJlaDE14ZzvNMx+VqZeU7RLOmaXXMEBVURfy9Jb0lC7/pOJ4ZdFIKsNEDTLHaBWihd9EXlcTsQaTxE01YbBlVUxUYtKF5v/4o8uPpNTe0Fun19uw9/Ni9bmO1QsisbAukufvKsclojiDYdofx40gLiYBT3uNCHWnMBYRyXOw3DWwvVJOEVgutOrxqDCttgVWqN5+DupSYKkslkqgJSDh1JcWTlN2yIMUzlHiGEG9u0sBcAT0eI5OSTq+O5JN3E+1pdRfxD5cmR54/qWpOmvKVjtJevnExn18VjhuDww+xtTRR2wWF+CPCPPJUKQLD6Gfqg8WZHcq9fGyg0I3TClfJ612bRpGwzNiax6OSI6m61iyY+XBagdi213PgH2Rp5BmiYmQVN0aWvdeznEXfoGVAoLIuoCGvCwYthCSnsFCSiCxpSRSyXTc4Rg2tbCRpz02uoIPLGVkN0pV2cs8ejHz3e0SlpvzISjRSXLIcZtfknbw/+KYl71+/bjP/YdcekFpYWFrXqGqFZFSRJSGy1Or7iBqahYuS3QJbYwWwX99O7It3zIAu9pvGwYXdBs13WNr7Htl8KhB8RZRioe4Y5VfQwz3Se2hQvviRCbDUV7AJoGofmoOmvfKz30ml+jiGsTAY6Yjh382o6mcLirIFoNqKvSj3CxNRPCmtb0vsQyXLXgVMRbXFMpJpw86ox8ywpomNzMBxlo8nR5gPX+QRa+O/plb+KkckiJ4pDcT+gOBKjoeFywoknQKi4PeBzoFzgJlQt5wlzkpz/ND6sb+Qa/Uf6hysDdScuni51XYGtBVwM1oJ9feDzTN2T+1fUrWXsxzeUxSDifNDHmCpkvU9N4qjB/A/9ojfqcxduVJTsk4jNHJDTGp1UziIiepy5GYl2ydL7ma/2BEWpv8O715EmbcDdyutoV/eDXuO3a4+PzCRed7M8GVgzrRpXdCcE0905nwfNqSj9+UdA8PDQadNoXuwPec7v96l2Wm96yiA964LstF0hXrqgmh01/GP/OqTpS5tdjBN750P32y9+AhPOV7mmbudxiSk5aU3qp91LPfPJRR442ftIbfpaNcmXoYd40faUOU3ssA0PXLhSU5TzcgHVfsoyFISvuaIL9hrf0FD/NhbVE+Mc1Phgr6WJkIDJFoJ9E60mEqTn4YqJqRuA1g85xlPE0MJp0L4m4WZG3/cMHDTIiC7spzj+/GEkq+YIBIv+Bt7FN87DOu4VL9D88MjbQ5RN8+dokljMitmjUrmX6xCnmw1G4Nn//f/sVGTEtIAtqvbmt+Z4IUYasgwPdvdjnI017N2QhYG2sX+9LPnb/6v/5vTgT9oOR9YjnEbPokm6sw9Q8t2vlPPd9V3LyjcVs0CmgX/z23HXl9dGPBr1bnWwBEtDMPNJ/IUDnWNTWEaUfbrh52tFx874sO/fayeUI8zfPex84Uc3358XK71hXteLLmHkBS/cN/z5fc9/9J9u8vve/Hlpy86bvdb+5vWt47atb9pvXCkp3akJz1l7xAcpEIcu8GI/HJWsaSub7a4J/8p1XWWPv+3/7THm6vqibrn+n55pu++9IJ2tv7tY0fHVXmEuy8s9U96qLIWQM9q8uqSEiJ1mnIbPI+UbqhST8vfJ838yCQpE9INctKF9PxRM5/vF1xphAPaAkTo84+C6tyXA52L97yvj4aH3x8f/oDIGp2CX4BOkhMBPATenvQP9bmzg7fH6t3J2Rt93D+8OHl32Vf9t5fvzKn+Kf7RnZeH5uz7I5Nyx1BgcvxDNsRK4BJjj5v/v+y9XVfbyNo2eDhrjuZ05gwCCcjEpJPu3bMfBzDGFuAdY/PYJum0JSuyJYN2ZMmRZD6aO/lX7/n8tFnXfVdJMpD+eNf7zDszqxcLq6pUkkql+rw/riu7cti1ikM8/CMEyYMS+UxmnjNdLB13ptaCSMiBQxCJYie9cRccXiRBnOhcCxF8OIxChoQkBG2Wk2TskcgpWemSIPKcYCZHntgQymKaujQFdsFM+F/YJ95ZRgG0+k6aTCUFciM5rpZXJ4bxpeOGoQNQMkZZ0yd0+XU8L5BOWC12npqVcwah58A7y5E84iflBIs8yC+kI8gE935vskwdJd+RahJ+e7V7coo9jeeH7p38OoIS4CQAt1dJYQyyq+ASvrNeHGUOliefUcC5i0yKFkQDogeF0E98lWGpgsKQiP6cVGFIUhoFlEbzhaPrmCPJbJoHrt8UwR8leJ0kC6hhF0AagFwBa5MZvhbMJwUaDpujWeheVkev3/xoY63z2ZGXhJoSWtk5dvezG/hb06WbLByFyY4gvwA03xwLwWrDX0Pd4mGqgivg5DmD7ZczqpTEnyV+evVU2lM30Em8LoMgMNVhrnsG74jcUkmFYst1NG7dlZteCURALN/+Kri80iWGs6Ej/ZWu4gW3QLEHWmjJ6xV8CcEin1Lghb6T3ZakmFfBJMicONLNnQWbHFGhIPSfwv8ptYy85MHCmbnzILyjYHGdrnbrz76/cMPg2vd2p3E0o89+Evmhk9w6k+XMYYb7z/4dC0YnvpuVW16etkx9ZxELGMejXooEtaFyrpPAQ0r+XaNY11EItUwK32oKr1NnFi7TqyLkYOkdLzhB+ZUiGPkZCuFM556TTK9R5PS7J5xZDOvD8ul5HAVZnDx97cOT5evhSHjnzIJZ/DDuKNk7ktkXVUJ30dTxXH8eRwD0dkCyUIw+SLmKFynN9YiIgWd+VZ1pY8v5VZXHn3kQrV6rugHSk1s+ZDikU0cPGRxhuhMO6ZFrDjicRQhpPbeD3N7DgcTDCRYsvRcrbCdYXP9MEWCCJnGCskV+5pQtREoxZE4pmokvex5wmIkFuFN5SjATfro8Ia8QNAuZ8aJYD1yOP3eDMEUKhxweYRFfJD6scCgquXdKnieSHJZNyQdTBwdVvFzomEi8vDwKGAb9gVkkVv76T3x5lSSjzGoM3Spv/fpU/imnVyIaV+nc4FV4uaA49PI5k6sErGLx3L90CU2HRZyO2O5gQcAoH26aMmsBf36AGTBM0NR3fOBt+CtJl4kbAZ0D9V9O1w1G17I6qoaXfzI1qOjj4671vROqW60MSuUIXzmPMx9zWhx5LkNB5YMoyC3vHDdZFCFncR26vEdOlnN1kM+owmD/U8HlQsGrOqkvhHYhz+dMr3HJVHmX/i2ucBRxh0oIotWEKFaVL9F4IRizEksBdUUC4O/k0DscQ/XKYK5tpECUB8spLA6SQAjy0HYCj5LU4cFfmrWvZ3s96YPFjdLSsJGqYSO9WmaoAN1EH8Tzb5x+DtRCAcOy43peQuk8WzhuiDG6CBariSKJFw0cf7hK4sRimuSoqmRebqTiAp3GSXKXnyhFHDUdriaW5gIxLMfAlGauuGck2XKRv+5KtChWidfECRaucAHpBK71IsayQkSWGMo8XOcvlAMIZImMhzeVJU6+gHBuBFotg3tK5Ga+6jW6BLLIm8w8FeJ2IEFZbUh4xSiXV4XS1ySmXlJFZO7IslCpEOdu+pn0uLHw/YRKC2+HGQAlikuWCUD8eAhHD+J5PfAcL0g4fD13p0wVSMtitr52Q1kBKrxhzatSqtFHKY5/y+scLz9VtPGVlOJa+QA6phrJalTVmUpk+GWU2LnF4n/CkMhoovhxGLv00TakvO34f9sytbwU/d5Cs1gPyvQdLNQs/OSSS1YbXGk/lSM/8zoCZaAnF1i/s7j67sLqDxZVegv356bWRzPmw1lIxpnVbV95uyer29QpLYJ00oIh//OB9akBUY0m8mVlBCh1/gd9VKNw042bzBkdCSNCjvhBjUajQY1TOmo0312cU5OFBa0+nTUGQ7NPZ79QtzEkZvwYDGjQHJ7ToNeAkICGF10a/jKEmIA8mEhQOAmn/JNQOKX5FUVfKL6eUQLUE/iu0U04pZskyck7mZ6iuurbP7LuLTDETdd2K8+UetuGzDOXp2/B7EahWTYAzt8AgP+w36EOoh0Odjm1j4Q+JwxO28dDNnhkt47huwvbGVk3dbhtN6qmDdFPnb7zRBiiWfaLHMg8yEDpKwcgQy7SNTe8ce9SBgzjeBytsRHyNF7cJTwOX8UZb2aUQz+F7h2vhRVIh8xOV8EsW5slvp+u4TZlHHVRWd+BH9tX1058f0FaPcAAMJ7veniK91mg+bDEZfgoNF9cHS0Z7j0FqlTGSDiAsCnQ0d1rX+kvgfyxTAtS8igNlJpCmlruVKefHcVqBRineNM0S+LPfmGOjcEOUxXrBdaQwVBOMJ/9u7kbkRw4rwRv/Al9ns9CgJtd+4khtlUX1o7Q09s75AF5NzcMBQ4v7Fl3DiwLruy71u5o29h/aYtvutbvl9XsDz3foca6N8o5xNmdOyscCr9n/vH9J2g6LLSlTSEd+O6jnomZDh6Uk2ZpXRMcrGipVKkgu2JptmFsWUeHYqxVK6jfuRDwGWNvMUN7BT5wUZgyRq8boW2wvC438mCU/rLyfr5wmePsd9T40wSIweJ2mQMPP0EpC3Y6RZunXQ0eaq1KavtcVy9OnWxgpQj0wBL6QPiAewUpAQiQ84Ifj3OvOn6KD2/Bjfcn3D9zFT+bvz/yBs20jl/zCrhBCA7nsrK/oKYVDZl2Br12E1iMKGxKBjDOeQism51DOtQjzydRLn6ydz6RaCpLTk8AeFnNUZy/l0//w+j2F7vE3lao2gSuukI/jCZH9kPLbCrr0/RYXVKwPVDYl86MZscdG4JzbemlLb9Eiba+Xa+tIwzQFetV5Tk7oMIvFZgybNGjVXe5yU4QXcMZJL0KKb3C2vAqgV8GnsFufJ8+fdIOkZ8+faLR1SkbGygcbraWevaAmk5StzQ9HR2KQ6dArclUgDBw0A3tLzFSGM0wN93NidAsD/EygZ+b+bwE8PwpgAXzHnG5DDyxT2PDNB+2esotNWBpRjHoT3kylzbDbkVRFqCruulUMWYq1MbJHTHtLKMVpgizjQwvGlKDrUmuXGAJA/0suKV0OZsFt2Jm7kwBSot+y6vVwhQnnZY6q9jWMF6+n+BmjtIcB1gLCZL4aveM/ETAyPCyMcoU+rOMeE40+JNmAfCJ/XkA7ShfJXdXSayTDj77mupDWD7iSDyCMmbfFAX1l6Wf3DkllHFFUe/rddL0yp+7anrzFwrDWq1Ss5iuwZZaIIjLDAe72x3ZjmMMSZWTY5CkGYVumkFJtM7tINe5HicBHSeB597RWRzhH8EB8LfA0cKRZYR/BIdXS/wnKUeWPv45/MH38B9xLKfEqCt1lFj4UtVgLt2EGstLavlTOvYn9C83on8tQ/rXMqIzF2hkd9SNr6k3zWjgL4z8Wsu7fwMbMz7W+FdMMzTVojIBy0HIWR9nNs+G9qg1sOnkjC6MocEWPZZ3j+kIniq5HRCnVfl2VX330drQfup5JXwnVu//UZZf5REC3d6oHudLgBUoqZHpl6wFlaX+nB0vpjSaR//NTmnkXc1Tm+YBZjCW8xD8lgF0UCf1MkE0syb74hfyTZkZ5oaFlC82rMJK9TlMcyxeMVn3WDaEaaYxX4EO5mbB3LAqdcP6ahQYTvuW5UeedW+9AUiPKBHd6m9s/mqzS3kFRlQK4qfsbrwJ//FNkCd95xTbhea+4hbMjSzNhsgJ9mp53TC4jMj/Eokbo/9lKYuES5fpXeYs1l2G2Fv5f/Ai2/wmsnqcBmzSN2XrSO396ykj0QQ2x6mvpmFDe77LKqYO6pnxV0U8g5suk/BRGu+uBbh+xiNBkDHnduJeJu7iipFlcxj7dDkpzqTLSSn90amHZ8sZ8P6/W9gRN4wX9ti6zx32t8cCCPAKdtSYQQxpoaN9Rz514b+1bRi48hXDO+WYYIurxfN8JbnLy05V/8+tr/B7v6eNcv4wCO8WceRtFBk3rK96Sbv1acM2RtvWyA7d+cRzNRLNmKRdb0GVTRYpxTap6RLuft+/A8fY7YRvAYaXDW1aXRSMR2Z/A8vUfSu1jY18wi7zyML/aNt4ZleUL5KYNytL57fPNpQZtLT7t7C2W9816PF9NrQBLgzH8kZrVDYEiAFOTX/f9e+7/n3Xv+/6913/vuvfd/37rn/f9e+7/pfcFetYTtL+ef+T/rFzUi4hYnAKc1VL5FpV68aujPbJFsgDrNKFEhfbg60derlDI2ds16v8i0qo7ozXD3Ydm8Ti3+DzjL+8u46Xvv/KG9q9g/E3rkgVs6x1GzALjpO7Br3K3USs++fgKo3n2DdaaeV5Xp+8xeKzfuStZIDfpmCuWfc0eg5UtWqdqrxV+4pv8Nz6ahtAzFUujjBeudQ+bCI/YzHC1F0wtrwCz+BHaB/hOSTVC/eSleyUuDeUZndasATBr+ZNKiTld9OQRWyJwLmvAPuw3qaMo6MyiRVfGHyB4FCbfygBF7ssJ8DKYVWb2qaKQLnEhad14i7bSC6jLLlTxiJO5l6mBFI+lExxRoQxWNASRSTFjFI5gzGCLPznu9BTd8vJMpWvtrNgjgkVUVnSLJ7D+FYFHF1EoewMUr6xo/iUGXM9T1sA9tFVvtsioHTgCx3DPpS3/3xwGFeDZrF8MTZ2nS3DWRCGXK+XYAkKpmL/cBnMMmfKlBXK4hJUTBQwJQAEHU4ACoYcxINBi1gwGfwmRckLOvfddKm+HchBXZBSuDNGD4LNRii/jgImjBPGZ2Plg3sJYw1RA+NWnCBl4GAu0shIqYwXSezBD0cd1XdgwFG0Vc/VFkHsZU9JPImzlJSZA8wbcqUz86oBHwkWlc4CphjlSPlTrKRLfaVXAbPX5cYxV/GCfxyuJPihZz6Up6xfdNxrNwjdSRBCMZ65tw6LjjN/vmBOyAxSAYHTVDRfS1ggLRJYPJfrF3YhjnuJIDMk4cgtgX9VFZcQkm52pG1sC5LKikCXYHdqMP4L7R3AYZgFfVSv7VdLnsNayq5QK1kBMdp9qUAkrQljc1mTURViU4xQOJnaxidhQGTB4bf1w83n4/29g/uv1o29szX2/JkGnfhepjFj5lWNOpy4BzuYlb6XlUXV4JstOYP/leCq4/jq/7b4GXJJYP7tz8RjzPNny4iFgenvvAREzn+pKH+hVLnoiVEAt+u1F/XvF0Qk4b+XwxD3Z8t4wSod7471CQbD0ajLQVJfYdr35S1Jz2MO64c5Pvt3jxJVAZj0pcqMWFVWjddf/E6hx3D6YsSF72V5+/btbmWjvvX9HLXvn3p5+Hs1Jh8eXUB//9DPZjQNqzy0svgc+mFhrsfcyDqfW5C5SWbwdeRmD3GmdLNJjmWhgdtSP/tSIu+rauVsQeIn6k3dGN0Fq16hu5Z5ioFCXIaSLiuYg0iTgaxcrlReSMS6wrD1CdYsC8FS+SS+wYjXQFEQUqZOrZ4ZVXfs+oqXcymbtW14/kw0dlCq8xyoJp5rN/n9LjSWdq6K+D+2Iwk+ENiJf6eJyZN/p2ONtj69tOvWNo1Y9mszdJCCUChctDdyxLAqg4eBrcNz7BLWzkOI2+JS2E4wki4nPbONbeYlMLZXybSsN5pLy3oDbi1jewu05Y+yvc6zvd4rKUbsA3bqTV++tWwDj3vFHmA5JC+zkLFdB8PEWq/EK34Epcsr69XoMpjfLW32f/vehaPxKzH0UFeVr9keEzOt7Yp+8Y/gFR6BqCve5xwuIdR0eaUuAYwjrB6NeuEz/AA1IVPOwbALz4G0c0pPGDhrk4hVrAM3KwirStw0ulszvkwJ9qCg52TYA35zZS9W0rAqYAg9UAh6grFOamCa3GnoCO0UDb11joK/Jgx6DxAgoBdf4+FIOAtFzZwQCgjTDUFoYMUwzA1UyVbpBRUUaYz1OVTUjO8AotHiPZiX5oW1a4zGL2xD2Agsr6K5qr9pHhtaIQopmEC2C24Ao258t/OsSU+TQ220/01UlHWDJAE487KdO6gbIP9hF+faft0Qi4sRHdjiB71X32OipfU6ffuG3xHt19krenSwX4dJBx5/UKcDaG2ZlgkES8+fa2omGHl8q+/jHgf0rf4N+b5x2gHAvmH+QdbYGrMJSN1mYHwMGARqwU/26Pnh+obGZPBkUN3ctW544+hWZ5ZnQ1st1l9/kEc02Ro9XOgCFq/f/JOu3HBGgXL9rGjEGj9z2ZBpsZg6ki+LP/uRtNXbf/7szBb//IED8/ltCUSGf2GiVcmV4Y/00g9QbDTCoVZkq5R3RdL9mx++6nxnHbt04sc3+sRpKfUnAJ2xX/pbcGmsV6CyXrFGK1vBrI/SzF6jNevGeGh4BpOYggZI273scst8QMxmFDzjCirEyCnFNb7DjuAs7laoAMzbrRiMZPP4Qmbo2l0DKh4YkNiZAdZrgjTc6Jj9ITX7bflpNxsdMs/M/on8mt3mRzL7ffz3+nTcaHcu+iYdN4aNDg3M92bfNKwJr1P4dh8a/S7hp909oQ/9rmFNboTQjE+32oPzTuMjtbvH+O9RtzdsN00aDBvDi4HBRgKx5Dw6oZZ5dHFCx+0unsGemXwKCX1OHgxp2G80TRr2m/Te7B/1Bia97x8B/xhvqLSqlk22hoYro2vyZsR6ZU3EonV3zba269bNo5MWCLNqpVm3umMb1fsfX36lff61KnyorlXXZBBj78pswR6Dad2o8Sw2tlJ6+XbrmV3Jgwe7wGMB7EfVutnZhSuztoP6ofofVbuE8VekKeBHQ9uHwIFb9Qxx5r7/8avuSjM2cxQDkFIUAAQ8lmoowj94YuVhUl4EmI5wZ/nn12oe/ulPhF+jy2mGLynXj2+U07YeB+zayLJe2aq6anpYe7YFQgdewtd4t3hAQJJiLATrlXXzRH5YlMGSZlR9JaYzeWC7XhuyjI2fXDNY4JbmUYP4SnjOj6qv1mxd5W++0l+1GeLr8cyXP30d1jX2trJ2gpkT2zctI7FnWvowXRJDI22u9FefaNT/ciHVw9Q7sv2kqooHR+4xL2u2Ho6ttK5smN58rdX5QL+K3BGWswC3FVsj9bV3SAPVkgKypWuh62Lyjnyor6wi33GzYPQKa2Iojjrrxhi9rdX39g++vTpc33z+Yseq0hhfv7JhA2nM3n1pW5Pe0fCDleaL0nTYafXxgkfDD7s7tXwlXLO21YS3Yxkle5TayDiIn9V4Aqgxrk1NsJBq1pFs4b+HxtTIhw4BNmqscfaji3fv2kPq9npH1L04O2r0+dCnYb/XO6aPjX5Xtlf0EqCpPJbJDdpna+3u2sc+tc/WehfDYWPtY99YMwqI20o592nvw1r717U2tdfav1L71wc581J16bh30W3hviftszPzlE6Gxz06bbTptDFYa1DpRpIgNzxeu1gbND6uDXr0VMGoPVjr9j5gbdgw6tQe/poHf6V3w9Nf+Ofoo0mdtvlOnztrmO/ozDw6MunsXeMjdc3+cbtL3d7ah0abemunjfZa+4x6a/3OR6tOvXaTemcn+P8wPKY+Dc56vcEpDfoDGrY7dHF+3u7S+/agfdQx6UMbP8Njq04fG7gDfeyXqnrr11K16+rB1Ecf2iufhM+1h0/k7vaGdNQbnq4NGuYZtdrHx/12d0g84Xao0f1IR+2Tkz7n4dNktoen8Bjptei832tdvBvSf170BqcX3SENzhqdTp8GF2f0odc11nrHpVII5vILeknr4+0DXj1Y2I5YEa+UIwxhEdtYHqBku8KF8zgHZ9jVULy/k0HvK59pBMUHJsE8rDngSRdbWyGzksMbdfxR6Ql8r2wuLzuyfFfmg+BqvvC/4Fcw/r+D7q9Q7oLZjLzgWvZsZWRF/4uSpWi4/pQpsAquZUZI0CClbAs7IziR/OaXgfDoUmzq4fq5YlkPs+M0mMJw/t8xo0AR5xGD2xDiawHFo0gJbOIM9QOPKHZPZtO4TEQ4OVLUTByiPKhNviyDTPm6skMI/wSUe6OuAPVf5qHCfjdO/FUXFa4txXiqHi/bTNhaK0t7tbmUMl2rQl1zjoe29tqC/CEK5J6Rr3x5/2TkSFT5MPkUZB2PkA6P9nUGM95cuQnwxSEzGX9bJyCY1fa1/ShbCe4dsAFpIef4Dt5TAb23K7yQ49oGzOc0dL0AoglzC3rCJtvh3X9VubBWGG3f24IdPRrXkEo5jB3WJ7Zh/NmbWdujw8rzvfFO3R61jm3LKG5fVcosvWhYgeNlmFnFUiGb9WAWQbjNR/9LrgkrfDSUb0aqz2gEV1pG6hbXcDo3BCpbPF7YC931PDF5564NO3f2umIPKviZlnqZLIJFSVCvVeMlhALADFBG+qwvYP/2Wehel8CCL5cMjgEl3ixW/clVWblXRXGGZ8HzJAlgELtwuQNl7ATA5Uyv/DCEw7HwoixIzquyiz5LbUzoJgg9VljdMLVcjTVSqZIz4luiAoTra2fdNur7NKJDe1R7i49nlx3eRv/7py372W6l/mz0f3zaslfoeZT4SJx+hDdAc96yepWsicrD7A3Flfn4o4DiFMauNUGgtIqEO30S3xj1a6YAh3VxAg+FqRtCEqoywg8pZEv8OXR2tIhZNrv9CNV+xaEiL0xRfJAmsl5pHieLKyaG4Vv8ydIoijIli9MCuAfQfIzJV/DZlb2dVrD5FInKInEv5+4fg4vmwKKoTkVSEmEj/dAJuuRF1L3odAqvS3t1FJPRqrRKhehJrXPzDZWseo36bZ4tqIvjw65trN54V417+Wn242HqhGq1oJ9jKYjY0dOIuQ/HewcvqIahbR3m4xtohSXgZ/t5YbZsfX3+fHfHOnpM2v3ncUVFDhP8G7Isa4KA2tIBvfSxmFV/30cs3eWPKf2+JBhduMmMHVVAJLMI8q+oxKMlwGNrtz6qAEkMjkiokNohM2/vfxNE7Lpwm8uCabT78q2oGu+/rttlCfl2TgNN1arCFnxmWYc5umBuoaKNUZ7RoeYjEDdG6+aVZe1W6jb7wMLpSa3IR2/39w7kU23fW6OSNrS0AOK6EvWL7gpi0rDCw65m61hVQTERK3sFY7T2vzKzgiYXhfmBOD8Fc/QPGGtk5GZZEkxYi/10EQqbizhOvPSuRDjJC6joKczgAi0zKsNhKhX5HHomD8A5uZR4Vjgk5c5HOY5JRotwiYE+mc79aKkrIInZjUq5IwmKpgjKtbMg/MdkHePFtMxES/5o5ZJXWJnxZZ+rT03Vf1fgX6hAsjyqWrt1IAFu32892zzcqNuavAlvq15ST4IPF42areDv+v6D+l6ZNNS27bsra69li3xmh0adc9uoj+bpLLNF6l97qGDleaf2YF76a/cvUKtl4ituKtRWAuKq1AlRpr9e/JnSIPSj7D0v0gpugWWULmGw5Hv6sknospHVEnC/0J9dwsvqMoEjZ6x3PowEnkGHBAMBSCyxb9g72GeahNGLcd0W1sptI/c+A5kwp4KuhSxrc/yJPm1+KkFhf7KNyqcgc0OQbWliJfYA5oXWk7NnlZlbP+gBZkUP+T2tY4mQudxCsR1TKypsEUtQwoyVLlOjWnnl+MEyAd2/fSALLzFcKaTgdWvXoNHoft9m8edjsgpr22DFV9kl2S5xTiiDn4r1ijmgaPR8bENY+LauZ1z7+fNdyGRvxP+3xFQy3s71HbwsbPkzthMbsEUg2wVK+XfAIFC1dxT4tXWzy3L1tyyi3d2BPq1a3RlVD2za398BLLGxOVbeexAAK6qYAc/XPPNbA6M+tgY7bpLEN9uj8d5BfLu7X+W2Xx1Vd3Ejbsb5ibyoK7uAsZU+w+lcOIIIF44vqheXfaecK8/gLnj/lWJgfYzoqz2imPWVVdkKIzqiexsX6Wx8Tbn4o734Fhft72MJuYPxuVI1Rgfxrc3Qr0+k074kSupO9YlSgWP+VtUPm4SCzev2wNBvsG3c2ozau7dHo9u9bdvgbOtVQ19PFSlvvTaqxHa1StUqArRnUb30jlQKW1QXKmYRJuA5+i64J+3Zhvawg/c52WVMEmNHzm1bo3tsuScHRpFVd/8HVyCDYdlf7R06MJjbt+DlvopBDePzbkpM+oCkWcJU4O2r5ig6OCBrxJjv6kLOjCyGZVu2AnJnEZyy1sv5mtUWSfcICQRwnZzTNAzA6Mw8QGzLmegzszC+AbELMImiLKPLIDthb0zxyfx3vEwiBQ9Z6mSLIJcfwXRB30w4caZ+HgcA11ORKjBJpbsuJ+LcKYP/Jn+k1ZfkrZobqpmekXBjxRbh+XkGvR9k72f09yjOfLi2w5oiXjBHCJtzBtNgAePFRChRcS2yaplMjal/Vl3o5Vw8M0ql3FCaLnvn7bZ1o0r8ohgAb4AOXaMaq9rf2iWoA1giYO2zM3r5dtuwVe+Vfd09wcGW+6lqrSObqUnAmSxTrW0boCBZ15Aj63XbALmexXtFxDj5VSWHT4EPssV3lUQlfp2EbvR5EUzZ6HqyoOmUpnPyPPKCLIuJAfX8RYr/IES7XYbhNEhgvAxVvgoGHrCIszsNIMLYWlx38zlbsAAIhI/qSVoiM6WFHyXub1gg+VG68KefOfBlCcEtQgJus0jieEYLQA+4SeYn6rmJH7q38n0onSMj7FYXwa0fckjdZ7nIDbOXWZzEy8jDBMgLAz+hCRLc5I65jfDD8DkIeAs53Mrhjg+A4MHxSg7BlA83nra4vgkiL74hj5GAIb1mfFUvSBeheyciLZjzsqH03BUI2hIs49ViseDO7iSuFyxTmsdRdkWxM40T3XWxy8V1Cz9y2FoyoxANNaMsXhjEFZA6CwbVA1AQao+n/Kv4BoiTC47MY0Ugr2S5IeTACn8uiC6Bi8R4bDrOg1ERFezfPO57l8VJ7cOeJ8gyWcdiga7QMabc0jF8dB1WEuk8jgZSRDI3yyNsqZ0S1jdcVDSka9SkEt9Jyq0y57+DzuBOIiWbfSB8YI8w19+fZXzTJUst+fNBcnnlhwsctWUlCzNRq3wZrLvu/h1PRCSVBmwAE0eZF8z9iIQdfAJKrRKsTjBX4BuXgpSR22z6NznYTiTguPyMaDlHTYB2DBA7qsEJmIcI/xnnUgT4U2wnBLvwKljwvuIqvuEfz4cdpx9NGWWS2waqFCGxv0GI7bwnTGnGj9Q7ioP9PZA2YNqmvX3ap/0aWfrngPZrFskvJ+SHA308oAM62KcahPJ7B0z/SRYxW8xI3xvP2ZGJ39pRki02XiBrp2rJZmGn+miwq7BBFDGxoR7vNDITL6cE+V2WsHzicOPFphiJjST4FHGVTOmCzcVjBfodf0vVVYAvTVM/YIxkga1zbgIvU1oqB9117s9j+HEgIcjkiNGRA7fKwcNPpvAMYcEWmh8yLjMPLi/TZYZNJXxaFN2eo8YxR7q9TlXDhe89SL+MY8+5fSrx7kHiVZwEv8H6PvzuzVZjN1dx+L3iyLmn0gBTCJvl370wz6RPBklpKZOHWE6tlHsZfDR4BsNEhrrDjxdnWCHw9/MTlzmtQlZDhJxnFtw6PHXQDAJwdF1AgcLVQsATJMm/zRLXEWRkTpApcBYwpWEE9NZkDtDKqwSrppWk4iKdkiV+xvyHUeZ8WbqehHjekFDoslNNlDm3zpXAjV7OpnESQZ5wGU/QP+XgEb4l2x6uTgt0S3cG733ZQ+cKGp4rngvF60awN+EGRdoOWwKsKeFQWq7kIGIvKML2Fs2DPgdhyPh0bNTHD+FQyoUI48vLILqEBiiMbxI/daBimbuf/csk8DjAuTUNzYM5jZOj2IszBq2BiAXgMtCVYmzjnseB1M8Y5VkN2Ay0DP0D/MdSjJxZ/JlHzSDD9KlKuPCjRZzSImCMaJ4v1VTB4UTIeVQouwqmnyNY1WrpwSzkziGyqAQgbw8jUtHqN+OhGb0+nUIMgcaYqrD2EfL12iflcTuQYRsHtAWu3TSeZbJxiEOM9PjIbBQMd6EFuKr9CBAvGXOuL4nnSL4SOdXEiQ+iglHMqj3uBnJAZ1lG3EHkIOcWwHDid8khLgfNdptcpr6UZVScegUUl+6evNCYhXGc0JV/u9KoGIyL/h1PBLAeSPKaURJtQ7DNEfDh8XW7oDm85qQDef51gCV8DMGQ5+FrqgXiwo/0d+RGC8hESFESBpX2dVB59OmvBY2nR+kXUQsKdk0m2DQKOSzO3FDD/sqSQ21GllGAlqZLpDDx6ZZ9yG7V4Y4P6lfS7jiWTzNhGosQM/ThKcVTjvgryAqULRNQ+ngpwIBJHLIjYJj7PGKOYFdGDBFiictv4SVq/ect54vH5FaRp/TEkCb5kSdPhd4YdKssG2UNcpApy3L/duFGnjsTR8Ccz/VauF1FleqnyjJ8JqytFOhFC5gJUBgwEkBgqrgwUAZNf+VqVTC0gvg4Uzfi5UlKGiyc8zOmJ85/DtBAuZ8gyghkWIrBThzTiMrPOhE1MrDgUFnI4xxEpwvl1Km+8616/J06/iZHowRCB1ZG/3aRFGpTN0g0LntEevOj+T7y0hfshax31oUkHk3zMuqFlyxQQBO5QRuHtEGHRrFuUZoirNUyh2UNelvCiwwVVAVR0fwJxIrUxHWKJY7E8wlTZj0eYq9EAM7jydy9JFli8sDlTNEaVZiZbgH35mbcKG7pjn4zrEmttrtzyGOqVjq702mc8M7M1eTH8KDVUHwg6SNs58R9OJ4G4C3AlslN0+Uc6XfzOSOqQ/hPk5ztzefdHrQA0dTHt1PqgBT8MuESCMxpnaYxZOfYAGFrs8z03RmTMwuU86SCPWe4OPEGCeBPygEG078rg3ZKJ8VGTjvz8jqKr5UuOoNyQRMn8yHgjVMdkQUE00D3jP1Udc/rIIHs5svSDdH3yL91p1l4J9ZKXPoVtQVdBte878AZvN/kjoDoDTYSf76I5ZJi/z6b1dkbJeC1wHUcLuGNxeUNEp7obqVWgtxVZe67USqfP4qj3G5JvUWEnQn7d5ScWJhYmcmVoXZP/JlIqAEaKndX+33xU/Ow62cXW1XZia/qS3Ha8kF/oHIhE/8ygAxOlaUkrUoZjjfhDdKVABb6ab2AK2ODJ6Bf+qyHuYrhY5urY9IlLlouFnEKSHjV6tI7JpKkzP3s5w45WnXjx4k/T+sIpeygs0zzEShQby34jVzZ1/HUnUAkALc4P8XSrazfgXPMjcwX0CS//oEJtyZiKyKkXROGHYTajC37qXpAL8jahbJigzYsg0Yva7lq2xYTdLFAr1o3h7XnuzvfNvZBBvbmHz9/FVuDH6r/sW0g6We4PFStm23jsPZ8Z/fbRv3Fq307t+qAnW5dgJ5zzi9FAlawgv1upsm2mLjvsPLvT3L4jrdHW8+E4tDa9L+QtXmZ8Y9P1mYQkbUZZvyDeMQ/nIrxxdpEu8VvQtYm/6hZ1tpkjH3EF0j+dxpHAwG4tDax/rQ2BbXS2uTx2tqUb2RtXvpxW69wUol/CCBx4ce7iToMFio/xjpr0w/9+RlrKq1N3gFYm6CrbIRhM5SLVHTgZzoS3a2ci+7knMZPWL0pU0Jbm2kI0bK1qSaBlquqaYosXEYssq3N+TLkV+R1mbWZ8p1TP+tF7YhNNq1NMY6xNl3PG8by6EW8wO+SX2kBmh+JNeQdXS7JIk55sCuVhm2x+DXkfsfwTkPlTZZMH6EDDcCx4g3DcMBCC4SX/K7qhXooAITrmVR9VyqIBc2dOMY6H7GYjwzgrW8kABA4plkHc9zAT1MWZklaOapvNM8rN7nEe2Dtb23CYb/pTq98fWs1yHGFeq4KLEJ36vfjuBRDO0FtMIN0Ueufg0VRRzgc3TXVWy+BGq0u099jyassufwDr7fy6oQgw9p0p9PlfBkyPDNicaoOV1L7q9/UDUNTuSkO4W+ne44b3al0nQwcSyQ1Mh0bxr2JenM3lV6XBhE/JnMjdXijjpx8fcntIHKTu4HqBuh5EoSQBYf5gj88Ox/rADNlS4Pg4k3j6FraqbwfEC+Ok3h+DrBeFR/G5RjODmRJpk+Xone92RmLZFXkg+9/1uGP0sg8H+rldBj3XS9wuaV4Abtcq4EJGxhrU8FnIABQBGtTtkbWZm5wsDKEXWGxb20Gs650K65Gbrm9mdCD59GjOxg+5NHmOcJpnintym4FwbhVeokgjVdD6oUYr6E4+NI9ICVAQUIeW+NL+cVkVB5pwwwCTnSRRTGooJtIi0iLIUkNOxCPK3hYTlvybWSonauaV6QOd/lIzr1HcMeHsX5RrsxFfFOMQYl8kGHckk/ESRF3WbWYUMP5sfScPCwDF0f1QKr6ai/yi4jOxvtJXQzZ9lubiaqJ/OVSP2sFs5ladnLclJUdh9ul/bFKSQdig82xi0idkE4h/SofSRchj2K8jbU208xr+dfnPCxLeODOJZJgJTzVkY4f6dYjMW48svfNA3kOjukcou1EkN9S7AusTengWXwEsxUE1FyTxS0lIOCwOIsi2OYRLYs7MXe5TI0dbY8jeVdEhhtuxVl8sVhISGo4S5Y8kamp+0ba9J005t+CRWm6QP9u8FDnsW5yNlPBQfFCPAaoW176GY+i0nK8fJTuy0ulxWkehnWkNBffLkKXP9VVwAmqS7i3w2Dunw3yjsBINRM0IAbc5nYFacM7H2GIg1pB+rkTo1QRAK9FOF+vWa+NOjMfjJ5t2caTRu1PsMrTX+dpN3Ii+L/0JC5k/k2b2DkcBVELHsCto74/I1REmqF9ykDFDUGCusmcubeoh7OAq6PvX5q3C2oPety2Li7aLbZKn4j7hTVR6DP/PVT0NYUILgafacVNcxL4v3KjFQIKdtn+H3IrxTswwY4PXvKwD195ZUu9wn/ns9irovyE8sPHG31/XjjLjTfMyKOt3Z2SYUSuyN/Y3bEmo/rzjU17W6yednOccEgAjmAMyEZQhthFidPerpHbR23mZOUic9TmFTLM8ujSxMa+yeNzk00hmgzX0NSGUy1lOGW6U6zDTUi/8NOeEYpuRh5CsP8zlUW5yRbldMyAA9KZj9m2/Jhtro7jBP8s2TjWs/aJGGG1Z9QugB3a4gjUFtUnhrh2bv7Bq0w6EyinM+GC7/o31MWGgmd7tXo6V0br5wloNbI7Oheb9b44+PTFwGsg7joDP5zRAOKvgeDyq5FzwMARQ2wnh2xSOIyJV27D5I4uWAz2Ho73HyBx+JBbTVu7tCe07Qf7darV99lEBlbK1qsX30gZKZ/FHg2uQhpcsf0+IAf4Y0UedeOMegq+CW4RDFYC22ll/UzWaHu/YpQRQazXsHfZAMR3gUD3FYAkZH3dKFriEz4URm7xtVM6+dh7QMk+xZ8lh+/QMpQVbhRFjBCEBStJOHuIw+FHBZQO+40UUBvKIPPwsJ5b03mG3rPTds3IU8Q644Sc92Z/0O51tXucMn+8dJMJY7zBmCELIp9VJtPEZ2A8n6VhyTJivxWhs6ObxF0orA+hL+ZLhMj40s9mfnSN41Ucf8aRnWou/Uxe+dLPsEQT7fSlnym5yh3Cy4X4yaTqJqm6SaovTssXp8UF7HsPqyWDvJjdgMQtqFSa4rogllcMYzZ3xGJOJMnoTalimhE7ggVH2PstzTwftFiZBy1J5jEd33whDHxYGtwkQeYbFEBQm2pnPNfjDAgowSwg+Pn52DbxNok3Mbx1kY0Lb0hwgjdPnn+JFqVUHTMsXWcJEkKPf2Om0H39Q1mPNYPXAtaqCdz2lAtfSZmPN8COiddzeDA2SgauxGgRYaSIU11JMPRyla8jK138W3+6zJRt86WfoYITfx5fM6ohU2Kp7+Urc5D5AsmGZuqRO7MsGxXjS0WFwUTJt4XpklLfB+gLSYUu2ONL/AIT94allghcMqTijfBhaQwqcTEsWlGp0fBXELUgq9shi2b1BRzFGBoS5HmyB79MlxNojoQOjzRf5yJX8uD8EstFQ5Aj5c1kDxmISGPu3ka6erDNNii3NstirQNi5sUI1UO3/KJq8SVmvGLeWwrCKsw3bSP3jlGIVUbu459bQsOpXKGs1C7qnQ6yKHeU6r59QN9k6GVKjL2D9X3l7QgT2trGuOQtwoYLegiO4kzGXuXpY1kP/Vk2sSp5pfxZihXdY+Qmsl5br7GS+/SQAeOTTZ8+GZVPmKxvdm0ZyBqt9+2BSezT3AHhXaPb6Hz81aTGgBqDJjWGdGSetLt01O42+h/pqNfrmI0uHfXNxjs6umi+M4d0dNHutOjoIzVxn2ZjMKRm54L585q9TqcxNPloNocYL5u9szOAlfBhaLao2et2zSZSusN29wKZ+31TXaZCyPUe9+ubnH7R75vdIbUaw8ZRY2ByYGBKwmDY65vUMpudhhz75hlnNjvmEAn99nuzRS1z0OSffvvIpFZ7MGx3m0Nq9ajV752T2WiektmRS81fmuY5HzoXLZPMX8zmxRDH806j3aVjc9g8peM21+BxpzEcml067lwMTum41+n0PgBM5RjwK71+06Tjfu+MjocDOr7oSp2c9DqN7gmd9BvdIZ30exfn8jugkwE775/SaeM97tI+pvZJFy/Y7rTfmdTuSpHaXf2a7W7L/AXgLGaf2t1Ou4uTXY4MABXT7g7N/gAV3u4Oe9QeYG3eaXA5/tV430CFnA/pX712l96ZH/E/4J9zALW86/Y+dAmlvWicmNTBx+6Yx/jh/yEK2THfmx3qtPGdO4MzOmuc4/8c584aw+ap2cLR7LcbnfaviACphs7a3YsBnbUHA2QEE6M8k3Fiuh3q9qg7PHXeNzoXJsGfj38GDLpg9ql39C+8Ve/4GC2h16XeOb+UHAbU67eQC176A+pd4Ftxmzpv9Acmfodtzg+mxw+9fovOG8NTOu/1OnTeN5tmC6U675vnaFbn/fYZOsR5v/0eLRLHdsc8Qah3xL9NswWonfOLo067Sf1G98SkfuMD9c1G54z6ZuuiaVLfZMbJvjk4R+H75vCi31UHPK9vvu+9M6nfPjkdUr/XMfHTAVsl9Xsf8D+gQWPYHhy3TYTem+c9ABUMmqfmWYMGzd65SQMTnQ+HYxqYZ21CBQ1Oex9o0Dtj8J7+kCF80AmaAxoM+3j24ONgaJ7REHce9oDU0+WfQUNa7bDfPjkxAXdx0W2iEi66RwCgMFuE3z5ddJHtotv+zwuclLZz0eXvedFFIS7OW3zhOTfNi4GJ/z5dcAt43+i0+bR8cf4d0Pt2g963zQ/04dTsm/ThlLEg2t1W7wN9aA9P6UOv/45+6fW1/ve40RkAYejCVNOADP/5hsbHSpkH/O+7fojXifXquU3r+wLXBUeJvdHBvlp1y3DabTE2RKPfb3ykI3P4wTS7GBFNMlEIs9siYC59JPOX9gAjQLs/QEck7swAnej1aXhqduVtW3jJLr9WG1BMo7esFXq5e/+1ZgvXGz3t+cjFwcA8bHepedo+p2an13xntvCw3sWQ2/tA/P0b1V8ZG0iOyucVnjPikw+fi2zNrhhA+R4fWDc7HBeksdTAQp93lDvb4wOskMcHuzv5NRty1BdVNhkB8UbgWgTujy32sVPgHAYQXeHTsSvuHPpGh7Ia5xhtGrsVyxopdCB7e4ydiXoO3NiKHYm9aYy39Vk8GEunIndRBgAR5jvi0Xjj8OCtldq7lbe7lU3MuJ/UlLv7lNgEOJEVQ1XgrlPfZHiw+ubhtw27UrNG9aP2cLAGdeDP9OMb+vknw7LrcpESIlppBWq1XXuHvYLFW1r5DBmj8VvZs2/Xa83zC2qZx42LzpCOO73G0NitCHZ3msFh7/buN3s+F+3daOpldmJ5lHB8NLnx7DqN/MSuj9zJ1LNvSY6jq9CWdCzkFuQFlAaULgzcwp9dprZGq5owvNImr5V+GF3dirNOTj+qAyupIkxYrHpXq3O4BVmbBW4Q/TCKv9gKWEgOSAAr452wMhL/Iko/jLyMPdYeenMXnm3Wbr2MPuRlzMXIoEKVHatqYZ22/4I219nSf3S/vV9jkGLUGP6qXHXyq3Sow8ymtR3OgcdaHv8Ug8YavtOvwLew9WU11qcKr5tgYVj2V4MfpB7L4dH4ZW2fO8S2sfVsBceiVr4GEM77xmqB+SVlrVo4sz3GaHrCB7D+pGe4USon42I8eF4Z67EE8vhH18DX4E9kY3zSZ8+eGVZStyJV8WOFxydJ66oTvwFkK5JAnSwpZeZi5iTQbn/PVJd99viJo/HGs62i+q30U9WmUa1qj8bPtl4WySozCm6DbS21gRwJrJCXSMDgpBBERuONUi6jMiruXtWjtwD8PzGAG+ubtG5VsPDfVG7rz54JxCswq9afGVR4/ovX//qWYazXQcN2iFGOrVmZzUBEij9U/8Oq7uomZd0b4436g1PfGJu9ehV4nh9V527y2dreBaj0oaKZxO3qjy7T4BMiiv3GaNEPssipl9/PUWHcXSXS3De2DwWGHSSNG4/fAK03F4C+NcBWeuVeY/MXsCUK5RXAVM/CaytEmcW2lmHe2STAsCbjB894WH6e3sPFlUv8213OqRHd0RG8dFhC2Qki/4g9QnGuu5xL7nOIHmnARRmAhZQGd/NJHNIHwKHghy9Sw+v2ymNfWumOgHnky5K0AnP7tFJFSAAc1q0bY1+9XdXzZ9M4+reSd/oaldKqa1DuILsD5lDG6n34MbEXAUd2HFu7iClDfHCwbj/+khb6QeVxeu1xaiGk/1PZDQU6ZBkPvznyj2pvXyqXLCuF25axweuAZ1uWFSWZLaZSj/ipLYv1IU/Q6eUM0xrkkwGaN0BbyShg4iTOC52BYDd73DAwEyNJeCZvFBdIhRGPxtbtD5DRvz62UhRs29i0eZwFPp0kAaVOQY0JWuX47f1XnMBggqHqT5SUhIV1QzOvYAjawDADum6pxNHbe9sYoZ62hcBUAcNaN2RZt6N//oeaJRSkI4KGQII8e/ZMj0hMD47R5llZoCBDESNFPzO2cu1SQUWOmzGeI8EVGSPUlgxkf64U9Gk0/iSryk9PEEvmlM+fSvlyeue4BwJnXQxnFUi40F2U4YSLmU+nMrFLfRQsZzbPkzl7iBg5zsnNYpAYTyDnUmwhZcAUgaJG93sITK2sHtg/cobfIGX0Io+ZUTVmyAr6mbCG8800nHOZLbwwKRQijxXZuCZRyUnCM8X6zRaCzFigmCrmwS0wSoKCJXyZiXv6IoP7EgwEwU66CsNTUFXALna50AJckbED1/qBnJ1/cGuReYvtLIOp4LMqb+F1SbF2jV2liRrti0Jj7+Bw89uL57ReH9e4OzC0DrzeR8ZXuF8CEUGL2eBvAs/HlIIUhgiM4CZmkEGkrB81jbbgnxn6wWTtyg1p9EkDkb6s2Q+h2GmDEWZ4zMEUvGXsKgx1a/OBTVxuEvcdDJqtLWmfW1tqByMpWwQf0U3r3jAqW1sacfU3+/7Hl//n15qgrVs3VnXn+Tfr1W5tY7/+wt7ZHo2tV7JUUefUmUqO0P7wGplLcMp69ehkBUPdviZRVzqPyTIIM9BslyBugujKT5T9qWY1yB6x8EzQNmHGJFbEYhfcxZzNIYaOSBmeDIm9mZj6Jv57wXdKFa1BR6ztxaxscJeCmMbz/cXA/0Kezxo55YTUE2BBWNthImcoM3j2AD0WKhv4USShUeCdDYQwpc6961+DXhedC8+DjL4BK+ZLPzOjazCAc/TKTa+UGg++hEUHVJYiyJQKxroEWS2aayahduTbs1JRbmRoPwsorYZXbkQwchvGcj2sdmACuHCT1G8l16gpFvmbYh4JPQuAmIOEjqEpVGJzuVgZxchzYK7/pQBbiy478th0KftKLkudMhc48ArqBIIV9GiumnMoGtTL/3LWMUSDxONAbybQZbM49MIt62i0vy7oEoKTzmIU4E68sl4RoBRG9UNbk2NBGVlgAD5YKnPnG228tQF5OVYbfFY+4z0aHt79CGqaILpsM3EQLNQManjXg0XoplfUAKDIdr0GA79WkLSBhI+6/xws8GqpQbBlbEKxJTZ6dHSC14Zd/QnMlWA1wrc26Mhlp1H9wCGUPkeoj2F8nOCCZr/ZZE/XphvClQpPa0GBQE1XmIqa7JZ40SbOdxRk+MBsPcoQ49CYQ2ed+R7fHbE4gmmfxBZ3XGhqsq5RPjxbSt8Rl3hwFSdZc5kZ1GK0TZSh2x74U8IhS2CpoQw2uPsZdWr5+OTb9do564nSo2WWxRGeZ1ArcEM/oVaAzsJFeO8m9N5PgtmdQWYE/Y2qNTNaotM9vD8w06/IvPWn6G7A+wP+uBugb6qDyR4sZnSt2yleEd91OWNzQ/42xNXDRehBv9hH78MPTKE4cDE8fv0zRKe+6/GyewCrow/QMMov5+SQzsoR5DXqsCpAY5KHHbNBIKv/5fUMOobSs91t04kPboXmkpvSEJNgU4amhqL0anU6agTbrtfYtAC1HF62MXDxa3T8az/k14SlTSnX8TIM0c24l+tRA81d3doETRtxqwqkwdA7ODgdx6HnJ9xBO/Co0/mH/pxbOd/vQxC9h9btBEB8p4Gnv1x7ipFplvcq1RBxnRpk+v4kjrPj0L2kfhZ2FJs18ed87yYw7/BvM9jeDRgUyKB2FGTnDK6UYmhCic+TGA7lKW6Tcgra1N0C73/iSwMfyNGoG6Q6KrcD3SCpCTK2VLVHaWqSF/f6+Sc6zxKj3pwvLup5mlE/nmcqxqd7C2qn6tXxKuhEnU4+GHeCKdz28NzP/Dhiw6jjOJn6YtiBbowL1VAoPaUTu56uGB4yO/H0s35KjIfAiFfynrlRMPP5/Vvn7cYNnGoG8GZIMt/rDZAhu6Iz8UI/im/pLEinpVroDtoDLyT+qN14Qb1lxo88N3HHMGxeuTDM8ROsNacpwWbxLuVvf+5e4tWaCrAkNeoEm8RzKPT/E+C1/TN8r77MKtInS0NHi1UmfR/vbqhmwemdDvVFj90X6jWTFd5BHElb74u3Bxczt5LB1lwmFV83dOyxT/xM2sgJTDClj3GERwPdVE7YdLyN+6jsg3L2gcqetyga+JGn6hSpaO564KfVKQSDLncfHWDimFYw5VtiMM9C1RLLw0CL1eXx9HNvkQVzPBzGcAOgAMgYm+aD7PvAvzHKY0GpzzUK5DQe0nvLjCupd+0nbC9B0rEuItb4l/umf4kbP+yXeaccXPFMyMOHFIguoqAU02OdXKCyYra8iFTIoEHow6IJog5UbEpqnmWxxxlg1AYZqqs5Xwzq1FzcUcePDLRBPQWqJdzQTWCHcBGp9nMRBQz8IUVCQ1XBx6OAuhEPXKUbS++6SP2kDfOZ920ZOdVgjGkJ9auisOEChaCKGvT+nE0VMMFJPfDteYpQs6j0AZQliEi6gsxdOHMGi2gEunDj5f6RFx8975dzge0Bk14N82p8mfK8aOROvP3mafu9CRWzCViRxnDYbx9dDE1HnylSur3+WaNTSugdH7MWuEjpm41Wr9v5WEpSur4iYWienff6jf5Hg07fyQ6s2afmBXXOsMoSLUadWi06b9EFMpkfUbRmpzEYmAOn3+sNtZ7eafa6x+2TPMo6vtbHrgN1PXV6zUbHOWs0T1HKc7N/jDfoNk05jcwDg9otvPdRD2QnONnRevBuj3rvoDHtf6SPJobII0dn5VSVr2UeH10Mh73u6yL4pgj+WAR/onaz14Wyv3EmenHEQXfSL8X/88Ic5JHBsHeOYvTeqcLxk3VYlLfDDuqdFavm8LjXN6Hi77Zo2Ds/6w1Y+9nHvfAW3Z5B6kPqz5d/tMFpc/gLDU7NTgcVOzR/GeaqWv3RyPVgvMS7K/jjTOLsSvhKfY9EbD/DtKXABoLLK19xPzKMbuhjaMJmI47CO2L3c3HoZqxzAJ0r+ET2npXVIWOX8PCgDjCmEigb9pflW7GmAFyV7CBn3Y/WrRtrt2aNqxCKYZu7vZKEXTQw5qxdOLE95Af6A6Rb07erosyoVvWGY29f9LX7+/UypiyN6hXr1bfxczvfS6yLwEdJUABr4XqewEJyhKn22B5t6hVuoqHYyxV0toLrLbDaytSLhTeYBS79zAtDDVp86WdZONExbKdnAgLOUppSMFLY4HzIBTzYkit5TvEL8RGc8+EDywZjV16icZZFAs7bRxVWu0JKZRyGaIdfh0EcAa48wZSogHtgL1l/9h1g9me5dvSZkhjMVUssCckEjuB7rG2Ko0rVIkvAWIBfglRUuNEsdmDjXTTEECbpYgfpJ6v2oFe8xRXaArhmxLMHYNKrFqN3C5/d0YX3jP24gGIp1zMD1nUcuhkLtpQxLprkYSFsO0T9H+YkciKOgG91FgNg+1BMXw8VvvVhgXh9qEGwkSYGxYcQsB0KVOqhlv8dyn78ML2L2H/1N58OvbvIhWjyUPvKGtakCnxC3QfW9+u0t4f2f3BQl75Q7gnfxs/RGQ5tETrLl9yCrApqeRoBc7CgAQJej7GVtwMlucIlBUA/K62s+21BoqwYFuW7eBisfRXRLWsoRz+8dqAFFr0lfviCCXd+BcKtjs4qNrcW5i4eSHJFQ4JxosQmVxL++k/nP9qAMcHRN/7dsm52PmnrX/FyZwEYe7GX6AcTl1Fu0HgxGgjCTQkLXaljSmjoAp1dANlyQEhDVziwRarGPug8diQUur/dKSEumoQW4orVKbzkJ2x9eoPhO/GnuVB3lo/a12KUPEWXWMWzFVBqluOCCkDMggtQ9afhbK0RoBxtGh2QDdHm/R4dWHBQ3v1mUw0G6jTa3zs4HNMLEeVuPl+vf7NHYPyBLn7XelXb2z+oH47pm10phLhuipeNYNeaUJiGFCLhFqD0sbKkfPsWMFU5bx4ERxuwtnSYAozZwcavKjaBfXLdqhhkiRzUIHU6j4/GFeVbovSwpfDG+mhsRVZiVxQfGIdz9ccujX64WN6yJkNT0MEjm/tBZCXQ3hhb0kug7XEn/ixKsmvYMaCxg3HpokRf9/NXWq6w2dFtmQvvq1HSbEdWotQx1uQHGHFwP9ohadU7dOVUcozh4iZOxbj/p+LsokdnfvpqUCw9cEc/2hE7j98QO3LcCbt8rM7DAt715GysehqUv8G/P9tF1xTbHo2qCsWgcf/mK3QPiiUqn0AcVq1MggxgF0+pXHhfU55PRMWSq1b06FjMKyuMoAokJbiMVj0MWNoqiL1RnDnQHiQO3yNOHDXJaHbeB5C+PLFotHsQLmANgL4VeHpSKfsjiD56tVKgcS2xa0IOmyw522a1Wq0eaGoB5lDZ2xdM2BffaFRdr+y8AvXl6PkLdE7+1GyPXB+DWeDlbu3tobLBGm9vWGlFM5WkFWNvND6wdw62vjPHa4JEA3Reb75uKVZYzSekJgzNZshKHclvGN8zW4NHSVqRxVSOLi7gzt85BTs1KbgQ4e1sbPBz99WzxF9jGjrCnQFgROfL0hc9HLcVIAJNfSfwgBAYZQx4w9SXc4JiCzbsOLmAkApAqexTmBgk92SELkcZus/9uTOD/tyZQe6APJ8dvquTkT7yFbAF83A9+2A7NFnC2dQx6hm9KaWzI8giu3JonrquUw4bwCH53qmMfvSczMB6aJElTkYAjQLoXQZdHnwPHCB2+kukKLwNJ/CcTL+eIyTwTkZLfQ9x28OEiU5TEImgfp0c1N1xxBRkO5/hDctgew98MYVGDTBqJ1ObW76eZ2KeQoGnprCy1ZcQZ5VivnI9h/cSHBK5B/9yqkErhZFFp0IBoiU/BcvOfKHIa0JD2E8B8Iah6g39SD/RP+n1z0Z9ZYhR3CsP1qwP+FQNtvPbrtduEaA3+lZGnV4/SKI3T2b7kX56Mv2fT6VyO3hAdVxeLZfXyXP3kt329XIZAxZwXoKFX14xp+KUpkew31svr66UFcbWn1sq88c3e8diyj0wzXdO86IvARjKcgBGwg4EAabjkOOwAAQBbIk5MGyfmYNh4+w8j3EAyyjHecrNiJ88DcLP6FwzZuOAd3lCKbfABWrlJqK7aGpom8cfbmVufGTaKPZzuZ3jAyvH39+dlqwSjdFseRXCXuKnrwcHvDjfrwMWZntU3WE+GOs12IswjLNryQsaC22MmCU0Txt9vM1Re0hnjV9gSG9Qs/OO5SCtVt8cDJRo5uwcvW3Yc8zWiWnUqdtjycK52RgayoEBOVG7YDM0G31zMGT07pNO76jREWGN4ZyZZ86x2YVxPkspYMXvNHu9foufVDK5RkG4bCf9Bu5z2ugcO0adTVfZF6E7aA8/UufirN2FuIQa9X79pH5UHzUUtDlcbbpGfdA+6ZotGl0MbDzTcFj0Ntyu19AR6Mc3hkEXOKNOOK9/wB/s3PtDpP3jH/+gf/z8D8Pg92kddei4MySUh+/Vap+QeT5od3pdnNf1qAao1z8Ydcf85ZyZDbtDp9U+MXC902+02r/Q6cWJCceEYy4xDPA7PQh68GVocNof8iPyb9PuHre7eO2zxi9SE1zq0es3tnPepjfO4D/7w/M2mdTp8nj0+geDOr0THTbrdN5ma6M3P4GpAdkxLjhv6A2b5jrH5Jzi+zb4ZS64HBco1wUX7ELKdNb4xbAm2icYC41nuekkYmJt0PyFeudm9z8bgzO6oImbJAFjM9+6KX6LTf0DO5csCTWUFgZwOWAOncNJzGfQXr014mEKw/vl4sotGRPo7c91PhmwajqeaYCrlHHb4Jzni9OaIurIFHoblPzgI8o36Bsi/dCWCAyMCFAbniCmiQ8U6FtIyVjMwPOEaMO/4NyXJfJqWFDMjXokg4shuxBG8HMUDIMkzsCiBaRCjD/KP9CQdUuar+r8JVSpi4Ayd4ki/l/0j/+N/hfNu7r5gKxqhbjDX6Fy8jKK4N1K/y2leQoOtOoBFSOK5nfQq0XmnnpB38ZMaPQcWvnDfA/19mVt137aUsXaJGYn10SRwumyQuUi8Pj5ztgrUz6yoCwQqxFUnHxvo672yGLfBFsDJaiE/3Ru76RsnVb2yQ/cgNkYC9thXigXNPaLxF8weDmbNCXxIrdpyh0dZ4xRmJO6QJPMEkuhdAmynCBRe0uI2R8WodtwhWYOwuKMaho/jCa3dm4jv/Il8Qm/qVnAmtALJXHRa2cProW7hvGJ0z9p8z8Yu5W3B2yAXAPdhyKxr9UN2htVa9gJ7HPSXh1pB/v1Wp0sa79Wp3Umst+QrfjLb+PDwj2R3x/2MrLBxofSRvNoHru1t/XHhlAwtNytPEmvLjiMa5VkreKvVdy1yue1ymKtEq9VgrVKtFbJaOUkeWuVyVrlcq3irFU8znezVolWkn2+IFlJW65VFisJtzTjq5O1ypQDc/3clB+drVX8IovHaddFgr9WCdcqYZGw4PIlKHA5LeEL5ys3S+XuKFE5balLl3DicuX8NV8w1QkUrFVmxZsiRiGfmnI5QpqvVe4o4iy3KJSUOeP7JqixpVQvly+km7XKlQTXKnqPKRZi7AzDdpVrGJUEBmKtgn8xhcRCBtS+Fctjicgay0s4i8FuunKGhyYEixQO+ewTgbEKNyyfrstNhGzG5vR9o07PJUR82OB+sgYWNjxghyNgrjHqVJVIFbQrddrj2IFctqcu2+dF8oGcKtK4YyAkdqrc4dbgZVvkeMGhF3gorVXAjLO18W0slNSwUYKcicRCaWwXUCuomjcG0sga61HTerM9Bh5o7cQcOlABOYa1S7WdkoOx9i5eHR5K60RrMvoGNzTLgiMasrHElouay2/392lPZAAH4p5WHc3g96OJR0Gmq6hw2TISDvUZRSs9/G3+UtY2d+htw6Yng2y2r/7ziqjXrLEe2YVLVEbqHIohYSYngt0++++y1pBOTKxiHOXeZNRz103UlnZ6uhjAjy9/lnWkjLCFzHX3Xvy4uQp5HLRuhINcRevFhaPDsc2j6O/k5vcYbY7fHmpymWdbNZs21OeqGNY9HKo1JeMcFBXW9srIyLgseQ4Sxw/YdT5B3Li+ZdDG6MXmc3hoSYOAOSs7J4CO1E3nhX8bm0FP/MhjW++RQtJ/oSHyJykwQn1iSQKbLCtxtSKsSrMyHioYMfJg/Eh0LWSwT5F2PlBuKEm175VUMkoZwojeK/bFLIoWa2S9Fc0Jk7W8BeiiCeiSwdIcK1RRxlSR+drXRouF6Fr8/4NMIQcvgSYrhsgPydd0ZQGTPM4J5kTI5t9oIdtKVlnT4ILizVZss1Ot31N8QmrlkovudT1x7YTBJMFKNY7E2jqvBdH56AVKytao+XtiYYIXypK7h8UrPrsG4XHDQGks5hOsMydBph6jlu1YmpWW7YuFJFzzKl0TdAOTmxG4c/mp4kxiveYCVBloA2EZr0U0HG6C/9c/5/zc2koddB0g2iiQeBgUT1pMslxkFMTMDpJqRj/NvgFrIsbpjGJdwihWS/8oTjN3+nkGUj+KQ2+2mDLWxSrILRvIFHzKbsoiJiXu+z4DLR/SK9/THN65zKTcOlMUKHVnPj8YiPI6Y8rQ8LK1UKwdUNnlQhVPrshYT6/EMEs0pkth0MvrClIVN3GTy7RQyzBiitiHv3jObpHWZj6KlCURj+huxYYezBw1mTwOitlD4QgxDdzheN9ebW3C+cSm1bd6r1Zs29Lc4P6Rnb21zSb2QLuVkbX29uWuXfa0fQxuwVhoajAsBtkdNcjKuGpN0P2F39hKdwJga6kFDA/135vPcuJk/V9/er57Kut/+e335U0mxnZNY4f9Vz6v/IUVUDfvqUozRzEx8EbtER8nJoZUxvpZAWcj8sRihyX6xd8bmAXda/jEOMz7dd6ew2oe6pnIzfRsoUZKtWV7Lq6vL5QrbNErfrdTbNdr8+w3ingTvW+92qe/0E2ohPWSaymfbPP3X23LGkVZMmlUf8VOe8VfFdvtvb097YTHNI6GqDbYR15pOSp1YPfJftxhBE5yHCiVQkFTfywiDlNFFpDvuEsM7uXPyMiiMlcJyBZ0JmrLnD4gc5b5Vn1NGE9r+7VOo39GEEINnUar5Zz0G+enKi6wLA+SBsN+76OKdXqNlgqe9yHCgsxYW0X13tH5oOOc93vHTqd3Qn2neWo23zmnvX771zz2HugSfafZaTffmX2Eep2Lsy71neM+w284bHjVdzqNIxhsydFpmsBKQbQ9GDpnF51h+xxm5Ktxp9vSSYCtKDJITE6fmd0L6jvnvfOLc310Bk2AeZg4DzFiLy+1xFSpGefDGTQbHTPPIDGVYWCeFyfM8zz5XHBf+g5MxJzjttlprUTytx32TlDsYb995nSUjVo54jS6LWfYb7Q7+RnAl3RbgKvhaH7yfa/dog+NfncVfUO6MQBcYhYLC6rdR3NAH8FA8ciPXF18noYtxkHzkySKubk6gppWymEqq6rzNNR28TBiLseVsfp5Cmju3kL4z5w0mi8cwVkT5DDPczymd3Ajxsn384ADe1Q3nQaBk8WOP5l6wRRxBuQqI45xj2KqMtFPgzgJCztAWAkS2ZUbOZomRIiohOVQANRg5+pMr3lp7jnQn7ihhG/cQBbsIF3ikVM5EjoTNSxzhMHFdERgw3SagkBTYHSCQja99DNHqUHBanOnj45AlRWnCzRc4Hs5Vxh1pSJQJVw35EfT5G6hVZ2wKAuufRWbuhksW7kmVQr7w0hYcFQlLJrKuRsxh1spaSWTL8tMjoAlgM1elI41CS4v/WQ19qaMtIbaZxg4wMbJ3qYECMf2MbMUTiKzzAcH1TIMHfhpYsXI2Hr4d/hbajw+KWNKeY0hcA36IAXqxhh+aY7ftwg8PvBi9hIwaKhSuOuoo8M3xbVqw+BoSgKOqZUy5Tx0Zc4eClI8G16PAo7GbETggcpdyhidjz8yfuQ1Cvi7ML70xbCIh/55eqk+F0IomNZ4q2gKCDcwJSCBDUJnHExVOMqu3ORSHTjK91XHGXhZnAlDFyOkmjlg6uJoFlwq5MBFvJBiQ94vVqfq9tg26l7FW0ihgGKkPlmou14I3/9Z4qdXTonyG2uTzFcvpyPcFVWk3D5XknQrU4loRU6KJZFKUGCHaukjhpWJfLfUn8oTUVXXHOU1P3eOIqYoLvDvuKGbzHUbQ4KCBEzBOlTCIGQbfB7Z3EvuZFKBpZSUUQhWEmJ1iby4BEvXcalUwOH5n2NXxYmrR6dSfYqrgUN5Upa4Cye4xJatlBAyTUopgTe/Tpp5HC2f8Kc+BpZyiuyvnGBeSuWvwdEbN/xMqRSFbUABwc0tUDdQ4ZRSbSbNYNMjQoYChDsVgG8FuK1tZNkpUoE+sp2z48VzoEiXwBpB4cmYh1nM+IbiH+ks0tDRrZXhsbXeHGQjwCpF7xTKgGvXQf+5dtXn05s95YJb1Su2bXha8iJOLDNENGZN6NGqEqYbIvo0Ro6sLhVHuNZMcbKmFy/rq3641eafZXGlCChhhAT10osXCiRLK59YDTXaX7e/PVJiE8pVq9sl3ZM9HlUBg+zZO6AzsXfGQBcBAi3HLHtsbZNlbNJLdWKgRGyC/vCWTU7yWyjkjPxiYSLBC0H3abPSAhgVKrYKRTIeYjXHj7HkWTc7nKQTChmiIF3ouzBQRymhqk/UGeFi9PalrUAgVjchQJbo9rA6eqxjmfTNs9H4rV15S3vKrnEPdo0Qxx8YkH+zeaOc48iBkUugKwf8g63yTn7bHevV9ySRBeiMtuVmKIjneGENsnEjJKD5jkHMUA1loaWzod4NMZ1VCkKlGVQ+rHpRolF+lQHQimgIpkFTvQsRDiIlJOM9SJo/EwaEEONqediqGOx7BdC2R3p5pPSVeqNbLVCMYQ2LLKviUD/DbklZ4aLLQmcoWufikhUU4/Kl+oVnK++sFZv61ZWwUEvD+FHiZD8T8aEfL0KfYdtLIiwWo+a1Vci0MCkqQ6qZlqmquqwruapf6ELZ61spQoWPDTbBsFkEtztL14x6rmbPx4585Ng7oJH09vV92UTzMED7h/aotvtWsE9tAUXbh8+HtM/96TLblU/5hb58oS839OWWadVyfBjbEFih7dG4wIxJ77et0V6ujsnhUXMtNmD1y/co6W0eZHxDZUHLg5NGwXz04MxXYqb40Xhk2Q9O2ayoGo33DlZPHBjG9jP69HuFzoFgSvpVMdOY05fk/8cVM5qnwe0i9pZuGF1O7QoLg6pKGIT5k+7++ts/9VK/+75PVMyPjzP++Dun/h+sM0WN8D/lA/lsJS/mDK9WWqv16tGn5DFCYdwlVvRy9+1X4wVZ1Z3Kt72D9foYUmAWpWEZlqsvteJSC5hvNYSLMXpR2Tx8blv31phNMnasrzqJExxbRTfqgmpSimIir9WMylZdoIpGsMDZYeNlmOIYO+q8viHm7vXn+8YIsdH6s43N5y+2to3KzkvxaHjLLg0jy7LssfPpnr5+szFLQ0NrWINK/UDcFK7Li4DKyrLq/s1LwOiny8kD4HwAp+SmVw/8pxjjgbzAfyjy0+pYLesTGkKtzRNpn8wvdwq7fJmULNsZMNz34txqRksA3TsSQQZQvHN5oFiFCui+VsaVAIG0GKfs2AcZZr2IGhWFXSjpP7xGilpveZym7QiUYYEkrHocqLXpKLm5jfsffun5v6UzL1wMJtNsefl5eHTWaNqAKdmBVQE05lWW7WKagoMUdAvsKDXa/4b0b6NvyMb6dvGd2hfbg/0D9jA0tGfVumQcPR/LMpdNcSBGRpaRZdUhJr6V1IlRiIx/v51zKx/df8VKedt4WbO3oUhXSwje2+bTPeZm3gFXZcdQh7zdKPYGk1Gx9KcRd2jbNpjcr86+lzur91bN4A+eodsE6HnlCl5ApPrhxu88OgdhxaKU8W239FpgC7zx+vQ6cJdU+JCt0iH2B1Xvch7CVH1k8ACmcGANDGn7m2TZBo0t0WJVd/cO6vLg+NY2RqO6XWfvNqmcKipp5CXh0tYqcf4WPsivA0qYfHa5MKo7ZO3+ybzW7g7xfQFnpmBnq2zVUorr+5XSrN0HmaxdrsUD8d2xXqmjpY50QKONynjn/jZmpp/a3tMZ92DUgoxfkfH/Iy/9Z98bltXsrGjZdXY2GukvLh8cwMDcgEYKwLjwUGGsuYq0nPF20SL1dsJKd9RuAOYXO6yPAid98pmEuVDoBiMhSp6JwEF4vvlzcE5O5L6Q7riXbhAZdXJBtMqiZzbFYAkNuWGmRdHYMLhJFsx4T7PM4uKCZU6FAAAPVrULSx9NQHMmgdvcoUE8ERl6ThR7QsytNkai8AvjpaepTRTuVmnDNA1E8MxM3WrfNE2CLGBzX2BeiOopL2IhY84w9XiBO4dt6BNU16OrxObKU/7TkaemFD/yRL+keHHFg0usU4B0Q7M4ZsLrROSq+Ba4WZ3vBmQunynO3cs4Eu93NjVetVEJ/Uuf/Q3jhdIsajTRyM9u8Oki/2bBpghMrnvjBe5lbtWyyEoDpYyW+M+CabDADnPhJ2kcifsNFJaZGCHLLkyLC2UzxnLAwqh5sgTTrcj9fO1y/zmIZDxmuwdS4j2Zilmyl8UJiqGNr9AGKYshjgYteurz11dH65WamHlNpoHE9bcRBjxMQ6VMuVjIBbwZ7xeBp7q/v7uzv795mNsuj2qvbFnOfCU9LVNtlO8T2TxQT9UbCuUOroeKewNr7h2BDbjZoefi7fV8VHv5VtFmAAvw/sevj4QmIM04/APLgh3r9SEwu7HUYypvRhx7RluPrsj3BW+sN2LVp7M/oNxga12h3GAd6PsTavYuukMF+i5oEopBgSHiO2ZXuW+04CZAZ70WdRnkHzARg4szukC+B7XeoEazaQ4G7aOOSY1WixonoIFonJz0zROg55fJPcrw9AXFR476QY2L4Wm7RSir4v1QGPZH7HnDtnqaCqTTO1IJQJano14L/CDDU2ISADq66LwDKcjRRxB2aG6QDmsJm41Bs9EyBRmffRPw02gyZcgp+BiG+ohq0uG26IHlqazZBaq9KkWzA1+WZqfHYUU/IscB+EfwapqHhET/O2AWEtTWE6QkZ+ftjgrAgaZMUzIYNroq0L9oDnt90jgcJQ6T7v/N3te2tW2s656v+/v5ASGQYNnYhLS7u9tgFAIk5SzeiqFdXZJMZGlsq+jFkWTAYcjPOZ/OjzzX/TwzskxIVtPV7kVSXQnWzEgazfs888wz903bsFzj2yeg8NDkJSe7O7uHp3tb+wWPyfbZSRexnHVPjw52tk7PDuTO1uFrKisCQSEaBDoFpehOfikRnLBd5M7uK2yIFywnxG5yuntyAHya071tubN3sovE/lImOzlDqyHCk52zEwY3KUhP9pm2YO+V3D04Pv2F2Qu621vHuyVClF0m2ShcXWZJ6QKUZsaTQmQHu3/fwyunuyeHW/sFaQq5uUfs/X13h0HtNVsKGk2ZNKUgTNk93D3Z2pevj06P5mhTylwpP+xuHcsf9nZ2dg/lD0dnJ3KPyv3VHlgQXsm9g4PdnT0U7N7BwdnpFkpi71AxqhDXimJS2dn9+24X173tLVQ2uSiETvHszphVqGHsqZgU1corUJjMka7snvy0ta/YVw4LkosPiFjKLCugR9E78/u7h69PfyhIVl4S3gvxR+DnOf1+S7/bmoMFv7s7fHhLUm+lU0D7R0fHipzl7/ijAWiXyFQKRpaCleUQNYkh6eBohxx7r36RB0eHpz9IsoRAn9XFSJwmOHt0SNnZ2ifHT7vykDr74e7P8vCo6FlwHv9C7BeHRz9v7Z1qchekhBu85nbZ3kMPxpXKTF1x6o/cugkfbe8V5Xy0vbd/hCGK6u5oe0/TxWzvgY0Fl91X6qL6ITxHP+/twKG4UI62905/Od6VMD3Z3yF2GWDxHB1vgdsEx6Pwc8LfULwzJ/LoZGt7fxcX6sWKgebk9dbh3j9USk/2MSIfnez/hGqcsdMQN83+1nGXHCd7zD6ztf03NIjjLfSM3f3z3UMqb/gP0Nlnri6c6MZzxDao/2MQ13W5oo73jvkHxjQ78nj/7PVrvnG0/8vB0cnxD3vb8vhk6/XBFpHg7BHl3fHJ3tFJifrmA6obcErNEd7syJPdbQKI232Fv90TOjx4sru/t9s9h+nNLihxDrb2iDhmxopzdHZCz3UxxPHlfHtr+4fde6ly0McKypwyT0536wCWO+DHKZPkvFyT3ZfPZfflt7K7u31Eh05f0+A3T5mDUj0Fj86PZ5TurqIuoqJiMh0MxXTUUHb3/rFLP+enil+HGYa6P+7jbxvdp/vjPrWI7o/7lNPuj/vg3yEunsOdrZOdMinPtuye7uzs/iSJ2WqnoOehyUd2T39BIs5eFr2we/ZyVunds5fd071T1TG7Zy+pGUOY6P5yeHT4y4EEhRbmRn7idOcIBDRMQkMdqzhhS65/HB3unm+9fHky89HYWvjUSFH4T3ZfE1kQEQhpC6IyiVDh3tqHbVAXIxUl8uzlmjx7+Vyevfz2fkIhNFcQCfHJ0LND/bZmFSI6Ic0k1D29wyO0dcIjNTlQqz+xXISOSC+BZAg/XWXVRFQ8c6RDmm3o55Ot42Ow9ZxgOvgFZ2eRdw1bo05+fYpeaGODNxLtrL652YaqibZLeu8XHG13SCf3in0T0Ja8cBQh0JuVlrOoT16RpvXxY71bB5D4BcP8yF27v+NOSS/1Kg18dyoPkhiXLliLyTEh/+lokmbkmAi6/iz8mFyUyVPsZxNeIcW1rReBDEQKzD1Yi2C9+ZMCkfq5AJGy+0ceQzh7zPgHtFCGWd13Mz5ydwTCZb6ZeYIAGeWO0E565ARr3CAeHiS+iubKnYIv/h8iTeQOdBOnyS50nacJ1sYUfDamdw+CDMaSRCJL76p0s4nCWSYAykxP/jhJckFwfZzR7JJQ/eje/0mC+G9BzDEAr/VogpXoHiED74tBvhXnATn4xgn0IxRGLgqkiAjAsohJcdYyECxu717nqcsQ2R8mFhjSRWq2wmGSBvkooud2lOU+UvADgBnh2CODlGM3INt4CqbUzFz8RDcBhmM6nGW1G6iCRjT8KN07ToUXAMKMP6pYoZlEnGtKAAngUhwnbMxkt1BNCuKTwCK5TYnrfDf2El8zTG6RjdnLYLgbgyq+hArJ13yw9h1+v1cojYWRIBF1sCaESKjxA3jdwvEPoDXtTFJuomVM7rXv8PvNc/x+9y1+v2eY7v1kSC2cMB2ZAFuesPHxKSEvER4lIjfsFkBAkRbs1RYHj8lynlTwrP+gWlTnnjN1vDl3Ga5+EoYUqWbxgBp4dqBBG32RLZCvdmwVfhMdeYZ6ivPva9M/sk7RjneEVqXzH8QDHFaZytiNddxZETmlI6d8sUH2IugkDV6sE7Vk/Y5aAPDu8TROYtqq/oyEFDvkZOIdqhJnNEIucWXurRKFElcpuzPuKu2COaN/U5wqpIlgLlA+b00nyu45Xa0Z4J6aL3pOoevfNBSa4CadyYZi31pZ16foWMv8xjE2FrVCYnFThzFvADmBeoiUAfyQwHPYIJ/UDUt2zeBAPmuHcfzNTMdApjxqTxh8AdgMtvi0GFSpM94MbN1ZPdax33HTATq2wS1QhWiLiTuP78ut8TiFXmqLYc9eut7FZCxfko6Q0MrHCfaFCKxcgXJvM2B/AVpehs6NB0Ea4RpDX7bNxqr6irFAu08TAjaXbAS8I+Kp3AkyquwdWGNyBDtBFtFx+10f9OAEPS53odLThOFAYsUF1hRA8wZmM4jGcYUV42tBiO6xxg4GBPaMFlxDrmngabkXXyYXQmIQlPtBFOQE6SwPFBoBDZPyAAUGqnACJS+Af48muTzG9EXgymyLwVzh2YjBlhV+OZu4nWCr7UQfMzph9WCBpwwuXw2rTEDK9IvPnIgsCelR1geeKFXiCVNQnwjKASEQM9ryjJocg7AgvPgrwsKnoR9YvkGuGYyYuTwZA2IX2e9OsjG9xyrG7jT25KnAGJjlkmQDeRbzGZKz2E9m8LfyLFahyiwFLlUYZ3FxvOpsTMPFGckNQS5/JhOenwmCjmB4jSarA/Xg6rHB9QhAnV7oSS8MpBeOpRdeaioJ6aFleWPpjQMcepPe5diVPtjvREjmzuCNkKI/VmieYxxuG3vZpRTjLJYihdp04MlBKAe5HFzJIfi4+2M59OTQC+TQy+TQT+UwkMNQDiM5HMvhOFM66WF2KYcTObyUw6sokAGseQPQXYcyoI8E+Aj6SUD3r1JlvjuWYVYAX0SB5KZP7SIay+hSYnqI/VTGgYwvZTK8hN2sL8eZHE+ykS/HV75M+2OJQ5U+htCYNmsimUbIcBoHMo3HMh3L9FKmKJQUKchAGO6OM5m52aXM+mOZeSVuaJmNvIhYA0NthBpm2thSZmO8OMaLrJ6+lBkizQXGHC8qc36rOnxJB4+YUWub6nubdia29VY3ga/vMJzETiKVdHNMqvBdDGb42RsQOReNA6+I2wMDAB3IfJWks3EAg85s3h/IPTqe2fXSYJxLxBmGIpQc+bEy2SzQypkzS7f+U7KVOoXJ6mk6lWe07X1GCG+EIE27Fz8n6cUgpFPQsAH8GbPNAh1m75tKOrg2k9SAjFAz24dJTjaLyLwLxpU9jDwXAnjw3sgoHenO9NM8PM3tHZ9oeNeRFaawnKGNboIF5X1viyhOO6ZhyWJ3ueXwcasy0l7ZgO6O4QHLMtrMLYhnh78/NGwjcMpJOMP2Uqcs5wmG5jFZR9hiSKeMKVW2IVj4+8E+zkZrCA7CPVRtCWfFhBvLGUc5YSHLMmwXGdNbaj/asPvzZ+hL8KhPTAfIKcV5rw/2G56UObrXcGTxA/C8+zhEKYhR/q7lYCqvB9b11DHldHBtznBHeKuEIUdgl+DPH+0EtGLbtjubG3bTrL+wV9cbPbmw1HIUKVLpSKYyIyi4jRy7b/VWiOoO1GexJAttNFsasc55O5fdtMXbn2oqJ7K2hfBCcgun9Hxm/Uf2DQtW571jGPaNtG9l573JAXLFtqTtSIgp9pWdtWGey7BbvGmURSP/aurIKDOMBiHQJYNBJvISBGA7m0QyIozGa+leqvTiNK0vMODQUWkG5KHf80tFL5TkeRJdyDwZXwD7LSZ4ss/KuOTEGCQdaruBO6cK50G/7uOWL4ypIXAH8YBoqOxeffVJo+kAz2GhIzc6ckNuduRmmUNemdawNcg66QEg1CmzCGtxwQF7ba8A1rwPxRGsc4COUaganbZD2B6PDPmIT7be/w4128ZvjrrDUctHBi4lHEEeKoqj3UAiDDxBRiIKSKfUkOwbg19Nxx4f8S0Z/xYElEBnciNlwtIy56MBeFspoEQ4+EGa6MJ0U2rA0qlMYkHYBTRbFGuyYtNXj2LYxCU7W7KU8jXQoq8TLdOxx4d77StDZ11y8iUQnd1rmScGI2BmdUqnb1gbmy101sgdQ2lES66GJlnUnk2Ot+iIuNdZLx+d5dM2agTMTAK9KoD91ZBoZRPHDIjvQYUrMihNBkwc2tZ86d4p2g/TUMMead24M0h0jB6NDUs9q1dzZmZAL1ozN0zwmpS/VgkuFtxqTCEt7W6rTjCiM4sNocDuMQWpiUX1Gnqm1ehZPR53+pM0tGs0dJtGi47UGvbLBQL5RPVjfaArW83bmbZH+fhX9Ea6xP5y02mAEpvWpTffrHx3q3hFA0+8hDk1tEFvJ+LnEUAtt95OXPqJ3BRCztY7iHwvRTAU8mWQ4YzIS5wvJBJSnIDbCsmcgmLCz09BAjXCyxTKr5eTNJz+nCS+3HZ9kdNDoIPJUwGbvO0REMldWqilbojfeECHVvjJJI2zILyQ22kQwXphe+rGcsdNL+g2HEXIaxhixCeJz77UcoUzVW4h+Jm/jdyLgFwHZOLikvsoDC7F7KEjOu6knN4o4AhPBF+7LrLLTuHO3uoiF0WqyFdOw+kkfTtJoDaBTxXRjhDj4yC+IEf3YsqvB1HxYuIPVUm8ClLxMg28C/kqRElxXb1KYKzBiXg18UZZ4MrXkNT6SZrI1zj4xw+icOSshPQH+E36/UWAl0z+kMRiuiPgyClpe6T1Qu7hGiZy7xKnBbkk991LEcO0RTtegpRK7rtXMUe9L6Ik3h4FgwE4ijCjUW7IxTXOTlQiuYo0qvRwoEqu8lDEcFICyaVqhd26WtinipU95WrhkFyIcPZA8dVI0I+OKBax1E3mwE2TJJYHwg8mETrKAXcUDqC42KlaD3uOJylIKtlTJFF5i7aj/DB4HZafmDUf9nMDQq0cBH5clOtBEOfbNI4fBFk+PYFK5CDxPDorfOheur8m3B4O3cupPAr9fQjm1P75dyd1+1J1AL7gGyojx24oZm2IfJREuGYJhG+WvGN37E7dn0fBWB5D63g8GQzksUgnkirvOJxE8ji58lUzV6WEN0+SbMpjyEkydbmOuq7vh4JDVZV33dhXzxWl2hUuUQ7JbiDi2AV90KVIpW4Ks+Keaw/dGKqHUtHP2sapCzIfN5SnOCULNWsSuXmC5VacYVkf53JWAqp3/zyCNRWXN/12I2g/VBPjC31Irz1HWSjTYd/g410+kRyoGVb5npj3+DFdyLkI3M+MQRFkP5PPTFZKrhkq3hpJlZhtnkjWdRjvpdVYIAJ7s0O4E802NovqVp3WdEzhPAN9fNnUqYPwSFpmiHyufMSYjL58RLpmrB3Z0pjlSoaqWG+vOHyaC0KYml4Vv2hT8ZuyFaV9a6gDd/hTXOjEoZwZVu+GadlrZntdKt+Ks1QzCc0MLO7STknsvJH2c3rXUIgkH+OAZOAXEB3jPN1s4sfE2zX0CYfUjtvAO2m3TZ6HmW67Z3B6WNtKdwzjbm40oFg5eWt/7BeYZ2BlSdo3wDG7pzDWdGFw5MVqq1XXZmp3FpUfLjuxzMSHEXbbplMRs+ptOT37Zqantm+XWCDGjlkwkInPVL01xY5jFDhm5bTaz+l2CyBqxaMZaVHsfqsOrGTN01l6DQmPebGh38fRSTqboWM2jEZ+FQwR63/Q99tuPg4/Ec9/fCyaUhReMhgI8XsiEb9mpXjg+x2RjNzYD0XfTctxlQL/tcxB+vw9UWD24SorRzYL/NdSFbnpBQzF/8VoMvf3ZS7Lp+GkXNwq4HemRvWFdqvxu1r0LAoiXF7E2u1f6iIFedVGS529tWNDBfmJlzOn5qNWQxGa0/ZjgHlvpQf3o1bDfBTEdr+Ab5zT6wXFYZ65Izxl+t35l4rdzY+9qRJTjoGJtRTklNYkakgxYPiKGENRq9EjwnLGwaXlP0pkySBWixmNFz30qNXo2dAXFMF2o1V4yg37Ka0+DZPH1wYgseghY/Z4zVxoFhVWJ4fz0ZftVVO/z3eLezVWjWFaNNQqlhexVm+F54yGoScSPLpgdpBBa8VwDGuhUzNWnMYif51aDTlKBfl5iWybs+y1m3LB7BhGq2G17OZCRyJeYiAnwpYGEGLpEJypjlvzeesec4R3jVbd7pLKZ8mo2TWjxUiVhtErHQgsHR5s2KtWEDn1a/pd6j1Wk9DjpWLeL7jUlx/PsanLDzBX7x7ZNBr2bSma+9Jde2HXHtc0CPqq0XYaTK2zasVpni1N9gH0TzNtaaozCH/rwy5q1M2ZZkIqcQSawaZ228/xxTsf/FO/hwyaMwMgnUfzno/SRnQfxxrsrCGt9x0b6pqbFYdkuU7D2YSDTmkbH61OBAfRNZs8vZwB45aq8db5bXUnUWcL9k1ZZ740f1z5I7WqQPKkXVcW851No2a3DD7WqXXHHu+oSF/jTDGi3Qx5fpBAGg4I2JG3gfXJx9wdlrjwJKvpfEMNSDOsjA+RfRXWXLM4mchi+XgcBp464jMDVC/YxSYRFHbFAU/a+Cqd7JzD3tPIAQTGmvExlRIkAIAqMw2UOjujWTaY2SLY2Jdq5wSIWrSvvs0wTiLGJozekdPng4o9OUoieL+hJHFzSdZEe3EuAJhzmORn9NFDIIgGnjzSGtRjNyfSkhMxBDrTicI9lSc4OxoJ2fUAg6OZ5rvMQXI6wUKVeHY52p/cNHAJmF+f16StBj6huUF7OJ33sgm8aI2QvGnK95s4PWZuql2whunMLZZ4NTQDfl53ZLtBFHFLZg3a2V/VDnTWMF5Yg74zcLOoSceJ7t6G/rl1bi69IHMZc+nF+0WHEQ4UZwuftsT3eutq8UA8DMdnhbU/WcljFqxrEWKBdKpQLb5TMwYUoe0PQo35F1gX/kFyamanrY7W57YvrevpOyeKbN/2TWl5fu6kti9T8lv9K8BLWyIFaHHf851ryVdrFDocDqXzWPoBbRCPDUQhBsPMySQibRT65CYWP/YSDXbPrNG1MyNeAdK4WSJhKTOtEHkf3cA7YBHVAXX5zEreOgr5kS8IkM+s/tRhXEj6hVc+s/ycgFPnCBcaZcIFu2WWrILwvKkbBjjsyC7zqVxaWGm1S1SiCsGCgFylMv3SO6phSGMPekbBMhSEIp3z6G6v/dTvy55gMPPSkbmST+3SFyFkaaZ9pUeL5/SeLnozfrSBGQ+S9BsSOfWM1YGuXuHww+JmyanICe+MYX4QAU8ZwwtQqpWzKBTlF9cYHYP8zmlB/Ra7ipfYO3uHTxWW8wLvXKqgNlWYxuo+HzxUYymZmhaAz7HPJKtwFK/PwKtnhQ4XjVM6WHsY6wnHGYN8JOe+rHfP3Quh9hLmwDmTFGBrGjJmmODAfQmNmwZ+unh6Gutr1ify0WlJ5R6DP3yWL8UcyzmKxRUZ3sXiig5BwrxOHUGfg+lml1dy+rSnr3xzHs2UNwNWBhcqTUSFy9OYbWgYHzkKqSYEbX/CtokFjDKsT4pCv1Pi2ZU7VhDaMGdMNGgpmsgMh1ZelwtLQRZrzN0WBAyTpPcOy8LAgNf0Hv2m+fHhYx7NH2Sxdt2UNqAGDJ5MZNPabP4GqlYTJ7eJqnX1hVNrG1avTTaHNMrfLhkLVpa6DjDx27fO0kyFBrtDhcp0w0LZjX1jAMie5SylznLkPw0wSHXFf7BakINUpgMS6B4/fiyXl5eNQlG3JmeHKVulc5Ta/OE5xZpO+o7spzLtG+Y9cXz4yHyUdy0q7D4JTxoXSo/GL8rVWJ+dq2b4XJYV24YephXVq5vBqM0lFM6yLcwHVjBkPiZCjB1sCqOg4YU3I7HRcMlzqE+Kwwa2v27U913F6xonsQLeVV0PH1Q4HAodnrpEATfF7XcKW3Ytz52fc/zgw+tnTAsOq9zxOJwyrKnEUW2FmtwH4DNtERMpIe0UM4kA7xl7Whb0RikXgIKiAmqFlwhIbGpKKSjzQPcEkdYHojnMzPzgEoYoetxTPBEoJj7MrX7oKLcmfIap5iBN3gmCxBuKnKLkQszkyM3IP4KsCWx5HPOWAaS38SQvYWXKICsgtYIsm3ArkQG+FYrC2thDpMQRyNyf16B3TNLpZSCuyNyE0VHUoW86+C0gJ/oKnrKA8McWTupenXM6mG5OpoIg6FMxhgkeSL9hF4AzDBrykTKThWQSkKR5Mb5piDHcBREjmUflJARr5gNUzESZxRME6TWn4l0wLnB5GZEXttQKXVsRx85gVhoyUZ7mf8F3zT5FwmzcZX49J+SaGlPAtsthxL+irGBmgeXRsPTor4oV1mo2nnQUXFi78wEUywx+my7WU9l774RuPJy4Q9F8ixlhXIDUqZ0D27b5u2oVSroEYNx9gI0o/4cfggmCwl4y7vzYS4+LIe6LSjg/dkOwgaiFJVUNH8ZS0/AB6EHGzKjC7pdNdQB/z6iNLQVsdfe2oVf6tLvkAjAfcRfoDX9AzPaNOnXv/4qTKHtxTktkuZ3rIy4KzRp3jmJswk7CgH/3+PJ3vvzCl3/IH4lS7oQ66AlzR6gFLsFhn4HIhA4rbfm/kpm9q69q+GaO037iA98jhfEpXxDFNqNzhMLXQB1wgg+ZGVJLMxUj+QfXk/E8PKGm4pvBDKdBnAUQLsluXx9W0YzjJayMK/zRoMRj41iLuHNogzMilxlElGZE1vNZEBdknCBBLaStPi/hmC2+wY2WB5q7Z+3umN8ZIQ6A9N3YB/RSkuLXjX3S48RJTtcktfugUeuAd7PjgEqPufSAZ2r38E+BnBLM6VPCPL2yVzumfP/+PekRGnaz11mATS34yWdGte0SzP/jQmZ5TEtzw3ZuHYN213pytrW2Wqhn7+wOfkQrqIzyOsVrM1UizJFgKmX0oEe7e1vRavQWF1qNN4Sm2W1IPtljPDu0Iv/d5DJ35LOfLT9/50jbv/n2FoVM6FuRLJynNA2Q8+7VarUdOG0fcwP/s/x3jmlIBH76cQufp/2LBdR+m5QFh9boV+GYSNXoV1ytq9iR+hDQVvPVp6m1rNGvA9HHWt5mvFwNHqqg4X99ZiqxyWfRKfMU7nuWDDT4e57C/DQzIUGlJsxEAfmOhuwlIaTEVKGwsynqpfTSBNJjdim9yQyzTYQ5OFVEhuX0pUJeL3GYB5eEtgReGSl+lSImgUXJTzNpU5M7yEF/ClEqhD02TlUOLsQ0k4MwGGvUc5JFWaQipHI+oUArrBFjQo840SMItyPqzKNsGskA5RD4CosnoDRjvPiVhwySnGnkUBSe08zUhBIXQglavw5MSbIQo48DJjnM3sqQPh8SLnIEq97Ivc5MGXFCIv8/ZYTSiYTP5+SiALClEclpZAwcTcjUOYKQFIvhbP3KiKkp0f8AmCcTckwr6/GvckxpGqd+ZmKv6RKSNjiCUe+pG19IGsAALv6Oqaif0e8aTqIFWOW6IcQ5/oVQJ5lqKGU+gZQqLaVMkTPzcMYObSEjY+XSeQquC8b4CYbEua1JRLMsNTXHSUbHZQBLHQG29VJmMHcu0Kn7gFEnfGoijQ8imV8PlKD4q5zEXNcKeJqP2TBE9WRMtccwr4gScm9mystMXqE6iKh+boSWV7+umfIK5X11Ja/RNK77biqv0fpNeU2t4xot8pq/en0hpvIa1X5NZQ0p9QLatGXaUgBTZZ+grPt6WIcBC/V5ucFyH4FKt2GL/2RlwXzfkUtPF1/0HIPePbf7bXMGKt1yNDi09eg/nLqhZzjC7yLrlPMlhqSzr7eeNe3rV68ctTuRGdaSfTULNuq04ajYOhX+0OPlVWceZ1sP63K5FFqALEtslCxY9VWnYC8yF1rkZmRnDexsr0KiIluX6pN/1ieVJEu4qFbh4b1G5bm9A59qfQHJdDTK68NO5kMo2i+gmKpG96c1un9Tmr+AYqoa3Z/W6B5COf81Plk1+gfT6P867bxqdA+m0VXTe9Xo/r3T+1+nBX4B1VQ1+mp6rxrd19Po/jqDa9XoHkyj+8QYSKYCf40G+df4ZNXtHky3qwSMqtFVAsaDKaaq0VXbA1/8J6tG/2Aa/V+nnVeN7sE0ump6rxpdtT3w1X6yavQPptFX03vV6Krp/cEUU9Xo/g3bA7fqZGp73TEKwMoZdhAH2TcKOxMn0w31xvrNfW/os+zFu22jpw8gzz/wQSz6Mf7UPXF+9EbpY7U2n6gggMts/dbSsE5L0lq/dYy/Rtf7a3yyGmAezABTiVJVo6tEqQdTTFWjqzZCvvhPVo3+wTT6v047rxrdg2l01fReNbpqI+Sr/WTV6B9Mo6+m96rRVdP7gymmqtH9j2+EGI17k63RIBUmbhIzD5llO+11UHzR0/dzgXHYqlw0WnVjBg/Mz5Qwgpk3QkG85anr5QrVjTCvFFw2Y+Bq6mjC/GUC6RIJNnFJKwxgXxBNwwcA6hrtPNFsqwwMPGOaLYiyNT6wBrxlWG8CtL2XQLvgd9B4tslghnNLgN6MXzuVsZuDWpAgGROAdQ0VDJqCr52kEsR9miIiFQMgxxNObU585hqqcUSM7skg1zyyBBk2Y9BmxPBJ1AdnN5PFznC508DLB+MSctk8uTcglkdpEgfvgMxNTN/0bfoF7bcbZwEY/goC8EtQlhICmWYCXzI/wsOhkCKfAcX2Q0qBMchzPgH7LxTc/8D52EPMCGv1WtwyFaO6Ili3FjqAEgN693tDY3mDjqKzacqNDvBxn1pPibZPWrKgYu8Rrd97k5lrZrQl1vJj5xPA10+s3hM7c+pP7BZj8bZkQbKwFw/koXtYoGkCIHGr+UqzKihwxLvgmWUOa2tXHI+dEnRisM9ojO3DLXm4dY4+4Xq5SM/JxwDQ5A6YAITcIFM5l4dn+/uqaxUMuneARwm2T+GF6lpuEk8HlZ/cMJuGKa3NzgIKq92e42pv1O3V3tKL986M5nzdWW/V5eK6QnrlqQm8fRjkakSpNzcbgFCbxzy46jR0OIZctCXdX5SOXEQdSEMiaGHxk/eMui0X6ae3CLTiVmMZX0Xci8t25jQWibXPmlw7FuNWgjrG7kurydB07LEnO98/e9a0JzsvX71y4N1m76tXrxwJUkKrZlsOA4mDgxk+Q3+JPqTBkZffLDoG30eXFsMgphEODEL8vmFiRAMOZ1Ncj93YN0xF3UDPBP0Uo2WTuQOaqfCS1G8SwmBTkVg3mXGd3+PnAAg+xfuDJPUE7iR3ANNphBtO3NSfA0gnVH686AVSf7zJTA6ELYuvKAD1UGCUSoXHfEjziQHivolH7LoOSeJwCkBINxK5SEH1M07FILhGbb6duFnQNA3z7SShARI4twBpXFBM3U1NfpZOQpEZmu5sEtML9H0io4iHhkkkaEAUtrhC7MwBWcu9NUIYpEAdZVo0DfqbJQAgzay3l46ar5ooINvUM1bHhHuai0vh5UmKBKgoml4ynvLvgmyGIh7mI9mcfN9MxYCulCsbg5LnYn5z/ZRA35vAeaR8TlIwrTbVRMeYvlQ/qqLpcXvV86SHCHz6QSz405ioI5dStamGBTQd15/aRIewgb+ObUr8beKvY5uGJDBSpICw1JssH0zywo0fQ4PO29RuM6lTi2GcqE8YiJ3fM/hFX8RJFMRunqTSn8ZuFHjNqwCsIcmgyZOkbZpSvLXxM3FDul7il6KkX/UgMhWkaQDC8Ew2NWk80s8grZcixovXrnqW898kaE/to2Iw8NQ4lwPhgsAiI1j8Jn3LNhm8FRGghdG82ExF5AbEA22vGnhiko2a5QIaJGmTsE6Hng+4V30TXb9oK8XEHcSUSOR8VuD4IhBgOYVSpZdqksQhBIZeJFXDgkBAN9Ws39xUH1HNkBodtbhmDgRqynXkXog7aWJgVt05tQzBN40yRD8kj0hEb/FzSUD9xGeSAASWpCDbZGqTWBRwsAgimaWcUmRE0RMALdb3bZNwrIv2VzSh+0sPL82K/k6xjd0AdTgW4qJJxUauyfdS9eJxkgUqsQV5im3KoqoV9wN+i24I2ZIHQWqf2hkoqNo7yZw5F1iO1e2KSkaVweR7g3jPEF3RtgpoW01X0PQs13fSBZm9nbipfpnKkqqtuakkwuZmNo36SSibm5N88H2pMdw7NgG1GBfdaIvBCtVdajkfHTBMCJla3KQvz1ewpFFFDeDck3NxnU/cUI+meTqJPZcH8I/2Mxo7eexCtooPqHllNgLr4tB94V/MNWYSDMk8ZwZJ3GT22FRepUF+twdRJZfq9Z1IE9v8jdOQ1WzUn6w60trYhJzV2bznxZ6c+RXQfs1sL0JyWLREAMI1ulIgkLz5ARIlZ1L1KqTKeSm7XhbFLZEN/LAkgBoSbuqUAxm7sWG3nuHBF39W3FJFrKDYf3fUd6I1A8Mw/8S4KXDR6idEq6ZrZOYsbpXKzXrW/O9ibbBa+H5boX/ey/M5/8S7/7zYPu9l45+05EXEOMgdxewAVobf2ml6siRxS7UssG0JAssWlgH/5NP3vHH3BeVZdl6UdSEvei/sq3qtR8oiqHtu2ypFj5dXsdqhkpnTAzEvOLhiU2IP/7g66C6Jx5y+iaNZZi7PFpQ9Z1jMFDD8N2sr398ay+BAr1UJ+uISNFMEGuU/5tVpF6T2hmIh67U/0QYpN3b9k6rHPyThdwqy+u6f993PbB/WxmbNMFdabShXQDr+wvyAfGeDUrCxud4Bzv/qk6eyR53hDwlX6TXqm0bpT82+XIorNWNjEwQCf8b3Py9dLATMdFa/3VfER5Ux90NPWqwPWwEpLBRcBubOlb9y/o2GulczF0hXCsUHqfpJdT/TsbPGS/FMStf3pRsGrtLaZB4Rhw7nCQSnRO+i7oB+peCtsq/kkmEwG4si+CSujCAGwWcc5PzkuiFBAkXMS9BEJQNeyyY5q/VjWn2mvkj7pNLKA6IkiZJLUSYZmcSRG7tD4SueD+ilNLNHkI/4WzeGnO2SZMQUOEeBqHZChHfBLFNzOyAF1WuI1beYqfkusZCaEbQy83GxAxJcC3+O9bREcMpvzHFSgajPu7jLPUUlMdbrd6zXL0WaBqDChh4hKzNiazpSsKkwASlpA7HaKliqXHBnZcE7lHaWu96FG4aJV2xv8CZGed8inRLTSgJ+bV1AkzhzB5rg6jJIsdi8s49RkDcaahV1z6BYI8Kyf1MvZDatEmHaw0yjUTdmabBB2EpLzg/7el3lBuRSKzXDqS3y/khBsl6weWpS4FQMiaqX9YkD1pmgwZESZpy6w8iV6iFmWJ8xxff0aILtxqgfTlVnGKDWpaJ3VBy81FBLZJKK63M6xjaIoblKqxGqGqGqEeqLHKGs9sqMttQj2tLPkLjtly9M+qqldgct+6rtMMdpxpnDxzdXO6wLyeqqEz+2eo9fOBDvrd7yC6e+TIlcfvxik57sWHa26RjSerzsYBnxQvMOvqAjnlc1wzEkVD00Wth9PbTWzAUVYigaPS2BLT9+sUolhBgeG2SwwpkECygrNx7LFyoYQY8fl8xGHvNby0q/89tKh3QlsPaomQvLhlKA8RJ6tV5Yv5QWz1gY0RCn1kbk5wXSvORZ5abKzZ+Xm0+sVZAkc8Ex6Qw28y/rIafI979Sin9cZHcGPfMrqp+vq7VVuXm4ufn4SFC2T/ry80mrsq8oP7N6w+oSNmOIyFywW9gaguUaqV4NJVsZDQhahmTBa3XTMaB/woJ1k8djR27YqyaZ+pHUClNAJdgtbTxRsl0l71UjSZWbLzA3lbz3sOvn62ptVW4ebm4qee/LzM8fJu/Zq+am3LDXKoGuGiqq3HypuakEuoddP19Xa6ty83BzUwl0X2Z+KgXel1+HX9dIUuXm4eamkvcedv18Xa2tys3DzU0l732Z+fljFXgYlysdXjVaVLn5cnNTyXQPu36+rtZW5ebh5qaS6b7M/FQ6vC+/Dr+ukaTKzcPNTSXvPez6+bpaW5Wbh5ubSt77MvNT6fC+jHr6ukaLKjcPNzeVTPew6+fram1Vbh5ubiqZ7svMT6XD+/Lr8OsaSarcPNzcVPLew66fr6u1Vbl5uLmp5L0vMz+VDu/LqKeva7SocvNwc1PJdA+7fr6u1lbl5uHmppLpvsz8VDq8L78Ov66RpMrNw81NJe897Pr5ulpblZuHm5tK3vsy8/PH6vCK2DbsVXsNUqDxW9wzJ3+wEhGrwafKzdeRm0pEfNj183W1tio3Dzc3lYj4ZebnDxURiTO9t2TbxC5N2S7ll+mMi2zzwy/003j4A85jo0ZUijOuPqLCM+ysYXyKRk5Tzd3zAPIHydJav3FU7Jp3ULH1MQufgWhqFM2CnfF01qsZYHqHvIqwuR7sfIbvE7OmTp6t6fxmb/5FyX8r8uOK/LiiFq2oRe/phV8Mtejnkx8zoXBDzwFVz696ftXzv8Sez9/vbEqrduNISi4qCEm3DDlzQhaNxZWSbCvBrxL8KsGvGv6r4f8LH/5/p+BXtzBdfETH8e/Lk9JN1DBZUQOyswa3vmLeqoaqaqiqhqovcajSvaXUtz86/uDJSk6t5NRKTq0G/2rw/woG/98rp85NFx/dk8OTHbXb9hvHB4MmmsYDrli7Tz1a7xNW4m81AlYj4Jc7AtbsPjXnT4xj1LEDtlZtxElumNLNjLLKtur+Vfevuv8X2f0/V/6hbl6tf6v1b7X+rYb/avj/wof/32+gU/T5fpKEsj/NhfRGbip94QWRG0o/mfRDIf1p7EaBJwdh4qJR5jJM4qFM+r9SH6P3slGS5hgfUOUTPDOhhyZ849JN5WUS+PK3jC5VR/y3dEQaDtFEbj5poGx1VtbbN4btwJoYM2hAw2lMffkBtqZqrqq6yB/UReyW3aIh81nNbF/z6YZzp84OR/atZ2vwPltzWOB6abdsH13kvGH7DaMu7f6cH8/MP8GzjrCaDce854blD8Jo4shwIiehYdr9zc2OKTc2Oqa0mh1nU9asZuOpdAx7Tb6XtmmbdKfB88hCZ2PT6Zg1q7biKK3fR1WebcM27ZYp221p3dxCMq4ZK622wwcfHAPHUu0bmqtubr/8oyRVbqrc/E8fWro15n8QrZf4Qg4msZcHSZzRQZ6vJ+tfV0VWuXm4ufl0JyvLMSSnKFGBZQCa8vkIndKsfPnlUdYTVbmpcvPvOEtdzWVVbqrc/KFzmZ9UnarKTZWbP7JT2VmdJMBKAKxyU+XmjxQAeftg3TChiK0mrio3VW7+4IlrZtT71QwnX9fgWOXm4eam0lxUualy8z82VynTgqpvVbmpcvOHagWDQSUCVrmpclOJgH+NobDKzcPNzcenKdYGwvaUXI1q1qpyU+XmDyayMKt5q8pNlZs/ct4y6nIkwrFI7awBdphq0qpyU+WmWmr9JYbFKjcPNzefmLJ6L+yrRq9mPbJzp05Ht1zfP3WHP9BEJt08T4P+JBd0mk9EIs4zGcQjkQbkoIOZoTvFkb0o8UVYOtg3doc4rycykV6Kq1GQq3A+2zj7RiboSIvMdchxKgbBtSLFoTNnRqteOl3W2TDKZ80qCsQqN1VuKgrEigKxyk2Vm4oCsaJA/BwKxIqPuurmVW4edm4qYexh18/X1dqq3Dzc3FTC2JeZn9/HR71hr5q44xt4f3O1s7TxBNJY22a05roKVmH1SparRokqNw87N5Us97Dr5+tqbVVuHm5uKlnuy8zP75PlJAteq5uOAXR1Mr9bNTc7eqdZ/WDD2cFRDXIYcy6jeCxTSa6ZCy1Kfp0Ko+5InWKD0lq3Wzff3NK9m1tHfs636IcF0LZlX7XaTUfxtv/mrzf0q0v8LvKKetW1KbmCUd/Ld4OXHUPJrTfLj1chuH5e6g1T/o+XlkbS/s2fWzUNc7MHkFUArOLdlvYY9aUeSp8kfHvVqfc62Am/MWo9y84fcetcvfnmVtp1+oZNpNwktqdD6abDCW/WE34usblgo59LuNFbpHVFZljnS27z3VbzH/b11rOmff3qlcOSPu4t2VezYKPeQTABQH9+JS4/3nQavGtvXy2hbDsbKAhIJVUb+9PbmCL5UZjY17mI/WzeoiPL3dgD/PEMLBvAzMBEVlRACxdimgwIBfhzWw6vTrX4SUOkdtGlvmnwf/P3tEtFLdxpO7z8JfjuAu2+ryFTWaAucWLYNbpi0sWc+/kfJsrQTcP4/YmmLq9SPR6HU9kPYl96bhgalAG7ZryYf7Pxez72mwq/YEGmprKVpu5UvlJlJ4/TJAoyId14KoHhLtyY8MOTEO3kUqQynkR9GPMwMHs2jfpJKCfxRZxcAf+dO58CxnZunt9K206sZ81vHOtZ87/4R9q27dOQZrek1Vu2bZqRjWUGomYQasph3W4Zdt9ym+944Oy028b8Q22GdJdulok0l30xDGKFCU+456kL6Hg/kX4SA+r8CqDtDHce+1Jce2JMGWe0czdkhPNJXCDwsiNJCekcAOdeOPGFto0i/PfADYN3IpWh+25K8O+RyEeJD0OpSShkNMndfqgA0JM4FZ5Guk8GAEMnYHiNe467WTDU0PUFgrmIZZ4U8OXAhi+QyhVCPGGVB/mIQMpRum2r3XGkLTdlc1NivOx0TLlpmBJY4QANt2TPXF5ceP/GkRaYJuxVB3jfXKwZ8hP7MkxSGWahDBFwnaTIFZoODfF2y5nNEy0eg7ku64/lG6v3xqm/kVyBd7DFa+ZCx1AThe0Yn4xBJahArqfqC6IxeAAIYh+o8mOAvw8BpZ8XLVxmSTQrlD6tttVN3a7Oi4akeT7mk1svImuaGrqdANtp1BFWo0ko7QBiZ5B1+dSR1sZmu+N0TLnQkXb/3O5bK+stCMU3tzXDKTK92GrUHj9+LJeXlw01YZv2mqw9lsuGKg/0gucGP163n2NkozmdhOJnzf9W8q+B+i75b767NZa4g5+NfbQrvvwk0gxt2uWmjQta3XmWTNCN/Mvz+DI8z1M3zgJ+YpCL9DxMXH8uNAyG+B2PXOmGuXRjb5Sk0o2pK6A3psKV7iRPZN/1LkCXEPuy76bnQXxJ3dRNz1ORBe8whsCD0MBzQ9kPXe/i3EvQ7PpJ6Mt+kudJdN53U+0cTvJcFL7ITdHllW/s+kTg0E+uz1OMVyBGSK7Pr1J3LD03Pp9wcXhuKnLpjYIQ/Aj4mJcmY93Czt1BdC5i6rXloDyIZgGDSRhmXipEXATl4jo/98ZoqZciBM+B9INUYPiYnsNgUvqpOzwfubEfKjcoI4TP7tkTqYtBGM4hJwIueiwZn2cj10+uym5VXggZq+eT8Vj4UriZCGK6wHJT+EOReWkShhj9zoduJMrVirBsHLrZaD4UTSAV49CdfhjOLYfdH9yciixO5oKvhcejIWdWXAf5fVEjWMUM591bH8Q7cH3kExfkcxCkWX4exD4ILdgDk1Ri9gjycwqRg8SbZPx7HrnZhRwkeDpJhWqvVDyRG8TlLw0FIs5yNwyFf64GnUwOk2QYinPKyIWYzvkzdBEV58jNzqNJFnjkyoqwyyTwhByJYDjK6XCJHAXg6xjKERgy+Pe81Jk4gOud3dksXPhyNB2LNAzii/MCSl4GaHX4Ue8FkTsU51k+RTDPa7p/BHEmKMuXc+5yCsrBKr44C2hqzFO3XGZB7oLB49dJlgeDqbwQaYycXYhpP3FT/5xrInTj4QQjeOhOkbUwGI/xGHkzbXwcikFOgwE51FBAbjUQkFsPA6GIh/lIhkEszkPhchg8KKXQHaO5BzkH6RYCj5tKqvi7PYQCIxFPVCVG7nUQTSIZBfH5VeDnI7h0iApIfDeUUTLJBP9ejYQyn5axmxITCkUJ+YASototRmKMyKXPJ4MBKGKIRKYY3pJJjtcyyXmalip8nNAfvzxma+vU9YNJJlM3HkLamPWTFG2PipZdqmzZowqXPbp00yQnkYUuCJXppD9VDSpzsexQrTJzL8V5MRTKzJ2eFxbn5QzyeHqu+oHycTnyuNV300yx5Qj/nPvGvFe1xSKQGv2c74MnSm09GyVX52jF59Q52J9fJedXQYxBl27plkKeaxQyuabseifo55xJgrIQw/M4Kxzn0STMg3EYIOU6ojwNLgQYaibDkcwm/XFwLUJJ0wnPteTkgiUnfZVcqG9/qIIpCfloEvX591y1GPaoiYM8sRuEupxnAVzUNM3lyZgaA66qKcCpGgKcuhlQ/YEsB01uEvs07giw6lCV0YSkhhWmNLpUUoi68lSgPflkHJKP5QFOEZf++QjFXGouKjjwZu657q/CuBI/eC0PchKZ4ck4kmvXxyiFxbK85pK/VsKNuro8+F3rq0cznbweBGEor9VqQF6rYrrWA8S1HheuVY1cJ4OMrjqtVKPX1Hyu3yVJJKeltEw5LVOVlulcWqb6qtIypbRMdVqmKi1TnZapTstUpWWq00DNZ0ppoN9r5ab0qB+MPSRNg+ULQhnRJ/QneZ7EfOFuG5PQwpIL9QRFIJWisodp4EtrdOn0k2s5SnJENErybJzkPCvxr4qV3JELxq3xJMe8IUO3L0JJw2YU8YjMMdMQS+JnfBmSUiwMRaiGEvT5AXVWHEKhLkM/6jto96m8RGIuA3FF6wtuHgZ2wZcoz4dYRxKj2Kx6qHZULYCA6kq68TDEKjqIXJaY1c3SQnUEFQBkUzWzMX9Xf0IiqeuNBOkHpKpUb4QB22eR9ZyqxRuR0OAFqReKTC96Q0xeXhgw9ZeeRD3U0hWESi+JB8GQ6MDcIM5mvGBeksYiXVPX59JLJvjy7E1fDErkYQP0cRwE8kXoTqUfZOjofuEgYRi+LAkvhRRhMJinGcPKGxdaTkMwBPVYKrJMC3Qz6jEsydMkmq3JNQ9bdJ4mSQ4JSo5I9PAVIRmqjlbrWKJn8tdJNJYXWCuGbtT3XZISZCiy7JwqRvhoRhRXlFwGWLNjei+I22ISQuQYJTx2MZWPMVxlObICIQ/rdzin+SiJ5duJmAjJQnzqxn4SyVTEY3CXjYWba/oymk2lSkAxw3giFjLzkjGtZWkGosmDZxC3n6SsTiAvaTXUHJsnY/ykQqoZGL96Gpr0szzIccArmwwgB+QjgVEeo+IgSaOZ61wNMhQwTjJBWodJICexFi55NE8lCoIlV61+8MGSxxc1OyuPnm21n1pHQaqGjmW9GjguGoh1mjvpRPDylX6eWf3EUbYpbduXz7R+yVBXTaMGjjSpONeM+fX5r6bVbDwpVuV1uw5iNGhXcd2wNjqbjik3LbpYT2XvvSNnCiZWNCSpVib07CX7Rtq3S8ulbS0otmpmuyXtq4ZhLG/ITWmvsmYDP6kdS7W9RQoABJDGeqbRki+ge2g5dbmoKNkodNH2LVYCKjUYdBs1u2XMNGNgpLsmHTkVCKspdOkYpiw8VC7jWbmQsrSk2KCH7y1BwxpMQufm2cq3t6XE1cxOB2pnqKWgQC6StFE4JWv/C/9H9XbEGvkvKe+IUPIDFd4/V90RB+Ufpb5TqtGPqO4+qa4z/yx9nVUziMNvZb3l2JIqvWF1mg74nxt6r8m4E4xGa9qxtFO6s2Y1pNNq4Ld8y2jYa/MvkqOItNN4ZD3qONhXapffs9daDaMxH1J6tlO+Q4rkrL5k9GwpbbnUsyV1PGln2OPBxepJp85Ow5a1R9i/eGRYvbbTaLd1YkDf+MgovcyO4kXTsOWj+9+xrJ7tOA3b6Z3L9tL8zfOa2SZlZeMNR91WW9VGw2i37z59T/yKAflRq1EMczrrKCSJG/cUyZLRsxYeLy49ebpcM+qNFbvZslfb6xudTfOFbdk2EvvmRt6+dxrytz641KvVfuOzhv2cBolSWuerc+k3f7TWk3cydyeyz0kTRkj1nlwyancj/oyobr5Zuf2w3IvNWYOqGurqRrtmdh4Z5Z6EkRNDnu3T/l+zKdUYaPtNHobR1HHBuGjZV02nrvZqGiB2Bnfzoz8gHtJhl3NgPrp5vnJrd41eu91u38kbHxGnjUBycTV80G/rvZrZbrflby/Ltbpxz8d+49ut+oeJqBv1ueKuN+zm48VtbPjRjqDfkFQi0gour30vjJyGYbNJyL230Ak7j4ze5uZmEe/m5uajDwoA2a/1aCu+RW2tbteXDIRoP3xv3rDvzZslo9eW7aVemzu+VNelWk8/Qm9L9bZcMkg8kW/eYDrAdoGd2c22vbr8eKNmWze056IiedOqm28k/eroa+W31S6u2jJ8brSMut21n7ORit1srbTXF0zbRtyG7dw6oDru2Za0nfMlGvIsHvTOP/VG7xxpWJJvzHPzfIkECtVgadv+vNVu6BbcMOrn5rlUgyWc58ptfOoLczMUrAoeySWDe0PTlP9bYgyV5+dcg+RbMuyXb7Dn/2b58Uqrvb5or9p2zdjY5H0YR21hrToGGQjZqxQ1chzbqe04dWVrZPVWWVSzLcdo4Fm1obskyZBopbV+azhk4dDBzG3wfFzmYebdeBJbroO8WNYEA71EUGzGSmBIp4bdfyHtfnea5SKinSv/5tvbpu3fPFe/KvD5bbv0e++Tp/c8BonV/2jJfKLQ6iwN9rkPkZAoIRtySOvm+co3t4a03uDdzofR/r5v1jA1qwmykPR4jWfwZj/MGPLCuOFRMqC2ROMYDYcNhr2wbwyD/fo2gmBVUg5qGzXlKoZAw+qtrDsNu5aQvOmGtgHp265bN7crrfV2x6mxUdkjcyfxyCCHlv2Y0UlyyQ0FvKGjlIsGrRTUusCUdqweIWHQaBQRUgcmAZFesbs03tu5Y3eNutHoWUsvnj5xeDHSe2Ta9Ztvbq1H/+HUuyLHBkJGHgqmL3K8iBRBhlFXsBxz7/7kpgGE3n/68txbpyLLH2272We+9jcxvUpS/ze/1Grwda6I7i2cmm3N1QcMA//VGrk3BgyYH6+jj75pW1bTvsLwChlFbwvTghFSRt3QlavsiJTh4k3hJjAy+3a+Ftzs4p+WZa3HSZA6RYsKeQUJmJkZrc7sjCQPk/WyFdKfcHtmdMlmTXd+++ZHjL76ZlpbrBtsTgpjUsS3ZmB1vdY3l/Ui/JqtUArDUTnhwi0CzuvGzdrKd7f2rWzNlul2vuwYy4sLZsnAlT9yT1pgK1qzOrUVMlSSdh8wODDzsSUtNWgFo1wz86AbzB3Gsn3VqNlL9lWjzcvlRs3uD2Jl1sfWXSKeRNo+BEvknNeVkzhIYmPuSS/FmpQWgHplTrYNtu/Uy0+wWnQyhmY3g5gGO6u5p7WFBEtwH9zFDRDU02NdxOb2sXz3cl7jT2NP0pki2RcebDKg92WFJy30S1pIShCW/NNYL/UnkVrh89QpBzEt8VnTF0ra9MtlmCRjGblemsiI5t2I1vCXtIKnzbEUKkKs1OV40pepGBQzL+UfY4RXGN6gNHTx6qU7fpIBlzT2N9wBbXME76ATgy5sZpGTap3YnI6LFRwjN5WDmtn+5rn87ltDWpMAY8P3cu07SUFy7fn3tIdkIDX0bmGSUjQYqqQNadcMgyxbFliLdO7QLyQtpT+7p6pQyfV777DV1QZP6KRm22q+gtqoZrbPzZnXqMtnCfUlvgEXwvrWszUdtIYQrbOjMNunRtIyzFIAOtSucEp6JrqFaf2b53Lw3bfSCiZ3CogKxwS4ab+5SeJeBwPw2gr0KG1pkapjvWastB1Y5dirTxZ60Px1WL331HrKqhZL4rqxARXg5iZ+rRem0yP5LfUzpN53c9cwaYfVWC8AtD76hLbjUePreo9G4prZZgUozGUIN5J1StQDBbV4GGYEfTbdQHetmW1szF5LepJ6XWOmFMsMk/YoDMnv21ljEgdvJ3Dwa9jVTHPy5onS2CohCsPW48cS4+Scof0yjGTJWJbt56XVW4dJe2O9EMH8IPOSOBYeYiadvLK4S6IoyEmNXzPbk1wYJjaXBdTb2LX1LrD3F1AiIHmP08TjTA6Eb5jZ25BzaNlXsuM0DHO9sIiqmR1UiHrDvmpIFLh8OwlymU5iY13ScUaaNbBOQHlnk34U5BxlzWzDfknGSTqJsSOUiSQOpwY3tM8rDioNpAiGtfSNdUPbLTSHaZJcTou8Ke8fkq3iG+HELerit2VSFkktFzzi+UNShiexu5+KbBLmRm/mxrvdBgs2dmZ0TKN8z+qt0+LQ7dKOhet5Isu2kzhPk1Biy1AM1c7ZxA8SsiXLJ7GQfXcqssCND0W+jXVVMMBGej9IDoS/RzuHGGNPoLjFVlpOW1xu6mPiCPKp9PxIeuEkywUpab0k9gOW6U9oo+YVhutM7ZJNUk6Dl4wnocs7YqkYUnnsoCdcinRKvuNUoLxElpG36wUi9sRxECY5B+QC1mVegN2t01Sgw/uTcRh4/AVfiPG+cFN2HYpJ6obkPMFGavZcCi+CUVWQT09EJkU23uZMYNMsdIP4gED5Bq6XR64nB26W/y2O5cCLxpiEB8Lvvg3lIBVvT92+HP7kpvr9oRvJYSjwm7rjUVdEQXei0jIKfF/EB256kVzyB8is6DVtKQWeW+zVhmTU44bHnkt2PPxw6LunyTjwJJpmN0+FG2Uy6nsyoq3gKDxNkjBjPMHjST8MshHqJBb5VZJeyJhK4VDkMo4GUL0f44iDyNPAe4lWgCBlrJOM80P1FpZoUfCOi3XsxiKUY8/Ffh12UjEjj0eow3GYybcXffk2DCL5duJyzaYQTyLsLsAMTG1GpiKIB0nqkRE9l0ya9CdZjuymk1AcBGTQRCYv7Ij9q8CD0YrnZqHEjrQ3grV17IbTPPAwfGdIDmKkwCyAXcvbCZqNzPjDNbN9jNkAz15iy2IqsyBirQBcMJTIIjfNd9A/s7GbXuxGfeH7wj9WjTGjoeBgHw5sdiCP2RhSjtsP0CEOkjjIE96wuEQ8OzQR8b5Kdhnx9EO75DWz/SrA9JXJVykndSpV1o/xGYluVzPbO2z9KLtekgpDchs4y4PQoC12Sm1pdzHbiweJzLMT4SWxhxqaxMFpEImuSAORyUs3PRH+xBOG3WKZmHc8aNlq1CAPGRB67JbToI20uUEHk5batMbMFBsmmVDFsJuCNcFkjNZp0HiEwQxboG4ux5Pc4K0ts21fYfPfN0jhYd55yMI5F75z57Oem5NlizcS3sU4CeL8Eds/inM3vHKnmfQjGp3dTA6CUNDDgyTJ4yQX8onergqDPt15EgYZpFzvQkZBBsxMyeqIjBE4aboly5snmAMyN0OkMrsIxjKbZsIbJZJMXmzfLE8Fnpt9xlRAswBJPHfm3dkz6hgJT1IsQsjPmGaNxvqTmtl++ePZ0emuPDwpHPraPT2R7O6enhi60GWHZGG8uvXy6ORUvvxFbh905fbR8S9yZ697vL/1i9w5krv73V25e7gjd3/a2pev949e4nIkXx+dHsm9V3LvcBt/+2c7u3LvcGf373Lv8PjsVP7t9GTvQO7vHr4+/UHu757K/b3uqdw/2t7al7j/Iz/wY3d761D+2D17Scns/tJ9dXa4LX88O97e6u7Kk93Ts5NDeXJ2KOlB9Vz37Hj35EfZ/eVgZ3cfl92/I/buLwdIIIXwl7q/dLe39umK9L8ix993t6X+UPeX7utdvNk9QapOf9g9lKdH8rR7JM8OudTODk/39qVK0M8/7O3vyp/3DneOfjbs/tNiofHEWn4MLVzn//Xer68sOrNy5kL+rfVj11p1OvfVe+LYhvGEVmg9vighoLNuPMGY26PfUuA5VrK0290j0x+7z5cMahM7W623lp46kE5VRzCs5vJjuWrbG5v1RqddM/AUpO/OulGITTxuoJGalfxRyR+V/FHJH58vf/AgpZWo66TdqyOwvv7EJH0Mj1skqZSkBbvfMS37anmppaSY8j2agpcVyE/DWmpBN2zwWPgZE6jVv3Y+43EISLkp88/5RDGY3lkk0qmu2UrR7t8Rieg4kXR1gyMbIDqA2EcDdflkEJv8kl6BhgTZnypTSDeTXt9l82KPrFxpbw2LX3FpmLByJAvHcBKRSmI8yYVv3mPryGntdIySIaOY08KobQPpJ3bWIEM2MkMKST8j/UlY2CFB0kuiMazwUk/QgjtPp6dkXCwuXSg2Ji4pROa0I2orkBos5DvDhA9PwzIeHXRAAt8g9gpDJmQ0yHLDLAwgkzyhoyVjKBenhilHwvWpfOAg2W8UZHkyTN2IzaBIKLwQYgw7WjajveANGGVUWxy0cC+FDMVQxL66oQ9TsDyKQZXn0oxsptKhkFHgk6CbyXMTxpPn6pxDkvQxXF75MvGzQmxNUpnkI5GSdWkyQQdHPzBJWYu8usjRGHOYMq+c5DOrSnE9xiVOUpmyKjkVqOaSUhcKNzWW0RUqX7KppKoijS+3sAwa9UkUuSkMa/WQE41lLtIoiKGggx2XnTX8RFl0KUkapl2XbqqtuqD3vXavgywZ55mcPp85tUurgsVbORRymLP6Woa5jFFQub5v+9p671p+4tghHqftflva0pQLC6b8v/8X9oybHTJn3MDFajbs1Q4OJr7/f9CDWktPXrRgEIZ9jPUVGFpoxaa9atmrdeceewt6gEwfzPYL3kaVVqPjkApIvW29aHScVkONi/ZSqwH7mIzkOeiXjVrbUCH2Eu99yUX7RrvtW4uUtY60OgtOpzB8KwwG2QgT9pd6h7atontUb7fqUvladWOWIWzGrVi9FTbTkdpFOtxZOGVr5Z4cN35zBEa9h92rF+2lxSf1hVXbdhov2DS0HNTuWb3FpSc0eywtPnFo6ujyOqpe6Pn6bjbi+z3ecPpn0bJFyP9q2tdrrxBqPt7YbK9LLOektfq+5dy9+QJ364ZJH2HyBQXFgqgf/cfy440lR0KbyrYji4ZcbNWXDLZxRQIcSRulhrSXaFYgRJQNY35XzF7C8XvDadjqOZiualM5q/fYtt8sMWoDJpj6srSVSa0Ce9F4MMtyY6MJMJUaUFZMowYbW3vNzlTJmbzFaT83Gi1seVLT4P3S1pJBk9k98DNl693lwnx3UgKW+fbWMJZrvX3JBiK82qcMcCN4YyzZq73avtIlYyIs3wRyRW+fdlb3HWP/ow/V74+bu826UbNqxjoMUKyX2zuv9v5P9ydoOfDCptMuB9bsloh92u1jQwdG4mg1HcNuKYjBuzfQt4rdujhOeK9c9lNYaitD3AkdgaetON6Dm8FHaNPXcZrkbOI9hiztQQKgk0R6Y20a5yPBLpIg+USOiHOD8QgpLXPJQkFtIJdNWLKxRMWlBCiA8sPW5djBntL98QzIrjyHUfmdR1bZ3cSoerh1KPcOX+0d7p3+IrUxNRpBYUwNT2FMTXdmxtRFiKkszMr21PdaU/uDMMsds5SiNrZu1YaWtGyr41g4Mb6y3nbspda8ILZIjfQdBlCYQcma1YDhTP39xmbnxRP51FyAzZ1p4DbKra2fr6FPkeWibdEetL7Bm9INm4dbMncOwrm9YZiJp03O6j/KxfIPR01MTX0Y/oMpS93BhNQxZbsj31vvOw4b4AMQwpabPGdZCz0YNz+VKy8cq7XeNjFJYbJyevaNXdf93Ybdg30zHo3tW2nf2KvkWtJBxWP6Ts+6gd30m1tnqYS/ohAGlgv4gQKMor5cw/dWTWMOJgDjF49jPiprseSyWzDchsqh3jGKcP1SzbZmgagSx6jZsGk2XpjFF+Sdnd6a8cHWb0etKahJxwnOhEKbicYtpwLihaULrLXSfuPI5qYyFn/iyE6H9jgXNjZRCU+fstRg94OM95DiJNeKET+4pKM6MvF9g1ckEDCVdILJGBJMbpIME+IaEjWQjMVbczZR2zVt7lHT5h6GQYiibA3yydtk86F+F01l26Etq+uPtdFM2zFoSxv9g1ZQdcJN6KuBDTv3tNKIfTfMElgkkHUeFgF00y8fKnhLQbOzBYN4dpYAZ6357P7dEwU4UUO/qbJFwNnFOKFwOiagTwrQh7TZnyezkctr34D+Yjef0PkdtkGgCwJY5NTAH2XzAhwhoB9G8Okrw+Bz2AEv4yDJx4FwCrMibVKkzYkMvadYlSGVoQY2UrN3HZY67K2aW9Xc/oTmJleq5lU1rz9zNCvMyKz6ikOWh4yLNhdUlVqp1GA0q410r5ZpWVFkvJRLlb27aaCPa4w9luhUxHORDibxBw/8Ncu/VpSJGgTfF8cO5tcV79Ux1uJMcIM0aM+u1DmfueAWraza1man7cjOpgmB3WJh2FqAlLzaW5Qv3juWVo612ivrjjKVxeYg1si0Cp6tf8Ogn7rplM6Hqgwzo6XeB/e1jUCfWTexrcNHXfvTXMiJGcS5Nm98/i0sHL99Jr/9Xv7ndzB1/K/n8vtn8vvv5X9/J9eefSvX1p7LtefPyEZ07Zvv5Nq338q1/3wu1757Jte++16u/dd3cu37b+Xafz+Xz589k8+ffS+fI+bn38rn3zyXz799Jp9/+718/p/fYWOHz6oiIVCjW2vN/3aktfbcsX35jfWs+dxhFSOSfi7dOImnQFjQJ3ejfjgtjvCyOa8bhmQuxgdgEjqTkc9pEUqIA6pEZ6gCrIXX7ZhMCsn8V2EGlDH65gAByqf+fYHdPXXKl1y6qshF2ouMm7equshllIRIRICniRKft3VRpWN3SurgceoOI3em7WAdxxitGptRQarP8WSwfCSUMyydfaE7QRIGPm2h5UlK0DLa0DjwYJdcHBcOgOCSJlfciki5DEtP7ifoGarB2j1Dn8Hhnz6dP8LSutOmA+7SbtgNifOC0pZY7W2QQpWOEhNWXe+p3NhcoAW59d50ytattQKgliDzSJ9WnIvgw8CkD54LN+r22m7s8/EyimrJMORu7M+gb2fhpa8RliWp4R4vdjCnQ+HJzmLRe6MhJb+/bWrnt//Mufb81r6t2ZmhUFTtm4a9aiogTkKqo40lX4T6qmEEfRFiAyBEXc+obnUQm9m3sJXXgkZFR/vCJBhe2zTve8Dq2d2Z6ti2rTjNHVlKB/eZLCt3iE8lDL0EdsID7Ba5bGcbZUP0DwyNrjcyTBnA1FxE4xybKWFfNfxcYIcfD89yB3XPLAcy7ctsXLRL/c3rwDeUCmBKw4DGcVJjGpLPx/BHeRTy7JLLXzNJu1lAcSFUjXkY0UkaEKgCFZNEWd42llhP0jFIn9EyHXvJ6tk/274GPDBNngmuGnJ2OBvTNBRZRUmTCuburGGJXacM3SiBnqA1eHbfNtuzU/cdRoyw0GGazj17EaSjQxpla6XtvOEN/NyuzWFaEs6D8aaYzFnb6nmTCGAyXhLmSe6GmSQknkGCqw7Bbuk7MWDDEDdOIjfEtjS7kknGoErsnfoiVzTL7ngMQYAvHgwdlDO7VK4wSS4mY+UZBxAvYE1AQ3viBahtWL/kZP2i7BGAXCv7E+9C5OriB4ROk+barkV6yYD26bETS3tw2FefpClt2PPoP9RuGii9JE0FtS5MHcwv7feDOBsLmh38yXi2QxvmrvSDwUCKVFzTDitPD2Qdw05onAn/mEqZSk7ts6tS5Att+E1p2xXYEuSgxjkIYh9yCOABQ1/QpiCAAV1vJHVEmH6G7gR7eGxIkcmhQJhIIpX9oUg4JdiLlaNgOAoZ3w87sulUAnIKgHgMa0S/qBxyqLoJxhDBqD6BFCkvIuHGmby4lBeXBNuCXdhfkz5LakgnOZKxVBFE7oVQEy7mbXijS7qwJXZGXTLSNRWJ3KXpGw42G5GRKl71BGeJUMwuLvmqH7z0kqiPzefoUlyPuZNEl4xQJ1JlcYksskslkT0ECKNg+eQ4uKRNX+EHXs5YdUhm6tIsOxTXMhWhuHTRiFIR0jZDygaUhCbpMbRdAbSjoPLQYNKcIKwk20heCl8lnq1OcJn0pQ6jS37NJ4SoAjIR+yJySTGOGT5XLSoLuA9kASUS2EAoJiCORULfIoQeCCmwhhlJ9Uieei4JybBPoiC1Ae0O4QxCOYsDLsIyRVS0gaKgXMtoPejaqIU805WmegTatEuNES4gRcU45ASbquJQU/BWTmJOgNrOXluT11F4cYnfSSwyzx0L4JblI3k9zchGxiiphd0MBhsKLuealcDaICYjcPkOHVnyb9ZWnt/aq/OOb29Zy9ZWwUC2Za3z3BiuvjeQamuHN3fsvrWxyeIMY/FCkAfoiaNNdYxFsuD5ELSnjM7Du4VkCmOYH9jCqP0XPs8FmfdIg3edJuVpnM6gFRN5IskAV50CF96r7gFdfzogS5CfsfwhsTZJd9Uwg+uBoGlyzrc1FAxUOgs6hf0cD0mwCAkGNJePC6PAV2R3NufdD2JxSJNwVgi1hDp1iF6Ujd2rWGawGpzDsSHBVKHZzGPYqIkNcxpsp6TrJVkZZziJ93Z0wN/EtOwku8lyAJLwgZ+RyjmQ0shOMsrLCijjLd+HaYn2+nf8fxNTTK3f7OwebvM5Jkofh+xinPuBFsapDtsn4C/X97eKR1+63gWksbJ7202HyQcBr9lKpxQ8C9l2o+7IvSAsue0JwYDqtBYB224kUneLwJSLwF0/oO55RCBE2Z07QTy88/wxG+S4vo/7Scrvkf9Ofl/BxrBwvBaxoAhOTncQ+DoZDkk48H0ywNzzuDgQwXAS72FLF17h+kPYRLq+r8NwLUqo8MzKAkHHEB6V+zQplzGHnMUBTXhFwE8Y4F3f3w8uRZeGN9f3D9yh+y5ghD7t3oqipPi6Drw/YJYkHfxhiE6o9s999xRiDiXrANiE6qrL4SAgW6S75X5w/EEI4OfuBh5dxcI/UJk7JkQ6snCkBBynAYSZn4U7Toq6IKNWTx/mvxvfiUsAw3AJtoiimCjOwtHF2hQeSBH+B1/o0uCA2M8Atef6PoYiNWrBl5xgtoyzbZ6JEhWavp1QtKVa/UmMAi8U7OSq/dmdkjkZuem7M1dRgSXvrLI48K5fp5p9uiLZV9RcFMTSpSGWfjO59Xr/NNnq7ks3iIS/lZ+6KVDu3CA6xhAXpDsEHzvdnqSXgjpLEaR849CNxekoTXIYBSIgSXMq2a297qsgDrLRDwIJDYFB64YhjUawtiZBPwy3+BVyKyN1dnMXV+58n6GS3TDcwSSvrgciJmcAbO8p3aYOTK4Ddwz7avXaAbdnOKilFmMMQC2/2YFZNbu3U3G1F+9FUdLHJMBhnJj9ZBh4e8M4SQVGIvXyjkum2to982AuOhqLVOHHclgoBDVNeF6LfC9mZ5fNAN0wPA6LrHbJELmU0m6Qcya4SsmJ1jlznG39BHeBciHdKEro5yg+noZoZoTcqRE8xUvMPOzcSQjpntxzz3bZqLDA/FSTmPYej9ysdJefvhtIeMqzhRuUaylUUnoMxxS4ByVWRkN4FsRyq4vW+XpfOU73tT4OhxOG8VamOkrZt0cnhIugJIpcwPYWITtpcFnyvp7Eccmrewp5VaUrn/DLXxP+3aiFPxe18OeiFjSyZ4VPdzTthZCjPcVoMe8/SYow7uzkLL15mqi+JN3cjennuXTzodw61b08z4G+6ut5cs6bFf7TRDnnntOhF7sxw6H29UTWn5MUCh+bJuMIiQrhItC+2SSjQ7pQ1bwCO4IYuZdBMoEr9kaRm15gcZ54k5BgeScDolCYxID2fQm8hZn7BKON9m8zwmw/DWALPSTZimBog3i4Cytl7cFw15+EfvJOpOecwZPE9XcCdzgL38tU1j+8tZ+4/qG4wo1SRKnAGhZDwIE7VkDCSthiT1fkyu+5vshpEIKcvQt+o4zDI9XStDPIZy6cjXEBW1qE5NoTZ/mEou6KXAmSCOcj+Z4b7UB7m8D8HILY7mBA2oySh/P6w9mOCqXOidmLvUexcvwEDa7nRmMXfYYO95BM7rnRMRdAySm0B8l+6cYXJe8OtC0l36UoeV8RkH7ZfznvOyHU91kQanTmOxHhfIDqgJ4bdUWuE9IVuUoEuTgBXZEXHyf35cxVfBSFnOhHZh/rinz2oZnrLBOHP70GaceW76vLHeGwHKgliXLYT1wTsSfULAFsHNQpTLq54cSvoLn33PggoZzEXZyg2ecKwYAcs2OS0aDsufFpGgyHIt2Zxm4UeN0gmoRFZGcx6m8v3k6ivkufVuMS93rPHedcYHQ9nETS62/jeCiqvN/9/9y9a3fbRtIu+nn/g72/OZITi1LkxJl5Z79bscxQIiVzQpEakrLjISgNCDRJRCDAoAFSijvz2896qqobACXPzDrnrPPhrEV2VxXuQF/q3ip3iIooUUiSqNgOJcFS+bmuYMF9q3uh2NRG6IdIRxxWY4JoE8WRL2shUZ+m1NDgLFpWZVuSugmYQyiliNSKYxqHLrJ0Vb5tbKkLPE9JwnLRBhIjNHggQp3UIFmqS6mgjlZP4SQDwurM+1NS9cgau06UAa+PwMjQR1gfgfKJumBgiVBlMHcJ1UtU2MgghiMrOPSMo1DakR+nCwsT58WIuwukxl9rYVwoJE+0Nfge70VFKKSIGcuAmhUPgDzetbI8imOVPXIzZuL5Em3PTb0CVfe4SClLucVGVxa8VDnUGYJFyYLEGEG5izAs74+REbRRFi7WnMV7o6pXtP2asY+cGI815ZI8pHwxqzUNjVxfkLsxEOh/7b1C0zWGxpADJSkUU9mwSR5ZCXwfqQw6vEfBuSMwCE0vg4hyw4ID7gzMnZE83ot0XqNepeEuXu6TrUYq0WnmHpd0DGOOIonHKTjPgBl4e31i5qlvnOcZKOtHdLvzOFrT8ihEGad13EpGuGHNgaFcdhK1emTwIougCRSMxA2CxrC/E3TDy7ZJDhlWiqzcgiEllUSRRyGw+olhYR0YsU3eItljL8KUUeKIsMMDlJRRwdyTJUlHIexS+VntnBz3KXDhZ4gzJPGQST2rKWeUxZoa0iN3BqFQw2aQ4skEJLmnfiNX1+cyc9fpVcmjRsI04wi5PfcI/JZICUyp7EcsqoA8wQhGcjWDluetYZDE6hT3lFsT5C3WyOB0gIfo9fk5LxKQnxfZSMUm4ADOIL+IEtl7mG61EIbp1p2BASeBlgRqf/lQId8W07TD5VxZ3BIlHCM7+iei0aoJBBV5OqLlQ9q0vECdNlRbWj+xRhytlWKam0QBl9MfMGENHZjb3YTlyzNcUAnIc20F5J0vsDgBgPfjq15PGLY8i7vtc6nbVF/561YSrYh9KVH78ktCeVNCaSPdueDnRaZTt/8VlrfASGkJo8CPVYlglYtx+jHNYndNQsYpb2MiGdgc1I6yVhLerEtKedJrP6Pe7sDz6oDFdDde5FnMX7wVx9Vvqyubnnzz8lrC52/UOS/IJiTXJoA80yxq5ErLqNHLxkGcrF3EqnalarMh1pYXsqjt8/T2Ve6aQ8kEW0RencDv39Sxsxr6Qx2rb/xTHatv/HMdq2/8rzpW3/iXOlbfyIsDPaHsPAXTfniG9qdnaH9+hvZfz9D+8pTmNJDVTdc1pHb/z+xvl3arfdKyN1ik1iEssdZOr7E+03Um+RQctdoTRiqvHTKyTnAh8y1M3YVrd+YITx4FW54S0xQrS+2gdAKI/8+QR8tK061uKG9rSRMGA/xgbhuASiN5ek+gfKRgbsKI7cizmKQUejHDdFuZSwjjiQS90c5N6Io8PY2UzDdj64xCtGG6rRM+kENEYOuacSWoWlbqGNlNnlDOVUQ5FeyGVM0tvGuJCZ6aYZ6S+DUwuTKa12w1gg3VAkvMZKXySTaM7GIqgltu8DwFH0qeFiRFOL2qJZ6zROlQqzRh1BlPdvC2Iiv0s1RRBu5s26EWv/8eu7P2nb+REJgLKmHtEFgbeQZmwgfqbiz/MMVZCCzOVoIaVtu/qusX2t9VlsoX1s48xohl4wudpysWqwgU6aegsZ8EpiIfzH5FNdQBKuolISu9Q/FsUeOULa4m9B9lLdFWxTAZKquD46PVrFhA3iGgly5MiNwvxJ7UDARMaln/SWHKBREBknK8gFAzAjKJ5/IK/HGpkg48xoTYDTn1i6CO0WZUGO0qwiwoU1j9I7AzNDFO3LGAuZ8Xlk7cMIOW6a1hxPQyxbWAUEEBa9gBig1l2oSRv7gj469l7S9GVzXyiPw+6qS/XTxLHdWoUOIUmbqgZceeUMYpSaFV+giWjcreaaiuVUb+REi6QsQw87fUXhnb1TF1kpC32MVpS1g2zNfaAVdRIjCu2k8ZIR+kvtqSjksoOhcIjUyAndulBA8VzSURMxLouDv1olVk340GypdhQh4F9+QWwBiZkgHLBZ0g2HmINJ0k/Gv3WirWqsDlKwqKGK3QgR336DsUaEtK4oBd4HkByhIaleuWtboWQoehYYZcMhwRjmpaWj3T2q63svVZyFf+upuEyKsEu5wQ+x8uO78V0ZpTijAN/HCuWF3gdkTKGfhx1a407j45+Kb1QfwXJI+O26BV1iV/spBl1V05S8ikaxCYNBECC8Mv2BfY+drW586+yynbZeC4X0ecp98BP7QdOPqNdmb9ZJQmmALxIlLSW8rHS+tarzC1FWu1wpQGzVR0WWFKeqswTTM2t4Up6avCdFdVFaYy3ocpK6jQG1tZRost+9tOHEdrXpZ5S84PFvhTm8AeJZIRoKTdM+DGzMzfXqfx40LgIb4hyTjAxllkEbKTcbaZ3WGg7d7gl7YQm/LM8CHdZXcD53Sym5WvsVZ0RDyEDJut0s0XW2T+UDSZ7H5tRaYREuSsDpL8jy1/rA0PWa2uA6waW/BoVTLXQiKrmkWQk23nEIh6uZ/lN2v0/ZI4zqJVSXFeNxbFmsSBvSHLHglWGwksbU051RjbHQKEGvmLHuXNsYQnpoIv0CW1Fm/tJKFovyy+gDOLbfqOuomyNKGxgSkXfh4tCvuEl0VCI7G9OeS6ukZWMtL0JeVh3WHP1+jcjF5Fq/K9XKtMO66JScwBCcwGLEHSNX8s+8pGft7HHBcPEmEkLX0DrksQ8CwJGAPBd99VSRANvJBzH5pVh6E7i6sBkzDisJOKJWQ+pgXBno6jjl6qWJlUs+TUSDyGC405TCgPbHwMlLAoMOGiqbAiRiXWHcgo+rIDC+iuHiTcZAm9Trcqq+DD9aqCsS8NE4QfVGWbcF1a5+SkEHaScKSyjcpoNnZkYD2siQl/au7crWzBKbDgPPvorECElWZrWbhTBcxXMoeEpID4EyNWtbepB5je/9q9vlJak9OfeoRJU6Zl9UgWSYrVmYvvIFYCJXcogrjZASJtKkNrpeAx6UfWbYU8uflDkAmLTDRw6qbinNJ5AbLqXMA1vpgI1SHrKWWo/JCP7M6p6mPZWS0K+Dk59cjtkGUJlBxrmmZcOD8iWo3evd557C+oaNUdR0BiRggQKfMBQFDAIDgXj5l5DPeUefzYTUQ0r8DwbpinCA9ZQBcSYJifpwsxfFOGwVbpksW4U2qghREphJmeIHCjBFxU74QINBPD0M94zZeQKO4kQ8W+poSwmo7Aj358LxB9SJqhLY6sYee0Ii5IC2dAts75VNFns1DZyBypx1pth7PXmi4J5ce3FBJVGSMRDaA9TaZUL03vyQ2XG5OZF8iJWcQxySvwiuy2z8kdkfQcIIziNH9KIYXHQuUl18OuQZbkDLhCEHWGxZxnq7YkseDUsG7b4pdYjllgMtBaFY3QyK/MiZuWiNFnZ8ddZsHRnaJDCE6DsVB5K1rBCwUcC7A47iSbEavpSDdELCdveR/lrCKRMZ6pzjHS7vbs0c4LFAjU8lUmQ2jU/tydkMMxATLn4hw1wjnnGMzsWku1jZ1xi3DrC1Vxj3uGTnaehcrrBnYQYqUwb7AjJTo5iEUGkDVcC5WfOy+TsqET2Xl7ASPFwGB+hfXIgJPR2rWsCipqChDTFTJ3ggmAs1vpj0TbqJ2pEFZNxnlWuPIfSLpckBrPKVVkoCEqtCgt2D74XVuXQICVBKAL9jXh6kOksbgKkN55C6un6xttD6pRzh7J4sN0LTVtoVlvoXLuoGW3YZwkb4fxTY9oJWYQEXCCuxrwqukg0RTMY4/MykTdbb6gWrYMIEJGrvyk8GNiWa/lIchfIqwOpiCSFZeg0ZX1WCS0ULFrJKVHdhUpX3jF92Kh8vdRqC4oWgBwLpVrJ7aXlZ2sdNVYqLzuhUEE6HxYde1QTOQOGSEyyWGkAiWM26GMGqxceEJwbdzaZuWTCvpkbKrSmQD1PeV4JaTQyg3sIIC3IHfS0DaOsvXvcEKOco5V2DOVlJR277xErrA6doTgPUe6ztKHxxKVD1zZwb4Uxrgni5QH6sPjQiW1IYCZ8hutQvtGKN0zt+naKFChV5+8Qh7apG91ssyqIMa1UYHdb6245Ajiju7wG55iHDKIqSFL07hONTgSB5X9m/GPFhz3Sqi2Uw1hoyfgJwPVkGw6AsnVa+oXa+vjDWs/ylzjhsoyLuzLGaZ5mp1l/r2Szg4TSlr7VKNlmrMWha5T+pMBeTou7JCGFJVHG4gXAiAyDoO56w9OfcG3NlYZlgayc7mgJee3EGsTakSW7g6JEJR5aJNHw4yEG0c2WEHHtB4WEK2yq4u2PaGg7taq41RNblqovOpd5dDRlqfaj5hFBxjyuEHKrRC5yomCdk1fMsZ7b+WSEZd09AyyqLCQqBVKkssl7wMIY2Bf5d2QUYyPzJjwvbsx03E5RJG9mRsnUC4F0DI27HBeIfH8nq1J2bZgt+dFAWXn0o9zyschUTTaIs4eI7gYN4BpDNtLX3ddboOlrys9F6jdPWg5h/9lQIDMC8tAeNdl4BR9bkemsGlgGTh+zYLlhhJcptszPxMoIdAGAy2jUJ2l4SMBImSVoIj0IPDZ0aSXUOqjOOcSvr8EjbBWRm6Wq9AsU23Hewo3p372/qYNjR8nS9+oWJtlseLcCzZfPKTQ8mEZp/5L4epkueOKecAoCfy1H0RgjULml5BmAh6huJMomcfgN6RGxglRspSQU7dYifzpFl3SAF76K3XT3dWtSVoLEmtpBfvWaobe0ovmuAGrWaQYYtGXRgmZYAbzUnfEi4PVRN7IhRVEGhy6VFeI713TAG4i3YICJT3LSAIDTr5gka7y0u4BJWIv0lDDvYfQPUgES1LKIsKIqO0qmnum5/DeZZDGpoQ3WX4YIHPBJtLk5oPa6uxI6UXXE5VdeVvM1rQgoTKuSF3PcO+8tfGjmAaASHesZibSnd8KOPA5CNN1BW7FcQ1NHmuovAlHkB4YUSjmNZTNcLZ3t3gR+5qDxenaF7Gfsz0u0swkknRMSE2Wjdgvh12YwtKMF+n3tJSCiXQ3eRKRBaLNznKBVSdUeSeiFqTb+Fk9soMO4CgJB3MT6XJz+cp7EoyOEzCfS9I7kOxeIbywYpaMdL2NVbBRGuOF9yO8Wxo4URETEmlut+65GOUmMkhI9RDp62hdPsq1vQKiH2jWAwguoMPL8oRPCDBCRZoVZgCW6TZKFn9qMycd6ZoHYKQ5PqlsWTJzl7cwyhEdJwMWUMR8Wz/Nm251x1KTWVJpuo30OC2ovVySMwsIRZaoEMYOwPl7SMjlUVUdJ7XqksDbu2A/+NSi/CkfoTZ7O3Tohz5/9JoKtLwm2if3TNGHqnWcPvImIgyVpqs7wSKimY9K6NtL/o3C7lG0tFQyAQCpgpxK5H7WCkPoT2ZQm9UwZmc1E3lViPvZe19bcKiQLgI1pj5LHas4Nvezj74e+VGIZPm8zsu9YikTLrS6NaOc+XCmQNFiWJg5m9XbxOgrwlTHuAkTz9gdMJ6x+CT1kFR38UycYOIZKYTimfgmxrOudjNyPLuOOLuWg+zh5WQaU3CBXMKC5W65u5D1tiGoPHGJVE5SpTgO+smWyo2WWyqXrlKenrwkP3uFcnP9MoxVTlchVK5dP4i6l4Mqu1nPKkKYyY1nJNPGsxFiybg6e7Tb5EzV08gmHqe5InfuNgceVCiX5NKkq6TdXYZY/kTTbjx66C9sFc7qX21s0SgCDr66m5b9bmh5NI4J/tebf1ZqfYYpu7Ib80q0lIT145CcW+fI7ZFri2I1oxjxtRlIcyUHkuxSjbIjSlvtUmAxYSghNVwMXwQWoHiFHjHgU1eIEnVGucoAuWhKvYMOZr/ukkYFsdq7ZDIPxlFCoXuc5giF9dkCzLOKHX9AqY2b2sSJiROMCMwpMHzOC5kwAs/tOLHDRWLHi6Q2YCQyYsjO3JMTGTbK0zEuO13SaFCsEidggeq6frIzqCSVkSTZHUosQc5mCdV7cgNMUhthkqdDzBNS9SLPjzBf3PTMoVUS99dkp+snle6eSH9PpMMn9R6fzOwpasfLVjAjKFozTbWz9gAhbxoAl3ZVFeduBcQJgRQlKTEyvKAVOUwBtCYbwBTzxnkbazmBKCQZLJRFyq+d0p1A5UxKn1QQzMqAJGQXIN4xVeVWF9LLiBiJgVQeI7iv0D9eG1i143Th1HZxurDrZ5Xg2K29gkRBrVwqtKtVTQW5cryCg1pl9HdJg/a+hu0cDtIFXpGjiMF6B3efb4duP8MOmb6Io8mLWNU8JeXWXLjAqhoqsKqFCawqIQIrfy06/UTE/pW/hgLIfVtEBbc0pxhQ4SAhBpSoKmvF66Uv8FlW6KXA3P0Yhtps5fS5DI2WSAC0KhW7DFIHWJUK3pX/gISKZFJbqaQQaZRAPKJKCutxTzA/KyCJjCOkzcmokkJYH4ASllGCfIYOp5wCSNImQXaAAVwGEgtG17eIu1JlWBKUuzEhyzTLgyKvIfzkINDbAIAxAoDbdDPsUS2nihL8lYhTK3anpZHq7JGX90yrYcIrG5bkfOCEQhxoBWbHWiGQYG2RDzL9UXY1GyJSRUSZ+pT0dFdHETF2lcLInXPOC8LYaL1KM3jAg5umomKqBNpNICYzJF2RYec2xLgMMIxIxgBGbGdKNzaOMoVRmvCC6SToMT8v1bmNJRT8wo+oCcEQ8AFzl5JVq/yVeBmAg3BjVcJ2/jMJire4c/DawfUuAexCu5jNKscKK1PD3HGiyK1Sn4HZHQEEDq8HBAVxbG/ZMh+JUqE47CSk+kzI5kBTQ6K2doZJ1ENuU9ewYQiUuuk9sTtoSec4mHfERWXcFtI4bWMET9lsYtOVMFqqX1NrH4Qwl8rdpLNfZY5LkzPxs7qk1RZLlFSPJd6H0qiCX8d+UkErzkCpbWWwDvHzhCZN2mkBL684Cu5NmiDBFrvApomzoNmNjoBX1iGX6x1ij5ZQS5P355elHhgd210OMVsR/P3sScWw4qRzS6HVPitEThRgx/WSQl2eCNBV9NVWmlaaVJ99rWzejlJ/DGK7d062SIJH9W1w2EBNM0hrzcintMiLmfoQhSo16RoZJyi7HudswSBMTiYWcF4nKenOKdMol5rXrBflDsGsW2F+mAg0lgKSJBU81q39LAcnrf9W8Aqr68iso+C+Epy9pqdeI2aHrCMOOsMg5bB+etPlkB0ivefqo4EuirzL4jS36idLYzU/+dnyzFKC/XRrRKnFlXi60IAk+i248TBYPfGl0jT7ALbKIoIxjlrAnp59o8jplszmKqwewuOXg/7UNi681wKW6+NBfZ3qehThWixrLoJwvebUF63w10LnDhX2pI7SalCWwiGWFrWpNSwuk3odLY8mtWc3QUaItfPaWHOjlylFMGnxgskLYIQWZUScRhVHwMa6mj2rjvH4ViM5lnydRSktiyp59cqgZyFAbpdxBudIwyLI7US8zpAmldPtVWBp1SWBWbZ1llL+1boToaU6fs8SqtFo61oWsB2UnT52iKLwXBd6CV7XATdJhLxd6yKv9K7fCpU90lsq0VryBaJUDsj8EP8oFfsxuMEqLg2lSmKNXI0E9o2SPS2SXXqPlqskosznGa0L6UfJLN0inWiYrlDdU9HF5SkVWsa+2JRAJ3PBVxyTZHFyAZOULVzZppqRkG/XkM6cIrkC4o4rKFTMbEbMlOOPyrSEJbFmAirJnJyQ8Vb1mJakEKt57btNLfENKwm19EuO7Px5qrRaNN0uuQybe7qtEgNX2fiFW3xfNYc66nNoXVnstj2Taq+69fpLG3YT71W2VdzMHO1J2r3KNnFAFYITGuuoKOiY+NzLfZoKskbfjUF8stFGIvKGto1dKFGMV/a4Z9oZmLQnFiPeZDNCZqWpuHLual7IzCUGIGswo5UtAGu5ZupkK1jXqR84w68l2ftwo3Mdrb3o3QZztSOd16l1os3nKOgzKR1ly/VzxCeJHZle5nZk/Gk6R6Y/l4ZRtpSZJ4RQT83IxEp2RibUX23llcpcWEVYEwu7Oktr1W1PKbUXXou7zBTs7VWdqF1CIbSTY6Y0OTVysAZho2JG7hSla1OmtPW7Afg7VRJfmDGzZbXOEKT8rO72h6zQdIOo5N3bPNFUh+Qs9slkUN3lVGnHmo9Tk6UIASm9FTMX+lBG7FZpdIhF3azhKLLZTn8Asd5xulaWV2KYYisAdpJS0QO8xws0A+QL3ySUDUFA4oQyODDpMjMT4+K8yPbErCCPdXHl1/5c/T1N1HsHfSwhKDQt8ksJVcmfKMt2PccUKKTtBODUhED+mj4iIOdeE2aFUcDXuywSiCIfAvzgZ6grZnRNRz7+0Eb5pzayG2eKS2K8NfFQepnmAlqWl78oadgY5JTIDEIy1UEhpg1d74+7OI9LO0Q3QLkVqlHBdHIdk3mBCbX8OFr02FWXDbtjzY1DWyGT00861DUUpoi/ACNX/oOFIrtDPxVzOaM1ZMgMVBX5SG5meOlEdG+jRKTvI39660bCPwjjgcuGooNCg5gFxIYK9KZ9XR4IDrU8qIKV/hs1MvNbFTp/1DIWRvK51/3rdwnaUkiQ1M+4zOuKy7xDqq7ylgY/cFKU6i/4zn+B7m6B/Fp3T1txJtU7rvYa6s/APmsryAs/Pq/lFwN5N1ut0GzCWi3Kal31qBfEJk/Vu870ICDBFq0JVcKIDgZaTXEKvPakFXchrfIzl/RSP+cZDyKcM7U8zXk9KWNlTmmruSgvK8Qa5UarcZdhztqndzzoNZm6Ku5GTHEp2rR4z2s90EEUSzgbUZNN+jhCisWS9qW8E5Vt8iqfMnf2c58/kw6CydXkDyVFOppFXSi93vXQdwTu5/J2xT9cl+77BHLTbdeTGRCFcuHL7EuEMjKMUFhLrvz1WawSqJbpFcMCwZXM+kAsF0twtFGD5JoWVACarul7Y10Q4F+Mnf1XG+1DV8IC9HNhASCKuiMJ7fgqYQEyp2q4/vPlULuwLiZwTABAjma1X/LiaQSYUFleFMR2yWrMANB0wdVu6BUTKzdQC2wSgrxxCTwgyEU06XoYguYwBFu70aCUBfTTcIQqSVf8bWv0yrB2KV63JSispSW4V3JJ/rSaAxzO1DLi+4evrK6EOOgnIQ6gpFn0O99jHPsPtgU8dSbV0FhblkXl3dJ5FJjz/EQKBDvJcjIE8dQs8TxXSeG+BdHOMnJiUDy89EqfGIu1/Uc31hBwEfuZuvIfqu263EAWKUspTTSWwt4SFrvRig4iAmzHH6MkLD/a1VOTpbYhHWxLrKOcBMTR2MRYR3d2cY9aQXd2kcbpkJ3NsFJWkZ3NbLqso7u7yBsrsZ0d7HBWYrs7PFavAayyA39Yiq4moBaOoiUcRRINO7QqL2ol7CjXrN/Uu6EquiTZYJSnlLIbVWNU9E6MyhPC7mG1WBVQrdofsO2auwEsmhIuk+b+PMoC7umOEst7sgRyH63gZaO0FMeTPh8Fo58Pd9HPhbtYoutn19F1+UWuyZig6yExjD7aYez6ib5fc9SLdlEvDvqhBD9acGy3u2bh4lu0xLdADwwTp8X1tdVFI4ADqs8rvWCYeHqqof0kEO+qF60FoZF/WNF96noUjN6Ne9FP4l50Pe4FqExNpV6iFW/9x+rAXm5i5oIs8DV6Vbre3VBlHcoN5Tes0KRD0jwvJkwJDyMqd/jRfRRTqy4jdrSE55Rff7RWWDpLQMUtgRhdyyTYaJ0SHAVLtbLbxJdA18N3gFLuh8GcLUrahjS3eHbCY/B4ItGHQnPSEWFWJq3FAmlxb0IdrZS4V0f8EGQBKR9vnCaIzF5LD62gZY+TBArtciqxlEpjENKlv65g7JBHOGU4ldxX8gIsEcrKEqVHciOaEN3zCBqtVFrUKPLFbX2TgKcIIpEi8I5bku9B1wOdBJXOKuBHeAsKavsLwSpIoxiswjwK7NxexkkRUksIrjlUihXw9imqsVR6J5ZKV2KpAJP6VeZAh3CyQkexMGm+7DRdQdvM2VgKpK8K7rq8TYsdVpGEH6vMNHtfQasDVtVRvIqrQEHYrPlDVjeDmRpsk+dO9URrWD1y3LUCgxA++FbCzz+oOA3kW1uYczquhTO31DFWUZtXOeTdyU2Gr+4cGbutpxK9oo9+AkdDx/V/9DcswVqxqia7ljJaVV6sUOGigmA3P4yK2ml2xkRLJmb/2UvUOH5LfL/LeNgNvRRrgz69LNNth7JU+4ot/twZrSKxQrEDgSPUermlVvq1I+1cvzKb2LiCmC2kdtr9KELAR8r3kVmQ17oSZJRb+oLo5AVgPyOFGeol1r/hsA/AFENIQJSolX/GawoSoZ46XUhrYmiWbpGcKunyekQ1VpFALbmDAMLpAnXyJOMAk91tJNUTJs9cpK+2dT0h9rNXTuylE3fBa5/vIOHYRgLJzVtkNeA3rQ8X9CGBfMTiNEluEWKSlunWnqc8zc5ZRsUsxyTEt1k9ZfWM5QlLJUUFwUKL6EFRqKrxcMD5FUWh4kgogihFi6YgeEmRDoQzMwCSm41CZTOka8dM4FK7+bSIch6nRehmRUcZBFgWlboEaN2EqHIWYUZGjwkujF3Ai0S/q8HcaOZHUHIOfH0frblVxwrr8sVRSDKOdDhCOdkiw1UfAEfZ2UF6IqMWZu4HRmFavJtTv+o0DiOVlZYzna5kdqEVLcEnibVdWyaJT1hyR+s4yiVMR/+Gg34rfCdgyhALM03dyUHTspl5uha9Cvplnq7XODc6bpEMsqsUD1msMUVQqL8W7gor5Wj22+/qjz71HEY5KZXFeGDZRqsuYpWgS6qZz7TgYmVnxGqyCLFOO4yJ7EAwue3oxyRYZmmCqDinvq/QhHGpEyvNu6TK0fCaeEoVR4nKBptNvkIquxDxnNxDauwnlkbKaY79OUm3sQoXSnBt69ZikakF+E0h/A1uHiZ/wuiD4vIlEOL8L/M665/vcPz5DqMPHLFtBNS4YRDIMgNA3Ajzkj3OHW+cW3EgLw2hJcinUP6KpjUAmsqRXQPbgrbjgyKns77qObPe5SpduwRIf09oQn3IqUCuV6l58jb5gpZ+paLCwdPICSshATYZbW7dnHLr30QAMZh5yh51eXoRPeAJ0h7SixmE4VLHzNObNdaDzWs8OvZ8wrTnFY7dwmLqtHbXGlmmnhptZ8enqfLyJ3JAXhEC8roEUEdFre2o9KE4VykpZBhmFQXDZCnPN+hb+YY90vON80cvQUT7AkPOpnwjwXP5hlvxRlzV8414pFuAj7K+5Q7iaJF84+JqGLQnta7pBJUH74bLPKG4eLknW5xFqLqlchdPI/KeJz97hWci8mhzNSKPCPz9NpXwOkJY7sk35ELPlY2yyTdyTHmAbKAv+yhr1wIYzA1HuZIvVhGVZuMiGtH0WST1BewsTi4VFqF8pRaxTbWAa/qWppJCvCekLtPiCYHtv4KUU2cB+ZOdfAiklSR5ot7BxSkfVOcbA6RLaxgWIqkWJIvCAbx4ViotaFCn8kzFWM+DPnaRuKi1IkFkTitYRoqV3aZIah5vxRoJrJ3hhVHnC8NoZSmjQqtWV9Z0G8w4uJxEXp3ztlGuVEZpv2waSpCR1xOd9wJGF4hPhU1n69rahmRc9FCGzlNtoSzV+pqdLIWEgAkHZiUkr9XiwnvUUaSiFUqa108Lg8g4FeTKXyRRXoRqFy9PcFWNuXhKqt2NjO6PgjKXQrH0GyvdW6B2nDjp8moGT0luX27Dm4qwbyczSwM7sHHie5Q65DnZffMlwX3zZaldNjnAiuobK6dvngrpG5VF80d4e3LW1w1aEoqyzwHjDgeo7G2bqgi/Ya7EikaCQhASEBKQgOWz1HHM1UKqCDNCYUll60f5TZJHsdmSGmArLFfdPegJ2Q4xdfqzO+/uWor+26eqhe2X9ArbZ5QK2+c1Ctsn6oTts7qE7XOKhO1TLcK2qkLY7uoPto713dbVCG6DNFuMg24XrFaxrSkZtk81DNsd9cIObrmGbVXlsN3RN2zZIS6Ak3eaIcbmCYUVaduKd9xWUsNaowTj3QRLj/mCETeG+xbnUam5XVeR6imZt5Wt4mizdZb6LbrKxwso5Gn+JJ+wrahDUNNOogZBfouKe9gWQwh/IUCkK99WR5rt0zFmWw0XaNDC8N5L482+f2hMvNA/nk+PvJkB9cx77YVHxpt54RFwYI1m46B5oiZHx9Mmod5sf9+8e2e++cZ4xjNm8tXp23fT06aZHB8dfvf1/u3U8OLzFPgVmiTNTZrZJenzZaQNClqjDYAViO7UQ6C4xd/Nk+Cu4uq1g4tAcTdPM0QEsRH5js5MZc0+RxQkICdAGu3dA91Pu/vzQfPkbuIf/+6F06PGkTc7uDWTW887meKpve+878x+4/WhUPdeTRuvDpongF9NjecBfihuppPvj/+PfzxvHV9MP3//7X//YSae9kbTRuOVO/InOuNPe3T43tTs7TUO9w6aX+01zJ6c0su8ZA+nfd043Gsc0Pui5SKNSoqVUVhfNUQqIh4703nD00cNbyvfanvUOKRj7u4uur3O3Z25u+t1+wAo98aMguwDgAGv90fnDmJa3Qprr3LJiWdoKbwoKbDSA/mJyPoORsVa1W8IYUbzNFPwg5wXiaSRmXPyJnuvEgOdFORxrykKQOVFBn2Cn0PRI0IdNxAkec8hvz6ucfB2ibDLRyRqtC3p+4fKWz8ytsmiCI/MRHWmrs02mg1v9tb7znjfvfvpoHnqHTS8I+/IHB+bt6fvzNvJ8dupeffuXdN8802TWrVtza5t//N2ak5OmpODxuc/vIk3/fbH11M0j9eHxvvOO+Tvfdj0DtFiDppfRUkQF6FqvD7cm3gPP3zvPfzwxnv44U/H3sN/nXkP/9U+9h7+d2d6uHd7MHnh5dPDxr4c4s1eH/K39+OFmmX+HaXqz0wdvUvUNqdsUrlaZH6u7t6EFQSzTA27m4XzHUp2/+f/QoQylo3IDSi4aAgpGzsH99m9wT5ouHd5GjeatJMfIr1LDspdkONrhkWg7nSxqoB3/FXxsfShd+Dpwwa6Wev471Nve3hwCoI3wscaGU8fHTS/8nSjcdjE19GHB82Tdy/Ntzh0e+Tpw9NGw5vheDqYdjlt3L412InfFdQQKz/PogeTkRdxur1jrkuYrwau+HZy+/bd9PCdNwv93OcTeZ8bPGDZpos0geSjoyTKlkPiFHQD5rfCt4GnuTVOKLRJivTxV8czMO78+Uiwl163TGOl7x/vkEY7ze6CNMueIW5kYc2Hsvdhzzt5siDdWBD3z10Rvc92tiCjORXLhdyts3RmKq+FVOIqlDizjbpzBFrEnd+aIs5GOmblHbK+9UF0SyS61F+v2aRRyN3UdtD/nzTfnXbnHdDMIFPkHYaXw8rA42iNZqNpZEYtiQfNk44dliq7Rk10gG3j7bHxXk8Ov8OQw8PQN9/wBHvkHTN58ur26382T6aTgwbGoc9/fPvj9OBWxhDvkOYqTze+MDZ5L73Pk9vPf0wPvT/M5H/+49XU205u/9c/XmHumR5O/tc/XrmzrfzcZ+ikwec4Qve8VUnozRo2idIxdrOH/Opv/sUhdq/1Y75Mk//g1LyjPYzeMoFHjeZB8+SgeTLzH7EUe5rmOs+wWvmjmT2S/lvW+LEL9pr5amXma0Mr75hf/eD+PoFFYjVfm1VkEjj0q4VJ0khH8aNZq2wFl9/fikjlMRz9Y3b+ZD0YqcVzPXs0OlfrbQRvwA3EJA6WeIgwWt2e8Ds94bsHg2Vvyl7Gnl4ObNiHqw6V3ktve/SlT0X97D94CbzE5XOvgkeOyguJ+CbsSgT0hnZfTzr/D94QWSGefU1+Rkl5aq+LniSdz02aEFbjQL2Z7UncG+9sdyzn8f39ppm8fffV6T+pk6C73H5jvpvShI35+mQqrJjl7Fy/AIpp+2XDeAe75AaRP1eJf5iXDWajO/32HTXF6+Hgcti6MueD/kX38mbYGncHfdPtjzvDi9Z5x1zc9M9BujvrDc5/dqhpcTUetvqjLoOfrjtmNB7enI/RYrr97rjb6t01mqNx59r0W1ed0TXO2OueDVvDT+b8favf7/TMxaDX7gzNsDMa3AzPO+ZDa4jhsHV+3hmN5L5M55dxZ9hv9cxlb3DW6plu//pmbLr9u8HN2AxuxsDGnavrBg43V53x+0HbXA8H153h+JP9SK2xOftkqk9/3hp1zMVgaLoXZti57rTG5uP7bq/TwHVH41Z/DGDc7d90THtgOr1RB0X3wnR+6Y7prvrtkbkYDq7MZWdsLgfjgeleXfc6V53+eGT+enVt+oP+3bAzbnX7ZnBhrofdD61xB/c27pyPO21zfXPW654b2WXYGd8M+2bUGZtxa/SzGb/v9M14YG76427P3Iy6/UvzsTt+b+7uzlvjc9Sdfns8/GTAO/dbvR6g8bB86P4n0xoOW5/M2WDQM2efxh1zg2dvm54ZNZrdPn2utuk1mh8Hw7Zpt8YdDPCtfvtu3L3qNJqmPTa95rDT6pnrATUNfGfcCbZj38HFXbv1qdE040G74c2+nnT/djWd/HL2sd2bTrzw9fTQgCYw3debv+xbGc78sD/5/s3d9Mh8/2BpDfScGd1Ye2zGdGIccKeXq/Bkemi82QTjzCGIr7+942Gq2vsOy1lsRw4cNYfNk+apZZoPvcOmeTs5fTdtmnckDZ7cfne0L8Jgq982nb+Zzi/XY3PZMZdj0+uY3thcDdqm3zH9wdgMhuaXwRAj50Fj4k1ff/tjlcEmEenwu6kB+JX3XcN43wE4bFQ2l1sbh+jSXLp+L7KX50HGEgntcM97WRG/WPpyR7Cw96p+xCvjeWBLSdQyfrZgQWpDQyykqCSKMchVuKHaoKUPTxrCs86RHeELggy9ZFy/KsmAsI7wTcKjjA+jiYIPqRJ4n4meTT+/+fbPf+BLejPv9ecfvv3THyShTCafpw3hL6anYDiO3r0z3tHnN9jjeHL8bmpO30HS95pe0/zkmeZPxkP7+IkPaTQ9Y77y8NW/On2Hd//5zbc//GHe0jXQHCbHX339zXdv3zV/Mqf/mE4+/8Ff9uTbH6dmH9d/Im1Xv/Z3+J7uI5ef/V9/7caB5zGPNrk9aEyNd0D1oddo0NtvNG69Br7gwUvI76cT+uz8yff26UbQTki29w6ePQ2Oz7zETG4Ppg1TSu6Nwz2zt/cfHF0eCEUAlAB7jcbh3t5eA9+F7sLz9o/+k8fAXi/Lm98/qj0Atv6bR9ivPMK0cdisPcK/Or48lA7b22t4P9zuU8eoNuFDb/ZVqSsiaXqfmTdIL2A/5twbJi/+B/F4XxFALd2b2X5GtC/eC9r6F7dVTi23AX3AkZE7wMJPdAsN3FZALu7QiWLJdk7QF+p0ScokLGOkMCm3jd0FYS6NZkXrgfAFuxFpCRvejN/JgTfDXqKx8WYHIhiKnAdVDhg9Hitax3+vDhcsEc8p0Hut/NyNLPzmkLXpGoGjQRqbkYrnhnSkJFQaXxs2l5EVydc6DSKItmSjs2i0gZrfh0+C8aEr/6KyqBRLET0aKVr1zimI5rTuKNJgY63IES3dZ1e321Uc8cJQfhxD2VMslvR21xmvSD8nDxtSLBUJLc9iFoWfhWYZLZYqGy991jBRsAfLvryGJHJ2Rw+UidtECdTJlEgbZ4uQITiNSa6P/d8fTYwFtmLKgreVc66KnFNPJFCKJWnijkjSxG1Eqh0UbKlMSWnpx5RWJ6MUMqnOcRfIjKJCvCNOd7/OFJP5Idf2m3G2D/txbew1xHDowbSTx9mJxZ9TqCo5jZLXj9OgkerO6GKmxcWvgOeAU6yRTo3PaFVrfhz5sEQiAVBoioROTnMXPv92qTIlurdtFCOXB01nSRR7M+8l8ePe7E54JPAVdiLyQnVHc9D3DxP/eP798f9xmxhdy+aZ5VnSyffH//uOWBZhSnBKdAQvnB5aGRyyAF+MusjnH779w9zT3iholsUZWHl3+tXbd9+Y2382Mau+nrz2dqkTEg0OGj9++/rE86a33mRy6yVeBsF6euhNMT2Q8PaycTu59fQpnkFIp43byY/7Uytviw4X8wBzC4JPaZxtNljZ640anvfyFp3ZR29IUsMyj8mzQplHpRsvD05luCKNmIzm/9GpDW7udo9Hcp46PI1DcMIjGnQxuO5Nncr535+zQYwPzogTTPZ/nL4+FBwT0VegNBqHb/dPrYi0/45UYG/3vaOS9Hb/KXzU3H/36tWr1zTom2Hnyps1Xh+VLMEr0bvvMee2t8ewaM1pesDg126/b/Xbvc7QtNrtYWc0GlyYVq/bGhkwna1+u9UbDUxrZM46nWtz1hu02sTEd1p9czZqfeiYs0/DzgXz9GefPrR65rzV6x00T160zkaD3s0YzDvJOCwrnJMIcE77n5+/bw3NObh9c94+65nzduccQlm3b3jT+3Z3aM4hH5z3WhDFeh2Qe/1Lc94b4KQ9yGdnfzXnAwiQV1eDPstNpdB0PuKLjd4PhmNzPsKxo/HQnJO0eH5DZ7+hU97wPu3WuEUyiGl3zrtXrR7qXmsI/AKPdtE3L0adS4N7xuE4GOcdjYcN7NO66Y1Nu9PrXNJJulem3R12zsfnrdEYQlx7cHPW6zhZrgNhDjx+/+bKdPofusNB33SGeGmd4XAwNJ0Pnf6Y5b2LFg666HZ6bQNDxchYketiMMS9dVrn7xtNczHs4pROWCbRsDOmZ77sjH+56pXisAi0l4PRzRnLj9woRpBJK6Jk9+p6MEQN6fx9Z9glmKXgceeyM6wI7d3B+bhnuiPTHUE++bnzyfzc7fVMrzOG+G163Z8hh/c7L/gMvcE53hVJ+L1B/9L0BoNr04MQetUxVz+jIUDeuRq0b3odc3UzGss9EDz40BkOu+2Oufp0hvd29YkbDB6yIvj3W8Ph4CPExn7no+l3fhmT9NQfjN8TcWBP2sL36Q/seQkdnP21cz6GBD24uDCDPt42mt0L/kgv8IwvII4OG00zuO70UQxb48HQDK7xEXAA7o42g9DqQXAbDKkhkBrhQ2eIPjYytQvLw43MdWvYumJR+ro1hHLDXA9+7lRFelI3PJXt8Y6Hre6ow21p2Gm1qRj0e5/MsIM2OuzQf/ChY8eEYWc0Hgw7qG+uOlYxMLzCxxji0wxv+oa716jT65yP6ZXwE2Lz6H2rPfg4Qj3stM3ofafXM9zHoEXodcyoh3FlNG6Nu+eGtDSj8eDayvasyrkZdgxa5uhj69qMPvXPqZGMPo3GnStRTrwfDj6SJmAIRcV4iA80HpJy6KZjoJoYDz9R76MOgGJwYW5ss72hFnfTpxNbNQfdJms7PnQ7H19cD9HVP7a6Y/MRXesjrkyqGvOxi8QJVi2Cgt7yyHwcdscdLulFQ0Y33hmEAx6l9unT78sgsI/z7ncvaP4hM7PwqGcjI8qo1vkAYzPeXWvYaZnWsDt+f9XB6+N20Rp1+wZqm9bYtMZ9Q93hrHPZ7ZuzYaf1szlv3WDg7HR75vw9BtPutTkf9Ho0Cg96gyGGToPLnA9G7835AIPmuYyHrfHNlWl3zm4uK2PjhWljMOxcDjudEY17NHRiCPzQPccAOLrutT6Z9mBsOr3W9ajTNp3rEQ1x1MA7v2AkgIKj1LJ1fqFPhTFOgF86bXNxbS4H5nLYun5vbCvttvume9W67PDAxKMRnaN7jRHo586nTtv0zgY3/bbp0VzU61xAidLH/3L8XkalPo9II9MbYPy5fPM9yh9MbzzsXpmr1hAv8ao1NletX/DHcH3VbZsrkLsjaiqkk2mNux86pn/TM/2bq86we06DBnV5A/3WYHjZ6nf/zorOwc2427cKxOsu67eclovqkbkejAw3QKstvR4Orq7Rp9v4d1v9kRm2+u3BVffv6KnnuM6wcz4SlN7hsNPjWxt2rlrdPus8SeWIno7+PcRgwK122L18PzbDftsM6c0N6S2MMKCOOufS4c2o87ebTp9GIurxnTHp5i776OH4vzd0C6Ofu9dm9Deo7cBVDNvU6W9G6OP4d1pXZjT+1OuYcevMjFt9/N+TQpVa5hhj9fh9Z9ihfk4FRszxEOM66YAvBsMrdPg+zSQ3/L1v6HujxYM3+dAadqnFoUdjMpNe3O23Bx+59/69MzR/H/Q7H7vt8fuyH1aVc9CPe9/dnn5T0899wPy4o4z79scTqNCnt2/3fzL7717enprbyd6rqUHx8hRc5Z55RVcRDZkB5/imIZoB7w34Of1q790pM/dwVziFhQrg2/2fSsbw9u3+KV0CvKMAqJw9aDNLVJ6k+Yv0fnK7/xms+vSwCq8zf7HyX0BdRhLD0cyP4hdpkX/1+nDcun4hJocXLLmER95ra597cbT/+rDR3H+B+Bel84PmyckLooALFfPa8fGxvVvmgZlOZ3ld3uajv4qdrtFqFfGCSOMiniGHewfeS7y2kxNW87HY//3x/5kenZw0YPjGDjDX/TE98v44uJ14+YvpoVa5mIn+9bGyOxJfyv7eyFFxrEj4dbFeZRlWzkayDvUQ5TXXjmhOaTSd2waLlTWTL4v4pNfBsF+5Gq8BZ4o1hMuNhFBW9jHeBLuN/Lm6ozSw4yA2/hxOvf4aC3uhih8NG9X9Ik9h3sBC1+m9VQNQDsjVfUT+QFjZKZo/cq6yBh0hm+7SODSzBT/qLEr87NHqOEITQAsQUAr+IE41KToCPzdhqEwYBVhuPUgpzzTcUmS17XVm5jPJxz8PKE04Lb0cpOtHqzRScEqiHNbQF8XIvUDOl3gxZhlpSsS1zPM1mfFp6TFWXax5xZ1YXkPM2hwol/CYMS8dJstcxJxxjBc4yCi0KBatAmqkswLAWdVirfwsWKLOTUz2upWfL8UTwqTrBvLF47ZWeoF3kDinbVKAwPkZyTrW/E3WyOR7v7hb3bND1jr2c3LGXhdIybuFPuNOPya5Ty4aQOf0tjO1wPrk7N6c4YstdDEzmUo4zZeP6EV1L+qO4J6qgsIFEcAEtQdZHosZPMqCGGp5hdWwPqZZaO6wFniPVzXhaKbB/KB50ofn3XWm4EupG7QnrW+2QdTqNs1CWpIEIyO1wTOFXtBomByrD3HoxwoeIPBgl5i0gmKLoUSBhwR5YJtiHSNLidlAqdbwZl+dWlPJ6WnF2ejt5PQthmYeoSfHR//0vvu6aT3p1G/QcEEfRYZlqNFJQ7EPbfnkaydaf+1NX7Fr2mFlOBZK4/AVWzqcN0PpLOW9bDoFS+Owscea6d2T7OEke1BeeJOvzddfN46b5hgXfUl3yaZNiM41YZnEXctusVhZNQD2SQbEhEtCIERAiH8k7EF0Azt03rtpgzMadYZj0wMLfNU6Hw5goGyxBHTdGfbAThB/OWx9JLxiBGSO/GMXdzRuXY4suz38BJYZB2F6FU542Lq+7mDuO528O502Db7Z21OeOEWD3CxdHCvujdVXqzErkNr26Qv2ZhP23DhowNnif7yYHuI1086o2eVy4m2Pp0fmFexPNLm9MqyXf82WA1HYsyakvNx/fFjDOrTA+EE3YSafv53i+v8fXv20Yc0NwjxUDArm1atXtm2/evXq358Vc/rnP/9x7IWff5AS9zT29JSQk0pZs7H93YBlqGyF9w67IXzxMHaknX1/0Dxhe6szxN1V0MahIc2mbCCocWhmkzffCwlA4xAeBej40+YzrkV1Z6Edm2BlS3kKsS4mPrwpJq+/PaUG90UXCPJ/OGieHB8b5/Pa2Pc+MxPz+Y+pqbgN/QesTeMQDEt5Lf7GdNB+aUq1pi8yR8IN7//hFcmEVt95/5m9/1+8XOPgNlMNTzYclUBp8SWLKataPc88ezbP/GNy+4/p4T+eGIqJxfP04VvjHTScX122gE0Hfj5sn+F1umU9AlunmfPpXT+agJOYViw1SHgZ0iqAJszStSEWTyFlPLgMleHMzLPM43Rr5gnzgrRKOS8wS8k9ZelSsCrEr2RRgvz3ZFWhRMYr4qxWKlsocgeneNh0XppP1j6vBrBWMed8DZAuweYokIycOcVE0zTPOVVopUaTpyYvVjPyPLIzrobFQiXWeBElIYIQonxp35+o3im2NCsc7yqmiMOaPR64F5Jlw3ZFRrgbdhR3QzZ9kJvx11DCH3yeTBswQnjfff3Pr27hknTKc/s3k28wp3hmYlC/fdvEzPKu+Q41Pu5Mk53OzSwwGhHpgWaZkxMz+dEjq4X32fvj29fOr+nkFGw+zgGcEOtQxpZ1Vqa/mjb2Xx/KpHo3/nQ9GJ0Pu9fjt09JaHnMaWGg5ua4Zw0Mh3s8HhP8Ct61735iPvzf7PjZe/n60Pvj1guPXk6+NSfT24PJ7en08HTy9sWUZj50z6mXNF6LP3vrfEyeUhdQoZ2zjohZDDAXl90Lcz5o4X/XZVcj8jkir6dxh1TjQ9Npd8fXLXhKdS4uIPWDbYBmxlz0brptJ6STBH4xhIqASnAPl92Ls5su+VddXnX6N1zeweUK8jtjvdanznBkLq/Ne9rn/fAGmp3346ue6Xb6Hwzfvmh5rvhEUnehBuxeXZKGoHt1eefcuJ5+FPPXER3KFR3Zg1J60GrfDTuX3RF4qf7AXOM6rEQZWS1oucOOUoLOOHYnHFef6GYE9eKoM6S3e1d5GSLTcSXhyox88DOadz6fTlnO1oeMvG5Ojr2t502PAJL57ceDxrevT8x0Ip72cC1BZzg+hkuKd1Rzym8efvfP26+/5HnPruDoRUWeKg72XVIiimW6bWBN4QUHB2188gf3DhrkKnDEHhWlcuLwtDF5+85MD7wtuY2XjuhwIDenziDmmec3NQ7f/Yv4DbuOC41l5ClCPgxiv8VYFSWN0lOARgXIGrm16Tsh2JRPWnm8GZZ1YPl+9pgrmSYk2sPXmgfwgJeaCFIFWSqQUOrKacqJhUNDdsNBqF4jm3VGDvEIEFnwNANRVacJoEzxYs7wBEiT/JnrYOVJvoiiHKqYBxK1rToM0ERkpW1Iqi72hB0F4tR3yopAYuc4B8yTwJRFmqdmUUTcNCq3ARRTYQhhDs4FiyTNFC1HHkuoml3tm9fzJu/68muS1wc+DxwGErvo38qm+5M1rCh1LVeQyCO7SlUqD5YgRtpPNH2bJM3rryRJc5LiKcLxGQ+EAivybBO45/IaTvINHR67paDL88BdoZyOM1WBS0cFDh3PVMzJr6r3bhVCvEoJ+lrlrVqHYGRlsenscutCzU4LPK2z7wJVtonVsEpDsx4NkhCxfF955kPaRqy03GdBQZ+kdGKmyHozcB+bIQxuJwruP/J+fPfOvH0Lx2NyQIZIzxFD/4Sz/sufpqfVYcu79W4xeJ18LRL9OZRFcIimZeMpUNq009w5P37+48dvX09vJ6/2pgbFS2H8ENpgw85niLSfQQMBZitAlFVsPb3jFKq9LFpR71B+llFiUUWJduZ+EPnx0o/AzlFO2blNu7OIKcp7geFlkalHYvUwiGLnJZQ2EVZ7i9VCM4Rk9eD7kjSgJq/m+ZIC/6IwjBVvXRUUaJKZBKv7JWniLpcmCnur0GVkRwuW8xPEZ1j7CS2lEbILDF2BWw25wSyjjNIPISbHjyO98hGvGum8jESJI4o29hGqS25NOb8qrP9CAHd2hn9NC3IYIoQUawTpR73SC2GlmUwgtEGZCQNaMowrcq5iEE0vROYbLqU/EsuNIlNxnAaG4rGhEIxprZwFFrMzi2K1ZiUkIKygkCZamWWa36tHGZ6gD8wlKieO5lzQ5bG6IRXuQNx9mtHfR94ZB2TkukTfd+2DgV6na3rAdWpXMVqtc3ceLD9Em3ktiQrIr0I0d0jxTQnpkPc/8DdUqISS37gUZH6Z9q/yJFrl2qZ/5HNqleNNyjeQ3bjC+2NIXiYj9BKKhN99kcjrIu0czlRoxSMiQWgchVZ80UIrOngTZXmhKHacinmKbK5rC9MLFpjfkMUwtDmY71gwufGtH9+b7dxum5NHn4az1qOKY1KLe5+/Pm5SlNz26Nb7PPn89ZT0bZOv/5h6f8iAkEvrJEU1Spqoi0RKlXHNzRGfF4rZMJrPl5jEAKz8xCdA5/6KAA5UxsQaUjEr5nMCQuVAXn0AEJ3aAnQ385QWq880tVr1ECEH9DIKQ5UYuuxybZaFMssC/ZRKhI5hclhB+U0niRK8G1lcgBG9kPl2U8QmpnGDMoi5BZ7lUvREK/+BroV6jdJS6TFX/oM85QpsBy1fidcVyiQN3XACNgGBf/EjzZZppNPEhc/xYmcbKiiL5W+FKjA+0dAkC1qV9yiNGddGiixuBXK/3L6pFMrGZ8hs/WxF6QLoZt1oBmOINnX/UVMxvUCCBy9Enq0oec6TQME4TddWtiSbwCNn9CoNOTQjto4vOKzgX0+JJAKTzolUaZ5uyB3OjrmEjeX4ge9Gv8C8S+6aohjAYph8K9pfqRe+ZhU979hgQ+FEYnC/OhXVObj/pvGaJ6wq/9qUwXAnr7+d/oNUg/8wnteEWoWc0hv/yIpE3SKYSgSGlwciKVt1mAe132GDlOQVZVAlvJo49cktuPWpeB3DYRCq+CPoLBtZ8wBW0YbzAK9qnUqrqKgrvTe/FeDvjpkFYnmB2N2qhEBsEToXCQTgHbzXjabcDUd7ixxGnr4r+PRCIePnKZxubfgprFpP+HiVSbNZzVTInLboeRYpYvXTRnPXy9Yxu5rXqRb1ThoWWFi2yNlxFrwjmXDYbzXmvKSsy1n6GTGDv8OAVvdcxWNSGFijiRGb0u/AI7Vh6KtUwl1JiXcyj30MChxpDebp7bsp+4zrw7fe9uidxIhJuLh/PEeYv4T8E9w4ZBdUq559w6TnVLb/RiuLy1NTqBhfG97koHlSlYHIR/mO5Lc7n3JTGHkIUn7FEA4yNb9Lk5gddEM1l5dwN09Em6XvdB4GPiaKqXtMfTjxGt7naeOfxmuaCTRPtyRKG+9ocno0bZrjyekxq55ODTRRB82TU/ON8W5PEar6DjHX0FM1mubtQfMEFo9Tc9xompNTwxbupgw/j3hsFrnuoiRvNEXgfCRhdp1njSZaXLbOMwNb259+MH/5c8NEB82T/zZv/mL+8mfz5of/NknewNpGnGDxztnxCgprMnQQ9mtQaDHO6s3QgQ+axmu8vEUsq3RI6o2mEjPZ+GnPqgX2xJnYWrxclgR4LnhNT4N5R+UdNhvetnHgTRrPHlCR5l0vQJd8Zmf22H/+NLbXVvQCZaeChMddgTo7h4zmwRK3d9B49oQIkDmhZja59abVIKZD8uuFheQ7z/rwNo687ybRSj8gTcWf/3BK5peGtn/7+sc/Gt50KuGNpdZBu1GFQgQ4nUSpZKiGCSxJ/hCngmpKiecTSoi+gDJLkIYA6/3uhgxo8LCiCYDVPkyRtp50AFnCKoD4sa4EIJkfrJYNjaf+JQL7m7+g/NMPKP/yZ5T/XR3aKgEDNHLFKQICnPGb5HBaELnIS59/9qC3i+c+EZydi//c+vfrUm4m6QUyDNIpxW5slG7husdz8vLTpBl1B/90bgr6JgWeveCHL/jpC378gp6/oKcskoj3thEBfGMFZHezoeRuJEuDM0b6KnBuG0RIRJyE5/5Jpg6nUrOB8//35G2gc1M0YxjmJObXRhW9JessDV7vzPE780/r3/T1N7cG7v40Cja9ZlMGMh4TOCjBm93uexNvYrypN91/ebv/k/WomZIx8xCWoRLz/kC2iCjxZuAEtsfTRmUjTzcTe8kJwg2Op+4+cWln0V9MVD41MZUJSCbNG6wAILXoybevS3Md3aHTdOJGK5sqKtAKed9lrZkSO+J5jcPGv384Med+OdLq6Um9l1/tnLU6LnMg1+svbmUeSjgo49ydGt4ZRb57M+/sH1yzJI94FeaAZUAibxhfU0YZ8vKhbjIjhw0zU4sogZNPiEJTkc7NzEU4zYo5/tH8e67eVDWmvkYmDl+r300Av49A4sBc4pzgHv0iWKVPlaUYOqOERz3IE5XIqQ3JZRuViR4WICeADUgTFCp5qoqqldfmDhXTOfkeaoqwonywNpgNf7p91DLLhO5eAfOdQkiwOlGVhDbnCcF0XxAf3KCoklCYPJWE1vMHIJRMpNMkhHKgCAht3SOx/eq3ggLFAK9VALcslYScpo0AfV/X867BKe5oequjvZlHmc7vmPl0at9S15uSjxPqeyrIg6rUANtHXagEoxliyn7/nqs3NGHM8SdOltUGd9R4kPF74ceCWKY4CKPMMqEUdwZlrw09Yy0xJcO2qZCc1hiKkJ1ZhxLU0s2iuPOTRwboVmJIjSaOZiLxsksTa5mp5DYSU9psjOac/CXIUsuei8S1UmFUrMC00yPI1oRsjmpBjYnmODTrJM1MkrJOFxrGWLFhMklz9Bmq3sh0mGFGXJMK2nqGkUucS59j1jjlOtV0jbLpVNftpgbkWk91Ao3j76l8QyVp6QEgrq6Iofp4jNVdmoQqp/XGqzRuV2soi52EHnCJngLANdKMurOkw/Fj8vXiaRsLUseKDrCReizf0JvK6OEyKKO5xPsR4A10XzELPvY6NLNK4vQsp+vVXzOvAW30CkpKyppjbO9BzV/7CVeQJovvpX5TRgRSHGABD8rvpX5juP/l/mIhqZ9LNqJYLCl9r01xXC7xDqygrLx4TvuY9inzLMIfhIgwSreLr4sSb9ClhmXBRlKsYhXzIpEHhgKy2GKFoVJtj3SYVZ7D6eQ4i5HZ4kLgP76n8k0ZtBgGCBul05HygTX/cPEzD2jcD2VuOp/yZBuu7oJ0NbPwfG6hGH2I2eMXhz81mt7Z/j44FMfJNJqvJmk4W05fNJnP+f3hjgIQyV0oPJy8vps2xG9HlZqTyfHR5z9u//n1ofddkyMUp0cTZx2dHh+/hlNJ+jCb7vFp76ZHe2Zv8v2b4uH3bbw8nh7t7Xmjo+YeMyE2p9zel31YvNkrZ19kUVT8bXmOjWMD99AIvQkdR4yOVrtgV8WUGZYY5VkaPmIahWJhVmjrnmIzylrPWLYa0RyJ9QTCSFvfFXTqPHW6LNZeGVncjR2SrSbr2dFcZVEg7ikULqxC0V/gAUgMoNyObnzWhvXtbjCNEhq4YhvBDV3Zyl/zeEhqQRrpKGSTo4CxXoAWw5uMehhUYVNbs8KwlAUCFeJGCNLajUcL8nqBC6pN8Vsm4qKTOUFBvGGQfBVaRatKYamhmHHngvMLHGNgFaPDRRPu07JCFObL6YdhGUNns+7YlJlVuhZ70FhTWWkaP2i8qrS5V7ZZH0kakrvX06N98Zh5zZ7f1UbOfPHJKdvKvjm1qSJnzNNRukh2fclKFeUKyYUMnLV17BuNwRBZ/rO42oGf+Gwhh6Kx+TuI9upV4/DV3uvDyrPQ1fuGnYHNNSVC+8X8ctVDc/3lqpdo48+MP5tBzYuP6M8C/MnK5s9S/DeK4sihgKMug4wgPhVhiIoLlnABpYbmcRRhlKNeUCFKvGzBBU3r7OqVLQoqJILf+DqIIjMzs76Z0a3PfDPzQ/xRxLGZhWYml5zhF+OfbjmAfDY3M+KfzCw2M1hdzGxlZqs0jOaRCs0sMTNq67PUzNJcDlqbmVN2zzLini0LjVIQugMAtlKiI7AVWJdZpijn6SxL8d9CmVDMw7QcOlBpMysS/MmrerY1s220pgSxgQn6JqAnD/rzoE9jQuCbgD8U6oAKNob6If7hjEu+BEDy2wcw55LPEuOPIrcajZkJ7FGBCYIYfzK4hAZ+E4rtLJAU+IxzE/C55lFGBQSChQkWKp9xKWeDDYBLOm6hcj5uSUMCV9oES0QlgMkMlqAq2H/zJUO5VJiocWexT8IJbEJiGbLWoZW/Drjkt5KYAIMaCtwLffAgmeNPNwG215dKXmsKJxH8QxJgYsLTTPN6akG6CqiQZGOrNRVRTDvTeD/nKSBbVaWhNReJOCquTbCe40934Zpc8JsJfisiiEgwu1L7CQoTFIlPhdxikWC0DrYmEMc/mLxmxWIhVaZU+Ah9U0CFrFdt9U+wJqOwU0uo4hUVfnYPcxnZxxZcIrdFNJ8jfB81ezESVEjFO3CMAiDirgDwDuKvGMIaHC0yf73EVk0GmfBXE/4Kc1gYm5C+ZJiJzVibUOI2Qg2UTq8MWaqhzw+WqeIyY2zFpV5QnZCPjVFxxWDkzEYro8ioqUgiFDtSxZo0L5JdsZGnaHIahcoJxqbS4qQS+m+NesDszTO4eijwJ8veXObzCNnHUVpzIol5pWZPbJERFRqpQjIWAQ3yacyjB4wz8xS2x5CKgEtq+oCYGqaBrbHFEqn1AeQTCAoWA1xG1XNInIcyOEesqfC5DEOzNEvfLP0spHa8VPGaijmXeAIACy5xOICcS39BJlJ2VkMzsQFBkW8iadsRRrXIjmpga341ETWSKDYRW02pk0eukxPHQ/04qvTjSNpPpNf4o/1EhYnQkyLXkyLuSb+KNFoYXEmbe3OvFP5rP86p/pVL3qrUmvtKbOK+iWmIjvtz/PGdY9/EiEyi0TguR+PYjsYxjcaxHY1jH3FPHFVHjg7kWpWZeGZie2hg4iA0MeKYeJSMgxh/fHlJ8DLPfS4xWbNrMiKn+IpzE/O10KZiblTxwsQ0WsflaB3TaB3b0Tq2o3W8AILvGXN7iG2DiJcmdh9b4rNMjHfAjxJH+ANamXjl31OhUK6pCLikLxknJoYKAJ0p5iE7piE7Tub4053gG9PBKUWAETcHfwjw5vJZ0uB+wyVOmoLDpdE8TnEYGn68Nmi0MQ/AsRuA4wyRYzTuxtrEuYlzf2HiwsTcUuKNiTfRih9WAL+E8D62JpZRGSZ4g0emJ8a9Gb5BrK1jPcaTIucSjCzllFzdm9W9esgCs8K+91qW61zd6zUVUNKt7jf4R4rLLVUrHJNyPl92QV/9bla/z/HHc65+l1ksMckM3jUlw09fInFfIkmX+NvgOe5eld6VFCbhRWiTIsEfLyc1KZ0mdaeB/AAbn6QSysWHD5KESfmgtVkHRhyA1viF+Ec5nPliKkIuU7PGb41/QcXarPFLKeUQe5BnpGepuixw3t91llJc5zzkEumOs5ReCju1zG2NTy+eQM4jaB2btTZreRnrvI8/Xts69/FfGDpBzv1qnf+KP8asdR7j7xM1wZ+PwpbyDnGlXFrdGlGEuchAeE6IXFsKLFw/mvXjHH+6bcoaa34zv/nmN/ByxDeg8LlEBnIbghiQ6LUhkQt4GFFBaIqCoMzfSqVtnft5oUUpxEIbMPrDtQop/2klChLenKZI4Tz0OFkk+ZyonEkFLt1khclgPS9mj1SEXKZUzbnEg2YQ4aCd2phsA18/rLPWN5o+gPaNhlRIyiOEUPpJOEsfjHaShIZLlr9RcLqYGT3r40+Hznz8ceBsjj99PD0DTl9Mz1b4W4FBzxL8+dA1/vYD6lmGPz+xlpGUnL/EBUzZ2kbVMkrGNqOVkaV1KdeV4w+0ymk53IVb+JoLXtV7bjQ1VY0BXcu9Y61CDA6kPtcRgJjeQbTCH5OZjkW+pCfkJf1W0L7RKoTokJr6sHZ9WCM8lRgmnRjNz59E+M/nRicp/nI4BFVtx2cGlK1xPK3a51bu49hWaPkMjWmhVOg4BC3SVGiRVPTtAWVSYYaOGS6kSkLZZysVlIQ2iHaNA913w8J59rOR6RF/Cr7J2ENnIZWNKiZMYoEIlv3K7b/iT09g1w+MuLQHwffHqjgKrB6YsO9+kayowJvDvRWaAqH1xmga32GSJgtPbvK+4eGHVq+b4d+ngmmzgAoaUXN/FlKRoiScBtfcn82poDOizqTStDGmwmdkRQWmk9yfJVSoLVd8QTo5O3P4szUV9h3n/ozOLK85hxIE75iYwTxAJDP+IRUpyjkV6Pm0rp2fQfjI8eObcznefjX8pvPY8BCLWGVqaHlieKSFgihdE4OUr0055MI7zd4RTMja2G+SFyYvEjpLAW2SsbwiKUaocaH4lUtwjQBiLsHmFMnSyDctkpiyyMeprHRFHpkJ1r3CZy7WNpprQysNzajAV7M5ozdoMigi9PlNBNUVq6820cpYPsSxIRUuZCMLL0UF/iSFbKhfb1y/3iQK/63ZaLPh7rEpzIbvbWu2fbOlBrX14cgZm+3SqcrIRSegYsWLuqQo11SkGhVND9vEbOk7bNdm617+9jez/c3HH2fNIiwio81W0yvYbszWjvIP5sE3D9gLEtXDyjzg1h7oOR7cczysFP5JYR4S0pXR6PMgo8+DG30e8KOHezSPfnLv9OFBaPzI+Pcr48dqvYSCK93iZqEXi+GFjIP81SzaRmG+BLQ1WB+BCtEjZ9CgZf4sCqTSSx+pJ7PI+JnARZ4y807QKqQaCQ6g8Cqg//eZxi/FQaRx2yJlJfnFi7c6QHbVAFSspSK5jEFciiFWnwHCcq6kPUthQ4IULghlw7AweP8ZHR7SLrxRPeCPTQszW8LKbBNLzKJU33OpHs3s3szuAzODaYH1ZdCG3YsWjE6rzUwzcG9mOXRh4js7K+bk5RoConkQ6nVSdwQbE4SsFKIxLJgXRnxxKE8nUsFHJogS/OmlBlFyT4V61KhTKoQFDaJkS0WahTBzR+tZCiNKsAqX7DYbrMItYmEEWZtgpSVdKmrod1YcMWMBtk9BIeTntGJTIKuOOoCSTlgEHDEMBPdcqkfSDtmbT3MTrFP87R1jdw01Et4C654YRXZmgn4rouAe2gJGMdI6iG1IjNqRJtDQl2k+wW9zE0CdpvPUBNwdgyIwQRGboMh0mkmqWEbI1SjYLlnnZEIVpDDhl1G3UDzNGHww4YITi6BAFE/2SOohKqhNkZppnVstkQmjNRwJxZkQWoLw0SjfoI8oP3TLWamZgVdnWHnpam7UfGWg8oHFPahkM0nCdE43rtLYqLVRSKAiFjGC8SbI+2qm4lgzSJMRQ7wuqtIBNSmVsy1fvO45Qg0zMklv8yA280CbOfQ0oTLzMDLzMMYfxJWZh4mBQnge5mYObQzuFYU2c/Vg4IU+Z4WRe4AqwpvklkqQyDF6hTbzezO/R+eZx2szX8VmvspYZ8RfEqCiFc0YpBwvWHKZHwggZ/ZwELE7hK5oKVwGVb5MWc+0Yh80TQhWVFj5DwSTewjfoVwGIPr62rcbbENnDJ8CKzhoMyd/vHluFkFmFqFZWJeRxXxlFvPELObaLOZbs1hmZsEqK3kvAHGiRR6bRY78uhE3X0DzNMltrZUDt5i8F0WEUJEsRSh4EdlbWxQRXN0XkLBmLowl92e5rA7KerBYESBjB0BoeMxybpZLs4zKSIHFMuZd7s2SvhSVqNZmGZtlvDDLWBsniUeBiaBnjtj5hmLT6WORFTJaQS8mi+dS+AzUD9EK6rJgFbJ34CrEX5xrolWEv4S3r+DxYa+UBBWHD6rpw0VJ4PagTRitZAtA6hlREt7DDokcxXBNnKuMb5AutOKFbzaYelFFVN6vqKrMvoTaCRgIJl2ped6NyLWFSn9ma7wjC/HUSygfmpUUNx8LIgOvYBkHgm3KCbmKYE4GvuUSuseNzMMElXMqUAeQrnIjsyZBmDgtoJjGBD4AcyhqNy1GySaYUxlxmUhl770yEBLGpggG+Vp2siHQzTfA6ObLqcMhdrogAu/K8wOgIuAq5qoyUThc3FI3NElQ7SYHYHQlmg6o5gmAQGmkyYa0uxtFV+S3UBvygdOzlSM8kJTuqTrIAy2Hd2AylgOkJ6M2uynHckIyekYM0qjuuZRWWRlEo2SzCLmUEQowDxlRsllSBNBGOj+gey7lTNL3CeKK77Hs/cmGGzePAcmm2vcTCAVUBlLZHg+ErlztuxvumZtq59zU+2dEV4eUQ4wmY1Qis7hojIDNqA/hYmwsJUSvpaa3AF3tOi4W0q/jNX2a+HeUK5/LwM91ETG84Add0a2uaGeoNrlS9rlYO2PfvdPVEJwJrdBqXkJpUGiHLdllbZMUXJJGM0o2aQjjQLKB3jJUm4g81zZrX/MosKZ7tArHsv+QiKO2ov4lAgXMAdoQAYMKCcoEy2enEMIM8dyKm0U5/PGgRVozkmKrSMDfNIu5pNeVUffK+NiCy5ifSVNT1gGXgmBBI9IqEEaHaaQmocfUfEHSKUFhtHRYriiIbaOX0TxncYSwNCOlliBbuUOA8yKOZUgBytpvi0hz0/SwesWln+W2VRJSvmZCpWtquQS9N839nTXkBMSRaBstxtpIwvitcKl5/9yXKsvLUUTn8rBbn2d2gqlJ8f65v5iV3Sr3F5mKOQKeUU3huIBnkVShAPTGc5WtHImS1hHwkFPuA4HtS8r5wgvuVXkUhypdM8gLyxKY823K4bIDPWpe3S9/nBVRnPMckuePc19OS2Pght4wqxJm8kp5ptv6GR2ypT22KsrCiCUwoPMlV/TW4ZxG8jfBWLZAmCKHs1RNKHW67Ur2zrh7oKb8eATLRMyTcPLo4HLy3WIFhDn+3BbRrOCbisaDCRBzH4Q+mAXJOFAZ4H6Fee/RCMuBipZGlCPASN6vzP1qbe7XZLMjmxBqPCGUUKIxr4yPGBzjQJtydGQGmUqS32moRMGiKEZMZt+rYyYGzBj7/W7cQMmjJKxLak4VbpC61tqPMgk+JOX5yn+wE+7Kf4AQGqp1vuSY0XUJq5VUaz8nR2TG8jQ3qyA1K1xHJUX0f7X3Ndxt20raf+N9z9k9x07cxrRDu0lze3sd24os24kb+SOWk/ReUfaFSEhiTBIMQVlWjPS3v+eZAUjKSbu9u3t3393TNgYHIMQPEBgMBjPzEDBwOopMOjFprN22FP0+MWmiTZqaNI1MmuYmTUtTMW1HaNPg3RXjJq5NrNlYxt3g2jXLJiq1B/pCRNoqLOERWdoDtUFusH2b6tSknz7iDyiX09QghJiCLJopESO5TpE2BFHknByaKRJD+cBSaKZoy4xkUD7EYUXw0yBHPyqqfCV+Mm35G2dI+GSSu3yDhuiZKTGjBLtytuuDqMXOTA3dEWEVlZU5QUDktEdJJZSlqhA3M1VLm5kK0ThhTEnGqX3OhviFDMuZRNH1nZQJqhIyMxXiQWsR09FOwkSeqrF8mSmIl0gTShvCpctSr8oUiZY4VJJlpiJcn+RKHFisBMVSZaZoT1PiLvSqCxJlpiTeopYnMwVxMlNNaTJTDWEyU06WzJQsKdYJBzyxgiToAi8DMTJTo2tKuEs1ZMhMjSNKrASZKStAZgryI6URXWFyTQlfwcqOIHLeugWQYUgJRV5piIqZilNKQk6tnAgaN6ilRNAjTq2MCLoSEYGUaDLV4J+Z+oCkwf4yBQaYqZr9gdY5H/B6TS6XKfC5TCWfDHaVKLHMzu0yZSrFg6WoxsjbFW8h0vEUl5FcpeAS4imOIK5iM8RXMoWNbeW2thXJgZlqiIGZYikww8ZOpu7JgFTQEAGRJwkwUxAAaQOd5T+np6bgOw3pD3nLcohf1KJfgw7pMxUJJWiRAl2/oB9NKUno8TU6nQ4pYbKS95BBfSvtZUrTLRqyns2QqAe6kvTIUcIKetZpIrWllZjHOZbyLM0dRuOldEqJk/AsXbVhJd+BpCujXTSNPpbtcKxEO5thyQ4ZenVKNFUtBaeVUIccv5UT6UCiX1DVhjxHmUqcoxxLc5mCMEdpxEfy8XeSHJH0apUcx6RthpJuNtbsYsIyHCgWzUCV9FT8Oz5JxsKNKrXwRhmS3TJVguncoO0aglumaKIgsS1TM5xtCm2ZgsyGFK1ZSWwgGwKby7K8hhzGBklrmSJhjQ8kq2XVvFVJapasZquZNlnhdJY85OylpzNDI0+NSqNGU6PSLLbRmquB6MI32XI+6Gr3PBfkkEOJNTvkgUtpqcZj2FCQqxBUV0TRt6ENhhx3z6GOzRHjmauMMpNPTA6tIJx8YpOnJk+HoUaKk1Bf32MIlh3YFlxkDiR82rchutLyco5uCorUlES5e4NOhyQkytJl62pOWWmZD/5NU/cMNxMDXvQRqLaqlFKHkEcqxsRsqTLJb/Imy5lqlrTAkIrEgBkVysBGpMxNMYUVBzgRpVYha805qJn1UBkdGjAnHZLJhMJufs2lmOT9dCKxF2wpRNYJYT5BzgIW09yyMy0T60eALQKm6OtaWyrXQGB6ehKO2G4iTCMKU0AZhOpkipqJSTaaaTDJmkUyNXc/unW/qtgmkdzB9SRlfyjEfjE1NwWf5DnScdUmT605asVPQUAPDaamJx+Njg1WOq4hK5KaLYb9xQejE7L3sLy3yXkrvqtTGIBERqsR8mzKoGBnEbJNBaehyMkum3PER4kiVTdRejoeI1qPzkewwDANrt3g2TqHLYbRRWHQHDBR0WQ8IRLTZNu8trIkTqHZp0ZPhdHT0Si+hTWNJbAJrmemYvAgaBdBz4YGvJ59yuEYq2fa6NuPsLDAHy2VEmNjuJdX7T0kh0i6przq9JC8QyKRKCTalFf7OHtwZMqrwydIniL5HskzJH9C8gOSPyP5EclfTHl1dIAEF32Nn73GL17jF6/xi9f4xWv84jV+8Rq/eN1Ggqd63UGyjwRXeY2HfP0SySskeJbXPyF5jQTPd46yczx9D1RviGRkyqv3Z0jwGH/Db/92bsorkZjyCtYkV2GEBO8Lc42rMEWCl44EElwlwokRyq7xHtd4/Wu8zDVe5hovc42XucbLXONlrvEy13iPa7zCNR7o+gQJnuUaF73Gfa9x3+sJEtzjukBCN5qa8gp2IlcpKqeonFIWVVJUgYHHlcpNeQVjmCuNr6VxFrYlV2WMBPWmyE6JKk15dYPrwd7l6gZVbnDiloxZqPfBwEWMJba23PBoyAylGFuEgqbsUEkO6NXl0EB8YOGhHMIfEXYxmHAgQphKjgBRTQssUlQCRSVOgGDGQhJFOZFaTAu8jZUsnNBgjwlcp0jAoLTKwqycCLuxhC2toSjckbacYNZB75unptSJKdGa1fWbN4A1Tjk3DTHFCSllOadzvM4vy7nlV2U5Z9+umSlvzTQ0U2tXQxuP1liGA38xTcv6aWluhuZmqM0NmLNdSNKgv+E0ljM6E8uZY/zOxMS6W5I9QUNeukGkKIR5gMA0G5pZaGZhambwvqzFJghNEJlmkzickAA0i80sHrNDJgJMOCIlyu6qVvIVERT5KoY9Pj/ZLEbljPUNuo7s3BDEmmJYbaAwi7P0Xqaq4ogbM4tnZpaaWToxJLnN0pmZ4W3p8QsBy3a4OlaCXCW+NYU3otl8ZDarQktXIS8W0Z1xHoEhAMLsr29QzIidZQK+3Pll0H/YGiAyD3vNUY7j+rSs21ysV1tbmSo5+JDFsnz8fGtweX5wjIs8+j//d2CBFasg5FcDc2V9QVsmyLyWt4ZQSh2KW3AAnxAkRyNzkEXm4JZDoXQwmelpWhX02EjxaGTO5ThWGYf2uGI8nOblzYa3DvSDB//yr/ReON49/YxI1P/yrwNvjQo6rYf1L6P11f6mP/AQNvgJNxeHseaTVUUASB17aNAtrrVVIWYvVvFangXD/vf8lEssZPEitDGFE+FIJQd1pBLzbf/V6YAjqDFKT//wfH9g3rb6R93ewAIHHFIQ8hMFZ+SxuWjEIW9H0SsKM1GYdkTRC09Hpk3atHYWoUKiEZirrc2eUokUmdmbn8uR2UPgir35O5GYDjRhHUgxHRKLOsDnQLweqtPBANyHed3+MDH7MjRHWWm62dicDj+YHtXpUdyXXjY2vbJgPOG3qPUW1d7SWY8v1KEYE9x/Os6tqzMtCpmFc3sbGcLGFkc4wZt9q8DZdwGA9uPU7JPhSgdscF+ZfQ4EdIBwDuiQgF1GWLADagJLokNSoPoDwvI5IC//A5jEHVrPoUNVmEMOcnro3HheSqA70SsBQ9LF9fFa5iUbFL9UvenQvFQXyvCX0OjoR3UY4COK/aDNUWaOXETgIxvR4aiK6HCkzZE+UaXpytJ046HpxtfSdGFz24Vf8bE0xyrCH8IvHE8JdMpez5zauEKeOUa4LYJEopb2TPXE5kQUBZaeY3MiZ+zFeqIaVyFtj70S4S218IWxLDgdmdPMnLpAv6fEYskFHnUK9OhEU/0pPwtUUbp5reoJtTlDJII2uYefCfavPrNOz2cukMNZFcjhjCMhnYtYS/5i51JEp1hhnUt0hHMKJerGwLmkyC7nbEBvOydbpAJfujcRiIiGI/lCc7eNMyxiexwboVfK3PQwNdsY5T2KioDVEL5zb56FXXivX8Dn+YIsaC+UuSjm+KP+SH0FyenIvKXm5W9N39KOhbfkTv2WAiW9g0N1Vpr36Hfvcdn3ZB/6HnstqPA+Jpwlen3ttcx7zBrUBD+TNzPFL9oMgsvtnd1vH75Y+WYZLP+qAh+20bwICmjj8VaLoYC+HhT9tz2jm6WPzPYjGzbg0QA1lnc9e2Y3WAl66y+CHscLsDCMrw46rxmKp4aqfbsPLMXDo5ODfXfkKgdArztsHxHGT4Xzc3h6TpiZR4fA+7k4MMe9l1TpxEF1HjBWj0PzsSA+QO7ZP7RIlwTcQ83mW/CTE3FijjJ4C5ZzsxBfqgnbwPzazc7Er104QMeND82FYcAIixWx/Y35Zte42XawAOPE4Sl3d3cB7IB5e/kXmtP9zW+A5bS+3KrR9hhlD7dZfe4+1/PAe/58Y+0eHs4DAsR54OIfjTNgRgPUbMeFux99/9SMEMgMIc1+eOY5bCfyq4cXOpxlZQz/4E91hCJIald9PR0Em3EdpQ9bEuQlEZafTERxiYNNXDyKbygeop4OvJaRHz+1bGgedw08RKJgPyYbFcdlI5M0z4Cl8PNTVMDvn3rVmeZvsJZIY0CzJwhP0zKZFNC+UJBJlYfsw2Sf8/unppAMm1bIMtjsj+JB/W6FTOmqplBlPykGRk8QdKXgQv2R3BBUIRuP1EJcBXz7LHTPFGzWQQ29FsmDwWb8wzOKRIAHJtA0+gBjMBOsDGrwlmxOCjkbMAOc9ioemavS8mc4n1OZxbP3WiYSpbAYLQlcdKs4TxwfiS43luVVjbJHnjCew2eoI3i6WEEIamGR3ZqBO3PbsThgD1RcmKTvB5/4yo3Y9NHGk5Hyiu/DgSg49gTFZbKQf8FKP5gtP1z55ttHa+uBv7G5tb2z23oRBJd/N78M1utBHKB7XLWCqAq4WeXvoyA1TiyMZyqvs/ZCv3J+f+AunJ995cJAaELotxEdM4H5cutXb8YXo3hug1VUt5O2jeIa7Png6MDltMj1VXS0ZSI8DrRGVGuL4pHQfrDIE4gR8HeKrxGBcm2bePb27sBs02Ftt0KfqMO08KhnR3eMUOxh17gBmvIuwiz91IXjQVkL0aQCvY5D9XzGVitoUWwDi/BvKC4m4W/WtVdby79effg7m4SC0331fTlCIELXtRCGeIhxhCVZoNd/16Utws3/lte3EZaC4f+id6JoqPxVm8byizFU6RfraXwbY2nLHXqZ0NCcWM7nfvfzbbkW/F2v8jsq7XCXXEAVIRtiTQ/FK/uvnfzdjON/w+d2kWmDjbvvPxMm4u8dxn3oQHYGFnYcq5I99jvdi8dHCHjKK5W9ePw2bmTnpbTLg/3TY0eJUryDU9khQst+/5SrUsb97rBQn2TG9BGCq1akq36UlT8ydTrEBhjYuF0sFSqNtTRve+/sDd/G9SXexvU1QP/YIDuJSHMZUUklWZASv8Hx3Vi5F4dXFdU0cH8U2WnhK73PId+Ye+OoGRaXImNVSDTYOeS1YGMDjQLfRna6WYxdB3uEohEZru5lDdHJDGOKaji0ig+K1WljBnP432qipHC2bra0SA8qLMktm2Jt1YH4eCp1MXjn6ZC9Fslbp+7jFHiOoBncvOy3WLfHaHE2VP5iLNuvRLI1zbWJV/dcdHTT39lqbe/6AxcFduPx88Gl1RIzeF0hxldslTYqVFZeAc2lwt26gmUuo/JckUU1h5y8sljBEMvuVfmyjKpm0/RqpgryqMt1DXqgBfqGrWQzKUIHYjEhb+2J6pdX3GIvPPcKqxtrrcBbfeFVaxnsZjrXsFpQwWuSkzoHc6N3gVCvKA4EOy0Ii7HEDwb1Oz9E4/YkegfD1VEGJti/qkOEE0rftuUSw7gkSJhmNOvFYPmWwINWQVljTaEFrTzOrkIiSWz8xAox0amdAL2A0COKojKwesTJ1qUq4Ih6L6gzi84xgSjDmcM6mbq3q8YFVnmh4mTCUciyCilbxxklEyNKkVHylNKJgwjgQxvrRKYyR3Vg9FXIg1uORfUercNnXJHNdhGii8ljceso3Jmo08ISPayuHD0dWupnYERAO2nXqIJCR8F3UE8YwKQLv7Zs/DdZUPE0K08zuReXNnNRiDipz9sgugj2hCN2iuLMRhrkEKyRKk2UR7eUdGB6KIk8JKe8HCGi8mhen5jTCaBUy9v8Kda9iItOD+DW3uCJh6qYoUuQP7Z95r24tMviUSrQr0P0blxqxHsPfLD34gzdzS7mrWPQHqOOEXJ3DwtV8kkzFeD3GH9PYdfaf+o/G9xSWq+d41ss9WBaU6SE/1UHLkfYwqe3T35g/ulyiE2QVrlplXt2+6NuZuwZGG2UhSG70fiTvFCHT34whYhiAbMIOUo4miG/vgUgp1eyFgDESQp3vCJrwwKIKzVsRDwqu3JkqXPeHudoDvQ3MTpVqpxoaPvsUh7TS1vb8AIyd+NsD3hYmGwQwRQDwQKJ7cepzDTtNdmSlwLhHRdzdlC4Qur6lj6Zpl0g4+hmAW/R1QU9eseqhLOLuT0o+xdK7t10oZDusHjmZVE/FJcsVqJhaDNXT6qqV0+bJMNUVAXf1+fC6VAuZO5VpfmpeTFX8NV6C1eri75aN50mZcy9JGre4NfK7RdvvqMr+kqtLx7QncC7czhNVgRmoZkigD6i52eLA6jO8zip89NGvhpGVZbP3siQR27F5W1nZYDxqwphvIpeSaAQVhr+zv8LQEcA4dO//XlQw9gO1vvxlLUqy/2N/Azz3v0qVjXSKLivC1nvjybYkQyiNYd+AhUMfrcOpBCO8Yk62LuDCPSbNe6f4fKhpRh9u37ureDS/GICgtExnnH7ptvbZnfXLEOO2vG+xet9u8PLjPUd4wMxaMcEmzvmmx0AnZhvd0xgdoAYAMAA1rFs7+4sD7wd/HZnl367swOwoe0d45AGqN7OwMNPSGPZX/+GoHYDLD2CmefxAxBkh0+KcyKBzrEcbHpe/4UV6B4/397d2hhs087tLL6OKUITx3yBBvsSqyGzTbAeX1bY3V799V85LfJ2sBk82b3cWTc76yuXqzvrXv+SYUkhfD1ZfYT/vI11WmQ98ZD3+peP8C021lqgvPrUr5y5fPRo3Tx6tL6y+uju6eM/fcblgieX/t2zx5+PensnS+gcf/lz/8e/DPpL/qDFy7eI6bu/fO4H0e2A8R/Ojo/2zflhx1taR7fpB31cawD0EqaurqiPr19dBXd3339G2WcsCu+CO6KDz5cPyfxMhuUvd98//tPnwDh0J7M88Di5NIzM6nrQJcE8AZXBAOXJ+Ka/9nDr+bIZ2M61vBysBgxWQIf+5drA8Pf2gIUAzBlkVoM1zwZVpg0Xu/AcatMe6nYxNu0wnBYinJs90vnuK96VdHLh0cgciyzOCSXT7QaeQMGNpAtL8BOEf3c7YCwcXpC8+R72Fby55MA2/r4O0HFQVxahHl8s8kywB2IDPXXru/5Q0bekTe2oUpkOPHtc+zcWMR8wUDeDDfPc7ADU4hLDa2sHoX15RG5Ty+6arV20LcFybPvmxYsXBv9MsPnC7CzvmJ0d/BmMNOOboB9s+uvf7ARNuK8dC/i10zLb/W0C0d5lLO3+t+byF2AB28+z6b7Ppmd45K155j90mj7zZjO9XP0GEB8M806wwSve5TfBKjCJfgVR7JsFNI0FYI0aV2MtsArf4MGgDt4NvFC3EfQNdTbP/N7LeWsPLh8uB5sb6w+XW9g2DKbff/fddwOCK2ZQJGh4CM2cJhc3kVQlpFRwi6Ia0mcRzKcC5QLoAuSxRcCwGuXGLvYpFD2FQq2WNP+Wmcw9JBh6WOF/unIzIXQ+dwOPO16FvuJQVyjU9De/XH5rWlsDE2zcPX38/ec+Q6jffaYF9irBNT14NDBIVghYap8whmDQQIqQMzGW5zCxLvZtAHMvWOmvbAyCFcJUebhON/pl53LgtfrBbGOwHqz0H2+YQX3mxQCQJlumv7LV2nhsBsHK4RbgsFG3ZYnV1tZjHpYv+v5D/lgb/WC2vjEINta8tcDQHgY+ezBbH5i+/3Bt45fLwTpnd4Iem/qs7AzMzjpNWms7a+bXrrd+/1q/XA7cJdd+85JeC/9TU/Ufm4H3a63QX9m6+2xf9+dDIOv9D3/jz1s/HwYr+JJ4YUxZ63Z667tXG3gtfNhN2w0eBhFjlc22yBIn6JuHQYStwv7WHSDjlpd5hqOrrm8Fd+b3XB70VnC32tqyP/da/a07oIM2zqJkpVFED/KIOCoMLYKht7EOdvPgAXaasc/825BMDUOnb/vDcKKmlosM1h9aq5GGAVk8wvR2BmWO+Jp9U54b1mq2YcqG5RysIdqw4axsm4j97MEIBkZO77DfyFZM922cDlmJilqdl6SkrWyTElV8YaFkVa6VpRIT5TFFbIGNTcNcqWmmBGREUjjOsgvYYX3NRIlsk6QFOnBmSaHMOQ8DpQOLasN2YAvmSg07JfzB7uQIFpnOOun04vS+PdKiHVK9fQ0IPbJUsXh1LbZDqq2PWNaA3VCcVLZBTod72iPDl6Z5z2+Y9dj2PCsLtu1x9i1e61fselicoeU9QB+BGthDBG5r1gNFcW/BnAdOL4s2PWzOAyMemlYu8CZsxqPIpo6seN4OScfw9qst47XuW+5g+0XQY1vzHbbcgbEp3u093xWWICyF7BLSF+GNBcGlgzRomO5lkemQLu9It1tk8kXWWqo0p4WBTq2ua61/Nh4/31r1BtvLvk/cahlULWT6/u520LIySCto7T7A0IVRD0T0tUeX28tmd8UAPmRwuX/aufjr2UH/MtDbu48eDNYvX5DCeR1ckAE/LFYWaa38hHXzNkMeBc5dxDNbxEYG6/YQbPDxIR8uCUVtBSCwfR0PVnhe5TdAmb8WzILb9nd+cHuIvXgSxXe8L6ot1Fpf3fnt0yQArHh988va5cqgtWPBEPvBABP66gPz6HfjsQIzsR9EGRshrAYsFzDDW6MTvEOFImxUsXBC4HaeZ6tDWLlBTN8o8qpzu5BvfyF5ZGFbn7EuShsKuGjsBtwz4rqcFsklS5lYuDz46hvVVl7OwutrdR5VdR55K9wVLG7dqvd4EAynRUJi5X/ibYyVZ1Gw6uGzOKkW8HHef+KdqHUXewjGEHccaE/qE7/Wo9a+co1/9Ar03be8ZRaERVYCQFR7lk0MGNc42LOgKYO77x//+DkYEprCQv9oJ3Eo94C62M5KoCS9Bx6PaX+cCkpSUWCEtj/BmHFPxmNp9mINNKW9BFt/e4nIwomM2kmqssjQlZC8ixX2IvYKgGjtTYtk/h4RZTsikiVVgmVvWUh4IXQmKuRtl44CJk5HFdmIEL65pioyHSfXplPEKRS2nbnIzL4oruk0iKrkJflyn6uIc0VfyMHc0nCjA/V6Iq5joo7FWGalIPoUyLh1pVNGzWEyhPM3yHPJx57A6zIpRf2rHt6ieirKNZ/hYlp8nCpsyCJnm2hfyvwMwRJB9K7n/PM4rX6oorFticO4kHtFHF5jh7gQCX+rQ3Jj5oc4nIYTHQvzUsSZHsI3+eVE6ZIronFM3ULuBvxLSv8KePuZeaUyOd+XIEp6tKMMena8PaixMkc3sO3iluyKG1q2VMReMtUT0xWzjC/dlanKOhMEGcxMF3p1ehui+IsziY9IVPWM9nm40D6uzdCFQdIDEmW/CtPus3DONitnmp+FS0opk7pCdddUUuIulMnMuC5zLAqlMnNMQHcYKMc8ULiArsWk7T2cOZsWUMVzpnpEm636js3DnXTcrFF3H85zB8JXOY6jrGrX4zgrO4UUqTmOdTk/h0b5WIUhbdSdiBvxQXF/OBE3c3OaRF1srlP/53QfsTTsAOAD7mFf5Ewksu5DlKNHBFU/IHL1452JXMzF+0mcmzOY6Z1NRyNzJoupoY93lkxTc6Zmke3mtpXO5VCGoahykTlXes4c5VzNBX+xnoiiRHKp7QA9kUW2XtXGPSl6FJ+7F8ssE6YXJwjJ7jpG3fgLvaOXqZlpfoi6p1yIzFwAUu8CSBqJNBfABYVQCC2+gKBv6vawY/39BKB+3PqU9lJ1LY3tcHygGzXm6cCx8CePf/y8yghwq62tb8w96xlnzrfh7Aa+6khCM49V5Ht9R9Xz893n51uPB6svIDoU4xoUig02HWqiZ43e7mjavfs8MAukg7b38LcefCb7oIaAtdKYzDachGVWvNVLYGM3zwZY3+9AzORHmo5t0FeGHbVLnIbJCIDmCzVabhl4BtOkwpiDbPbx73rwBVRsl2GM7xrBOrJLuZiiGKnRF0YptRUNtgs1B2ZsProDyXTmLnhkj5WrZKjUv7taYfOCWhIwK7D7Rc1mxeBujc7s7Fo4YigyW1trA8j9O9u7MOqnNrUo8rSPAOOQgI37gzWYOZngznvBqLp8Wx9YxpMyTfTNmPz6Pyb6Y3L5cHljrUIdJzzM6Et4Xo0NHb1GuGiNc2vemgm1btSoTX8LSZCU0GKEhcSopPIe7oA2HgHzU3t4VO/vTYP2YOXXv+/C5yUJfSW4Ixn97wNv7e/8HnhH454mzjJJuKOy8F5dHHfxoOutnX/CbfXN+J9w1dXWFsLFEpppGv0zmguf7GNibJdofEvA7BbY8i7h9fPPuLX+mPynXrW/AeBpsKHg0i4pfItt2TDDhnvhtJF99tlMg7uGj0fw2XzX/87/8+Duu8dwRXzy9PsB559+NqEdTgOz4Xn+f8ldgqA/0xFukVsmtx58/mIzgbG2+24pNWguooIB6MDuMV6urK+1zMaAA1hge+ZrN8ALLS88ldd/4v9lEATXZJX5aLC+21+5pNu094Yv//Zp8M9rg9Vtg61GuitMs3YfDVY8WoYGYFDVA0HFQdQj09/dGpjtFhxmTT+O0kxPb9+SOtlvZL3WFtw/aZHZX1+D6+wdT72PSbcZfPb6rfVB63I12Gxu62wSa11b8S6DTRNsrlzyfL5yydskvDS33+jx3cC6iXqr2ED4dX3D0wV9w1O3TrTGzYuzZtMIk82W1KgxIWVyRibB0LIHwWCdZIeVr61ar1YWJqWvT/R21QqnlaalKPCXFU11nuuQC+LBg0cBjG6t0stu9cxjmVhWRvvYpLzmfjtYcDgL6Gj6l5sB+i81y3qw2Y/GcTqfavSaP3829c/7C783/0Ap7uX+fsc9bxazUOQQ42xsF9a7hW57cLW1tWLoio83nm999miIbqLCKvFb72Gr+iL3JYXf/Ch6rb+zNeD5jqx8K3voobMu5K30e9uBq9V+oPnHb0weEbue5+7gO5RY53RGGvbat4rdIsk82Wv4Ty3YK3stq+3/wiq7UvdXJtfkOMx+vfVWeVYm5qfe6QnuBs0ptcKxyKEz9swxIueccIQyq8t2JtZnhbqFfykbop3L8cFtrT9mi9/3cghbsXSYVCbVlTRJz1FtktozVwMTRLctr7FX6mxDnWtWoVK7GeoFQxYhuSqB7DpzU0IZdfsSkYU/rrAPFYH9uV1UaxrKOC/F3NqE8oiDBikrC5X40M/AHjsYVnbMwTCLEx7DwWcam3Rja8+8MbCyKA1a+zYsC1sl5p1nqO9Vcmyj6wWrZrH7QLw1iy8Jm9p6D7nxvoTLCWN0Z1drwTgdDDQM0217Ot5o26Z2ErijG9IudKHSWtR+9IAfpTLChTDEkFJeXeth8JWn523sigXXO9pfY8ZYPRJinEWHrqCga+znCsaevJ+/tilefVsLws4fGMxXjRr26ASKThjoFTxz9f3/w4yGl6TMaYAST+bZ5EpAXaYVrLqF7ApNcwt+tt/1h3sD8p4lV0lyo13LWua7vjrlad+eAGXPwAaNQiXQvj+drrNUh2frK6yP17LaxJ4LnKdrswy7tMYZqNmie16/zbq8RMfrfDmb/ztbccvzfbYdw2ptp2V2ds233+6wmzC2i5Z34Di8vb3D3sLkIwwrhW/N5fIOmy+wP0DQCsgAphVstEz/l63Bf+QLfykhsDCzUMYO3pEKWbOw2tqyuGocH8zrWVv1yvI+EzfxmKII5DaUGSysOToLMVIMeAXPX+IjGx77Tltg+8vt5aDf2W9ftGnzKBjsrlxuB5stSrBptRtsDtYvQe0M1uHd4lOYUf3APLrceWAe0GpiObjznOKg1hMYIryaWg8+OzhR//bjVBZzTOv1FpFbofxDV2xsJNEmEkaHfvRgdwdO5Jut3Uv7FlvYNnMvhLfD7yLPFu2sbH/DIU70uiui/D/5CRH/BZ9ls7X7LQnun1iV9RyajsgHhEs5//bhbaup53oerG653amtoCH0PgmeuJu5lcmTYPXhxnrrYQB7GT+YbVlR1W2AhRRID1K7KnwtE+ygN5yYJnECfGYdyiwStIHbqDdCADfEv0CxjhGCauy1jNXv5YUEHNL9s/Tb1dbO1hazsi3feoGQl7zQ5Ma8hMk8vjHyo5G0cW/G0oxLE0cUiZungCU3B1CkvVgbuB2VjGIv4QE1zchOCLqfFXune7ckMHfJHjDAghJa+tMiNrRlLYq5z8omnj6FLvFcoUoSHnqVpM6ZfO5X+ildqbzqebW6E0+saV7Ol8hJHeob4NBKoUuvgQl0I+EZZkP+fOHN0pwT2TksEbc0FSJO4hcKs0z5rl6m/AqTlD3GDEEwrba2loZzQzAF9CFdJTddijLWoxjB7IDWKoxWKQW/gzkGu4vRIbe+5wpYdoIaDdOonWBhaR3JgqbSJGaYOSvbVvhys4kspGEesfgB3Y7p1hZTjudjZpQsLthl2f1qVa/+lfOLPaPhuU0IWqZiyfYuECpCMOVs7MeNfkBwQrcaIvrBycXRxdFBzxDxV3O0b472zw8Oey1z0iETl5Pji9PXBycoOL1oXxydnlB4GfOGUpHN2+ShQ3YgIpu749vzI+qrPzzbszBnCw55wiYX2KOJxBxHZzaHfknBgKzbXuTK2Xx+vC/mZnyssnJiD1TwV+DZUcqnJvJ2z0HFsFPimHCkHVY0nP8yGO3EN9JFa8lUdvJl0Rm5tjWLrIdMZJcH+b0K1k3QBoLDG5bqWmaVnyDCo6AVKKZSI0DMNCMtN3Z1qU29lpm796lsChf72r1wU4vmV/11SBYvWHBvwfIWNuv9ne3KQBZbzj7vNfetuePj51ubg/vGBTZyTGV1WgeJYXsS9My7z89prWwlI7a/7NN+xhptbS8UtHa2MM0/38K9Nvuby4ONtUiFvu3Lwebd088ba9bg9cXAC1tfjVKzatfnqxwALGyxSe2GtQesgowFT2EouOrUZfdi2/SD6f6P333nB9P9w0NWWpF2ZsPc9llRFUSsygruGgVPHv/wOfjseY+CvRc8VZN63I11dhzkxY1dy0BEJndxsrAllYj9mVP/b1XrFRLegyF/8IWLWzEcdiTEeWkxwR7ZbAqLBZG1wrUTjDWAdb7qEP5gFdiqrhQg8EzOa2F/lzUqpCIZkD5kzRlDY2+BNcTknEmv+msqhUCv0fyDN9VrNzARoFcy9OtEzT7JQgVD1iSwpO4ewWorhhQiPtjgkGjLjQA31e8pdA1iphSWH5EhldCpse7OC2vMLJRJtZ5OcxqcXyw3oXRorCyLwhaRqqGx0Cwy58KJuY6w24BMcW0j6ppMXMsoJDQDC3XgkGl5FVgYVdB9+PsZ++5YAVJolbTh/hlhhRWGlQOog7i1K0JJsSuxZWUjqxTzBQdlPE4jxoqZYlKoZ15eMfL3qSyuvYXOCRbzxzf47/wGHg1Cvf7HZ/jv/QyeMyl0X+C3mCDpRPo7zx97A6dj/YPx/tHb/mC8/4O+wR+M9/+Pz/CPM14owJj8g/X+0d/+YL3/477BH6z3/4/P8I+z3udOZT7nhuPwPVfTFofaYwUcEiI0a8DCK+Ss3i+8ok1M96EQVNRG8MpKzyDCauWn9eTpj55BIIhF960nT3/k2KoEDUZNSd3Dxun6oz/9V/anL9RYLj6JjadsvlO874tYA5WSjZWbdf5eyJFGRa/1ZRjnOvyrdQvf6JOBF7t4m76/M9il+d3uxcIbHMZk7Cfur68NvrH7rpffmu3d5Z2Bh53Y1i+D/sbW4+fWmm7g+/6q2/ewGwkeyvqXbJ99NfAergYz2HE9NIBJ0vSMQct59G+RP9fmxtrq1iqfj1qk0kWkQ2/VmsHhSnBdX3cbpIP+1s7goW0DtgOvopRurHnPaespE4mvp0Mty0iFeDa/FOO8UIka2wKy+dVhEedliFDCrLn2nQG2VIlTy9ozDj+M1NpVjjwNbCithPoKRYQLVSF9oFjV8dlgLJSjvaZET4SeDEU2djf0+Tb2Zs5m/TZNqgqNHy9ctdoTCdkrH/ghIixl4ZNliQj5gdIULqZiKBOOCRLfSJ/CLd/L+mQ1j3eqT/DArPP0uQghl+ITApZpLAuYbbBhyFyXMvVd70hVJqI4rNosmi9khcYOAX4XjbJUhIWi/brqbvVt0WZAOeM9d6pK3xYob2Hiw2nI7rg0i4g3iaxsllXmW40yvHeSyMS34L1jmckiDgsxs9+GtiHDREy1tOeqV7z/GH6Y58zRfbivZXYDzecwio19qUKOAZxayOwmLhS1wlDoCXBo/Mj2T8aso8dFw4xUYTd7ZVhy4/nAVKu+m55I9CwdikQU13LukG8oMqKfElAvbQ766PhMMVBcXeoXasY7iOTt2qyEU6GKbHchyu0wUUZncZ5LGjbXUucyjEXio5M2788/poSAz+gGhCU0KQDzOS0Sv8CUgViU8I+IIhlVPRu27vajhFpb6oMj0sgNpo+ulp64cxQRi8iEgmISBFuOQDkhtnunY1FUA0pXFJ6FB0Eh80SE1M3pwaMqrLqk+QVoRrEuF0crRoqM+J3ra8qsLObAhfJpahVRqph70AVoqOKOvp1W6VrUnhhz2nInvmgutLYRFrnAvhxnFAK0McmgerYxOOSn7/xlEK98LMv6AasTi1yMf0xdvh6NDfNYv46b6cZJSuED6Cd4ubyQdptWFWxRUXde6taqqIZW9RQ26GrkE7++EclUUuNV/EHo3PFskHbwoCySE3nrM2Qk4xrbjN11tbnCd8PR3ZMGnMtUhfRp6GVgfFA9aM0QG1E5XV+koUb+PKEitpfKUqAQULQpvtYQgf0qe9KQsnY6sF+z5uy2IFKlD4xRZmWZPywgBZXajTpq23t1UAb2Zt/Z12HMjx1y6eJpSFnubnmBByX+7+b9uuhJxc8bhU8bhYoaJc7CggZPJC0xLOCMG2djkg19IByKcYPp17MKYJ8Xe2Ld/WxDLZyu+pSPhidQMBr+dlBRR+Epr5Bjecvj2/8gbgR3nbryAsOoJmeaXn323qIruIYCO5S3JVljyExl+AslZi/MDRwNspyHSl3PBMYgH9284877FOhOpAjlOc3iEjYfYGU+GDsGis2KhAQebiyJly5VgR/UORrrEX3ninK34xvwzZzVAWaLwmX4FBW536DvVo9NpxvXbVQn0ooernGYFfi1rCSKsSbQa03zIX87PYlzyzx0GqeSPiEmMpqcRjDsTKXQU/gd3uAb5eDQt6FSRcSmspGPmdHRFhIIlrv2TJWhU5D+6XtaWDV4H01z8g6iIUGhN7X2qRsDNdwOsUiFbPBT99OJG8I8P1SDxWYR3FVPpCwxxwPVNAQyJkGUF8CPt3OeyKpB6+Q6CgX8RceXaUwiBssEJa1dqDfm4VSXKnUzoGUJtGohYEFfjkYyLP2KATEOOo3Wa1lkMvFtfGIXE1q7glSUE0c3GT/6hp1s+KTPqJgEq5Jx/JSEzbEiqsxPbivB4Z5YmHR9pX42NB6/elXEJil8mVrkVZEUbK9ucxnNWAJ2YxH3PZiBN+dn+2GY4Y3KSvAHWfEhZBa4y1jkCxMzAcJaQDhiGjRD8RSLC2I8TsQTZyDqU4hemHGRZDhWvqV0Do7Ek7izynS+cE4iJKlfpX6c5dPSBYWuR5Sf2n7SKCKbLce5OMfhvylguT8F053IW7QYGwqSmDOB03TBRmu+hUcvmO/FER7PlXHQRazc41SM5UipEvjVENGzeYrnD4EGSNwWeJdxBq47yicAKhvFYGHULZoMOnInQq0dpUYj6YplMbRUzbNtQSKrn7i2s9liOpxbUtfXhXVYnEg3fzI3p1UOk/x6TFcdsJCYNXk1B8M5FTLHr2u4T9Psx7KY19lcxMVibqolBKiRqourIuIzdW1VlHH+5VCJ8xt/NEWg1ji/+cEXHEanrhnnN89cqZiWE1Vgsvnybr6W9PDM3SyNgV9NK/Qy1SXgMix16bMUOSnLvOrShMNLX7SQAlIOf3e7nqCBYmn0AXchFrd1Dibn8zVgfW+bvPHRF0q1ypp5WkHfltURSwciQq3pmCcCBpi4u2Na1SxHoog91C3EcECZ1OAa9mw4UXGIp5wnMk+m+CCsYSBxlmlRjGkaw1FfY2Kiya8+SQT1xUrUrG5KiwVglbqg81BvlHE5JVrWy0Ny/eU2hc1nIn3L33geENENjRuoAWjigqmnE/h5ZJPMW5fx7AP/C+u/UddqzOKVFNxUgmA1yI8mXZwvgmO2vJYvBMArWegpuMScZyZSRKaqkGI8LijImHahTHXFw5xQbJvNPUCkSge3UK8q5C0FQc5U6adzx1okvSjUinEuUxEnocqi2P40VNkoHlsRyKK+omPYfmq7iM1Vcz9UPu6ctnh6otIoYAbHwp5HCAz27UxAApLL45popAQLZdJbTfJEpMNI1O+TxMk8B3+3K2P/iwJmRWTNXC3jJhx73fUH0kUksc4riRYY26G0JtI02wlWwcjRjYAKd5rxk4SioB+CuQK8gzwcENEF6xfNIgCfowIg02q4+OjSNkW9MKhk1NwxpVSEjowo3OR0GkekEQH7sZDB+bQk+RA/deOW2zWNyfq36pBYlYOVlzLTqmhO/CT5+dwqmAU4T6s7K6U6Ue46U7OsMTx46GhWZGudQ2tcdUwRhvQW82FzREUqtS4fvHIEyq9SmVVBWhmZPrAfR4t5GsyuyEqj9Wm9WJk00kAe8zUtfhEyjjyeI6LtKsf+hrXbbpUOzmMXUhj/mrgEXTAnpY3VP6FUO5HKb57ipQvJA/dP44Ik7dkCxr6+X43vGIoc05eg4E5W7qNGc5/D4ly4PuQDqKT5YS0IBekYomnR5FN1GTek1Q3Wa0WsDSq1f9Wz5rm8r0dkGTkHQMFCr7IllSYiRRg5EU6qp3dinZ4OwRlIX1S9ih0f6O4Tigl44xQI8U0csSAso4augRZEtMBFv8XvmWDxEytR363kblizkmLvhtj6rdVlaJej+qnI3SQDRlj1YIwowSyOWQRf1L5Vs6waCo2yUozpKmgKXvOT2xJPP3yXxoK7KcyJMk+cyPfBSWzcOENRuAIEAVr4mRaVeIcZYtq4PM351N1pLWD9Q0kSrk+xW6WMWDtgtbnc/LRz1/ieaO9q5eaLDDKvmuovTjBTk1GtMqLR6JRyuQzDWlfMs1gt5VQzXKOoXgfmsggld07qSNAd5jrWoZ6IIi/EJ1V1ycgG7qx5MF+syRnLxrJuQZe4qNik1rTnC5XIhjKUuUlDSMEgJLmf2XStFsikfVfbtxfuR7rQ4TRJeCsHU4zVO6c5NCvVZE/Q6aKInCzEU7NzD+EuiF+jD7pJCHQp9DUzTVlCPaLdZ9VUHT5GuprRhb7WYaKgd2g2RFVE/DiJR6Rv9+s1fLUQqPS3xM9qtmSXWI3xwgFlGuov1ma7HEVSjeE7wFxpXCh1M9fTIS00XbVkKiBYEi/grRX3dvgG5DHIna/6BSqEQvu8bQQZORdJyZX4CrYxaO0J5oMPCKks9PXHhI78LEQmU0HHUHAVKHv4MnaiqVSJXNpoAC6QmUO6p99a/oN7VoyH1T+VVJghPl9B63Er43DHrdXcErM3lMDVp4a+p5xXwlM+yWkHaFrPxKIYVzyaFgdiHId1a1bicqNXNDXYPJxEnJWpKAVGcD4vJ9gYYzmnUneiJ7L8VJUxt3GPr9KYNVX+SApMk24OHYk4gY4qp7jCQxFjLyJPBFYK6MpzkSYxNtAo9pMq3Mzc7MeilGNVzN3eAlSWjtaJ0BNeB/sJwbnYjG2he5sErmWmPB9GNzJRIRaa9npWw+Ta6GYSJT7PT5omXT/OuNtqNwdXbVx1mQURT2Prz/EOqPtjaOrrLJlRVIpzq/dfKGz8YKiSyI/Rt0Pe+hqKgiEmuC/Zl5BpPhE6thtlpRjbeXSYiOzaDmDXENXDfnXTFTLF/bJKNL5/AuxGgjH5Gsg8ZXwTl/Ncy2mkfOsGZ3PUUTK/nNS6vaqT03Kc5INmD5iIwk355BW2UNSo6PSJLFtSHS1LUviyZFX9Cmh7DbVmOFEFa7ad3lpl7FFYtSomXsxp4jbW9pR9LZuruoIYiry91z4Tw2zU3js5tFyL5rM20T3WEESiHQkRqbCtwzjeV6EYR6I9joRI2l2RlUnxrH1y0T1/JnIBLZ7KRm2iljrNhaDI5W07l7ciT9pnXegZrMzRBmnv9TFpv+mKIprGmWrzQRSjUfv88FAUqS902j4/XnJRNUSRCmI/7aKcFkpwiqeMVCh0+sOfvnuKv/oHGqxYJm0kS+13540zeSbLdu9s4+TgYmm189CDT52YlmqisPBCBPFXRKEsLpE/KsVNlLRvCrV0tN8VNzGUsZP2TdzDUdwUijR9N1rMrtvvX++R2YKOw71276gzhCS5h2Q4RHfa20M6HH7Y2/swjEOZ7yEZxsVwj/60yobZaO/kcPgx23tzMgRDHE3D6z1HDAtEhOQm3SOa23RYqL1CdcJR2DnkknBkV04TETPVmYjYnouTzlE3jJPrTpxcb3bW10H7IeeYznMcQ0ryPMQKokPriDBRH6aF7PAhTMW17ByLaxmqoUo6p3unXVZCdii1N1RZ2FFZOC0yAVmaiY7KLuTPJTZKIPJ37DHMczwR6TqSDh9C3XkYauimziGpLXUeWogFvyfDKSnozlQSh/NOrxfqm07vXTiVnbcH4TwH9hal0X4kinJfFDQrz6S4kQgb8x5EJG732z9HE5Ek+5TEo1H0QWRjtU/p5k9x9kE8jTLtf1KZ3D/pLeG4hGWIK/Qpo8JrWexTyjRK908vllZfYrPkJv7kRarMZCmH2ehg7+RQRnGpClanHBDNI0rGo5FMDjj9qSehT+jGOpdJfBsXB5TKJD1IUkgumhJsHucH53uyQEMeUCpLcVAKCVHnwLK2pe5ULFm7GWws3oaYaVSRThOBgPPJ0iFnRjQRHlJKcPYUd34UF+R9T8orbnwIHfrQlS+58iUqxxriMFGzkSoAh3XIhxEJ3ocPDwspj0kVsnRhTXmWunYFOH42hqJLXPMLoeilSCW6W1FVetk+W1rttHveWMyuX7bfvx5jkL0k/j2OuO+/3OeOOJYQWF4e7HdOjwm29LYcx+XLGGk8hkHgRkWNE5287Pa64zQZZy9Pxlk8Vi/VWEHP/1ItsUTKWRCFiBhBjdJ88qb7ksS88c1EpMkr+nNLsomAfjN5xYeJuJWvxK2cDPUkTF51upOxfRZHTBKdvOr2uhOlslf4u7g4WzqjmDD+azn3z+JMTzSV9sif3eeIpZCL3ABBmEMonVErDifxWH0Q6RERPwnskWVHocricOpUtj4LtUedt0vHXELdQpRxVBxFRaxjSmSoy55V5cloCcH0l1aPDjpLPzx58v0T/3vPvgsfoDgv0j8f0WHpz3EWH2VxnKlYHakPP/2EQLbiBvMQyH0V2hwYjy3xHc1fFNQSaUWXILfJDzRQP6gklj8h+fDxpzcf9AeNS/ZwQa0yxILC8U8g/gQqB3X2QdOF6Do/9Rauqm/PpQjLpZ96P3+YJrH4Ccm1hPAP/d/riqrmQyyiUpG9pvRalUmcvab0urwuNZNL/A7X2Ih8jQS9/7YrLuTPpN3sIkmilydvl7pxhk7PP+hKrbtxMj9TGVSh17RZgxNJ/HEaR11KmWHcWBacJDdpt/vueOnoPFHjrhoT70pUgmHSPe12TvcPulORzFNIx8dIeFRh9KHqcXXk/aJj2gHmfWC/ZiZcvNQsKAX2QyV6TiiOaxKlaYKC424qykQMj9sX3fZeKm75bY7bP/PDp1Eqk+ODbiqLVMTRMR+wNh2prDw+uGgfnp5cpPEnURwjSbFhGA2PcdjfS1V2LefHlEKleKyc2JPyfc4QlvwNJKd0io8+kcf2mD35mJw8edPNnn3QJ89+6uEYZSKLnpbYPdD+JEpORBYtXailCypZerXfzUQWn4gsztSNTOwnQ5m2lE5P2r3jbNhoi6UTVcqhUteZVNnJwelJJm9UdIIkG8fZbRanJ3Gaxbcn8W2Wp3ZMVVSmY33SO+qp4YeQY5hBGu4oR4ZM5QK2EVxh6YwyKhRpctoRaYLoHadRnLH67jSXWacL+qPQKXJvhE7Vp9NPgNgc52ft86PNl2eszDujlK/Ol2U6HqszR+TDkdAIli33IB/lIaTXs47fvo11jk54JhWhU0YyJ4q2WmWRnOHv1Vk+ySMVnr0621chVm2lP02TMxBvj7tUME2THMFrz7qbvTfdXOX4rLyvC4pWvPSpKWh0/rGOhHHWpBIFS9j0Y4IocG+6duUcS71RkxTgcDgdAcgEce6XOCydznVy1r44P+3arx5n42qeyqfjs+k4n8L474zSfFpIEhbz23x+Ruvdj2+WVq+j4foSZBQYVHpo/o9p8ua4+1EV8o0q5Ef95uFHVlud84bsOaWkxCqG59PhvBhmo/O9k0PeTjy36VjeFnKszrGGlVk+P5fZo3xeSH1umURhpXVC0Za9i6VVoH463g7W7hVxfh7nxXVZqKGC1HJuj8iXyJRLhwUbSV1T2ajK5fNC6/Ner5jq8nyqSy10r92DHrIntF5aReqRWWaPE2zR6BBTPyG1dLAdE8nC1u70ep6e0MeE/SLr+Si7ZDNWydHIVLQqSnSwniN0kvVUQoo44owa4Tx6SEAlpUiuew0Cm0Fp0jvu6jTJPvSOu5snP2mV9FQSRxB8Vg+go5DT1NO2SNurk5io1byn5kurHVaMVZKPp/Nkml37Ok96RC31zrr646j35nBrqUdbvEtvpmrJxTZcWm0XqVj63uu96WpEpC5k0rNHjQfEE5Yi65WCdpkFriGW2pHqkcqXQsiFrlnfvdSzeFT2kLCNctTjw9LCdh81UPns4hnP9u7hNS2pymd+qMtnjSnh4lljOiif+TfDr/zy3Z5XivyifVaGyUWILegL+fMFmx2UCSLIuHFUqjS5OD3ulgW2QC8ohdBznciyUPNSozL3Z9jE4bkvejwrl24av+j9XJZPK3nzQqnkOi6Xnl7M4jHvFdh7wRKeLzXPFVMX81zx5afhW/g7JDZHNNeZKhqMb0+XeL1iaxTx2/Ojt+fdKde6eXcjEvFOJOJmeDMU7/baN8NMlu/2Nk5k6RRC7+zxRhZxosbv+AB90LtX+92bOL2JNfZeiZG8I3qJOOxMFDnf570ocn6CmdBpI2LlTA6xen0vh1jczuQwjpKZHKYii0dSlyhv5/nSsc3Pxjp5/7LXhZ7nfXwdL/HsP0tmKsEof8+HJdd6s0Jm7wuZ3UpViJ+REAWYXsp1pkN5m2j8+/m4e6s+qJ/VB7W0en7Q7tLreKzP+Jnm5r+2j7tzkY3/2j55OU+TT/H4b/H4/wHVeIHx4G0KAA==";
@@ -1,16 +1,49 @@
 import { NitroModules } from 'react-native-nitro-modules';
 import type { LibPrisma as LibPrismaSpec } from './specs/LibPrisma.nitro';
-import { GRAMMARS_DATA } from './grammars';
-import type { Token, Language } from './types';
+import type { Token, Language, TokenBuffer, TokenChunk, TokenLines, CacheStats, PatternProfile, TokenizeLimits, LimitedTokens } from './types';
+import { TOKEN_BUFFER_STRIDE, TOKEN_RUN_STRIDE } from './utils';
 
 // Create Nitro Module instance
 const LibPrismaHybrid = NitroModules.createHybridObject<LibPrismaSpec>('LibPrisma');
 
-// Load grammars immediately when module loads
-if (LibPrismaHybrid) {
+// Load grammars immediately when module loads. The native grammar image is
+// memory-mapped; the embedded base64 copy is only required (and decoded) on
+// platforms that do not ship it.
+if (LibPrismaHybrid && !LibPrismaHybrid.loadBundledGrammars()) {
+    const { GRAMMARS_DATA } = require('./grammars') as typeof import('./grammars');
     LibPrismaHybrid.loadGrammars(GRAMMARS_DATA);
 }
 
+const TOKEN_BUFFER_VERSION = 1;
+const TOKEN_BUFFER_HEADER = 3;
+const TOKEN_BATCH_VERSION = 1;
+const TOKEN_BATCH_SNIPPET_FIELDS = 2;
+const TOKEN_LINES_VERSION = 1;
+const TOKEN_LINES_HEADER = 5;
+
+// The token type table is shared by all languages and only grows, so it is
+// fetched once and refreshed only when a buffer references a larger table.
+let tokenTypeTable: string[] = [];
+
+// Raw JSI methods that HybridLibPrisma registers next to the Nitro spec.
+// Optional, so a stale native build falls back to the JSON path.
+interface LibPrismaRawMethods {
+    tokenizeToObjects?: (code: string, language: string) => Token[];
+}
+
+let nextRequestId = 1;
+let nextDocumentId = 1;
+let nextStreamId = 1;
+
+function getLibPrisma(): LibPrismaSpec {
+    if (!LibPrismaHybrid) {
+        throw new Error(
+            'LibPrisma Nitro Module is not available. Make sure the native module is properly linked.'
+        );
+    }
+    return LibPrismaHybrid;
+}
+
 /**
  * Tokenize source code into syntax-highlighted tokens.
  *
@@ -32,18 +65,573 @@ if (LibPrismaHybrid) {
  * ```
  */
 export function tokenize(code: string, language: Language): Token[] {
-    if (!LibPrismaHybrid) {
-        throw new Error(
-            'LibPrisma Nitro Module is not available. Make sure the native module is properly linked.'
-        );
+    const jsonString = getLibPrisma().tokenizeToJson(code, language);
+    return JSON.parse(jsonString) as Token[];
+}
+
+/**
+ * Tokenize source code within a time limit, a regex step budget and a memory
+ * ceiling, so a pathological or huge input cannot stall the caller or run the
+ * app out of memory. Once the time or step limit is hit no further pattern is
+ * tried: the tokens matched until then are kept and the rest of the code is
+ * plain text. Past the memory ceiling, matches are kept as single tokens
+ * instead of being tokenized inside. `maxDepth` and `flatTypes` do the same
+ * on purpose, for previews that only need top-level colors. Bypasses the
+ * native result cache.
+ *
+ * @param code - The source code to tokenize
+ * @param language - The language identifier (e.g., "javascript", "python", "cpp")
+ * @param limits - Time limit, step budget, memory ceiling and nesting of the call
+ * @returns The tokens, which limits were hit and the memory of the tokens
+ *
+ * @example
+ * ```ts
+ * const { tokens, limited } = tokenizeWithLimits(pasted, 'javascript', { timeLimit: 16 });
+ * if (limited) {
+ *     // Show the partly highlighted code now, the rest later
+ *     tokenizeAsync(pasted, 'javascript').then(setTokens);
+ * }
+ *
+ * // Search result snippet, top-level tokens only
+ * const preview = tokenizeWithLimits(snippet, 'php', { maxDepth: 1 }).tokens;
+ * ```
+ */
+export function tokenizeWithLimits(code: string, language: Language, limits: TokenizeLimits): LimitedTokens {
+    const jsonString = getLibPrisma().tokenizeWithLimits(
+        code,
+        language,
+        limits.timeLimit ?? 0,
+        limits.maxSteps ?? 0,
+        limits.maxBytes ?? 0,
+        limits.maxDepth ?? 0,
+        limits.flatTypes ?? []
+    );
+    return JSON.parse(jsonString) as LimitedTokens;
+}
+
+/**
+ * Tokenize source code into the same tokens as `tokenize`, built natively as
+ * JS objects. Skips the JSON string and `JSON.parse`, but also the native
+ * result cache, so it suits code that is tokenized once.
+ *
+ * @param code - The source code to tokenize
+ * @param language - The language identifier (e.g., "javascript", "python", "cpp")
+ * @returns An array of tokens representing the highlighted code
+ *
+ * @example
+ * ```ts
+ * const tokens = tokenizeToObjects(fileContents, 'typescript');
+ * ```
+ */
+export function tokenizeToObjects(code: string, language: Language): Token[] {
+    const libPrisma = getLibPrisma() as LibPrismaSpec & LibPrismaRawMethods;
+    if (typeof libPrisma.tokenizeToObjects !== 'function') {
+        return tokenize(code, language);
     }
+    return libPrisma.tokenizeToObjects(code, language);
+}
 
-    const jsonString = LibPrismaHybrid.tokenizeToJson(code, language);
-    return JSON.parse(jsonString) as Token[];
+/**
+ * Tokenize source code on a native worker thread, keeping the JS thread free.
+ *
+ * @param code - The source code to tokenize
+ * @param language - The language identifier (e.g., "javascript", "python", "cpp")
+ * @param options - Optional `signal` to cancel the request. A request that has
+ * not started on a worker yet is dropped natively, a running one is discarded.
+ * @returns A promise of the same tokens `tokenize` returns
+ *
+ * @example
+ * ```ts
+ * const controller = new AbortController();
+ * tokenizeAsync(code, 'typescript', { signal: controller.signal })
+ *   .then(setTokens)
+ *   .catch(() => {});
+ * // File scrolled out of view
+ * controller.abort();
+ * ```
+ */
+export async function tokenizeAsync(
+    code: string,
+    language: Language,
+    options?: { signal?: AbortSignal }
+): Promise<Token[]> {
+    const libPrisma = getLibPrisma();
+    const signal = options?.signal;
+
+    if (signal?.aborted) {
+        throw new Error('Tokenize request cancelled');
+    }
+
+    const requestId = nextRequestId++;
+    const onAbort = () => {
+        libPrisma.cancelTokenize(requestId);
+    };
+    signal?.addEventListener('abort', onAbort);
+
+    try {
+        const jsonString = await libPrisma.tokenizeAsync(code, language, requestId);
+        if (signal?.aborted) {
+            throw new Error('Tokenize request cancelled');
+        }
+        return JSON.parse(jsonString) as Token[];
+    } finally {
+        signal?.removeEventListener('abort', onAbort);
+    }
+}
+
+/**
+ * Compile the grammars of languages on a native worker thread ahead of use.
+ * The first tokenize call of a language otherwise compiles all of its regexes,
+ * which can take longer than the tokenization itself.
+ *
+ * @param languages - The language identifiers to warm up
+ * @returns A promise that resolves once all languages are compiled
+ *
+ * @example
+ * ```ts
+ * // While navigating to a screen that shows a diff
+ * preloadLanguages(['typescript', 'objectivec']);
+ * ```
+ */
+export function preloadLanguages(languages: Language[]): Promise<void> {
+    return getLibPrisma().preloadLanguages(languages);
+}
+
+/**
+ * Tokenize large source code a few lines at a time on a native worker thread,
+ * so the first screen can be rendered before the rest is tokenized.
+ *
+ * Chunks hold whole top-level tokens; concatenated, their tokens match
+ * `tokenize` except where a pattern looks back further than the line above
+ * a chunk, which gets more likely with very small chunks.
+ *
+ * @param code - The source code to tokenize
+ * @param language - The language identifier (e.g., "javascript", "python", "cpp")
+ * @param options - `linesPerChunk` (default 50) lines per chunk
+ * @returns An async iterator of chunks in order. Breaking out of the loop
+ * releases the native stream.
+ *
+ * @example
+ * ```ts
+ * for await (const chunk of tokenizeStream(code, 'typescript')) {
+ *   setTokens((tokens) => [...tokens, ...chunk.tokens]);
+ * }
+ * ```
+ */
+export async function* tokenizeStream(
+    code: string,
+    language: Language,
+    options?: { linesPerChunk?: number }
+): AsyncGenerator<TokenChunk, void, undefined> {
+    const libPrisma = getLibPrisma();
+    const streamId = nextStreamId++;
+    libPrisma.openStream(streamId, code, language, options?.linesPerChunk ?? 50);
+
+    try {
+        while (true) {
+            const jsonString = await libPrisma.readStream(streamId);
+            const chunk = JSON.parse(jsonString) as TokenChunk & { done: boolean };
+            if (chunk.tokens.length > 0) {
+                yield { tokens: chunk.tokens, offset: chunk.offset, startLine: chunk.startLine, endLine: chunk.endLine };
+            }
+            if (chunk.done) {
+                return;
+            }
+        }
+    } finally {
+        libPrisma.closeStream(streamId);
+    }
+}
+
+/**
+ * Tokenize only some lines of a large text, e.g. the visible rows of a
+ * virtualized list.
+ *
+ * While tokenizing, the native side saves a checkpoint every 100 lines for
+ * the last few texts it saw. A later range of the same text is tokenized
+ * from the nearest checkpoint above it, not from the start of the text.
+ * Tokens match the ones `tokenizeStream` yields.
+ *
+ * @param code - The source code
+ * @param language - The language identifier (e.g., "javascript", "python", "cpp")
+ * @param startLine - First line, zero-based
+ * @param endLine - Line after the last one
+ * @returns The top-level tokens overlapping the lines. The first token can
+ * start, and the last can end, outside them (e.g. a block comment).
+ *
+ * @example
+ * ```ts
+ * const onViewableItemsChanged = ({ viewableItems }) => {
+ *   const first = viewableItems[0].index;
+ *   setChunk(tokenizeRange(code, 'typescript', first, first + 50));
+ * };
+ * ```
+ */
+export function tokenizeRange(code: string, language: Language, startLine: number, endLine: number): TokenChunk {
+    const jsonString = getLibPrisma().tokenizeRange(code, language, startLine, endLine);
+    return JSON.parse(jsonString) as TokenChunk;
+}
+
+/**
+ * Tokens of a document that is edited over time, e.g. in a code editor.
+ * Each edit re-tokenizes only the lines around it natively and patches the
+ * previous top-level tokens instead of rebuilding the whole result.
+ *
+ * The result matches `tokenize` except for edits that change tokens starting
+ * well above them (e.g. closing a block comment left open further up);
+ * reopen the document to resync.
+ *
+ * @example
+ * ```ts
+ * const document = new TokenDocument(code, 'typescript');
+ * // User typed "x" at UTF-16 offset 120
+ * const tokens = document.edit(120, 0, 'x');
+ * // Editor unmounted
+ * document.close();
+ * ```
+ */
+export class TokenDocument {
+    private readonly documentId = nextDocumentId++;
+    private current: Token[];
+
+    /**
+     * @param code - The initial source code
+     * @param language - The language identifier (e.g., "javascript", "python", "cpp")
+     */
+    constructor(code: string, language: Language) {
+        const jsonString = getLibPrisma().openDocument(this.documentId, code, language);
+        this.current = JSON.parse(jsonString) as Token[];
+    }
+
+    /**
+     * Current tokens of the document, same shape as `tokenize` returns.
+     */
+    get tokens(): Token[] {
+        return this.current;
+    }
+
+    /**
+     * Replace `deleteCount` characters at `offset` with `insertText`.
+     * Offsets are JS string indices (UTF-16 code units) into the current text.
+     *
+     * @returns The new tokens. Tokens outside the edited range are the same
+     * objects as before, so memoized renderers can skip them.
+     */
+    edit(offset: number, deleteCount: number, insertText: string): Token[] {
+        const jsonString = getLibPrisma().editDocument(this.documentId, offset, deleteCount, insertText);
+        const patch = JSON.parse(jsonString) as { start: number; deleteCount: number; tokens: Token[] };
+
+        const tokens = this.current.slice(0, patch.start);
+        tokens.push(...patch.tokens);
+        for (let i = patch.start + patch.deleteCount; i < this.current.length; i++) {
+            tokens.push(this.current[i]!);
+        }
+
+        this.current = tokens;
+        return tokens;
+    }
+
+    /**
+     * Release the native copy of the document.
+     */
+    close(): void {
+        getLibPrisma().closeDocument(this.documentId);
+    }
+}
+
+/**
+ * Tokenize source code into a flat binary token stream.
+ * Avoids the JSON round trip of `tokenize`: no strings are created per token,
+ * token text is addressed by offsets into `code`.
+ *
+ * @param code - The source code to tokenize
+ * @param language - The language identifier (e.g., "javascript", "python", "cpp")
+ * @returns A flat, pre-order token stream
+ *
+ * @example
+ * ```ts
+ * const { entries, count, types } = tokenizeToBuffer(code, 'javascript');
+ * for (let i = 0; i < count; i++) {
+ *   const base = i * TOKEN_BUFFER_STRIDE;
+ *   const type = types[entries[base]];
+ *   const text = code.substr(entries[base + 2], entries[base + 3]);
+ * }
+ * ```
+ */
+export function tokenizeToBuffer(code: string, language: Language): TokenBuffer {
+    return decodeTokenBuffer(getLibPrisma().tokenizeToBuffer(code, language));
+}
+
+/**
+ * Tokenize UTF-8 encoded source code, e.g. a file read into an ArrayBuffer,
+ * into the token stream of `tokenizeToBuffer`. The native tokenizer reads the
+ * bytes in place, so large files are not copied into a string on the way in,
+ * and tokens are reported as offsets, not copied text. Offsets are in UTF-16
+ * code units of the decoded code, as for `tokenizeToBuffer`.
+ *
+ * @param code - UTF-8 bytes of the source code. A view that does not span its
+ * whole ArrayBuffer is copied first.
+ * @param language - The language identifier (e.g., "javascript", "python", "cpp")
+ * @returns A flat, pre-order token stream
+ *
+ * @example
+ * ```ts
+ * const bytes = await (await fetch(url)).arrayBuffer();
+ * const { entries, count, types } = tokenizeUtf8ToBuffer(bytes, 'rust');
+ * ```
+ */
+export function tokenizeUtf8ToBuffer(code: ArrayBuffer | Uint8Array, language: Language): TokenBuffer {
+    let bytes: ArrayBuffer;
+    if (code instanceof Uint8Array) {
+        const whole = code.byteOffset === 0 && code.byteLength === code.buffer.byteLength;
+        bytes = (whole ? code.buffer : code.slice().buffer) as ArrayBuffer;
+    } else {
+        bytes = code;
+    }
+    return decodeTokenBuffer(getLibPrisma().tokenizeUtf8ToBuffer(bytes, language));
+}
+
+function decodeTokenBuffer(buffer: ArrayBuffer): TokenBuffer {
+    const words = new Uint32Array(buffer);
+
+    if (words[0] !== TOKEN_BUFFER_VERSION) {
+        throw new Error(`Unsupported token buffer version ${words[0]}`);
+    }
+
+    const count = words[1] ?? 0;
+    const tableSize = words[2] ?? 0;
+
+    if (words.length < TOKEN_BUFFER_HEADER + count * TOKEN_BUFFER_STRIDE) {
+        throw new Error('Truncated token buffer');
+    }
+
+    return { entries: words.subarray(TOKEN_BUFFER_HEADER), count, types: getTokenTypes(tableSize) };
+}
+
+/**
+ * Tokenize many snippets in a single native call, e.g. all code blocks of a
+ * chat screen. The results share one buffer, so the bridge overhead is paid
+ * once per batch instead of once per snippet.
+ *
+ * @param snippets - The code and language of each snippet
+ * @param options - Set `parallel` to spread the snippets over the native
+ * worker threads; the call still returns synchronously
+ * @returns One token stream per snippet, in order, as `tokenizeToBuffer` returns
+ *
+ * @example
+ * ```ts
+ * const buffers = tokenizeBatch(
+ *   blocks.map((block) => ({ code: block.code, language: block.language })),
+ *   { parallel: true }
+ * );
+ * ```
+ */
+export function tokenizeBatch(
+    snippets: { code: string; language: Language }[],
+    options?: { parallel?: boolean }
+): TokenBuffer[] {
+    const libPrisma = getLibPrisma();
+    const words = new Uint32Array(
+        libPrisma.tokenizeBatch(
+            snippets.map((snippet) => snippet.code),
+            snippets.map((snippet) => snippet.language),
+            options?.parallel ?? false
+        )
+    );
+
+    if (words[0] !== TOKEN_BATCH_VERSION) {
+        throw new Error(`Unsupported token batch version ${words[0]}`);
+    }
+
+    const snippetCount = words[1] ?? 0;
+    const tableSize = words[2] ?? 0;
+    const entriesStart = TOKEN_BUFFER_HEADER + snippetCount * TOKEN_BATCH_SNIPPET_FIELDS;
+
+    // Type ids are shared by all languages, one table serves the whole batch
+    const types = snippetCount > 0 ? getTokenTypes(tableSize) : [];
+
+    const buffers: TokenBuffer[] = [];
+    for (let i = 0; i < snippetCount; i++) {
+        const first = words[TOKEN_BUFFER_HEADER + i * TOKEN_BATCH_SNIPPET_FIELDS] ?? 0;
+        const count = words[TOKEN_BUFFER_HEADER + i * TOKEN_BATCH_SNIPPET_FIELDS + 1] ?? 0;
+        const begin = entriesStart + first * TOKEN_BUFFER_STRIDE;
+        const end = begin + count * TOKEN_BUFFER_STRIDE;
+
+        if (words.length < end) {
+            throw new Error('Truncated token batch');
+        }
+
+        buffers.push({ entries: words.subarray(begin, end), count, types });
+    }
+
+    return buffers;
+}
+
+/**
+ * Tokenize source code into runs that are ready to render: split per line,
+ * with every run carrying one style class instead of a nested token tree.
+ * Pair it with `getClassColors` to look up theme colors once per class.
+ *
+ * @param code - The source code to tokenize
+ * @param language - The language identifier (e.g., "javascript", "python", "cpp")
+ * @returns The runs of every line and the class table
+ *
+ * @example
+ * ```tsx
+ * const { lineStarts, lineCount, runs, runCount, classes } = tokenizeToLines(code, 'go');
+ * const colors = getClassColors(classes, themes.draculaTheme);
+ * for (let line = 0; line < lineCount; line++) {
+ *     const end = line + 1 < lineCount ? lineStarts[line + 1] : runCount;
+ *     for (let run = lineStarts[line]; run < end; run++) {
+ *         const base = run * TOKEN_RUN_STRIDE;
+ *         const text = code.substr(runs[base], runs[base + 1]);
+ *         const color = colors[runs[base + 2]];
+ *     }
+ * }
+ * ```
+ */
+export function tokenizeToLines(code: string, language: Language): TokenLines {
+    const words = new Uint32Array(getLibPrisma().tokenizeToLines(code, language));
+
+    if (words[0] !== TOKEN_LINES_VERSION) {
+        throw new Error(`Unsupported token lines version ${words[0]}`);
+    }
+
+    const lineCount = words[1] ?? 0;
+    const runCount = words[2] ?? 0;
+    const classCount = words[3] ?? 0;
+    const tableSize = words[4] ?? 0;
+    const runsStart = TOKEN_LINES_HEADER + lineCount;
+    const runsEnd = runsStart + runCount * TOKEN_RUN_STRIDE;
+
+    if (words.length < runsEnd + classCount) {
+        throw new Error('Truncated token lines');
+    }
+
+    const types = getTokenTypes(tableSize);
+    const classes: string[][] = [];
+    let at = runsEnd;
+    for (let i = 0; i < classCount; i++) {
+        const size = words[at++] ?? 0;
+        const names: string[] = [];
+        for (let j = 0; j < size; j++) {
+            names.push(types[words[at++] ?? 0] ?? '');
+        }
+        classes.push(names);
+    }
+
+    return {
+        lineStarts: words.subarray(TOKEN_LINES_HEADER, runsStart),
+        lineCount,
+        runs: words.subarray(runsStart, runsEnd),
+        runCount,
+        classes,
+    };
+}
+
+function getTokenTypes(tableSize: number): string[] {
+    if (tokenTypeTable.length < tableSize) {
+        tokenTypeTable = getLibPrisma().getTokenTypes();
+    }
+    return tokenTypeTable;
+}
+
+/**
+ * Set the memory budget of the native cache of `tokenize` and `tokenizeAsync`
+ * results (8 MB by default). Repeated snippets, e.g. from list recycling or
+ * navigating back, are then answered without tokenizing them again.
+ * The least recently used results are evicted first.
+ *
+ * @param bytes - Budget for the cached code and results, 0 disables the cache
+ */
+export function setCacheBudget(bytes: number): void {
+    getLibPrisma().setCacheBudget(bytes);
+}
+
+/**
+ * Drop all cached results, e.g. when the app receives a memory warning.
+ */
+export function clearCache(): void {
+    getLibPrisma().clearCache();
+}
+
+/**
+ * Hit and miss counters and memory use of the native result cache.
+ *
+ * @example
+ * ```ts
+ * const { hits, misses } = getCacheStats();
+ * console.log(`cache hit rate ${(hits / (hits + misses)) * 100}%`);
+ * ```
+ */
+export function getCacheStats(): CacheStats {
+    return JSON.parse(getLibPrisma().getCacheStats()) as CacheStats;
+}
+
+/**
+ * Turn per-pattern profiling of the native tokenizer on or off. Enabling it
+ * starts a new profile. Results served from the cache are not tokenized
+ * again, disable it with `setCacheBudget(0)` to profile repeated inputs.
+ *
+ * @param enabled Whether to profile the following tokenize calls
+ */
+export function setProfiling(enabled: boolean): void {
+    getLibPrisma().setProfiling(enabled);
+}
+
+/**
+ * Call counts, match counts and regex time of every grammar pattern run
+ * since profiling was enabled, the most expensive first.
+ *
+ * @example
+ * ```ts
+ * setProfiling(true);
+ * tokenize(code, 'php');
+ * for (const entry of getProfile().slice(0, 5)) {
+ *     console.log(`${entry.token}[${entry.pattern}] ${entry.time.toFixed(2)}ms`);
+ * }
+ * ```
+ */
+export function getProfile(): PatternProfile[] {
+    return JSON.parse(getLibPrisma().getProfile()) as PatternProfile[];
+}
+
+/**
+ * Split files of 256 KB and more into chunks that the native worker threads
+ * tokenize together, in `tokenize`, `tokenizeAsync`, `tokenizeToBuffer` and
+ * `tokenizeToLines`. Off by default. The seams between chunks are checked
+ * and tokenized again where they don't match, but a string or comment that
+ * is still open at a seam can in rare cases end up tokenized differently
+ * than in one piece.
+ *
+ * @param enabled Whether to split large files
+ */
+export function setParallelTokenize(enabled: boolean): void {
+    getLibPrisma().setParallelTokenize(enabled);
+}
+
+/**
+ * Name of the regex engine the native core was built with.
+ * Selected at build time, see `LIBPRISMA_REGEX_BACKEND`.
+ *
+ * @returns "boost" or "std"
+ */
+export function getRegexBackend(): string {
+    return getLibPrisma().getRegexBackend();
 }
 
 // Export types
-export type { Token, Language } from './types';
+export type {
+    Token,
+    Language,
+    TokenBuffer,
+    TokenChunk,
+    TokenLines,
+    CacheStats,
+    TokenizeLimits,
+    LimitedTokens,
+    PatternProfile,
+} from './types';
 
 // Export themes
 export * from './utils/themes';
@@ -12,8 +12,183 @@ export interface LibPrisma extends HybridObject<{ ios: 'c++'; android: 'c++' }>
     tokenizeToJson(code: string, language: string): string
 
     /**
-     * Load grammars from a base64-encoded gzipped string.
+     * Tokenize source code with bounds on the regex work, memory and
+     * nesting: at most `timeLimit` milliseconds, `maxSteps` regex engine
+     * steps, `maxBytes` bytes of token nodes and `maxDepth` levels of nested
+     * tokens, 0 for no limit. Returns a JSON object
+     * `{ limited, shallow, bytes, tokens }`. When the time or step limit is
+     * hit, tokens keeps the matches found until then and the rest of the
+     * code is plain text. Past the memory or depth limit, and for token types
+     * or aliases in `flatTypes`, matches are not tokenized inside.
+     */
+    tokenizeWithLimits(
+        code: string,
+        language: string,
+        timeLimit: number,
+        maxSteps: number,
+        maxBytes: number,
+        maxDepth: number,
+        flatTypes: string[]
+    ): string
+
+    /**
+     * Tokenize source code on a native worker thread.
+     * Resolves with the same JSON string as tokenizeToJson.
+     * `requestId` identifies the request for cancelTokenize.
+     */
+    tokenizeAsync(code: string, language: string, requestId: number): Promise<string>
+
+    /**
+     * Drop a pending tokenizeAsync request before it starts on a worker.
+     * The request's promise is rejected. Returns false if it already started.
+     */
+    cancelTokenize(requestId: number): boolean
+
+    /**
+     * Compile the patterns of languages on a native worker thread, so their
+     * first tokenize call does not pay for it. Unknown languages are skipped.
+     */
+    preloadLanguages(languages: string[]): Promise<void>
+
+    /**
+     * Open a document for incremental tokenization under a caller-chosen id.
+     * Returns the same JSON string as tokenizeToJson.
+     */
+    openDocument(documentId: number, code: string, language: string): string
+
+    /**
+     * Replace `deleteCount` UTF-16 code units at `offset` of an open document
+     * with `insertText`, re-tokenizing only the affected part.
+     * Returns a JSON object `{ start, deleteCount, tokens }` describing which
+     * top-level tokens of the previous result were replaced.
+     */
+    editDocument(documentId: number, offset: number, deleteCount: number, insertText: string): string
+
+    /**
+     * Release an open document. Returns false if it wasn't open.
+     */
+    closeDocument(documentId: number): boolean
+
+    /**
+     * Open a large text for streaming tokenization under a caller-chosen id.
+     */
+    openStream(streamId: number, code: string, language: string, linesPerChunk: number): void
+
+    /**
+     * Tokenize the next chunk of an open stream on a native worker thread.
+     * Resolves with a JSON object `{ offset, startLine, endLine, done, tokens }`:
+     * the top-level tokens starting at UTF-16 offset `offset`.
+     */
+    readStream(streamId: number): Promise<string>
+
+    /**
+     * Release an open stream. Returns false if it wasn't open.
+     */
+    closeStream(streamId: number): boolean
+
+    /**
+     * Tokenize lines [startLine, endLine) of a large text, resuming from the
+     * nearest cached checkpoint above them.
+     * Returns a JSON object `{ offset, startLine, endLine, tokens }`: the
+     * top-level tokens overlapping the lines, starting at UTF-16 offset `offset`.
+     */
+    tokenizeRange(code: string, language: string, startLine: number, endLine: number): string
+
+    /**
+     * Tokenize source code into a flat binary token stream.
+     * The buffer holds uint32 words: a header (version, entry count,
+     * token type table size) followed by one entry per token in pre-order
+     * (type id, alias id, start, length, depth).
+     */
+    tokenizeToBuffer(code: string, language: string): ArrayBuffer
+
+    /**
+     * Tokenize UTF-8 encoded source code into the token stream of
+     * tokenizeToBuffer. The ArrayBuffer is read in place, without copying it
+     * into a native string. Offsets are in UTF-16 code units of the decoded code.
+     */
+    tokenizeUtf8ToBuffer(code: ArrayBuffer, language: string): ArrayBuffer
+
+    /**
+     * Tokenize snippets `codes[i]` in `languages[i]` in one call, optionally
+     * spread over the native worker pool.
+     * The buffer holds uint32 words: a header (version, snippet count,
+     * token type table size), then (first entry, entry count) per snippet,
+     * then the entries of all snippets as in tokenizeToBuffer.
+     */
+    tokenizeBatch(codes: string[], languages: string[], parallel: boolean): ArrayBuffer
+
+    /**
+     * Tokenize source code into runs split per line, each with one style class.
+     * The buffer holds uint32 words: a header (version, line count, run count,
+     * class count, token type table size), the first run index of every line,
+     * then (start, length, class id) per run, then every class as a name
+     * count followed by that many token type ids, innermost token first.
+     */
+    tokenizeToLines(code: string, language: string): ArrayBuffer
+
+    /**
+     * Get the token type table, shared by all languages.
+     * Type and alias ids in buffers returned by tokenizeToBuffer index into it.
+     */
+    getTokenTypes(): string[]
+
+    /**
+     * Set the memory budget in bytes of the cache of tokenizeToJson and
+     * tokenizeAsync results. 0 disables the cache.
+     */
+    setCacheBudget(bytes: number): void
+
+    /**
+     * Drop all cached results, the counters are kept.
+     */
+    clearCache(): void
+
+    /**
+     * Counters of the result cache as a JSON object
+     * `{ hits, misses, entries, bytes, budget }`.
+     */
+    getCacheStats(): string
+
+    /**
+     * Turn per-pattern profiling of the tokenize calls on or off.
+     * Enabling it starts a new profile.
+     */
+    setProfiling(enabled: boolean): void
+
+    /**
+     * Counters of every pattern run since profiling was enabled as a JSON
+     * array of `{ language, token, pattern, regex, calls, matches, misses,
+     * rematches, time }`, the most expensive first.
+     */
+    getProfile(): string
+
+    /**
+     * Split code of 256 KB and more into chunks that the native worker
+     * threads tokenize together, off by default.
+     */
+    setParallelTokenize(enabled: boolean): void
+
+    /**
+     * Name of the regex engine the native core was built with ("boost" or "std").
+     */
+    getRegexBackend(): string
+
+    /**
+     * Load grammars from a base64-encoded gzipped grammar image.
      * This should be called once before using tokenizeToJson.
      */
     loadGrammars(grammars: string): void
+
+    /**
+     * Memory-map a grammar image (grammars.bin) from a file.
+     * Returns false if the file cannot be opened.
+     */
+    loadGrammarsFromFile(path: string): boolean
+
+    /**
+     * Memory-map the grammar image packaged with the app.
+     * Returns false if it is not available on this platform.
+     */
+    loadBundledGrammars(): boolean
 }
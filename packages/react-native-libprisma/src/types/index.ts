@@ -470,6 +470,206 @@ export interface Token {
   alias?: string;
 }
 
+/**
+ * Flat, pre-order token stream returned by `tokenizeToBuffer`.
+ * Every token occupies `TOKEN_BUFFER_STRIDE` consecutive words of `entries`:
+ * type id, alias id, start offset, length and nesting depth.
+ * Offsets and lengths are in UTF-16 code units of the tokenized string.
+ */
+export interface TokenBuffer {
+  /**
+   * Token entries, `TOKEN_BUFFER_STRIDE` words per token
+   */
+  entries: Uint32Array;
+
+  /**
+   * Number of tokens in `entries`
+   */
+  count: number;
+
+  /**
+   * Token type and alias names indexed by the ids stored in `entries`.
+   * Id 0 is the empty string (no alias) and id 1 is "text".
+   */
+  types: string[];
+}
+
+/**
+ * Render-ready runs returned by `tokenizeToLines`.
+ */
+export interface TokenLines {
+  /**
+   * Index of the first run of every line. The runs of line `i` end where
+   * those of line `i + 1` start, or at `runCount` for the last line.
+   */
+  lineStarts: Uint32Array;
+  lineCount: number;
+
+  /**
+   * `TOKEN_RUN_STRIDE` words per run: UTF-16 start offset and length in
+   * the code, without line breaks, and the class id
+   */
+  runs: Uint32Array;
+  runCount: number;
+
+  /**
+   * Style names of every class id: alias and type of the token a run is in,
+   * then those of the enclosing tokens. Class 0 is plain text.
+   */
+  classes: string[][];
+}
+
+/**
+ * A run of whole top-level tokens yielded by `tokenizeStream` or returned by
+ * `tokenizeRange`.
+ */
+export interface TokenChunk {
+  /**
+   * Top-level tokens of the chunk, same shape as `tokenize` returns
+   */
+  tokens: Token[];
+
+  /**
+   * UTF-16 offset of the first token in the streamed code
+   */
+  offset: number;
+
+  /**
+   * Zero-based lines of the chunk start and end. A chunk can end mid-line
+   * when a token spans a line break.
+   */
+  startLine: number;
+  endLine: number;
+}
+
+/**
+ * Counters of the native result cache returned by `getCacheStats`.
+ */
+export interface CacheStats {
+  /**
+   * Lookups answered from the cache, and lookups that tokenized
+   */
+  hits: number;
+  misses: number;
+
+  /**
+   * Number of cached results
+   */
+  entries: number;
+
+  /**
+   * Bytes of cached code and results, and their upper bound
+   */
+  bytes: number;
+  budget: number;
+}
+
+/**
+ * Bounds on the work, memory and nesting of one `tokenizeWithLimits` call.
+ * Omitted or 0 means no limit.
+ */
+export interface TokenizeLimits {
+  /**
+   * Milliseconds the call may take
+   */
+  timeLimit?: number;
+
+  /**
+   * Steps the regex engine may take over the code, summed over all
+   * patterns. Each move of the engine by one character is a step, so
+   * backtracking counts. Unlike `timeLimit` the result does not depend on
+   * the device.
+   */
+  maxSteps?: number;
+
+  /**
+   * Bytes the native token nodes may take. Past it, matches are no longer
+   * tokenized inside (e.g. code in a Markdown fence stays one token), so
+   * memory only grows with the top-level tokens.
+   */
+  maxBytes?: number;
+
+  /**
+   * Levels of nested tokens, 1 keeps only the top-level tokens. Deeper
+   * matches stay single tokens, so embedded grammars (e.g. JS in a PHP
+   * template) are not run.
+   */
+  maxDepth?: number;
+
+  /**
+   * Token types or aliases whose matches are not tokenized inside, e.g.
+   * `['script', 'style']` for markup previews
+   */
+  flatTypes?: string[];
+}
+
+/**
+ * Result of `tokenizeWithLimits`.
+ */
+export interface LimitedTokens {
+  /**
+   * Same shape as `tokenize` returns. When `limited` is set, the tokens
+   * matched before the limit was hit are kept and the rest of the code is
+   * plain text.
+   */
+  tokens: Token[];
+
+  /**
+   * Whether the time or step limit was hit
+   */
+  limited: boolean;
+
+  /**
+   * Whether the memory ceiling was hit, later matches were not tokenized
+   * inside
+   */
+  shallow: boolean;
+
+  /**
+   * Bytes the native token nodes took
+   */
+  bytes: number;
+}
+
+/**
+ * Counters of one grammar pattern returned by `getProfile`.
+ */
+export interface PatternProfile {
+  /**
+   * Language of the profiled calls, patterns of embedded grammars count
+   * for the language that embeds them
+   */
+  language: string;
+
+  /**
+   * Grammar token the pattern belongs to, and its index in the token
+   */
+  token: string;
+  pattern: number;
+
+  /**
+   * Regex source of the pattern
+   */
+  regex: string;
+
+  /**
+   * Regex searches, and how many of them found a match
+   */
+  calls: number;
+  matches: number;
+  misses: number;
+
+  /**
+   * Rematch passes started because a greedy match consumed other tokens
+   */
+  rematches: number;
+
+  /**
+   * Milliseconds spent in the regex searches
+   */
+  time: number;
+}
+
 
 export * from '../utils/themes';
 export type { ThemeName, PrismTheme } from '../utils/themes';
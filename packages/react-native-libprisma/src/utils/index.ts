@@ -1,6 +1,16 @@
-import type { Token } from '../types';
+import type { Token, TokenBuffer } from '../types';
 import type { PrismTheme } from './themes';
 
+/**
+ * Number of uint32 words per token in a `TokenBuffer`.
+ */
+export const TOKEN_BUFFER_STRIDE = 5;
+
+/**
+ * Number of uint32 words per run in `TokenLines.runs`.
+ */
+export const TOKEN_RUN_STRIDE = 3;
+
 /**
  * Gets the color for a token based on its type and alias.
  * Falls back to the theme's foreground color if no specific color is found.
@@ -201,3 +211,71 @@ export function countTokens(tokens: Token[]): number {
   tokens.forEach(countToken);
   return count;
 }
+
+/**
+ * Resolves the color of every class of `tokenizeToLines` output: the first
+ * name of the class that the theme has a color for, like nested tokens
+ * inherit the color of their parent. Falls back to the foreground color.
+ *
+ * @param classes - Class table of a `TokenLines` result
+ * @param theme - The theme to use
+ * @returns Color of every class id
+ *
+ * @example
+ * ```ts
+ * const colors = getClassColors(lines.classes, themes.peaceOfEyeTheme);
+ * const color = colors[lines.runs[run * TOKEN_RUN_STRIDE + 2]];
+ * ```
+ */
+export function getClassColors(classes: string[][], theme: PrismTheme): string[] {
+  return classes.map((names) => {
+    const name = names.find((candidate) => theme.colors[candidate]);
+    return name ? theme.colors[name]! : theme.colors.foreground;
+  });
+}
+
+/**
+ * Rebuilds the nested token tree from a flat token stream.
+ * The result has the same shape as the output of `tokenize`.
+ *
+ * @param buffer - Token stream returned by `tokenizeToBuffer`
+ * @param code - The source code that was tokenized
+ * @returns Array of tokens
+ *
+ * @example
+ * ```ts
+ * const tokens = tokenBufferToTokens(tokenizeToBuffer(code, 'go'), code);
+ * ```
+ */
+export function tokenBufferToTokens(buffer: TokenBuffer, code: string): Token[] {
+  const { entries, count, types } = buffer;
+  const root: Token[] = [];
+  // stack[depth] is the array receiving tokens of that depth
+  const stack: Token[][] = [root];
+
+  for (let i = 0; i < count; i++) {
+    const base = i * TOKEN_BUFFER_STRIDE;
+    const type = types[entries[base] ?? 0] ?? '';
+    const alias = types[entries[base + 1] ?? 0];
+    const start = entries[base + 2] ?? 0;
+    const length = entries[base + 3] ?? 0;
+    const depth = entries[base + 4] ?? 0;
+    const parent = stack[depth] ?? root;
+
+    // Syntax tokens are always followed by at least one child
+    const next = entries[base + TOKEN_BUFFER_STRIDE + 4];
+    if (i + 1 === count || next === undefined || next <= depth) {
+      parent.push({ type, content: code.substr(start, length) });
+      continue;
+    }
+
+    const children: Token[] = [];
+    const token: Token = alias
+      ? { type, alias, content: children }
+      : { type, content: children };
+    parent.push(token);
+    stack[depth + 1] = children;
+  }
+
+  return root;
+}
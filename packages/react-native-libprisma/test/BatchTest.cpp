@@ -0,0 +1,103 @@
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "TestSupport.hpp"
+
+namespace athex {
+namespace libprisma {
+namespace test {
+
+namespace {
+
+/**
+ * The entries of every snippet of a tokenizeBatch call against those of a
+ * tokenizeToBuffer call on its code alone
+ */
+void checkSnippets(const std::vector<std::string> &codes,
+                   const std::vector<std::string> &languages,
+                   const std::vector<std::string> &names, bool parallel) {
+  constexpr size_t table = Libprisma::TokenBatchFormat::headerFields;
+  constexpr size_t snippetFields = Libprisma::TokenBatchFormat::snippetFields;
+  constexpr size_t fields = Libprisma::TokenBufferFormat::entryFields;
+  const std::string what = parallel ? "parallel batch" : "batch";
+
+  const auto batch = gLibprisma->tokenizeBatch(codes, languages, parallel);
+  if (batch.size() < table + codes.size() * snippetFields ||
+      batch[0] != Libprisma::TokenBatchFormat::version ||
+      batch[1] != codes.size() || batch[2] != names.size()) {
+    fail(what, "malformed header");
+    return;
+  }
+
+  const uint32_t *entries = batch.data() + table + codes.size() * snippetFields;
+  const uint32_t *end = batch.data() + batch.size();
+  uint32_t next = 0;
+  for (size_t i = 0; i < codes.size(); ++i) {
+    const std::string name = what + " snippet " + std::to_string(i) + " (" +
+                             languages[i] + ")";
+    const uint32_t first = batch[table + i * snippetFields];
+    const uint32_t count = batch[table + i * snippetFields + 1];
+    if (first != next || entries + (first + count) * fields > end) {
+      fail(name, "malformed snippet table");
+      return;
+    }
+    next = first + count;
+
+    const auto single = gLibprisma->tokenizeToBuffer(codes[i], languages[i]);
+    const std::vector<uint32_t> expected(
+        single.begin() + Libprisma::TokenBufferFormat::headerFields, single.end());
+    const std::vector<uint32_t> actual(entries + first * fields,
+                                       entries + next * fields);
+    if (actual != expected) {
+      fail(name, std::to_string(count) + " entries instead of the " +
+                     std::to_string(single[1]) + " of tokenizeToBuffer, or "
+                     "different ones");
+    }
+  }
+
+  if (entries + next * fields != end) {
+    fail(what, "entries past the last snippet");
+  }
+}
+
+} // namespace
+
+/**
+ * tokenizeBatch against one tokenizeToBuffer call per snippet, serial and
+ * spread over the worker pool, with empty snippets and unknown languages
+ * in between
+ */
+void checkBatch() {
+  const auto names = gLibprisma->tokenTypes();
+
+  std::vector<std::string> codes;
+  std::vector<std::string> languages;
+  for (const auto &samples : {gSamples, utf8Samples()}) {
+    for (const auto &sample : samples) {
+      codes.push_back(sample.code);
+      languages.push_back(sample.language);
+    }
+  }
+  codes.insert(codes.begin() + 3, "");
+  languages.insert(languages.begin() + 3, "python");
+  codes.insert(codes.begin() + 7, "let x = 1;");
+  languages.insert(languages.begin() + 7, "no-such-language");
+
+  for (bool parallel : {false, true}) {
+    checkSnippets(codes, languages, names, parallel);
+    checkSnippets({}, {}, names, parallel);
+    checkSnippets({codes[0]}, {languages[0]}, names, parallel);
+  }
+
+  try {
+    gLibprisma->tokenizeBatch(codes, {languages[0]}, false);
+    fail("batch", "no error for more snippets than languages");
+  } catch (const std::invalid_argument &) {
+  }
+}
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
@@ -0,0 +1,82 @@
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "TestSupport.hpp"
+
+namespace athex {
+namespace libprisma {
+namespace test {
+
+namespace {
+
+/**
+ * tokenizeToBuffer against the token tree
+ */
+void checkBuffers(const std::vector<Sample> &samples, bool large) {
+  SyntaxHighlighter highlighter(gImage);
+  const auto names = gLibprisma->tokenTypes();
+  constexpr size_t fields = Libprisma::TokenBufferFormat::entryFields;
+
+  for (const auto &sample : samples) {
+    for (const auto &code : codes(sample, large)) {
+      std::string tree;
+      dumpLengths(highlighter, highlighter.tokenize(code, sample.language), tree);
+
+      const auto buffer = gLibprisma->tokenizeToBuffer(code, sample.language);
+      std::string actual;
+      if (buffer.size() < Libprisma::TokenBufferFormat::headerFields ||
+          buffer[0] != Libprisma::TokenBufferFormat::version ||
+          buffer[2] != names.size() ||
+          buffer.size() != Libprisma::TokenBufferFormat::headerFields + buffer[1] * fields ||
+          !decodeBuffer(buffer.data() + Libprisma::TokenBufferFormat::headerFields,
+                        buffer[1], names, utf16(code).size(), actual)) {
+        fail(sample.name, "malformed token buffer of " + std::to_string(code.size()) +
+                              " bytes");
+      } else if (actual != tree) {
+        fail(sample.name, "token buffer " + difference(tree, actual));
+      }
+    }
+  }
+}
+
+} // namespace
+
+/**
+ * The samples and their UTF-8 variants, large ones split into chunks
+ */
+void checkBuffer() {
+  gLibprisma->setParallelTokenize(true);
+  checkBuffers(gSamples, true);
+  checkBuffers(utf8Samples(), true);
+}
+
+/**
+ * tokenizeToBuffer on a view into a larger buffer, as tokenizeUtf8ToBuffer
+ * reads a JS ArrayBuffer in place, against a copy of the same code. The
+ * bytes around the view open a string and a comment, which would change
+ * the tokens if a pattern read past either end. The views end at the end of
+ * the code and at points inside its tokens.
+ */
+void checkBufferView() {
+  for (const auto &samples : {gSamples, utf8Samples()}) {
+    for (const auto &sample : samples) {
+      const std::string storage = "\"/*" + sample.code + "*/\"x";
+      for (size_t size : {sample.code.size(), sample.code.size() / 3,
+                          sample.code.size() / 2 + 1}) {
+        const std::string_view view(storage.data() + 3, size);
+        const auto expected =
+            gLibprisma->tokenizeToBuffer(std::string(view), sample.language);
+        if (gLibprisma->tokenizeToBuffer(view, sample.language) != expected) {
+          fail(sample.name, "token buffer of a view of " + std::to_string(size) +
+                                " bytes differs from a copy");
+        }
+      }
+    }
+  }
+}
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
@@ -0,0 +1,141 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ResultCache.hpp"
+#include "TestSupport.hpp"
+
+namespace athex {
+namespace libprisma {
+namespace test {
+
+namespace {
+
+/**
+ * Compare the counters of the cache, failing with what on a difference
+ */
+void expectStats(const ResultCache &cache, uint64_t hits, uint64_t misses,
+                 size_t entries, size_t bytes, const std::string &what) {
+  const auto stats = cache.stats();
+  if (stats.hits != hits || stats.misses != misses || stats.entries != entries ||
+      stats.bytes != bytes || stats.bytes > stats.budget) {
+    fail("cache", what + ": " + std::to_string(stats.hits) + " hits, " +
+                      std::to_string(stats.misses) + " misses, " +
+                      std::to_string(stats.entries) + " entries of " +
+                      std::to_string(stats.bytes) + " bytes instead of " +
+                      std::to_string(hits) + ", " + std::to_string(misses) +
+                      ", " + std::to_string(entries) + " of " +
+                      std::to_string(bytes));
+  }
+}
+
+/**
+ * Which of the codes the cache holds, a find counts as a hit or a miss
+ */
+std::string held(ResultCache &cache, const std::vector<std::string> &codes) {
+  std::string out;
+  for (const auto &code : codes) {
+    const auto result = cache.find(code, "text");
+    if (result && *result != "[" + code + "]") {
+      fail("cache", "wrong result for " + code.substr(0, 1));
+    }
+    out += result ? code.substr(0, 1) : "-";
+  }
+  return out;
+}
+
+/**
+ * Counter name of the JSON of cacheStats
+ */
+uint64_t counter(const std::string &stats, const std::string &name) {
+  const size_t pos = stats.find("\"" + name + "\":");
+  return pos == std::string::npos
+             ? UINT64_MAX
+             : std::stoull(stats.substr(pos + name.size() + 3));
+}
+
+} // namespace
+
+/**
+ * ResultCache evicting the least recently used entries to stay within its
+ * byte budget, and the counters of Libprisma's tokenizeToJson cache
+ */
+void checkCache() {
+  // Entries of the same size, four of them fit the budget
+  std::vector<std::string> codes;
+  for (char name : std::string("abcdef")) {
+    codes.push_back(name + std::string(1000, ' '));
+  }
+  ResultCache measure(1 << 20);
+  measure.insert(codes[0], "text", "[" + codes[0] + "]");
+  const size_t entry = measure.stats().bytes;
+
+  ResultCache cache(4 * entry);
+  for (size_t i = 0; i < 4; ++i) {
+    cache.insert(codes[i], "text", "[" + codes[i] + "]");
+  }
+  expectStats(cache, 0, 0, 4, 4 * entry, "filled");
+
+  // Using a moves it to the front, so b is evicted first and then c
+  if (held(cache, {codes[0]}) != "a") {
+    fail("cache", "a not held");
+  }
+  cache.insert(codes[4], "text", "[" + codes[4] + "]");
+  cache.insert(codes[5], "text", "[" + codes[5] + "]");
+  const auto after = held(cache, codes);
+  if (after != "a--def") {
+    fail("cache", "holds " + after + " instead of a--def");
+  }
+  expectStats(cache, 5, 2, 4, 4 * entry, "evicted");
+
+  // Inserting a held code again replaces its entry
+  cache.insert(codes[3], "text", "[" + codes[3] + "]");
+  expectStats(cache, 5, 2, 4, 4 * entry, "replaced");
+
+  // The same code in another language is another entry
+  if (cache.find(codes[0], "other")) {
+    fail("cache", "found a in another language");
+  }
+
+  // Results larger than the budget are not stored
+  const std::string large(4 * entry, 'x');
+  cache.insert(large, "text", "[" + large + "]");
+  expectStats(cache, 5, 3, 4, 4 * entry, "too large");
+
+  // A smaller budget evicts the least recently used: d was inserted again
+  // last, f found right before
+  cache.setBudget(2 * entry);
+  const auto shrunk = held(cache, codes);
+  if (shrunk != "---d-f") {
+    fail("cache", "holds " + shrunk + " instead of ---d-f after shrinking");
+  }
+  expectStats(cache, 7, 7, 2, 2 * entry, "shrunk");
+
+  cache.clear();
+  expectStats(cache, 7, 7, 0, 0, "cleared");
+
+  cache.setBudget(0);
+  cache.insert(codes[0], "text", "[" + codes[0] + "]");
+  expectStats(cache, 7, 7, 0, 0, "disabled");
+
+  // Libprisma serves the second call from its cache
+  const Sample &sample = gSamples.front();
+  gLibprisma->setCacheBudget(1 << 20);
+  gLibprisma->clearCache();
+  const auto before = gLibprisma->cacheStats();
+  const auto first = gLibprisma->tokenizeToJson(sample.code, sample.language);
+  const auto second = gLibprisma->tokenizeToJson(sample.code, sample.language);
+  const auto stats = gLibprisma->cacheStats();
+  if (first != second) {
+    fail(sample.name, "cached result differs");
+  }
+  if (counter(stats, "hits") != counter(before, "hits") + 1 ||
+      counter(stats, "misses") != counter(before, "misses") + 1 ||
+      counter(stats, "entries") != 1 || counter(stats, "budget") != 1 << 20) {
+    fail(sample.name, "cache stats " + stats + " after " + before);
+  }
+}
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
@@ -0,0 +1,87 @@
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "TestSupport.hpp"
+
+namespace athex {
+namespace libprisma {
+namespace test {
+
+namespace {
+
+constexpr size_t kThreads = 8;
+constexpr size_t kRounds = 3;
+
+/**
+ * Tokenize the sample of each thread on one highlighter, all threads
+ * starting at once, and compare each result to expected
+ */
+void tokenizeTogether(SyntaxHighlighter &highlighter,
+                      const std::vector<const Sample *> &samples,
+                      const std::vector<std::string> &expected) {
+  std::atomic<size_t> ready{0};
+  std::vector<std::string> dumps(samples.size());
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < samples.size(); ++i) {
+    threads.emplace_back([&, i] {
+      ++ready;
+      while (ready.load() < samples.size()) {
+        std::this_thread::yield();
+      }
+      const Sample &sample = *samples[i];
+      dumps[i] = dump(highlighter, highlighter.tokenize(sample.code, sample.language));
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (size_t i = 0; i < samples.size(); ++i) {
+    if (dumps[i] != expected[i]) {
+      fail(samples[i]->name, "thread " + std::to_string(i) + " on a cold tree " +
+                                 difference(expected[i], dumps[i]));
+    }
+  }
+}
+
+} // namespace
+
+/**
+ * Threads that tokenize on a highlighter whose grammars are not built yet,
+ * the same language at once and then every language at once, against one
+ * thread on a highlighter of its own. Run under -fsanitize=thread to check
+ * the build and pattern locks of LanguageTree.
+ */
+void checkConcurrency() {
+  std::vector<std::string> serial;
+  {
+    SyntaxHighlighter highlighter(gImage);
+    for (const auto &sample : gSamples) {
+      serial.push_back(dump(highlighter, highlighter.tokenize(sample.code, sample.language)));
+    }
+  }
+
+  for (size_t round = 0; round < kRounds; ++round) {
+    for (size_t s = 0; s < gSamples.size(); ++s) {
+      SyntaxHighlighter highlighter(gImage);
+      tokenizeTogether(highlighter, std::vector<const Sample *>(kThreads, &gSamples[s]),
+                       std::vector<std::string>(kThreads, serial[s]));
+    }
+
+    // Languages that share grammars through inside build them at once
+    SyntaxHighlighter highlighter(gImage);
+    std::vector<const Sample *> samples;
+    std::vector<std::string> expected;
+    for (size_t s = 0; s < gSamples.size(); ++s) {
+      samples.push_back(&gSamples[s]);
+      expected.push_back(serial[s]);
+    }
+    tokenizeTogether(highlighter, samples, expected);
+  }
+}
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
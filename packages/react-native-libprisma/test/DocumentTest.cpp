@@ -0,0 +1,73 @@
+#include <cctype>
+#include <string>
+#include <vector>
+
+#include "TestSupport.hpp"
+#include "TokenDocument.hpp"
+
+namespace athex {
+namespace libprisma {
+namespace test {
+
+/**
+ * Incremental edits of a TokenDocument against tokenizing the edited text
+ * from scratch, on the samples and on them repeated past the text that an
+ * edit window is tokenized with. The edits add and remove letters all over
+ * the code, inside words so that they change tokens but no lookahead of a
+ * token before the edited lines.
+ */
+void checkDocument() {
+  SyntaxHighlighter highlighter(gImage);
+  for (const auto &sample : gSamples) {
+    const auto tokenize = documentTokenizer(highlighter, sample.language);
+    for (const auto &code : {sample.code, repeated(sample.code, 64 * 1024)}) {
+      TokenDocument document(code, tokenize);
+
+      const size_t step = code.size() / 16 + 1;
+      for (size_t edit = 0; edit < 32; ++edit) {
+        const std::string &text = document.text();
+        const auto letter = [&](size_t i) {
+          return i < text.size() && std::isalnum(static_cast<unsigned char>(text[i]));
+        };
+        size_t offset = (edit * step + edit * 7) % text.size();
+        while (offset < text.size() &&
+               !(letter(offset - 1) && letter(offset) && letter(offset + 1))) {
+          ++offset;
+        }
+        if (offset == text.size()) {
+          continue;
+        }
+
+        const bool insert = edit % 2 == 0;
+        if (insert) {
+          document.edit(offset, 0, edit % 4 == 0 ? "x" : "yz", tokenize);
+        } else {
+          document.edit(offset, 1, "", tokenize);
+        }
+
+        const TokenDocument fresh(document.text(), tokenize);
+        const auto &actual = document.segments();
+        const auto &expected = fresh.segments();
+        size_t i = 0;
+        while (i < actual.size() && i < expected.size() &&
+               actual[i].start == expected[i].start &&
+               actual[i].length == expected[i].length &&
+               actual[i].json == expected[i].json) {
+          ++i;
+        }
+        if (i < actual.size() || i < expected.size()) {
+          fail(sample.name, std::to_string(code.size()) + " bytes, edit " +
+                                std::to_string(edit) + " at " +
+                                std::to_string(offset) + ": top-level token " +
+                                std::to_string(i) + " of " +
+                                std::to_string(expected.size()) + " differs");
+          break;
+        }
+      }
+    }
+  }
+}
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
@@ -0,0 +1,42 @@
+#include <filesystem>
+#include <string>
+
+#include "TestSupport.hpp"
+
+namespace athex {
+namespace libprisma {
+namespace test {
+
+/**
+ * golden/ holds the tokenizeToJson output of the baseline tokenizer, which
+ * ran on std::regex, for every sample. The std backend has to reproduce it
+ * byte for byte. Boost.Regex honors the "m" flag of the macro and decorator
+ * patterns and compiles C# patterns that std::regex rejects, so the samples
+ * that use them have their Boost output in golden/boost/.
+ */
+void checkGolden() {
+  const std::filesystem::path golden(LIBPRISMA_GOLDEN_DIR);
+  const std::filesystem::path backend = golden / Libprisma::regexBackend();
+
+  // Every sample is tokenized, not served from the cache
+  gLibprisma->setCacheBudget(0);
+  for (const auto &sample : gSamples) {
+    const std::string file = sample.name + ".json";
+    const std::string expected = std::filesystem::exists(backend / file)
+                                     ? readFile(backend / file)
+                                     : readFile(golden / file);
+    if (expected.empty()) {
+      fail(sample.name, "no golden output");
+      continue;
+    }
+
+    const std::string actual = gLibprisma->tokenizeToJson(sample.code, sample.language);
+    if (expected != actual) {
+      fail(sample.name, difference(expected, actual));
+    }
+  }
+}
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
@@ -0,0 +1,162 @@
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "TestSupport.hpp"
+
+namespace athex {
+namespace libprisma {
+namespace test {
+
+namespace {
+
+// Tables of the header, see GrammarImage.h
+enum Table { Patterns, Grammars, Tokens, Indices, Languages, Names };
+constexpr size_t kRecordWords[] = {5, 2, 3, 1, 5, 2};
+
+uint32_t word(const std::string &bytes, size_t offset) {
+  uint32_t value;
+  std::memcpy(&value, bytes.data() + offset, sizeof(value));
+  return value;
+}
+
+void setWord(std::string &bytes, size_t offset, uint32_t value) {
+  std::memcpy(&bytes[offset], &value, sizeof(value));
+}
+
+uint32_t count(const std::string &bytes, Table table) {
+  return word(bytes, 8 + table * 8);
+}
+
+/**
+ * Offset of the word at index in the record id of table
+ */
+size_t field(const std::string &bytes, Table table, size_t id, size_t index) {
+  return word(bytes, 12 + table * 8) + (id * kRecordWords[table] + index) * sizeof(uint32_t);
+}
+
+/**
+ * Lowest free descriptor, which is taken by any descriptor left open
+ */
+int freeDescriptor() {
+#ifndef _WIN32
+  const int fd = open("/dev/null", O_RDONLY);
+  close(fd);
+  return fd;
+#else
+  return 0;
+#endif
+}
+
+struct Corruption {
+  const char *name;
+  std::function<void(std::string &)> apply;
+};
+
+} // namespace
+
+/**
+ * Images with a table, string or reference between records out of range
+ * throw at load, from bytes as well as from a file, instead of being read
+ * out of bounds by LanguageTree later
+ */
+void checkImage() {
+  const std::string image = readFile(gGrammarsPath);
+  const auto set = [](Table table, size_t index, uint32_t value) {
+    return [=](std::string &bytes) { setWord(bytes, field(bytes, table, 0, index), value); };
+  };
+
+  const std::vector<Corruption> corruptions = {
+      {"truncated to the header", [](std::string &bytes) { bytes.resize(16); }},
+      {"truncated to half", [](std::string &bytes) { bytes.resize(bytes.size() / 2); }},
+      {"magic", [](std::string &bytes) { setWord(bytes, 0, 0); }},
+      {"version", [](std::string &bytes) { setWord(bytes, 4, 99); }},
+      {"pattern count", [](std::string &bytes) { setWord(bytes, 8, 0x7FFFFFFF); }},
+      {"string pool", [](std::string &bytes) { setWord(bytes, 60, 0x7FFFFFFF); }},
+      {"text name", [](std::string &bytes) { setWord(bytes, field(bytes, Names, 1, 1), 0); }},
+      {"single name", [](std::string &bytes) { setWord(bytes, 8 + Names * 8, 1); }},
+      {"name string", set(Names, 0, 0x7FFFFFFF)},
+      {"pattern regex", set(Patterns, 1, 0x7FFFFFFF)},
+      {"pattern alias", [](std::string &bytes) {
+         setWord(bytes, field(bytes, Patterns, 0, 2), count(bytes, Names));
+       }},
+      {"pattern inside", [](std::string &bytes) {
+         setWord(bytes, field(bytes, Patterns, 0, 3), count(bytes, Grammars));
+       }},
+      {"grammar tokens", [](std::string &bytes) {
+         setWord(bytes, field(bytes, Grammars, 0, 0), count(bytes, Tokens));
+         setWord(bytes, field(bytes, Grammars, 0, 1), 1);
+       }},
+      {"grammar token overflow", [](std::string &bytes) {
+         setWord(bytes, field(bytes, Grammars, 0, 0), 0xFFFFFFFF);
+         setWord(bytes, field(bytes, Grammars, 0, 1), 2);
+       }},
+      {"token name", [](std::string &bytes) {
+         setWord(bytes, field(bytes, Tokens, 0, 0), count(bytes, Names));
+       }},
+      {"token indices", [](std::string &bytes) {
+         setWord(bytes, field(bytes, Tokens, 0, 1), count(bytes, Indices));
+         setWord(bytes, field(bytes, Tokens, 0, 2), 1);
+       }},
+      {"pattern index", [](std::string &bytes) {
+         setWord(bytes, field(bytes, Indices, 0, 0), count(bytes, Patterns));
+       }},
+      {"language name", set(Languages, 0, 0x7FFFFFFF)},
+      {"language grammar", [](std::string &bytes) {
+         setWord(bytes, field(bytes, Languages, 0, 4), count(bytes, Grammars));
+       }},
+  };
+
+  if (GrammarImage::fromBytes(image) == nullptr) {
+    fail("image", "the intact image does not load");
+  }
+
+  const auto path = std::filesystem::temp_directory_path() / "libprisma_corrupt.bin";
+  for (const auto &corruption : corruptions) {
+    std::string bytes = image;
+    corruption.apply(bytes);
+
+    try {
+      GrammarImage::fromBytes(bytes);
+      fail(corruption.name, "loaded from bytes");
+    } catch (const std::runtime_error &) {
+    }
+
+    std::ofstream(path, std::ios::binary).write(bytes.data(), bytes.size());
+    const int fd = freeDescriptor();
+    try {
+      GrammarImage::fromFile(path.string());
+      fail(corruption.name, "loaded from a file");
+    } catch (const std::runtime_error &) {
+    }
+    if (freeDescriptor() != fd) {
+      fail(corruption.name, "the file stays open");
+    }
+
+    // Libprisma stays without grammars and can load a valid image after
+    Libprisma libprisma;
+    try {
+      libprisma.loadGrammarsFromFile(path.string());
+      fail(corruption.name, "loaded by Libprisma");
+    } catch (const std::runtime_error &) {
+    }
+    if (libprisma.highlighter() != nullptr || !libprisma.loadGrammarsFromFile(gGrammarsPath)) {
+      fail(corruption.name, "Libprisma cannot load grammars after it");
+    }
+  }
+  std::filesystem::remove(path);
+}
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
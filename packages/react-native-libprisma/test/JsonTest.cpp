@@ -0,0 +1,169 @@
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "JsonWriter.hpp"
+#include "TestSupport.hpp"
+
+namespace athex {
+namespace libprisma {
+namespace test {
+
+// Escaping of the scalar JsonWriter, ScalarJsonWriter.cpp
+std::string scalarEscaped(std::string_view text);
+
+namespace {
+
+/**
+ * escapeJson of the tokenizer before JsonWriter, but for the control
+ * characters without a short escape, which it copied as they are and JSON
+ * does not allow in a string
+ */
+std::string escapeJson(std::string_view str) {
+  std::stringstream escaped;
+  for (char c : str) {
+    switch (c) {
+    case '"':
+      escaped << "\\\"";
+      break;
+    case '\\':
+      escaped << "\\\\";
+      break;
+    case '\b':
+      escaped << "\\b";
+      break;
+    case '\f':
+      escaped << "\\f";
+      break;
+    case '\n':
+      escaped << "\\n";
+      break;
+    case '\r':
+      escaped << "\\r";
+      break;
+    case '\t':
+      escaped << "\\t";
+      break;
+    default:
+      if (static_cast<unsigned char>(c) < 0x20) {
+        static constexpr char hex[] = "0123456789abcdef";
+        escaped << "\\u00" << hex[c >> 4] << hex[c & 0xF];
+      } else {
+        escaped << c;
+      }
+      break;
+    }
+  }
+  return escaped.str();
+}
+
+/**
+ * tokensToJson of the tokenizer before JsonWriter
+ */
+std::string tokensToJson(const SyntaxHighlighter &highlighter,
+                         const TokenList &tokens) {
+  std::stringstream json;
+  json << "[";
+  bool first = true;
+  for (const auto &node : tokens) {
+    if (!first)
+      json << ",";
+    first = false;
+
+    json << "{";
+    if (node.isSyntax()) {
+      const auto &syntax = static_cast<const Syntax &>(node);
+      json << "\"type\":\"" << escapeJson(highlighter.tokenName(syntax.type()))
+           << "\"";
+      if (syntax.alias() != TokenNames::None) {
+        json << ",\"alias\":\""
+             << escapeJson(highlighter.tokenName(syntax.alias())) << "\"";
+      }
+      const TokenList &nested = syntax.children();
+      if (nested.begin() != nested.end()) {
+        json << ",\"content\":" << tokensToJson(highlighter, nested);
+      } else {
+        json << ",\"content\":\"\"";
+      }
+    } else {
+      json << "\"type\":\"text\",\"content\":\""
+           << escapeJson(static_cast<const Text &>(node).value()) << "\"";
+    }
+    json << "}";
+  }
+  json << "]";
+  return json.str();
+}
+
+/**
+ * Escape text with the JsonWriter of the core and the scalar one
+ */
+void checkEscaped(const std::string &text, const std::string &what) {
+  const auto expected = escapeJson(text);
+  JsonWriter out;
+  out.escaped(text);
+  const auto actual = out.take();
+  if (actual != expected) {
+    fail("json", what + ": " + difference(expected, actual));
+  }
+  const auto scalar = scalarEscaped(text);
+  if (scalar != expected) {
+    fail("json", what + " scalar: " + difference(expected, scalar));
+  }
+}
+
+} // namespace
+
+/**
+ * JsonWriter against the escaping and token JSON of the tokenizer before
+ * it, with and without the vector scan: every byte that needs escaping at
+ * every position of a vector block, multibyte UTF-8 across block ends, and
+ * tokensToJson on the samples and on code full of quotes, backslashes and
+ * control characters
+ */
+void checkJson() {
+  const std::vector<std::string> specials = {
+      std::string(1, '\0'), "\x01", "\x1F", "\"", "\\", "\b", "\f", "\n",
+      "\r",                 "\t",   "\x7F", "\xC3\xA9", "\xE6\x97\xA5",
+      "\xF0\x9F\x98\x80",
+  };
+  for (const auto &special : specials) {
+    for (size_t before = 0; before < 40; ++before) {
+      const std::string text =
+          std::string(before, 'a') + special + std::string(40 - before, 'b');
+      checkEscaped(text, "byte " + std::to_string(
+                                       static_cast<unsigned char>(special[0])) +
+                             " after " + std::to_string(before));
+    }
+  }
+
+  std::string bytes;
+  for (int c = 0; c < 256; ++c) {
+    bytes += static_cast<char>(c);
+  }
+  checkEscaped(bytes, "all bytes");
+  checkEscaped("", "empty");
+
+  SyntaxHighlighter highlighter(gImage);
+  std::vector<Sample> samples = gSamples;
+  for (const auto &sample : utf8Samples()) {
+    samples.push_back(sample);
+  }
+  samples.push_back({"javascript/escapes", "javascript",
+                     "const s = \"a\\\"b\\\\c\\n\";\n// \x01\x02 \t\x1F\r\n"
+                     "const t = `\xC3\xA9\xE6\x97\xA5\xF0\x9F\x98\x80 ${s}`;\n"
+                     "/* \"\\\\\" */ let u = '\\u0000\f';\n"});
+  for (const auto &sample : samples) {
+    const auto tokens = highlighter.tokenize(sample.code, sample.language);
+    const auto expected = tokensToJson(highlighter, tokens);
+    const auto actual = gLibprisma->tokensToJson(tokens);
+    if (actual != expected) {
+      fail(sample.name, difference(expected, actual));
+    }
+  }
+}
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
@@ -0,0 +1,96 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "TestSupport.hpp"
+
+using namespace athex::libprisma;
+using namespace athex::libprisma::test;
+
+// Runs one check of the core, named on the command line, on the samples of
+// the example app. Most checks tokenize the same code two ways and report
+// every sample where the results differ.
+namespace {
+
+std::string envOr(const char *name, const char *fallback) {
+  const char *value = std::getenv(name);
+  return value != nullptr && *value != '\0' ? value : fallback;
+}
+
+struct Check {
+  const char *name;
+  void (*run)();
+};
+
+// Run by name, one ctest test each, see CMakeLists.txt
+const Check kChecks[] = {
+    {"golden", checkGolden},
+    {"reference", [] { checkReference(gSamples); }},
+    {"utf8", [] { checkReference(utf8Samples()); }},
+    {"document", checkDocument},
+    {"parallel", checkParallel},
+    {"buffer", checkBuffer},
+    {"batch", checkBatch},
+    {"lines", checkLines},
+    {"stream", checkStream},
+    {"range", checkRange},
+    {"cache", checkCache},
+    {"prefilter", checkPrefilter},
+    {"literals", checkLiterals},
+    {"profile", checkProfile},
+    {"json", checkJson},
+    {"objects", checkObjects},
+    {"view", checkBufferView},
+    {"steps", checkSteps},
+    {"memory", checkMemory},
+    {"depth", checkDepth},
+    {"image", checkImage},
+    {"workers", checkWorkers},
+    {"concurrency", checkConcurrency},
+    {"preload", checkPreload},
+};
+
+} // namespace
+
+int main(int argc, char **argv) {
+  gGrammarsPath = envOr("LIBPRISMA_GRAMMARS", LIBPRISMA_GRAMMARS_PATH);
+  const std::string &grammars = gGrammarsPath;
+  const std::string samplesDir = envOr("LIBPRISMA_SAMPLES", LIBPRISMA_SAMPLES_DIR);
+
+  gImage = GrammarImage::fromFile(grammars);
+  gLibprisma = std::make_unique<Libprisma>();
+  if (gImage == nullptr || !gLibprisma->loadGrammarsFromFile(grammars)) {
+    std::fprintf(stderr, "Cannot load grammars from %s\n", grammars.c_str());
+    return 1;
+  }
+
+  gSamples = loadSamples(samplesDir);
+  if (gSamples.empty()) {
+    std::fprintf(stderr, "No samples in %s\n", samplesDir.c_str());
+    return 1;
+  }
+
+  const std::string name = argc > 1 ? argv[1] : "";
+  const Check *check = nullptr;
+  std::string usage;
+  for (const auto &candidate : kChecks) {
+    if (name == candidate.name) {
+      check = &candidate;
+    }
+    usage += usage.empty() ? "" : "|";
+    usage += candidate.name;
+  }
+  if (check == nullptr) {
+    std::fprintf(stderr, "Usage: %s %s\n", argv[0], usage.c_str());
+    return 1;
+  }
+  check->run();
+
+  std::printf("%s: %zu failures\n", check->name, failures());
+  return failures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,306 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "JsonWriter.hpp"
+#include "MatchBudget.h"
+#include "Regex.h"
+#include "TestSupport.hpp"
+
+namespace athex {
+namespace libprisma {
+namespace test {
+
+namespace {
+
+/**
+ * Text the tokens cover, which is the code whatever limit was hit
+ */
+void coveredText(const TokenList &tokens, std::string &out) {
+  for (const auto &node : tokens) {
+    if (node.isSyntax()) {
+      coveredText(static_cast<const Syntax &>(node).children(), out);
+    } else {
+      out += static_cast<const Text &>(node).value();
+    }
+  }
+}
+
+/**
+ * Tokenize with limits, failing if the tokens do not cover the code
+ */
+TokenList tokenizeWithin(SyntaxHighlighter &highlighter, const Sample &sample,
+                         const TokenizeLimits &limits, TokenizeStats &stats) {
+  TokenList tokens = highlighter.tokenize(sample.code, sample.language, limits, stats);
+  std::string text;
+  coveredText(tokens, text);
+  if (text != sample.code) {
+    fail(sample.name, "tokens within limits do not cover the code, " +
+                          difference(sample.code, text));
+  }
+  return tokens;
+}
+
+/**
+ * Levels of nested tokens, 1 for top-level tokens with only text inside
+ */
+size_t depth(const TokenList &tokens) {
+  size_t levels = 0;
+  for (const auto &node : tokens) {
+    if (node.isSyntax()) {
+      levels = std::max(levels, 1 + depth(static_cast<const Syntax &>(node).children()));
+    }
+  }
+  return levels;
+}
+
+/**
+ * Tokens of a TokenList and all lists nested in it
+ */
+size_t count(const TokenList &tokens) {
+  size_t nodes = 0;
+  for (const auto &node : tokens) {
+    ++nodes;
+    if (node.isSyntax()) {
+      nodes += count(static_cast<const Syntax &>(node).children());
+    }
+  }
+  return nodes;
+}
+
+/**
+ * Type, alias and length of the top-level tokens, one line each
+ */
+std::string topLevel(const TokenList &tokens) {
+  std::string out;
+  for (const auto &node : tokens) {
+    if (node.isSyntax()) {
+      const auto &syntax = static_cast<const Syntax &>(node);
+      out += std::to_string(syntax.type()) + " " + std::to_string(syntax.alias()) + " ";
+    }
+    out += std::to_string(node.length()) + "\n";
+  }
+  return out;
+}
+
+/**
+ * Tokens of a type or alias in ids that hold more than one text node,
+ * counting the ones that hold just that in flat
+ */
+size_t notFlat(const TokenList &tokens, const std::vector<uint32_t> &ids, size_t &flat) {
+  size_t found = 0;
+  for (const auto &node : tokens) {
+    if (!node.isSyntax()) {
+      continue;
+    }
+    const auto &syntax = static_cast<const Syntax &>(node);
+    const auto &children = syntax.children();
+    const auto listed = [&](uint32_t id) {
+      return std::find(ids.begin(), ids.end(), id) != ids.end();
+    };
+    if (listed(syntax.type()) || listed(syntax.alias())) {
+      const bool single = children.length == 1 && !(*children.begin()).isSyntax();
+      found += single ? 0 : 1;
+      flat += single ? 1 : 0;
+    }
+    found += notFlat(children, ids, flat);
+  }
+  return found;
+}
+
+} // namespace
+
+/**
+ * Step and time limits: a search that backtracks catastrophically stops at
+ * the step budget or the deadline, and tokenize calls that hit a limit keep
+ * their tokens so far and plain text for the rest
+ */
+void checkSteps() {
+  // (?:a+)+b tries every split of the a's before it gives up at the !
+  const std::string text = std::string(40, 'a') + "!b";
+  const Regex regex("(?:a+)+b", RegexFlags::None);
+  {
+    TokenizeLimits limits;
+    limits.maxSteps = 10000;
+    MatchBudget budget(limits);
+    RegexMatch match;
+    if (regex.search(text.data(), text.data() + text.size(), match, &budget) ||
+        !budget.exhausted() || budget.steps() != limits.maxSteps) {
+      fail("backtracking", "stopped after " + std::to_string(budget.steps()) +
+                               " steps, the budget is " +
+                               std::to_string(limits.maxSteps));
+    }
+  }
+  {
+    TokenizeLimits limits;
+    limits.timeLimit = std::chrono::milliseconds(20);
+    MatchBudget budget(limits);
+    RegexMatch match;
+    if (regex.search(text.data(), text.data() + text.size(), match, &budget) ||
+        !budget.exhausted()) {
+      fail("backtracking", "did not stop at the deadline");
+    }
+  }
+
+  SyntaxHighlighter highlighter(gImage);
+  for (const auto &sample : gSamples) {
+    TokenizeLimits limits;
+    TokenizeStats stats;
+
+    // A budget the call does not reach changes nothing
+    limits.maxSteps = UINT64_MAX / 2;
+    const auto full = dump(highlighter, highlighter.tokenize(sample.code, sample.language));
+    const auto unlimited =
+        dump(highlighter, tokenizeWithin(highlighter, sample, limits, stats));
+    if (stats.limited || unlimited != full) {
+      fail(sample.name, "tokens within an ample budget " + difference(full, unlimited));
+    }
+
+    // Part of the code is tokenized
+    limits.maxSteps = 2000;
+    tokenizeWithin(highlighter, sample, limits, stats);
+    if (!stats.limited) {
+      fail(sample.name, "not limited by 2000 steps");
+    }
+
+    // Nothing is, the code is one text token
+    limits.maxSteps = 1;
+    const auto tokens = tokenizeWithin(highlighter, sample, limits, stats);
+    if (!stats.limited || tokens.begin() == tokens.end() ||
+        std::next(tokens.begin()) != tokens.end() || tokens.begin()->isSyntax()) {
+      fail(sample.name, "more than one text token within a budget of 1 step");
+    }
+
+    JsonWriter expected;
+    expected.raw("{\"limited\":true,\"shallow\":false,\"bytes\":");
+    expected.raw(std::to_string(stats.bytes));
+    expected.raw(",\"tokens\":[{\"type\":\"text\",\"content\":");
+    expected.string(sample.code);
+    expected.raw("}]}");
+    if (gLibprisma->tokenizeWithLimits(sample.code, sample.language, limits) !=
+        expected.take()) {
+      fail(sample.name, "tokenizeWithLimits within a budget of 1 step");
+    }
+  }
+}
+
+/**
+ * Memory limit: the bytes of the token nodes are reported, and past the
+ * limit matches are no longer tokenized inside. With a limit below the
+ * first node no match is, every token holds only text.
+ */
+void checkMemory() {
+  SyntaxHighlighter highlighter(gImage);
+  for (const auto &sample : gSamples) {
+    TokenizeLimits limits;
+    TokenizeStats stats;
+
+    limits.maxBytes = SIZE_MAX / 2;
+    const TokenList full = tokenizeWithin(highlighter, sample, limits, stats);
+    const size_t bytes = stats.bytes;
+    if (stats.shallow || bytes == 0) {
+      fail(sample.name, "full tokens of " + std::to_string(bytes) + " bytes are shallow");
+    }
+    if (dump(highlighter, full) != dump(highlighter, highlighter.tokenize(sample.code, sample.language))) {
+      fail(sample.name, "tokens below the memory limit differ from tokenize");
+    }
+
+    // Patterns run in grammar order, so the ones with tokens inside mostly
+    // match while the nodes still fit the first block of the arena
+    limits.maxBytes = 4 * 1024;
+    const TokenList shallow = tokenizeWithin(highlighter, sample, limits, stats);
+    if (stats.shallow ? stats.bytes > bytes || count(shallow) >= count(full)
+                      : dump(highlighter, shallow) != dump(highlighter, full)) {
+      fail(sample.name, "a memory limit of 4 KB took " + std::to_string(stats.bytes) +
+                            " bytes of " + std::to_string(bytes));
+    }
+
+    limits.maxBytes = 1;
+    const TokenList flat = tokenizeWithin(highlighter, sample, limits, stats);
+    if (depth(flat) > 1 || (depth(full) > 1 && !stats.shallow)) {
+      fail(sample.name, "tokenized inside past a memory limit of 1 byte");
+    }
+
+    const auto json = gLibprisma->tokenizeWithLimits(sample.code, sample.language, limits);
+    const auto expected = std::string(depth(full) > 1 ? "{\"limited\":false,\"shallow\":true"
+                                                      : "{\"limited\":false,\"shallow\":false") +
+                          ",\"bytes\":" + std::to_string(stats.bytes) + ",";
+    if (json.compare(0, expected.size(), expected) != 0) {
+      fail(sample.name, "tokenizeWithLimits past the memory limit starts with " +
+                            json.substr(0, expected.size()));
+    }
+  }
+}
+
+/**
+ * Depth limit and flat tokens: maxDepth 1 keeps the top-level tokens of
+ * tokenize with only text inside, and tokens of a flat type or alias hold
+ * their match as one text node
+ */
+void checkDepth() {
+  SyntaxHighlighter highlighter(gImage);
+  const std::vector<std::string> names = {"string", "comment", "template-string", "class-name"};
+  const std::vector<uint32_t> ids = gLibprisma->tokenIds(names);
+  for (const uint32_t id : ids) {
+    if (std::find(names.begin(), names.end(), highlighter.tokenName(id)) == names.end()) {
+      fail("depth", "token id " + std::to_string(id) + " of Libprisma names " +
+                        highlighter.tokenName(id));
+    }
+  }
+
+  // A budget keeps the flat tokens of limits that are gone, in any order
+  MatchBudget budget([&] {
+    TokenizeLimits limits;
+    limits.flatTokens.assign(ids.rbegin(), ids.rend());
+    return limits;
+  }());
+  for (const uint32_t id : ids) {
+    if (budget.allowInside(0, id, 0) || budget.allowInside(0, 0, id)) {
+      fail("depth", "flat token " + highlighter.tokenName(id) + " of a temporary is tokenized inside");
+    }
+  }
+  if (!budget.allowInside(0, 0, 0)) {
+    fail("depth", "a token that is not flat is not tokenized inside");
+  }
+
+  size_t flat = 0;
+  for (const auto &sample : gSamples) {
+    const TokenList full = highlighter.tokenize(sample.code, sample.language);
+    TokenizeLimits limits;
+    TokenizeStats stats;
+
+    for (uint32_t maxDepth : {1u, 2u}) {
+      limits.maxDepth = maxDepth;
+      const TokenList tokens = tokenizeWithin(highlighter, sample, limits, stats);
+      if (depth(tokens) > maxDepth || stats.shallow || stats.limited) {
+        fail(sample.name, std::to_string(depth(tokens)) + " levels of tokens with maxDepth " +
+                              std::to_string(maxDepth));
+      }
+      if (topLevel(tokens) != topLevel(full)) {
+        fail(sample.name, "top-level tokens with maxDepth " + std::to_string(maxDepth) +
+                              " " + difference(topLevel(full), topLevel(tokens)));
+      }
+    }
+
+    limits.maxDepth = 0;
+    limits.flatTokens = ids;
+    const TokenList tokens = tokenizeWithin(highlighter, sample, limits, stats);
+    if (const size_t found = notFlat(tokens, ids, flat)) {
+      fail(sample.name, std::to_string(found) + " flat tokens tokenized inside");
+    }
+    if (topLevel(tokens) != topLevel(full)) {
+      fail(sample.name, "top-level tokens with flat tokens " +
+                            difference(topLevel(full), topLevel(tokens)));
+    }
+  }
+
+  if (flat == 0) {
+    fail("depth", "no flat token in the samples");
+  }
+}
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
@@ -0,0 +1,148 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "TestSupport.hpp"
+
+namespace athex {
+namespace libprisma {
+namespace test {
+
+namespace {
+
+/**
+ * Name chain of the class of every UTF-16 unit of the code but the line
+ * breaks, innermost token first, as tokenizeToLines defines a class
+ */
+void classChains(const SyntaxHighlighter &highlighter, const TokenList &tokens,
+                 const std::string &chain, std::vector<std::string> &out) {
+  for (const auto &node : tokens) {
+    if (node.isSyntax()) {
+      const auto &syntax = static_cast<const Syntax &>(node);
+      std::string inner;
+      if (syntax.alias() != TokenNames::None) {
+        inner += highlighter.tokenName(syntax.alias()) + ' ';
+      }
+      inner += highlighter.tokenName(syntax.type()) + ' ' + chain;
+      classChains(highlighter, syntax.children(), inner, out);
+    } else {
+      for (unsigned char c : static_cast<const Text &>(node).value()) {
+        if (c != '\n' && (c & 0xC0) != 0x80) {
+          out.insert(out.end(), c >= 0xF0 ? 2 : 1, chain);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * tokenizeToLines against the token tree: the runs of every line cover it
+ * without gaps, and each UTF-16 unit is in a run of the class of its token
+ */
+void checkSamples(const std::vector<Sample> &samples, bool large) {
+  SyntaxHighlighter highlighter(gImage);
+  const auto names = gLibprisma->tokenTypes();
+  using Format = Libprisma::TokenLinesFormat;
+
+  for (const auto &sample : samples) {
+    for (const auto &code : codes(sample, large)) {
+      std::vector<std::string> expected;
+      classChains(highlighter, highlighter.tokenize(code, sample.language), "",
+                  expected);
+
+      const auto buffer = gLibprisma->tokenizeToLines(code, sample.language);
+      const auto what = "lines of " + std::to_string(code.size()) + " bytes: ";
+      if (buffer.size() < Format::headerFields || buffer[0] != Format::version ||
+          buffer[4] != names.size()) {
+        fail(sample.name, what + "malformed header");
+        continue;
+      }
+
+      const uint32_t lines = buffer[1];
+      const uint32_t runs = buffer[2];
+      const uint32_t classes = buffer[3];
+      const size_t runTable = Format::headerFields + lines;
+      size_t classTable = runTable + runs * Format::runFields;
+
+      // Chain of every class id
+      std::vector<std::string> chains;
+      for (uint32_t i = 0; i < classes && classTable < buffer.size(); ++i) {
+        const uint32_t count = buffer[classTable++];
+        std::string chain;
+        for (uint32_t j = 0; j < count && classTable < buffer.size(); ++j) {
+          const uint32_t name = buffer[classTable++];
+          chain += (name < names.size() ? names[name] : "?") + ' ';
+        }
+        chains.push_back(std::move(chain));
+      }
+      if (chains.size() != classes || classTable != buffer.size() ||
+          chains.empty() || !chains[0].empty()) {
+        fail(sample.name, what + "malformed class table");
+        continue;
+      }
+
+      // Lines are split at every line break, runs are contiguous within a
+      // line and a line break advances the offset by one unit
+      const auto units = utf16(code);
+      std::vector<size_t> lineStarts{0};
+      for (size_t i = 0; i < units.size(); ++i) {
+        if (units[i] == u'\n') {
+          lineStarts.push_back(i + 1);
+        }
+      }
+      if (lineStarts.size() != lines) {
+        fail(sample.name, what + std::to_string(lines) + " lines instead of " +
+                              std::to_string(lineStarts.size()));
+        continue;
+      }
+
+      std::vector<std::string> actual;
+      bool valid = true;
+      for (uint32_t line = 0; line < lines && valid; ++line) {
+        const uint32_t first = buffer[Format::headerFields + line];
+        const uint32_t end =
+            line + 1 < lines ? buffer[Format::headerFields + line + 1] : runs;
+        const size_t lineEnd =
+            line + 1 < lines ? lineStarts[line + 1] - 1 : units.size();
+        size_t offset = lineStarts[line];
+        for (uint32_t run = first; run < end && valid; ++run) {
+          const uint32_t *fields = buffer.data() + runTable + run * Format::runFields;
+          valid = fields[0] == offset && fields[1] > 0 && fields[2] < classes &&
+                  (run == first || fields[2] != fields[-1]);
+          for (uint32_t i = 0; valid && i < fields[1]; ++i) {
+            actual.push_back(chains[fields[2]]);
+          }
+          offset += fields[1];
+        }
+        valid = valid && offset == lineEnd;
+      }
+
+      if (!valid) {
+        fail(sample.name, what + "runs do not cover the lines");
+      } else if (actual != expected) {
+        size_t i = 0;
+        while (i < actual.size() && i < expected.size() && actual[i] == expected[i]) {
+          ++i;
+        }
+        fail(sample.name, what + "class of UTF-16 unit " + std::to_string(i) +
+                              " differs");
+      }
+    }
+  }
+}
+
+} // namespace
+
+/**
+ * tokenizeToLines, split into chunks, against the token tree on the samples
+ * and their UTF-8 variants
+ */
+void checkLines() {
+  gLibprisma->setParallelTokenize(true);
+  checkSamples(gSamples, true);
+  checkSamples(utf8Samples(), true);
+}
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
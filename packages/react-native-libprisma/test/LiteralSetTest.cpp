@@ -0,0 +1,64 @@
+#include <string>
+#include <vector>
+
+#include "Regex.h"
+#include "TestSupport.hpp"
+
+namespace athex {
+namespace libprisma {
+namespace test {
+
+/**
+ * Alternations of literals matched by a LiteralSet against the regex engine,
+ * searching from and matching at every position of texts where a word
+ * boundary decides the match. \b outside a group belongs to the first or
+ * last alternative only, such a pattern has to be left to the engine.
+ */
+void checkLiterals() {
+  const std::vector<const char *> patterns = {
+      "\\bfoo|bar\\b",          "\\b(?:foo|bar)\\b", "\\b(?:foo)|(?:bar)\\b",
+      "\\bfoo|bar",             "foo|bar\\b",        "foo|bar",
+      "\\b(?:in|int|if)\\b",    "(?:in|int|if)\\b",  "\\b(?:a\\|b|c)\\b",
+  };
+  const std::vector<std::string> texts = {
+      "xfoo barx foo bar",
+      "xbar foox",
+      "barfoo foobar",
+      "int in if interface",
+      "a|b c a|bc",
+  };
+
+  for (const char *pattern : patterns) {
+    for (uint8_t flags : {RegexFlags::None, RegexFlags::IgnoreCase}) {
+      const Regex accelerated(pattern, flags);
+      const Regex plain(pattern, flags | RegexFlags::Plain);
+      for (const auto &text : texts) {
+        const char *end = text.data() + text.size();
+        for (size_t i = 0; i < text.size(); ++i) {
+          const char *begin = text.data() + i;
+          const auto what = std::string(pattern) + " at byte " +
+                            std::to_string(i) + " of \"" + text + "\"";
+
+          RegexMatch expected;
+          RegexMatch actual;
+          const bool found = plain.search(begin, end, expected);
+          if (accelerated.search(begin, end, actual) != found ||
+              (found && (actual.position != expected.position ||
+                         actual.length != expected.length))) {
+            fail("literals", "search of " + what + " differs");
+          }
+
+          const bool matched = plain.matchAt(begin, end, expected);
+          if (accelerated.matchAt(begin, end, actual) != matched ||
+              (matched && actual.length != expected.length)) {
+            fail("literals", "match of " + what + " differs");
+          }
+        }
+      }
+    }
+  }
+}
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
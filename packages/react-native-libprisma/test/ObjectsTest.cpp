@@ -0,0 +1,127 @@
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "JsonWriter.hpp"
+#include "TestSupport.hpp"
+#include "TokenObjectBuilder.hpp"
+
+namespace athex {
+namespace libprisma {
+namespace test {
+
+namespace {
+
+/**
+ * Values of TokenObjectBuilder as JSON text: an object is its members, an
+ * array its elements, until they are set into their parent
+ */
+struct JsonValues {
+  using Array = std::vector<std::string>;
+  using Object = std::string;
+  using String = std::string;
+
+  Array array(size_t size) { return Array(size); }
+
+  Object object() { return Object(); }
+
+  String string(std::string_view utf8) {
+    ++strings;
+    JsonWriter out;
+    out.string(utf8);
+    return out.take();
+  }
+
+  void set(Array &array, size_t index, Object &&object) {
+    array.at(index) = "{" + object + "}";
+  }
+
+  void set(Object &object, TokenProperty property, const String &value) {
+    member(object, property) += value;
+  }
+
+  void set(Object &object, TokenProperty property, Array &&value) {
+    member(object, property) += join(value);
+  }
+
+  static std::string join(const Array &array) {
+    std::string out = "[";
+    for (size_t i = 0; i < array.size(); ++i) {
+      out += (i > 0 ? "," : "") + array[i];
+    }
+    return out + "]";
+  }
+
+  // Strings created, names once per id and the content of every text
+  size_t strings = 0;
+
+private:
+  static std::string &member(Object &object, TokenProperty property) {
+    static const char *const keys[] = {"\"type\":", "\"alias\":", "\"content\":"};
+    object += object.empty() ? "" : ",";
+    return object += keys[static_cast<int>(property)];
+  }
+};
+
+/**
+ * Text nodes and distinct type and alias names of the tokens
+ */
+void countStrings(const TokenList &tokens, std::vector<bool> &names, size_t &texts) {
+  for (const auto &node : tokens) {
+    if (node.isSyntax()) {
+      const auto &syntax = static_cast<const Syntax &>(node);
+      names[syntax.type()] = true;
+      if (syntax.alias() != TokenNames::None) {
+        names[syntax.alias()] = true;
+      }
+      if (syntax.children().begin() == syntax.children().end()) {
+        names[TokenNames::None] = true;
+      }
+      countStrings(syntax.children(), names, texts);
+    } else {
+      names[TokenNames::Text] = true;
+      ++texts;
+    }
+  }
+}
+
+} // namespace
+
+/**
+ * The token objects of tokenizeToObjects, built as JSON, against
+ * tokensToJson of the same tokens, and every name created only once
+ */
+void checkObjects() {
+  SyntaxHighlighter highlighter(gImage);
+  std::vector<Sample> samples = gSamples;
+  for (const auto &sample : utf8Samples()) {
+    samples.push_back(sample);
+  }
+  samples.push_back({"javascript/empty", "javascript", ""});
+
+  for (const auto &sample : samples) {
+    const auto tokens = highlighter.tokenize(sample.code, sample.language);
+    JsonValues values;
+    TokenObjectBuilder<JsonValues> builder(values, highlighter);
+    const auto actual = JsonValues::join(builder.array(tokens));
+    const auto expected = gLibprisma->tokensToJson(tokens);
+    if (actual != expected) {
+      fail(sample.name, difference(expected, actual));
+    }
+
+    std::vector<bool> names(highlighter.tokenNames().size());
+    size_t strings = 0;
+    countStrings(tokens, names, strings);
+    for (bool used : names) {
+      strings += used;
+    }
+    if (values.strings != strings) {
+      fail(sample.name, std::to_string(values.strings) + " strings created instead of " +
+                            std::to_string(strings));
+    }
+  }
+}
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
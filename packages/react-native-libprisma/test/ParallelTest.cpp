@@ -0,0 +1,115 @@
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "TestSupport.hpp"
+#include "WorkerPool.hpp"
+
+namespace athex {
+namespace libprisma {
+namespace test {
+
+namespace {
+
+/**
+ * Code of a sample with long tokens between its copies, one of each length,
+ * built by open, body repeated and close. The tokens run across the seams of
+ * a split into any number of chunks, some past the window of a chunk.
+ */
+Sample longTokens(const char *name, const std::string &open,
+                  const std::string &body, const std::string &close) {
+  // std::regex recurses for every character it matches, a longer token
+  // overflows the stack
+  const size_t maxKilobytes = std::string(Libprisma::regexBackend()) == "std" ? 8 : 40;
+  const Sample &sample = findSample(name);
+  std::string code = sample.code;
+  for (size_t kilobytes : {1, 3, 5, 7, 9, 13, 17, 2, 6, 11, 4, 8, 24, 40}) {
+    if (kilobytes > maxKilobytes) {
+      continue;
+    }
+    code += "\n\n" + open;
+    for (const size_t end = code.size() + kilobytes * 1024; code.size() < end;) {
+      code += body;
+    }
+    code += close + sample.code;
+  }
+  return {sample.name + "/long", sample.language, code};
+}
+
+} // namespace
+
+/**
+ * Chunked tokenization with seam repair against one serial call, on the
+ * samples and their UTF-8 variants repeated to a large file and on
+ * constructs that run across a seam
+ */
+void checkParallel() {
+  SyntaxHighlighter highlighter(gImage);
+  WorkerPool pool(3);
+  const auto parallelFor = [&pool](size_t count,
+                                   const std::function<void(size_t)> &body) {
+    pool.parallelFor(count, body);
+  };
+
+  std::vector<Sample> samples;
+  for (const auto &sample : gSamples) {
+    samples.push_back({sample.name, sample.language, repeated(sample.code, 300 * 1024)});
+  }
+  for (const auto &sample : utf8Samples()) {
+    samples.push_back({sample.name, sample.language, repeated(sample.code, 300 * 1024)});
+  }
+
+  // Block comments, docstrings and template literals that span many of the
+  // blank lines a chunk may start after
+  const std::string function = "\n\nfunction f() {\n  return 1;\n}\n";
+  const auto around = [&](const char *name, const std::string &open,
+                          const std::string &body, size_t count,
+                          const std::string &close) {
+    const Sample &sample = findSample(name);
+    std::string code = sample.code + "\n\n" + open;
+    for (size_t i = 0; i < count; ++i) {
+      code += body;
+    }
+    code += close + sample.code;
+    samples.push_back({sample.name + "/seam", sample.language, code});
+  };
+  around("cpp", "/*\n", function, 300, "*/\n");
+  around("python", "def g():\n    \"\"\"\n", "\n\nArgs: x\n", 300, "\"\"\"\n");
+  around("typescript", "const t = `\n", function, 100, "`;\n");
+  around("rust", "/*\n", function, 30, "*/\n");
+
+  // Many multi-line tokens of 1 to 40 KB in one text, so that every split
+  // has several seams inside them
+  samples.push_back(longTokens("cpp", "/*\n", function, "*/\n"));
+  samples.push_back(longTokens("python", "def g():\n    \"\"\"\n", "\n\nArgs: x\n", "\"\"\"\n"));
+  samples.push_back(longTokens("typescript", "const t = `\n", function, "`;\n"));
+
+  // A template literal of 12 KB full of blank lines and functions at the end
+  // of a file large enough for Libprisma to split
+  const Sample &typescript = findSample("typescript");
+  std::string code = repeated(typescript.code, 256 * 1024) + "const page = `\n";
+  while (code.size() < 256 * 1024 + 12 * 1024) {
+    code += function;
+  }
+  code += "`;\n" + typescript.code;
+  samples.push_back({"javascript/template", "javascript", code});
+
+  for (const auto &sample : samples) {
+    const auto expected =
+        dump(highlighter, highlighter.tokenize(sample.code, sample.language));
+    for (size_t chunks : {2, 3, 8, 40}) {
+      const auto actual = dump(highlighter, highlighter.tokenizeParallel(
+                                                sample.code, sample.language,
+                                                chunks, parallelFor));
+      if (expected != actual) {
+        fail(sample.name, std::to_string(chunks) + " chunks " +
+                              difference(expected, actual));
+        break;
+      }
+    }
+  }
+}
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
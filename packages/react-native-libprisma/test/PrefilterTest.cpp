@@ -0,0 +1,61 @@
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "Prefilter.h"
+#include "TestSupport.hpp"
+
+namespace athex {
+namespace libprisma {
+namespace test {
+
+/**
+ * Prefilters of negated classes and class escapes against the regex engine
+ * on UTF-8 text: every position a match starts at has to pass canStartAt,
+ * and find from any position before it must not skip it. Before negated
+ * classes kept the bytes from 0x80 up, [^\w] could not start at an é.
+ */
+void checkPrefilter() {
+  const std::vector<const char *> patterns = {
+      "[^a-z]+",  "[^\\w\\s]", "[^\"\\\\]+", "\\W+",    "[^\\d]",
+      "\\S+",     "[^ -~]",    "[^\\x00-\\x7F]+", "[^'\\n]*'", "\\D",
+  };
+  const std::vector<std::string> texts = {
+      "plain ascii, only",
+      "caf\xC3\xA9 na\xC3\xAFve",
+      "\xE2\x82\xAC" "42 \xF0\x9F\x98\x80 \"q\\\"\"",
+      "\xC3\xA9'\xE6\x97\xA5\xE6\x9C\xAC'",
+  };
+
+  for (const char *pattern : patterns) {
+    const Prefilter prefilter(pattern, false);
+    const std::regex regex(pattern, std::regex::ECMAScript);
+    for (const auto &text : texts) {
+      const char *begin = text.data();
+      const char *end = begin + text.size();
+      for (size_t start = 0; start < text.size(); ++start) {
+        if (!std::regex_search(begin + start, end, regex,
+                               std::regex_constants::match_continuous)) {
+          continue;
+        }
+
+        const auto what = std::string(pattern) + " at byte " +
+                          std::to_string(start) + " of \"" + text + "\"";
+        if (!prefilter.canStartAt(begin + start, end)) {
+          fail("prefilter", what + " cannot start");
+        }
+        for (size_t from = 0; from <= start; ++from) {
+          const char *found = prefilter.find(begin + from, end);
+          if (found == nullptr || found > begin + start) {
+            fail("prefilter", what + " skipped from byte " + std::to_string(from));
+            break;
+          }
+        }
+      }
+    }
+  }
+}
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
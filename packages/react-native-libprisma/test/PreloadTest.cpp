@@ -0,0 +1,68 @@
+#include <exception>
+#include <future>
+#include <string>
+#include <vector>
+
+#include "TestSupport.hpp"
+
+namespace athex {
+namespace libprisma {
+namespace test {
+
+/**
+ * Languages compiled ahead of use tokenize like a highlighter that builds
+ * them on the first call: preload materializes every grammar a language
+ * reaches through inside, on a fresh highlighter and on one that preloaded
+ * other languages before. preloadLanguages resolves and skips unknown ones.
+ */
+void checkPreload() {
+  SyntaxHighlighter serial(gImage);
+  SyntaxHighlighter shared(gImage);
+  for (const auto &sample : gSamples) {
+    const auto expected = dump(serial, serial.tokenize(sample.code, sample.language));
+
+    SyntaxHighlighter fresh(gImage);
+    if (!fresh.preload(sample.language) || !shared.preload(sample.language)) {
+      fail(sample.name, "the language was not preloaded");
+    }
+    for (SyntaxHighlighter *highlighter : {&fresh, &shared}) {
+      const auto tokens = dump(*highlighter, highlighter->tokenize(sample.code, sample.language));
+      if (tokens != expected) {
+        fail(sample.name, "tokens after preload " + difference(expected, tokens));
+      }
+    }
+  }
+
+  if (shared.preload("no-such-language")) {
+    fail("preload", "an unknown language was preloaded");
+  }
+
+  Libprisma libprisma;
+  if (!libprisma.loadGrammarsFromFile(gGrammarsPath)) {
+    fail("preloadLanguages", "the grammars do not load");
+    return;
+  }
+  std::vector<std::string> languages = {"no-such-language"};
+  for (const auto &sample : gSamples) {
+    languages.push_back(sample.language);
+  }
+  std::promise<void> preloaded;
+  libprisma.preloadLanguages(
+      languages, [&] { preloaded.set_value(); },
+      [&](std::exception_ptr e) { preloaded.set_exception(e); });
+  try {
+    preloaded.get_future().get();
+  } catch (const std::exception &e) {
+    fail("preloadLanguages", std::string("rejected with ") + e.what());
+  }
+  for (const auto &sample : gSamples) {
+    if (libprisma.tokenizeToJson(sample.code, sample.language) !=
+        gLibprisma->tokenizeToJson(sample.code, sample.language)) {
+      fail(sample.name, "tokenizeToJson after preloadLanguages differs");
+    }
+  }
+}
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
@@ -0,0 +1,98 @@
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "TestSupport.hpp"
+#include "WorkerPool.hpp"
+
+namespace athex {
+namespace libprisma {
+namespace test {
+
+namespace {
+
+using Counters = std::map<std::tuple<std::string, uint32_t, uint32_t>, uint64_t>;
+
+/**
+ * Regex searches of every pattern in the profile, keyed by language, token
+ * and pattern index. Fails if an entry does not add up.
+ */
+Counters searches(const SyntaxHighlighter &highlighter, const std::string &sample) {
+  Counters out;
+  const auto entries = highlighter.profile();
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const auto &stats = entries[i];
+    if (stats.calls != stats.matches + stats.misses || stats.source.empty() ||
+        (i > 0 && stats.time > entries[i - 1].time)) {
+      fail(sample, "profile entry " + std::to_string(i) + " of " +
+                       highlighter.tokenName(stats.token) + " is inconsistent");
+    }
+    out[{stats.language, stats.token, stats.index}] = stats.calls;
+  }
+  return out;
+}
+
+} // namespace
+
+/**
+ * Per-pattern profile of tokenize calls: it counts nothing while off and
+ * the same searches for every call of the same code, also when the calls
+ * run on several threads at once. Profiling leaves the tokens as they are.
+ */
+void checkProfile() {
+  WorkerPool pool(3);
+  for (const auto &sample : gSamples) {
+    SyntaxHighlighter highlighter(gImage);
+    const auto expected = dump(highlighter, highlighter.tokenize(sample.code, sample.language));
+    if (!highlighter.profile().empty()) {
+      fail(sample.name, "profiled while off");
+    }
+
+    highlighter.setProfiling(true);
+    const auto actual = dump(highlighter, highlighter.tokenize(sample.code, sample.language));
+    if (expected != actual) {
+      fail(sample.name, "profiled tokens " + difference(expected, actual));
+    }
+    const auto once = searches(highlighter, sample.name);
+    if (once.empty()) {
+      fail(sample.name, "no searches profiled");
+    }
+    for (const auto &[key, calls] : once) {
+      if (std::get<0>(key) != sample.language) {
+        fail(sample.name, "searches counted for " + std::get<0>(key));
+        break;
+      }
+    }
+
+    // Enabling it again starts a new profile, the calls on the pool add up
+    constexpr size_t kCalls = 4;
+    highlighter.setProfiling(false);
+    highlighter.setProfiling(true);
+    pool.parallelFor(kCalls, [&](size_t) {
+      highlighter.tokenize(sample.code, sample.language);
+    });
+    const auto parallel = searches(highlighter, sample.name);
+    bool same = parallel.size() == once.size();
+    for (auto it = once.begin(), other = parallel.begin(); same && it != once.end();
+         ++it, ++other) {
+      same = it->first == other->first && other->second == kCalls * it->second;
+    }
+    if (!same) {
+      fail(sample.name, "searches of " + std::to_string(kCalls) +
+                            " calls on the pool differ from one call");
+    }
+
+    highlighter.setProfiling(false);
+    highlighter.tokenize(sample.code, sample.language);
+    if (searches(highlighter, sample.name) != parallel) {
+      fail(sample.name, "profiled after turning it off");
+    }
+  }
+}
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "TestSupport.hpp"
+#include "TokenRanges.hpp"
+
+namespace athex {
+namespace libprisma {
+namespace test {
+
+namespace {
+
+// Lines between two checkpoints, small for many of them in a sample
+constexpr size_t kCheckpointLines = 16;
+
+/**
+ * Start of line line of the text, its size past the last line
+ */
+size_t lineStart(const std::string &text, size_t line) {
+  size_t pos = 0;
+  for (; line > 0 && pos < text.size(); --line) {
+    const size_t newline = text.find('\n', pos);
+    pos = newline == std::string::npos ? text.size() : newline + 1;
+  }
+  return pos;
+}
+
+} // namespace
+
+/**
+ * Ranges of TokenRanges against the top-level tokens of a full tokenization
+ * that overlap their lines, on the samples repeated to many checkpoints.
+ * The ranges jump to the end, back to the start and to the end again, where
+ * resuming from the checkpoint above has to stream less than getting there
+ * the first time.
+ */
+void checkRange() {
+  SyntaxHighlighter highlighter(gImage);
+  for (const auto &sample : gSamples) {
+    const auto tokenize = documentTokenizer(highlighter, sample.language);
+    const std::string code = repeated(sample.code, 64 * 1024);
+    const auto expected = TokenDocument(code, tokenize).segments();
+    const size_t lines = std::count(code.begin(), code.end(), '\n') + 1;
+
+    // Counts the bytes every call of the range tokenizer sees
+    size_t streamed = 0;
+    const TokenDocument::Tokenizer counting =
+        [&](std::string_view text, size_t base, size_t limit) {
+          streamed += text.size();
+          return tokenize(text, base, limit);
+        };
+
+    TokenRanges ranges(code, kCheckpointLines);
+    std::vector<size_t> costs;
+    for (size_t startLine :
+         {lines * 3 / 4, size_t(5), lines / 2, lines * 3 / 4, lines + 5}) {
+      const size_t endLine = startLine + 20;
+      const auto what = "lines " + std::to_string(startLine) + " to " +
+                        std::to_string(endLine) + ": ";
+
+      streamed = 0;
+      const auto range = ranges.tokenize(startLine, endLine, counting);
+      costs.push_back(streamed);
+
+      const size_t from = lineStart(code, startLine);
+      const size_t to = std::max(lineStart(code, endLine), from + 1);
+      std::vector<TokenDocument::Segment> overlapping;
+      for (const auto &segment : expected) {
+        if (segment.start + segment.length > from && segment.start < to) {
+          overlapping.push_back(segment);
+        }
+      }
+
+      bool same = range.segments.size() == overlapping.size();
+      for (size_t i = 0; same && i < overlapping.size(); ++i) {
+        same = range.segments[i].start == overlapping[i].start &&
+               range.segments[i].length == overlapping[i].length &&
+               range.segments[i].json == overlapping[i].json;
+      }
+      if (!same) {
+        fail(sample.name, what + std::to_string(range.segments.size()) +
+                              " tokens instead of " +
+                              std::to_string(overlapping.size()) +
+                              " or the tokens differ");
+        continue;
+      }
+
+      const size_t rangeStart = overlapping.empty() ? code.size() : overlapping.front().start;
+      const size_t rangeEnd = overlapping.empty()
+                                  ? code.size()
+                                  : overlapping.back().start + overlapping.back().length;
+      const size_t firstLine =
+          std::count(code.begin(), code.begin() + rangeStart, '\n');
+      const size_t lastLine =
+          firstLine + std::count(code.begin() + rangeStart, code.begin() + rangeEnd, '\n');
+      if (range.start != rangeStart || range.end != rangeEnd ||
+          (!overlapping.empty() && (range.startLine != firstLine || range.endLine != lastLine))) {
+        fail(sample.name, what + "byte range or lines of the tokens differ");
+      }
+    }
+
+    if (costs[3] * 4 > costs[0]) {
+      fail(sample.name, "streamed " + std::to_string(costs[3]) +
+                            " bytes for a range again, " +
+                            std::to_string(costs[0]) + " the first time");
+    }
+  }
+}
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
@@ -0,0 +1,28 @@
+#include <vector>
+
+#include "TestSupport.hpp"
+
+namespace athex {
+namespace libprisma {
+namespace test {
+
+/**
+ * Accelerated searches (prefilter, literal set, reuse of greedy searches)
+ * against the plain regex engine
+ */
+void checkReference(const std::vector<Sample> &samples) {
+  SyntaxHighlighter accelerated(gImage);
+  SyntaxHighlighter plain(gImage, false);
+  for (const auto &sample : samples) {
+    const auto expected = dump(plain, plain.tokenize(sample.code, sample.language));
+    const auto actual =
+        dump(accelerated, accelerated.tokenize(sample.code, sample.language));
+    if (expected != actual) {
+      fail(sample.name, difference(expected, actual));
+    }
+  }
+}
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
@@ -0,0 +1,23 @@
+#include <string>
+#include <string_view>
+
+// JsonWriter once more without the vector scan, renamed so that it links next
+// to the one of the core, whatever LIBPRISMA_JSON_SIMD built that with
+#define LIBPRISMA_JSON_SCALAR 1
+#define JsonWriter ScalarJsonWriter
+#include "JsonWriter.cpp"
+#undef JsonWriter
+
+namespace athex {
+namespace libprisma {
+namespace test {
+
+std::string scalarEscaped(std::string_view text) {
+  ScalarJsonWriter out;
+  out.escaped(text);
+  return out.take();
+}
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
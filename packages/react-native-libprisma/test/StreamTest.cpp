@@ -0,0 +1,114 @@
+#include <string>
+#include <vector>
+
+#include "TestSupport.hpp"
+#include "TokenStream.hpp"
+
+namespace athex {
+namespace libprisma {
+namespace test {
+
+namespace {
+
+/**
+ * Index of the first segment where two token lists differ, npos if they are
+ * the same
+ */
+size_t firstDifference(const std::vector<TokenDocument::Segment> &expected,
+                       const std::vector<TokenDocument::Segment> &actual) {
+  size_t i = 0;
+  while (i < actual.size() && i < expected.size() &&
+         actual[i].start == expected[i].start &&
+         actual[i].length == expected[i].length &&
+         actual[i].json == expected[i].json) {
+    ++i;
+  }
+  return i < actual.size() || i < expected.size() ? i : std::string::npos;
+}
+
+/**
+ * Read the stream to the end, appending the tokens of every chunk. Fails if
+ * a chunk does not start where the previous one ended or does not cover its
+ * byte range with its tokens.
+ */
+bool readAll(TokenStream &stream, const TokenDocument::Tokenizer &tokenize,
+             std::vector<TokenDocument::Segment> &out, std::string &error) {
+  size_t offset = stream.checkpoint().offset;
+  size_t line = stream.checkpoint().line;
+  while (!stream.done()) {
+    auto chunk = stream.next(tokenize);
+    size_t end = chunk.start;
+    for (const auto &segment : chunk.segments) {
+      end = segment.start == end ? end + segment.length : std::string::npos;
+    }
+    if (chunk.start != offset || chunk.startLine != line || end != chunk.end ||
+        chunk.end <= chunk.start) {
+      error = "chunk at " + std::to_string(chunk.start) + " does not follow " +
+              std::to_string(offset);
+      return false;
+    }
+    offset = chunk.end;
+    line = chunk.endLine;
+    for (auto &segment : chunk.segments) {
+      out.push_back(std::move(segment));
+    }
+  }
+  if (offset != stream.text().size()) {
+    error = "stream ends at " + std::to_string(offset);
+    return false;
+  }
+  return stream.next(tokenize).segments.empty();
+}
+
+} // namespace
+
+/**
+ * The chunks of a TokenStream joined against tokenizing the whole text at
+ * once, on the samples and on them repeated to many chunks, and reading on
+ * from a checkpoint against the chunks read before seeking to it
+ */
+void checkStream() {
+  SyntaxHighlighter highlighter(gImage);
+  for (const auto &sample : gSamples) {
+    const auto tokenize = documentTokenizer(highlighter, sample.language);
+    for (const auto &code : {sample.code, repeated(sample.code, 64 * 1024)}) {
+      const auto expected = TokenDocument(code, tokenize).segments();
+      for (size_t lines : {4, 16, 256}) {
+        const auto what = std::to_string(code.size()) + " bytes, " +
+                          std::to_string(lines) + " lines per chunk: ";
+        TokenStream stream(code, lines);
+        std::vector<TokenDocument::Segment> actual;
+        std::string error;
+        if (!readAll(stream, tokenize, actual, error)) {
+          fail(sample.name, what + error);
+          continue;
+        }
+        const size_t i = firstDifference(expected, actual);
+        if (i != std::string::npos) {
+          fail(sample.name, what + "top-level token " + std::to_string(i) +
+                                " of " + std::to_string(expected.size()) +
+                                " differs");
+          continue;
+        }
+
+        // Seek back to the checkpoint after the first chunk
+        TokenStream seeking(code, lines);
+        const auto first = seeking.next(tokenize);
+        const auto checkpoint = seeking.checkpoint();
+        std::vector<TokenDocument::Segment> rest;
+        readAll(seeking, tokenize, rest, error);
+        seeking.seek(checkpoint);
+        std::vector<TokenDocument::Segment> again;
+        if (!readAll(seeking, tokenize, again, error) ||
+            firstDifference(rest, again) != std::string::npos) {
+          fail(sample.name, what + "chunks differ after seeking to " +
+                                std::to_string(first.end) + " " + error);
+        }
+      }
+    }
+  }
+}
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
@@ -0,0 +1,219 @@
+#include "TestSupport.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+
+namespace athex {
+namespace libprisma {
+namespace test {
+
+std::string gGrammarsPath;
+std::shared_ptr<const GrammarImage> gImage;
+std::unique_ptr<Libprisma> gLibprisma;
+std::vector<Sample> gSamples;
+
+namespace {
+size_t gFailures = 0;
+} // namespace
+
+void fail(const std::string &sample, const std::string &what) {
+  std::fprintf(stderr, "FAIL %s: %s\n", sample.c_str(), what.c_str());
+  ++gFailures;
+}
+
+size_t failures() { return gFailures; }
+
+void dump(const SyntaxHighlighter &highlighter, const TokenList &tokens,
+          std::string &out) {
+  for (const auto &node : tokens) {
+    if (node.isSyntax()) {
+      const auto &syntax = static_cast<const Syntax &>(node);
+      out += '(';
+      out += highlighter.tokenName(syntax.type());
+      out += '/';
+      out += highlighter.tokenName(syntax.alias());
+      out += ' ';
+      dump(highlighter, syntax.children(), out);
+      out += ')';
+    } else {
+      const auto value = static_cast<const Text &>(node).value();
+      out += std::to_string(value.size());
+      out += ':';
+      out += value;
+    }
+  }
+}
+
+std::string dump(const SyntaxHighlighter &highlighter, const TokenList &tokens) {
+  std::string out;
+  dump(highlighter, tokens, out);
+  return out;
+}
+
+std::string difference(const std::string &expected, const std::string &actual) {
+  size_t i = 0;
+  while (i < expected.size() && i < actual.size() && expected[i] == actual[i]) {
+    ++i;
+  }
+  const size_t from = i > 40 ? i - 40 : 0;
+  return "differs at " + std::to_string(i) + "\n  expected ..." +
+         expected.substr(from, 120) + "\n  actual   ..." + actual.substr(from, 120);
+}
+
+const Sample &findSample(const char *name) {
+  for (const auto &sample : gSamples) {
+    if (sample.name == name) {
+      return sample;
+    }
+  }
+  std::fprintf(stderr, "No %s sample\n", name);
+  std::exit(1);
+}
+
+std::vector<Sample> utf8Samples() {
+  const std::pair<char, const char *> replacements[] = {
+      {'e', "\xC3\xA9"}, {'a', "\xE6\x97\xA5"}, {'o', "\xF0\x9F\x98\x80"}};
+
+  std::vector<Sample> samples;
+  for (const auto &[from, to] : replacements) {
+    for (const auto &sample : gSamples) {
+      Sample variant{sample.name + "/" + to, sample.language, ""};
+      for (char c : sample.code) {
+        if (c == from) {
+          variant.code += to;
+        } else {
+          variant.code += c;
+        }
+      }
+      samples.push_back(std::move(variant));
+    }
+  }
+  return samples;
+}
+
+std::string repeated(const std::string &code, size_t size) {
+  std::string out;
+  while (out.size() < size) {
+    out += code;
+    out += "\n\n";
+  }
+  return out;
+}
+
+uint32_t utf16Length(std::string_view str) {
+  uint32_t length = 0;
+  for (unsigned char c : str) {
+    if ((c & 0xC0) != 0x80) {
+      length += c >= 0xF0 ? 2 : 1;
+    }
+  }
+  return length;
+}
+
+std::u16string utf16(std::string_view str) {
+  std::u16string out;
+  for (size_t i = 0; i < str.size();) {
+    const auto c = static_cast<unsigned char>(str[i]);
+    const size_t length = c < 0x80 ? 1 : c < 0xE0 ? 2 : c < 0xF0 ? 3 : 4;
+    uint32_t codePoint = length == 1 ? c : c & (0x7F >> length);
+    for (size_t j = 1; j < length; ++j) {
+      codePoint = (codePoint << 6) | (static_cast<unsigned char>(str[i + j]) & 0x3F);
+    }
+    if (codePoint >= 0x10000) {
+      out += static_cast<char16_t>(0xD800 + ((codePoint - 0x10000) >> 10));
+      out += static_cast<char16_t>(0xDC00 + ((codePoint - 0x10000) & 0x3FF));
+    } else {
+      out += static_cast<char16_t>(codePoint);
+    }
+    i += length;
+  }
+  return out;
+}
+
+bool decodeBuffer(const uint32_t *entries, size_t count,
+                  const std::vector<std::string> &names, size_t units,
+                  std::string &out) {
+  constexpr size_t fields = Libprisma::TokenBufferFormat::entryFields;
+  std::vector<uint32_t> ends;
+  uint32_t offset = 0;
+  for (size_t i = 0; i < count; ++i) {
+    const uint32_t *entry = entries + i * fields;
+    const uint32_t depth = entry[4];
+    if (depth > ends.size() || entry[2] != offset || entry[0] >= names.size() ||
+        entry[1] >= names.size()) {
+      return false;
+    }
+    for (; ends.size() > depth; ends.pop_back()) {
+      if (ends.back() != offset) {
+        return false;
+      }
+      out += ')';
+    }
+
+    if (entry[0] == Libprisma::TokenBufferFormat::textType) {
+      out += std::to_string(entry[3]) + ';';
+      offset += entry[3];
+    } else {
+      out += '(' + names[entry[0]] + '/' + names[entry[1]] + ' ';
+      ends.push_back(entry[2] + entry[3]);
+    }
+  }
+  for (; !ends.empty(); ends.pop_back()) {
+    if (ends.back() != offset) {
+      return false;
+    }
+    out += ')';
+  }
+  return offset == units;
+}
+
+void dumpLengths(const SyntaxHighlighter &highlighter, const TokenList &tokens,
+                 std::string &out) {
+  for (const auto &node : tokens) {
+    if (node.isSyntax()) {
+      const auto &syntax = static_cast<const Syntax &>(node);
+      out += '(' + highlighter.tokenName(syntax.type()) + '/' +
+             highlighter.tokenName(syntax.alias()) + ' ';
+      dumpLengths(highlighter, syntax.children(), out);
+      out += ')';
+    } else {
+      out += std::to_string(utf16Length(static_cast<const Text &>(node).value())) + ';';
+    }
+  }
+}
+
+std::vector<std::string> codes(const Sample &sample, bool large) {
+  if (!large) {
+    return {sample.code};
+  }
+  return {sample.code, repeated(sample.code, 300 * 1024)};
+}
+
+TokenDocument::Tokenizer documentTokenizer(SyntaxHighlighter &highlighter,
+                                           const std::string &language) {
+  return [&highlighter, language](std::string_view text, size_t base, size_t limit) {
+    std::vector<TokenDocument::Segment> segments;
+    TokenList tokens = highlighter.tokenize(text, language, limit);
+
+    size_t start = 0;
+    for (auto it = tokens.begin(); it != tokens.end() && start < limit; ++it) {
+      std::string json;
+      if (it->isSyntax()) {
+        const auto &syntax = static_cast<const Syntax &>(*it);
+        json = highlighter.tokenName(syntax.type()) + "/" +
+               highlighter.tokenName(syntax.alias()) + " " +
+               dump(highlighter, syntax.children());
+      } else {
+        json = std::string(static_cast<const Text &>(*it).value());
+      }
+      segments.push_back({base + start, it->length(), std::move(json)});
+      start += it->length();
+    }
+    return segments;
+  };
+}
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
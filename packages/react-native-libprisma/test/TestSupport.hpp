@@ -0,0 +1,229 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "GrammarImage.h"
+#include "Libprisma.hpp"
+#include "Samples.hpp"
+#include "SyntaxHighlighter.h"
+#include "TokenDocument.hpp"
+
+// Shared state and helpers of the native checks. Every check is a function
+// of its own file, registered by name in LibprismaTest.cpp and run as one
+// ctest test. A check reports every difference it finds with fail.
+namespace athex {
+namespace libprisma {
+namespace test {
+
+// Loaded by main before any check runs, gImage from gGrammarsPath
+extern std::string gGrammarsPath;
+extern std::shared_ptr<const GrammarImage> gImage;
+extern std::unique_ptr<Libprisma> gLibprisma;
+extern std::vector<Sample> gSamples;
+
+/**
+ * Report a failure of sample, the check fails once any was reported
+ */
+void fail(const std::string &sample, const std::string &what);
+
+/**
+ * Failures reported so far
+ */
+size_t failures();
+
+/**
+ * Tokens as text, with the type and alias names of every token so that
+ * highlighters with different accelerations can be compared
+ */
+void dump(const SyntaxHighlighter &highlighter, const TokenList &tokens,
+          std::string &out);
+std::string dump(const SyntaxHighlighter &highlighter, const TokenList &tokens);
+
+/**
+ * Where two dumps first differ, with some context
+ */
+std::string difference(const std::string &expected, const std::string &actual);
+
+/**
+ * The sample of the example app named name, exits if there is none
+ */
+const Sample &findSample(const char *name);
+
+/**
+ * The samples with every e, a and o replaced by a character of another UTF-8
+ * length, inside keywords, strings and comments alike
+ */
+std::vector<Sample> utf8Samples();
+
+/**
+ * The code repeated until it is at least size bytes long
+ */
+std::string repeated(const std::string &code, size_t size);
+
+/**
+ * Length of a UTF-8 string in UTF-16 code units, counted by lead byte like
+ * the encoders do. A byte regex can end a token inside a character, its
+ * units then count for the token it starts in.
+ */
+uint32_t utf16Length(std::string_view str);
+
+/**
+ * UTF-16 code units of a UTF-8 string, as JS sees it
+ */
+std::u16string utf16(std::string_view str);
+
+/**
+ * Entries of a token buffer rebuilt into a dump of type and alias names
+ * from the token type table and text lengths. Fails if the entries are not
+ * in pre-order or do not cover the units of the code without gaps.
+ */
+bool decodeBuffer(const uint32_t *entries, size_t count,
+                  const std::vector<std::string> &names, size_t units,
+                  std::string &out);
+
+/**
+ * Tokens in the format of decodeBuffer
+ */
+void dumpLengths(const SyntaxHighlighter &highlighter, const TokenList &tokens,
+                 std::string &out);
+
+/**
+ * The code of a sample, and with large also the code repeated to be
+ * tokenized in chunks
+ */
+std::vector<std::string> codes(const Sample &sample, bool large);
+
+/**
+ * Tokenizer of a TokenDocument, the same as Libprisma's but with the dump of
+ * every top-level token instead of its JSON
+ */
+TokenDocument::Tokenizer documentTokenizer(SyntaxHighlighter &highlighter,
+                                           const std::string &language);
+
+// Checks, each defined in the file named after it
+
+/**
+ * tokenizeBatch against tokenizeToBuffer per snippet, BatchTest.cpp
+ */
+void checkBatch();
+
+/**
+ * tokenizeToBuffer against the token tree, BufferTest.cpp
+ */
+void checkBuffer();
+
+/**
+ * tokenizeToBuffer on a view into a larger buffer against a copy of the
+ * code, BufferTest.cpp
+ */
+void checkBufferView();
+
+/**
+ * Eviction and counters of the result cache, CacheTest.cpp
+ */
+void checkCache();
+
+/**
+ * Threads tokenizing on a cold language tree against one thread,
+ * ConcurrencyTest.cpp
+ */
+void checkConcurrency();
+
+/**
+ * Depth limit and flat tokens of tokenize, LimitsTest.cpp
+ */
+void checkDepth();
+
+/**
+ * Truncated and corrupted grammar images are rejected, GrammarImageTest.cpp
+ */
+void checkImage();
+
+/**
+ * Edits of a TokenDocument against a fresh tokenization, DocumentTest.cpp
+ */
+void checkDocument();
+
+/**
+ * JsonWriter against the token JSON of the tokenizer before it, JsonTest.cpp
+ */
+void checkJson();
+
+/**
+ * tokenizeToLines against the token tree, LinesTest.cpp
+ */
+void checkLines();
+
+/**
+ * Literal sets against the regex engine, LiteralSetTest.cpp
+ */
+void checkLiterals();
+
+/**
+ * Memory limit of tokenize, LimitsTest.cpp
+ */
+void checkMemory();
+
+/**
+ * Token objects of tokenizeToObjects against tokensToJson, ObjectsTest.cpp
+ */
+void checkObjects();
+
+/**
+ * Chunked tokenization against one serial call, ParallelTest.cpp
+ */
+void checkParallel();
+
+/**
+ * Tokenizing after preload against building languages on first use,
+ * PreloadTest.cpp
+ */
+void checkPreload();
+
+/**
+ * Prefilters on UTF-8 text against the regex engine, PrefilterTest.cpp
+ */
+void checkPrefilter();
+
+/**
+ * Per-pattern profile of tokenize calls, ProfileTest.cpp
+ */
+void checkProfile();
+
+/**
+ * Line ranges of TokenRanges against a full tokenization, RangeTest.cpp
+ */
+void checkRange();
+
+/**
+ * Accelerated searches against the plain regex engine, ReferenceTest.cpp
+ */
+void checkReference(const std::vector<Sample> &samples);
+
+/**
+ * Step and time limits of tokenize, LimitsTest.cpp
+ */
+void checkSteps();
+
+/**
+ * Chunks of a TokenStream against a full tokenization, StreamTest.cpp
+ */
+void checkStream();
+
+/**
+ * Cancelling queued jobs of WorkerPool and tokenizeAsync, WorkerPoolTest.cpp
+ */
+void checkWorkers();
+
+/**
+ * tokenizeToJson against the output of the baseline tokenizer, GoldenTest.cpp
+ */
+void checkGolden();
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
@@ -0,0 +1,217 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "TestSupport.hpp"
+#include "WorkerPool.hpp"
+
+namespace athex {
+namespace libprisma {
+namespace test {
+
+namespace {
+
+/**
+ * What happened to each job of a check, by id
+ */
+struct Outcomes {
+  std::mutex mutex;
+  std::vector<std::string> ran;
+  std::vector<std::string> cancelled;
+
+  void add(std::vector<std::string> &to, const std::string &id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    to.push_back(id);
+  }
+
+  bool has(const std::vector<std::string> &in, const std::string &id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return std::find(in.begin(), in.end(), id) != in.end();
+  }
+};
+
+/**
+ * Wait until count reaches expected, false after a few seconds
+ */
+bool waitFor(const std::atomic<size_t> &count, size_t expected) {
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (count.load() < expected) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return true;
+}
+
+/**
+ * Jobs that keep every worker of a pool busy until released
+ */
+struct Blockers {
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  std::atomic<size_t> started{0};
+
+  WorkerPool::Job job() {
+    return {[this] {
+              ++started;
+              released.wait();
+            },
+            nullptr};
+  }
+};
+
+WorkerPool::Job recorded(Outcomes &outcomes, const std::string &id,
+                         std::atomic<size_t> &finished) {
+  return {[&outcomes, &finished, id] {
+            outcomes.add(outcomes.ran, id);
+            ++finished;
+          },
+          [&outcomes, &finished, id] {
+            outcomes.add(outcomes.cancelled, id);
+            ++finished;
+          }};
+}
+
+} // namespace
+
+/**
+ * Cancelling jobs of a WorkerPool that have not started, and of Libprisma's
+ * tokenizeAsync: a queued job gets its cancel callback right away and never
+ * runs, a started one cannot be cancelled, and destroying a pool cancels
+ * everything still queued
+ */
+void checkWorkers() {
+  {
+    // Declared before the pool, which joins its workers first
+    Blockers blockers;
+    Outcomes outcomes;
+    std::atomic<size_t> finished{0};
+    WorkerPool pool(2);
+    pool.submit(WorkerPool::kAnonymousJob, blockers.job());
+    pool.submit(WorkerPool::kAnonymousJob, blockers.job());
+    if (!waitFor(blockers.started, 2)) {
+      fail("pool", "the workers did not start");
+    }
+
+    for (const char *id : {"1", "2", "3", "4"}) {
+      pool.submit(std::stoull(id), recorded(outcomes, id, finished));
+    }
+
+    if (!pool.cancel(2) || !outcomes.has(outcomes.cancelled, "2")) {
+      fail("pool", "a queued job was not cancelled before cancel returned");
+    }
+    if (pool.cancel(2) || pool.cancel(99)) {
+      fail("pool", "a job was cancelled twice or without being queued");
+    }
+
+    blockers.release.set_value();
+    if (!waitFor(finished, 4)) {
+      fail("pool", "the queued jobs did not finish");
+    }
+    for (const char *id : {"1", "3", "4"}) {
+      if (!outcomes.has(outcomes.ran, id) || outcomes.has(outcomes.cancelled, id)) {
+        fail("pool", std::string("job ") + id + " did not run");
+      }
+    }
+    if (outcomes.has(outcomes.ran, "2") || pool.cancel(1)) {
+      fail("pool", "a cancelled job ran, or a finished one was cancelled");
+    }
+  }
+
+  {
+    // The destructor cancels the queue before it joins the busy worker
+    Blockers blockers;
+    Outcomes outcomes;
+    std::atomic<size_t> finished{0};
+    auto pool = std::make_unique<WorkerPool>(1);
+    pool->submit(WorkerPool::kAnonymousJob, blockers.job());
+    if (!waitFor(blockers.started, 1)) {
+      fail("pool", "the worker did not start");
+    }
+
+    for (const char *id : {"1", "2", "3"}) {
+      pool->submit(std::stoull(id), recorded(outcomes, id, finished));
+    }
+    std::thread destroy([&] { pool.reset(); });
+    if (!waitFor(finished, 3)) {
+      fail("pool", "destroying the pool did not cancel its queue");
+    }
+    blockers.release.set_value();
+    destroy.join();
+    for (const char *id : {"1", "2", "3"}) {
+      if (!outcomes.has(outcomes.cancelled, id) || outcomes.has(outcomes.ran, id)) {
+        fail("pool", std::string("job ") + id + " queued at destruction was not cancelled");
+      }
+    }
+  }
+
+  {
+    // The resolve callbacks of the first requests block the workers, as
+    // many as there are cores, which is at least the size of the pool
+    Libprisma &libprisma = *gLibprisma;
+    const Sample &sample = gSamples.front();
+    const size_t blocking = std::max(1u, std::thread::hardware_concurrency());
+    Blockers blockers;
+    std::atomic<size_t> resolved{0};
+    for (size_t id = 1; id <= blocking; ++id) {
+      libprisma.tokenizeAsync(
+          id, sample.code, sample.language,
+          [&](std::string) {
+            blockers.released.wait();
+            ++resolved;
+          },
+          [](std::exception_ptr) { fail("tokenizeAsync", "a blocking request was rejected"); });
+    }
+
+    const uint64_t queued = blocking + 1;
+    std::string json;
+    std::exception_ptr error;
+    libprisma.tokenizeAsync(
+        queued, sample.code, sample.language,
+        [&](std::string result) { json = std::move(result); },
+        [&](std::exception_ptr e) { error = e; });
+
+    if (!libprisma.cancelTokenize(queued) || error == nullptr) {
+      fail("tokenizeAsync", "a queued request was not rejected by cancelTokenize");
+    }
+    try {
+      if (error) {
+        std::rethrow_exception(error);
+      }
+    } catch (const std::runtime_error &) {
+    } catch (...) {
+      fail("tokenizeAsync", "cancelTokenize rejected with an unexpected error");
+    }
+
+    blockers.release.set_value();
+    if (!waitFor(resolved, blocking)) {
+      fail("tokenizeAsync", "the blocking requests were not resolved");
+    }
+    if (!json.empty() || libprisma.cancelTokenize(queued) || libprisma.cancelTokenize(1)) {
+      fail("tokenizeAsync", "a cancelled request resolved, or a finished one was cancelled");
+    }
+
+    // Not cancelled, it resolves with the JSON of tokenizeToJson
+    std::promise<std::string> result;
+    libprisma.tokenizeAsync(
+        queued + 1, sample.code, sample.language,
+        [&](std::string json) { result.set_value(std::move(json)); },
+        [&](std::exception_ptr e) { result.set_exception(e); });
+    if (result.get_future().get() != libprisma.tokenizeToJson(sample.code, sample.language)) {
+      fail("tokenizeAsync", "the result differs from tokenizeToJson");
+    }
+  }
+}
+
+} // namespace test
+} // namespace libprisma
+} // namespace athex
@@ -22,6 +22,9 @@ struct LibprismaModule {
   /**
    * Tokenize source code into syntax-highlighted tokens.
    * Returns a JSON string representation.
+   * Arguments and result are std::string, so the JS strings are converted to
+   * and from UTF-8 once by the value reader and writer, without a wide string
+   * copy in between.
    *
    * @param code The source code to tokenize
    * @param language The language identifier (e.g., "javascript", "python",
@@ -29,21 +32,12 @@ struct LibprismaModule {
    * @return JSON string representing an array of tokens
    */
   REACT_METHOD(TokenizeToJson, L"tokenizeToJson")
-  std::wstring TokenizeToJson(std::wstring code,
-                              std::wstring language) noexcept {
+  std::string TokenizeToJson(std::string code, std::string language) noexcept {
     try {
-      // Convert wide string to UTF-8
-      std::string codeUtf8 = winrt::to_string(code);
-      std::string langUtf8 = winrt::to_string(language);
-
-      // Call C++ implementation
-      std::string resultUtf8 = m_libprisma->tokenizeToJson(codeUtf8, langUtf8);
-
-      // Convert back to wide string
-      return winrt::to_hstring(resultUtf8);
+      return m_libprisma->tokenizeToJson(code, language);
     } catch (const std::exception &ex) {
       // Return empty array on error
-      return L"[]";
+      return "[]";
     }
   }
 
@@ -54,13 +48,9 @@ struct LibprismaModule {
    * @param grammars Base64 encoded grammar data
    */
   REACT_METHOD(LoadGrammars, L"loadGrammars")
-  void LoadGrammars(std::wstring grammars) noexcept {
+  void LoadGrammars(std::string grammars) noexcept {
     try {
-      // Convert wide string to UTF-8
-      std::string grammarsUtf8 = winrt::to_string(grammars);
-
-      // Call C++ implementation
-      m_libprisma->loadGrammars(grammarsUtf8);
+      m_libprisma->loadGrammars(grammars);
     } catch (const std::exception &ex) {
       // Silently handle errors
     }